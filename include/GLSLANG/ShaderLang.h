@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 205
+#define ANGLE_SH_VERSION 211
 
 enum ShShaderSpec
 {
@@ -274,6 +274,33 @@ const ShCompileOptions SH_EMULATE_GL_DRAW_ID = UINT64_C(1) << 40;
 // another webpage/application.
 const ShCompileOptions SH_INIT_SHARED_VARIABLES = UINT64_C(1) << 41;
 
+// Also generate SPIR-V directly from the AST when translating ESSL 1.00 shaders to Vulkan GLSL.
+// The SPIR-V is retrieved with GetSPIRVCode(), and is only generated if the shader doesn't use
+// anything the generator doesn't support.
+const ShCompileOptions SH_GENERATE_SPIRV = UINT64_C(1) << 42;
+
+// Optimize the AST before translating it: reuse the values of local variables instead of
+// recomputing the same expressions, propagate constants and copies of variables, and remove dead
+// code and stores. This cleans up the temporary variables that other AST transformations add.
+const ShCompileOptions SH_OPTIMIZE_AST = UINT64_C(1) << 43;
+
+// Keep the AST of the shader after parsing and the simplifications that don't depend on the rest of
+// the compile options. Compiling the same source again with this flag, for example with different
+// workaround flags, then starts from a copy of the kept AST instead of parsing the source. Only the
+// most recently parsed shader is kept. Has no effect together with SH_REGENERATE_STRUCT_NAMES.
+const ShCompileOptions SH_REUSE_PARSED_SHADER = UINT64_C(1) << 44;
+
+// Write the code of function definitions on several threads when the shader has many functions.
+// The output is the same as without the flag. Only affects GLSL and ESSL output, and has no effect
+// when names are hashed.
+const ShCompileOptions SH_PARALLEL_FUNCTION_OUTPUT = UINT64_C(1) << 45;
+
+// Remove the vertex shader outputs set with sh::SetUnusedOutputVaryings, together with the code
+// that only computes their values. Meant for translating a vertex shader again at link time, once
+// it's known which of its outputs the fragment shader doesn't read. The variables collected with
+// SH_VARIABLES still include the removed outputs.
+const ShCompileOptions SH_REMOVE_UNUSED_OUTPUT_VARYINGS = UINT64_C(1) << 46;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -548,6 +575,22 @@ bool Compile(const ShHandle handle,
              size_t numStrings,
              ShCompileOptions compileOptions);
 
+// Sets the names of the output varyings that SH_REMOVE_UNUSED_OUTPUT_VARYINGS removes in the
+// following compilations.
+// Parameters:
+// handle: Specifies the compiler
+// names: The names of the varyings as declared in the shader. Names that don't match a user-defined
+//        output varying are ignored.
+void SetUnusedOutputVaryings(const ShHandle handle, const std::vector<std::string> &names);
+
+// Sets the number of threads that write function definitions with SH_PARALLEL_FUNCTION_OUTPUT in
+// the following compilations. It only affects how the output is produced, not its contents.
+// Parameters:
+// handle: Specifies the compiler
+// threadCount: 0 uses one thread per CPU core, which is the default. Fewer threads are used for
+//              shaders with few functions.
+void SetFunctionOutputThreadCount(const ShHandle handle, int threadCount);
+
 // Clears the results from the previous compilation.
 void ClearResults(const ShHandle handle);
 
@@ -642,6 +685,14 @@ unsigned int GetImage2DRegisterIndex(const ShHandle handle);
 // handle: Specifies the compiler
 const std::set<std::string> *GetUsedImage2DFunctionNames(const ShHandle handle);
 
+// Returns the SPIR-V generated with SH_GENERATE_SPIRV, with or without the line raster emulation
+// code, or nullptr if none was generated.  The Location, DescriptorSet and Binding decorations of
+// the shader interface are placeholders to be assigned when the program is linked.
+// Parameters:
+// handle: Specifies the compiler
+// lineRasterEmulation: Whether to return the variant with line raster emulation
+const std::vector<uint32_t> *GetSPIRVCode(const ShHandle handle, bool lineRasterEmulation);
+
 bool HasValidGeometryShaderInputPrimitiveType(const ShHandle handle);
 bool HasValidGeometryShaderOutputPrimitiveType(const ShHandle handle);
 bool HasValidGeometryShaderMaxVertices(const ShHandle handle);
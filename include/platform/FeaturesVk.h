@@ -62,6 +62,25 @@ struct FeaturesVk
     // Intel drivers on windows that have an issue with creating single-layer views on cube map
     // textures.
     bool forceCpuPathForCubeMapCopy = false;
+
+    // Whether the VkDevice can import dma-bufs as image memory through VK_KHR_external_memory_fd
+    // and VK_EXT_external_memory_dma_buf, on which EGL_EXT_image_dma_buf_import is layered.
+    bool supportsExternalMemoryDmaBuf = false;
+
+    // Whether transform feedback is exposed, emulated by having the vertex shader of programs that
+    // capture varyings write them to storage buffers.  Requires the vertexPipelineStoresAndAtomics
+    // device feature.
+    bool emulateTransformFeedback = false;
+
+    // Whether shaders are translated straight to SPIR-V, leaving only their locations and bindings
+    // to be assigned at link time, instead of compiling the translated GLSL with glslang when the
+    // program is linked.  Shaders the SPIR-V generator doesn't support still use glslang.
+    bool directSPIRVGeneration = false;
+
+    // Whether the vertex shader is translated again when a program is linked, without the outputs
+    // that the fragment shader doesn't read and the code that computes them.  Only applies when the
+    // translated GLSL is compiled with glslang.
+    bool removeUnusedVertexOutputs = false;
 };
 
 }  // namespace angle
@@ -32,6 +32,7 @@ static bool CompileFile(char *fileName, ShHandle compiler, ShCompileOptions comp
 static void LogMsg(const char *msg, const char *name, const int num, const char *logName);
 static void PrintVariable(const std::string &prefix, size_t index, const sh::ShaderVariable &var);
 static void PrintActiveVariables(ShHandle compiler);
+static void PrintSPIRV(const std::vector<uint32_t> *spirv);
 
 // If NUM_SOURCE_STRINGS is set to a value > 1, the input file data is
 // broken into that many chunks. This will affect file/line numbering in
@@ -97,6 +98,8 @@ int main(int argc, char *argv[])
               case 'o': compileOptions |= SH_OBJECT_CODE; break;
               case 'u': compileOptions |= SH_VARIABLES; break;
               case 'p': resources.WEBGL_debug_shader_precision = 1; break;
+              case 'O': compileOptions |= SH_OPTIMIZE_AST; break;
+              case 'P': compileOptions |= SH_PARALLEL_FUNCTION_OUTPUT; break;
               case 's':
                 if (argv[0][2] == '=')
                 {
@@ -163,6 +166,14 @@ int main(int argc, char *argv[])
                             }
                             compileOptions |= SH_INITIALIZE_UNINITIALIZED_LOCALS;
                             break;
+                        case 'v':
+                            output = SH_GLSL_VULKAN_OUTPUT;
+                            compileOptions |= SH_INITIALIZE_UNINITIALIZED_LOCALS;
+                            if (argv[0][4] == 's')
+                            {
+                                compileOptions |= SH_GENERATE_SPIRV;
+                            }
+                            break;
                         case 'h':
                             if (argv[0][4] == '1' && argv[0][5] == '1')
                             {
@@ -310,6 +321,13 @@ int main(int argc, char *argv[])
                     LogMsg("END", "COMPILER", numCompiles, "OBJ CODE");
                     printf("\n\n");
                 }
+                if (compiled && (compileOptions & SH_GENERATE_SPIRV))
+                {
+                    LogMsg("BEGIN", "COMPILER", numCompiles, "SPIR-V");
+                    PrintSPIRV(sh::GetSPIRVCode(compiler, false));
+                    LogMsg("END", "COMPILER", numCompiles, "SPIR-V");
+                    printf("\n\n");
+                }
                 if (compiled && (compileOptions & SH_VARIABLES))
                 {
                     LogMsg("BEGIN", "COMPILER", numCompiles, "VARIABLES");
@@ -355,12 +373,14 @@ void usage()
 {
     // clang-format off
     printf(
-        "Usage: translate [-i -o -u -l -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "Usage: translate [-i -o -u -l -p -O -P -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
         "Where: filename : filename ending in .frag or .vert\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
         "       -u       : print active attribs, uniforms, varyings and program outputs\n"
         "       -p       : use precision emulation\n"
+        "       -O       : optimize the AST before translating it\n"
+        "       -P       : write the code of functions on several threads\n"
         "       -s=e2    : use GLES2 spec (this is by default)\n"
         "       -s=e3    : use GLES3 spec\n"
         "       -s=e31   : use GLES31 spec (in development)\n"
@@ -371,6 +391,8 @@ void usage()
         "       -b=g     : output GLSL code (compatibility profile)\n"
         "       -b=g[NUM]: output GLSL code (NUM can be 130, 140, 150, 330, 400, 410, 420, 430, "
         "440, 450)\n"
+        "       -b=v     : output Vulkan GLSL code\n"
+        "       -b=vs    : output Vulkan GLSL code, and SPIR-V words for ESSL 1.00 shaders\n"
         "       -b=h9    : output HLSL9 code\n"
         "       -b=h11   : output HLSL11 code\n"
         "       -x=i     : enable GL_OES_EGL_image_external\n"
@@ -592,6 +614,21 @@ void PrintVariable(const std::string &prefix, size_t index, const sh::ShaderVari
     }
 }
 
+static void PrintSPIRV(const std::vector<uint32_t> *spirv)
+{
+    if (spirv == nullptr)
+    {
+        printf("SPIR-V not generated, the shader isn't supported by the SPIR-V generator\n");
+        return;
+    }
+
+    for (size_t index = 0; index < spirv->size(); ++index)
+    {
+        printf("0x%08x%s", (*spirv)[index], (index % 8 == 7) ? ",\n" : ", ");
+    }
+    printf("\n");
+}
+
 static void PrintActiveVariables(ShHandle compiler)
 {
     const std::vector<sh::Uniform> *uniforms       = sh::GetUniforms(compiler);
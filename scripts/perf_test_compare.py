@@ -0,0 +1,73 @@
+#!/usr/bin/python2
+#
+# Copyright 2019 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+# perf_test_compare.py:
+#   Compares two results files written by angle_perftests --results-file and flags the tests
+#   whose median time per iteration changed significantly. A change is significant when the 95%
+#   confidence intervals of the two medians don't overlap and the medians differ by more than the
+#   threshold. Exits with 1 if any test regressed.
+#
+#   Usage: perf_test_compare.py baseline.json new.json [--threshold 0.05]
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+    with open(path) as results_file:
+        results = json.load(results_file)['results']
+    return dict(((result['name'], result['backend']), result) for result in results)
+
+
+def compare(baseline, new, threshold):
+    """Returns -1 for an improvement, 1 for a regression and 0 otherwise."""
+    change = float(new['median'] - baseline['median']) / baseline['median']
+    if abs(change) <= threshold:
+        return 0
+    if new['median_ci_low'] > baseline['median_ci_high']:
+        return 1
+    if new['median_ci_high'] < baseline['median_ci_low']:
+        return -1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two angle_perftests results files.')
+    parser.add_argument('baseline', help='Results of the reference run.')
+    parser.add_argument('new', help='Results of the run to check.')
+    parser.add_argument(
+        '--threshold',
+        type=float,
+        default=0.05,
+        help='Smallest relative change of the median that is reported.')
+    args = parser.parse_args()
+
+    baseline_results = load_results(args.baseline)
+    new_results = load_results(args.new)
+
+    verdicts = {-1: 'improved', 0: '', 1: 'REGRESSED'}
+    regressions = 0
+    for key in sorted(set(baseline_results) & set(new_results)):
+        baseline = baseline_results[key]
+        new = new_results[key]
+        verdict = compare(baseline, new, args.threshold)
+        if verdict > 0:
+            regressions += 1
+
+        change = 100.0 * float(new['median'] - baseline['median']) / baseline['median']
+        print('%-60s %12.2f ns -> %12.2f ns (%+6.1f%%) %s' %
+              (key[0] + key[1], baseline['median'], new['median'], change, verdicts[verdict]))
+
+    for key in sorted(set(baseline_results) ^ set(new_results)):
+        print('%-60s only in one of the runs' % (key[0] + key[1]))
+
+    print('%d regression(s) found.' % regressions)
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -101,8 +101,16 @@ generators = {
     },
     'GL format map': {
         'inputs': [
+            'include/GLES2/gl2.h',
+            'include/GLES2/gl2ext.h',
+            'include/GLES2/gl2ext_angle.h',
+            'include/GLES3/gl3.h',
+            'include/GLES3/gl31.h',
+            'include/GLES3/gl32.h',
+            'src/common/angleutils.h',
             'src/libANGLE/es3_format_type_combinations.json',
             'src/libANGLE/format_map_data.json',
+            'src/libANGLE/formatutils.cpp',
         ],
         'script': 'src/libANGLE/gen_format_map.py',
     },
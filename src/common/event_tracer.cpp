@@ -4,13 +4,63 @@
 
 #include "common/event_tracer.h"
 
+#include <cstdlib>
+
 #include "common/debug.h"
+#include "common/system_utils.h"
+#include "common/trace_recorder.h"
 
 namespace angle
 {
+namespace
+{
+constexpr char kTraceCategoriesEnv[] = "ANGLE_TRACE_CATEGORIES";
+constexpr char kTraceFileEnv[]       = "ANGLE_TRACE_FILE";
+constexpr char kDefaultTraceFile[]   = "angle_trace.json";
+
+std::string GetTraceFilePath()
+{
+    std::string path = GetEnvironmentVar(kTraceFileEnv);
+    return path.empty() ? kDefaultTraceFile : path;
+}
+
+void WriteTraceAtExit();
+
+// Setting ANGLE_TRACE_CATEGORIES records the listed categories in memory instead of sending them to
+// the platform, and writes them to ANGLE_TRACE_FILE at exit.  The recorder is never deleted, since
+// trace events may be added until the very end of the process.
+TraceRecorder *GetTraceRecorder()
+{
+    static TraceRecorder *recorder = []() -> TraceRecorder * {
+        std::string categories = GetEnvironmentVar(kTraceCategoriesEnv);
+        if (categories.empty())
+        {
+            return nullptr;
+        }
+        std::atexit(WriteTraceAtExit);
+        return new TraceRecorder(categories);
+    }();
+    return recorder;
+}
+
+void WriteTraceAtExit()
+{
+    std::string path = GetTraceFilePath();
+    if (!GetTraceRecorder()->writeJSONFile(path.c_str()))
+    {
+        WARN() << "Failed to write the trace to " << path;
+    }
+}
+}  // anonymous namespace
 
 const unsigned char *GetTraceCategoryEnabledFlag(const char *name)
 {
+    TraceRecorder *recorder = GetTraceRecorder();
+    if (recorder != nullptr)
+    {
+        return recorder->getCategoryEnabledFlag(name);
+    }
+
     auto *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
@@ -35,6 +85,14 @@ angle::TraceEventHandle AddTraceEvent(char phase,
                                       const unsigned long long *argValues,
                                       unsigned char flags)
 {
+    TraceRecorder *recorder = GetTraceRecorder();
+    if (recorder != nullptr)
+    {
+        recorder->addEvent(phase, categoryGroupEnabled, name, id, recorder->currentTime(), numArgs,
+                           argNames, argTypes, argValues, flags);
+        return static_cast<angle::TraceEventHandle>(0);
+    }
+
     auto *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
@@ -51,4 +109,16 @@ angle::TraceEventHandle AddTraceEvent(char phase,
     return static_cast<angle::TraceEventHandle>(0);
 }
 
+bool WriteRecordedTraceEvents(const char *path)
+{
+    TraceRecorder *recorder = GetTraceRecorder();
+    if (recorder == nullptr)
+    {
+        return false;
+    }
+
+    std::string filePath = path != nullptr ? path : GetTraceFilePath();
+    return recorder->writeJSONFile(filePath.c_str());
+}
+
 }  // namespace angle
@@ -21,6 +21,10 @@ angle::TraceEventHandle AddTraceEvent(char phase,
                                       const unsigned char *argTypes,
                                       const unsigned long long *argValues,
                                       unsigned char flags);
+
+// Writes the events recorded so far when ANGLE_TRACE_CATEGORIES is set, to |path| or to
+// ANGLE_TRACE_FILE if it is null.  Returns false if nothing is being recorded or the write fails.
+bool WriteRecordedTraceEvents(const char *path);
 }  // namespace angle
 
 #endif  // COMMON_EVENT_TRACER_H_
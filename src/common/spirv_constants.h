@@ -0,0 +1,55 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// spirv_constants.h:
+//   Helpers for the SPIR-V modules generated by the translator and patched by the Vulkan back-end.
+//   The SPIR-V and GLSL.std.450 enums come from the SPIRV-Headers registry headers, and are
+//   available in angle::spirv along with the helpers.
+//
+
+#ifndef COMMON_SPIRV_CONSTANTS_H_
+#define COMMON_SPIRV_CONSTANTS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <spirv/unified1/GLSL.std.450.h>
+#include <spirv/unified1/spirv.hpp>
+
+namespace angle
+{
+namespace spirv
+{
+using namespace ::spv;
+
+// The generated modules target SPIR-V 1.0, whatever the version of the headers.
+constexpr uint32_t kVersion1_0 = 0x00010000;
+// Generator id 0 is "unknown", which is what tools that aren't registered with Khronos use.
+constexpr uint32_t kGenerator = 0;
+
+// A module starts with the magic number, version, generator, id bound and a reserved word.
+constexpr size_t kHeaderWordCount  = 5;
+constexpr size_t kHeaderBoundIndex = 3;
+
+// The first word of every instruction holds its word count in the high 16 bits and its opcode in
+// the low 16 bits.
+inline uint32_t GetOpCode(uint32_t firstWord)
+{
+    return firstWord & OpCodeMask;
+}
+
+inline uint32_t GetWordCount(uint32_t firstWord)
+{
+    return firstWord >> WordCountShift;
+}
+
+inline uint32_t MakeFirstWord(Op op, size_t wordCount)
+{
+    return static_cast<uint32_t>(wordCount) << WordCountShift | static_cast<uint32_t>(op);
+}
+}  // namespace spirv
+}  // namespace angle
+
+#endif  // COMMON_SPIRV_CONSTANTS_H_
@@ -35,6 +35,11 @@ static vector<DWORD> freeTlsIndices;
 #endif
 
 TLSIndex CreateTLSIndex()
+{
+    return CreateTLSIndex(nullptr);
+}
+
+TLSIndex CreateTLSIndex(TLSDestructor destructor)
 {
     TLSIndex index;
 
@@ -56,7 +61,7 @@ TLSIndex CreateTLSIndex()
 
 #elif defined(ANGLE_PLATFORM_POSIX)
     // Create global pool key
-    if ((pthread_key_create(&index, nullptr)) != 0)
+    if ((pthread_key_create(&index, destructor)) != 0)
     {
         index = TLS_INVALID_INDEX;
     }
@@ -34,10 +34,12 @@ typedef pthread_key_t TLSIndex;
 #    error Unsupported platform.
 #endif
 
-// TODO(kbr): for POSIX platforms this will have to be changed to take
-// in a destructor function pointer, to allow the thread-local storage
-// to be properly deallocated upon thread exit.
+// Called with the thread's value when a thread that set a non-null value exits. Only supported on
+// POSIX platforms; elsewhere the destructor is never called.
+typedef void (*TLSDestructor)(void *value);
+
 TLSIndex CreateTLSIndex();
+TLSIndex CreateTLSIndex(TLSDestructor destructor);
 bool DestroyTLSIndex(TLSIndex index);
 
 bool SetTLSValue(TLSIndex index, void *value);
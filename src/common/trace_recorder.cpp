@@ -0,0 +1,538 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_recorder.cpp:
+//   Implements the TraceRecorder class.
+//
+
+#include "common/trace_recorder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "common/string_utils.h"
+
+namespace angle
+{
+namespace
+{
+// The values of the flags and argument types documented with AddTraceEventFunc in Platform.h.
+constexpr unsigned char kFlagCopy  = 1 << 0;
+constexpr unsigned char kFlagHasId = 1 << 1;
+
+enum ArgType : unsigned char
+{
+    kArgTypeBool       = 1,
+    kArgTypeUint       = 2,
+    kArgTypeInt        = 3,
+    kArgTypeDouble     = 4,
+    kArgTypePointer    = 5,
+    kArgTypeString     = 6,
+    kArgTypeCopyString = 7,
+};
+
+static_assert((TraceRecorder::kEventsPerThread & (TraceRecorder::kEventsPerThread - 1)) == 0,
+              "The ring buffer size must be a power of two");
+static_assert((TraceRecorder::kEventsPerChunk & (TraceRecorder::kEventsPerChunk - 1)) == 0 &&
+                  TraceRecorder::kEventsPerChunk <= TraceRecorder::kEventsPerThread,
+              "The chunk size must be a power of two that divides the ring buffer size");
+static_assert(TraceRecorder::kCopiedStringBytes <= 256,
+              "Copied strings are addressed with unsigned char offsets");
+
+constexpr size_t kChunksPerThread =
+    TraceRecorder::kEventsPerThread / TraceRecorder::kEventsPerChunk;
+
+constexpr size_t kEventWords =
+    (sizeof(TraceRecorder::Event) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+// A slot of a thread's ring buffer.  Other threads copy events while the owning thread may be
+// overwriting them, so the event is stored in atomic words, and the sequence number tells whether
+// the copy is of a complete event: it's 2 * index + 1 while event |index| is being written to the
+// slot, and 2 * index + 2 once it's complete.
+class EventSlot final : angle::NonCopyable
+{
+  public:
+    void store(uint64_t index, const TraceRecorder::Event &event)
+    {
+        uint64_t words[kEventWords] = {};
+        memcpy(words, &event, sizeof(event));
+
+        // A reader that sees any of the new words also sees the odd sequence number.
+        mSequence.store(index * 2 + 1, std::memory_order_relaxed);
+        for (size_t wordIndex = 0; wordIndex < kEventWords; ++wordIndex)
+        {
+            mWords[wordIndex].store(words[wordIndex], std::memory_order_release);
+        }
+        mSequence.store(index * 2 + 2, std::memory_order_release);
+    }
+
+    // Returns false if the slot doesn't hold the complete event |index|, or if it was changed
+    // during the copy.
+    bool load(uint64_t index, TraceRecorder::Event *eventOut) const
+    {
+        uint64_t sequence = index * 2 + 2;
+        if (mSequence.load(std::memory_order_acquire) != sequence)
+        {
+            return false;
+        }
+
+        uint64_t words[kEventWords];
+        for (size_t wordIndex = 0; wordIndex < kEventWords; ++wordIndex)
+        {
+            words[wordIndex] = mWords[wordIndex].load(std::memory_order_acquire);
+        }
+        if (mSequence.load(std::memory_order_relaxed) != sequence)
+        {
+            return false;
+        }
+
+        memcpy(eventOut, words, sizeof(*eventOut));
+        return true;
+    }
+
+  private:
+    std::atomic<uint64_t> mSequence;
+    std::array<std::atomic<uint64_t>, kEventWords> mWords;
+};
+
+struct EventChunk
+{
+    std::array<EventSlot, TraceRecorder::kEventsPerChunk> slots;
+};
+
+// Appends |str| to the copied strings of |event| at |*usedBytes|, truncated to the space left, and
+// returns its offset.  The last byte is never written, so it's the empty string once space runs
+// out.
+unsigned char CopyEventString(TraceRecorder::Event *event, size_t *usedBytes, const char *str)
+{
+    constexpr size_t kLastByte = TraceRecorder::kCopiedStringBytes - 1;
+    size_t offset              = *usedBytes;
+    if (str == nullptr || offset >= kLastByte)
+    {
+        return static_cast<unsigned char>(kLastByte);
+    }
+
+    size_t length = 0;
+    while (str[length] != '\0' && offset + length + 1 < kLastByte)
+    {
+        event->copiedStrings[offset + length] = str[length];
+        ++length;
+    }
+    event->copiedStrings[offset + length] = '\0';
+
+    *usedBytes = offset + length + 1;
+    return static_cast<unsigned char>(offset);
+}
+
+void WriteJSONString(const char *str, std::ostream &out)
+{
+    out << '"';
+    for (; str != nullptr && *str != '\0'; ++str)
+    {
+        switch (*str)
+        {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            default:
+                if (static_cast<unsigned char>(*str) >= 0x20)
+                {
+                    out << *str;
+                }
+                break;
+        }
+    }
+    out << '"';
+}
+
+void WriteJSONArgValue(const TraceRecorder::Event &event, size_t argIndex, std::ostream &out)
+{
+    unsigned long long value = event.argValues[argIndex];
+    switch (event.argTypes[argIndex])
+    {
+        case kArgTypeBool:
+            out << (value != 0 ? "true" : "false");
+            break;
+        case kArgTypeUint:
+            out << value;
+            break;
+        case kArgTypeInt:
+            out << static_cast<long long>(value);
+            break;
+        case kArgTypeDouble:
+        {
+            double doubleValue;
+            memcpy(&doubleValue, &value, sizeof(doubleValue));
+            out << doubleValue;
+            break;
+        }
+        case kArgTypePointer:
+            out << "\"0x" << std::hex << value << std::dec << '"';
+            break;
+        case kArgTypeString:
+        case kArgTypeCopyString:
+            WriteJSONString(event.getStringArg(argIndex), out);
+            break;
+        default:
+            out << "null";
+            break;
+    }
+}
+}  // anonymous namespace
+
+constexpr size_t TraceRecorder::kMaxArgs;
+constexpr size_t TraceRecorder::kMaxCategories;
+constexpr size_t TraceRecorder::kEventsPerThread;
+constexpr size_t TraceRecorder::kEventsPerChunk;
+constexpr size_t TraceRecorder::kMaxThreadBuffers;
+constexpr size_t TraceRecorder::kCopiedStringBytes;
+
+const char *TraceRecorder::Event::getName() const
+{
+    return (flags & kFlagCopy) != 0 ? &copiedStrings[nameOffset] : name;
+}
+
+const char *TraceRecorder::Event::getArgName(size_t argIndex) const
+{
+    return (flags & kFlagCopy) != 0 ? &copiedStrings[argNameOffsets[argIndex]]
+                                    : argNames[argIndex];
+}
+
+const char *TraceRecorder::Event::getStringArg(size_t argIndex) const
+{
+    switch (argTypes[argIndex])
+    {
+        case kArgTypeString:
+            return reinterpret_cast<const char *>(static_cast<uintptr_t>(argValues[argIndex]));
+        case kArgTypeCopyString:
+            return &copiedStrings[argValues[argIndex]];
+        default:
+            return nullptr;
+    }
+}
+
+struct TraceRecorder::ThreadBuffer
+{
+    ~ThreadBuffer()
+    {
+        for (std::atomic<EventChunk *> &chunk : chunks)
+        {
+            delete chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Returns null if the chunk of slot |index| hasn't been allocated yet.
+    const EventSlot *getSlot(uint64_t index) const
+    {
+        const EventChunk *chunk =
+            chunks[(index / kEventsPerChunk) % kChunksPerThread].load(std::memory_order_acquire);
+        return chunk != nullptr ? &chunk->slots[index & (kEventsPerChunk - 1)] : nullptr;
+    }
+
+    // Only called by the owning thread, which allocates the chunks.
+    EventSlot *getOrAllocateSlot(uint64_t index)
+    {
+        std::atomic<EventChunk *> &chunk = chunks[(index / kEventsPerChunk) % kChunksPerThread];
+        EventChunk *slots                = chunk.load(std::memory_order_relaxed);
+        if (slots == nullptr)
+        {
+            slots = new EventChunk();
+            chunk.store(slots, std::memory_order_release);
+        }
+        return &slots->slots[index & (kEventsPerChunk - 1)];
+    }
+
+    TraceRecorder *recorder;
+
+    // Only written by the owning thread, which changes when the buffer is reused.
+    uint32_t threadId;
+
+    // Only written by the owning thread.  Event |index| is in slot index % kEventsPerThread.  The
+    // index keeps counting up when the buffer is reused, so readers never confuse an old event
+    // with a new one.
+    std::atomic<uint64_t> writeIndex;
+    std::array<std::atomic<EventChunk *>, kChunksPerThread> chunks;
+};
+
+TraceRecorder::TraceRecorder(const std::string &categories)
+    : mEnabledCategories(SplitString(categories, ",", TRIM_WHITESPACE, SPLIT_WANT_NONEMPTY)),
+      mAllCategoriesEnabled(std::find(mEnabledCategories.begin(), mEnabledCategories.end(), "*") !=
+                            mEnabledCategories.end()),
+      mStartTime(std::chrono::steady_clock::now()),
+      mCategories{},
+      mCategoryCount(0),
+      mDisabledFlag(0),
+      mThreadBufferIndex(CreateTLSIndex(OnThreadExit)),
+      mThreadCount(0)
+{}
+
+TraceRecorder::~TraceRecorder()
+{
+    DestroyTLSIndex(mThreadBufferIndex);
+}
+
+const unsigned char *TraceRecorder::getCategoryEnabledFlag(const char *categoryName)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (size_t index = 0; index < mCategoryCount; ++index)
+    {
+        if (strcmp(mCategories[index].name, categoryName) == 0)
+        {
+            return &mCategories[index].enabled;
+        }
+    }
+
+    bool enabled = mAllCategoriesEnabled ||
+                   std::find(mEnabledCategories.begin(), mEnabledCategories.end(), categoryName) !=
+                       mEnabledCategories.end();
+    if (!enabled || mCategoryCount == kMaxCategories)
+    {
+        return &mDisabledFlag;
+    }
+
+    // Category names are long-lived literals, as with the platform's trace category flags.
+    Category &category = mCategories[mCategoryCount++];
+    category.enabled   = 1;
+    category.name      = categoryName;
+    return &category.enabled;
+}
+
+void TraceRecorder::addEvent(char phase,
+                             const unsigned char *categoryEnabledFlag,
+                             const char *name,
+                             unsigned long long id,
+                             double timestamp,
+                             int numArgs,
+                             const char **argNames,
+                             const unsigned char *argTypes,
+                             const unsigned long long *argValues,
+                             unsigned char flags)
+{
+    if (categoryEnabledFlag == &mDisabledFlag)
+    {
+        return;
+    }
+
+    ThreadBuffer *buffer = getThreadBuffer();
+    if (buffer == nullptr)
+    {
+        return;
+    }
+
+    // The enabled flag is the first member of its category.
+    static_assert(offsetof(Category, enabled) == 0, "Category::enabled must be the first member");
+    const Category *category = reinterpret_cast<const Category *>(categoryEnabledFlag);
+
+    bool copyStrings = (flags & kFlagCopy) != 0;
+    size_t argCount  = std::min<size_t>(std::max(numArgs, 0), kMaxArgs);
+
+    Event event        = {};
+    event.timestamp    = timestamp;
+    event.categoryName = category->name;
+    event.id           = id;
+    event.numArgs      = static_cast<unsigned char>(argCount);
+    event.flags        = flags;
+    event.phase        = phase;
+    event.threadId     = buffer->threadId;
+
+    // The caller may free copied strings as soon as this returns.
+    size_t copiedBytes = 0;
+    if (copyStrings)
+    {
+        event.nameOffset = CopyEventString(&event, &copiedBytes, name);
+    }
+    else
+    {
+        event.name = name;
+    }
+
+    for (size_t argIndex = 0; argIndex < event.numArgs; ++argIndex)
+    {
+        if (copyStrings)
+        {
+            event.argNameOffsets[argIndex] =
+                CopyEventString(&event, &copiedBytes, argNames[argIndex]);
+        }
+        else
+        {
+            event.argNames[argIndex] = argNames[argIndex];
+        }
+
+        event.argTypes[argIndex]  = argTypes[argIndex];
+        event.argValues[argIndex] = argValues[argIndex];
+        if (argTypes[argIndex] == kArgTypeCopyString)
+        {
+            const char *value =
+                reinterpret_cast<const char *>(static_cast<uintptr_t>(argValues[argIndex]));
+            event.argValues[argIndex] = CopyEventString(&event, &copiedBytes, value);
+        }
+    }
+
+    uint64_t writeIndex = buffer->writeIndex.load(std::memory_order_relaxed);
+    buffer->getOrAllocateSlot(writeIndex)->store(writeIndex, event);
+    buffer->writeIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+double TraceRecorder::currentTime() const
+{
+    using Seconds = std::chrono::duration<double>;
+    return std::chrono::duration_cast<Seconds>(std::chrono::steady_clock::now() - mStartTime)
+        .count();
+}
+
+std::vector<TraceRecorder::Event> TraceRecorder::getEvents(double startTime, double endTime) const
+{
+    std::vector<Event> events;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (const std::unique_ptr<ThreadBuffer> &buffer : mThreadBuffers)
+    {
+        // The slot of event endIndex - kEventsPerThread may already be getting event endIndex.
+        uint64_t endIndex   = buffer->writeIndex.load(std::memory_order_acquire);
+        uint64_t startIndex = endIndex >= kEventsPerThread ? endIndex - kEventsPerThread + 1 : 0;
+
+        // A thread adds its events in timestamp order, so walk back from the newest one until the
+        // window is passed.  That keeps snapshots of a recent window cheap.  The thread overwrites
+        // its oldest events first, so once one is gone, so are all the ones before it.
+        size_t firstCopied = events.size();
+        for (uint64_t index = endIndex; index > startIndex; --index)
+        {
+            Event event;
+            const EventSlot *slot = buffer->getSlot(index - 1);
+            if (slot == nullptr || !slot->load(index - 1, &event) || event.timestamp < startTime)
+            {
+                break;
+            }
+            if (event.timestamp <= endTime)
+            {
+                events.push_back(event);
+            }
+        }
+        std::reverse(events.begin() + firstCopied, events.end());
+    }
+
+    return events;
+}
+
+std::vector<TraceRecorder::Event> TraceRecorder::getEvents() const
+{
+    return getEvents(0.0, std::numeric_limits<double>::infinity());
+}
+
+// static
+void TraceRecorder::WriteJSON(const std::vector<Event> &events, std::ostream &out)
+{
+    out << "{\"traceEvents\":[";
+
+    const char *separator = "\n";
+    for (const Event &event : events)
+    {
+        out << separator << "{\"name\":";
+        WriteJSONString(event.getName(), out);
+        out << ",\"cat\":";
+        WriteJSONString(event.categoryName, out);
+        out << ",\"ph\":\"" << event.phase << "\",\"ts\":" << event.timestamp * 1e6
+            << ",\"pid\":1,\"tid\":" << event.threadId;
+
+        if ((event.flags & kFlagHasId) != 0)
+        {
+            out << ",\"id\":\"0x" << std::hex << event.id << std::dec << '"';
+        }
+
+        if (event.numArgs > 0)
+        {
+            out << ",\"args\":{";
+            for (size_t argIndex = 0; argIndex < event.numArgs; ++argIndex)
+            {
+                if (argIndex > 0)
+                {
+                    out << ',';
+                }
+                WriteJSONString(event.getArgName(argIndex), out);
+                out << ':';
+                WriteJSONArgValue(event, argIndex, out);
+            }
+            out << '}';
+        }
+
+        out << '}';
+        separator = ",\n";
+    }
+
+    out << "\n]}\n";
+}
+
+bool TraceRecorder::writeJSONFile(const char *path) const
+{
+    std::ofstream outFile(path);
+    if (!outFile)
+    {
+        return false;
+    }
+
+    WriteJSON(getEvents(), outFile);
+    return outFile.good();
+}
+
+TraceRecorder::ThreadBuffer *TraceRecorder::getThreadBuffer()
+{
+    ThreadBuffer *buffer = static_cast<ThreadBuffer *>(GetTLSValue(mThreadBufferIndex));
+    if (buffer != nullptr)
+    {
+        return buffer;
+    }
+
+    if (mThreadBufferIndex == TLS_INVALID_INDEX)
+    {
+        return nullptr;
+    }
+
+    // The buffer outlives its thread so that its events can still be written out after it exits,
+    // until a new thread takes it over.
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mFreeThreadBuffers.empty())
+    {
+        buffer = mFreeThreadBuffers.back();
+        mFreeThreadBuffers.pop_back();
+    }
+    else if (mThreadBuffers.size() < kMaxThreadBuffers)
+    {
+        mThreadBuffers.emplace_back(new ThreadBuffer());
+        buffer           = mThreadBuffers.back().get();
+        buffer->recorder = this;
+        buffer->writeIndex.store(0, std::memory_order_relaxed);
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    buffer->threadId = ++mThreadCount;
+    SetTLSValue(mThreadBufferIndex, buffer);
+    return buffer;
+}
+
+// static
+void TraceRecorder::OnThreadExit(void *threadBuffer)
+{
+    ThreadBuffer *buffer    = static_cast<ThreadBuffer *>(threadBuffer);
+    TraceRecorder *recorder = buffer->recorder;
+
+    std::lock_guard<std::mutex> lock(recorder->mMutex);
+    recorder->mFreeThreadBuffers.push_back(buffer);
+}
+
+}  // namespace angle
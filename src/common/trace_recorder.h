@@ -0,0 +1,136 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_recorder.h:
+//   Records trace events in memory and writes them out in the Chrome trace event JSON format, for
+//   when there is no embedder collecting them through the platform methods.
+//
+
+#ifndef COMMON_TRACE_RECORDER_H_
+#define COMMON_TRACE_RECORDER_H_
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/tls.h"
+
+namespace angle
+{
+
+// Each thread that adds events gets its own ring buffer, which it writes without taking any locks.
+// Only the most recent kEventsPerThread - 1 events of a thread can be read back, since the slot of
+// the oldest one is the next to be written.  A ring buffer is allocated a chunk at a time as it
+// fills, and at most kMaxThreadBuffers exist at once; threads beyond that don't record.  Where
+// thread exit can be observed, the buffer of an exited thread is reused by the next new thread.
+//
+// Strings passed with the COPY flag, and arguments of the copied string type, are copied into the
+// event, truncated to fit in kCopiedStringBytes in total.
+class TraceRecorder final : angle::NonCopyable
+{
+  public:
+    static constexpr size_t kMaxArgs           = 2;
+    static constexpr size_t kMaxCategories     = 64;
+    static constexpr size_t kEventsPerThread   = 1 << 12;
+    static constexpr size_t kEventsPerChunk    = 1 << 8;
+    static constexpr size_t kMaxThreadBuffers  = 16;
+    static constexpr size_t kCopiedStringBytes = 64;
+
+    struct Event
+    {
+        // Use these rather than |name| and |argNames| directly, which are null for copied strings.
+        // The returned strings live as long as the event.
+        const char *getName() const;
+        const char *getArgName(size_t argIndex) const;
+        // Returns null unless the argument is a string.
+        const char *getStringArg(size_t argIndex) const;
+
+        double timestamp;
+        const char *categoryName;
+        const char *name;
+        unsigned long long id;
+        const char *argNames[kMaxArgs];
+        // Copied string arguments hold the offset of the string in |copiedStrings|.
+        unsigned long long argValues[kMaxArgs];
+        unsigned char argTypes[kMaxArgs];
+        unsigned char numArgs;
+        unsigned char flags;
+        char phase;
+        uint32_t threadId;
+        // Offsets in |copiedStrings| of the name and argument names, when they are copied.
+        unsigned char nameOffset;
+        unsigned char argNameOffsets[kMaxArgs];
+        char copiedStrings[kCopiedStringBytes];
+    };
+
+    // |categories| is a comma-separated list of the categories to record, or "*" for all of them.
+    explicit TraceRecorder(const std::string &categories);
+    ~TraceRecorder();
+
+    // The returned flag stays valid for the lifetime of the recorder, so it can be cached by the
+    // trace event macros.
+    const unsigned char *getCategoryEnabledFlag(const char *categoryName);
+
+    // Takes the same arguments as the platform's addTraceEvent.  |timestamp| is in seconds.
+    void addEvent(char phase,
+                  const unsigned char *categoryEnabledFlag,
+                  const char *name,
+                  unsigned long long id,
+                  double timestamp,
+                  int numArgs,
+                  const char **argNames,
+                  const unsigned char *argTypes,
+                  const unsigned long long *argValues,
+                  unsigned char flags);
+
+    // Seconds since the recorder was created.
+    double currentTime() const;
+
+    // Copies the recorded events with timestamps in [startTime, endTime].  Threads may keep adding
+    // events meanwhile; any that get overwritten during the copy are left out.  Only the events
+    // newer than |startTime| are visited, so taking a recent window is cheap.
+    std::vector<Event> getEvents(double startTime, double endTime) const;
+    std::vector<Event> getEvents() const;
+
+    static void WriteJSON(const std::vector<Event> &events, std::ostream &out);
+    bool writeJSONFile(const char *path) const;
+
+  private:
+    struct Category
+    {
+        unsigned char enabled;
+        const char *name;
+    };
+
+    struct ThreadBuffer;
+    ThreadBuffer *getThreadBuffer();
+    static void OnThreadExit(void *threadBuffer);
+
+    std::vector<std::string> mEnabledCategories;
+    bool mAllCategoriesEnabled;
+
+    const std::chrono::steady_clock::time_point mStartTime;
+
+    // Guards the category table and the list of thread buffers, but not the buffers themselves.
+    mutable std::mutex mMutex;
+    std::array<Category, kMaxCategories> mCategories;
+    size_t mCategoryCount;
+    const unsigned char mDisabledFlag;
+
+    TLSIndex mThreadBufferIndex;
+    std::vector<std::unique_ptr<ThreadBuffer>> mThreadBuffers;
+    // Buffers of exited threads.  Their events stay readable until a new thread overwrites them.
+    std::vector<ThreadBuffer *> mFreeThreadBuffers;
+    uint32_t mThreadCount;
+};
+
+}  // namespace angle
+
+#endif  // COMMON_TRACE_RECORDER_H_
@@ -0,0 +1,290 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_recorder_unittest: Tests of the in-memory trace event recorder.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "common/platform.h"
+#include "common/trace_recorder.h"
+
+using namespace angle;
+
+namespace
+{
+void AddEvent(TraceRecorder *recorder,
+              const unsigned char *categoryEnabledFlag,
+              const char *name,
+              double timestamp)
+{
+    recorder->addEvent('B', categoryEnabledFlag, name, 0, timestamp, 0, nullptr, nullptr, nullptr,
+                       0);
+}
+
+// Tests that only the listed categories are enabled.
+TEST(TraceRecorderTest, CategoryFiltering)
+{
+    TraceRecorder recorder("gpu.angle, gpu.angle.gpu");
+
+    EXPECT_NE(0, *recorder.getCategoryEnabledFlag("gpu.angle"));
+    EXPECT_NE(0, *recorder.getCategoryEnabledFlag("gpu.angle.gpu"));
+    EXPECT_EQ(0, *recorder.getCategoryEnabledFlag("gpu.angle.texture_metrics"));
+
+    // The same flag is returned every time.
+    EXPECT_EQ(recorder.getCategoryEnabledFlag("gpu.angle"),
+              recorder.getCategoryEnabledFlag("gpu.angle"));
+
+    TraceRecorder allRecorder("*");
+    EXPECT_NE(0, *allRecorder.getCategoryEnabledFlag("gpu.angle.texture_metrics"));
+}
+
+// Tests that events keep their category and arguments, and that events of disabled categories
+// are dropped.
+TEST(TraceRecorderTest, RecordsEvents)
+{
+    TraceRecorder recorder("gpu.angle");
+    const unsigned char *enabled  = recorder.getCategoryEnabledFlag("gpu.angle");
+    const unsigned char *disabled = recorder.getCategoryEnabledFlag("other");
+
+    const char *argNames[]               = {"count"};
+    const unsigned char argTypes[]       = {2};
+    const unsigned long long argValues[] = {42};
+    recorder.addEvent('B', enabled, "Draw", 0, 1.0, 1, argNames, argTypes, argValues, 0);
+    AddEvent(&recorder, disabled, "Ignored", 2.0);
+    AddEvent(&recorder, enabled, "Flush", 3.0);
+
+    std::vector<TraceRecorder::Event> events = recorder.getEvents();
+    ASSERT_EQ(2u, events.size());
+    EXPECT_STREQ("Draw", events[0].name);
+    EXPECT_STREQ("gpu.angle", events[0].categoryName);
+    ASSERT_EQ(1u, events[0].numArgs);
+    EXPECT_EQ(42u, events[0].argValues[0]);
+    EXPECT_STREQ("Flush", events[1].name);
+}
+
+// Tests that only the most recent events of a thread are kept.  The slot of the oldest one is the
+// next to be written, so it isn't returned.
+TEST(TraceRecorderTest, RingBufferWraps)
+{
+    TraceRecorder recorder("*");
+    const unsigned char *enabled = recorder.getCategoryEnabledFlag("gpu.angle");
+
+    size_t eventCount = TraceRecorder::kEventsPerThread + 10;
+    for (size_t index = 0; index < eventCount; ++index)
+    {
+        AddEvent(&recorder, enabled, "Event", static_cast<double>(index));
+    }
+
+    std::vector<TraceRecorder::Event> events = recorder.getEvents();
+    ASSERT_EQ(TraceRecorder::kEventsPerThread - 1, events.size());
+    EXPECT_EQ(11.0, events.front().timestamp);
+    EXPECT_EQ(static_cast<double>(eventCount - 1), events.back().timestamp);
+}
+
+// Tests taking the events of a time window.
+TEST(TraceRecorderTest, TimeWindow)
+{
+    TraceRecorder recorder("*");
+    const unsigned char *enabled = recorder.getCategoryEnabledFlag("gpu.angle");
+
+    for (int index = 0; index < 10; ++index)
+    {
+        AddEvent(&recorder, enabled, "Event", static_cast<double>(index));
+    }
+
+    std::vector<TraceRecorder::Event> events = recorder.getEvents(3.0, 5.0);
+    ASSERT_EQ(3u, events.size());
+    EXPECT_EQ(3.0, events[0].timestamp);
+    EXPECT_EQ(5.0, events[2].timestamp);
+}
+
+// Tests that each thread records into its own buffer.
+TEST(TraceRecorderTest, MultipleThreads)
+{
+    TraceRecorder recorder("*");
+    const unsigned char *enabled = recorder.getCategoryEnabledFlag("gpu.angle");
+
+    auto addEvents = [&recorder, enabled]() {
+        for (int index = 0; index < 100; ++index)
+        {
+            AddEvent(&recorder, enabled, "Event", static_cast<double>(index));
+        }
+    };
+
+    std::thread first(addEvents);
+    std::thread second(addEvents);
+    first.join();
+    second.join();
+
+    std::vector<TraceRecorder::Event> events = recorder.getEvents();
+    ASSERT_EQ(200u, events.size());
+    EXPECT_NE(events.front().threadId, events.back().threadId);
+}
+
+// Tests that events read while their thread keeps overwriting the ring buffer are never torn.
+TEST(TraceRecorderTest, ConcurrentReads)
+{
+    TraceRecorder recorder("*");
+    const unsigned char *enabled = recorder.getCategoryEnabledFlag("gpu.angle");
+
+    std::atomic<bool> done(false);
+    std::thread writer([&recorder, enabled, &done]() {
+        const char *argName        = "value";
+        const unsigned char argType = 2;
+        for (unsigned long long index = 0; index < 4 * TraceRecorder::kEventsPerThread; ++index)
+        {
+            unsigned long long argValue = index * 3;
+            recorder.addEvent('B', enabled, "Event", index, static_cast<double>(index), 1,
+                              &argName, &argType, &argValue, 0);
+        }
+        done = true;
+    });
+
+    while (!done)
+    {
+        std::vector<TraceRecorder::Event> events = recorder.getEvents();
+        for (size_t eventIndex = 0; eventIndex < events.size(); ++eventIndex)
+        {
+            const TraceRecorder::Event &event = events[eventIndex];
+            ASSERT_EQ(static_cast<double>(event.id), event.timestamp);
+            ASSERT_EQ(1u, event.numArgs);
+            ASSERT_EQ(event.id * 3, event.argValues[0]);
+            if (eventIndex > 0)
+            {
+                ASSERT_EQ(events[eventIndex - 1].id + 1, event.id);
+            }
+        }
+    }
+    writer.join();
+}
+
+// Tests that names and string arguments passed with the COPY flag are copied into the event, since
+// the caller may free them right after adding it, and that they are truncated to fit.
+TEST(TraceRecorderTest, CopiedStrings)
+{
+    constexpr unsigned char kFlagCopy          = 1 << 0;
+    constexpr unsigned char kArgTypeUint       = 2;
+    constexpr unsigned char kArgTypeCopyString = 7;
+
+    TraceRecorder recorder("*");
+    const unsigned char *enabled = recorder.getCategoryEnabledFlag("gpu.angle");
+
+    {
+        std::string name    = "Compile";
+        std::string argName = "shader";
+        std::string value   = "main.frag";
+        std::string count   = "count";
+
+        const char *argNames[]               = {argName.c_str(), count.c_str()};
+        const unsigned char argTypes[]       = {kArgTypeCopyString, kArgTypeUint};
+        const unsigned long long argValues[] = {
+            static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(value.c_str())), 7};
+        recorder.addEvent('B', enabled, name.c_str(), 0, 1.0, 2, argNames, argTypes, argValues,
+                          kFlagCopy);
+
+        std::string longName(2 * TraceRecorder::kCopiedStringBytes, 'x');
+        recorder.addEvent('E', enabled, longName.c_str(), 0, 2.0, 1, argNames, argTypes,
+                          argValues, kFlagCopy);
+
+        // Overwrite the strings before reading the events back.
+        name.assign(name.size(), '?');
+        argName.assign(argName.size(), '?');
+        value.assign(value.size(), '?');
+        count.assign(count.size(), '?');
+    }
+
+    std::vector<TraceRecorder::Event> events = recorder.getEvents();
+    ASSERT_EQ(2u, events.size());
+    EXPECT_STREQ("Compile", events[0].getName());
+    ASSERT_EQ(2u, events[0].numArgs);
+    EXPECT_STREQ("shader", events[0].getArgName(0));
+    EXPECT_STREQ("main.frag", events[0].getStringArg(0));
+    EXPECT_STREQ("count", events[0].getArgName(1));
+    EXPECT_EQ(nullptr, events[0].getStringArg(1));
+    EXPECT_EQ(7u, events[0].argValues[1]);
+
+    // The name takes all the space, so the argument strings are empty.
+    EXPECT_EQ(std::string(TraceRecorder::kCopiedStringBytes - 2, 'x'), events[1].getName());
+    EXPECT_STREQ("", events[1].getArgName(0));
+    EXPECT_STREQ("", events[1].getStringArg(0));
+
+    std::ostringstream out;
+    TraceRecorder::WriteJSON(events, out);
+    EXPECT_NE(std::string::npos, out.str().find("\"args\":{\"shader\":\"main.frag\",\"count\":7}"));
+}
+
+// Tests that at most kMaxThreadBuffers threads record at once.
+TEST(TraceRecorderTest, ThreadBufferLimit)
+{
+    TraceRecorder recorder("*");
+    const unsigned char *enabled = recorder.getCategoryEnabledFlag("gpu.angle");
+
+    // Keep every thread alive until all of them have tried to add their event.
+    constexpr size_t kThreadCount = TraceRecorder::kMaxThreadBuffers + 2;
+    std::atomic<size_t> addedCount(0);
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&recorder, enabled, &addedCount]() {
+            AddEvent(&recorder, enabled, "Event", 0.0);
+            addedCount++;
+            while (addedCount < kThreadCount)
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(TraceRecorder::kMaxThreadBuffers, recorder.getEvents().size());
+}
+
+#if defined(ANGLE_PLATFORM_POSIX)
+// Tests that the buffers of exited threads are reused, keeping their events until overwritten.
+TEST(TraceRecorderTest, ThreadBufferReuse)
+{
+    TraceRecorder recorder("*");
+    const unsigned char *enabled = recorder.getCategoryEnabledFlag("gpu.angle");
+
+    constexpr size_t kThreadCount = TraceRecorder::kMaxThreadBuffers + 2;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        std::thread thread([&recorder, enabled, threadIndex]() {
+            AddEvent(&recorder, enabled, "Event", static_cast<double>(threadIndex));
+        });
+        thread.join();
+    }
+
+    std::vector<TraceRecorder::Event> events = recorder.getEvents();
+    ASSERT_EQ(kThreadCount, events.size());
+    EXPECT_NE(events.front().threadId, events.back().threadId);
+}
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+// Tests the JSON output.
+TEST(TraceRecorderTest, WriteJSON)
+{
+    TraceRecorder recorder("*");
+    const unsigned char *enabled = recorder.getCategoryEnabledFlag("gpu.angle");
+    AddEvent(&recorder, enabled, "Draw \"quad\"", 0.5);
+
+    std::ostringstream out;
+    TraceRecorder::WriteJSON(recorder.getEvents(), out);
+
+    std::string json = out.str();
+    EXPECT_NE(std::string::npos, json.find("\"traceEvents\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"Draw \\\"quad\\\"\""));
+    EXPECT_NE(std::string::npos, json.find("\"ph\":\"B\""));
+    EXPECT_NE(std::string::npos, json.find("\"ts\":500000"));
+}
+}  // anonymous namespace
@@ -952,6 +952,7 @@ bool IsExternalImageTarget(EGLenum target)
     switch (target)
     {
         case EGL_NATIVE_BUFFER_ANDROID:
+        case EGL_LINUX_DMA_BUF_EXT:
             return true;
 
         default:
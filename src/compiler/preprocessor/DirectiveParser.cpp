@@ -352,6 +352,10 @@ void DirectiveParser::parseDefine(Token *token)
         // the replacement list for either form of macro.
         macro->replacements.front().setHasLeadingSpace(false);
     }
+    if (macro->type == Macro::kTypeFunc)
+    {
+        macro->cacheParameterIndices();
+    }
 
     // Check for macro redefinition.
     MacroSet::const_iterator iter = mMacroSet->find(macro->name);
@@ -6,7 +6,10 @@
 
 #include "compiler/preprocessor/Macro.h"
 
+#include <algorithm>
+
 #include "common/angleutils.h"
+#include "common/debug.h"
 #include "compiler/preprocessor/Token.h"
 
 namespace angle
@@ -15,6 +18,8 @@ namespace angle
 namespace pp
 {
 
+constexpr int Macro::kNotAParameter;
+
 Macro::Macro() : predefined(false), disabled(false), expansionCount(0), type(kTypeObj) {}
 
 Macro::~Macro() {}
@@ -25,6 +30,27 @@ bool Macro::equals(const Macro &other) const
            (replacements == other.replacements);
 }
 
+void Macro::cacheParameterIndices()
+{
+    ASSERT(type == kTypeFunc);
+
+    parameterIndices.assign(replacements.size(), kNotAParameter);
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        const Token &repl = replacements[i];
+        if (repl.type != Token::IDENTIFIER)
+        {
+            continue;
+        }
+
+        auto iter = std::find(parameters.begin(), parameters.end(), repl.text);
+        if (iter != parameters.end())
+        {
+            parameterIndices[i] = static_cast<int>(std::distance(parameters.begin(), iter));
+        }
+    }
+}
+
 void PredefineMacro(MacroSet *macroSet, const char *name, int value)
 {
     Token token;
@@ -30,10 +30,19 @@ struct Macro
     typedef std::vector<std::string> Parameters;
     typedef std::vector<Token> Replacements;
 
+    typedef std::vector<int> ParameterIndices;
+
+    // Value of parameterIndices for replacement tokens that aren't parameters.
+    static constexpr int kNotAParameter = -1;
+
     Macro();
     ~Macro();
     bool equals(const Macro &other) const;
 
+    // Looks up the parameter each replacement token refers to.  Must be called once the
+    // replacement list of a function-like macro is complete.
+    void cacheParameterIndices();
+
     bool predefined;
     mutable bool disabled;
     mutable int expansionCount;
@@ -41,7 +50,12 @@ struct Macro
     Type type;
     std::string name;
     Parameters parameters;
+    // The replacement list never changes once the macro is defined, so object-like macros are
+    // expanded straight from it without copying it.
     Replacements replacements;
+    // For function-like macros, the index in |parameters| of each replacement token, or
+    // kNotAParameter.
+    ParameterIndices parameterIndices;
 };
 
 typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
@@ -93,6 +93,7 @@ MacroExpander::MacroExpander(Lexer *lexer,
       mMacroSet(macroSet),
       mDiagnostics(diagnostics),
       mParseDefined(parseDefined),
+      mHasReserveToken(false),
       mTotalTokensInContexts(0),
       mSettings(settings),
       mDeferReenablingMacros(false)
@@ -105,6 +106,10 @@ MacroExpander::~MacroExpander()
     {
         delete context;
     }
+    for (MacroContext *context : mFreeContexts)
+    {
+        delete context;
+    }
 }
 
 void MacroExpander::lex(Token *token)
@@ -140,8 +145,7 @@ void MacroExpander::lex(Token *token)
                                      token->text);
                 break;
             }
-            auto iter              = mMacroSet->find(token->text);
-            std::string expression = iter != mMacroSet->end() ? "1" : "0";
+            const bool isDefined = mMacroSet->find(token->text) != mMacroSet->end();
 
             if (paren)
             {
@@ -157,7 +161,7 @@ void MacroExpander::lex(Token *token)
             // We have a valid defined operator.
             // Convert the current token into a CONST_INT token.
             token->type = Token::CONST_INT;
-            token->text = expression;
+            token->text = isDefined ? "1" : "0";
             break;
         }
 
@@ -193,10 +197,10 @@ void MacroExpander::lex(Token *token)
 
 void MacroExpander::getToken(Token *token)
 {
-    if (mReserveToken.get())
+    if (mHasReserveToken)
     {
-        *token = *mReserveToken;
-        mReserveToken.reset();
+        *token           = mReserveToken;
+        mHasReserveToken = false;
         return;
     }
 
@@ -208,7 +212,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back()->get();
+        mContextStack.back()->get(token);
     }
     else
     {
@@ -223,12 +227,13 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext *context = mContextStack.back();
         context->unget();
-        ASSERT(context->replacements[context->index] == token);
+        ASSERT(context->peek().type == token.type && context->peek().text == token.text);
     }
     else
     {
-        ASSERT(!mReserveToken.get());
-        mReserveToken.reset(new Token(token));
+        ASSERT(!mHasReserveToken);
+        mReserveToken    = token;
+        mHasReserveToken = true;
     }
 }
 
@@ -250,18 +255,30 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext *context = nullptr;
+    if (mFreeContexts.empty())
+    {
+        context = new MacroContext;
+    }
+    else
+    {
+        context = mFreeContexts.back();
+        mFreeContexts.pop_back();
+    }
+
+    if (!expandMacro(*macro, identifier, context))
+    {
+        context->reset();
+        mFreeContexts.push_back(context);
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    MacroContext *context = new MacroContext;
-    context->macro        = macro;
-    context->replacements.swap(replacements);
+    context->macro = macro;
     mContextStack.push_back(context);
-    mTotalTokensInContexts += context->replacements.size();
+    mTotalTokensInContexts += context->size();
     return true;
 }
 
@@ -284,14 +301,16 @@ void MacroExpander::popMacro()
         context->macro->disabled = false;
     }
     context->macro->expansionCount--;
-    mTotalTokensInContexts -= context->replacements.size();
-    delete context;
+    mTotalTokensInContexts -= context->size();
+    context->reset();
+    mFreeContexts.push_back(context);
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
-                                std::vector<Token> *replacements)
+                                MacroContext *context)
 {
+    std::vector<Token> *replacements = &context->expandedReplacements;
     replacements->clear();
 
     // In the case of an object-like macro, the replacement list gets its location
@@ -301,13 +320,12 @@ bool MacroExpander::expandMacro(const Macro &macro,
     SourceLocation replacementLocation = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
-        replacements->assign(macro.replacements.begin(), macro.replacements.end());
-
         if (macro.predefined)
         {
             const char kLine[] = "__LINE__";
             const char kFile[] = "__FILE__";
 
+            replacements->assign(macro.replacements.begin(), macro.replacements.end());
             ASSERT(replacements->size() == 1);
             Token &repl = replacements->front();
             if (macro.name == kLine)
@@ -318,6 +336,11 @@ bool MacroExpander::expandMacro(const Macro &macro,
             {
                 repl.text = ToString(identifier.location.file);
             }
+            context->replacements = replacements;
+        }
+        else
+        {
+            context->replacements = &macro.replacements;
         }
     }
     else
@@ -329,20 +352,14 @@ bool MacroExpander::expandMacro(const Macro &macro,
             return false;
 
         replaceMacroParams(macro, args, replacements);
+        context->replacements = replacements;
     }
 
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token &repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
-    }
+    // The first token in the replacement list inherits the padding properties of the identifier
+    // token.
+    context->location        = replacementLocation;
+    context->atStartOfLine   = identifier.atStartOfLine();
+    context->hasLeadingSpace = identifier.hasLeadingSpace();
     return true;
 }
 
@@ -406,7 +423,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
             // Initial whitespace is not part of the argument.
             if (arg.empty())
                 token.setHasLeadingSpace(false);
-            arg.push_back(token);
+            arg.push_back(std::move(token));
         }
     }
 
@@ -447,7 +464,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         expander.lex(&token);
         while (token.type != Token::LAST)
         {
-            arg.push_back(token);
+            arg.push_back(std::move(token));
             expander.lex(&token);
             numTokens++;
             if (numTokens + mTotalTokensInContexts > kMaxContextTokens)
@@ -464,6 +481,7 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
+    ASSERT(macro.parameterIndices.size() == macro.replacements.size());
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         if (!replacements->empty() &&
@@ -475,24 +493,13 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
         }
 
         const Token &repl = macro.replacements[i];
-        if (repl.type != Token::IDENTIFIER)
+        const int iArg    = macro.parameterIndices[i];
+        if (iArg == Macro::kNotAParameter)
         {
             replacements->push_back(repl);
             continue;
         }
 
-        // TODO(alokp): Optimize this.
-        // There is no need to search for macro params every time.
-        // The param index can be cached with the replacement token.
-        Macro::Parameters::const_iterator iter =
-            std::find(macro.parameters.begin(), macro.parameters.end(), repl.text);
-        if (iter == macro.parameters.end())
-        {
-            replacements->push_back(repl);
-            continue;
-        }
-
-        std::size_t iArg    = std::distance(macro.parameters.begin(), iter);
         const MacroArg &arg = args[iArg];
         if (arg.empty())
         {
@@ -506,18 +513,46 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
     }
 }
 
-MacroExpander::MacroContext::MacroContext() : macro(0), index(0) {}
+MacroExpander::MacroContext::MacroContext()
+    : macro(0), index(0), replacements(nullptr), atStartOfLine(false), hasLeadingSpace(false)
+{}
 
 MacroExpander::MacroContext::~MacroContext() {}
 
+void MacroExpander::MacroContext::reset()
+{
+    macro.reset();
+    index        = 0;
+    replacements = nullptr;
+    // Keep the storage of the expanded replacements for the next expansion.
+    expandedReplacements.clear();
+}
+
 bool MacroExpander::MacroContext::empty() const
 {
-    return index == replacements.size();
+    return index == replacements->size();
 }
 
-const Token &MacroExpander::MacroContext::get()
+size_t MacroExpander::MacroContext::size() const
 {
-    return replacements[index++];
+    return replacements->size();
+}
+
+const Token &MacroExpander::MacroContext::peek() const
+{
+    return (*replacements)[index];
+}
+
+void MacroExpander::MacroContext::get(Token *token)
+{
+    *token          = (*replacements)[index];
+    token->location = location;
+    if (index == 0)
+    {
+        token->setAtStartOfLine(atStartOfLine);
+        token->setHasLeadingSpace(hasLeadingSpace);
+    }
+    ++index;
 }
 
 void MacroExpander::MacroContext::unget()
@@ -13,6 +13,7 @@
 #include "compiler/preprocessor/Lexer.h"
 #include "compiler/preprocessor/Macro.h"
 #include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
 
 namespace angle
 {
@@ -43,7 +44,8 @@ class MacroExpander : public Lexer
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
 
-    bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
+    struct MacroContext;
+    bool expandMacro(const Macro &macro, const Token &identifier, MacroContext *context);
 
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
@@ -58,13 +60,25 @@ class MacroExpander : public Lexer
     {
         MacroContext();
         ~MacroContext();
+        void reset();
         bool empty() const;
-        const Token &get();
+        size_t size() const;
+        const Token &peek() const;
+        void get(Token *token);
         void unget();
 
         std::shared_ptr<Macro> macro;
         std::size_t index;
-        std::vector<Token> replacements;
+        // Either the replacement list of |macro| for object-like macros, which is shared by all
+        // their expansions, or |expandedReplacements|.
+        const std::vector<Token> *replacements;
+        std::vector<Token> expandedReplacements;
+
+        // The location of all the replacement tokens, and the padding of the macro invocation,
+        // which the first replacement token inherits.  They are applied as the tokens are read.
+        SourceLocation location;
+        bool atStartOfLine;
+        bool hasLeadingSpace;
     };
 
     Lexer *mLexer;
@@ -72,8 +86,11 @@ class MacroExpander : public Lexer
     Diagnostics *mDiagnostics;
     bool mParseDefined;
 
-    std::unique_ptr<Token> mReserveToken;
+    Token mReserveToken;
+    bool mHasReserveToken;
     std::vector<MacroContext *> mContextStack;
+    // Popped contexts, kept to reuse the storage of their replacements.
+    std::vector<MacroContext *> mFreeContexts;
     size_t mTotalTokensInContexts;
 
     PreprocessorSettings mSettings;
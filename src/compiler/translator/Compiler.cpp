@@ -26,18 +26,22 @@
 #include "compiler/translator/tree_ops/ClampPointSize.h"
 #include "compiler/translator/tree_ops/DeclareAndInitBuiltinsForInstancedMultiview.h"
 #include "compiler/translator/tree_ops/DeferGlobalInitializers.h"
+#include "compiler/translator/tree_ops/EliminateCommonSubexpressions.h"
 #include "compiler/translator/tree_ops/EmulateGLDrawID.h"
 #include "compiler/translator/tree_ops/EmulateGLFragColorBroadcast.h"
 #include "compiler/translator/tree_ops/EmulatePrecision.h"
 #include "compiler/translator/tree_ops/FoldExpressions.h"
 #include "compiler/translator/tree_ops/InitializeVariables.h"
+#include "compiler/translator/tree_ops/PropagateConstantsAndCopies.h"
 #include "compiler/translator/tree_ops/PruneEmptyCases.h"
 #include "compiler/translator/tree_ops/PruneNoOps.h"
 #include "compiler/translator/tree_ops/RegenerateStructNames.h"
 #include "compiler/translator/tree_ops/RemoveArrayLengthMethod.h"
+#include "compiler/translator/tree_ops/RemoveDeadCode.h"
 #include "compiler/translator/tree_ops/RemoveInvariantDeclaration.h"
 #include "compiler/translator/tree_ops/RemovePow.h"
 #include "compiler/translator/tree_ops/RemoveUnreferencedVariables.h"
+#include "compiler/translator/tree_ops/RemoveUnusedOutputVaryings.h"
 #include "compiler/translator/tree_ops/RewriteDoWhile.h"
 #include "compiler/translator/tree_ops/RewriteRepeatedAssignToSwizzled.h"
 #include "compiler/translator/tree_ops/ScalarizeVecAndMatConstructorArgs.h"
@@ -48,6 +52,7 @@
 #include "compiler/translator/tree_ops/UseInterfaceBlockFields.h"
 #include "compiler/translator/tree_ops/VectorizeVectorScalarArithmetic.h"
 #include "compiler/translator/tree_util/BuiltIn_autogen.h"
+#include "compiler/translator/tree_util/DeepCopyTree.h"
 #include "compiler/translator/tree_util/IntermNodePatternMatcher.h"
 #include "compiler/translator/util.h"
 #include "third_party/compiler/ArrayBoundsClamper.h"
@@ -222,6 +227,20 @@ int MapSpecToShaderVersion(ShShaderSpec spec)
     }
 }
 
+// Estimates the length of the object code so that the sink can be allocated once. Translated code
+// is usually somewhat longer than the source, and the translators add declarations of their own.
+size_t EstimateObjectCodeLength(const char *const shaderStrings[], size_t numStrings)
+{
+    constexpr size_t kAddedDeclarationsLength = 1024;
+
+    size_t sourceLength = 0;
+    for (size_t stringIndex = 0; stringIndex < numStrings; ++stringIndex)
+    {
+        sourceLength += strlen(shaderStrings[stringIndex]);
+    }
+    return 2 * sourceLength + kAddedDeclarationsLength;
+}
+
 bool ValidateFragColorAndFragData(GLenum shaderType,
                                   int shaderVersion,
                                   const TSymbolTable &symbolTable,
@@ -267,8 +286,54 @@ bool ValidateFragColorAndFragData(GLenum shaderType,
     return true;
 }
 
+// The compile options that affect the result of TCompiler::parseShader.
+constexpr ShCompileOptions kParsingCompileOptions =
+    SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL | SH_EMULATE_GL_DRAW_ID |
+    SH_LIMIT_EXPRESSION_COMPLEXITY | SH_VALIDATE_LOOP_INDEXING;
+
+std::string GetParsedShaderKey(const char *const shaderStrings[],
+                               size_t numStrings,
+                               ShCompileOptions compileOptions)
+{
+    std::string key = std::to_string(compileOptions & kParsingCompileOptions);
+    for (size_t stringIndex = 0; stringIndex < numStrings; ++stringIndex)
+    {
+        // The lengths keep the boundaries of the strings, which are a part of source locations.
+        const size_t length = strlen(shaderStrings[stringIndex]);
+        key += ':';
+        key += std::to_string(length);
+        key += ':';
+        key.append(shaderStrings[stringIndex], length);
+    }
+    return key;
+}
+
 }  // namespace
 
+struct TCompiler::ParsedShader
+{
+    // Declared first so that everything allocated from it is destroyed before it.
+    TPoolAllocator allocator;
+
+    // Empty if parsing failed.
+    std::string key;
+    TIntermBlock *root = nullptr;
+
+    int shaderVersion = 0;
+    TPragma pragma;
+    bool computeShaderLocalSizeDeclared                    = false;
+    sh::WorkGroupSize computeShaderLocalSize               = sh::WorkGroupSize(1);
+    int numViews                                           = -1;
+    TLayoutPrimitiveType geometryShaderInputPrimitiveType  = EptUndefined;
+    TLayoutPrimitiveType geometryShaderOutputPrimitiveType = EptUndefined;
+    int geometryShaderMaxVertices                          = -1;
+    int geometryShaderInvocations                          = 0;
+
+    TExtensionBehavior extensionBehavior;
+    std::shared_ptr<const TSymbolTable::TParsedShaderState> symbolTableState;
+    std::string infoLog;
+};
+
 TShHandleBase::TShHandleBase()
 {
     allocator.push();
@@ -295,7 +360,8 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mGeometryShaderMaxVertices(-1),
       mGeometryShaderInvocations(0),
       mGeometryShaderInputPrimitiveType(EptUndefined),
-      mGeometryShaderOutputPrimitiveType(EptUndefined)
+      mGeometryShaderOutputPrimitiveType(EptUndefined),
+      mFunctionOutputThreadCount(0)
 {}
 
 TCompiler::~TCompiler() {}
@@ -313,13 +379,14 @@ bool TCompiler::Init(const ShBuiltInResources &resources)
 {
     SetGlobalPoolAllocator(&allocator);
 
+    // The resource string identifies the built-in symbols that depend on the resources.
+    mResources = resources;
+    setResourceString();
+
     // Generate built-in symbol table.
     if (!initBuiltInSymbolTable(resources))
         return false;
 
-    mResources = resources;
-    setResourceString();
-
     InitExtensionBehavior(resources, mExtensionBehavior);
     mArrayBoundsClamper.SetClampingStrategy(resources.ArrayIndexClampingStrategy);
     return true;
@@ -329,6 +396,7 @@ TIntermBlock *TCompiler::compileTreeForTesting(const char *const shaderStrings[]
                                                size_t numStrings,
                                                ShCompileOptions compileOptions)
 {
+    TScopedTypeSharing scopedTypeSharing;
     return compileTreeImpl(shaderStrings, numStrings, compileOptions);
 }
 
@@ -341,6 +409,44 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     ASSERT(numStrings > 0);
     ASSERT(GetGlobalPoolAllocator());
 
+    // First string is path of source file if flag is set. The actual source follows.
+    size_t firstSource = 0;
+    if (compileOptions & SH_SOURCE_PATH)
+    {
+        mSourcePath = shaderStrings[0];
+        ++firstSource;
+    }
+
+    // We preserve symbols at the built-in level from compile-to-compile.
+    // Start pushing the user-defined symbols at global level.
+    TScopedSymbolTableLevel globalLevel(&mSymbolTable);
+    ASSERT(mSymbolTable.atGlobalLevel());
+
+    // The copies of a kept AST share the structs of the kept AST, so they can't be renamed.
+    const bool reuseParsedShader = (compileOptions & SH_REUSE_PARSED_SHADER) != 0 &&
+                                   (compileOptions & SH_REGENERATE_STRUCT_NAMES) == 0;
+    TIntermBlock *root =
+        reuseParsedShader
+            ? reuseOrParseShader(&shaderStrings[firstSource], numStrings - firstSource,
+                                 compileOptions)
+            : parseShader(&shaderStrings[firstSource], numStrings - firstSource, compileOptions);
+    if (root == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (!checkAndSimplifyAST(root, compileOptions))
+    {
+        return nullptr;
+    }
+
+    return root;
+}
+
+TIntermBlock *TCompiler::parseShader(const char *const shaderStrings[],
+                                     size_t numStrings,
+                                     ShCompileOptions compileOptions)
+{
     // Reset the extension behavior for each compilation unit.
     ResetExtensionBehavior(mExtensionBehavior);
 
@@ -356,27 +462,13 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         }
     }
 
-    // First string is path of source file if flag is set. The actual source follows.
-    size_t firstSource = 0;
-    if (compileOptions & SH_SOURCE_PATH)
-    {
-        mSourcePath = shaderStrings[0];
-        ++firstSource;
-    }
-
     TParseContext parseContext(mSymbolTable, mExtensionBehavior, mShaderType, mShaderSpec,
                                compileOptions, true, &mDiagnostics, getResources());
 
     parseContext.setFragmentPrecisionHighOnESSL1(mResources.FragmentPrecisionHigh == 1);
 
-    // We preserve symbols at the built-in level from compile-to-compile.
-    // Start pushing the user-defined symbols at global level.
-    TScopedSymbolTableLevel globalLevel(&mSymbolTable);
-    ASSERT(mSymbolTable.atGlobalLevel());
-
     // Parse shader.
-    if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
-                       &parseContext) != 0)
+    if (PaParseStrings(numStrings, shaderStrings, nullptr, &parseContext) != 0)
     {
         return nullptr;
     }
@@ -394,7 +486,43 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     }
 
     TIntermBlock *root = parseContext.getTreeRoot();
-    if (!checkAndSimplifyAST(root, parseContext, compileOptions))
+
+    // Disallow expressions deemed too complex.
+    if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) && !limitExpressionComplexity(root))
+    {
+        return nullptr;
+    }
+
+    if (shouldRunLoopAndIndexingValidation(compileOptions) &&
+        !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
+    {
+        return nullptr;
+    }
+
+    if (!ValidateFragColorAndFragData(mShaderType, mShaderVersion, mSymbolTable, &mDiagnostics))
+    {
+        return nullptr;
+    }
+
+    // Fold expressions that could not be folded before validation that was done as a part of
+    // parsing.
+    FoldExpressions(root, &mDiagnostics);
+    // Folding should only be able to generate warnings.
+    ASSERT(mDiagnostics.numErrors() == 0);
+    if (!ValidateAST(root, &mDiagnostics, mValidateASTOptions))
+    {
+        return nullptr;
+    }
+
+    // We prune no-ops to work around driver bugs and to keep AST processing and output simple.
+    // The following kinds of no-ops are pruned:
+    //   1. Empty declarations "int;".
+    //   2. Literal statements: "1.0;". The ESSL output doesn't define a default precision
+    //      for float, so float literal statements would end up with no precision which is
+    //      invalid ESSL.
+    // After this empty declarations are not allowed in the AST.
+    PruneNoOps(root, &mSymbolTable);
+    if (!ValidateAST(root, &mDiagnostics, mValidateASTOptions))
     {
         return nullptr;
     }
@@ -402,6 +530,69 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     return root;
 }
 
+TIntermBlock *TCompiler::reuseOrParseShader(const char *const shaderStrings[],
+                                            size_t numStrings,
+                                            ShCompileOptions compileOptions)
+{
+    std::string key = GetParsedShaderKey(shaderStrings, numStrings, compileOptions);
+    if (mParsedShader && mParsedShader->key == key)
+    {
+        mShaderVersion                     = mParsedShader->shaderVersion;
+        mPragma                            = mParsedShader->pragma;
+        mComputeShaderLocalSizeDeclared    = mParsedShader->computeShaderLocalSizeDeclared;
+        mComputeShaderLocalSize            = mParsedShader->computeShaderLocalSize;
+        mNumViews                          = mParsedShader->numViews;
+        mGeometryShaderInputPrimitiveType  = mParsedShader->geometryShaderInputPrimitiveType;
+        mGeometryShaderOutputPrimitiveType = mParsedShader->geometryShaderOutputPrimitiveType;
+        mGeometryShaderMaxVertices         = mParsedShader->geometryShaderMaxVertices;
+        mGeometryShaderInvocations         = mParsedShader->geometryShaderInvocations;
+        mExtensionBehavior                 = mParsedShader->extensionBehavior;
+        mSymbolTable.restoreParsedShaderState(*mParsedShader->symbolTableState);
+
+        // Repeat the warnings of parsing.
+        mInfoSink.info << mParsedShader->infoLog;
+
+        return DeepCopyTree(mParsedShader->root);
+    }
+
+    // The kept AST and the symbols it refers to are allocated from a pool that outlives this
+    // compilation. Symbols created later in the compilation are not shared with the next one.
+    mParsedShader.reset(new ParsedShader());
+    TPoolAllocator *compilationAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&mParsedShader->allocator);
+
+    TIntermBlock *root = nullptr;
+    {
+        TScopedTypeSharing keptTypeSharing;
+        root = parseShader(shaderStrings, numStrings, compileOptions);
+    }
+    if (root != nullptr)
+    {
+        PrepareTreeForSharing(root);
+
+        mParsedShader->key                               = std::move(key);
+        mParsedShader->root                              = root;
+        mParsedShader->shaderVersion                     = mShaderVersion;
+        mParsedShader->pragma                            = mPragma;
+        mParsedShader->computeShaderLocalSizeDeclared    = mComputeShaderLocalSizeDeclared;
+        mParsedShader->computeShaderLocalSize            = mComputeShaderLocalSize;
+        mParsedShader->numViews                          = mNumViews;
+        mParsedShader->geometryShaderInputPrimitiveType  = mGeometryShaderInputPrimitiveType;
+        mParsedShader->geometryShaderOutputPrimitiveType = mGeometryShaderOutputPrimitiveType;
+        mParsedShader->geometryShaderMaxVertices         = mGeometryShaderMaxVertices;
+        mParsedShader->geometryShaderInvocations         = mGeometryShaderInvocations;
+        mParsedShader->extensionBehavior                 = mExtensionBehavior;
+        mParsedShader->symbolTableState                  = mSymbolTable.saveParsedShaderState();
+        mParsedShader->infoLog                           = mInfoSink.info.str();
+    }
+
+    SetGlobalPoolAllocator(compilationAllocator);
+
+    // The rest of the compilation transforms the AST in place, so it works on a copy also when the
+    // shader was just parsed.
+    return root != nullptr ? DeepCopyTree(root) : nullptr;
+}
+
 bool TCompiler::checkShaderVersion(TParseContext *parseContext)
 {
     if (MapSpecToShaderVersion(mShaderSpec) < mShaderVersion)
@@ -467,50 +658,8 @@ void TCompiler::setASTMetadata(const TParseContext &parseContext)
     }
 }
 
-bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
-                                    const TParseContext &parseContext,
-                                    ShCompileOptions compileOptions)
+bool TCompiler::checkAndSimplifyAST(TIntermBlock *root, ShCompileOptions compileOptions)
 {
-    // Disallow expressions deemed too complex.
-    if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) && !limitExpressionComplexity(root))
-    {
-        return false;
-    }
-
-    if (shouldRunLoopAndIndexingValidation(compileOptions) &&
-        !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
-    {
-        return false;
-    }
-
-    if (!ValidateFragColorAndFragData(mShaderType, mShaderVersion, mSymbolTable, &mDiagnostics))
-    {
-        return false;
-    }
-
-    // Fold expressions that could not be folded before validation that was done as a part of
-    // parsing.
-    FoldExpressions(root, &mDiagnostics);
-    // Folding should only be able to generate warnings.
-    ASSERT(mDiagnostics.numErrors() == 0);
-    if (!ValidateAST(root, &mDiagnostics, mValidateASTOptions))
-    {
-        return false;
-    }
-
-    // We prune no-ops to work around driver bugs and to keep AST processing and output simple.
-    // The following kinds of no-ops are pruned:
-    //   1. Empty declarations "int;".
-    //   2. Literal statements: "1.0;". The ESSL output doesn't define a default precision
-    //      for float, so float literal statements would end up with no precision which is
-    //      invalid ESSL.
-    // After this empty declarations are not allowed in the AST.
-    PruneNoOps(root, &mSymbolTable);
-    if (!ValidateAST(root, &mDiagnostics, mValidateASTOptions))
-    {
-        return false;
-    }
-
     // Create the function DAG and check there is no recursion
     if (!initCallDag(root))
     {
@@ -565,7 +714,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     }
 
     if ((compileOptions & SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW) &&
-        parseContext.isExtensionEnabled(TExtension::OVR_multiview) &&
+        IsExtensionEnabled(mExtensionBehavior, TExtension::OVR_multiview) &&
         getShaderType() != GL_COMPUTE_SHADER)
     {
         DeclareAndInitBuiltinsForInstancedMultiview(root, mNumViews, mShaderType, compileOptions,
@@ -756,6 +905,20 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
     }
 
+    // Done after collecting variables so that the removed outputs are still reported, and after
+    // initializing output variables so that their initialization is removed as well.
+    if (mShaderType == GL_VERTEX_SHADER && (compileOptions & SH_REMOVE_UNUSED_OUTPUT_VARYINGS) &&
+        !mUnusedOutputVaryings.empty())
+    {
+        RemoveUnusedOutputVaryings(root, &mSymbolTable, mUnusedOutputVaryings);
+        RemoveUnreferencedVariables(root, &mSymbolTable);
+        PruneEmptyCases(root);
+        if (!ValidateAST(root, &mDiagnostics, mValidateASTOptions))
+        {
+            return false;
+        }
+    }
+
     // Removing invariant declarations must be done after collecting variables.
     // Otherwise, built-in invariant declarations don't apply.
     if (RemoveInvariant(mShaderType, mShaderVersion, mOutputType, compileOptions))
@@ -861,9 +1024,38 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
     }
 
+    if (compileOptions & SH_OPTIMIZE_AST)
+    {
+        optimizeAST(root, compileOptions);
+        if (!ValidateAST(root, &mDiagnostics, mValidateASTOptions))
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
+void TCompiler::optimizeAST(TIntermBlock *root, ShCompileOptions compileOptions)
+{
+    if ((compileOptions & SH_OPTIMIZE_AST) == 0)
+    {
+        return;
+    }
+
+    // Common subexpression elimination leaves copies of variables behind for copy propagation to
+    // remove. Propagating constants can make if conditions constant, and folding them may in turn
+    // make branches dead.
+    EliminateCommonSubexpressions(root, &mSymbolTable);
+    PropagateConstantsAndCopies(root, &mSymbolTable);
+    FoldExpressions(root, &mDiagnostics);
+    RemoveDeadCode(root, &mSymbolTable);
+    RemoveUnreferencedVariables(root, &mSymbolTable);
+
+    // Removing dead code may leave no-op cases at the end of switch statements.
+    PruneEmptyCases(root);
+}
+
 bool TCompiler::compile(const char *const shaderStrings[],
                         size_t numStrings,
                         ShCompileOptions compileOptionsIn)
@@ -886,6 +1078,7 @@ bool TCompiler::compile(const char *const shaderStrings[],
     }
 
     TScopedPoolAllocator scopedAlloc(&allocator);
+    TScopedTypeSharing scopedTypeSharing;
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
     if (root)
@@ -895,6 +1088,8 @@ bool TCompiler::compile(const char *const shaderStrings[],
 
         if (compileOptions & SH_OBJECT_CODE)
         {
+            mInfoSink.obj.reserve(EstimateObjectCodeLength(shaderStrings, numStrings));
+
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
             translate(root, compileOptions, &perfDiagnostics);
         }
@@ -933,7 +1128,7 @@ bool TCompiler::initBuiltInSymbolTable(const ShBuiltInResources &resources)
         return false;
     }
 
-    mSymbolTable.initializeBuiltIns(mShaderType, mShaderSpec, resources);
+    mSymbolTable.initializeBuiltIns(mShaderType, mShaderSpec, resources, mBuiltInResourcesString);
 
     return true;
 }
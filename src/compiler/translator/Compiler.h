@@ -14,6 +14,8 @@
 // This should not be included by driver code.
 //
 
+#include <memory>
+
 #include <GLSLANG/ShaderVars.h>
 
 #include "compiler/translator/BuiltInFunctionEmulator.h"
@@ -35,6 +37,9 @@ class TParseContext;
 #ifdef ANGLE_ENABLE_HLSL
 class TranslatorHLSL;
 #endif  // ANGLE_ENABLE_HLSL
+#ifdef ANGLE_ENABLE_VULKAN
+class TranslatorVulkan;
+#endif  // ANGLE_ENABLE_VULKAN
 
 //
 // Helper function to check if the shader type is GLSL.
@@ -63,6 +68,9 @@ class TShHandleBase
 #ifdef ANGLE_ENABLE_HLSL
     virtual TranslatorHLSL *getAsTranslatorHLSL() { return 0; }
 #endif  // ANGLE_ENABLE_HLSL
+#ifdef ANGLE_ENABLE_VULKAN
+    virtual TranslatorVulkan *getAsTranslatorVulkan() { return 0; }
+#endif  // ANGLE_ENABLE_VULKAN
 
   protected:
     // Memory allocator. Allocates and tracks memory required by the compiler.
@@ -105,6 +113,17 @@ class TCompiler : public TShHandleBase
     // Clears the results from the previous compilation.
     void clearResults();
 
+    // Sets the outputs that SH_REMOVE_UNUSED_OUTPUT_VARYINGS removes.
+    void setUnusedOutputVaryings(const std::vector<std::string> &names)
+    {
+        mUnusedOutputVaryings = names;
+    }
+
+    // Sets the number of threads that write function definitions with
+    // SH_PARALLEL_FUNCTION_OUTPUT.  This isn't a resource, as the output doesn't depend on it.
+    void setFunctionOutputThreadCount(int threadCount) { mFunctionOutputThreadCount = threadCount; }
+    int getFunctionOutputThreadCount() const { return mFunctionOutputThreadCount; }
+
     const std::vector<sh::Attribute> &getAttributes() const { return mAttributes; }
     const std::vector<sh::OutputVariable> &getOutputVariables() const { return mOutputVariables; }
     const std::vector<sh::Uniform> &getUniforms() const { return mUniforms; }
@@ -167,6 +186,10 @@ class TCompiler : public TShHandleBase
     virtual bool shouldFlattenPragmaStdglInvariantAll() = 0;
     virtual bool shouldCollectVariables(ShCompileOptions compileOptions);
 
+    // Runs the optimization passes enabled by SH_OPTIMIZE_AST. Translators that transform the AST
+    // further can run them again before generating their output.
+    void optimizeAST(TIntermBlock *root, ShCompileOptions compileOptions);
+
     bool wereVariablesCollected() const;
     std::vector<sh::Attribute> mAttributes;
     std::vector<sh::OutputVariable> mOutputVariables;
@@ -219,6 +242,19 @@ class TCompiler : public TShHandleBase
                                   size_t numStrings,
                                   const ShCompileOptions compileOptions);
 
+    // Parses the shader and runs the checks and simplifications that only depend on the source and
+    // on the compile options in kParsingCompileOptions. Returns nullptr whenever there are
+    // compilation errors.
+    TIntermBlock *parseShader(const char *const shaderStrings[],
+                              size_t numStrings,
+                              ShCompileOptions compileOptions);
+
+    // Same as parseShader, but returns a copy of the AST kept from an earlier compilation of the
+    // same source if there is one, and keeps the AST for later compilations otherwise.
+    TIntermBlock *reuseOrParseShader(const char *const shaderStrings[],
+                                     size_t numStrings,
+                                     ShCompileOptions compileOptions);
+
     // Fetches and stores shader metadata that is not stored within the AST itself, such as shader
     // version.
     void setASTMetadata(const TParseContext &parseContext);
@@ -226,10 +262,9 @@ class TCompiler : public TShHandleBase
     // Check if shader version meets the requirement.
     bool checkShaderVersion(TParseContext *parseContext);
 
-    // Does checks that need to be run after parsing is complete and returns true if they pass.
-    bool checkAndSimplifyAST(TIntermBlock *root,
-                             const TParseContext &parseContext,
-                             ShCompileOptions compileOptions);
+    // Does the checks and simplifications that follow parseShader and returns true if the checks
+    // pass.
+    bool checkAndSimplifyAST(TIntermBlock *root, ShCompileOptions compileOptions);
 
     sh::GLenum mShaderType;
     ShShaderSpec mShaderSpec;
@@ -282,6 +317,15 @@ class TCompiler : public TShHandleBase
 
     // Track what should be validated given passes currently applied.
     ValidateASTOptions mValidateASTOptions;
+
+    // The AST and the compilation results of the shader kept by SH_REUSE_PARSED_SHADER.
+    struct ParsedShader;
+    std::unique_ptr<ParsedShader> mParsedShader;
+
+    // The outputs removed by SH_REMOVE_UNUSED_OUTPUT_VARYINGS.
+    std::vector<std::string> mUnusedOutputVaryings;
+
+    int mFunctionOutputThreadCount;
 };
 
 //
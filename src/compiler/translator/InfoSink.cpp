@@ -6,12 +6,62 @@
 
 #include "compiler/translator/InfoSink.h"
 
+#include <stdio.h>
+#include <cmath>
+
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/Types.h"
 
 namespace sh
 {
 
+namespace
+{
+
+// Enough for the digits and the sign of any 64-bit integer.
+constexpr size_t kMaxIntegerLength = 20;
+
+// Enough for "%.8g" and "%.1f" of any finite float. The largest one is "%.1f" of -FLT_MAX.
+constexpr size_t kMaxFloatLength = 48;
+
+// Writes the digits of the given number to the end of the buffer and returns where they start.
+char *FormatDigits(unsigned long long value, char *bufferEnd)
+{
+    char *digits = bufferEnd;
+    do
+    {
+        *--digits = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    return digits;
+}
+
+// snprintf uses the decimal point of the current C locale, while the output has to use the classic
+// locale like InitializeStream does. The formatted number only contains digits, signs, the
+// exponent and the decimal point, so anything else is the locale's decimal point.
+size_t UseClassicDecimalPoint(char *number, size_t length)
+{
+    size_t outIndex = 0;
+    bool inDecimalPoint = false;
+    for (size_t inIndex = 0; inIndex < length; ++inIndex)
+    {
+        char c = number[inIndex];
+        if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == 'e')
+        {
+            number[outIndex++] = c;
+            inDecimalPoint     = false;
+        }
+        else if (!inDecimalPoint)
+        {
+            number[outIndex++] = '.';
+            inDecimalPoint     = true;
+        }
+    }
+    return outIndex;
+}
+
+}  // anonymous namespace
+
 void TInfoSinkBase::prefix(Severity severity)
 {
     switch (severity)
@@ -30,7 +80,30 @@ void TInfoSinkBase::prefix(Severity severity)
 
 TInfoSinkBase &TInfoSinkBase::operator<<(const ImmutableString &str)
 {
-    sink.append(str.data());
+    sink.append(str.data(), str.length());
+    return *this;
+}
+
+TInfoSinkBase &TInfoSinkBase::operator<<(float f)
+{
+    // Infinities and NaNs are rare enough to not need a fast path.
+    if (!std::isfinite(f))
+    {
+        TPersistStringStream stream = sh::InitializeStream<TPersistStringStream>();
+        stream << f;
+        sink.append(stream.str());
+        return *this;
+    }
+
+    // Make sure that at least one decimal point is written. If a number does not have a fractional
+    // part, the default precision format does not write the decimal portion which gets interpreted
+    // as integer by the compiler. The formats match what a string stream writes with precision 1
+    // and std::fixed, or with precision 8 and the default float field.
+    char buffer[kMaxFloatLength];
+    const char *format = fractionalPart(f) == 0.0f ? "%.1f" : "%.8g";
+    int length = snprintf(buffer, sizeof(buffer), format, static_cast<double>(f));
+    ASSERT(length > 0 && static_cast<size_t>(length) < sizeof(buffer));
+    sink.append(buffer, UseClassicDecimalPoint(buffer, static_cast<size_t>(length)));
     return *this;
 }
 
@@ -69,14 +142,36 @@ TInfoSinkBase &TInfoSinkBase::operator<<(const TType &type)
 
 void TInfoSinkBase::location(int file, int line)
 {
-    TPersistStringStream stream = sh::InitializeStream<TPersistStringStream>();
     if (line)
-        stream << file << ":" << line;
+        *this << file << ":" << line;
     else
-        stream << file << ":? ";
-    stream << ": ";
+        *this << file << ":? ";
+    sink.append(": ");
+}
 
-    sink.append(stream.str());
+void TInfoSinkBase::appendSignedInteger(long long i)
+{
+    // Negate in unsigned arithmetic so that the most negative value doesn't overflow.
+    unsigned long long magnitude = static_cast<unsigned long long>(i);
+    if (i < 0)
+    {
+        magnitude = 0u - magnitude;
+    }
+
+    char buffer[kMaxIntegerLength];
+    char *digits = FormatDigits(magnitude, buffer + kMaxIntegerLength);
+    if (i < 0)
+    {
+        *--digits = '-';
+    }
+    sink.append(digits, buffer + kMaxIntegerLength);
+}
+
+void TInfoSinkBase::appendUnsignedInteger(unsigned long long i)
+{
+    char buffer[kMaxIntegerLength];
+    char *digits = FormatDigits(i, buffer + kMaxIntegerLength);
+    sink.append(digits, buffer + kMaxIntegerLength);
 }
 
 }  // namespace sh
@@ -65,36 +65,47 @@ class TInfoSinkBase
     }
     TInfoSinkBase &operator<<(const TString &str)
     {
-        sink.append(str.c_str());
+        sink.append(str.data(), str.size());
         return *this;
     }
     TInfoSinkBase &operator<<(const ImmutableString &str);
 
     TInfoSinkBase &operator<<(const TType &type);
 
-    // Make sure floats are written with correct precision.
-    TInfoSinkBase &operator<<(float f)
+    // Integers are formatted directly into the sink instead of through a string stream.
+    TInfoSinkBase &operator<<(int i)
     {
-        // Make sure that at least one decimal point is written. If a number
-        // does not have a fractional part, the default precision format does
-        // not write the decimal portion which gets interpreted as integer by
-        // the compiler.
-        TPersistStringStream stream = sh::InitializeStream<TPersistStringStream>();
-        if (fractionalPart(f) == 0.0f)
-        {
-            stream.precision(1);
-            stream << std::showpoint << std::fixed << f;
-        }
-        else
-        {
-            stream.unsetf(std::ios::fixed);
-            stream.unsetf(std::ios::scientific);
-            stream.precision(8);
-            stream << f;
-        }
-        sink.append(stream.str());
+        appendSignedInteger(i);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(unsigned int i)
+    {
+        appendUnsignedInteger(i);
         return *this;
     }
+    TInfoSinkBase &operator<<(long i)
+    {
+        appendSignedInteger(i);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(unsigned long i)
+    {
+        appendUnsignedInteger(i);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(long long i)
+    {
+        appendSignedInteger(i);
+        return *this;
+    }
+    TInfoSinkBase &operator<<(unsigned long long i)
+    {
+        appendUnsignedInteger(i);
+        return *this;
+    }
+
+    // Make sure floats are written with correct precision.
+    TInfoSinkBase &operator<<(float f);
     // Write boolean values as their names instead of integral value.
     TInfoSinkBase &operator<<(bool b)
     {
@@ -105,6 +116,8 @@ class TInfoSinkBase
 
     void erase() { sink.clear(); }
     int size() { return static_cast<int>(sink.size()); }
+    // Preallocates the sink when the size of the output can be estimated up front.
+    void reserve(size_t size) { sink.reserve(size); }
 
     const TPersistString &str() const { return sink; }
     const char *c_str() const { return sink.c_str(); }
@@ -113,6 +126,9 @@ class TInfoSinkBase
     void location(int file, int line);
 
   private:
+    void appendSignedInteger(long long i);
+    void appendUnsignedInteger(unsigned long long i);
+
     TPersistString sink;
 };
 
@@ -6,6 +6,7 @@
 
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/InitializeGlobals.h"
+#include "compiler/translator/SymbolTable.h"
 
 #include "common/platform.h"
 
@@ -22,11 +23,19 @@ bool InitProcess()
         return false;
     }
 
+    if (!InitializeTypeSharingIndex())
+    {
+        assert(0 && "InitProcess(): Failed to initialize type sharing");
+        return false;
+    }
+
     return true;
 }
 
 void DetachProcess()
 {
+    TSymbolTable::ReleaseBuiltInSnapshots();
+    FreeTypeSharingIndex();
     FreePoolIndex();
 }
 
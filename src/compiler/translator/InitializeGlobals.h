@@ -10,4 +10,7 @@
 bool InitializePoolIndex();
 void FreePoolIndex();
 
+bool InitializeTypeSharingIndex();
+void FreeTypeSharingIndex();
+
 #endif  // COMPILER_TRANSLATOR_INITIALIZEGLOBALS_H_
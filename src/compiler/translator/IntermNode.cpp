@@ -20,6 +20,7 @@
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/IntermNode.h"
+#include "compiler/translator/StaticType.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/util.h"
 
@@ -183,14 +184,46 @@ bool CanFoldAggregateBuiltInOp(TOperator op)
 //
 ////////////////////////////////////////////////////////////////
 
-TIntermExpression::TIntermExpression(const TType &t) : TIntermTyped(), mType(t) {}
+TIntermExpression::TIntermExpression(const TType &t)
+    : TIntermTyped(), mType(TScopedTypeSharing::GetSharedType(t))
+{}
+
+TIntermExpression::TIntermExpression()
+    : TIntermTyped(), mType(StaticType::Get<EbtFloat, EbpUndefined, EvqTemporary, 1, 1>())
+{}
 
 void TIntermExpression::setTypePreservePrecision(const TType &t)
 {
     TPrecision precision = getPrecision();
-    mType                = t;
-    ASSERT(mType.getBasicType() != EbtBool || precision == EbpUndefined);
-    mType.setPrecision(precision);
+    ASSERT(t.getBasicType() != EbtBool || precision == EbpUndefined);
+    if (t.getPrecision() == precision)
+    {
+        setType(t);
+        return;
+    }
+    TType type(t);
+    type.setPrecision(precision);
+    setType(type);
+}
+
+void TIntermExpression::setTypeQualifier(TQualifier qualifier)
+{
+    if (mType->getQualifier() != qualifier)
+    {
+        TType type(*mType);
+        type.setQualifier(qualifier);
+        setType(type);
+    }
+}
+
+void TIntermExpression::setTypePrecision(TPrecision precision)
+{
+    if (mType->getPrecision() != precision)
+    {
+        TType type(*mType);
+        type.setPrecision(precision);
+        setType(type);
+    }
 }
 
 #define REPLACE_IF_IS(node, type, original, replacement) \
@@ -554,7 +587,7 @@ TIntermAggregate::TIntermAggregate(const TFunction *func,
 
 void TIntermAggregate::setPrecisionAndQualifier()
 {
-    mType.setQualifier(EvqTemporary);
+    setTypeQualifier(EvqTemporary);
     if (mOp == EOpCallBuiltInFunction)
     {
         setBuiltInFunctionPrecision();
@@ -576,7 +609,7 @@ void TIntermAggregate::setPrecisionAndQualifier()
         }
         if (areChildrenConstQualified())
         {
-            mType.setQualifier(EvqConst);
+            setTypeQualifier(EvqConst);
         }
     }
 }
@@ -599,7 +632,7 @@ void TIntermAggregate::setPrecisionFromChildren()
     mGotPrecisionFromChildren = true;
     if (getBasicType() == EbtBool)
     {
-        mType.setPrecision(EbpUndefined);
+        setTypePrecision(EbpUndefined);
         return;
     }
 
@@ -612,7 +645,7 @@ void TIntermAggregate::setPrecisionFromChildren()
             precision = GetHigherPrecision(typed->getPrecision(), precision);
         ++childIter;
     }
-    mType.setPrecision(precision);
+    setTypePrecision(precision);
 }
 
 void TIntermAggregate::setPrecisionForBuiltInOp()
@@ -630,17 +663,17 @@ bool TIntermAggregate::setPrecisionForSpecialBuiltInOp()
     switch (mOp)
     {
         case EOpBitfieldExtract:
-            mType.setPrecision(mArguments[0]->getAsTyped()->getPrecision());
+            setTypePrecision(mArguments[0]->getAsTyped()->getPrecision());
             mGotPrecisionFromChildren = true;
             return true;
         case EOpBitfieldInsert:
-            mType.setPrecision(GetHigherPrecision(mArguments[0]->getAsTyped()->getPrecision(),
-                                                  mArguments[1]->getAsTyped()->getPrecision()));
+            setTypePrecision(GetHigherPrecision(mArguments[0]->getAsTyped()->getPrecision(),
+                                                mArguments[1]->getAsTyped()->getPrecision()));
             mGotPrecisionFromChildren = true;
             return true;
         case EOpUaddCarry:
         case EOpUsubBorrow:
-            mType.setPrecision(EbpHigh);
+            setTypePrecision(EbpHigh);
             return true;
         default:
             return false;
@@ -667,9 +700,9 @@ void TIntermAggregate::setBuiltInFunctionPrecision()
     // ESSL 3.0 spec section 8: textureSize always gets highp precision.
     // All other functions that take a sampler are assumed to be texture functions.
     if (mFunction->name() == "textureSize")
-        mType.setPrecision(EbpHigh);
+        setTypePrecision(EbpHigh);
     else
-        mType.setPrecision(precision);
+        setTypePrecision(precision);
 }
 
 const char *TIntermAggregate::functionName() const
@@ -1013,6 +1046,7 @@ TIntermAggregate::TIntermAggregate(const TIntermAggregate &node)
       mGotPrecisionFromChildren(node.mGotPrecisionFromChildren),
       mFunction(node.mFunction)
 {
+    mArguments.reserve(node.mArguments.size());
     for (TIntermNode *arg : node.mArguments)
     {
         TIntermTyped *typedArg = arg->getAsTyped();
@@ -1026,7 +1060,7 @@ TIntermAggregate *TIntermAggregate::shallowCopy() const
 {
     TIntermSequence *copySeq = new TIntermSequence();
     copySeq->insert(copySeq->begin(), getSequence()->begin(), getSequence()->end());
-    TIntermAggregate *copyNode = new TIntermAggregate(mFunction, mType, mOp, copySeq);
+    TIntermAggregate *copyNode = new TIntermAggregate(mFunction, *mType, mOp, copySeq);
     copyNode->setLine(mLine);
     return copyNode;
 }
@@ -1277,14 +1311,17 @@ void TIntermUnary::promote()
             setType(TType(EbtInt, EbpLow, resultQualifier, operandPrimarySize));
             break;
         default:
-            setType(mOperand->getType());
-            mType.setQualifier(resultQualifier);
+        {
+            TType type(mOperand->getType());
+            type.setQualifier(resultQualifier);
+            setType(type);
             break;
+        }
     }
 }
 
 TIntermSwizzle::TIntermSwizzle(TIntermTyped *operand, const TVector<int> &swizzleOffsets)
-    : TIntermExpression(TType(EbtFloat, EbpUndefined)),
+    : TIntermExpression(),
       mOperand(operand),
       mSwizzleOffsets(swizzleOffsets),
       mHasFoldedDuplicateOffsets(false)
@@ -1314,7 +1351,7 @@ TIntermBinary *TIntermBinary::CreateComma(TIntermTyped *left,
                                           int shaderVersion)
 {
     TIntermBinary *node = new TIntermBinary(EOpComma, left, right);
-    node->getTypePointer()->setQualifier(GetCommaQualifier(shaderVersion, left, right));
+    node->setTypeQualifier(GetCommaQualifier(shaderVersion, left, right));
     return node;
 }
 
@@ -1337,8 +1374,7 @@ TIntermTernary::TIntermTernary(TIntermTyped *cond,
     ASSERT(mCondition);
     ASSERT(mTrueExpression);
     ASSERT(mFalseExpression);
-    getTypePointer()->setQualifier(
-        TIntermTernary::DetermineQualifier(cond, trueExpression, falseExpression));
+    setTypeQualifier(TIntermTernary::DetermineQualifier(cond, trueExpression, falseExpression));
 }
 
 TIntermLoop::TIntermLoop(TLoopType type,
@@ -1500,19 +1536,19 @@ void TIntermBinary::promote()
         return;
     }
 
-    // Base assumption:  just make the type the same as the left
-    // operand.  Then only deviations from this need be coded.
-    setType(mLeft->getType());
-
     TQualifier resultQualifier = EvqConst;
     // Binary operations results in temporary variables unless both
     // operands are const.
     if (mLeft->getQualifier() != EvqConst || mRight->getQualifier() != EvqConst)
     {
         resultQualifier = EvqTemporary;
-        getTypePointer()->setQualifier(EvqTemporary);
     }
 
+    // Base assumption:  just make the type the same as the left
+    // operand.  Then only deviations from this need be coded.
+    TType type(mLeft->getType());
+    type.setQualifier(resultQualifier);
+
     // Handle indexing ops.
     switch (mOp)
     {
@@ -1520,7 +1556,8 @@ void TIntermBinary::promote()
         case EOpIndexIndirect:
             if (mLeft->isArray())
             {
-                mType.toArrayElementType();
+                type.toArrayElementType();
+                setType(type);
             }
             else if (mLeft->isMatrix())
             {
@@ -1540,16 +1577,18 @@ void TIntermBinary::promote()
         {
             const TFieldList &fields = mLeft->getType().getStruct()->fields();
             const int i              = mRight->getAsConstantUnion()->getIConst(0);
-            setType(*fields[i]->type());
-            getTypePointer()->setQualifier(resultQualifier);
+            TType fieldType(*fields[i]->type());
+            fieldType.setQualifier(resultQualifier);
+            setType(fieldType);
             return;
         }
         case EOpIndexDirectInterfaceBlock:
         {
             const TFieldList &fields = mLeft->getType().getInterfaceBlock()->fields();
             const int i              = mRight->getAsConstantUnion()->getIConst(0);
-            setType(*fields[i]->type());
-            getTypePointer()->setQualifier(resultQualifier);
+            TType fieldType(*fields[i]->type());
+            fieldType.setQualifier(resultQualifier);
+            setType(fieldType);
             return;
         }
         default:
@@ -1560,7 +1599,7 @@ void TIntermBinary::promote()
 
     // The result gets promoted to the highest precision.
     TPrecision higherPrecision = GetHigherPrecision(mLeft->getPrecision(), mRight->getPrecision());
-    getTypePointer()->setPrecision(higherPrecision);
+    type.setPrecision(higherPrecision);
 
     const int nominalSize = std::max(mLeft->getNominalSize(), mRight->getNominalSize());
 
@@ -1580,7 +1619,7 @@ void TIntermBinary::promote()
             case EOpGreaterThan:
             case EOpLessThanEqual:
             case EOpGreaterThanEqual:
-                setType(TType(EbtBool, EbpUndefined, resultQualifier));
+                type = TType(EbtBool, EbpUndefined, resultQualifier);
                 break;
 
             //
@@ -1590,12 +1629,13 @@ void TIntermBinary::promote()
             case EOpLogicalXor:
             case EOpLogicalOr:
                 ASSERT(mLeft->getBasicType() == EbtBool && mRight->getBasicType() == EbtBool);
-                setType(TType(EbtBool, EbpUndefined, resultQualifier));
+                type = TType(EbtBool, EbpUndefined, resultQualifier);
                 break;
 
             default:
                 break;
         }
+        setType(type);
         return;
     }
 
@@ -1610,27 +1650,27 @@ void TIntermBinary::promote()
         case EOpMatrixTimesScalar:
             if (mRight->isMatrix())
             {
-                setType(TType(basicType, higherPrecision, resultQualifier,
-                              static_cast<unsigned char>(mRight->getCols()),
-                              static_cast<unsigned char>(mRight->getRows())));
+                type = TType(basicType, higherPrecision, resultQualifier,
+                             static_cast<unsigned char>(mRight->getCols()),
+                             static_cast<unsigned char>(mRight->getRows()));
             }
             break;
         case EOpMatrixTimesVector:
-            setType(TType(basicType, higherPrecision, resultQualifier,
-                          static_cast<unsigned char>(mLeft->getRows()), 1));
+            type = TType(basicType, higherPrecision, resultQualifier,
+                         static_cast<unsigned char>(mLeft->getRows()), 1);
             break;
         case EOpMatrixTimesMatrix:
-            setType(TType(basicType, higherPrecision, resultQualifier,
-                          static_cast<unsigned char>(mRight->getCols()),
-                          static_cast<unsigned char>(mLeft->getRows())));
+            type = TType(basicType, higherPrecision, resultQualifier,
+                         static_cast<unsigned char>(mRight->getCols()),
+                         static_cast<unsigned char>(mLeft->getRows()));
             break;
         case EOpVectorTimesScalar:
-            setType(TType(basicType, higherPrecision, resultQualifier,
-                          static_cast<unsigned char>(nominalSize), 1));
+            type = TType(basicType, higherPrecision, resultQualifier,
+                         static_cast<unsigned char>(nominalSize), 1);
             break;
         case EOpVectorTimesMatrix:
-            setType(TType(basicType, higherPrecision, resultQualifier,
-                          static_cast<unsigned char>(mRight->getCols()), 1));
+            type = TType(basicType, higherPrecision, resultQualifier,
+                         static_cast<unsigned char>(mRight->getCols()), 1);
             break;
         case EOpMulAssign:
         case EOpVectorTimesScalarAssign:
@@ -1665,9 +1705,9 @@ void TIntermBinary::promote()
         {
             const int secondarySize =
                 std::max(mLeft->getSecondarySize(), mRight->getSecondarySize());
-            setType(TType(basicType, higherPrecision, resultQualifier,
-                          static_cast<unsigned char>(nominalSize),
-                          static_cast<unsigned char>(secondarySize)));
+            type = TType(basicType, higherPrecision, resultQualifier,
+                         static_cast<unsigned char>(nominalSize),
+                         static_cast<unsigned char>(secondarySize));
             ASSERT(!mLeft->isArray() && !mRight->isArray());
             break;
         }
@@ -1679,7 +1719,7 @@ void TIntermBinary::promote()
         case EOpGreaterThanEqual:
             ASSERT((mLeft->getNominalSize() == mRight->getNominalSize()) &&
                    (mLeft->getSecondarySize() == mRight->getSecondarySize()));
-            setType(TType(EbtBool, EbpUndefined, resultQualifier));
+            type = TType(EbtBool, EbpUndefined, resultQualifier);
             break;
 
         case EOpIndexDirect:
@@ -1693,6 +1733,7 @@ void TIntermBinary::promote()
             UNREACHABLE();
             break;
     }
+    setType(type);
 }
 
 bool TIntermConstantUnion::hasConstantValue() const
@@ -1971,13 +2012,13 @@ TIntermTyped *TIntermAggregate::fold(TDiagnostics *diagnostics)
     const TConstantUnion *constArray = nullptr;
     if (isConstructor())
     {
-        if (mType.canReplaceWithConstantUnion())
+        if (mType->canReplaceWithConstantUnion())
         {
             constArray = getConstantValue();
-            if (constArray && mType.getBasicType() == EbtUInt)
+            if (constArray && mType->getBasicType() == EbtUInt)
             {
                 // Check if we converted a negative float to uint and issue a warning in that case.
-                size_t sizeRemaining = mType.getObjectSize();
+                size_t sizeRemaining = mType->getObjectSize();
                 for (TIntermNode *arg : mArguments)
                 {
                     TIntermTyped *typedArg = arg->getAsTyped();
@@ -1993,7 +2034,7 @@ TIntermTyped *TIntermAggregate::fold(TDiagnostics *diagnostics)
                                 // ESSL 3.00.6 section 5.4.1.
                                 diagnostics->warning(
                                     mLine, "casting a negative float to uint is undefined",
-                                    mType.getBuiltInTypeNameString());
+                                    mType->getBuiltInTypeNameString());
                             }
                         }
                     }
@@ -283,16 +283,21 @@ class TIntermExpression : public TIntermTyped
   public:
     TIntermExpression(const TType &t);
 
-    const TType &getType() const override { return mType; }
+    const TType &getType() const override { return *mType; }
 
   protected:
-    TType *getTypePointer() { return &mType; }
-    void setType(const TType &t) { mType = t; }
+    // For nodes that compute their type from their children in the constructor.
+    TIntermExpression();
+
+    // The type may be shared with other nodes, so it is replaced rather than changed in place.
+    void setType(const TType &t) { mType = TScopedTypeSharing::GetSharedType(t); }
     void setTypePreservePrecision(const TType &t);
+    void setTypeQualifier(TQualifier qualifier);
+    void setTypePrecision(TPrecision precision);
 
     TIntermExpression(const TIntermExpression &node) = default;
 
-    TType mType;
+    const TType *mType;
 };
 
 // Constant folded node.
@@ -391,7 +396,7 @@ class TIntermOperator : public TIntermExpression
     bool hasSideEffects() const override { return isAssignment(); }
 
   protected:
-    TIntermOperator(TOperator op) : TIntermExpression(TType(EbtFloat, EbpUndefined)), mOp(op) {}
+    TIntermOperator(TOperator op) : TIntermExpression(), mOp(op) {}
     TIntermOperator(TOperator op, const TType &type) : TIntermExpression(type), mOp(op) {}
 
     TIntermOperator(const TIntermOperator &) = default;
@@ -30,6 +30,15 @@ TOutputESSL::TOutputESSL(TInfoSinkBase &objSink,
       mForceHighp(forceHighp)
 {}
 
+TOutputESSL::TOutputESSL(TInfoSinkBase &objSink, const TOutputESSL &other)
+    : TOutputGLSLBase(objSink, other), mForceHighp(other.mForceHighp)
+{}
+
+std::unique_ptr<TOutputGLSLBase> TOutputESSL::createFunctionOutput(TInfoSinkBase &objSink) const
+{
+    return std::unique_ptr<TOutputGLSLBase>(new TOutputESSL(objSink, *this));
+}
+
 bool TOutputESSL::writeVariablePrecision(TPrecision precision)
 {
     if (precision == EbpUndefined)
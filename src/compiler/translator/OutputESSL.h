@@ -26,6 +26,9 @@ class TOutputESSL : public TOutputGLSLBase
                 ShCompileOptions compileOptions);
 
   protected:
+    TOutputESSL(TInfoSinkBase &objSink, const TOutputESSL &other);
+
+    std::unique_ptr<TOutputGLSLBase> createFunctionOutput(TInfoSinkBase &objSink) const override;
     bool writeVariablePrecision(TPrecision precision) override;
 
   private:
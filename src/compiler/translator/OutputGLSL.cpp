@@ -31,6 +31,15 @@ TOutputGLSL::TOutputGLSL(TInfoSinkBase &objSink,
                       compileOptions)
 {}
 
+TOutputGLSL::TOutputGLSL(TInfoSinkBase &objSink, const TOutputGLSL &other)
+    : TOutputGLSLBase(objSink, other)
+{}
+
+std::unique_ptr<TOutputGLSLBase> TOutputGLSL::createFunctionOutput(TInfoSinkBase &objSink) const
+{
+    return std::unique_ptr<TOutputGLSLBase>(new TOutputGLSL(objSink, *this));
+}
+
 bool TOutputGLSL::writeVariablePrecision(TPrecision)
 {
     return false;
@@ -26,6 +26,9 @@ class TOutputGLSL : public TOutputGLSLBase
                 ShCompileOptions compileOptions);
 
   protected:
+    TOutputGLSL(TInfoSinkBase &objSink, const TOutputGLSL &other);
+
+    std::unique_ptr<TOutputGLSLBase> createFunctionOutput(TInfoSinkBase &objSink) const override;
     bool writeVariablePrecision(TPrecision) override;
     void visitSymbol(TIntermSymbol *node) override;
     ImmutableString translateTextureFunction(const ImmutableString &name) override;
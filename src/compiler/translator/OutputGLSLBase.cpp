@@ -10,9 +10,12 @@
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "compiler/translator/Compiler.h"
+#include "compiler/translator/tree_util/DeepCopyTree.h"
 #include "compiler/translator/util.h"
 
+#include <algorithm>
 #include <cfloat>
+#include <thread>
 
 namespace sh
 {
@@ -20,6 +23,10 @@ namespace sh
 namespace
 {
 
+// Function definitions are only written on other threads when there are enough of them to make up
+// for starting the threads.
+constexpr size_t kMinFunctionsPerThread = 4;
+
 bool isSingleStatement(TIntermNode *node)
 {
     if (node->getAsFunctionDefinition())
@@ -98,7 +105,23 @@ TOutputGLSLBase::TOutputGLSLBase(TInfoSinkBase &objSink,
       mShaderType(shaderType),
       mShaderVersion(shaderVersion),
       mOutput(output),
-      mCompileOptions(compileOptions)
+      mCompileOptions(compileOptions),
+      mFunctionOutputThreadCount(0)
+{}
+
+TOutputGLSLBase::TOutputGLSLBase(TInfoSinkBase &objSink, const TOutputGLSLBase &other)
+    : TIntermTraverser(true, true, true, other.mSymbolTable),
+      mObjSink(objSink),
+      mDeclaringVariable(false),
+      mDeclaredStructs(other.mDeclaredStructs),
+      mClampingStrategy(other.mClampingStrategy),
+      mHashFunction(other.mHashFunction),
+      mNameMap(other.mNameMap),
+      mShaderType(other.mShaderType),
+      mShaderVersion(other.mShaderVersion),
+      mOutput(other.mOutput),
+      mCompileOptions(other.mCompileOptions),
+      mFunctionOutputThreadCount(other.mFunctionOutputThreadCount)
 {}
 
 void TOutputGLSLBase::writeInvariantQualifier(const TType &type)
@@ -852,6 +875,12 @@ bool TOutputGLSLBase::visitCase(Visit visit, TIntermCase *node)
 
 bool TOutputGLSLBase::visitBlock(Visit visit, TIntermBlock *node)
 {
+    if (getCurrentTraversalDepth() == 0 && (mCompileOptions & SH_PARALLEL_FUNCTION_OUTPUT) != 0 &&
+        writeGlobalScopeInParallel(node))
+    {
+        return false;
+    }
+
     TInfoSinkBase &out = objSink();
     // Scope the blocks except when at the global scope.
     if (getCurrentTraversalDepth() > 0)
@@ -878,6 +907,117 @@ bool TOutputGLSLBase::visitBlock(Visit visit, TIntermBlock *node)
     return false;
 }
 
+bool TOutputGLSLBase::writeGlobalScopeInParallel(TIntermBlock *root)
+{
+    // Hashing names adds them to the shared name map.
+    if (mHashFunction != nullptr)
+    {
+        return false;
+    }
+
+    std::vector<FunctionOutput> functionOutputs;
+    for (TIntermNode *statement : *root->getSequence())
+    {
+        TIntermFunctionDefinition *definition = statement->getAsFunctionDefinition();
+        if (definition == nullptr)
+        {
+            continue;
+        }
+        // A struct declared in the return type would also be declared for the rest of the global
+        // scope.
+        if (definition->getFunction()->getReturnType().isStructSpecifier())
+        {
+            return false;
+        }
+        functionOutputs.push_back({definition, 0, TInfoSinkBase()});
+    }
+
+    size_t threadCount = mFunctionOutputThreadCount > 0
+                             ? static_cast<size_t>(mFunctionOutputThreadCount)
+                             : static_cast<size_t>(std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, functionOutputs.size() / kMinFunctionsPerThread);
+    if (threadCount <= 1)
+    {
+        return false;
+    }
+
+    // Write everything but the function definitions, and remember where they go. Functions can
+    // only refer to the structs declared before them, so declaring all the global structs before
+    // writing any function doesn't change the output.
+    TInfoSinkBase &out      = objSink();
+    auto functionOutputIter = functionOutputs.begin();
+    for (TIntermNode *statement : *root->getSequence())
+    {
+        if (statement->getAsFunctionDefinition() != nullptr)
+        {
+            functionOutputIter->offset = out.str().size();
+            ++functionOutputIter;
+            continue;
+        }
+
+        statement->traverse(this);
+        if (isSingleStatement(statement))
+            out << ";\n";
+    }
+
+    // Nothing may be computed lazily while the tree is read from several threads.
+    PrepareTreeForSharing(root);
+
+    std::atomic<size_t> nextFunction(0);
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(&TOutputGLSLBase::writeFunctionDefinitions, this, &functionOutputs,
+                             &nextFunction);
+    }
+    writeFunctionDefinitions(&functionOutputs, &nextFunction);
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    // Put the code of the functions in place, in their original order.
+    const TPersistString globalCode = out.str();
+    out.erase();
+    out.reserve(globalCode.size());
+
+    size_t copiedLength = 0;
+    for (const FunctionOutput &functionOutput : functionOutputs)
+    {
+        out << globalCode.substr(copiedLength, functionOutput.offset - copiedLength)
+            << functionOutput.sink.str();
+        copiedLength = functionOutput.offset;
+    }
+    out << globalCode.substr(copiedLength);
+    return true;
+}
+
+void TOutputGLSLBase::writeFunctionDefinitions(std::vector<FunctionOutput> *functionOutputs,
+                                               std::atomic<size_t> *nextFunction) const
+{
+    // What's allocated while writing a function is only needed until its code is written.
+    TPoolAllocator allocator;
+    allocator.push();
+    TPoolAllocator *previousAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&allocator);
+
+    while (true)
+    {
+        size_t index = (*nextFunction)++;
+        if (index >= functionOutputs->size())
+        {
+            break;
+        }
+
+        FunctionOutput &functionOutput = (*functionOutputs)[index];
+        std::unique_ptr<TOutputGLSLBase> output(createFunctionOutput(functionOutput.sink));
+        functionOutput.definition->traverse(output.get());
+    }
+
+    SetGlobalPoolAllocator(previousAllocator);
+    allocator.pop();
+}
+
 bool TOutputGLSLBase::visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node)
 {
     TIntermFunctionPrototype *prototype = node->getFunctionPrototype();
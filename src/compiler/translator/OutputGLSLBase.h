@@ -7,7 +7,10 @@
 #ifndef COMPILER_TRANSLATOR_OUTPUTGLSLBASE_H_
 #define COMPILER_TRANSLATOR_OUTPUTGLSLBASE_H_
 
+#include <atomic>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/InfoSink.h"
@@ -31,12 +34,24 @@ class TOutputGLSLBase : public TIntermTraverser
 
     ShShaderOutput getShaderOutput() const { return mOutput; }
 
+    // Sets the number of threads that write function definitions with SH_PARALLEL_FUNCTION_OUTPUT.
+    // 0 uses one thread per CPU core.
+    void setFunctionOutputThreadCount(int threadCount) { mFunctionOutputThreadCount = threadCount; }
+
     // Return the original name if hash function pointer is NULL;
     // otherwise return the hashed name. Has special handling for internal names and built-ins,
     // which are not hashed.
     ImmutableString hashName(const TSymbol *symbol);
 
   protected:
+    // Writes to |objSink| with the same settings as |other|, and with the structs that |other| has
+    // declared so far.
+    TOutputGLSLBase(TInfoSinkBase &objSink, const TOutputGLSLBase &other);
+
+    // Creates a traverser like this one that writes to |objSink|. Used to write function
+    // definitions on other threads with SH_PARALLEL_FUNCTION_OUTPUT.
+    virtual std::unique_ptr<TOutputGLSLBase> createFunctionOutput(TInfoSinkBase &objSink) const = 0;
+
     TInfoSinkBase &objSink() { return mObjSink; }
     void writeFloat(TInfoSinkBase &out, float f);
     void writeTriplet(Visit visit, const char *preStr, const char *inStr, const char *postStr);
@@ -81,6 +96,20 @@ class TOutputGLSLBase : public TIntermTraverser
     bool structDeclared(const TStructure *structure) const;
 
   private:
+    struct FunctionOutput
+    {
+        TIntermFunctionDefinition *definition;
+        // Where the code of the function goes in the sink of the global scope.
+        size_t offset;
+        TInfoSinkBase sink;
+    };
+
+    // Writes the global scope with the function definitions written on several threads. Returns
+    // false without writing anything if that can't give the same output or isn't worth it.
+    bool writeGlobalScopeInParallel(TIntermBlock *root);
+    void writeFunctionDefinitions(std::vector<FunctionOutput> *functionOutputs,
+                                  std::atomic<size_t> *nextFunction) const;
+
     void declareInterfaceBlockLayout(const TInterfaceBlock *interfaceBlock);
     void declareInterfaceBlock(const TInterfaceBlock *interfaceBlock);
 
@@ -108,6 +137,8 @@ class TOutputGLSLBase : public TIntermTraverser
     ShShaderOutput mOutput;
 
     ShCompileOptions mCompileOptions;
+
+    int mFunctionOutputThreadCount;
 };
 
 void WriteGeometryShaderLayoutQualifiers(TInfoSinkBase &out,
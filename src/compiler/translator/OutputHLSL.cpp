@@ -362,9 +362,11 @@ void OutputHLSL::output(TIntermNode *treeRoot, TInfoSinkBase &objSink)
     header(mHeader, std140Structs, &builtInFunctionEmulator);
     mInfoSinkStack.pop();
 
-    objSink << mHeader.c_str();
-    objSink << mBody.c_str();
-    objSink << mFooter.c_str();
+    objSink.reserve(objSink.str().size() + mHeader.str().size() + mBody.str().size() +
+                    mFooter.str().size());
+    objSink << mHeader.str();
+    objSink << mBody.str();
+    objSink << mFooter.str();
 
     builtInFunctionEmulator.cleanup();
 }
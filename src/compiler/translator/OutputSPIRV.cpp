@@ -0,0 +1,2770 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OutputSPIRV:
+//   Generates SPIR-V directly from the AST of a GLSL ES 1.00 shader that went through the
+//   Vulkan-specific transformations of TranslatorVulkan.
+//
+
+#include "compiler/translator/OutputSPIRV.h"
+
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+
+#include "angle_gl.h"
+#include "common/mathutil.h"
+#include "common/spirv_constants.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/Symbol.h"
+
+namespace sh
+{
+
+namespace
+{
+
+namespace spirv = angle::spirv;
+
+using SpirvId   = uint32_t;
+using SpirvBlob = std::vector<uint32_t>;
+
+constexpr char kLineRasterEmulationDefine[] = "ANGLE_ENABLE_LINE_SEGMENT_RASTERIZATION";
+
+// std140 rounds up the alignment of arrays, matrices and structs to the size of a vec4.
+constexpr uint32_t kStd140VectorSize = 16;
+
+void AppendInstruction(SpirvBlob *blob, spirv::Op op, std::initializer_list<uint32_t> operands)
+{
+    blob->push_back(spirv::MakeFirstWord(op, operands.size() + 1));
+    blob->insert(blob->end(), operands.begin(), operands.end());
+}
+
+void AppendInstruction(SpirvBlob *blob, spirv::Op op, const std::vector<uint32_t> &operands)
+{
+    blob->push_back(spirv::MakeFirstWord(op, operands.size() + 1));
+    blob->insert(blob->end(), operands.begin(), operands.end());
+}
+
+// Literal strings are nul-terminated and padded with zeros to a whole number of words.
+void AppendString(std::vector<uint32_t> *operands, const std::string &str)
+{
+    size_t start = operands->size();
+    operands->resize(start + str.length() / 4 + 1, 0);
+    memcpy(&(*operands)[start], str.c_str(), str.length());
+}
+
+std::vector<const TType *> GetFieldTypes(const TFieldList &fields)
+{
+    std::vector<const TType *> types;
+    for (const TField *field : fields)
+    {
+        types.push_back(field->type());
+    }
+    return types;
+}
+
+uint32_t GetStd140Size(const TType &type);
+
+uint32_t GetStd140Alignment(const TType &type)
+{
+    if (type.isArray() || type.isMatrix() || type.getStruct() != nullptr)
+    {
+        return kStd140VectorSize;
+    }
+    switch (type.getNominalSize())
+    {
+        case 1:
+            return 4;
+        case 2:
+            return 8;
+        default:
+            return kStd140VectorSize;
+    }
+}
+
+uint32_t GetStd140ArrayStride(const TType &elementType)
+{
+    return rx::roundUp(GetStd140Size(elementType), kStd140VectorSize);
+}
+
+// Computes the std140 offsets of the members of a struct or a block, and returns its size.
+uint32_t GetStd140MemberOffsets(const std::vector<const TType *> &memberTypes,
+                                std::vector<uint32_t> *offsetsOut)
+{
+    uint32_t offset = 0;
+    for (const TType *memberType : memberTypes)
+    {
+        offset = rx::roundUp(offset, GetStd140Alignment(*memberType));
+        offsetsOut->push_back(offset);
+        offset += GetStd140Size(*memberType);
+    }
+    return rx::roundUp(offset, kStd140VectorSize);
+}
+
+uint32_t GetStd140Size(const TType &type)
+{
+    if (type.isArray())
+    {
+        TType elementType(type);
+        elementType.toArrayElementType();
+        return GetStd140ArrayStride(elementType) * type.getOutermostArraySize();
+    }
+    if (type.getStruct() != nullptr)
+    {
+        std::vector<uint32_t> offsets;
+        return GetStd140MemberOffsets(GetFieldTypes(type.getStruct()->fields()), &offsets);
+    }
+    if (type.isMatrix())
+    {
+        return kStd140VectorSize * type.getCols();
+    }
+    return 4 * type.getNominalSize();
+}
+
+bool IsComponentWiseBinaryBuiltIn(TOperator op)
+{
+    switch (op)
+    {
+        case EOpEqualComponentWise:
+        case EOpNotEqualComponentWise:
+        case EOpLessThanComponentWise:
+        case EOpLessThanEqualComponentWise:
+        case EOpGreaterThanComponentWise:
+        case EOpGreaterThanEqualComponentWise:
+        case EOpMulMatrixComponentWise:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Built-ins whose scalar arguments are applied to every component of their vector arguments.
+bool IsScalarExpandingBuiltIn(TOperator op)
+{
+    switch (op)
+    {
+        case EOpMod:
+        case EOpMin:
+        case EOpMax:
+        case EOpClamp:
+        case EOpMix:
+        case EOpStep:
+        case EOpSmoothstep:
+            return true;
+        default:
+            return false;
+    }
+}
+
+TOperator GetCompoundAssignmentBaseOp(TOperator op)
+{
+    switch (op)
+    {
+        case EOpAddAssign:
+            return EOpAdd;
+        case EOpSubAssign:
+            return EOpSub;
+        case EOpMulAssign:
+            return EOpMul;
+        case EOpVectorTimesMatrixAssign:
+            return EOpVectorTimesMatrix;
+        case EOpVectorTimesScalarAssign:
+            return EOpVectorTimesScalar;
+        case EOpMatrixTimesScalarAssign:
+            return EOpMatrixTimesScalar;
+        case EOpMatrixTimesMatrixAssign:
+            return EOpMatrixTimesMatrix;
+        case EOpDivAssign:
+            return EOpDiv;
+        case EOpIModAssign:
+            return EOpIMod;
+        case EOpBitShiftLeftAssign:
+            return EOpBitShiftLeft;
+        case EOpBitShiftRightAssign:
+            return EOpBitShiftRight;
+        case EOpBitwiseAndAssign:
+            return EOpBitwiseAnd;
+        case EOpBitwiseXorAssign:
+            return EOpBitwiseXor;
+        case EOpBitwiseOrAssign:
+            return EOpBitwiseOr;
+        default:
+            return EOpNull;
+    }
+}
+
+spirv::Op GetArithmeticOp(TOperator op, TBasicType basicType)
+{
+    bool isFloat = basicType == EbtFloat;
+    bool isUInt  = basicType == EbtUInt;
+    switch (op)
+    {
+        case EOpAdd:
+            return isFloat ? spirv::OpFAdd : spirv::OpIAdd;
+        case EOpSub:
+            return isFloat ? spirv::OpFSub : spirv::OpISub;
+        case EOpMul:
+        case EOpMulMatrixComponentWise:
+            return isFloat ? spirv::OpFMul : spirv::OpIMul;
+        case EOpDiv:
+            return isFloat ? spirv::OpFDiv : (isUInt ? spirv::OpUDiv : spirv::OpSDiv);
+        case EOpIMod:
+            return isUInt ? spirv::OpUMod : spirv::OpSMod;
+        case EOpBitShiftLeft:
+            return spirv::OpShiftLeftLogical;
+        case EOpBitShiftRight:
+            return isUInt ? spirv::OpShiftRightLogical : spirv::OpShiftRightArithmetic;
+        case EOpBitwiseAnd:
+            return spirv::OpBitwiseAnd;
+        case EOpBitwiseXor:
+            return spirv::OpBitwiseXor;
+        case EOpBitwiseOr:
+            return spirv::OpBitwiseOr;
+        default:
+            UNREACHABLE();
+            return spirv::OpNop;
+    }
+}
+
+spirv::Op GetComparisonOp(TOperator op, TBasicType basicType)
+{
+    bool isFloat = basicType == EbtFloat;
+    bool isUInt  = basicType == EbtUInt;
+    switch (op)
+    {
+        case EOpEqual:
+        case EOpEqualComponentWise:
+            return isFloat ? spirv::OpFOrdEqual
+                           : (basicType == EbtBool ? spirv::OpLogicalEqual : spirv::OpIEqual);
+        case EOpNotEqualComponentWise:
+            return isFloat ? spirv::OpFOrdNotEqual
+                           : (basicType == EbtBool ? spirv::OpLogicalNotEqual : spirv::OpINotEqual);
+        case EOpLessThan:
+        case EOpLessThanComponentWise:
+            return isFloat ? spirv::OpFOrdLessThan
+                           : (isUInt ? spirv::OpULessThan : spirv::OpSLessThan);
+        case EOpGreaterThan:
+        case EOpGreaterThanComponentWise:
+            return isFloat ? spirv::OpFOrdGreaterThan
+                           : (isUInt ? spirv::OpUGreaterThan : spirv::OpSGreaterThan);
+        case EOpLessThanEqual:
+        case EOpLessThanEqualComponentWise:
+            return isFloat ? spirv::OpFOrdLessThanEqual
+                           : (isUInt ? spirv::OpULessThanEqual : spirv::OpSLessThanEqual);
+        case EOpGreaterThanEqual:
+        case EOpGreaterThanEqualComponentWise:
+            return isFloat ? spirv::OpFOrdGreaterThanEqual
+                           : (isUInt ? spirv::OpUGreaterThanEqual : spirv::OpSGreaterThanEqual);
+        default:
+            UNREACHABLE();
+            return spirv::OpNop;
+    }
+}
+
+// The value of an expression.  L-values are kept as an access chain so that they can be both
+// loaded and stored, and are only loaded when their value is used.
+struct NodeData
+{
+    bool isLValue() const { return baseId != 0; }
+
+    // The type of the expression.
+    const TType *type = nullptr;
+
+    // The value of an r-value.
+    SpirvId value = 0;
+
+    // The variable an l-value's access chain starts from, and its storage class.
+    SpirvId baseId                   = 0;
+    spirv::StorageClass storageClass = spirv::StorageClassFunction;
+    // Set for l-values in the default and driver uniform blocks, whose types follow the std140
+    // layout and are converted to the regular types when they are loaded.
+    bool blockLayout = false;
+    std::vector<SpirvId> indices;
+    // The type the access chain points to.  It's only different from |type| when a multi-component
+    // swizzle is applied to the loaded vector.
+    const TType *chainType = nullptr;
+    std::vector<int> swizzle;
+};
+
+NodeData MakeRValue(const TType &type, SpirvId value)
+{
+    NodeData data;
+    data.type  = &type;
+    data.value = value;
+    return data;
+}
+
+struct VariableInfo
+{
+    SpirvId id;
+    spirv::StorageClass storageClass;
+    bool blockLayout;
+};
+
+struct FunctionInfo
+{
+    SpirvId id                = 0;
+    bool defined              = false;
+    const TFunction *function = nullptr;
+};
+
+struct LoopInfo
+{
+    SpirvId continueLabel;
+    SpirvId mergeLabel;
+};
+
+class SPIRVBuilder : angle::NonCopyable
+{
+  public:
+    SPIRVBuilder(sh::GLenum shaderType,
+                 const TVector<const TVariable *> &defaultUniforms,
+                 const TVariable *driverUniforms,
+                 bool lineRasterEmulation);
+
+    bool generate(TIntermBlock *root, SpirvBlob *spirvOut);
+
+  private:
+    // Every type is identified by its basic type and sizes, its struct or block, or its element
+    // type and array size.  Types in the std140 layout are decorated, and are distinct types.
+    using TypeKey = std::tuple<TBasicType,
+                               int,
+                               int,
+                               const TFieldListCollection *,
+                               SpirvId,
+                               unsigned int,
+                               bool>;
+
+    SpirvId newId() { return mNextId++; }
+    void setUnsupported() { mUnsupported = true; }
+
+    void addName(SpirvId id, const std::string &name);
+    void addDecoration(SpirvId id, spirv::Decoration decoration);
+    void addDecoration(SpirvId id, spirv::Decoration decoration, uint32_t value);
+    void addLocationPlaceholder(SpirvId id);
+    void addBindingPlaceholder(SpirvId id);
+    void decorateStd140Members(SpirvId structTypeId, const std::vector<const TType *> &memberTypes);
+
+    // Types.
+    SpirvId getBasicTypeId(TBasicType basicType, int size);
+    SpirvId getMatrixTypeId(int cols, int rows);
+    SpirvId getTypeId(const TType &type, bool blockLayout);
+    SpirvId getTypeId(const TType &type) { return getTypeId(type, false); }
+    SpirvId getPointerTypeId(spirv::StorageClass storageClass, SpirvId typeId);
+    SpirvId getFunctionTypeId(SpirvId returnTypeId, const std::vector<SpirvId> &paramTypeIds);
+    SpirvId getParameterTypeId(const TType &paramType);
+
+    // Constants.
+    SpirvId getScalarConstant(TBasicType basicType, uint32_t bits);
+    SpirvId getIntConstant(int value) { return getScalarConstant(EbtInt, value); }
+    SpirvId getFloatConstant(float value);
+    SpirvId getBoolConstant(bool value);
+    SpirvId getCompositeConstant(SpirvId typeId, const std::vector<SpirvId> &components);
+    SpirvId getSplatConstant(TBasicType basicType, int size, uint32_t bits);
+    SpirvId getConstant(const TType &type, const TConstantUnion *values);
+    SpirvId getConstantRecursive(const TType &type, const TConstantUnion **values);
+
+    // Variables.
+    SpirvId declareGlobalVariable(spirv::StorageClass storageClass,
+                                  SpirvId typeId,
+                                  SpirvId initializerId,
+                                  const char *name);
+    SpirvId declareFunctionVariable(SpirvId typeId);
+    const VariableInfo *getVariableInfo(const TVariable *variable);
+    SpirvId getDefaultUniformsId();
+    FunctionInfo *getFunctionInfo(const TFunction *function);
+
+    // Instructions.
+    SpirvId emitOp(spirv::Op op, SpirvId resultTypeId, std::initializer_list<SpirvId> operands);
+    SpirvId emitOp(spirv::Op op, SpirvId resultTypeId, const std::vector<SpirvId> &operands);
+    SpirvId emitExtInst(GLSLstd450 inst,
+                        SpirvId resultTypeId,
+                        const std::vector<SpirvId> &operands);
+    SpirvId emitExtract(SpirvId typeId, SpirvId compositeId, uint32_t index);
+    SpirvId emitSplat(SpirvId scalarId, TBasicType basicType, int size);
+    SpirvId emitConversion(SpirvId id, TBasicType from, TBasicType to, int size);
+    void startBlock(SpirvId label);
+    void branchTo(SpirvId label);
+    void terminateBlock(spirv::Op op, std::initializer_list<SpirvId> operands);
+
+    // Access chains.
+    SpirvId getAccessChainPointer(const NodeData &data);
+    SpirvId loadNode(const NodeData &data);
+    void storeNode(const NodeData &data, SpirvId value);
+    SpirvId convertFromBlockLayout(SpirvId id, const TType &type);
+    SpirvId rvalue(TIntermTyped *node) { return loadNode(emitExpression(node)); }
+
+    // Declarations and directives.
+    bool isActive() const;
+    void handleDirective(TIntermPreprocessorDirective *directive);
+    void collectGlobalDeclaration(TIntermDeclaration *declaration);
+    void emitFunctionDefinition(TIntermFunctionDefinition *definition);
+
+    // Statements.
+    void emitSequence(const TIntermSequence &sequence);
+    void emitStatement(TIntermNode *node);
+    void emitLocalDeclaration(TIntermDeclaration *declaration);
+    void emitIfElse(TIntermIfElse *node);
+    void emitLoop(TIntermLoop *node);
+    void emitBranch(TIntermBranch *node);
+
+    // Expressions.
+    NodeData emitExpression(TIntermTyped *node);
+    NodeData emitSymbol(TIntermSymbol *node);
+    NodeData emitSwizzle(TIntermSwizzle *node);
+    NodeData emitIndex(TIntermBinary *node);
+    NodeData emitBinary(TIntermBinary *node);
+    NodeData emitUnary(TIntermUnary *node);
+    NodeData emitAggregate(TIntermAggregate *node);
+    NodeData emitTernary(TIntermTernary *node);
+    SpirvId emitShortCircuit(TIntermBinary *node);
+    SpirvId emitBinaryOp(TOperator op,
+                         const TType &resultType,
+                         const TType &leftType,
+                         SpirvId leftId,
+                         const TType &rightType,
+                         SpirvId rightId);
+    SpirvId emitMatrixComponentWise(TOperator op,
+                                    const TType &resultType,
+                                    const TType &leftType,
+                                    SpirvId leftId,
+                                    const TType &rightType,
+                                    SpirvId rightId);
+    SpirvId emitEqual(const TType &type, SpirvId leftId, SpirvId rightId);
+    SpirvId emitBuiltInOp(TOperator op,
+                          const TType &resultType,
+                          std::vector<SpirvId> *ids,
+                          const std::vector<const TType *> &types);
+    SpirvId emitFunctionCall(TIntermAggregate *node);
+    SpirvId emitTextureCall(TIntermAggregate *node);
+    SpirvId emitConstructor(TIntermAggregate *node);
+    void getScalarComponents(SpirvId id, const TType &type, std::vector<SpirvId> *componentsOut);
+
+    sh::GLenum mShaderType;
+    const TVector<const TVariable *> &mDefaultUniforms;
+    const TVariable *mDriverUniforms;
+    bool mLineRasterEmulation;
+
+    bool mUnsupported;
+    SpirvId mNextId;
+
+    // The sections of the module.  Types, constants and global variables share a section as they
+    // may depend on each other.
+    SpirvBlob mExtInstImports;
+    SpirvBlob mNames;
+    SpirvBlob mDecorations;
+    SpirvBlob mTypesAndGlobals;
+    SpirvBlob mFunctions;
+
+    SpirvId mGLSLstd450Id;
+    SpirvId mEntryPointId;
+    SpirvId mDefaultUniformsId;
+    std::vector<SpirvId> mInterfaceIds;
+    bool mWritesFragDepth;
+
+    std::map<TypeKey, SpirvId> mTypeIds;
+    std::map<std::pair<spirv::StorageClass, SpirvId>, SpirvId> mPointerTypeIds;
+    std::map<std::vector<SpirvId>, SpirvId> mFunctionTypeIds;
+    std::map<std::pair<SpirvId, uint32_t>, SpirvId> mScalarConstantIds;
+    std::map<std::vector<SpirvId>, SpirvId> mCompositeConstantIds;
+
+    std::map<const TVariable *, uint32_t> mDefaultUniformIndices;
+    std::map<const TVariable *, VariableInfo> mVariables;
+    std::map<const TVariable *, TIntermTyped *> mGlobalInitializers;
+    std::set<const TVariable *> mInvariantVariables;
+    std::map<int, FunctionInfo> mFunctionInfos;
+
+    // Whether each enclosing #ifdef is taken.
+    std::vector<bool> mConditionalStack;
+
+    // State of the function being generated.  Its local variables must be declared at the start
+    // of its first block, so they are kept apart from the rest of its code.
+    SpirvBlob mFunctionVariables;
+    SpirvBlob mCode;
+    SpirvId mCurrentBlockLabel;
+    bool mIsBlockTerminated;
+    std::vector<LoopInfo> mLoopStack;
+};
+
+SPIRVBuilder::SPIRVBuilder(sh::GLenum shaderType,
+                           const TVector<const TVariable *> &defaultUniforms,
+                           const TVariable *driverUniforms,
+                           bool lineRasterEmulation)
+    : mShaderType(shaderType),
+      mDefaultUniforms(defaultUniforms),
+      mDriverUniforms(driverUniforms),
+      mLineRasterEmulation(lineRasterEmulation),
+      mUnsupported(false),
+      mNextId(1),
+      mGLSLstd450Id(0),
+      mEntryPointId(0),
+      mDefaultUniformsId(0),
+      mWritesFragDepth(false),
+      mCurrentBlockLabel(0),
+      mIsBlockTerminated(false)
+{
+    for (uint32_t index = 0; index < mDefaultUniforms.size(); ++index)
+    {
+        mDefaultUniformIndices[mDefaultUniforms[index]] = index;
+    }
+}
+
+bool SPIRVBuilder::generate(TIntermBlock *root, SpirvBlob *spirvOut)
+{
+    // Global variables are only declared when they are first used, but their initializers and
+    // invariance are needed then, so they are gathered before any function is generated.
+    std::vector<TIntermFunctionDefinition *> definitions;
+    for (TIntermNode *node : *root->getSequence())
+    {
+        if (TIntermPreprocessorDirective *directive = node->getAsPreprocessorDirective())
+        {
+            handleDirective(directive);
+        }
+        else if (!isActive())
+        {
+            continue;
+        }
+        else if (TIntermFunctionDefinition *definition = node->getAsFunctionDefinition())
+        {
+            definitions.push_back(definition);
+        }
+        else if (TIntermDeclaration *declaration = node->getAsDeclarationNode())
+        {
+            collectGlobalDeclaration(declaration);
+        }
+        else if (TIntermInvariantDeclaration *invariant = node->getAsInvariantDeclarationNode())
+        {
+            mInvariantVariables.insert(&invariant->getSymbol()->variable());
+        }
+        else if (node->getAsFunctionPrototypeNode() == nullptr)
+        {
+            setUnsupported();
+        }
+    }
+    if (!mConditionalStack.empty())
+    {
+        setUnsupported();
+    }
+
+    for (TIntermFunctionDefinition *definition : definitions)
+    {
+        emitFunctionDefinition(definition);
+    }
+
+    // Calls to functions that are only declared can't be generated.
+    for (auto &iter : mFunctionInfos)
+    {
+        if (!iter.second.defined)
+        {
+            setUnsupported();
+        }
+    }
+
+    if (mUnsupported || mEntryPointId == 0)
+    {
+        return false;
+    }
+
+    SpirvBlob &spirv = *spirvOut;
+    spirv.clear();
+    spirv.push_back(spirv::MagicNumber);
+    spirv.push_back(spirv::kVersion1_0);
+    spirv.push_back(spirv::kGenerator);
+    spirv.push_back(mNextId);
+    spirv.push_back(0);
+
+    AppendInstruction(&spirv, spirv::OpCapability, {spirv::CapabilityShader});
+    spirv.insert(spirv.end(), mExtInstImports.begin(), mExtInstImports.end());
+    AppendInstruction(&spirv, spirv::OpMemoryModel,
+                      {spirv::AddressingModelLogical, spirv::MemoryModelGLSL450});
+
+    spirv::ExecutionModel executionModel = mShaderType == GL_VERTEX_SHADER
+                                               ? spirv::ExecutionModelVertex
+                                               : spirv::ExecutionModelFragment;
+    std::vector<uint32_t> entryPointOperands = {executionModel, mEntryPointId};
+    AppendString(&entryPointOperands, "main");
+    entryPointOperands.insert(entryPointOperands.end(), mInterfaceIds.begin(),
+                              mInterfaceIds.end());
+    AppendInstruction(&spirv, spirv::OpEntryPoint, entryPointOperands);
+
+    if (mShaderType == GL_FRAGMENT_SHADER)
+    {
+        AppendInstruction(&spirv, spirv::OpExecutionMode,
+                          {mEntryPointId, spirv::ExecutionModeOriginUpperLeft});
+        if (mWritesFragDepth)
+        {
+            AppendInstruction(&spirv, spirv::OpExecutionMode,
+                              {mEntryPointId, spirv::ExecutionModeDepthReplacing});
+        }
+    }
+
+    spirv.insert(spirv.end(), mNames.begin(), mNames.end());
+    spirv.insert(spirv.end(), mDecorations.begin(), mDecorations.end());
+    spirv.insert(spirv.end(), mTypesAndGlobals.begin(), mTypesAndGlobals.end());
+    spirv.insert(spirv.end(), mFunctions.begin(), mFunctions.end());
+
+    return true;
+}
+
+void SPIRVBuilder::addName(SpirvId id, const std::string &name)
+{
+    std::vector<uint32_t> operands = {id};
+    AppendString(&operands, name);
+    AppendInstruction(&mNames, spirv::OpName, operands);
+}
+
+void SPIRVBuilder::addDecoration(SpirvId id, spirv::Decoration decoration)
+{
+    AppendInstruction(&mDecorations, spirv::OpDecorate, {id, decoration});
+}
+
+void SPIRVBuilder::addDecoration(SpirvId id, spirv::Decoration decoration, uint32_t value)
+{
+    AppendInstruction(&mDecorations, spirv::OpDecorate, {id, decoration, value});
+}
+
+void SPIRVBuilder::addLocationPlaceholder(SpirvId id)
+{
+    addDecoration(id, spirv::DecorationLocation, 0);
+}
+
+void SPIRVBuilder::addBindingPlaceholder(SpirvId id)
+{
+    addDecoration(id, spirv::DecorationDescriptorSet, 0);
+    addDecoration(id, spirv::DecorationBinding, 0);
+}
+
+void SPIRVBuilder::decorateStd140Members(SpirvId structTypeId,
+                                         const std::vector<const TType *> &memberTypes)
+{
+    std::vector<uint32_t> offsets;
+    GetStd140MemberOffsets(memberTypes, &offsets);
+
+    for (uint32_t member = 0; member < memberTypes.size(); ++member)
+    {
+        AppendInstruction(&mDecorations, spirv::OpMemberDecorate,
+                          {structTypeId, member, spirv::DecorationOffset, offsets[member]});
+        if (memberTypes[member]->isMatrix())
+        {
+            AppendInstruction(&mDecorations, spirv::OpMemberDecorate,
+                              {structTypeId, member, spirv::DecorationColMajor});
+            AppendInstruction(&mDecorations, spirv::OpMemberDecorate,
+                              {structTypeId, member, spirv::DecorationMatrixStride,
+                               kStd140VectorSize});
+        }
+    }
+}
+
+SpirvId SPIRVBuilder::getBasicTypeId(TBasicType basicType, int size)
+{
+    TypeKey key(basicType, size, 1, nullptr, 0, 0, false);
+    auto iter = mTypeIds.find(key);
+    if (iter != mTypeIds.end())
+    {
+        return iter->second;
+    }
+
+    SpirvId id = 0;
+    if (size > 1)
+    {
+        SpirvId componentTypeId = getBasicTypeId(basicType, 1);
+        id                      = newId();
+        AppendInstruction(&mTypesAndGlobals, spirv::OpTypeVector,
+                          {id, componentTypeId, static_cast<uint32_t>(size)});
+        mTypeIds[key] = id;
+        return id;
+    }
+
+    switch (basicType)
+    {
+        case EbtVoid:
+            id = newId();
+            AppendInstruction(&mTypesAndGlobals, spirv::OpTypeVoid, {id});
+            break;
+        case EbtBool:
+            id = newId();
+            AppendInstruction(&mTypesAndGlobals, spirv::OpTypeBool, {id});
+            break;
+        case EbtInt:
+            id = newId();
+            AppendInstruction(&mTypesAndGlobals, spirv::OpTypeInt, {id, 32, 1});
+            break;
+        case EbtUInt:
+            id = newId();
+            AppendInstruction(&mTypesAndGlobals, spirv::OpTypeInt, {id, 32, 0});
+            break;
+        case EbtFloat:
+            id = newId();
+            AppendInstruction(&mTypesAndGlobals, spirv::OpTypeFloat, {id, 32});
+            break;
+        case EbtSampler2D:
+        case EbtSamplerExternalOES:
+        case EbtSamplerCube:
+        {
+            SpirvId sampledTypeId = getBasicTypeId(EbtFloat, 1);
+            SpirvId imageTypeId   = newId();
+            spirv::Dim dim = basicType == EbtSamplerCube ? spirv::DimCube : spirv::Dim2D;
+            // Not a depth image, not arrayed, single-sampled, and used with a sampler.
+            AppendInstruction(&mTypesAndGlobals, spirv::OpTypeImage,
+                              {imageTypeId, sampledTypeId, dim, 0, 0, 0, 1,
+                               spirv::ImageFormatUnknown});
+            id = newId();
+            AppendInstruction(&mTypesAndGlobals, spirv::OpTypeSampledImage, {id, imageTypeId});
+            break;
+        }
+        default:
+            setUnsupported();
+            return getBasicTypeId(EbtFloat, 1);
+    }
+
+    mTypeIds[key] = id;
+    return id;
+}
+
+SpirvId SPIRVBuilder::getMatrixTypeId(int cols, int rows)
+{
+    TypeKey key(EbtFloat, cols, rows, nullptr, 0, 0, false);
+    auto iter = mTypeIds.find(key);
+    if (iter != mTypeIds.end())
+    {
+        return iter->second;
+    }
+
+    SpirvId columnTypeId = getBasicTypeId(EbtFloat, rows);
+    SpirvId id           = newId();
+    AppendInstruction(&mTypesAndGlobals, spirv::OpTypeMatrix,
+                      {id, columnTypeId, static_cast<uint32_t>(cols)});
+    mTypeIds[key] = id;
+    return id;
+}
+
+SpirvId SPIRVBuilder::getTypeId(const TType &type, bool blockLayout)
+{
+    if (type.isArray())
+    {
+        TType elementType(type);
+        elementType.toArrayElementType();
+        SpirvId elementTypeId = getTypeId(elementType, blockLayout);
+        unsigned int size     = type.getOutermostArraySize();
+
+        TypeKey key(EbtVoid, 0, 0, nullptr, elementTypeId, size, blockLayout);
+        auto iter = mTypeIds.find(key);
+        if (iter != mTypeIds.end())
+        {
+            return iter->second;
+        }
+
+        SpirvId lengthId = getIntConstant(size);
+        SpirvId id       = newId();
+        AppendInstruction(&mTypesAndGlobals, spirv::OpTypeArray, {id, elementTypeId, lengthId});
+        if (blockLayout)
+        {
+            addDecoration(id, spirv::DecorationArrayStride, GetStd140ArrayStride(elementType));
+        }
+        mTypeIds[key] = id;
+        return id;
+    }
+
+    if (type.getStruct() != nullptr || type.isInterfaceBlock())
+    {
+        bool isBlock = type.isInterfaceBlock();
+        const TFieldListCollection *fieldList =
+            isBlock ? static_cast<const TFieldListCollection *>(type.getInterfaceBlock())
+                    : static_cast<const TFieldListCollection *>(type.getStruct());
+        blockLayout = blockLayout || isBlock;
+
+        TypeKey key(EbtStruct, 0, 0, fieldList, 0, 0, blockLayout);
+        auto iter = mTypeIds.find(key);
+        if (iter != mTypeIds.end())
+        {
+            return iter->second;
+        }
+
+        std::vector<const TType *> memberTypes = GetFieldTypes(fieldList->fields());
+        std::vector<uint32_t> operands         = {0};
+        for (const TType *memberType : memberTypes)
+        {
+            operands.push_back(getTypeId(*memberType, blockLayout));
+        }
+        SpirvId id  = newId();
+        operands[0] = id;
+        AppendInstruction(&mTypesAndGlobals, spirv::OpTypeStruct, operands);
+        if (blockLayout)
+        {
+            decorateStd140Members(id, memberTypes);
+        }
+        if (isBlock)
+        {
+            addDecoration(id, spirv::DecorationBlock);
+        }
+        mTypeIds[key] = id;
+        return id;
+    }
+
+    if (type.isMatrix())
+    {
+        return getMatrixTypeId(type.getCols(), type.getRows());
+    }
+
+    // Bools have no defined size, so they are stored as uints in blocks.
+    TBasicType basicType = type.getBasicType();
+    if (blockLayout && basicType == EbtBool)
+    {
+        basicType = EbtUInt;
+    }
+    return getBasicTypeId(basicType, type.getNominalSize());
+}
+
+SpirvId SPIRVBuilder::getPointerTypeId(spirv::StorageClass storageClass, SpirvId typeId)
+{
+    auto key  = std::make_pair(storageClass, typeId);
+    auto iter = mPointerTypeIds.find(key);
+    if (iter != mPointerTypeIds.end())
+    {
+        return iter->second;
+    }
+
+    SpirvId id = newId();
+    AppendInstruction(&mTypesAndGlobals, spirv::OpTypePointer, {id, storageClass, typeId});
+    mPointerTypeIds[key] = id;
+    return id;
+}
+
+SpirvId SPIRVBuilder::getFunctionTypeId(SpirvId returnTypeId,
+                                        const std::vector<SpirvId> &paramTypeIds)
+{
+    std::vector<SpirvId> key = {returnTypeId};
+    key.insert(key.end(), paramTypeIds.begin(), paramTypeIds.end());
+    auto iter = mFunctionTypeIds.find(key);
+    if (iter != mFunctionTypeIds.end())
+    {
+        return iter->second;
+    }
+
+    SpirvId id                     = newId();
+    std::vector<uint32_t> operands = {id};
+    operands.insert(operands.end(), key.begin(), key.end());
+    AppendInstruction(&mTypesAndGlobals, spirv::OpTypeFunction, operands);
+    mFunctionTypeIds[key] = id;
+    return id;
+}
+
+// Parameters are passed by pointer.  Samplers can only be passed as pointers to the sampler
+// uniforms themselves, the rest is copied in and out of function variables by the caller.
+SpirvId SPIRVBuilder::getParameterTypeId(const TType &paramType)
+{
+    spirv::StorageClass storageClass = IsSampler(paramType.getBasicType())
+                                           ? spirv::StorageClassUniformConstant
+                                           : spirv::StorageClassFunction;
+    return getPointerTypeId(storageClass, getTypeId(paramType));
+}
+
+SpirvId SPIRVBuilder::getScalarConstant(TBasicType basicType, uint32_t bits)
+{
+    if (basicType == EbtBool)
+    {
+        return getBoolConstant(bits != 0);
+    }
+
+    SpirvId typeId = getBasicTypeId(basicType, 1);
+    auto key       = std::make_pair(typeId, bits);
+    auto iter      = mScalarConstantIds.find(key);
+    if (iter != mScalarConstantIds.end())
+    {
+        return iter->second;
+    }
+
+    SpirvId id = newId();
+    AppendInstruction(&mTypesAndGlobals, spirv::OpConstant, {typeId, id, bits});
+    mScalarConstantIds[key] = id;
+    return id;
+}
+
+SpirvId SPIRVBuilder::getFloatConstant(float value)
+{
+    return getScalarConstant(EbtFloat, gl::bitCast<uint32_t>(value));
+}
+
+SpirvId SPIRVBuilder::getBoolConstant(bool value)
+{
+    SpirvId typeId = getBasicTypeId(EbtBool, 1);
+    auto key       = std::make_pair(typeId, static_cast<uint32_t>(value));
+    auto iter      = mScalarConstantIds.find(key);
+    if (iter != mScalarConstantIds.end())
+    {
+        return iter->second;
+    }
+
+    SpirvId id = newId();
+    AppendInstruction(&mTypesAndGlobals, value ? spirv::OpConstantTrue : spirv::OpConstantFalse,
+                      {typeId, id});
+    mScalarConstantIds[key] = id;
+    return id;
+}
+
+SpirvId SPIRVBuilder::getCompositeConstant(SpirvId typeId, const std::vector<SpirvId> &components)
+{
+    std::vector<SpirvId> key = {typeId};
+    key.insert(key.end(), components.begin(), components.end());
+    auto iter = mCompositeConstantIds.find(key);
+    if (iter != mCompositeConstantIds.end())
+    {
+        return iter->second;
+    }
+
+    SpirvId id                     = newId();
+    std::vector<uint32_t> operands = {typeId, id};
+    operands.insert(operands.end(), components.begin(), components.end());
+    AppendInstruction(&mTypesAndGlobals, spirv::OpConstantComposite, operands);
+    mCompositeConstantIds[key] = id;
+    return id;
+}
+
+SpirvId SPIRVBuilder::getSplatConstant(TBasicType basicType, int size, uint32_t bits)
+{
+    SpirvId scalarId = getScalarConstant(basicType, bits);
+    if (size == 1)
+    {
+        return scalarId;
+    }
+    return getCompositeConstant(getBasicTypeId(basicType, size),
+                                std::vector<SpirvId>(size, scalarId));
+}
+
+SpirvId SPIRVBuilder::getConstant(const TType &type, const TConstantUnion *values)
+{
+    return getConstantRecursive(type, &values);
+}
+
+SpirvId SPIRVBuilder::getConstantRecursive(const TType &type, const TConstantUnion **values)
+{
+    std::vector<SpirvId> components;
+
+    if (type.isArray())
+    {
+        TType elementType(type);
+        elementType.toArrayElementType();
+        for (unsigned int element = 0; element < type.getOutermostArraySize(); ++element)
+        {
+            components.push_back(getConstantRecursive(elementType, values));
+        }
+    }
+    else if (type.getStruct() != nullptr)
+    {
+        for (const TField *field : type.getStruct()->fields())
+        {
+            components.push_back(getConstantRecursive(*field->type(), values));
+        }
+    }
+    else if (type.isMatrix())
+    {
+        TType columnType(EbtFloat, type.getRows());
+        for (int col = 0; col < type.getCols(); ++col)
+        {
+            components.push_back(getConstantRecursive(columnType, values));
+        }
+    }
+    else
+    {
+        TBasicType basicType = type.getBasicType();
+        for (int component = 0; component < type.getNominalSize(); ++component)
+        {
+            TConstantUnion value = *(*values)++;
+            if (value.getType() != basicType)
+            {
+                TConstantUnion converted;
+                converted.cast(basicType, value);
+                value = converted;
+            }
+
+            uint32_t bits = 0;
+            switch (basicType)
+            {
+                case EbtFloat:
+                    bits = gl::bitCast<uint32_t>(value.getFConst());
+                    break;
+                case EbtInt:
+                    bits = static_cast<uint32_t>(value.getIConst());
+                    break;
+                case EbtUInt:
+                    bits = value.getUConst();
+                    break;
+                case EbtBool:
+                    bits = value.getBConst();
+                    break;
+                default:
+                    setUnsupported();
+                    break;
+            }
+            components.push_back(getScalarConstant(basicType, bits));
+        }
+
+        if (components.size() == 1)
+        {
+            return components[0];
+        }
+    }
+
+    return getCompositeConstant(getTypeId(type), components);
+}
+
+SpirvId SPIRVBuilder::declareGlobalVariable(spirv::StorageClass storageClass,
+                                            SpirvId typeId,
+                                            SpirvId initializerId,
+                                            const char *name)
+{
+    SpirvId pointerTypeId = getPointerTypeId(storageClass, typeId);
+    SpirvId id            = newId();
+    if (initializerId != 0)
+    {
+        AppendInstruction(&mTypesAndGlobals, spirv::OpVariable,
+                          {pointerTypeId, id, storageClass, initializerId});
+    }
+    else
+    {
+        AppendInstruction(&mTypesAndGlobals, spirv::OpVariable, {pointerTypeId, id, storageClass});
+    }
+
+    if (storageClass == spirv::StorageClassInput || storageClass == spirv::StorageClassOutput)
+    {
+        mInterfaceIds.push_back(id);
+    }
+    if (name != nullptr)
+    {
+        addName(id, name);
+    }
+    return id;
+}
+
+SpirvId SPIRVBuilder::declareFunctionVariable(SpirvId typeId)
+{
+    SpirvId pointerTypeId = getPointerTypeId(spirv::StorageClassFunction, typeId);
+    SpirvId id            = newId();
+    AppendInstruction(&mFunctionVariables, spirv::OpVariable,
+                      {pointerTypeId, id, spirv::StorageClassFunction});
+    return id;
+}
+
+const VariableInfo *SPIRVBuilder::getVariableInfo(const TVariable *variable)
+{
+    auto iter = mVariables.find(variable);
+    if (iter != mVariables.end())
+    {
+        return &iter->second;
+    }
+
+    const TType &type = variable->getType();
+    VariableInfo info = {0, spirv::StorageClassPrivate, false};
+
+    // Variables that are assigned a location or binding at link time are named after their GLSL
+    // variable so that GlslangWrapper can find them.
+    bool isLinked             = false;
+    bool needsLocation        = false;
+    bool needsBinding         = false;
+    bool isBuiltIn            = false;
+    spirv::BuiltIn builtIn    = spirv::BuiltInPosition;
+    bool hasFixedLocation     = false;
+    SpirvId initializerId     = 0;
+    TQualifier qualifier      = type.getQualifier();
+    bool isInvariant          = type.isInvariant() || mInvariantVariables.count(variable) > 0;
+
+    switch (qualifier)
+    {
+        case EvqGlobal:
+        {
+            auto initializer = mGlobalInitializers.find(variable);
+            if (initializer != mGlobalInitializers.end())
+            {
+                TIntermTyped *value = initializer->second;
+                if (value->hasConstantValue())
+                {
+                    initializerId = getConstant(value->getType(), value->getConstantValue());
+                }
+                else
+                {
+                    setUnsupported();
+                }
+            }
+            break;
+        }
+        case EvqAttribute:
+        case EvqVertexIn:
+        case EvqVaryingIn:
+            info.storageClass = spirv::StorageClassInput;
+            isLinked          = true;
+            needsLocation     = true;
+            break;
+        case EvqVaryingOut:
+            info.storageClass = spirv::StorageClassOutput;
+            isLinked          = true;
+            needsLocation     = true;
+            break;
+        case EvqUniform:
+            isLinked     = true;
+            needsBinding = true;
+            if (variable == mDriverUniforms)
+            {
+                info.storageClass = spirv::StorageClassUniform;
+                info.blockLayout  = true;
+            }
+            else if (IsSampler(type.getBasicType()))
+            {
+                info.storageClass = spirv::StorageClassUniformConstant;
+            }
+            else
+            {
+                setUnsupported();
+            }
+            break;
+        case EvqPosition:
+            info.storageClass = spirv::StorageClassOutput;
+            isBuiltIn         = true;
+            builtIn           = spirv::BuiltInPosition;
+            break;
+        case EvqPointSize:
+            info.storageClass = spirv::StorageClassOutput;
+            isBuiltIn         = true;
+            builtIn           = spirv::BuiltInPointSize;
+            break;
+        case EvqFragCoord:
+            info.storageClass = spirv::StorageClassInput;
+            isBuiltIn         = true;
+            builtIn           = spirv::BuiltInFragCoord;
+            break;
+        case EvqFrontFacing:
+            info.storageClass = spirv::StorageClassInput;
+            isBuiltIn         = true;
+            builtIn           = spirv::BuiltInFrontFacing;
+            break;
+        case EvqPointCoord:
+            info.storageClass = spirv::StorageClassInput;
+            isBuiltIn         = true;
+            builtIn           = spirv::BuiltInPointCoord;
+            break;
+        case EvqFragColor:
+        case EvqFragData:
+            info.storageClass = spirv::StorageClassOutput;
+            hasFixedLocation  = true;
+            break;
+        case EvqFragDepth:
+        case EvqFragDepthEXT:
+            info.storageClass = spirv::StorageClassOutput;
+            isBuiltIn         = true;
+            builtIn           = spirv::BuiltInFragDepth;
+            mWritesFragDepth  = true;
+            break;
+        default:
+            setUnsupported();
+            break;
+    }
+
+    std::string name;
+    if (isLinked)
+    {
+        name = std::string(variable->name().data(), variable->name().length());
+    }
+    info.id = declareGlobalVariable(info.storageClass, getTypeId(type, info.blockLayout),
+                                    initializerId, isLinked ? name.c_str() : nullptr);
+
+    if (needsLocation)
+    {
+        addLocationPlaceholder(info.id);
+    }
+    if (needsBinding)
+    {
+        addBindingPlaceholder(info.id);
+    }
+    if (hasFixedLocation)
+    {
+        addDecoration(info.id, spirv::DecorationLocation, 0);
+    }
+    if (isBuiltIn)
+    {
+        addDecoration(info.id, spirv::DecorationBuiltIn, builtIn);
+    }
+    if (isInvariant)
+    {
+        addDecoration(info.id, spirv::DecorationInvariant);
+    }
+
+    mVariables[variable] = info;
+    return &mVariables[variable];
+}
+
+SpirvId SPIRVBuilder::getDefaultUniformsId()
+{
+    if (mDefaultUniformsId != 0)
+    {
+        return mDefaultUniformsId;
+    }
+
+    std::vector<const TType *> memberTypes;
+    std::vector<uint32_t> operands = {0};
+    for (const TVariable *uniform : mDefaultUniforms)
+    {
+        memberTypes.push_back(&uniform->getType());
+        operands.push_back(getTypeId(uniform->getType(), true));
+    }
+
+    SpirvId blockTypeId = newId();
+    operands[0]         = blockTypeId;
+    AppendInstruction(&mTypesAndGlobals, spirv::OpTypeStruct, operands);
+    decorateStd140Members(blockTypeId, memberTypes);
+    addDecoration(blockTypeId, spirv::DecorationBlock);
+
+    mDefaultUniformsId = declareGlobalVariable(spirv::StorageClassUniform, blockTypeId, 0,
+                                               kDefaultUniformsBlockName);
+    addBindingPlaceholder(mDefaultUniformsId);
+    return mDefaultUniformsId;
+}
+
+FunctionInfo *SPIRVBuilder::getFunctionInfo(const TFunction *function)
+{
+    FunctionInfo &info = mFunctionInfos[function->uniqueId().get()];
+    if (info.id == 0)
+    {
+        info.id       = newId();
+        info.function = function;
+    }
+    return &info;
+}
+
+SpirvId SPIRVBuilder::emitOp(spirv::Op op,
+                             SpirvId resultTypeId,
+                             std::initializer_list<SpirvId> operands)
+{
+    SpirvId id = newId();
+    mCode.push_back(spirv::MakeFirstWord(op, operands.size() + 3));
+    mCode.push_back(resultTypeId);
+    mCode.push_back(id);
+    mCode.insert(mCode.end(), operands.begin(), operands.end());
+    return id;
+}
+
+SpirvId SPIRVBuilder::emitOp(spirv::Op op,
+                             SpirvId resultTypeId,
+                             const std::vector<SpirvId> &operands)
+{
+    SpirvId id = newId();
+    mCode.push_back(spirv::MakeFirstWord(op, operands.size() + 3));
+    mCode.push_back(resultTypeId);
+    mCode.push_back(id);
+    mCode.insert(mCode.end(), operands.begin(), operands.end());
+    return id;
+}
+
+SpirvId SPIRVBuilder::emitExtInst(GLSLstd450 inst,
+                                  SpirvId resultTypeId,
+                                  const std::vector<SpirvId> &operands)
+{
+    if (mGLSLstd450Id == 0)
+    {
+        mGLSLstd450Id                   = newId();
+        std::vector<uint32_t> arguments = {mGLSLstd450Id};
+        AppendString(&arguments, "GLSL.std.450");
+        AppendInstruction(&mExtInstImports, spirv::OpExtInstImport, arguments);
+    }
+
+    std::vector<SpirvId> allOperands = {mGLSLstd450Id, inst};
+    allOperands.insert(allOperands.end(), operands.begin(), operands.end());
+    return emitOp(spirv::OpExtInst, resultTypeId, allOperands);
+}
+
+SpirvId SPIRVBuilder::emitExtract(SpirvId typeId, SpirvId compositeId, uint32_t index)
+{
+    return emitOp(spirv::OpCompositeExtract, typeId, {compositeId, index});
+}
+
+SpirvId SPIRVBuilder::emitSplat(SpirvId scalarId, TBasicType basicType, int size)
+{
+    if (size == 1)
+    {
+        return scalarId;
+    }
+    return emitOp(spirv::OpCompositeConstruct, getBasicTypeId(basicType, size),
+                  std::vector<SpirvId>(size, scalarId));
+}
+
+SpirvId SPIRVBuilder::emitConversion(SpirvId id, TBasicType from, TBasicType to, int size)
+{
+    if (from == to)
+    {
+        return id;
+    }
+
+    SpirvId typeId = getBasicTypeId(to, size);
+    if (from == EbtBool)
+    {
+        uint32_t oneBits = to == EbtFloat ? gl::bitCast<uint32_t>(1.0f) : 1;
+        return emitOp(spirv::OpSelect, typeId,
+                      {id, getSplatConstant(to, size, oneBits), getSplatConstant(to, size, 0)});
+    }
+    if (to == EbtBool)
+    {
+        spirv::Op op = from == EbtFloat ? spirv::OpFOrdNotEqual : spirv::OpINotEqual;
+        return emitOp(op, typeId, {id, getSplatConstant(from, size, 0)});
+    }
+
+    switch (to)
+    {
+        case EbtFloat:
+            return emitOp(from == EbtInt ? spirv::OpConvertSToF : spirv::OpConvertUToF, typeId,
+                          {id});
+        case EbtInt:
+            return emitOp(from == EbtFloat ? spirv::OpConvertFToS : spirv::OpBitcast, typeId,
+                          {id});
+        case EbtUInt:
+            return emitOp(from == EbtFloat ? spirv::OpConvertFToU : spirv::OpBitcast, typeId,
+                          {id});
+        default:
+            setUnsupported();
+            return id;
+    }
+}
+
+void SPIRVBuilder::startBlock(SpirvId label)
+{
+    AppendInstruction(&mCode, spirv::OpLabel, {label});
+    mCurrentBlockLabel = label;
+    mIsBlockTerminated = false;
+}
+
+void SPIRVBuilder::branchTo(SpirvId label)
+{
+    if (!mIsBlockTerminated)
+    {
+        terminateBlock(spirv::OpBranch, {label});
+    }
+}
+
+void SPIRVBuilder::terminateBlock(spirv::Op op, std::initializer_list<SpirvId> operands)
+{
+    AppendInstruction(&mCode, op, operands);
+    mIsBlockTerminated = true;
+}
+
+SpirvId SPIRVBuilder::getAccessChainPointer(const NodeData &data)
+{
+    if (data.indices.empty())
+    {
+        return data.baseId;
+    }
+
+    SpirvId pointerTypeId =
+        getPointerTypeId(data.storageClass, getTypeId(*data.chainType, data.blockLayout));
+    std::vector<SpirvId> operands = {data.baseId};
+    operands.insert(operands.end(), data.indices.begin(), data.indices.end());
+    return emitOp(spirv::OpAccessChain, pointerTypeId, operands);
+}
+
+SpirvId SPIRVBuilder::loadNode(const NodeData &data)
+{
+    if (!data.isLValue())
+    {
+        return data.value;
+    }
+
+    SpirvId pointerId = getAccessChainPointer(data);
+    SpirvId value =
+        emitOp(spirv::OpLoad, getTypeId(*data.chainType, data.blockLayout), {pointerId});
+    if (data.blockLayout)
+    {
+        value = convertFromBlockLayout(value, *data.chainType);
+    }
+
+    if (data.swizzle.empty())
+    {
+        return value;
+    }
+    std::vector<SpirvId> operands = {value, value};
+    operands.insert(operands.end(), data.swizzle.begin(), data.swizzle.end());
+    return emitOp(spirv::OpVectorShuffle, getTypeId(*data.type), operands);
+}
+
+void SPIRVBuilder::storeNode(const NodeData &data, SpirvId value)
+{
+    if (!data.isLValue() || data.blockLayout)
+    {
+        setUnsupported();
+        return;
+    }
+
+    SpirvId pointerId = getAccessChainPointer(data);
+    if (!data.swizzle.empty())
+    {
+        // Merge the written components into the rest of the vector.
+        SpirvId vectorTypeId          = getTypeId(*data.chainType);
+        int size                      = data.chainType->getNominalSize();
+        SpirvId current               = emitOp(spirv::OpLoad, vectorTypeId, {pointerId});
+        std::vector<SpirvId> operands = {current, value};
+        for (int component = 0; component < size; ++component)
+        {
+            operands.push_back(component);
+        }
+        for (size_t index = 0; index < data.swizzle.size(); ++index)
+        {
+            operands[2 + data.swizzle[index]] = static_cast<SpirvId>(size + index);
+        }
+        value = emitOp(spirv::OpVectorShuffle, vectorTypeId, operands);
+    }
+    AppendInstruction(&mCode, spirv::OpStore, {pointerId, value});
+}
+
+SpirvId SPIRVBuilder::convertFromBlockLayout(SpirvId id, const TType &type)
+{
+    if (type.isArray())
+    {
+        TType elementType(type);
+        elementType.toArrayElementType();
+        SpirvId blockElementTypeId    = getTypeId(elementType, true);
+        std::vector<SpirvId> elements;
+        for (uint32_t element = 0; element < type.getOutermostArraySize(); ++element)
+        {
+            SpirvId value = emitExtract(blockElementTypeId, id, element);
+            elements.push_back(convertFromBlockLayout(value, elementType));
+        }
+        return emitOp(spirv::OpCompositeConstruct, getTypeId(type), elements);
+    }
+
+    if (type.getStruct() != nullptr)
+    {
+        std::vector<SpirvId> members;
+        uint32_t index = 0;
+        for (const TField *field : type.getStruct()->fields())
+        {
+            SpirvId value = emitExtract(getTypeId(*field->type(), true), id, index++);
+            members.push_back(convertFromBlockLayout(value, *field->type()));
+        }
+        return emitOp(spirv::OpCompositeConstruct, getTypeId(type), members);
+    }
+
+    if (type.getBasicType() == EbtBool)
+    {
+        return emitConversion(id, EbtUInt, EbtBool, type.getNominalSize());
+    }
+    return id;
+}
+
+bool SPIRVBuilder::isActive() const
+{
+    for (bool taken : mConditionalStack)
+    {
+        if (!taken)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The only directives TranslatorVulkan adds are #ifdefs around the line raster emulation code and
+// the transform feedback capture. Programs that capture transform feedback use the GLSL output.
+void SPIRVBuilder::handleDirective(TIntermPreprocessorDirective *directive)
+{
+    switch (directive->getDirective())
+    {
+        case PreprocessorDirective::Ifdef:
+            mConditionalStack.push_back(mLineRasterEmulation &&
+                                        directive->getCommand() == kLineRasterEmulationDefine);
+            break;
+        case PreprocessorDirective::Endif:
+            if (mConditionalStack.empty())
+            {
+                setUnsupported();
+                break;
+            }
+            mConditionalStack.pop_back();
+            break;
+        default:
+            setUnsupported();
+            break;
+    }
+}
+
+void SPIRVBuilder::collectGlobalDeclaration(TIntermDeclaration *declaration)
+{
+    for (TIntermNode *declarator : *declaration->getSequence())
+    {
+        TIntermBinary *initNode = declarator->getAsBinaryNode();
+        if (initNode != nullptr && initNode->getOp() == EOpInitialize)
+        {
+            const TVariable *variable = &initNode->getLeft()->getAsSymbolNode()->variable();
+            mGlobalInitializers[variable] = initNode->getRight();
+        }
+    }
+}
+
+void SPIRVBuilder::emitFunctionDefinition(TIntermFunctionDefinition *definition)
+{
+    const TFunction *function = definition->getFunction();
+    FunctionInfo *info        = getFunctionInfo(function);
+    info->defined             = true;
+
+    SpirvBlob header;
+    SpirvId returnTypeId = getTypeId(function->getReturnType());
+    std::vector<SpirvId> paramTypeIds;
+    for (size_t paramIndex = 0; paramIndex < function->getParamCount(); ++paramIndex)
+    {
+        paramTypeIds.push_back(getParameterTypeId(function->getParam(paramIndex)->getType()));
+    }
+    AppendInstruction(&header, spirv::OpFunction,
+                      {returnTypeId, info->id, spirv::FunctionControlMaskNone,
+                       getFunctionTypeId(returnTypeId, paramTypeIds)});
+
+    for (size_t paramIndex = 0; paramIndex < function->getParamCount(); ++paramIndex)
+    {
+        const TVariable *param = function->getParam(paramIndex);
+        SpirvId paramId        = newId();
+        AppendInstruction(&header, spirv::OpFunctionParameter, {paramTypeIds[paramIndex], paramId});
+
+        VariableInfo paramInfo = {paramId, IsSampler(param->getType().getBasicType())
+                                               ? spirv::StorageClassUniformConstant
+                                               : spirv::StorageClassFunction,
+                                  false};
+        mVariables[param] = paramInfo;
+    }
+    // The entry block's label is part of the header, as the function's variables must follow it.
+    SpirvId entryLabel = newId();
+    AppendInstruction(&header, spirv::OpLabel, {entryLabel});
+
+    mFunctionVariables.clear();
+    mCode.clear();
+    mCurrentBlockLabel = entryLabel;
+    mIsBlockTerminated = false;
+
+    emitSequence(*definition->getBody()->getSequence());
+
+    if (!mIsBlockTerminated)
+    {
+        // Functions that return a value can't fall off their end in valid GLSL.
+        if (function->getReturnType().getBasicType() == EbtVoid)
+        {
+            terminateBlock(spirv::OpReturn, {});
+        }
+        else
+        {
+            terminateBlock(spirv::OpUnreachable, {});
+        }
+    }
+
+    mFunctions.insert(mFunctions.end(), header.begin(), header.end());
+    mFunctions.insert(mFunctions.end(), mFunctionVariables.begin(), mFunctionVariables.end());
+    mFunctions.insert(mFunctions.end(), mCode.begin(), mCode.end());
+    AppendInstruction(&mFunctions, spirv::OpFunctionEnd, {});
+
+    if (function->isMain())
+    {
+        mEntryPointId = info->id;
+    }
+}
+
+void SPIRVBuilder::emitSequence(const TIntermSequence &sequence)
+{
+    for (TIntermNode *node : sequence)
+    {
+        // Directives are tracked even in unreachable code to keep the #ifdef nesting right.
+        if (TIntermPreprocessorDirective *directive = node->getAsPreprocessorDirective())
+        {
+            handleDirective(directive);
+        }
+        else if (isActive())
+        {
+            emitStatement(node);
+        }
+    }
+}
+
+void SPIRVBuilder::emitStatement(TIntermNode *node)
+{
+    // SPIR-V doesn't allow code after a block's terminator, and the code is unreachable anyway.
+    if (mIsBlockTerminated)
+    {
+        return;
+    }
+
+    if (TIntermBlock *block = node->getAsBlock())
+    {
+        emitSequence(*block->getSequence());
+    }
+    else if (TIntermDeclaration *declaration = node->getAsDeclarationNode())
+    {
+        emitLocalDeclaration(declaration);
+    }
+    else if (TIntermIfElse *ifElse = node->getAsIfElseNode())
+    {
+        emitIfElse(ifElse);
+    }
+    else if (TIntermLoop *loop = node->getAsLoopNode())
+    {
+        emitLoop(loop);
+    }
+    else if (TIntermBranch *branch = node->getAsBranchNode())
+    {
+        emitBranch(branch);
+    }
+    else if (TIntermTyped *expression = node->getAsTyped())
+    {
+        emitExpression(expression);
+    }
+    else
+    {
+        setUnsupported();
+    }
+}
+
+void SPIRVBuilder::emitLocalDeclaration(TIntermDeclaration *declaration)
+{
+    for (TIntermNode *declarator : *declaration->getSequence())
+    {
+        TIntermSymbol *symbol      = declarator->getAsSymbolNode();
+        TIntermTyped *initializer  = nullptr;
+        TIntermBinary *initNode    = declarator->getAsBinaryNode();
+        if (initNode != nullptr && initNode->getOp() == EOpInitialize)
+        {
+            symbol      = initNode->getLeft()->getAsSymbolNode();
+            initializer = initNode->getRight();
+        }
+        if (symbol == nullptr)
+        {
+            setUnsupported();
+            continue;
+        }
+
+        // References to constants are replaced by their value.
+        if (symbol->variable().symbolType() == SymbolType::Empty || symbol->hasConstantValue())
+        {
+            continue;
+        }
+
+        SpirvId id = declareFunctionVariable(getTypeId(symbol->getType()));
+        mVariables[&symbol->variable()] = {id, spirv::StorageClassFunction, false};
+        if (initializer != nullptr)
+        {
+            AppendInstruction(&mCode, spirv::OpStore, {id, rvalue(initializer)});
+        }
+    }
+}
+
+void SPIRVBuilder::emitIfElse(TIntermIfElse *node)
+{
+    SpirvId condition  = rvalue(node->getCondition());
+    SpirvId trueLabel  = newId();
+    SpirvId mergeLabel = newId();
+    SpirvId falseLabel = node->getFalseBlock() != nullptr ? newId() : mergeLabel;
+
+    AppendInstruction(&mCode, spirv::OpSelectionMerge,
+                      {mergeLabel, spirv::SelectionControlMaskNone});
+    terminateBlock(spirv::OpBranchConditional, {condition, trueLabel, falseLabel});
+
+    startBlock(trueLabel);
+    if (node->getTrueBlock() != nullptr)
+    {
+        emitStatement(node->getTrueBlock());
+    }
+    branchTo(mergeLabel);
+
+    if (node->getFalseBlock() != nullptr)
+    {
+        startBlock(falseLabel);
+        emitStatement(node->getFalseBlock());
+        branchTo(mergeLabel);
+    }
+
+    startBlock(mergeLabel);
+}
+
+// Loops are generated as a header block holding the merge instruction, a block evaluating the
+// condition, the body, and a continue block evaluating the loop expression or, for do-while
+// loops, the condition.
+void SPIRVBuilder::emitLoop(TIntermLoop *node)
+{
+    if (node->getInit() != nullptr)
+    {
+        emitStatement(node->getInit());
+    }
+
+    bool isDoWhile        = node->getType() == ELoopDoWhile;
+    SpirvId headerLabel   = newId();
+    SpirvId bodyLabel     = newId();
+    SpirvId continueLabel = newId();
+    SpirvId mergeLabel    = newId();
+
+    branchTo(headerLabel);
+    startBlock(headerLabel);
+    AppendInstruction(&mCode, spirv::OpLoopMerge,
+                      {mergeLabel, continueLabel, spirv::LoopControlMaskNone});
+    if (!isDoWhile && node->getCondition() != nullptr)
+    {
+        SpirvId conditionLabel = newId();
+        terminateBlock(spirv::OpBranch, {conditionLabel});
+        startBlock(conditionLabel);
+        SpirvId condition = rvalue(node->getCondition());
+        terminateBlock(spirv::OpBranchConditional, {condition, bodyLabel, mergeLabel});
+    }
+    else
+    {
+        terminateBlock(spirv::OpBranch, {bodyLabel});
+    }
+
+    startBlock(bodyLabel);
+    mLoopStack.push_back({continueLabel, mergeLabel});
+    emitStatement(node->getBody());
+    mLoopStack.pop_back();
+    branchTo(continueLabel);
+
+    startBlock(continueLabel);
+    if (isDoWhile)
+    {
+        SpirvId condition = rvalue(node->getCondition());
+        terminateBlock(spirv::OpBranchConditional, {condition, headerLabel, mergeLabel});
+    }
+    else
+    {
+        if (node->getExpression() != nullptr)
+        {
+            emitExpression(node->getExpression());
+        }
+        terminateBlock(spirv::OpBranch, {headerLabel});
+    }
+
+    startBlock(mergeLabel);
+}
+
+void SPIRVBuilder::emitBranch(TIntermBranch *node)
+{
+    switch (node->getFlowOp())
+    {
+        case EOpKill:
+            terminateBlock(spirv::OpKill, {});
+            break;
+        case EOpReturn:
+            if (node->getExpression() != nullptr)
+            {
+                SpirvId value = rvalue(node->getExpression());
+                terminateBlock(spirv::OpReturnValue, {value});
+            }
+            else
+            {
+                terminateBlock(spirv::OpReturn, {});
+            }
+            break;
+        case EOpBreak:
+        case EOpContinue:
+            // Breaks out of switch statements aren't possible as those are unsupported.
+            if (mLoopStack.empty())
+            {
+                setUnsupported();
+                break;
+            }
+            terminateBlock(spirv::OpBranch, {node->getFlowOp() == EOpBreak
+                                                 ? mLoopStack.back().mergeLabel
+                                                 : mLoopStack.back().continueLabel});
+            break;
+        default:
+            setUnsupported();
+            break;
+    }
+}
+
+NodeData SPIRVBuilder::emitExpression(TIntermTyped *node)
+{
+    const TType &type = node->getType();
+    if (node->hasConstantValue() && node->getConstantValue() != nullptr)
+    {
+        return MakeRValue(type, getConstant(type, node->getConstantValue()));
+    }
+
+    if (TIntermSymbol *symbol = node->getAsSymbolNode())
+    {
+        return emitSymbol(symbol);
+    }
+    if (TIntermSwizzle *swizzle = node->getAsSwizzleNode())
+    {
+        return emitSwizzle(swizzle);
+    }
+    if (TIntermBinary *binary = node->getAsBinaryNode())
+    {
+        return emitBinary(binary);
+    }
+    if (TIntermUnary *unary = node->getAsUnaryNode())
+    {
+        return emitUnary(unary);
+    }
+    if (TIntermAggregate *aggregate = node->getAsAggregate())
+    {
+        return emitAggregate(aggregate);
+    }
+    if (TIntermTernary *ternary = node->getAsTernaryNode())
+    {
+        return emitTernary(ternary);
+    }
+
+    setUnsupported();
+    return MakeRValue(type, 0);
+}
+
+NodeData SPIRVBuilder::emitSymbol(TIntermSymbol *node)
+{
+    const TVariable *variable = &node->variable();
+
+    NodeData data;
+    data.type      = &node->getType();
+    data.chainType = data.type;
+
+    auto defaultUniform = mDefaultUniformIndices.find(variable);
+    if (defaultUniform != mDefaultUniformIndices.end())
+    {
+        data.baseId       = getDefaultUniformsId();
+        data.storageClass = spirv::StorageClassUniform;
+        data.blockLayout  = true;
+        data.indices.push_back(getIntConstant(defaultUniform->second));
+        return data;
+    }
+
+    const VariableInfo *info = getVariableInfo(variable);
+    data.baseId              = info->id;
+    data.storageClass        = info->storageClass;
+    data.blockLayout         = info->blockLayout;
+    return data;
+}
+
+NodeData SPIRVBuilder::emitSwizzle(TIntermSwizzle *node)
+{
+    NodeData operand                = emitExpression(node->getOperand());
+    const TType &type               = node->getType();
+    const TVector<int> &offsets     = node->getSwizzleOffsets();
+
+    if (operand.isLValue())
+    {
+        // Swizzles of swizzles are folded into one, and single components are selected by the
+        // access chain so that they can be stored without loading the rest of the vector.
+        std::vector<int> swizzle;
+        for (int offset : offsets)
+        {
+            swizzle.push_back(operand.swizzle.empty() ? offset : operand.swizzle[offset]);
+        }
+        operand.type = &type;
+        if (swizzle.size() == 1)
+        {
+            operand.indices.push_back(getIntConstant(swizzle[0]));
+            operand.chainType = &type;
+            operand.swizzle.clear();
+        }
+        else
+        {
+            operand.swizzle = swizzle;
+        }
+        return operand;
+    }
+
+    if (offsets.size() == 1)
+    {
+        return MakeRValue(type, emitExtract(getTypeId(type), operand.value, offsets[0]));
+    }
+    std::vector<SpirvId> operands = {operand.value, operand.value};
+    operands.insert(operands.end(), offsets.begin(), offsets.end());
+    return MakeRValue(type, emitOp(spirv::OpVectorShuffle, getTypeId(type), operands));
+}
+
+NodeData SPIRVBuilder::emitIndex(TIntermBinary *node)
+{
+    NodeData base     = emitExpression(node->getLeft());
+    const TType &type = node->getType();
+    bool isDirect     = node->getOp() != EOpIndexIndirect;
+    int directIndex   = isDirect ? node->getRight()->getAsConstantUnion()->getIConst(0) : 0;
+
+    if (base.isLValue())
+    {
+        if (!base.swizzle.empty())
+        {
+            if (isDirect)
+            {
+                base.indices.push_back(getIntConstant(base.swizzle[directIndex]));
+                base.swizzle.clear();
+                base.type      = &type;
+                base.chainType = &type;
+                return base;
+            }
+            SpirvId vector = loadNode(base);
+            SpirvId index  = rvalue(node->getRight());
+            return MakeRValue(
+                type, emitOp(spirv::OpVectorExtractDynamic, getTypeId(type), {vector, index}));
+        }
+
+        base.indices.push_back(isDirect ? getIntConstant(directIndex) : rvalue(node->getRight()));
+        base.type      = &type;
+        base.chainType = &type;
+        return base;
+    }
+
+    if (isDirect)
+    {
+        return MakeRValue(type, emitExtract(getTypeId(type), base.value, directIndex));
+    }
+
+    SpirvId index = rvalue(node->getRight());
+    if (base.type->isVector() && !base.type->isArray())
+    {
+        return MakeRValue(
+            type, emitOp(spirv::OpVectorExtractDynamic, getTypeId(type), {base.value, index}));
+    }
+
+    // Arrays and matrices can only be indexed dynamically through a pointer.
+    SpirvId temp = declareFunctionVariable(getTypeId(*base.type));
+    AppendInstruction(&mCode, spirv::OpStore, {temp, base.value});
+
+    NodeData element;
+    element.type      = &type;
+    element.chainType = &type;
+    element.baseId    = temp;
+    element.indices.push_back(index);
+    return element;
+}
+
+NodeData SPIRVBuilder::emitBinary(TIntermBinary *node)
+{
+    TOperator op      = node->getOp();
+    const TType &type = node->getType();
+
+    switch (op)
+    {
+        case EOpIndexDirect:
+        case EOpIndexIndirect:
+        case EOpIndexDirectStruct:
+        case EOpIndexDirectInterfaceBlock:
+            return emitIndex(node);
+        case EOpAssign:
+        case EOpInitialize:
+        {
+            NodeData left = emitExpression(node->getLeft());
+            SpirvId value = rvalue(node->getRight());
+            storeNode(left, value);
+            return MakeRValue(type, value);
+        }
+        case EOpLogicalAnd:
+        case EOpLogicalOr:
+            return MakeRValue(type, emitShortCircuit(node));
+        case EOpComma:
+            emitExpression(node->getLeft());
+            return emitExpression(node->getRight());
+        default:
+            break;
+    }
+
+    const TType &leftType  = node->getLeft()->getType();
+    const TType &rightType = node->getRight()->getType();
+
+    if (node->isAssignment())
+    {
+        NodeData left    = emitExpression(node->getLeft());
+        SpirvId leftId   = loadNode(left);
+        SpirvId rightId  = rvalue(node->getRight());
+        SpirvId resultId = emitBinaryOp(GetCompoundAssignmentBaseOp(op), leftType, leftType,
+                                        leftId, rightType, rightId);
+        storeNode(left, resultId);
+        return MakeRValue(type, resultId);
+    }
+
+    SpirvId leftId  = rvalue(node->getLeft());
+    SpirvId rightId = rvalue(node->getRight());
+    return MakeRValue(type, emitBinaryOp(op, type, leftType, leftId, rightType, rightId));
+}
+
+SpirvId SPIRVBuilder::emitShortCircuit(TIntermBinary *node)
+{
+    bool isAnd           = node->getOp() == EOpLogicalAnd;
+    SpirvId boolTypeId   = getBasicTypeId(EbtBool, 1);
+    SpirvId leftId       = rvalue(node->getLeft());
+
+    if (!node->getRight()->hasSideEffects())
+    {
+        SpirvId rightId = rvalue(node->getRight());
+        return emitOp(isAnd ? spirv::OpLogicalAnd : spirv::OpLogicalOr, boolTypeId,
+                      {leftId, rightId});
+    }
+
+    SpirvId leftLabel  = mCurrentBlockLabel;
+    SpirvId rightLabel = newId();
+    SpirvId mergeLabel = newId();
+    AppendInstruction(&mCode, spirv::OpSelectionMerge,
+                      {mergeLabel, spirv::SelectionControlMaskNone});
+    terminateBlock(spirv::OpBranchConditional,
+                   {leftId, isAnd ? rightLabel : mergeLabel, isAnd ? mergeLabel : rightLabel});
+
+    startBlock(rightLabel);
+    SpirvId rightId = rvalue(node->getRight());
+    rightLabel      = mCurrentBlockLabel;
+    terminateBlock(spirv::OpBranch, {mergeLabel});
+
+    startBlock(mergeLabel);
+    return emitOp(spirv::OpPhi, boolTypeId, {leftId, leftLabel, rightId, rightLabel});
+}
+
+SpirvId SPIRVBuilder::emitBinaryOp(TOperator op,
+                                   const TType &resultType,
+                                   const TType &leftType,
+                                   SpirvId leftId,
+                                   const TType &rightType,
+                                   SpirvId rightId)
+{
+    TBasicType basicType = leftType.getBasicType();
+    SpirvId resultTypeId = getTypeId(resultType);
+    int resultSize       = resultType.getNominalSize();
+
+    switch (op)
+    {
+        case EOpAdd:
+        case EOpSub:
+        case EOpMul:
+        case EOpDiv:
+        case EOpIMod:
+        case EOpBitShiftLeft:
+        case EOpBitShiftRight:
+        case EOpBitwiseAnd:
+        case EOpBitwiseXor:
+        case EOpBitwiseOr:
+        case EOpMulMatrixComponentWise:
+            if (resultType.isMatrix())
+            {
+                return emitMatrixComponentWise(op, resultType, leftType, leftId, rightType,
+                                               rightId);
+            }
+            // Scalars are applied to every component of the other operand.
+            if (leftType.isScalar() && resultSize > 1)
+            {
+                leftId = emitSplat(leftId, basicType, resultSize);
+            }
+            if (rightType.isScalar() && resultSize > 1)
+            {
+                rightId = emitSplat(rightId, rightType.getBasicType(), resultSize);
+            }
+            return emitOp(GetArithmeticOp(op, basicType), resultTypeId, {leftId, rightId});
+
+        case EOpVectorTimesScalar:
+        case EOpMatrixTimesScalar:
+            if (leftType.isScalar())
+            {
+                std::swap(leftId, rightId);
+            }
+            if (op == EOpMatrixTimesScalar)
+            {
+                return emitOp(spirv::OpMatrixTimesScalar, resultTypeId, {leftId, rightId});
+            }
+            if (basicType == EbtFloat)
+            {
+                return emitOp(spirv::OpVectorTimesScalar, resultTypeId, {leftId, rightId});
+            }
+            return emitOp(spirv::OpIMul, resultTypeId,
+                          {leftId, emitSplat(rightId, basicType, resultSize)});
+
+        case EOpVectorTimesMatrix:
+            return emitOp(spirv::OpVectorTimesMatrix, resultTypeId, {leftId, rightId});
+        case EOpMatrixTimesVector:
+            return emitOp(spirv::OpMatrixTimesVector, resultTypeId, {leftId, rightId});
+        case EOpMatrixTimesMatrix:
+            return emitOp(spirv::OpMatrixTimesMatrix, resultTypeId, {leftId, rightId});
+
+        case EOpEqual:
+            return emitEqual(leftType, leftId, rightId);
+        case EOpNotEqual:
+            return emitOp(spirv::OpLogicalNot, resultTypeId,
+                          {emitEqual(leftType, leftId, rightId)});
+
+        case EOpLessThan:
+        case EOpGreaterThan:
+        case EOpLessThanEqual:
+        case EOpGreaterThanEqual:
+        case EOpEqualComponentWise:
+        case EOpNotEqualComponentWise:
+        case EOpLessThanComponentWise:
+        case EOpLessThanEqualComponentWise:
+        case EOpGreaterThanComponentWise:
+        case EOpGreaterThanEqualComponentWise:
+            return emitOp(GetComparisonOp(op, basicType), resultTypeId, {leftId, rightId});
+
+        case EOpLogicalXor:
+            return emitOp(spirv::OpLogicalNotEqual, resultTypeId, {leftId, rightId});
+
+        default:
+            setUnsupported();
+            return leftId;
+    }
+}
+
+SpirvId SPIRVBuilder::emitMatrixComponentWise(TOperator op,
+                                              const TType &resultType,
+                                              const TType &leftType,
+                                              SpirvId leftId,
+                                              const TType &rightType,
+                                              SpirvId rightId)
+{
+    int rows             = resultType.getRows();
+    SpirvId columnTypeId = getBasicTypeId(EbtFloat, rows);
+    SpirvId leftSplatId  = leftType.isMatrix() ? 0 : emitSplat(leftId, EbtFloat, rows);
+    SpirvId rightSplatId = rightType.isMatrix() ? 0 : emitSplat(rightId, EbtFloat, rows);
+
+    std::vector<SpirvId> columns;
+    for (int col = 0; col < resultType.getCols(); ++col)
+    {
+        SpirvId left  = leftSplatId != 0 ? leftSplatId : emitExtract(columnTypeId, leftId, col);
+        SpirvId right = rightSplatId != 0 ? rightSplatId : emitExtract(columnTypeId, rightId, col);
+        columns.push_back(emitOp(GetArithmeticOp(op, EbtFloat), columnTypeId, {left, right}));
+    }
+    return emitOp(spirv::OpCompositeConstruct, getTypeId(resultType), columns);
+}
+
+// GLSL's == compares whole values, arrays and structs included.
+SpirvId SPIRVBuilder::emitEqual(const TType &type, SpirvId leftId, SpirvId rightId)
+{
+    SpirvId boolTypeId = getBasicTypeId(EbtBool, 1);
+    std::vector<SpirvId> results;
+
+    if (type.isArray())
+    {
+        TType elementType(type);
+        elementType.toArrayElementType();
+        SpirvId elementTypeId = getTypeId(elementType);
+        for (uint32_t element = 0; element < type.getOutermostArraySize(); ++element)
+        {
+            results.push_back(emitEqual(elementType, emitExtract(elementTypeId, leftId, element),
+                                        emitExtract(elementTypeId, rightId, element)));
+        }
+    }
+    else if (type.getStruct() != nullptr)
+    {
+        uint32_t index = 0;
+        for (const TField *field : type.getStruct()->fields())
+        {
+            SpirvId fieldTypeId = getTypeId(*field->type());
+            results.push_back(emitEqual(*field->type(), emitExtract(fieldTypeId, leftId, index),
+                                        emitExtract(fieldTypeId, rightId, index)));
+            ++index;
+        }
+    }
+    else if (type.isMatrix())
+    {
+        SpirvId columnTypeId  = getBasicTypeId(EbtFloat, type.getRows());
+        SpirvId bvecTypeId    = getBasicTypeId(EbtBool, type.getRows());
+        for (int col = 0; col < type.getCols(); ++col)
+        {
+            SpirvId equal = emitOp(spirv::OpFOrdEqual, bvecTypeId,
+                                   {emitExtract(columnTypeId, leftId, col),
+                                    emitExtract(columnTypeId, rightId, col)});
+            results.push_back(emitOp(spirv::OpAll, boolTypeId, {equal}));
+        }
+    }
+    else
+    {
+        spirv::Op op  = GetComparisonOp(EOpEqual, type.getBasicType());
+        int size      = type.getNominalSize();
+        SpirvId equal = emitOp(op, getBasicTypeId(EbtBool, size), {leftId, rightId});
+        return size > 1 ? emitOp(spirv::OpAll, boolTypeId, {equal}) : equal;
+    }
+
+    SpirvId result = results[0];
+    for (size_t index = 1; index < results.size(); ++index)
+    {
+        result = emitOp(spirv::OpLogicalAnd, boolTypeId, {result, results[index]});
+    }
+    return result;
+}
+
+NodeData SPIRVBuilder::emitUnary(TIntermUnary *node)
+{
+    TOperator op           = node->getOp();
+    const TType &type      = node->getType();
+    TIntermTyped *operand  = node->getOperand();
+    TBasicType basicType   = operand->getType().getBasicType();
+    SpirvId typeId         = getTypeId(type);
+
+    switch (op)
+    {
+        case EOpPostIncrement:
+        case EOpPostDecrement:
+        case EOpPreIncrement:
+        case EOpPreDecrement:
+        {
+            NodeData lvalue = emitExpression(operand);
+            SpirvId before  = loadNode(lvalue);
+            TType oneType(basicType);
+            uint32_t oneBits = basicType == EbtFloat ? gl::bitCast<uint32_t>(1.0f) : 1;
+            bool isIncrement = op == EOpPostIncrement || op == EOpPreIncrement;
+            SpirvId after =
+                emitBinaryOp(isIncrement ? EOpAdd : EOpSub, type, type, before, oneType,
+                             getScalarConstant(basicType, oneBits));
+            storeNode(lvalue, after);
+            bool isPost = op == EOpPostIncrement || op == EOpPostDecrement;
+            return MakeRValue(type, isPost ? before : after);
+        }
+        case EOpPositive:
+            return MakeRValue(type, rvalue(operand));
+        case EOpNegative:
+        {
+            SpirvId value = rvalue(operand);
+            if (type.isMatrix())
+            {
+                SpirvId columnTypeId = getBasicTypeId(EbtFloat, type.getRows());
+                std::vector<SpirvId> columns;
+                for (int col = 0; col < type.getCols(); ++col)
+                {
+                    columns.push_back(emitOp(spirv::OpFNegate, columnTypeId,
+                                             {emitExtract(columnTypeId, value, col)}));
+                }
+                return MakeRValue(type, emitOp(spirv::OpCompositeConstruct, typeId, columns));
+            }
+            spirv::Op negate = basicType == EbtFloat ? spirv::OpFNegate : spirv::OpSNegate;
+            return MakeRValue(type, emitOp(negate, typeId, {value}));
+        }
+        case EOpLogicalNot:
+        case EOpLogicalNotComponentWise:
+            return MakeRValue(type, emitOp(spirv::OpLogicalNot, typeId, {rvalue(operand)}));
+        case EOpBitwiseNot:
+            return MakeRValue(type, emitOp(spirv::OpNot, typeId, {rvalue(operand)}));
+        default:
+        {
+            std::vector<SpirvId> ids = {rvalue(operand)};
+            return MakeRValue(type, emitBuiltInOp(op, type, &ids, {&operand->getType()}));
+        }
+    }
+}
+
+NodeData SPIRVBuilder::emitAggregate(TIntermAggregate *node)
+{
+    const TType &type = node->getType();
+    TOperator op      = node->getOp();
+
+    switch (op)
+    {
+        case EOpCallFunctionInAST:
+            return MakeRValue(type, emitFunctionCall(node));
+        case EOpCallBuiltInFunction:
+            return MakeRValue(type, emitTextureCall(node));
+        case EOpConstruct:
+            return MakeRValue(type, emitConstructor(node));
+        case EOpCallInternalRawFunction:
+            setUnsupported();
+            return MakeRValue(type, 0);
+        default:
+            break;
+    }
+
+    std::vector<SpirvId> ids;
+    std::vector<const TType *> types;
+    for (TIntermNode *arg : *node->getSequence())
+    {
+        ids.push_back(rvalue(arg->getAsTyped()));
+        types.push_back(&arg->getAsTyped()->getType());
+    }
+
+    if (IsComponentWiseBinaryBuiltIn(op))
+    {
+        return MakeRValue(type, emitBinaryOp(op, type, *types[0], ids[0], *types[1], ids[1]));
+    }
+    return MakeRValue(type, emitBuiltInOp(op, type, &ids, types));
+}
+
+SpirvId SPIRVBuilder::emitBuiltInOp(TOperator op,
+                                    const TType &resultType,
+                                    std::vector<SpirvId> *ids,
+                                    const std::vector<const TType *> &types)
+{
+    SpirvId resultTypeId = getTypeId(resultType);
+    TBasicType basicType = types[0]->getBasicType();
+    bool isFloat         = basicType == EbtFloat;
+    bool isUInt          = basicType == EbtUInt;
+    int resultSize       = resultType.getNominalSize();
+
+    bool isBoolMix = op == EOpMix && types[2]->getBasicType() == EbtBool;
+    if (IsScalarExpandingBuiltIn(op) && resultType.isVector() && !isBoolMix)
+    {
+        for (size_t index = 0; index < ids->size(); ++index)
+        {
+            if (types[index]->isScalar())
+            {
+                (*ids)[index] = emitSplat((*ids)[index], types[index]->getBasicType(), resultSize);
+            }
+        }
+    }
+
+    switch (op)
+    {
+        case EOpRadians:
+            return emitExtInst(GLSLstd450Radians, resultTypeId, *ids);
+        case EOpDegrees:
+            return emitExtInst(GLSLstd450Degrees, resultTypeId, *ids);
+        case EOpSin:
+            return emitExtInst(GLSLstd450Sin, resultTypeId, *ids);
+        case EOpCos:
+            return emitExtInst(GLSLstd450Cos, resultTypeId, *ids);
+        case EOpTan:
+            return emitExtInst(GLSLstd450Tan, resultTypeId, *ids);
+        case EOpAsin:
+            return emitExtInst(GLSLstd450Asin, resultTypeId, *ids);
+        case EOpAcos:
+            return emitExtInst(GLSLstd450Acos, resultTypeId, *ids);
+        case EOpAtan:
+            return emitExtInst(ids->size() == 2 ? GLSLstd450Atan2 : GLSLstd450Atan,
+                               resultTypeId, *ids);
+        case EOpSinh:
+            return emitExtInst(GLSLstd450Sinh, resultTypeId, *ids);
+        case EOpCosh:
+            return emitExtInst(GLSLstd450Cosh, resultTypeId, *ids);
+        case EOpTanh:
+            return emitExtInst(GLSLstd450Tanh, resultTypeId, *ids);
+        case EOpAsinh:
+            return emitExtInst(GLSLstd450Asinh, resultTypeId, *ids);
+        case EOpAcosh:
+            return emitExtInst(GLSLstd450Acosh, resultTypeId, *ids);
+        case EOpAtanh:
+            return emitExtInst(GLSLstd450Atanh, resultTypeId, *ids);
+        case EOpPow:
+            return emitExtInst(GLSLstd450Pow, resultTypeId, *ids);
+        case EOpExp:
+            return emitExtInst(GLSLstd450Exp, resultTypeId, *ids);
+        case EOpLog:
+            return emitExtInst(GLSLstd450Log, resultTypeId, *ids);
+        case EOpExp2:
+            return emitExtInst(GLSLstd450Exp2, resultTypeId, *ids);
+        case EOpLog2:
+            return emitExtInst(GLSLstd450Log2, resultTypeId, *ids);
+        case EOpSqrt:
+            return emitExtInst(GLSLstd450Sqrt, resultTypeId, *ids);
+        case EOpInversesqrt:
+            return emitExtInst(GLSLstd450InverseSqrt, resultTypeId, *ids);
+        case EOpAbs:
+            return emitExtInst(isFloat ? GLSLstd450FAbs : GLSLstd450SAbs,
+                               resultTypeId, *ids);
+        case EOpSign:
+            return emitExtInst(isFloat ? GLSLstd450FSign : GLSLstd450SSign,
+                               resultTypeId, *ids);
+        case EOpFloor:
+            return emitExtInst(GLSLstd450Floor, resultTypeId, *ids);
+        case EOpTrunc:
+            return emitExtInst(GLSLstd450Trunc, resultTypeId, *ids);
+        case EOpRound:
+            return emitExtInst(GLSLstd450Round, resultTypeId, *ids);
+        case EOpCeil:
+            return emitExtInst(GLSLstd450Ceil, resultTypeId, *ids);
+        case EOpFract:
+            return emitExtInst(GLSLstd450Fract, resultTypeId, *ids);
+        case EOpMod:
+            return emitOp(spirv::OpFMod, resultTypeId, *ids);
+        case EOpMin:
+            return emitExtInst(isFloat ? GLSLstd450FMin
+                                       : (isUInt ? GLSLstd450UMin : GLSLstd450SMin),
+                               resultTypeId, *ids);
+        case EOpMax:
+            return emitExtInst(isFloat ? GLSLstd450FMax
+                                       : (isUInt ? GLSLstd450UMax : GLSLstd450SMax),
+                               resultTypeId, *ids);
+        case EOpClamp:
+            return emitExtInst(isFloat ? GLSLstd450FClamp
+                                       : (isUInt ? GLSLstd450UClamp
+                                                 : GLSLstd450SClamp),
+                               resultTypeId, *ids);
+        case EOpMix:
+            if (isBoolMix)
+            {
+                // mix(x, y, a) selects y where a is true.
+                return emitOp(spirv::OpSelect, resultTypeId, {(*ids)[2], (*ids)[1], (*ids)[0]});
+            }
+            return emitExtInst(GLSLstd450FMix, resultTypeId, *ids);
+        case EOpStep:
+            return emitExtInst(GLSLstd450Step, resultTypeId, *ids);
+        case EOpSmoothstep:
+            return emitExtInst(GLSLstd450SmoothStep, resultTypeId, *ids);
+        case EOpIsnan:
+            return emitOp(spirv::OpIsNan, resultTypeId, *ids);
+        case EOpIsinf:
+            return emitOp(spirv::OpIsInf, resultTypeId, *ids);
+        case EOpLength:
+            return emitExtInst(GLSLstd450Length, resultTypeId, *ids);
+        case EOpDistance:
+            return emitExtInst(GLSLstd450Distance, resultTypeId, *ids);
+        case EOpDot:
+            // OpDot only takes vectors.
+            return emitOp(types[0]->isScalar() ? spirv::OpFMul : spirv::OpDot, resultTypeId,
+                          *ids);
+        case EOpCross:
+            return emitExtInst(GLSLstd450Cross, resultTypeId, *ids);
+        case EOpNormalize:
+            return emitExtInst(GLSLstd450Normalize, resultTypeId, *ids);
+        case EOpFaceforward:
+            return emitExtInst(GLSLstd450FaceForward, resultTypeId, *ids);
+        case EOpReflect:
+            return emitExtInst(GLSLstd450Reflect, resultTypeId, *ids);
+        case EOpRefract:
+            return emitExtInst(GLSLstd450Refract, resultTypeId, *ids);
+        case EOpOuterProduct:
+            return emitOp(spirv::OpOuterProduct, resultTypeId, *ids);
+        case EOpTranspose:
+            return emitOp(spirv::OpTranspose, resultTypeId, *ids);
+        case EOpDeterminant:
+            return emitExtInst(GLSLstd450Determinant, resultTypeId, *ids);
+        case EOpInverse:
+            return emitExtInst(GLSLstd450MatrixInverse, resultTypeId, *ids);
+        case EOpAny:
+            return emitOp(spirv::OpAny, resultTypeId, *ids);
+        case EOpAll:
+            return emitOp(spirv::OpAll, resultTypeId, *ids);
+        case EOpDFdx:
+            return emitOp(spirv::OpDPdx, resultTypeId, *ids);
+        case EOpDFdy:
+            return emitOp(spirv::OpDPdy, resultTypeId, *ids);
+        case EOpFwidth:
+            return emitOp(spirv::OpFwidth, resultTypeId, *ids);
+        default:
+            setUnsupported();
+            return 0;
+    }
+}
+
+// Arguments are copied to function variables, and out and inout arguments are copied back after
+// the call.  Sampler arguments must be the sampler uniforms themselves.
+SpirvId SPIRVBuilder::emitFunctionCall(TIntermAggregate *node)
+{
+    const TFunction *function     = node->getFunction();
+    FunctionInfo *info            = getFunctionInfo(function);
+    TIntermSequence &args         = *node->getSequence();
+    std::vector<SpirvId> operands = {info->id};
+    std::vector<std::pair<NodeData, SpirvId>> copyOuts;
+
+    for (size_t argIndex = 0; argIndex < args.size(); ++argIndex)
+    {
+        TIntermTyped *arg         = args[argIndex]->getAsTyped();
+        const TType &paramType    = function->getParam(argIndex)->getType();
+        TQualifier paramQualifier = paramType.getQualifier();
+
+        if (IsSampler(paramType.getBasicType()))
+        {
+            NodeData sampler = emitExpression(arg);
+            if (!sampler.indices.empty())
+            {
+                setUnsupported();
+            }
+            operands.push_back(sampler.baseId);
+            continue;
+        }
+
+        SpirvId temp = declareFunctionVariable(getTypeId(paramType));
+        if (paramQualifier == EvqOut || paramQualifier == EvqInOut)
+        {
+            NodeData lvalue = emitExpression(arg);
+            if (paramQualifier == EvqInOut)
+            {
+                AppendInstruction(&mCode, spirv::OpStore, {temp, loadNode(lvalue)});
+            }
+            copyOuts.emplace_back(lvalue, temp);
+        }
+        else
+        {
+            AppendInstruction(&mCode, spirv::OpStore, {temp, rvalue(arg)});
+        }
+        operands.push_back(temp);
+    }
+
+    SpirvId result =
+        emitOp(spirv::OpFunctionCall, getTypeId(function->getReturnType()), operands);
+
+    for (const auto &copyOut : copyOuts)
+    {
+        const NodeData &lvalue = copyOut.first;
+        SpirvId value = emitOp(spirv::OpLoad, getTypeId(*lvalue.type), {copyOut.second});
+        storeNode(lvalue, value);
+    }
+    return result;
+}
+
+// Texture functions are the only built-in functions that aren't operators in ESSL 1.00.
+SpirvId SPIRVBuilder::emitTextureCall(TIntermAggregate *node)
+{
+    const ImmutableString &name = node->getFunction()->name();
+    TIntermSequence &args       = *node->getSequence();
+    SpirvId resultTypeId        = getTypeId(node->getType());
+
+    bool isProj = name == "texture2DProj" || name == "texture2DProjLod" ||
+                  name == "texture2DProjLodEXT" || name == "texture2DProjGradEXT";
+    bool isLod = name == "texture2DLod" || name == "texture2DProjLod" ||
+                 name == "textureCubeLod" || name == "texture2DLodEXT" ||
+                 name == "texture2DProjLodEXT" || name == "textureCubeLodEXT";
+    bool isGrad = name == "texture2DGradEXT" || name == "texture2DProjGradEXT" ||
+                  name == "textureCubeGradEXT";
+    bool isPlain = name == "texture2D" || name == "texture2DProj" || name == "textureCube";
+    if (!isPlain && !isLod && !isGrad)
+    {
+        setUnsupported();
+        return 0;
+    }
+
+    SpirvId sampler               = rvalue(args[0]->getAsTyped());
+    SpirvId coord                 = rvalue(args[1]->getAsTyped());
+    const TType &coordType        = args[1]->getAsTyped()->getType();
+    std::vector<SpirvId> operands = {sampler, coord};
+
+    // The projective 2D lookups with a vec4 coordinate divide by its last component.
+    if (isProj && coordType.getNominalSize() == 4)
+    {
+        operands[1] = emitOp(spirv::OpVectorShuffle, getBasicTypeId(EbtFloat, 3),
+                             {coord, coord, 0, 1, 3});
+    }
+
+    // Implicit level of detail is only available in fragment shaders; vertex shaders sample the
+    // base level.
+    bool isExplicit = isLod || isGrad || mShaderType != GL_FRAGMENT_SHADER;
+    if (isGrad)
+    {
+        operands.push_back(spirv::ImageOperandsGradMask);
+        operands.push_back(rvalue(args[2]->getAsTyped()));
+        operands.push_back(rvalue(args[3]->getAsTyped()));
+    }
+    else if (isLod)
+    {
+        operands.push_back(spirv::ImageOperandsLodMask);
+        operands.push_back(rvalue(args[2]->getAsTyped()));
+    }
+    else if (isExplicit)
+    {
+        operands.push_back(spirv::ImageOperandsLodMask);
+        operands.push_back(getFloatConstant(0.0f));
+    }
+    else if (args.size() > 2)
+    {
+        operands.push_back(spirv::ImageOperandsBiasMask);
+        operands.push_back(rvalue(args[2]->getAsTyped()));
+    }
+
+    spirv::Op op;
+    if (isProj)
+    {
+        op = isExplicit ? spirv::OpImageSampleProjExplicitLod : spirv::OpImageSampleProjImplicitLod;
+    }
+    else
+    {
+        op = isExplicit ? spirv::OpImageSampleExplicitLod : spirv::OpImageSampleImplicitLod;
+    }
+    return emitOp(op, resultTypeId, operands);
+}
+
+void SPIRVBuilder::getScalarComponents(SpirvId id,
+                                       const TType &type,
+                                       std::vector<SpirvId> *componentsOut)
+{
+    SpirvId scalarTypeId = getBasicTypeId(type.getBasicType(), 1);
+    if (type.isScalar())
+    {
+        componentsOut->push_back(id);
+    }
+    else if (type.isMatrix())
+    {
+        for (int col = 0; col < type.getCols(); ++col)
+        {
+            for (int row = 0; row < type.getRows(); ++row)
+            {
+                componentsOut->push_back(emitOp(spirv::OpCompositeExtract, scalarTypeId,
+                                                {id, static_cast<SpirvId>(col),
+                                                 static_cast<SpirvId>(row)}));
+            }
+        }
+    }
+    else
+    {
+        for (int component = 0; component < type.getNominalSize(); ++component)
+        {
+            componentsOut->push_back(emitExtract(scalarTypeId, id, component));
+        }
+    }
+}
+
+SpirvId SPIRVBuilder::emitConstructor(TIntermAggregate *node)
+{
+    const TType &type     = node->getType();
+    SpirvId typeId        = getTypeId(type);
+    TIntermSequence &args = *node->getSequence();
+    TBasicType basicType  = type.getBasicType();
+
+    std::vector<SpirvId> argIds;
+    for (TIntermNode *arg : args)
+    {
+        argIds.push_back(rvalue(arg->getAsTyped()));
+    }
+
+    if (type.isArray() || type.getStruct() != nullptr)
+    {
+        return emitOp(spirv::OpCompositeConstruct, typeId, argIds);
+    }
+
+    const TType &firstArgType = args[0]->getAsTyped()->getType();
+
+    if (type.isMatrix())
+    {
+        int cols             = type.getCols();
+        int rows             = type.getRows();
+        SpirvId columnTypeId = getBasicTypeId(EbtFloat, rows);
+        SpirvId zero         = getFloatConstant(0.0f);
+        std::vector<SpirvId> columns;
+
+        if (args.size() == 1 && firstArgType.isScalar())
+        {
+            // A diagonal matrix.
+            SpirvId diagonal = emitConversion(argIds[0], firstArgType.getBasicType(), EbtFloat, 1);
+            for (int col = 0; col < cols; ++col)
+            {
+                std::vector<SpirvId> components(rows, zero);
+                components[col] = diagonal;
+                columns.push_back(emitOp(spirv::OpCompositeConstruct, columnTypeId, components));
+            }
+        }
+        else if (args.size() == 1 && firstArgType.isMatrix())
+        {
+            // Components that the argument doesn't have are taken from the identity matrix.
+            SpirvId one         = getFloatConstant(1.0f);
+            SpirvId argColumnId = getBasicTypeId(EbtFloat, firstArgType.getRows());
+            for (int col = 0; col < cols; ++col)
+            {
+                std::vector<SpirvId> components;
+                SpirvId argColumn = col < firstArgType.getCols()
+                                        ? emitExtract(argColumnId, argIds[0], col)
+                                        : 0;
+                for (int row = 0; row < rows; ++row)
+                {
+                    if (argColumn != 0 && row < firstArgType.getRows())
+                    {
+                        components.push_back(
+                            emitExtract(getBasicTypeId(EbtFloat, 1), argColumn, row));
+                    }
+                    else
+                    {
+                        components.push_back(row == col ? one : zero);
+                    }
+                }
+                columns.push_back(emitOp(spirv::OpCompositeConstruct, columnTypeId, components));
+            }
+        }
+        else
+        {
+            std::vector<SpirvId> components;
+            for (size_t argIndex = 0; argIndex < args.size(); ++argIndex)
+            {
+                const TType &argType = args[argIndex]->getAsTyped()->getType();
+                std::vector<SpirvId> argComponents;
+                getScalarComponents(argIds[argIndex], argType, &argComponents);
+                for (SpirvId component : argComponents)
+                {
+                    components.push_back(
+                        emitConversion(component, argType.getBasicType(), EbtFloat, 1));
+                }
+            }
+            for (int col = 0; col < cols; ++col)
+            {
+                std::vector<SpirvId> column(components.begin() + col * rows,
+                                            components.begin() + (col + 1) * rows);
+                columns.push_back(emitOp(spirv::OpCompositeConstruct, columnTypeId, column));
+            }
+        }
+        return emitOp(spirv::OpCompositeConstruct, typeId, columns);
+    }
+
+    int size = type.getNominalSize();
+    if (args.size() == 1 && (firstArgType.isScalar() || firstArgType.getNominalSize() == size) &&
+        !firstArgType.isMatrix())
+    {
+        SpirvId converted = emitConversion(argIds[0], firstArgType.getBasicType(), basicType,
+                                           firstArgType.getNominalSize());
+        return firstArgType.isScalar() ? emitSplat(converted, basicType, size) : converted;
+    }
+
+    // Arguments are consumed component by component until the result is complete.  Whole vectors
+    // are passed to OpCompositeConstruct when they fit.
+    std::vector<SpirvId> constituents;
+    int remaining = size;
+    for (size_t argIndex = 0; argIndex < args.size() && remaining > 0; ++argIndex)
+    {
+        const TType &argType = args[argIndex]->getAsTyped()->getType();
+        TBasicType argBasic  = argType.getBasicType();
+        if (argType.isVector() && argType.getNominalSize() <= remaining)
+        {
+            constituents.push_back(
+                emitConversion(argIds[argIndex], argBasic, basicType, argType.getNominalSize()));
+            remaining -= argType.getNominalSize();
+            continue;
+        }
+
+        std::vector<SpirvId> argComponents;
+        getScalarComponents(argIds[argIndex], argType, &argComponents);
+        for (size_t index = 0; index < argComponents.size() && remaining > 0; ++index)
+        {
+            constituents.push_back(emitConversion(argComponents[index], argBasic, basicType, 1));
+            --remaining;
+        }
+    }
+
+    if (size == 1)
+    {
+        return constituents[0];
+    }
+    return emitOp(spirv::OpCompositeConstruct, typeId, constituents);
+}
+
+NodeData SPIRVBuilder::emitTernary(TIntermTernary *node)
+{
+    const TType &type         = node->getType();
+    TIntermTyped *trueExpr    = node->getTrueExpression();
+    TIntermTyped *falseExpr   = node->getFalseExpression();
+    SpirvId condition         = rvalue(node->getCondition());
+
+    if (!trueExpr->hasSideEffects() && !falseExpr->hasSideEffects() && !type.isArray() &&
+        !type.isMatrix() && type.getStruct() == nullptr && type.getBasicType() != EbtVoid)
+    {
+        SpirvId trueId  = rvalue(trueExpr);
+        SpirvId falseId = rvalue(falseExpr);
+        // SPIR-V 1.0 only selects vectors with a vector condition.
+        SpirvId selector = emitSplat(condition, EbtBool, type.getNominalSize());
+        return MakeRValue(type,
+                          emitOp(spirv::OpSelect, getTypeId(type), {selector, trueId, falseId}));
+    }
+
+    SpirvId trueLabel  = newId();
+    SpirvId falseLabel = newId();
+    SpirvId mergeLabel = newId();
+    AppendInstruction(&mCode, spirv::OpSelectionMerge,
+                      {mergeLabel, spirv::SelectionControlMaskNone});
+    terminateBlock(spirv::OpBranchConditional, {condition, trueLabel, falseLabel});
+
+    startBlock(trueLabel);
+    SpirvId trueId = rvalue(trueExpr);
+    trueLabel      = mCurrentBlockLabel;
+    terminateBlock(spirv::OpBranch, {mergeLabel});
+
+    startBlock(falseLabel);
+    SpirvId falseId = rvalue(falseExpr);
+    falseLabel      = mCurrentBlockLabel;
+    terminateBlock(spirv::OpBranch, {mergeLabel});
+
+    startBlock(mergeLabel);
+    if (type.getBasicType() == EbtVoid)
+    {
+        return MakeRValue(type, 0);
+    }
+    return MakeRValue(type, emitOp(spirv::OpPhi, getTypeId(type),
+                                   {trueId, trueLabel, falseId, falseLabel}));
+}
+
+}  // anonymous namespace
+
+bool OutputSPIRV(TIntermBlock *root,
+                 sh::GLenum shaderType,
+                 const TVector<const TVariable *> &defaultUniforms,
+                 const TVariable *driverUniforms,
+                 bool lineRasterEmulation,
+                 std::vector<uint32_t> *spirvOut)
+{
+    SPIRVBuilder builder(shaderType, defaultUniforms, driverUniforms, lineRasterEmulation);
+    return builder.generate(root, spirvOut);
+}
+
+}  // namespace sh
@@ -0,0 +1,51 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OutputSPIRV:
+//   Generates SPIR-V directly from the AST of a GLSL ES 1.00 shader that went through the
+//   Vulkan-specific transformations of TranslatorVulkan.  When the directSPIRVGeneration feature
+//   is enabled, the Vulkan back-end uses it instead of compiling the GLSL output with glslang at
+//   link time.  Other shaders, and shaders using anything the generator doesn't support, still go
+//   through glslang.
+//
+//   Interface variables whose layout is only known at link time (attributes, varyings, samplers,
+//   the default uniform block and the driver uniform block) are the only variables with debug
+//   names.  They are named after their GLSL variable, and their Location or DescriptorSet and
+//   Binding decorations are placeholders that GlslangWrapper rewrites when the program is linked.
+//
+
+#ifndef COMPILER_TRANSLATOR_OUTPUTSPIRV_H_
+#define COMPILER_TRANSLATOR_OUTPUTSPIRV_H_
+
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/Common.h"
+
+namespace sh
+{
+class TIntermBlock;
+class TVariable;
+
+// The name of the default uniform block variable.
+constexpr char kDefaultUniformsBlockName[] = "defaultUniforms";
+
+// Generates the SPIR-V of |root|.  |defaultUniforms| are the non-opaque uniforms in the order of
+// the members of the default uniform block, and |driverUniforms| is the driver uniform block.
+// The code in "#ifdef ANGLE_ENABLE_LINE_SEGMENT_RASTERIZATION" regions is only generated if
+// |lineRasterEmulation| is set.
+//
+// Returns false if the shader uses something the generator doesn't support, in which case the
+// GLSL output must be used instead.
+bool OutputSPIRV(TIntermBlock *root,
+                 sh::GLenum shaderType,
+                 const TVector<const TVariable *> &defaultUniforms,
+                 const TVariable *driverUniforms,
+                 bool lineRasterEmulation,
+                 std::vector<uint32_t> *spirvOut);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_OUTPUTSPIRV_H_
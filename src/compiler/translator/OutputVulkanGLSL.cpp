@@ -38,6 +38,16 @@ TOutputVulkanGLSL::TOutputVulkanGLSL(TInfoSinkBase &objSink,
                   compileOptions)
 {}
 
+TOutputVulkanGLSL::TOutputVulkanGLSL(TInfoSinkBase &objSink, const TOutputVulkanGLSL &other)
+    : TOutputGLSL(objSink, other)
+{}
+
+std::unique_ptr<TOutputGLSLBase> TOutputVulkanGLSL::createFunctionOutput(
+    TInfoSinkBase &objSink) const
+{
+    return std::unique_ptr<TOutputGLSLBase>(new TOutputVulkanGLSL(objSink, *this));
+}
+
 // TODO(jmadill): This is not complete.
 void TOutputVulkanGLSL::writeLayoutQualifier(TIntermTyped *variable)
 {
@@ -97,7 +107,7 @@ void TOutputVulkanGLSL::writeQualifier(TQualifier qualifier, const TSymbol *symb
     }
 
     TInfoSinkBase &out = objSink();
-    out << "@@ QUALIFIER-" << symbol->name().data() << " @@ ";
+    out << "@@ QUALIFIER-" << symbol->name() << " @@ ";
 }
 
 void TOutputVulkanGLSL::writeVariableType(const TType &type, const TSymbol *symbol)
@@ -30,6 +30,9 @@ class TOutputVulkanGLSL : public TOutputGLSL
     void writeStructType(const TStructure *structure);
 
   protected:
+    TOutputVulkanGLSL(TInfoSinkBase &objSink, const TOutputVulkanGLSL &other);
+
+    std::unique_ptr<TOutputGLSLBase> createFunctionOutput(TInfoSinkBase &objSink) const override;
     void writeLayoutQualifier(TIntermTyped *variable) override;
     void writeQualifier(TQualifier qualifier, const TSymbol *symbol) override;
     void writeVariableType(const TType &type, const TSymbol *symbol) override;
@@ -350,6 +350,15 @@ void TPoolAllocator::unlock()
     mLocked = false;
 }
 
+size_t TPoolAllocator::getTotalBytes() const
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    return totalBytes;
+#else
+    return 0;
+#endif
+}
+
 //
 // Check all allocations in a list for damage by calling check on each.
 //
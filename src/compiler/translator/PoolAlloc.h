@@ -163,6 +163,12 @@ class TPoolAllocator
     void lock();
     void unlock();
 
+    //
+    // Returns the number of bytes requested with allocate() since the pool was
+    // created, or 0 if the pool allocator is disabled.
+    //
+    size_t getTotalBytes() const;
+
   private:
     size_t alignment;  // all returned allocations will be aligned at
                        // this granularity, which will be a power of 2
@@ -17,6 +17,9 @@
 #ifdef ANGLE_ENABLE_HLSL
 #    include "compiler/translator/TranslatorHLSL.h"
 #endif  // ANGLE_ENABLE_HLSL
+#ifdef ANGLE_ENABLE_VULKAN
+#    include "compiler/translator/TranslatorVulkan.h"
+#endif  // ANGLE_ENABLE_VULKAN
 #include "angle_gl.h"
 #include "compiler/translator/VariablePacker.h"
 
@@ -112,6 +115,16 @@ TranslatorHLSL *GetTranslatorHLSLFromHandle(ShHandle handle)
 }
 #endif  // ANGLE_ENABLE_HLSL
 
+#ifdef ANGLE_ENABLE_VULKAN
+TranslatorVulkan *GetTranslatorVulkanFromHandle(ShHandle handle)
+{
+    if (!handle)
+        return nullptr;
+    TShHandleBase *base = static_cast<TShHandleBase *>(handle);
+    return base->getAsTranslatorVulkan();
+}
+#endif  // ANGLE_ENABLE_VULKAN
+
 GLenum GetGeometryShaderPrimitiveTypeEnum(sh::TLayoutPrimitiveType primitiveType)
 {
     switch (primitiveType)
@@ -355,6 +368,20 @@ bool Compile(const ShHandle handle,
     return compiler->compile(shaderStrings, numStrings, compileOptions);
 }
 
+void SetUnusedOutputVaryings(const ShHandle handle, const std::vector<std::string> &names)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    compiler->setUnusedOutputVaryings(names);
+}
+
+void SetFunctionOutputThreadCount(const ShHandle handle, int threadCount)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    compiler->setFunctionOutputThreadCount(threadCount);
+}
+
 void ClearResults(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
@@ -590,6 +617,22 @@ const std::set<std::string> *GetUsedImage2DFunctionNames(const ShHandle handle)
 #endif  // ANGLE_ENABLE_HLSL
 }
 
+const std::vector<uint32_t> *GetSPIRVCode(const ShHandle handle, bool lineRasterEmulation)
+{
+#ifdef ANGLE_ENABLE_VULKAN
+    TranslatorVulkan *translator = GetTranslatorVulkanFromHandle(handle);
+    if (!translator)
+    {
+        return nullptr;
+    }
+
+    const std::vector<uint32_t> &spirv = translator->getSPIRV(lineRasterEmulation);
+    return spirv.empty() ? nullptr : &spirv;
+#else
+    return nullptr;
+#endif  // ANGLE_ENABLE_VULKAN
+}
+
 bool HasValidGeometryShaderInputPrimitiveType(const ShHandle handle)
 {
     ASSERT(handle);
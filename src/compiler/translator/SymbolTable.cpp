@@ -13,14 +13,58 @@
 
 #include "compiler/translator/SymbolTable.h"
 
+#include <map>
+#include <mutex>
+
 #include "angle_gl.h"
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PoolAlloc.h"
 #include "compiler/translator/StaticType.h"
 
 namespace sh
 {
 
+// The built-in variables of one shader type, spec and resources combination, and the pool they're
+// allocated from.
+class TBuiltInSnapshot : public TSymbolTableBase
+{
+  public:
+    TBuiltInSnapshot() = default;
+
+    TPoolAllocator allocator;
+};
+
+namespace
+{
+
+struct BuiltInSnapshotCache
+{
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<const TBuiltInSnapshot>> snapshots;
+};
+
+BuiltInSnapshotCache *GetBuiltInSnapshotCache()
+{
+    static BuiltInSnapshotCache cache;
+    return &cache;
+}
+
+// Computes the data that field lists compute on demand. Otherwise it would be allocated from the
+// pool of whichever compilation happens to need it first, while the field list is shared.
+void RealizeFieldList(const TFieldListCollection &fieldList)
+{
+    for (const TField *field : fieldList.fields())
+    {
+        field->type()->getMangledName();
+    }
+    fieldList.mangledFieldList();
+    fieldList.objectSize();
+    fieldList.deepestNesting();
+}
+
+}  // anonymous namespace
+
 class TSymbolTable::TSymbolTableLevel
 {
   public:
@@ -321,6 +365,41 @@ void TSymbolTable::clearCompilationResults()
     ASSERT(mTable.empty());
 }
 
+class TSymbolTable::TParsedShaderState
+{
+  public:
+    TSymbolTableLevel globalLevel;
+    PrecisionStackLevel globalPrecisions;
+    bool globalInvariant;
+    int uniqueIdCounter;
+    std::map<int, VariableMetadata> variableMetadata;
+    TVariable *glInVariableWithArraySize;
+};
+
+std::shared_ptr<const TSymbolTable::TParsedShaderState> TSymbolTable::saveParsedShaderState() const
+{
+    ASSERT(atGlobalLevel());
+    std::shared_ptr<TParsedShaderState> state = std::make_shared<TParsedShaderState>();
+    state->globalLevel               = *mTable.back();
+    state->globalPrecisions          = *mPrecisionStack.back();
+    state->globalInvariant           = mGlobalInvariant;
+    state->uniqueIdCounter           = mUniqueIdCounter;
+    state->variableMetadata          = mVariableMetadata;
+    state->glInVariableWithArraySize = mGlInVariableWithArraySize;
+    return state;
+}
+
+void TSymbolTable::restoreParsedShaderState(const TParsedShaderState &state)
+{
+    ASSERT(atGlobalLevel());
+    *mTable.back()             = state.globalLevel;
+    *mPrecisionStack.back()    = state.globalPrecisions;
+    mGlobalInvariant           = state.globalInvariant;
+    mUniqueIdCounter           = state.uniqueIdCounter;
+    mVariableMetadata          = state.variableMetadata;
+    mGlInVariableWithArraySize = state.glInVariableWithArraySize;
+}
+
 int TSymbolTable::nextUniqueIdValue()
 {
     ASSERT(mUniqueIdCounter < std::numeric_limits<int>::max());
@@ -329,7 +408,8 @@ int TSymbolTable::nextUniqueIdValue()
 
 void TSymbolTable::initializeBuiltIns(sh::GLenum type,
                                       ShShaderSpec spec,
-                                      const ShBuiltInResources &resources)
+                                      const ShBuiltInResources &resources,
+                                      const std::string &builtInResourcesString)
 {
     mShaderType = type;
     mResources  = resources;
@@ -365,10 +445,65 @@ void TSymbolTable::initializeBuiltIns(sh::GLenum type,
 
     setDefaultPrecision(EbtAtomicCounter, EbpHigh);
 
-    initializeBuiltInVariables(type, spec, resources);
+    mBuiltInSnapshot = GetBuiltInSnapshot(type, spec, resources, builtInResourcesString);
+    static_cast<TSymbolTableBase &>(*this) = *mBuiltInSnapshot;
     mUniqueIdCounter = kLastBuiltInId + 1;
 }
 
+// static
+void TSymbolTable::ReleaseBuiltInSnapshots()
+{
+    BuiltInSnapshotCache *cache = GetBuiltInSnapshotCache();
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    cache->snapshots.clear();
+}
+
+// static
+std::shared_ptr<const TBuiltInSnapshot> TSymbolTable::GetBuiltInSnapshot(
+    sh::GLenum shaderType,
+    ShShaderSpec spec,
+    const ShBuiltInResources &resources,
+    const std::string &builtInResourcesString)
+{
+    const std::string key =
+        std::to_string(shaderType) + ":" + std::to_string(spec) + builtInResourcesString;
+
+    BuiltInSnapshotCache *cache = GetBuiltInSnapshotCache();
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    std::shared_ptr<const TBuiltInSnapshot> &snapshot = cache->snapshots[key];
+    if (!snapshot)
+    {
+        snapshot = CreateBuiltInSnapshot(shaderType, spec, resources);
+    }
+    return snapshot;
+}
+
+// static
+std::shared_ptr<const TBuiltInSnapshot> TSymbolTable::CreateBuiltInSnapshot(
+    sh::GLenum shaderType,
+    ShShaderSpec spec,
+    const ShBuiltInResources &resources)
+{
+    std::shared_ptr<TBuiltInSnapshot> snapshot = std::make_shared<TBuiltInSnapshot>();
+
+    TPoolAllocator *previousAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&snapshot->allocator);
+
+    TSymbolTable symbolTable;
+    symbolTable.mResources = resources;
+    symbolTable.initializeBuiltInVariables(shaderType, spec, resources);
+
+    // The snapshot is shared between threads, so nothing may be computed lazily once it's in use.
+    RealizeFieldList(*symbolTable.mVar_gl_DepthRangeParameters);
+    RealizeFieldList(*symbolTable.mVar_gl_PerVertex);
+    RealizeFieldList(*symbolTable.mVar_gl_PositionGS->getType().getInterfaceBlock());
+
+    static_cast<TSymbolTableBase &>(*snapshot) = symbolTable;
+
+    SetGlobalPoolAllocator(previousAllocator);
+    return snapshot;
+}
+
 void TSymbolTable::initSamplerDefaultPrecision(TBasicType samplerType)
 {
     ASSERT(samplerType >= EbtGuardSamplerBegin && samplerType <= EbtGuardSamplerEnd);
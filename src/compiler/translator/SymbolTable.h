@@ -32,6 +32,7 @@
 
 #include <memory>
 #include <set>
+#include <string>
 
 #include "common/angleutils.h"
 #include "compiler/translator/ExtensionBehavior.h"
@@ -55,6 +56,8 @@ const int ESSL3_1_BUILTINS = 3;
 const int GLSL_BUILTINS      = 4;
 const int LAST_BUILTIN_LEVEL = GLSL_BUILTINS;
 
+class TBuiltInSnapshot;
+
 struct UnmangledBuiltIn
 {
     constexpr UnmangledBuiltIn(TExtension extension) : extension(extension) {}
@@ -141,11 +144,32 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
     const UnmangledBuiltIn *getUnmangledBuiltInForShaderVersion(const ImmutableString &name,
                                                                 int shaderVersion);
 
+    // The built-in variables that depend on the shader type, spec and resources are created once
+    // per process for each combination of them, and shared by all symbol tables initialized with
+    // the same combination. |builtInResourcesString| must identify the resources.
     void initializeBuiltIns(sh::GLenum type,
                             ShShaderSpec spec,
-                            const ShBuiltInResources &resources);
+                            const ShBuiltInResources &resources,
+                            const std::string &builtInResourcesString);
     void clearCompilationResults();
 
+    // The user-defined global symbols and the rest of the per-compilation state that parsing a
+    // shader leaves in the symbol table. TCompiler uses it to compile the same shader again without
+    // parsing it.
+    class TParsedShaderState;
+    // Must be called at global level. The copy of the global level is allocated from the current
+    // pool.
+    std::shared_ptr<const TParsedShaderState> saveParsedShaderState() const;
+    // Must be called at an empty global level.
+    void restoreParsedShaderState(const TParsedShaderState &state);
+
+    // Drops the shared built-in variables from the cache. The ones that are still used by symbol
+    // tables are freed once the last of those symbol tables is destroyed.
+    static void ReleaseBuiltInSnapshots();
+
+    // Symbol tables initialized with identical resources return the same snapshot.
+    const TBuiltInSnapshot *getBuiltInSnapshotForTesting() const { return mBuiltInSnapshot.get(); }
+
   private:
     friend class TSymbolUniqueId;
 
@@ -161,6 +185,16 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 
     class TSymbolTableLevel;
 
+    static std::shared_ptr<const TBuiltInSnapshot> GetBuiltInSnapshot(
+        sh::GLenum shaderType,
+        ShShaderSpec spec,
+        const ShBuiltInResources &resources,
+        const std::string &builtInResourcesString);
+    static std::shared_ptr<const TBuiltInSnapshot> CreateBuiltInSnapshot(
+        sh::GLenum shaderType,
+        ShShaderSpec spec,
+        const ShBuiltInResources &resources);
+
     void initSamplerDefaultPrecision(TBasicType samplerType);
 
     void initializeBuiltInVariables(sh::GLenum shaderType,
@@ -185,6 +219,9 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
     sh::GLenum mShaderType;
     ShBuiltInResources mResources;
 
+    // Keeps the built-in variables that TSymbolTableBase points to alive.
+    std::shared_ptr<const TBuiltInSnapshot> mBuiltInSnapshot;
+
     // Indexed by unique id. Map instead of vector since the variables are fairly sparse.
     std::map<int, VariableMetadata> mVariableMetadata;
 
@@ -102,6 +102,7 @@ void TranslatorESSL::translate(TIntermBlock *root,
     TOutputESSL outputESSL(sink, getArrayIndexClampingStrategy(), getHashFunction(), getNameMap(),
                            &getSymbolTable(), getShaderType(), shaderVer, precisionEmulation,
                            compileOptions);
+    outputESSL.setFunctionOutputThreadCount(getFunctionOutputThreadCount());
 
     root->traverse(&outputESSL);
 }
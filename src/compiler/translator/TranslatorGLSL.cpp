@@ -212,6 +212,7 @@ void TranslatorGLSL::translate(TIntermBlock *root,
     TOutputGLSL outputGLSL(sink, getArrayIndexClampingStrategy(), getHashFunction(), getNameMap(),
                            &getSymbolTable(), getShaderType(), getShaderVersion(), getOutputType(),
                            compileOptions);
+    outputGLSL.setFunctionOutputThreadCount(getFunctionOutputThreadCount());
 
     root->traverse(&outputGLSL);
 }
@@ -80,6 +80,10 @@ void TranslatorHLSL::translate(TIntermBlock *root,
         RemoveDynamicIndexing(root, &getSymbolTable(), perfDiagnostics);
     }
 
+    // Clean up the temporary variables added by the transformations above. This needs to run
+    // before RewriteElseBlocks, since propagating copies could undo its workaround.
+    optimizeAST(root, compileOptions);
+
     // Work around D3D9 bug that would manifest in vertex shaders with selection blocks which
     // use a vertex attribute as a condition, and some related computation in the else block.
     if (getOutputType() == SH_HLSL_3_0_OUTPUT && getShaderType() == GL_VERTEX_SHADER)
@@ -8,12 +8,15 @@
 //   The shaders are then fed into glslang to spit out SPIR-V (libANGLE-side).
 //   See: https://www.khronos.org/registry/vulkan/specs/misc/GL_KHR_vulkan_glsl.txt
 //
+//   With SH_GENERATE_SPIRV, ESSL 1.00 shaders are also output as SPIR-V directly.
+//
 
 #include "compiler/translator/TranslatorVulkan.h"
 
 #include "angle_gl.h"
 #include "common/utilities.h"
 #include "compiler/translator/ImmutableStringBuilder.h"
+#include "compiler/translator/OutputSPIRV.h"
 #include "compiler/translator/OutputVulkanGLSL.h"
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/tree_ops/NameEmbeddedUniformStructs.h"
@@ -82,11 +85,13 @@ class DeclareDefaultUniformsTraverser : public TIntermTraverser
   public:
     DeclareDefaultUniformsTraverser(TInfoSinkBase *sink,
                                     ShHashFunction64 hashFunction,
-                                    NameMap *nameMap)
+                                    NameMap *nameMap,
+                                    TVector<const TVariable *> *uniformsOut)
         : TIntermTraverser(true, true, true),
           mSink(sink),
           mHashFunction(hashFunction),
           mNameMap(nameMap),
+          mUniformsOut(uniformsOut),
           mInDefaultUniform(false)
     {}
 
@@ -118,6 +123,7 @@ class DeclareDefaultUniformsTraverser : public TIntermTraverser
             if (isUniform)
             {
                 (*mSink) << ";\n";
+                mUniformsOut->push_back(&variable->getAsSymbolNode()->variable());
 
                 // Remove the uniform declaration from the tree so it isn't parsed again.
                 TIntermSequence emptyReplacement;
@@ -145,6 +151,8 @@ class DeclareDefaultUniformsTraverser : public TIntermTraverser
     TInfoSinkBase *mSink;
     ShHashFunction64 mHashFunction;
     NameMap *mNameMap;
+    // The uniforms in the order they are declared in the default uniform block.
+    TVector<const TVariable *> *mUniformsOut;
     bool mInDefaultUniform;
 };
 
@@ -157,11 +165,16 @@ constexpr const char kHalfRenderAreaHeight[] = "halfRenderAreaHeight";
 constexpr const char kViewportYScale[]       = "viewportYScale";
 constexpr const char kNegViewportYScale[]    = "negViewportYScale";
 constexpr const char kDepthRange[]           = "depthRange";
+constexpr const char kXfbBufferOffsets[]     = "xfbBufferOffsets";
+constexpr const char kXfbActiveUnpaused[]    = "xfbActiveUnpaused";
+constexpr const char kXfbVerticesPerDraw[]   = "xfbVerticesPerDraw";
 
-constexpr size_t kNumDriverUniforms                                        = 6;
+constexpr size_t kNumDriverUniforms                                        = 9;
 constexpr std::array<const char *, kNumDriverUniforms> kDriverUniformNames = {
     {kViewport, kHalfRenderAreaHeight, kViewportYScale, kNegViewportYScale, "padding",
-     kDepthRange}};
+     kDepthRange, kXfbBufferOffsets, kXfbActiveUnpaused, kXfbVerticesPerDraw}};
+
+constexpr ImmutableString kCaptureXfbFunctionName = ImmutableString("ANGLECaptureXfb");
 
 template <TBasicType BasicType = EbtFloat, unsigned char PrimarySize = 1>
 TIntermConstantUnion *CreateBasicConstant(float value)
@@ -351,6 +364,9 @@ const TVariable *AddDriverUniformsToShader(TIntermBlock *root, TSymbolTable *sym
         new TType(EbtFloat),
         new TType(EbtFloat),
         emulatedDepthRangeType,
+        new TType(EbtInt, 4),
+        new TType(EbtInt),
+        new TType(EbtInt),
     }};
 
     for (size_t uniformIndex = 0; uniformIndex < kNumDriverUniforms; ++uniformIndex)
@@ -391,11 +407,47 @@ TIntermPreprocessorDirective *GenerateLineRasterIfDef()
         PreprocessorDirective::Ifdef, ImmutableString("ANGLE_ENABLE_LINE_SEGMENT_RASTERIZATION"));
 }
 
+TIntermPreprocessorDirective *GenerateCaptureXfbIfDef()
+{
+    return new TIntermPreprocessorDirective(PreprocessorDirective::Ifdef,
+                                            ImmutableString("ANGLE_CAPTURE_XFB"));
+}
+
 TIntermPreprocessorDirective *GenerateEndIf()
 {
     return new TIntermPreprocessorDirective(PreprocessorDirective::Endif, kEmptyImmutableString);
 }
 
+// Transform feedback is emulated by writing the captured varyings to storage buffers from the
+// vertex shader. Which varyings are captured, and into which buffers, is only known at link time.
+// A call to ANGLECaptureXfb() is thus added at the end of main(), and the function is defined by
+// GlslangWrapper in place of the "@@ XFB-OUT @@" marker written after the shader. The declaration
+// and the call are behind ANGLE_CAPTURE_XFB, which is only defined for programs that capture
+// varyings, so other programs don't pay for the emulation.
+void AddXfbEmulationSupport(TIntermBlock *root, TSymbolTable *symbolTable)
+{
+    TFunction *captureXfbFunction =
+        new TFunction(symbolTable, kCaptureXfbFunctionName, SymbolType::AngleInternal,
+                      StaticType::GetBasic<EbtVoid>(), false);
+
+    // Declare "void ANGLECaptureXfb();" before main.
+    TIntermSequence insertSequence;
+    insertSequence.push_back(GenerateCaptureXfbIfDef());
+    insertSequence.push_back(CreateInternalFunctionPrototypeNode(*captureXfbFunction));
+    insertSequence.push_back(GenerateEndIf());
+
+    size_t mainIndex = FindMainIndex(root);
+    root->insertChildNodes(mainIndex, insertSequence);
+
+    // Call it at the end of main, before gl_Position is modified for Vulkan.
+    TIntermBlock *captureXfbBlock = new TIntermBlock;
+    captureXfbBlock->appendStatement(GenerateCaptureXfbIfDef());
+    captureXfbBlock->appendStatement(
+        TIntermAggregate::CreateFunctionCall(*captureXfbFunction, new TIntermSequence()));
+    captureXfbBlock->appendStatement(GenerateEndIf());
+    RunAtTheEndOfShader(root, captureXfbBlock, symbolTable);
+}
+
 TVariable *AddANGLEPositionVaryingDeclaration(TIntermBlock *root,
                                               TSymbolTable *symbolTable,
                                               TQualifier qualifier)
@@ -629,9 +681,13 @@ void TranslatorVulkan::translate(TIntermBlock *root,
                                  PerformanceDiagnostics * /*perfDiagnostics*/)
 {
     TInfoSinkBase &sink = getInfoSink().obj;
+    mSPIRV.clear();
+    mLineRasterSPIRV.clear();
+
     TOutputVulkanGLSL outputGLSL(sink, getArrayIndexClampingStrategy(), getHashFunction(),
                                  getNameMap(), &getSymbolTable(), getShaderType(),
                                  getShaderVersion(), getOutputType(), compileOptions);
+    outputGLSL.setFunctionOutputThreadCount(getFunctionOutputThreadCount());
 
     sink << "#version 450 core\n";
 
@@ -651,6 +707,8 @@ void TranslatorVulkan::translate(TIntermBlock *root,
         }
     }
 
+    TVector<const TVariable *> defaultUniforms;
+
     // TODO(lucferron): Refactor this function to do less tree traversals.
     // http://anglebug.com/2461
     if (structTypesUsedForUniforms > 0)
@@ -669,7 +727,8 @@ void TranslatorVulkan::translate(TIntermBlock *root,
     {
         sink << "\nlayout(@@ DEFAULT-UNIFORMS-SET-BINDING @@) uniform defaultUniforms\n{\n";
 
-        DeclareDefaultUniformsTraverser defaultTraverser(&sink, getHashFunction(), &getNameMap());
+        DeclareDefaultUniformsTraverser defaultTraverser(&sink, getHashFunction(), &getNameMap(),
+                                                         &defaultUniforms);
         root->traverse(&defaultTraverser);
         defaultTraverser.updateTree();
 
@@ -760,12 +819,32 @@ void TranslatorVulkan::translate(TIntermBlock *root,
 
         AddANGLEPositionVarying(root, &getSymbolTable());
 
+        AddXfbEmulationSupport(root, &getSymbolTable());
+
         // Append depth range translation to main.
         AppendVertexShaderDepthCorrectionToMain(root, &getSymbolTable());
     }
 
+    // The GLSL output is still needed when the SPIR-V generator doesn't support the shader, or if
+    // the program uses transform feedback.
+    if ((compileOptions & SH_GENERATE_SPIRV) != 0 && getShaderVersion() == 100)
+    {
+        if (!OutputSPIRV(root, getShaderType(), defaultUniforms, driverUniforms, false, &mSPIRV) ||
+            !OutputSPIRV(root, getShaderType(), defaultUniforms, driverUniforms, true,
+                         &mLineRasterSPIRV))
+        {
+            mSPIRV.clear();
+            mLineRasterSPIRV.clear();
+        }
+    }
+
     // Write translated shader.
     root->traverse(&outputGLSL);
+
+    if (getShaderType() == GL_VERTEX_SHADER)
+    {
+        sink << "@@ XFB-OUT @@\n";
+    }
 }
 
 bool TranslatorVulkan::shouldFlattenPragmaStdglInvariantAll()
@@ -8,10 +8,15 @@
 //   The shaders are then fed into glslang to spit out SPIR-V (libANGLE-side).
 //   See: https://www.khronos.org/registry/vulkan/specs/misc/GL_KHR_vulkan_glsl.txt
 //
+//   With SH_GENERATE_SPIRV, ESSL 1.00 shaders are also output as SPIR-V directly, which lets
+//   libANGLE skip glslang at link time.
+//
 
 #ifndef COMPILER_TRANSLATOR_TRANSLATORVULKAN_H_
 #define COMPILER_TRANSLATOR_TRANSLATORVULKAN_H_
 
+#include <vector>
+
 #include "compiler/translator/Compiler.h"
 
 namespace sh
@@ -22,11 +27,24 @@ class TranslatorVulkan : public TCompiler
   public:
     TranslatorVulkan(sh::GLenum type, ShShaderSpec spec);
 
+    TranslatorVulkan *getAsTranslatorVulkan() override { return this; }
+
+    // The SPIR-V generated with SH_GENERATE_SPIRV, with and without the line raster emulation
+    // code.  Empty if it wasn't requested or the shader isn't supported by the SPIR-V generator.
+    const std::vector<uint32_t> &getSPIRV(bool lineRasterEmulation) const
+    {
+        return lineRasterEmulation ? mLineRasterSPIRV : mSPIRV;
+    }
+
   protected:
     void translate(TIntermBlock *root,
                    ShCompileOptions compileOptions,
                    PerformanceDiagnostics *perfDiagnostics) override;
     bool shouldFlattenPragmaStdglInvariantAll() override;
+
+  private:
+    std::vector<uint32_t> mSPIRV;
+    std::vector<uint32_t> mLineRasterSPIRV;
 };
 
 }  // namespace sh
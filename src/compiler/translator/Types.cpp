@@ -9,13 +9,35 @@
 #endif
 
 #include "compiler/translator/Types.h"
+#include "common/tls.h"
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/InfoSink.h"
+#include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/SymbolTable.h"
 
 #include <algorithm>
 #include <climits>
+#include <functional>
+#include <unordered_set>
+
+TLSIndex TypeSharingIndex = TLS_INVALID_INDEX;
+
+bool InitializeTypeSharingIndex()
+{
+    ASSERT(TypeSharingIndex == TLS_INVALID_INDEX);
+
+    TypeSharingIndex = CreateTLSIndex();
+    return TypeSharingIndex != TLS_INVALID_INDEX;
+}
+
+void FreeTypeSharingIndex()
+{
+    ASSERT(TypeSharingIndex != TLS_INVALID_INDEX);
+
+    DestroyTLSIndex(TypeSharingIndex);
+    TypeSharingIndex = TLS_INVALID_INDEX;
+}
 
 namespace sh
 {
@@ -967,4 +989,97 @@ bool TPublicType::isAggregate() const
     return isArray() || typeSpecifierNonArray.isMatrix() || typeSpecifierNonArray.isVector();
 }
 
+namespace
+{
+
+bool CanShareType(const TType &type)
+{
+    return type.getLayoutQualifier().isEmpty() &&
+           type.getLayoutQualifier().locationsSpecified == 0 &&
+           type.getMemoryQualifier().isEmpty();
+}
+
+struct SharedTypeHash
+{
+    size_t operator()(const TType *type) const
+    {
+        size_t hash = type->getBasicType();
+        hash        = hash * 31 + type->getPrecision();
+        hash        = hash * 31 + type->getQualifier();
+        hash        = hash * 31 + type->getNominalSize();
+        hash        = hash * 31 + type->getSecondarySize();
+        hash        = hash * 31 + type->getNumArraySizes();
+        hash        = hash * 31 + std::hash<const TStructure *>()(type->getStruct());
+        return hash;
+    }
+};
+
+struct SharedTypeEqual
+{
+    bool operator()(const TType *a, const TType *b) const
+    {
+        // operator== checks the basic type, sizes, array sizes and struct.
+        return *a == *b && a->getPrecision() == b->getPrecision() &&
+               a->getQualifier() == b->getQualifier() && a->isInvariant() == b->isInvariant() &&
+               a->getInterfaceBlock() == b->getInterfaceBlock() &&
+               a->isStructSpecifier() == b->isStructSpecifier();
+    }
+};
+
+}  // anonymous namespace
+
+class TScopedTypeSharing::TypeSet
+    : public std::unordered_set<const TType *,
+                                SharedTypeHash,
+                                SharedTypeEqual,
+                                pool_allocator<const TType *>>
+{
+  public:
+    POOL_ALLOCATOR_NEW_DELETE
+};
+
+TScopedTypeSharing::TScopedTypeSharing()
+    : mAllocator(GetGlobalPoolAllocator()), mTypes(new TypeSet()), mPrevious(nullptr)
+{
+    ASSERT(mAllocator != nullptr);
+    if (TypeSharingIndex != TLS_INVALID_INDEX)
+    {
+        mPrevious = static_cast<TScopedTypeSharing *>(GetTLSValue(TypeSharingIndex));
+        SetTLSValue(TypeSharingIndex, this);
+    }
+}
+
+TScopedTypeSharing::~TScopedTypeSharing()
+{
+    // The types themselves are freed with the pool.
+    if (TypeSharingIndex != TLS_INVALID_INDEX)
+    {
+        ASSERT(GetTLSValue(TypeSharingIndex) == this);
+        SetTLSValue(TypeSharingIndex, mPrevious);
+    }
+}
+
+// static
+const TType *TScopedTypeSharing::GetSharedType(const TType &type)
+{
+    TScopedTypeSharing *scope = nullptr;
+    if (TypeSharingIndex != TLS_INVALID_INDEX)
+    {
+        scope = static_cast<TScopedTypeSharing *>(GetTLSValue(TypeSharingIndex));
+    }
+    if (scope == nullptr || scope->mAllocator != GetGlobalPoolAllocator() || !CanShareType(type))
+    {
+        return new TType(type);
+    }
+
+    auto iter = scope->mTypes->find(&type);
+    if (iter != scope->mTypes->end())
+    {
+        return *iter;
+    }
+    const TType *sharedType = new TType(type);
+    scope->mTypes->insert(sharedType);
+    return sharedType;
+}
+
 }  // namespace sh
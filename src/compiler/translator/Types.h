@@ -360,6 +360,27 @@ class TType
     mutable const char *mMangledName;
 };
 
+// The nodes of the AST refer to immutable types instead of holding copies of them. While a
+// TScopedTypeSharing is alive on the current thread and its pool is the current pool, equal types
+// are only allocated once, and stay alive until the pool is popped. Types with layout or memory
+// qualifiers, and types that are requested while another pool is current, are copied every time.
+class TScopedTypeSharing : angle::NonCopyable
+{
+  public:
+    TScopedTypeSharing();
+    ~TScopedTypeSharing();
+
+    // Returns a type with the same value as |type|, allocated from the current pool.
+    static const TType *GetSharedType(const TType &type);
+
+  private:
+    class TypeSet;
+
+    TPoolAllocator *mAllocator;
+    TypeSet *mTypes;
+    TScopedTypeSharing *mPrevious;
+};
+
 // TTypeSpecifierNonArray stores all of the necessary fields for type_specifier_nonarray from the
 // grammar
 struct TTypeSpecifierNonArray
@@ -0,0 +1,404 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EliminateCommonSubexpressions.cpp: Reuse the value of a local variable instead of recomputing
+// the expression it was initialized with later in the same block. For example:
+//     float a = u * v + 1.0;
+//     float b = (u * v + 1.0) * w;
+// becomes:
+//     float a = u * v + 1.0;
+//     float b = a * w;
+// The elimination is local to each block: an expression is available from the declaration that
+// computes it until one of the variables it reads may be written. Only statements whose only side
+// effect is their assignment reuse available expressions.
+//
+
+#include "compiler/translator/tree_ops/EliminateCommonSubexpressions.h"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_util/CountVariableAccesses.h"
+#include "compiler/translator/tree_util/IntermNode_util.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Limits the number of expressions that each expression is compared with, so that the pass stays
+// linear in the size of the shader.
+constexpr size_t kMaxAvailableExpressions = 32u;
+
+// Returns true if |node| computes something, rather than just selecting a part of a variable or
+// a constant.
+bool IsComputation(TIntermTyped *node)
+{
+    if (node->getAsSwizzleNode() != nullptr)
+    {
+        return IsComputation(node->getAsSwizzleNode()->getOperand());
+    }
+    TIntermBinary *binary = node->getAsBinaryNode();
+    if (binary != nullptr &&
+        (binary->getOp() == EOpIndexDirect || binary->getOp() == EOpIndexDirectStruct ||
+         binary->getOp() == EOpIndexDirectInterfaceBlock))
+    {
+        return IsComputation(binary->getLeft());
+    }
+    return node->getAsSymbolNode() == nullptr && node->getAsConstantUnion() == nullptr;
+}
+
+bool AreEquivalentExpressions(TIntermNode *a, TIntermNode *b)
+{
+    TIntermTyped *typedA = a->getAsTyped();
+    TIntermTyped *typedB = b->getAsTyped();
+    if (typedA == nullptr || typedB == nullptr || typedA->getType() != typedB->getType() ||
+        typedA->getType().getPrecision() != typedB->getType().getPrecision())
+    {
+        return false;
+    }
+
+    if (typedA->getAsSymbolNode() != nullptr)
+    {
+        return typedB->getAsSymbolNode() != nullptr &&
+               typedA->getAsSymbolNode()->uniqueId() == typedB->getAsSymbolNode()->uniqueId();
+    }
+    if (typedA->getAsConstantUnion() != nullptr)
+    {
+        if (typedB->getAsConstantUnion() == nullptr)
+        {
+            return false;
+        }
+        const TConstantUnion *valueA = typedA->getConstantValue();
+        const TConstantUnion *valueB = typedB->getConstantValue();
+        for (size_t index = 0; index < typedA->getType().getObjectSize(); ++index)
+        {
+            if (valueA[index] != valueB[index])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (typedA->getAsSwizzleNode() != nullptr)
+    {
+        if (typedB->getAsSwizzleNode() == nullptr ||
+            typedA->getAsSwizzleNode()->getSwizzleOffsets() !=
+                typedB->getAsSwizzleNode()->getSwizzleOffsets())
+        {
+            return false;
+        }
+    }
+    else if (typedA->getAsBinaryNode() != nullptr)
+    {
+        if (typedB->getAsBinaryNode() == nullptr ||
+            typedA->getAsBinaryNode()->getOp() != typedB->getAsBinaryNode()->getOp())
+        {
+            return false;
+        }
+    }
+    else if (typedA->getAsUnaryNode() != nullptr)
+    {
+        if (typedB->getAsUnaryNode() == nullptr ||
+            typedA->getAsUnaryNode()->getOp() != typedB->getAsUnaryNode()->getOp() ||
+            typedA->getAsUnaryNode()->getFunction() != typedB->getAsUnaryNode()->getFunction())
+        {
+            return false;
+        }
+    }
+    else if (typedA->getAsTernaryNode() != nullptr)
+    {
+        if (typedB->getAsTernaryNode() == nullptr)
+        {
+            return false;
+        }
+    }
+    else if (typedA->getAsAggregate() != nullptr)
+    {
+        if (typedB->getAsAggregate() == nullptr ||
+            typedA->getAsAggregate()->getOp() != typedB->getAsAggregate()->getOp() ||
+            typedA->getAsAggregate()->getFunction() != typedB->getAsAggregate()->getFunction())
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    if (a->getChildCount() != b->getChildCount())
+    {
+        return false;
+    }
+    for (size_t childIndex = 0; childIndex < a->getChildCount(); ++childIndex)
+    {
+        if (!AreEquivalentExpressions(a->getChildNode(childIndex), b->getChildNode(childIndex)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// An expression whose value is held by a variable.
+struct AvailableExpression
+{
+    TIntermTyped *expression;
+    const TVariable *variable;
+    // The unique ids of the variables that the expression reads.
+    std::set<int> readVariables;
+};
+
+using AvailableExpressions = std::vector<AvailableExpression>;
+
+class CollectReadVariablesTraverser : public TIntermTraverser
+{
+  public:
+    CollectReadVariablesTraverser(std::set<int> *readVariables)
+        : TIntermTraverser(true, false, false), mReadVariables(readVariables)
+    {}
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        mReadVariables->insert(node->uniqueId().get());
+    }
+
+  private:
+    std::set<int> *mReadVariables;
+};
+
+// Finds calls to functions that may write to global variables.
+class FindCallsWithSideEffectsTraverser : public TIntermTraverser
+{
+  public:
+    FindCallsWithSideEffectsTraverser() : TIntermTraverser(true, false, false), mFound(false) {}
+
+    bool found() const { return mFound; }
+
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        if (node->getOp() == EOpCallFunctionInAST || node->getOp() == EOpCallInternalRawFunction)
+        {
+            mFound = mFound || !node->getFunction()->isKnownToNotHaveSideEffects();
+        }
+        return !mFound;
+    }
+
+  private:
+    bool mFound;
+};
+
+// Replaces the expressions in a statement that are available in variables.
+class ReplaceAvailableExpressionsTraverser : public TLValueTrackingTraverser
+{
+  public:
+    ReplaceAvailableExpressionsTraverser(const AvailableExpressions &availableExpressions,
+                                         TSymbolTable *symbolTable)
+        : TLValueTrackingTraverser(true, false, false, symbolTable),
+          mAvailableExpressions(availableExpressions)
+    {}
+
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override { return !replace(node); }
+    bool visitBinary(Visit visit, TIntermBinary *node) override { return !replace(node); }
+    bool visitUnary(Visit visit, TIntermUnary *node) override { return !replace(node); }
+    bool visitTernary(Visit visit, TIntermTernary *node) override { return !replace(node); }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override { return !replace(node); }
+
+  private:
+    bool replace(TIntermTyped *node)
+    {
+        if (isLValueRequiredHere())
+        {
+            return false;
+        }
+        for (const AvailableExpression &available : mAvailableExpressions)
+        {
+            if (AreEquivalentExpressions(available.expression, node))
+            {
+                TIntermSymbol *replacement = new TIntermSymbol(available.variable);
+                replacement->setLine(node->getLine());
+                queueReplacement(replacement, OriginalNode::IS_DROPPED);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const AvailableExpressions &mAvailableExpressions;
+};
+
+class EliminateCommonSubexpressionsTraverser : public TIntermTraverser
+{
+  public:
+    EliminateCommonSubexpressionsTraverser(const VariableAccessCountMap &accessCounts,
+                                           TSymbolTable *symbolTable)
+        : TIntermTraverser(true, false, false, symbolTable), mAccessCounts(accessCounts)
+    {}
+
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+
+  private:
+    void replaceAvailableExpressions(TIntermNode *statement,
+                                     const AvailableExpressions &availableExpressions);
+    void removeInvalidatedExpressions(TIntermNode *statement,
+                                      AvailableExpressions *availableExpressions);
+    void addAvailableExpression(TIntermNode *statement,
+                                AvailableExpressions *availableExpressions);
+
+    const VariableAccessCountMap &mAccessCounts;
+};
+
+bool EliminateCommonSubexpressionsTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    // The statements of a switch statement are not executed in sequence because of the case
+    // labels.
+    if (getParentNode() != nullptr && getParentNode()->getAsSwitchNode() != nullptr)
+    {
+        return true;
+    }
+
+    AvailableExpressions availableExpressions;
+    for (TIntermNode *statement : *node->getSequence())
+    {
+        if (!availableExpressions.empty())
+        {
+            replaceAvailableExpressions(statement, availableExpressions);
+            removeInvalidatedExpressions(statement, &availableExpressions);
+        }
+        addAvailableExpression(statement, &availableExpressions);
+    }
+    return true;
+}
+
+void EliminateCommonSubexpressionsTraverser::replaceAvailableExpressions(
+    TIntermNode *statement,
+    const AvailableExpressions &availableExpressions)
+{
+    // Expressions are only replaced in statements whose only side effect is their top-level
+    // assignment, so that the variables the expressions read can't change while the statement is
+    // evaluated.
+    bool canReplace = false;
+    if (statement->getAsDeclarationNode() != nullptr)
+    {
+        TIntermBinary *initNode =
+            statement->getAsDeclarationNode()->getSequence()->front()->getAsBinaryNode();
+        canReplace = initNode != nullptr && IsPureExpression(initNode->getRight());
+    }
+    else if (statement->getAsBinaryNode() != nullptr)
+    {
+        TIntermBinary *assignment = statement->getAsBinaryNode();
+        canReplace = assignment->isAssignment() && IsPureExpression(assignment->getLeft()) &&
+                     IsPureExpression(assignment->getRight());
+    }
+    else if (statement->getAsBranchNode() != nullptr)
+    {
+        TIntermTyped *expression = statement->getAsBranchNode()->getExpression();
+        canReplace               = expression != nullptr && IsPureExpression(expression);
+    }
+
+    if (canReplace)
+    {
+        ReplaceAvailableExpressionsTraverser traverser(availableExpressions, mSymbolTable);
+        statement->traverse(&traverser);
+        traverser.updateTree();
+    }
+}
+
+void EliminateCommonSubexpressionsTraverser::removeInvalidatedExpressions(
+    TIntermNode *statement,
+    AvailableExpressions *availableExpressions)
+{
+    FindCallsWithSideEffectsTraverser findCalls;
+    statement->traverse(&findCalls);
+    if (findCalls.found())
+    {
+        availableExpressions->clear();
+        return;
+    }
+
+    VariableAccessCountMap statementAccessCounts;
+    CountVariableAccesses(statement, mSymbolTable, &statementAccessCounts);
+
+    auto isInvalidated = [&statementAccessCounts](const AvailableExpression &available) {
+        for (int variableId : available.readVariables)
+        {
+            auto iter = statementAccessCounts.find(variableId);
+            if (iter != statementAccessCounts.end() && iter->second.writes > 0u)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    availableExpressions->erase(std::remove_if(availableExpressions->begin(),
+                                               availableExpressions->end(), isInvalidated),
+                                availableExpressions->end());
+}
+
+void EliminateCommonSubexpressionsTraverser::addAvailableExpression(
+    TIntermNode *statement,
+    AvailableExpressions *availableExpressions)
+{
+    TIntermDeclaration *declaration = statement->getAsDeclarationNode();
+    if (declaration == nullptr)
+    {
+        return;
+    }
+
+    // SeparateDeclarations should have already been run.
+    ASSERT(declaration->getSequence()->size() == 1u);
+    TIntermBinary *initNode = declaration->getSequence()->front()->getAsBinaryNode();
+    if (initNode == nullptr)
+    {
+        return;
+    }
+
+    const TVariable &variable = initNode->getLeft()->getAsSymbolNode()->variable();
+    const TType &type         = variable.getType();
+    TIntermTyped *expression  = initNode->getRight();
+    if (type.getQualifier() != EvqTemporary || type.isArray() || type.getStruct() != nullptr ||
+        IsOpaqueType(type.getBasicType()) ||
+        GetVariableAccessCount(mAccessCounts, variable).writes != 0u)
+    {
+        return;
+    }
+
+    // The variable must hold the expression's value at the same precision.
+    if (expression->getType().getPrecision() != type.getPrecision() ||
+        !IsComputation(expression) || !IsPureExpression(expression))
+    {
+        return;
+    }
+
+    if (availableExpressions->size() == kMaxAvailableExpressions)
+    {
+        availableExpressions->erase(availableExpressions->begin());
+    }
+
+    AvailableExpression available;
+    available.expression = expression;
+    available.variable   = &variable;
+    CollectReadVariablesTraverser collectReadVariables(&available.readVariables);
+    expression->traverse(&collectReadVariables);
+    availableExpressions->push_back(std::move(available));
+}
+
+}  // anonymous namespace
+
+void EliminateCommonSubexpressions(TIntermBlock *root, TSymbolTable *symbolTable)
+{
+    VariableAccessCountMap accessCounts;
+    CountVariableAccesses(root, symbolTable, &accessCounts);
+
+    EliminateCommonSubexpressionsTraverser traverser(accessCounts, symbolTable);
+    root->traverse(&traverser);
+}
+
+}  // namespace sh
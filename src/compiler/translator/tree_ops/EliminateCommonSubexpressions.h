@@ -0,0 +1,21 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EliminateCommonSubexpressions.h: Reuse the value of a local variable instead of recomputing the
+// expression it was initialized with later in the same block.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_ELIMINATECOMMONSUBEXPRESSIONS_H_
+#define COMPILER_TRANSLATOR_TREEOPS_ELIMINATECOMMONSUBEXPRESSIONS_H_
+
+namespace sh
+{
+class TIntermBlock;
+class TSymbolTable;
+
+void EliminateCommonSubexpressions(TIntermBlock *root, TSymbolTable *symbolTable);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_ELIMINATECOMMONSUBEXPRESSIONS_H_
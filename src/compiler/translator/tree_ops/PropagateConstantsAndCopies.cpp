@@ -0,0 +1,241 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PropagateConstantsAndCopies.cpp: Replace references to local variables that are never assigned
+// after being initialized with a constant or with another such variable by the constant or the
+// other variable. For example:
+//     float a = 2.0;
+//     float b = u * a;
+//     float c = b;
+//     gl_FragColor = vec4(c);
+// becomes:
+//     float a = 2.0;
+//     float b = u * 2.0;
+//     float c = b;
+//     gl_FragColor = vec4(b);
+// This cleans up the temporary variables that other AST transformations leave behind.
+//
+
+#include "compiler/translator/tree_ops/PropagateConstantsAndCopies.h"
+
+#include <map>
+
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_ops/RecordConstantPrecision.h"
+#include "compiler/translator/tree_util/CountVariableAccesses.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Counts how many times each name is declared. A reference to a variable whose name is declared
+// only once can't be hidden by another declaration, so it can be moved anywhere inside the scope of
+// the variable.
+class CountDeclaredNamesTraverser : public TIntermTraverser
+{
+  public:
+    CountDeclaredNamesTraverser() : TIntermTraverser(true, false, false) {}
+
+    bool isDeclaredOnce(const ImmutableString &name) const
+    {
+        auto iter = mDeclarationCounts.find(name);
+        return iter != mDeclarationCounts.end() && iter->second == 1u;
+    }
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        for (TIntermNode *declarator : *node->getSequence())
+        {
+            TIntermTyped *declaratorTyped = declarator->getAsTyped();
+            TIntermSymbol *symbolNode     = declaratorTyped->getAsSymbolNode();
+            if (symbolNode == nullptr)
+            {
+                symbolNode = declaratorTyped->getAsBinaryNode()->getLeft()->getAsSymbolNode();
+            }
+            ++mDeclarationCounts[symbolNode->variable().name()];
+
+            // Struct names hide variable names as well.
+            const TType &type = declaratorTyped->getType();
+            if (type.isStructSpecifier() && type.getStruct()->symbolType() != SymbolType::Empty)
+            {
+                ++mDeclarationCounts[type.getStruct()->name()];
+            }
+        }
+        return false;
+    }
+
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        const TFunction *function = node->getFunctionPrototype()->getFunction();
+        for (size_t paramIndex = 0; paramIndex < function->getParamCount(); ++paramIndex)
+        {
+            ++mDeclarationCounts[function->getParam(paramIndex)->name()];
+        }
+        return true;
+    }
+
+  private:
+    std::map<ImmutableString, unsigned int> mDeclarationCounts;
+};
+
+class PropagateConstantsAndCopiesTraverser : public TIntermTraverser
+{
+  public:
+    PropagateConstantsAndCopiesTraverser(const VariableAccessCountMap &accessCounts,
+                                         const CountDeclaredNamesTraverser &declaredNames,
+                                         TSymbolTable *symbolTable)
+        : TIntermTraverser(true, false, false, symbolTable),
+          mAccessCounts(accessCounts),
+          mDeclaredNames(declaredNames)
+    {}
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+    void visitSymbol(TIntermSymbol *node) override;
+
+  private:
+    bool isNeverAssigned(const TVariable &variable) const
+    {
+        return GetVariableAccessCount(mAccessCounts, variable).writes == 0u;
+    }
+
+    bool canBeReplaced(const TVariable &variable) const;
+    bool canBeCopied(const TVariable &source, const TVariable &destination) const;
+
+    const VariableAccessCountMap &mAccessCounts;
+    const CountDeclaredNamesTraverser &mDeclaredNames;
+
+    // Maps the unique id of each variable that's being replaced to the node it's replaced with,
+    // which is either a constant union or a symbol.
+    std::map<int, TIntermTyped *> mReplacements;
+};
+
+bool PropagateConstantsAndCopiesTraverser::canBeReplaced(const TVariable &variable) const
+{
+    const TType &type = variable.getType();
+    return type.getQualifier() == EvqTemporary && !type.isArray() && type.getStruct() == nullptr &&
+           !IsOpaqueType(type.getBasicType()) && isNeverAssigned(variable);
+}
+
+bool PropagateConstantsAndCopiesTraverser::canBeCopied(const TVariable &source,
+                                                       const TVariable &destination) const
+{
+    TQualifier qualifier = source.getType().getQualifier();
+    if (qualifier != EvqTemporary && qualifier != EvqConst && qualifier != EvqIn &&
+        qualifier != EvqConstReadOnly)
+    {
+        return false;
+    }
+
+    // Replacing the variable with one that has a different precision would change the precision
+    // of the expressions it's used in.
+    const TType &sourceType      = source.getType();
+    const TType &destinationType = destination.getType();
+    if (sourceType != destinationType ||
+        sourceType.getPrecision() != destinationType.getPrecision())
+    {
+        return false;
+    }
+
+    return source.symbolType() != SymbolType::Empty && isNeverAssigned(source) &&
+           mDeclaredNames.isDeclaredOnce(source.name());
+}
+
+bool PropagateConstantsAndCopiesTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    // SeparateDeclarations should have already been run.
+    ASSERT(node->getSequence()->size() == 1u);
+
+    TIntermBinary *initNode = node->getSequence()->front()->getAsBinaryNode();
+    if (initNode == nullptr)
+    {
+        return true;
+    }
+    ASSERT(initNode->getOp() == EOpInitialize);
+
+    const TVariable &variable = initNode->getLeft()->getAsSymbolNode()->variable();
+    if (!canBeReplaced(variable))
+    {
+        return true;
+    }
+
+    TIntermTyped *value = initNode->getRight();
+    if (value->getAsSymbolNode() != nullptr)
+    {
+        // The initializer may be a variable that's replaced itself.
+        auto iter = mReplacements.find(value->getAsSymbolNode()->uniqueId().get());
+        if (iter != mReplacements.end())
+        {
+            value = iter->second;
+        }
+    }
+
+    if (value->getAsConstantUnion() != nullptr ||
+        (value->getAsSymbolNode() != nullptr &&
+         canBeCopied(value->getAsSymbolNode()->variable(), variable)))
+    {
+        mReplacements[variable.uniqueId().get()] = value;
+    }
+    return true;
+}
+
+void PropagateConstantsAndCopiesTraverser::visitSymbol(TIntermSymbol *node)
+{
+    auto iter = mReplacements.find(node->uniqueId().get());
+    if (iter == mReplacements.end())
+    {
+        return;
+    }
+
+    // Keep the declaration. RemoveUnreferencedVariables will remove it once it's unreferenced.
+    TIntermBinary *parentBinary = getParentNode()->getAsBinaryNode();
+    if (parentBinary != nullptr && parentBinary->getOp() == EOpInitialize &&
+        parentBinary->getLeft() == node)
+    {
+        return;
+    }
+
+    TIntermTyped *replacement = nullptr;
+    if (iter->second->getAsConstantUnion() != nullptr)
+    {
+        // A constant whose precision matters to the operation would be hoisted back into a
+        // variable by RecordConstantPrecision, once for each use.
+        if (node->getPrecision() >= EbpMedium &&
+            OperandAffectsParentOperationPrecision(getParentNode(), node))
+        {
+            return;
+        }
+
+        // The constant keeps the precision of the variable.
+        TType constantType(node->getType());
+        constantType.setQualifier(EvqConst);
+        replacement = new TIntermConstantUnion(iter->second->getConstantValue(), constantType);
+    }
+    else
+    {
+        replacement = new TIntermSymbol(&iter->second->getAsSymbolNode()->variable());
+    }
+    replacement->setLine(node->getLine());
+    queueReplacement(replacement, OriginalNode::IS_DROPPED);
+}
+
+}  // anonymous namespace
+
+void PropagateConstantsAndCopies(TIntermBlock *root, TSymbolTable *symbolTable)
+{
+    VariableAccessCountMap accessCounts;
+    CountVariableAccesses(root, symbolTable, &accessCounts);
+
+    CountDeclaredNamesTraverser declaredNames;
+    root->traverse(&declaredNames);
+
+    PropagateConstantsAndCopiesTraverser traverser(accessCounts, declaredNames, symbolTable);
+    root->traverse(&traverser);
+    traverser.updateTree();
+}
+
+}  // namespace sh
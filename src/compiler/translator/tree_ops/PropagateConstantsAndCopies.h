@@ -0,0 +1,23 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PropagateConstantsAndCopies.h: Replace references to local variables that are never assigned
+// after being initialized with a constant or with another such variable by the constant or the
+// other variable. The declarations that become unreferenced are left for
+// RemoveUnreferencedVariables to prune.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_PROPAGATECONSTANTSANDCOPIES_H_
+#define COMPILER_TRANSLATOR_TREEOPS_PROPAGATECONSTANTSANDCOPIES_H_
+
+namespace sh
+{
+class TIntermBlock;
+class TSymbolTable;
+
+void PropagateConstantsAndCopies(TIntermBlock *root, TSymbolTable *symbolTable);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_PROPAGATECONSTANTSANDCOPIES_H_
@@ -38,8 +38,6 @@ class RecordConstantPrecisionTraverser : public TIntermTraverser
     bool foundHigherPrecisionConstant() const { return mFoundHigherPrecisionConstant; }
 
   protected:
-    bool operandAffectsParentOperationPrecision(TIntermTyped *operand);
-
     bool mFoundHigherPrecisionConstant;
 };
 
@@ -47,14 +45,16 @@ RecordConstantPrecisionTraverser::RecordConstantPrecisionTraverser(TSymbolTable
     : TIntermTraverser(true, false, true, symbolTable), mFoundHigherPrecisionConstant(false)
 {}
 
-bool RecordConstantPrecisionTraverser::operandAffectsParentOperationPrecision(TIntermTyped *operand)
+}  // namespace
+
+bool OperandAffectsParentOperationPrecision(TIntermNode *parent, TIntermTyped *operand)
 {
-    if (getParentNode()->getAsCaseNode() || getParentNode()->getAsBlock())
+    if (parent->getAsCaseNode() || parent->getAsBlock())
     {
         return false;
     }
 
-    const TIntermBinary *parentAsBinary = getParentNode()->getAsBinaryNode();
+    const TIntermBinary *parentAsBinary = parent->getAsBinaryNode();
     if (parentAsBinary != nullptr)
     {
         // If the constant is assigned or is used to initialize a variable, or if it's an index,
@@ -86,7 +86,7 @@ bool RecordConstantPrecisionTraverser::operandAffectsParentOperationPrecision(TI
         }
     }
 
-    TIntermAggregate *parentAsAggregate = getParentNode()->getAsAggregate();
+    TIntermAggregate *parentAsAggregate = parent->getAsAggregate();
     if (parentAsAggregate != nullptr)
     {
         if (!parentAsAggregate->gotPrecisionFromChildren())
@@ -132,7 +132,7 @@ void RecordConstantPrecisionTraverser::visitConstantUnion(TIntermConstantUnion *
 
     // It's possible the node has no effect on the precision of the consuming expression, depending
     // on the consuming expression, and the precision of the other parameters of the expression.
-    if (!operandAffectsParentOperationPrecision(node))
+    if (!OperandAffectsParentOperationPrecision(getParentNode(), node))
         return;
 
     // Make the constant a precision-qualified named variable to make sure it affects the precision
@@ -149,8 +149,6 @@ void RecordConstantPrecisionTraverser::nextIteration()
     mFoundHigherPrecisionConstant = false;
 }
 
-}  // namespace
-
 void RecordConstantPrecision(TIntermNode *root, TSymbolTable *symbolTable)
 {
     RecordConstantPrecisionTraverser traverser(symbolTable);
@@ -20,9 +20,14 @@
 namespace sh
 {
 class TIntermNode;
+class TIntermTyped;
 class TSymbolTable;
 
 void RecordConstantPrecision(TIntermNode *root, TSymbolTable *symbolTable);
+
+// Returns true if the precision of |operand| may raise the precision of the operation |parent|
+// performs with it. RecordConstantPrecision hoists the constants used this way.
+bool OperandAffectsParentOperationPrecision(TIntermNode *parent, TIntermTyped *operand);
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_TREEOPS_RECORDCONSTANTPRECISION_H_
@@ -0,0 +1,128 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// RemoveDeadCode.cpp: Remove code that has no effect on the output of the shader:
+//   1. Statements after a return, break, continue or discard in the same block.
+//   2. The branch of an if statement with a constant condition that is not taken. The taken branch
+//      is kept as a block, so that the scope of the variables declared in it doesn't change.
+//   3. Assignments to local variables that are never read. If the assigned value has side
+//      effects, the assignment is replaced with the value.
+//
+
+#include "compiler/translator/tree_ops/RemoveDeadCode.h"
+
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_util/CountVariableAccesses.h"
+#include "compiler/translator/tree_util/IntermNode_util.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+class RemoveDeadCodeTraverser : public TIntermTraverser
+{
+  public:
+    RemoveDeadCodeTraverser(const VariableAccessCountMap &accessCounts, TSymbolTable *symbolTable)
+        : TIntermTraverser(true, false, false, symbolTable), mAccessCounts(accessCounts)
+    {}
+
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+
+  private:
+    void removeStatement(TIntermNode *statement)
+    {
+        TIntermSequence emptyReplacement;
+        mMultiReplacements.push_back(NodeReplaceWithMultipleEntry(
+            getParentNode()->getAsBlock(), statement, emptyReplacement));
+    }
+
+    const VariableAccessCountMap &mAccessCounts;
+};
+
+bool RemoveDeadCodeTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    // Statements after a branch in a switch statement may be reached through a case label.
+    if (getParentNode() != nullptr && getParentNode()->getAsSwitchNode() != nullptr)
+    {
+        return true;
+    }
+
+    TIntermSequence *statements = node->getSequence();
+    for (auto iter = statements->begin(); iter != statements->end(); ++iter)
+    {
+        if ((*iter)->getAsBranchNode() != nullptr)
+        {
+            statements->erase(iter + 1, statements->end());
+            break;
+        }
+    }
+    return true;
+}
+
+bool RemoveDeadCodeTraverser::visitIfElse(Visit visit, TIntermIfElse *node)
+{
+    TIntermConstantUnion *condition = node->getCondition()->getAsConstantUnion();
+    if (condition == nullptr)
+    {
+        return true;
+    }
+
+    ASSERT(getParentNode()->getAsBlock());
+    TIntermBlock *takenBlock =
+        condition->getBConst(0) ? node->getTrueBlock() : node->getFalseBlock();
+    if (takenBlock == nullptr)
+    {
+        removeStatement(node);
+        return false;
+    }
+
+    queueReplacement(takenBlock, OriginalNode::IS_DROPPED);
+    takenBlock->traverse(this);
+    return false;
+}
+
+bool RemoveDeadCodeTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    if (node->getOp() != EOpAssign || getParentNode()->getAsBlock() == nullptr)
+    {
+        return true;
+    }
+
+    TIntermSymbol *assigned = node->getLeft()->getAsSymbolNode();
+    if (assigned == nullptr || assigned->getType().getQualifier() != EvqTemporary ||
+        GetVariableAccessCount(mAccessCounts, assigned->variable()).reads != 0u)
+    {
+        return true;
+    }
+
+    if (IsPureExpression(node->getRight()))
+    {
+        removeStatement(node);
+    }
+    else
+    {
+        queueReplacement(node->getRight(), OriginalNode::IS_DROPPED);
+    }
+    return false;
+}
+
+}  // anonymous namespace
+
+void RemoveDeadCode(TIntermBlock *root, TSymbolTable *symbolTable)
+{
+    VariableAccessCountMap accessCounts;
+    CountVariableAccesses(root, symbolTable, &accessCounts);
+
+    RemoveDeadCodeTraverser traverser(accessCounts, symbolTable);
+    root->traverse(&traverser);
+    traverser.updateTree();
+}
+
+}  // namespace sh
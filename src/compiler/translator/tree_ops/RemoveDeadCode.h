@@ -0,0 +1,24 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// RemoveDeadCode.h: Remove code that has no effect on the output of the shader:
+//   1. Statements after a return, break, continue or discard in the same block.
+//   2. The branch of an if statement with a constant condition that is not taken.
+//   3. Assignments to local variables that are never read.
+// The declarations that become unreferenced are left for RemoveUnreferencedVariables to prune.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_REMOVEDEADCODE_H_
+#define COMPILER_TRANSLATOR_TREEOPS_REMOVEDEADCODE_H_
+
+namespace sh
+{
+class TIntermBlock;
+class TSymbolTable;
+
+void RemoveDeadCode(TIntermBlock *root, TSymbolTable *symbolTable);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_REMOVEDEADCODE_H_
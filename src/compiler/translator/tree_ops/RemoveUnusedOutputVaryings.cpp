@@ -0,0 +1,224 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// RemoveUnusedOutputVaryings.cpp: Turn the output varyings that the next shader stage doesn't read
+// into private global variables, and remove the assignments to them that have no other effect.
+// The declarations and computations that become unreferenced are left for
+// RemoveUnreferencedVariables to prune.
+//
+
+#include "compiler/translator/tree_ops/RemoveUnusedOutputVaryings.h"
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_util/IntermNode_util.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/util.h"
+
+namespace sh
+{
+
+namespace
+{
+
+using VariableReplacementMap = std::unordered_map<const TVariable *, const TVariable *>;
+
+// Returns the symbol of the variable that the l-value |node| writes to, or nullptr if it isn't a
+// plain variable, or an element, field or swizzle of one.
+TIntermSymbol *GetAssignedSymbol(TIntermTyped *node)
+{
+    while (node->getAsSymbolNode() == nullptr)
+    {
+        if (TIntermSwizzle *swizzle = node->getAsSwizzleNode())
+        {
+            node = swizzle->getOperand();
+            continue;
+        }
+
+        TIntermBinary *binary = node->getAsBinaryNode();
+        if (binary == nullptr)
+        {
+            return nullptr;
+        }
+        node = binary->getLeft();
+    }
+    return node->getAsSymbolNode();
+}
+
+// Finds the variables in |outputs| that are read anywhere, meaning referenced other than as the
+// variable written by a plain assignment, or in a declaration.
+class FindReadOutputsTraverser : public TIntermTraverser
+{
+  public:
+    FindReadOutputsTraverser(const VariableReplacementMap &outputs)
+        : TIntermTraverser(true, false, false), mOutputs(outputs)
+    {}
+
+    void visitSymbol(TIntermSymbol *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+
+    const std::unordered_set<const TVariable *> &getReadOutputs() const { return mReadOutputs; }
+
+  private:
+    const VariableReplacementMap &mOutputs;
+    std::unordered_set<const TIntermSymbol *> mAssignedSymbols;
+    std::unordered_set<const TVariable *> mReadOutputs;
+};
+
+void FindReadOutputsTraverser::visitSymbol(TIntermSymbol *node)
+{
+    TIntermNode *parent = getParentNode();
+    if (mOutputs.count(&node->variable()) == 0 || mAssignedSymbols.count(node) != 0 ||
+        parent->getAsDeclarationNode() != nullptr ||
+        parent->getAsInvariantDeclarationNode() != nullptr)
+    {
+        return;
+    }
+    mReadOutputs.insert(&node->variable());
+}
+
+bool FindReadOutputsTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    if (node->getOp() == EOpAssign)
+    {
+        // Symbols used in the indices are still visited, and count as reads.
+        TIntermSymbol *assigned = GetAssignedSymbol(node->getLeft());
+        if (assigned != nullptr)
+        {
+            mAssignedSymbols.insert(assigned);
+        }
+    }
+    return true;
+}
+
+class RemoveUnusedOutputVaryingsTraverser : public TIntermTraverser
+{
+  public:
+    RemoveUnusedOutputVaryingsTraverser(const VariableReplacementMap &replacements,
+                                        const std::unordered_set<const TVariable *> &unread)
+        : TIntermTraverser(true, false, false), mReplacements(replacements), mUnread(unread)
+    {}
+
+    void visitSymbol(TIntermSymbol *node) override;
+    bool visitInvariantDeclaration(Visit visit, TIntermInvariantDeclaration *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+
+  private:
+    void removeStatement(TIntermNode *statement)
+    {
+        TIntermSequence emptyReplacement;
+        mMultiReplacements.push_back(NodeReplaceWithMultipleEntry(
+            getParentNode()->getAsBlock(), statement, emptyReplacement));
+    }
+
+    const VariableReplacementMap &mReplacements;
+    const std::unordered_set<const TVariable *> &mUnread;
+};
+
+void RemoveUnusedOutputVaryingsTraverser::visitSymbol(TIntermSymbol *node)
+{
+    auto replacement = mReplacements.find(&node->variable());
+    if (replacement != mReplacements.end())
+    {
+        queueReplacement(new TIntermSymbol(replacement->second), OriginalNode::IS_DROPPED);
+    }
+}
+
+bool RemoveUnusedOutputVaryingsTraverser::visitInvariantDeclaration(
+    Visit visit,
+    TIntermInvariantDeclaration *node)
+{
+    // Private variables can't be invariant.
+    if (mReplacements.count(&node->getSymbol()->variable()) != 0)
+    {
+        removeStatement(node);
+    }
+    return false;
+}
+
+bool RemoveUnusedOutputVaryingsTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    if (node->getOp() != EOpAssign || getParentNode()->getAsBlock() == nullptr)
+    {
+        return true;
+    }
+
+    // The value written to a varying that is never read back is lost, so the assignment can go
+    // unless computing the value or the indices has side effects.
+    TIntermSymbol *assigned = GetAssignedSymbol(node->getLeft());
+    if (assigned == nullptr || mUnread.count(&assigned->variable()) == 0 ||
+        !IsPureExpression(node->getLeft()) || !IsPureExpression(node->getRight()))
+    {
+        return true;
+    }
+
+    removeStatement(node);
+    return false;
+}
+
+}  // anonymous namespace
+
+void RemoveUnusedOutputVaryings(TIntermBlock *root,
+                                TSymbolTable *symbolTable,
+                                const std::vector<std::string> &unusedOutputs)
+{
+    const std::set<std::string> unusedNames(unusedOutputs.begin(), unusedOutputs.end());
+
+    // Output varyings can only be declared at the global scope.
+    VariableReplacementMap replacements;
+    for (TIntermNode *statement : *root->getSequence())
+    {
+        TIntermDeclaration *declaration = statement->getAsDeclarationNode();
+        if (declaration == nullptr)
+        {
+            continue;
+        }
+
+        for (TIntermNode *declarator : *declaration->getSequence())
+        {
+            TIntermSymbol *symbol = declarator->getAsSymbolNode();
+            if (symbol == nullptr || symbol->variable().symbolType() != SymbolType::UserDefined ||
+                !IsVaryingOut(symbol->getType().getQualifier()) ||
+                unusedNames.count(symbol->getName().data()) == 0)
+            {
+                continue;
+            }
+
+            TType *privateType = new TType(symbol->getType());
+            privateType->setQualifier(EvqGlobal);
+            privateType->setInvariant(false);
+            privateType->setLayoutQualifier(TLayoutQualifier::Create());
+
+            replacements[&symbol->variable()] = new TVariable(
+                symbolTable, symbol->variable().name(), privateType, SymbolType::UserDefined);
+        }
+    }
+
+    if (replacements.empty())
+    {
+        return;
+    }
+
+    FindReadOutputsTraverser findReads(replacements);
+    root->traverse(&findReads);
+
+    std::unordered_set<const TVariable *> unread;
+    for (const auto &replacement : replacements)
+    {
+        if (findReads.getReadOutputs().count(replacement.first) == 0)
+        {
+            unread.insert(replacement.first);
+        }
+    }
+
+    RemoveUnusedOutputVaryingsTraverser traverser(replacements, unread);
+    root->traverse(&traverser);
+    traverser.updateTree();
+}
+
+}  // namespace sh
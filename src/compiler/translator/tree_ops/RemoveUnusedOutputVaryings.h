@@ -0,0 +1,31 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// RemoveUnusedOutputVaryings.h: Turn the output varyings that the next shader stage doesn't read
+// into private global variables, and remove the assignments to them that have no other effect.
+// The declarations and computations that become unreferenced are left for
+// RemoveUnreferencedVariables to prune.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_REMOVEUNUSEDOUTPUTVARYINGS_H_
+#define COMPILER_TRANSLATOR_TREEOPS_REMOVEUNUSEDOUTPUTVARYINGS_H_
+
+#include <string>
+#include <vector>
+
+namespace sh
+{
+class TIntermBlock;
+class TSymbolTable;
+
+// |unusedOutputs| has the names of the varyings as they are declared in the shader. Built-in and
+// internal varyings are never removed. Writes to a removed varying are only dropped if the shader
+// doesn't read it back.
+void RemoveUnusedOutputVaryings(TIntermBlock *root,
+                                TSymbolTable *symbolTable,
+                                const std::vector<std::string> &unusedOutputs);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_REMOVEUNUSEDOUTPUTVARYINGS_H_
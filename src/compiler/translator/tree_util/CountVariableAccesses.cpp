@@ -0,0 +1,75 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CountVariableAccesses.cpp:
+//     Utility for counting how many times each variable is read and written in an AST subtree.
+
+#include "compiler/translator/tree_util/CountVariableAccesses.h"
+
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+class CountVariableAccessesTraverser : public TLValueTrackingTraverser
+{
+  public:
+    CountVariableAccessesTraverser(TSymbolTable *symbolTable, VariableAccessCountMap *counts)
+        : TLValueTrackingTraverser(true, false, false, symbolTable), mCounts(counts)
+    {}
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        TIntermNode *parent = getParentNode();
+        if (parent != nullptr && parent->getAsDeclarationNode() != nullptr)
+        {
+            // A declaration without an initializer.
+            return;
+        }
+
+        TIntermBinary *parentBinary = parent != nullptr ? parent->getAsBinaryNode() : nullptr;
+        bool isWholeLeftHandSide    = parentBinary != nullptr && parentBinary->getLeft() == node;
+        if (isWholeLeftHandSide && parentBinary->getOp() == EOpInitialize)
+        {
+            return;
+        }
+
+        VariableAccessCount &count = (*mCounts)[node->uniqueId().get()];
+        if (isLValueRequiredHere())
+        {
+            ++count.writes;
+        }
+        if (!isWholeLeftHandSide || parentBinary->getOp() != EOpAssign)
+        {
+            ++count.reads;
+        }
+    }
+
+  private:
+    VariableAccessCountMap *mCounts;
+};
+
+}  // anonymous namespace
+
+void CountVariableAccesses(TIntermNode *node,
+                           TSymbolTable *symbolTable,
+                           VariableAccessCountMap *countsOut)
+{
+    CountVariableAccessesTraverser traverser(symbolTable, countsOut);
+    node->traverse(&traverser);
+}
+
+VariableAccessCount GetVariableAccessCount(const VariableAccessCountMap &counts,
+                                           const TVariable &variable)
+{
+    auto iter = counts.find(variable.uniqueId().get());
+    return iter != counts.end() ? iter->second : VariableAccessCount();
+}
+
+}  // namespace sh
@@ -0,0 +1,48 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CountVariableAccesses.h:
+//     Utility for counting how many times each variable is read and written in an AST subtree.
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_COUNTVARIABLEACCESSES_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_COUNTVARIABLEACCESSES_H_
+
+#include <unordered_map>
+
+namespace sh
+{
+
+class TIntermNode;
+class TSymbolTable;
+class TVariable;
+
+struct VariableAccessCount
+{
+    VariableAccessCount() : reads(0u), writes(0u) {}
+
+    unsigned int reads;
+    unsigned int writes;
+};
+
+// Keyed by the unique id of the variable.
+using VariableAccessCountMap = std::unordered_map<int, VariableAccessCount>;
+
+// Every reference to a variable in |node| that needs to be an l-value counts as a write, and every
+// other reference counts as a read, except that:
+//   1. The variable being declared is not counted, so a variable with no writes keeps the value of
+//      its initializer for as long as it is in scope.
+//   2. A variable that is the whole left-hand side of a plain assignment is not read.
+// Note that a compound assignment like "x += y" both reads and writes x.
+void CountVariableAccesses(TIntermNode *node,
+                           TSymbolTable *symbolTable,
+                           VariableAccessCountMap *countsOut);
+
+// Returns the access counts of |variable|, which are zero if it's not in |counts|.
+VariableAccessCount GetVariableAccessCount(const VariableAccessCountMap &counts,
+                                           const TVariable &variable);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_COUNTVARIABLEACCESSES_H_
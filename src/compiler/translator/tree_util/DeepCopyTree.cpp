@@ -0,0 +1,212 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeepCopyTree.cpp:
+//     Utilities for copying a whole AST, statements included, into the current pool.
+
+#include "compiler/translator/tree_util/DeepCopyTree.h"
+
+#include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+TIntermNode *CopyNode(TIntermNode *node);
+
+TIntermTyped *CopyTyped(TIntermTyped *node)
+{
+    // Expression nodes copy their children themselves.
+    return node != nullptr ? node->deepCopy() : nullptr;
+}
+
+TIntermBlock *CopyBlock(TIntermBlock *block)
+{
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+
+    TIntermBlock *copy = new TIntermBlock();
+    copy->getSequence()->reserve(block->getSequence()->size());
+    for (TIntermNode *statement : *block->getSequence())
+    {
+        copy->getSequence()->push_back(CopyNode(statement));
+    }
+    copy->setLine(block->getLine());
+    return copy;
+}
+
+TIntermFunctionPrototype *CopyFunctionPrototype(TIntermFunctionPrototype *prototype)
+{
+    TIntermFunctionPrototype *copy = new TIntermFunctionPrototype(prototype->getFunction());
+    copy->setLine(prototype->getLine());
+    return copy;
+}
+
+TIntermNode *CopyStatement(TIntermNode *node)
+{
+    if (TIntermDeclaration *declaration = node->getAsDeclarationNode())
+    {
+        TIntermDeclaration *copy = new TIntermDeclaration();
+        for (TIntermNode *declarator : *declaration->getSequence())
+        {
+            copy->getSequence()->push_back(CopyTyped(declarator->getAsTyped()));
+        }
+        return copy;
+    }
+    if (TIntermFunctionDefinition *definition = node->getAsFunctionDefinition())
+    {
+        TIntermFunctionPrototype *prototype =
+            CopyFunctionPrototype(definition->getFunctionPrototype());
+        return new TIntermFunctionDefinition(prototype, CopyBlock(definition->getBody()));
+    }
+    if (TIntermIfElse *ifElse = node->getAsIfElseNode())
+    {
+        return new TIntermIfElse(CopyTyped(ifElse->getCondition()),
+                                 CopyBlock(ifElse->getTrueBlock()),
+                                 CopyBlock(ifElse->getFalseBlock()));
+    }
+    if (TIntermLoop *loop = node->getAsLoopNode())
+    {
+        return new TIntermLoop(loop->getType(), CopyNode(loop->getInit()),
+                               CopyTyped(loop->getCondition()), CopyTyped(loop->getExpression()),
+                               CopyBlock(loop->getBody()));
+    }
+    if (TIntermBranch *branch = node->getAsBranchNode())
+    {
+        return new TIntermBranch(branch->getFlowOp(), CopyTyped(branch->getExpression()));
+    }
+    if (TIntermSwitch *switchNode = node->getAsSwitchNode())
+    {
+        return new TIntermSwitch(CopyTyped(switchNode->getInit()),
+                                 CopyBlock(switchNode->getStatementList()));
+    }
+    if (TIntermCase *caseNode = node->getAsCaseNode())
+    {
+        return new TIntermCase(CopyTyped(caseNode->getCondition()));
+    }
+    if (TIntermInvariantDeclaration *invariant = node->getAsInvariantDeclarationNode())
+    {
+        TIntermSymbol *symbol = CopyTyped(invariant->getSymbol())->getAsSymbolNode();
+        return new TIntermInvariantDeclaration(symbol, invariant->getLine());
+    }
+    if (TIntermPreprocessorDirective *directive = node->getAsPreprocessorDirective())
+    {
+        return new TIntermPreprocessorDirective(directive->getDirective(),
+                                                directive->getCommand());
+    }
+    UNREACHABLE();
+    return nullptr;
+}
+
+TIntermNode *CopyNode(TIntermNode *node)
+{
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+    if (TIntermBlock *block = node->getAsBlock())
+    {
+        return CopyBlock(block);
+    }
+    if (TIntermFunctionPrototype *prototype = node->getAsFunctionPrototypeNode())
+    {
+        return CopyFunctionPrototype(prototype);
+    }
+    if (TIntermTyped *typed = node->getAsTyped())
+    {
+        return CopyTyped(typed);
+    }
+
+    TIntermNode *copy = CopyStatement(node);
+    copy->setLine(node->getLine());
+    return copy;
+}
+
+class PrepareTypesTraverser : public TIntermTraverser
+{
+  public:
+    PrepareTypesTraverser() : TIntermTraverser(true, false, false) {}
+
+    void visitSymbol(TIntermSymbol *node) override { prepareType(node->getType()); }
+    void visitConstantUnion(TIntermConstantUnion *node) override { prepareType(node->getType()); }
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        prepareType(node->getType());
+        return true;
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        prepareType(node->getType());
+        return true;
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        prepareType(node->getType());
+        return true;
+    }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        prepareType(node->getType());
+        return true;
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        prepareType(node->getType());
+        if (node->getFunction() != nullptr)
+        {
+            prepareFunction(*node->getFunction());
+        }
+        return true;
+    }
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override
+    {
+        prepareFunction(*node->getFunction());
+    }
+
+  private:
+    static void prepareType(const TType &type)
+    {
+        // The mangled name of a struct or interface block includes the mangled names of all its
+        // fields.
+        type.getMangledName();
+        type.getObjectSize();
+        type.getDeepestStructNesting();
+    }
+
+    static void prepareFunction(const TFunction &function)
+    {
+        // Built-in functions don't compute anything on demand.
+        if (function.symbolType() == SymbolType::BuiltIn)
+        {
+            return;
+        }
+        function.getFunctionMangledName();
+        prepareType(function.getReturnType());
+        for (size_t paramIndex = 0; paramIndex < function.getParamCount(); ++paramIndex)
+        {
+            prepareType(function.getParam(paramIndex)->getType());
+        }
+    }
+};
+
+}  // anonymous namespace
+
+TIntermBlock *DeepCopyTree(TIntermBlock *root)
+{
+    return CopyBlock(root);
+}
+
+void PrepareTreeForSharing(TIntermBlock *root)
+{
+    PrepareTypesTraverser traverser;
+    root->traverse(&traverser);
+}
+
+}  // namespace sh
@@ -0,0 +1,29 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeepCopyTree.h:
+//     Utilities for copying a whole AST, statements included, into the current pool.
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_DEEPCOPYTREE_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_DEEPCOPYTREE_H_
+
+namespace sh
+{
+
+class TIntermBlock;
+
+// The copy gets new nodes and types, but refers to the same variables, functions, structs and
+// interface blocks as |root|.
+TIntermBlock *DeepCopyTree(TIntermBlock *root);
+
+// Types compute some of their data on demand, allocating it from the current pool. Computes all of
+// it for the types of the nodes in |root| and for the symbols they refer to, so that the copies of
+// |root| may use another pool that is freed before the pool of |root|, and so that |root| may be
+// read from several threads at once.
+void PrepareTreeForSharing(TIntermBlock *root);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_DEEPCOPYTREE_H_
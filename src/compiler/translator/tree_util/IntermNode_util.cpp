@@ -254,4 +254,62 @@ TIntermTyped *CreateBuiltInFunctionCallNode(const char *name,
     return TIntermAggregate::CreateBuiltInFunctionCall(*fn, arguments);
 }
 
+bool IsPureExpression(TIntermTyped *node)
+{
+    if (node->getAsConstantUnion() != nullptr)
+    {
+        return true;
+    }
+    if (node->getAsSymbolNode() != nullptr)
+    {
+        // Other invocations may write to buffer and shared variables at any time.
+        TQualifier qualifier = node->getType().getQualifier();
+        return qualifier != EvqBuffer && qualifier != EvqShared;
+    }
+    if (node->getAsSwizzleNode() != nullptr)
+    {
+        return IsPureExpression(node->getAsSwizzleNode()->getOperand());
+    }
+    if (node->getAsBinaryNode() != nullptr)
+    {
+        TIntermBinary *binary = node->getAsBinaryNode();
+        return !binary->isAssignment() && IsPureExpression(binary->getLeft()) &&
+               IsPureExpression(binary->getRight());
+    }
+    if (node->getAsUnaryNode() != nullptr)
+    {
+        TIntermUnary *unary       = node->getAsUnaryNode();
+        const TFunction *function = unary->getFunction();
+        return !unary->isAssignment() &&
+               (function == nullptr || function->isKnownToNotHaveSideEffects()) &&
+               IsPureExpression(unary->getOperand());
+    }
+    if (node->getAsTernaryNode() != nullptr)
+    {
+        TIntermTernary *ternary = node->getAsTernaryNode();
+        return IsPureExpression(ternary->getCondition()) &&
+               IsPureExpression(ternary->getTrueExpression()) &&
+               IsPureExpression(ternary->getFalseExpression());
+    }
+    if (node->getAsAggregate() != nullptr)
+    {
+        TIntermAggregate *aggregate = node->getAsAggregate();
+        const TFunction *function   = aggregate->getFunction();
+        if (!aggregate->isConstructor() &&
+            (function == nullptr || !function->isKnownToNotHaveSideEffects()))
+        {
+            return false;
+        }
+        for (TIntermNode *arg : *aggregate->getSequence())
+        {
+            if (!IsPureExpression(arg->getAsTyped()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
 }  // namespace sh
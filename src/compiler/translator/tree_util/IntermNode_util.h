@@ -63,6 +63,12 @@ TIntermTyped *CreateBuiltInFunctionCallNode(const char *name,
                                             const TSymbolTable &symbolTable,
                                             int shaderVersion);
 
+// Returns true if evaluating |node| has no side effects and always gives the same result as long
+// as the variables it reads are not written. Unlike TIntermTyped::hasSideEffects(), this knows
+// that most built-in operations are pure, but assumes that buffer and shared variables can change
+// at any time.
+bool IsPureExpression(TIntermTyped *node);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_INTERMNODEUTIL_H_
\ No newline at end of file
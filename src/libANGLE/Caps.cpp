@@ -1325,6 +1325,9 @@ Caps GenerateMinimumCaps(const Version &clientVersion, const Extensions &extensi
 
     return caps;
 }
+
+ContextCaps::ContextCaps()  = default;
+ContextCaps::~ContextCaps() = default;
 }  // namespace gl
 
 namespace egl
@@ -1378,7 +1381,8 @@ DisplayExtensions::DisplayExtensions()
       blobCache(false),
       imageNativeBuffer(false),
       getFrameTimestamps(false),
-      recordable(false)
+      recordable(false),
+      imageDmaBufImportEXT(false)
 {}
 
 std::vector<std::string> DisplayExtensions::getStrings() const
@@ -1432,6 +1436,7 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_ANDROID_image_native_buffer",                     imageNativeBuffer,                  &extensionStrings);
     InsertExtensionString("EGL_ANDROID_get_frame_timestamps",                    getFrameTimestamps,                 &extensionStrings);
     InsertExtensionString("EGL_ANDROID_recordable",                              recordable,                 &extensionStrings);
+    InsertExtensionString("EGL_EXT_image_dma_buf_import",                        imageDmaBufImportEXT,               &extensionStrings);
     // TODO(jmadill): Enable this when complete.
     //InsertExtensionString("KHR_create_context_no_error",                       createContextNoError,               &extensionStrings);
     // clang-format on
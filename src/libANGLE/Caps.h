@@ -692,6 +692,21 @@ struct Caps
 };
 
 Caps GenerateMinimumCaps(const Version &clientVersion, const Extensions &extensions);
+
+// The caps of a context after they've been adjusted for its client version and creation
+// attributes. These only depend on the display and the attributes, so they are computed once and
+// shared by every context created with the same ones.
+struct ContextCaps final : angle::NonCopyable
+{
+    ContextCaps();
+    ~ContextCaps();
+
+    Caps caps;
+    TextureCapsMap textureCaps;
+    Extensions supportedExtensions;
+    Extensions extensions;
+    Limitations limitations;
+};
 }  // namespace gl
 
 namespace egl
@@ -849,6 +864,9 @@ struct DisplayExtensions
 
     // EGL_ANDROID_recordable
     bool recordable;
+
+    // EGL_EXT_image_dma_buf_import
+    bool imageDmaBufImportEXT;
 };
 
 struct DeviceExtensions
@@ -17,6 +17,9 @@ namespace gl
 // The binary cache is currently left disable by default, and the application can enable it.
 const size_t kDefaultMaxProgramCacheMemoryBytes = 0;
 
+// The results of compiling shaders are cached in memory while the program cache is enabled.
+const size_t kMaxShaderCacheMemoryBytes = 4 * 1024 * 1024;
+
 enum
 {
     // Implementation upper limits, real maximums depend on the hardware
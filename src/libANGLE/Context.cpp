@@ -416,12 +416,6 @@ void Context::initialize()
         bindBufferRange(BufferBinding::Uniform, i, 0, 0, -1);
     }
 
-    // Initialize GLES1 renderer if appropriate.
-    if (getClientVersion() < Version(2, 0))
-    {
-        mGLES1Renderer.reset(new GLES1Renderer());
-    }
-
     // Initialize dirty bit masks
     mAllDirtyBits.set();
 
@@ -3069,8 +3063,16 @@ void Context::requestExtension(const char *name)
         return;
     }
 
-    mState.mExtensions.*(extension.ExtensionsMember) = true;
-    updateCaps();
+    // The caps may be shared with other contexts, so give this one its own copy to modify.
+    auto contextCaps                 = std::make_shared<ContextCaps>();
+    contextCaps->caps                = mState.mCaps;
+    contextCaps->supportedExtensions = mSupportedExtensions;
+    contextCaps->extensions          = mState.mExtensions;
+    contextCaps->limitations         = mState.mLimitations;
+
+    contextCaps->extensions.*(extension.ExtensionsMember) = true;
+    generateTextureCaps(contextCaps.get());
+    setCaps(contextCaps);
     initExtensionStrings();
 
     // Release the shader compiler so it will be re-created with the requested extensions enabled.
@@ -3224,83 +3226,85 @@ Extensions Context::generateSupportedExtensions() const
     return supportedExtensions;
 }
 
-void Context::initCaps()
+void Context::generateCaps(ContextCaps *contextCaps) const
 {
-    mState.mCaps = mImplementation->getNativeCaps();
+    Caps &caps = contextCaps->caps;
+    caps       = mImplementation->getNativeCaps();
 
-    mSupportedExtensions = generateSupportedExtensions();
-    mState.mExtensions   = mSupportedExtensions;
+    contextCaps->supportedExtensions = generateSupportedExtensions();
+    contextCaps->extensions          = contextCaps->supportedExtensions;
 
-    mState.mLimitations = mImplementation->getNativeLimitations();
+    contextCaps->limitations = mImplementation->getNativeLimitations();
 
     // GLES1 emulation: Initialize caps (Table 6.20 / 6.22 in the ES 1.1 spec)
     if (getClientVersion() < Version(2, 0))
     {
-        mState.mCaps.maxMultitextureUnits          = 4;
-        mState.mCaps.maxClipPlanes                 = 6;
-        mState.mCaps.maxLights                     = 8;
-        mState.mCaps.maxModelviewMatrixStackDepth  = Caps::GlobalMatrixStackDepth;
-        mState.mCaps.maxProjectionMatrixStackDepth = Caps::GlobalMatrixStackDepth;
-        mState.mCaps.maxTextureMatrixStackDepth    = Caps::GlobalMatrixStackDepth;
-        mState.mCaps.minSmoothPointSize            = 1.0f;
-        mState.mCaps.maxSmoothPointSize            = 1.0f;
-        mState.mCaps.minSmoothLineWidth            = 1.0f;
-        mState.mCaps.maxSmoothLineWidth            = 1.0f;
+        caps.maxMultitextureUnits          = 4;
+        caps.maxClipPlanes                 = 6;
+        caps.maxLights                     = 8;
+        caps.maxModelviewMatrixStackDepth  = Caps::GlobalMatrixStackDepth;
+        caps.maxProjectionMatrixStackDepth = Caps::GlobalMatrixStackDepth;
+        caps.maxTextureMatrixStackDepth    = Caps::GlobalMatrixStackDepth;
+        caps.minSmoothPointSize            = 1.0f;
+        caps.maxSmoothPointSize            = 1.0f;
+        caps.minSmoothLineWidth            = 1.0f;
+        caps.maxSmoothLineWidth            = 1.0f;
     }
 
     // Apply/Verify implementation limits
-    LimitCap(&mState.mCaps.maxVertexAttributes, MAX_VERTEX_ATTRIBS);
+    LimitCap(&caps.maxVertexAttributes, MAX_VERTEX_ATTRIBS);
 
-    ASSERT(mState.mCaps.minAliasedPointSize >= 1.0f);
+    ASSERT(caps.minAliasedPointSize >= 1.0f);
 
     if (getClientVersion() < ES_3_1)
     {
-        mState.mCaps.maxVertexAttribBindings = mState.mCaps.maxVertexAttributes;
+        caps.maxVertexAttribBindings = caps.maxVertexAttributes;
     }
     else
     {
-        LimitCap(&mState.mCaps.maxVertexAttribBindings, MAX_VERTEX_ATTRIB_BINDINGS);
+        LimitCap(&caps.maxVertexAttribBindings, MAX_VERTEX_ATTRIB_BINDINGS);
     }
 
-    LimitCap(&mState.mCaps.maxShaderUniformBlocks[ShaderType::Vertex],
+    LimitCap(&caps.maxShaderUniformBlocks[ShaderType::Vertex],
              IMPLEMENTATION_MAX_VERTEX_SHADER_UNIFORM_BUFFERS);
-    LimitCap(&mState.mCaps.maxUniformBufferBindings, IMPLEMENTATION_MAX_UNIFORM_BUFFER_BINDINGS);
+    LimitCap(&caps.maxUniformBufferBindings, IMPLEMENTATION_MAX_UNIFORM_BUFFER_BINDINGS);
 
-    LimitCap(&mState.mCaps.maxVertexOutputComponents, IMPLEMENTATION_MAX_VARYING_VECTORS * 4);
-    LimitCap(&mState.mCaps.maxFragmentInputComponents, IMPLEMENTATION_MAX_VARYING_VECTORS * 4);
+    LimitCap(&caps.maxVertexOutputComponents, IMPLEMENTATION_MAX_VARYING_VECTORS * 4);
+    LimitCap(&caps.maxFragmentInputComponents, IMPLEMENTATION_MAX_VARYING_VECTORS * 4);
 
     // Limit textures as well, so we can use fast bitsets with texture bindings.
-    LimitCap(&mState.mCaps.maxCombinedTextureImageUnits, IMPLEMENTATION_MAX_ACTIVE_TEXTURES);
-    LimitCap(&mState.mCaps.maxShaderTextureImageUnits[ShaderType::Vertex],
+    LimitCap(&caps.maxCombinedTextureImageUnits, IMPLEMENTATION_MAX_ACTIVE_TEXTURES);
+    LimitCap(&caps.maxShaderTextureImageUnits[ShaderType::Vertex],
              IMPLEMENTATION_MAX_ACTIVE_TEXTURES / 2);
-    LimitCap(&mState.mCaps.maxShaderTextureImageUnits[ShaderType::Fragment],
+    LimitCap(&caps.maxShaderTextureImageUnits[ShaderType::Fragment],
              IMPLEMENTATION_MAX_ACTIVE_TEXTURES / 2);
 
-    LimitCap(&mState.mCaps.maxImageUnits, IMPLEMENTATION_MAX_IMAGE_UNITS);
+    LimitCap(&caps.maxImageUnits, IMPLEMENTATION_MAX_IMAGE_UNITS);
 
-    mState.mCaps.maxSampleMaskWords =
-        std::min<GLuint>(mState.mCaps.maxSampleMaskWords, MAX_SAMPLE_MASK_WORDS);
+    caps.maxSampleMaskWords = std::min<GLuint>(caps.maxSampleMaskWords, MAX_SAMPLE_MASK_WORDS);
 
     // WebGL compatibility
-    mState.mExtensions.webglCompatibility = mWebGLContext;
+    contextCaps->extensions.webglCompatibility = mWebGLContext;
     for (const auto &extensionInfo : GetExtensionInfoMap())
     {
         // If the user has requested that extensions start disabled and they are requestable,
         // disable them.
         if (!mExtensionsEnabled && extensionInfo.second.Requestable)
         {
-            mState.mExtensions.*(extensionInfo.second.ExtensionsMember) = false;
+            contextCaps->extensions.*(extensionInfo.second.ExtensionsMember) = false;
         }
     }
 
     // Generate texture caps
-    updateCaps();
+    generateTextureCaps(contextCaps);
 }
 
-void Context::updateCaps()
+void Context::generateTextureCaps(ContextCaps *contextCaps) const
 {
-    mState.mCaps.compressedTextureFormats.clear();
-    mState.mTextureCaps.clear();
+    Caps &caps                   = contextCaps->caps;
+    const Extensions &extensions = contextCaps->extensions;
+    caps.compressedTextureFormats.clear();
+    contextCaps->textureCaps.clear();
 
     for (GLenum sizedInternalFormat : GetAllSizedInternalFormats())
     {
@@ -3310,21 +3314,21 @@ void Context::updateCaps()
         // Update the format caps based on the client version and extensions.
         // Caps are AND'd with the renderer caps because some core formats are still unsupported in
         // ES3.
-        formatCaps.texturable = formatCaps.texturable &&
-                                formatInfo.textureSupport(getClientVersion(), mState.mExtensions);
-        formatCaps.filterable = formatCaps.filterable &&
-                                formatInfo.filterSupport(getClientVersion(), mState.mExtensions);
+        formatCaps.texturable =
+            formatCaps.texturable && formatInfo.textureSupport(getClientVersion(), extensions);
+        formatCaps.filterable =
+            formatCaps.filterable && formatInfo.filterSupport(getClientVersion(), extensions);
         formatCaps.textureAttachment =
             formatCaps.textureAttachment &&
-            formatInfo.textureAttachmentSupport(getClientVersion(), mState.mExtensions);
+            formatInfo.textureAttachmentSupport(getClientVersion(), extensions);
         formatCaps.renderbuffer =
             formatCaps.renderbuffer &&
-            formatInfo.renderbufferSupport(getClientVersion(), mState.mExtensions);
+            formatInfo.renderbufferSupport(getClientVersion(), extensions);
 
         // OpenGL ES does not support multisampling with non-rendererable formats
         // OpenGL ES 3.0 or prior does not support multisampling with integer formats
         if (!formatCaps.renderbuffer ||
-            (getClientVersion() < ES_3_1 && !mSupportedExtensions.textureMultisample &&
+            (getClientVersion() < ES_3_1 && !contextCaps->supportedExtensions.textureMultisample &&
              (formatInfo.componentType == GL_INT || formatInfo.componentType == GL_UNSIGNED_INT)))
         {
             formatCaps.sampleCounts.clear();
@@ -3342,11 +3346,11 @@ void Context::updateCaps()
                 formatInfo.isRequiredRenderbufferFormat(getClientVersion()))
             {
                 ASSERT(getClientVersion() < ES_3_0 || formatMaxSamples >= 4);
-                mState.mCaps.maxSamples = std::min(mState.mCaps.maxSamples, formatMaxSamples);
+                caps.maxSamples = std::min(caps.maxSamples, formatMaxSamples);
             }
 
             // Handle GLES 3.1 MAX_*_SAMPLES values similarly to MAX_SAMPLES.
-            if (getClientVersion() >= ES_3_1 || mSupportedExtensions.textureMultisample)
+            if (getClientVersion() >= ES_3_1 || contextCaps->supportedExtensions.textureMultisample)
             {
                 // GLES 3.1 section 9.2.5: "Implementations must support creation of renderbuffers
                 // in these required formats with up to the value of MAX_SAMPLES multisamples, with
@@ -3356,8 +3360,7 @@ void Context::updateCaps()
                 if (formatInfo.componentType == GL_INT ||
                     formatInfo.componentType == GL_UNSIGNED_INT)
                 {
-                    mState.mCaps.maxIntegerSamples =
-                        std::min(mState.mCaps.maxIntegerSamples, formatMaxSamples);
+                    caps.maxIntegerSamples = std::min(caps.maxIntegerSamples, formatMaxSamples);
                 }
 
                 // GLES 3.1 section 19.3.1.
@@ -3365,13 +3368,13 @@ void Context::updateCaps()
                 {
                     if (formatInfo.depthBits > 0)
                     {
-                        mState.mCaps.maxDepthTextureSamples =
-                            std::min(mState.mCaps.maxDepthTextureSamples, formatMaxSamples);
+                        caps.maxDepthTextureSamples =
+                            std::min(caps.maxDepthTextureSamples, formatMaxSamples);
                     }
                     else if (formatInfo.redBits > 0)
                     {
-                        mState.mCaps.maxColorTextureSamples =
-                            std::min(mState.mCaps.maxColorTextureSamples, formatMaxSamples);
+                        caps.maxColorTextureSamples =
+                            std::min(caps.maxColorTextureSamples, formatMaxSamples);
                     }
                 }
             }
@@ -3379,12 +3382,53 @@ void Context::updateCaps()
 
         if (formatCaps.texturable && formatInfo.compressed)
         {
-            mState.mCaps.compressedTextureFormats.push_back(sizedInternalFormat);
+            caps.compressedTextureFormats.push_back(sizedInternalFormat);
         }
 
-        mState.mTextureCaps.insert(sizedInternalFormat, formatCaps);
+        contextCaps->textureCaps.insert(sizedInternalFormat, formatCaps);
+    }
+}
+
+void Context::initCaps()
+{
+    // The generated caps only depend on the display's native caps and these attributes, so
+    // contexts that share them can share the caps.
+    const Version &clientVersion = getClientVersion();
+    uint32_t key                 = clientVersion.major << 12 | clientVersion.minor << 8;
+    key |= (mSkipValidation ? 1u : 0u) << 0;
+    key |= (mState.isRobustResourceInitEnabled() ? 1u : 0u) << 1;
+    key |= (mRobustAccess ? 1u : 0u) << 2;
+    key |= (mWebGLContext ? 1u : 0u) << 3;
+    key |= (mExtensionsEnabled ? 1u : 0u) << 4;
+
+    std::shared_ptr<const ContextCaps> contextCaps = mCurrentDisplay->getCachedContextCaps(key);
+    if (!contextCaps)
+    {
+        auto generatedCaps = std::make_shared<ContextCaps>();
+        generateCaps(generatedCaps.get());
+        mCurrentDisplay->cacheContextCaps(key, generatedCaps);
+        contextCaps = std::move(generatedCaps);
     }
 
+    setCaps(contextCaps);
+}
+
+void Context::setCaps(const std::shared_ptr<const ContextCaps> &contextCaps)
+{
+    // Alias the shared texture caps rather than copying them.
+    mState.mTextureCaps =
+        std::shared_ptr<const TextureCapsMap>(contextCaps, &contextCaps->textureCaps);
+
+    mState.mCaps         = contextCaps->caps;
+    mState.mExtensions   = contextCaps->extensions;
+    mState.mLimitations  = contextCaps->limitations;
+    mSupportedExtensions = contextCaps->supportedExtensions;
+
+    updateCaps();
+}
+
+void Context::updateCaps()
+{
     // If program binary is disabled, blank out the memory cache pointer.
     if (!mSupportedExtensions.getProgramBinary)
     {
@@ -5297,35 +5341,7 @@ void Context::multiDrawArrays(PrimitiveMode mode,
                               GLsizei drawcount)
 {
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
-    Program *programObject = mState.getLinkedProgram(this);
-    const bool hasDrawID   = programObject && programObject->hasDrawIDUniform();
-    if (hasDrawID)
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDraw(mode, counts[drawID]))
-            {
-                continue;
-            }
-            programObject->setDrawIDUniform(drawID);
-            ANGLE_CONTEXT_TRY(
-                mImplementation->drawArrays(this, mode, firsts[drawID], counts[drawID]));
-            MarkTransformFeedbackBufferUsage(this, counts[drawID], 1);
-        }
-    }
-    else
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDraw(mode, counts[drawID]))
-            {
-                continue;
-            }
-            ANGLE_CONTEXT_TRY(
-                mImplementation->drawArrays(this, mode, firsts[drawID], counts[drawID]));
-            MarkTransformFeedbackBufferUsage(this, counts[drawID], 1);
-        }
-    }
+    ANGLE_CONTEXT_TRY(mImplementation->multiDrawArrays(this, mode, firsts, counts, drawcount));
 }
 
 void Context::multiDrawArraysInstanced(PrimitiveMode mode,
@@ -5335,35 +5351,8 @@ void Context::multiDrawArraysInstanced(PrimitiveMode mode,
                                        GLsizei drawcount)
 {
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
-    Program *programObject = mState.getLinkedProgram(this);
-    const bool hasDrawID   = programObject && programObject->hasDrawIDUniform();
-    if (hasDrawID)
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDrawInstanced(mode, counts[drawID], instanceCounts[drawID]))
-            {
-                continue;
-            }
-            programObject->setDrawIDUniform(drawID);
-            ANGLE_CONTEXT_TRY(mImplementation->drawArraysInstanced(
-                this, mode, firsts[drawID], counts[drawID], instanceCounts[drawID]));
-            MarkTransformFeedbackBufferUsage(this, counts[drawID], instanceCounts[drawID]);
-        }
-    }
-    else
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDrawInstanced(mode, counts[drawID], instanceCounts[drawID]))
-            {
-                continue;
-            }
-            ANGLE_CONTEXT_TRY(mImplementation->drawArraysInstanced(
-                this, mode, firsts[drawID], counts[drawID], instanceCounts[drawID]));
-            MarkTransformFeedbackBufferUsage(this, counts[drawID], instanceCounts[drawID]);
-        }
-    }
+    ANGLE_CONTEXT_TRY(mImplementation->multiDrawArraysInstanced(this, mode, firsts, counts,
+                                                                instanceCounts, drawcount));
 }
 
 void Context::multiDrawElements(PrimitiveMode mode,
@@ -5373,33 +5362,8 @@ void Context::multiDrawElements(PrimitiveMode mode,
                                 GLsizei drawcount)
 {
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
-    Program *programObject = mState.getLinkedProgram(this);
-    const bool hasDrawID   = programObject && programObject->hasDrawIDUniform();
-    if (hasDrawID)
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDraw(mode, counts[drawID]))
-            {
-                continue;
-            }
-            programObject->setDrawIDUniform(drawID);
-            ANGLE_CONTEXT_TRY(
-                mImplementation->drawElements(this, mode, counts[drawID], type, indices[drawID]));
-        }
-    }
-    else
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDraw(mode, counts[drawID]))
-            {
-                continue;
-            }
-            ANGLE_CONTEXT_TRY(
-                mImplementation->drawElements(this, mode, counts[drawID], type, indices[drawID]));
-        }
-    }
+    ANGLE_CONTEXT_TRY(
+        mImplementation->multiDrawElements(this, mode, counts, type, indices, drawcount));
 }
 
 void Context::multiDrawElementsInstanced(PrimitiveMode mode,
@@ -5410,33 +5374,8 @@ void Context::multiDrawElementsInstanced(PrimitiveMode mode,
                                          GLsizei drawcount)
 {
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
-    Program *programObject = mState.getLinkedProgram(this);
-    const bool hasDrawID   = programObject && programObject->hasDrawIDUniform();
-    if (hasDrawID)
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDrawInstanced(mode, counts[drawID], instanceCounts[drawID]))
-            {
-                continue;
-            }
-            programObject->setDrawIDUniform(drawID);
-            ANGLE_CONTEXT_TRY(mImplementation->drawElementsInstanced(
-                this, mode, counts[drawID], type, indices[drawID], instanceCounts[drawID]));
-        }
-    }
-    else
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDrawInstanced(mode, counts[drawID], instanceCounts[drawID]))
-            {
-                continue;
-            }
-            ANGLE_CONTEXT_TRY(mImplementation->drawElementsInstanced(
-                this, mode, counts[drawID], type, indices[drawID], instanceCounts[drawID]));
-        }
-    }
+    ANGLE_CONTEXT_TRY(mImplementation->multiDrawElementsInstanced(this, mode, counts, type, indices,
+                                                                  instanceCounts, drawcount));
 }
 
 void Context::provokingVertex(ProvokingVertex provokeMode)
@@ -6641,7 +6580,7 @@ void Context::getInternalformativ(GLenum target,
                                   GLsizei bufSize,
                                   GLint *params)
 {
-    const TextureCaps &formatCaps = mState.mTextureCaps.get(internalformat);
+    const TextureCaps &formatCaps = mState.getTextureCap(internalformat);
     QueryInternalFormativ(formatCaps, pname, bufSize, params);
 }
 
@@ -7978,6 +7917,18 @@ bool Context::isGLES1() const
     return mState.getClientVersion() < Version(2, 0);
 }
 
+GLES1Renderer *Context::getGLES1Renderer()
+{
+    // The emulation is set up on the first GLES1 draw rather than with the context, since many
+    // GLES1 contexts never draw.
+    ASSERT(isGLES1());
+    if (!mGLES1Renderer)
+    {
+        mGLES1Renderer.reset(new GLES1Renderer());
+    }
+    return mGLES1Renderer.get();
+}
+
 void Context::onSubjectStateChange(const Context *context,
                                    angle::SubjectIndex index,
                                    angle::SubjectMessage message)
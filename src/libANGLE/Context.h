@@ -1748,6 +1748,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     const Limitations &getLimitations() const { return mState.getLimitations(); }
     bool skipValidation() const { return mSkipValidation; }
     bool isGLES1() const;
+    GLES1Renderer *getGLES1Renderer();
 
     // Specific methods needed for validation.
     bool getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *numParams);
@@ -1846,7 +1847,10 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     void initExtensionStrings();
 
     Extensions generateSupportedExtensions() const;
+    void generateCaps(ContextCaps *contextCaps) const;
+    void generateTextureCaps(ContextCaps *contextCaps) const;
     void initCaps();
+    void setCaps(const std::shared_ptr<const ContextCaps> &contextCaps);
     void updateCaps();
     void initWorkarounds();
 
@@ -77,9 +77,9 @@ ANGLE_INLINE angle::Result Context::syncDirtyObjects(const State::DirtyObjects &
 
 ANGLE_INLINE angle::Result Context::prepareForDraw(PrimitiveMode mode)
 {
-    if (mGLES1Renderer)
+    if (mState.getClientMajorVersion() < 2)
     {
-        ANGLE_TRY(mGLES1Renderer->prepareForDraw(mode, this, &mState));
+        ANGLE_TRY(getGLES1Renderer()->prepareForDraw(mode, this, &mState));
     }
 
     ANGLE_TRY(syncDirtyObjects(mDrawDirtyObjects));
@@ -625,6 +625,7 @@ Error Display::terminate(const Thread *thread)
     }
 
     mConfigSet.clear();
+    mContextCapsCache.clear();
 
     if (mDevice != nullptr && mDevice->getOwningDisplay() != nullptr)
     {
@@ -917,6 +918,9 @@ Error Display::restoreLostDevice()
         }
     }
 
+    // The restored device may not have the same caps.
+    mContextCapsCache.clear();
+
     return mImplementation->restoreLostDevice(this);
 }
 
@@ -1302,6 +1306,17 @@ gl::Version Display::getMaxSupportedESVersion() const
     return mImplementation->getMaxSupportedESVersion();
 }
 
+std::shared_ptr<const gl::ContextCaps> Display::getCachedContextCaps(uint32_t key) const
+{
+    auto iter = mContextCapsCache.find(key);
+    return iter != mContextCapsCache.end() ? iter->second : nullptr;
+}
+
+void Display::cacheContextCaps(uint32_t key, const std::shared_ptr<const gl::ContextCaps> &caps)
+{
+    mContextCapsCache[key] = caps;
+}
+
 EGLint Display::programCacheGetAttrib(EGLenum attrib) const
 {
     switch (attrib)
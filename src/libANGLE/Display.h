@@ -11,6 +11,8 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -186,6 +188,11 @@ class Display final : public LabeledObject, angle::NonCopyable
     typedef std::set<gl::Context *> ContextSet;
     const ContextSet &getContextSet() { return mContextSet; }
 
+    // Caps computed by the first context made current with a given client version and set of
+    // creation attributes, reused by the contexts created with the same ones after it.
+    std::shared_ptr<const gl::ContextCaps> getCachedContextCaps(uint32_t key) const;
+    void cacheContextCaps(uint32_t key, const std::shared_ptr<const gl::ContextCaps> &caps);
+
   private:
     Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDevice);
 
@@ -206,6 +213,8 @@ class Display final : public LabeledObject, angle::NonCopyable
 
     ContextSet mContextSet;
 
+    std::map<uint32_t, std::shared_ptr<const gl::ContextCaps>> mContextCapsCache;
+
     typedef std::set<Image *> ImageSet;
     ImageSet mImageSet;
 
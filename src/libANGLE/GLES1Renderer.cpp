@@ -13,6 +13,7 @@
 #include <sstream>
 #include <vector>
 
+#include "common/hash_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Context.inl.h"
 #include "libANGLE/Program.h"
@@ -24,12 +25,65 @@
 namespace
 {
 #include "libANGLE/GLES1Shaders.inc"
+
+void AddBoolDefine(std::ostream &out, const char *name, bool value)
+{
+    out << "#define " << name << " " << (value ? "true" : "false") << "\n";
+}
+
+void AddEnumDefine(std::ostream &out, const char *name, GLenum value)
+{
+    out << "#define " << name << " " << value << "\n";
+}
+
+template <size_t N>
+void AddBoolArrayDefine(std::ostream &out, const char *name, const std::array<bool, N> &values)
+{
+    out << "#define " << name << " bool[" << N << "](";
+    for (size_t i = 0; i < N; i++)
+    {
+        out << (i > 0 ? ", " : "") << (values[i] ? "true" : "false");
+    }
+    out << ")\n";
+}
+
+template <size_t N>
+void AddEnumArrayDefine(std::ostream &out, const char *name, const std::array<GLenum, N> &values)
+{
+    out << "#define " << name << " int[" << N << "](";
+    for (size_t i = 0; i < N; i++)
+    {
+        out << (i > 0 ? ", " : "") << values[i];
+    }
+    out << ")\n";
+}
 }  // anonymous namespace
 
 namespace gl
 {
 
-GLES1Renderer::GLES1Renderer() : mRendererProgramInitialized(false) {}
+GLES1Renderer::GLES1ShaderState::GLES1ShaderState()
+{
+    memset(this, 0, sizeof(GLES1ShaderState));
+}
+
+bool GLES1Renderer::GLES1ShaderState::operator==(const GLES1ShaderState &other) const
+{
+    return memcmp(this, &other, sizeof(GLES1ShaderState)) == 0;
+}
+
+size_t GLES1Renderer::GLES1ShaderStateHash::operator()(const GLES1ShaderState &shaderState) const
+{
+    return angle::ComputeGenericHash(shaderState);
+}
+
+GLES1Renderer::GLES1Renderer()
+    : mRendererProgramInitialized(false),
+      mShaderPrograms(nullptr),
+      mVertexShader(0),
+      mProgramStates(decltype(mProgramStates)::NO_AUTO_EVICT),
+      mProgramState(nullptr)
+{}
 
 void GLES1Renderer::onDestroy(Context *context, State *state)
 {
@@ -37,7 +91,14 @@ void GLES1Renderer::onDestroy(Context *context, State *state)
     {
         (void)state->setProgram(context, 0);
 
-        mShaderPrograms->deleteProgram(context, mProgramState.program);
+        for (const auto &programState : mProgramStates)
+        {
+            mShaderPrograms->deleteProgram(context, programState.second.program);
+        }
+        mProgramStates.Clear();
+        mProgramState = nullptr;
+
+        mShaderPrograms->deleteShader(context, mVertexShader);
         mShaderPrograms->release(context);
         mShaderPrograms             = nullptr;
         mRendererProgramInitialized = false;
@@ -52,75 +113,53 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
 
     GLES1State &gles1State = glState->gles1();
 
-    Program *programObject = getProgram(mProgramState.program);
+    // Only the enables and modes below select the program; switching to another one re-uploads
+    // every uniform, since each program has its own copies.
+    bool programChanged = false;
+    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_TEXTURE_UNIT_ENABLE) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_TEXTURE_ENVIRONMENT) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_LIGHTS) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_FOG) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_ALPHA_TEST) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_CLIP_PLANES))
+    {
+        ANGLE_TRY(bindProgramForShaderState(context, glState, &programChanged));
+    }
 
-    GLES1UniformBuffers &uniformBuffers = mUniformBuffers;
+    if (programChanged)
+    {
+        gles1State.setAllDirty();
+    }
 
-    // If anything is dirty in gles1 or the common parts of gles1/2, just redo these parts
-    // completely for now.
+    Program *programObject = getProgram(mProgramState->program);
+
+    GLES1UniformBuffers &uniformBuffers = mUniformBuffers;
 
     // Feature enables
+    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE))
     {
-        setUniform1i(context, programObject, mProgramState.enableAlphaTestLoc,
-                     glState->getEnableFeature(GL_ALPHA_TEST));
-        setUniform1i(context, programObject, mProgramState.enableLightingLoc,
-                     glState->getEnableFeature(GL_LIGHTING));
-        setUniform1i(context, programObject, mProgramState.enableRescaleNormalLoc,
-                     glState->getEnableFeature(GL_RESCALE_NORMAL));
-        setUniform1i(context, programObject, mProgramState.enableNormalizeLoc,
-                     glState->getEnableFeature(GL_NORMALIZE));
-        setUniform1i(context, programObject, mProgramState.enableColorMaterialLoc,
-                     glState->getEnableFeature(GL_COLOR_MATERIAL));
-        setUniform1i(context, programObject, mProgramState.fogEnableLoc,
-                     glState->getEnableFeature(GL_FOG));
-
-        bool enableClipPlanes = false;
-        for (int i = 0; i < kClipPlaneCount; i++)
-        {
-            uniformBuffers.clipPlaneEnables[i] = glState->getEnableFeature(GL_CLIP_PLANE0 + i);
-            enableClipPlanes = enableClipPlanes || uniformBuffers.clipPlaneEnables[i];
-        }
-
-        setUniform1i(context, programObject, mProgramState.enableClipPlanesLoc, enableClipPlanes);
+        setUniform1i(context, programObject, mProgramState->enableRescaleNormalLoc,
+                     gles1State.mRescaleNormalEnabled);
+        setUniform1i(context, programObject, mProgramState->enableNormalizeLoc,
+                     gles1State.mNormalizeEnabled);
+        setUniform1i(context, programObject, mProgramState->pointSpriteEnabledLoc,
+                     gles1State.mPointSpriteEnabled);
     }
 
-    // Texture unit enables and format info
+    // Texture format info. The bound textures aren't tracked by GLES1State, so compare with what
+    // was last uploaded.
     {
-        std::array<GLint, kTexUnitCount> &tex2DEnables   = uniformBuffers.tex2DEnables;
-        std::array<GLint, kTexUnitCount> &texCubeEnables = uniformBuffers.texCubeEnables;
-
-        std::vector<int> tex2DFormats = {GL_RGBA, GL_RGBA, GL_RGBA, GL_RGBA};
-
-        Vec4Uniform *cropRectBuffer = uniformBuffers.texCropRects.data();
+        std::array<GLint, kTexUnitCount> texFormats = {{GL_RGBA, GL_RGBA, GL_RGBA, GL_RGBA}};
+        std::array<Vec4Uniform, kTexUnitCount> cropRects;
+        memcpy(cropRects.data(), uniformBuffers.texCropRects.data(), sizeof(cropRects));
 
         for (int i = 0; i < kTexUnitCount; i++)
         {
-            // GL_OES_cube_map allows only one of TEXTURE_2D / TEXTURE_CUBE_MAP
-            // to be enabled per unit, thankfully. From the extension text:
-            //
-            //  --  Section 3.8.10 "Texture Application"
-            //
-            //      Replace the beginning sentences of the first paragraph (page 138)
-            //      with:
-            //
-            //      "Texturing is enabled or disabled using the generic Enable
-            //      and Disable commands, respectively, with the symbolic constants
-            //      TEXTURE_2D or TEXTURE_CUBE_MAP_OES to enable the two-dimensional or cube
-            //      map texturing respectively.  If the cube map texture and the two-
-            //      dimensional texture are enabled, then cube map texturing is used.  If
-            //      texturing is disabled, a rasterized fragment is passed on unaltered to the
-            //      next stage of the GL (although its texture coordinates may be discarded).
-            //      Otherwise, a texture value is found according to the parameter values of
-            //      the currently bound texture image of the appropriate dimensionality.
-
-            texCubeEnables[i] = gles1State.isTextureTargetEnabled(i, TextureType::CubeMap);
-            tex2DEnables[i] =
-                !texCubeEnables[i] && (gles1State.isTextureTargetEnabled(i, TextureType::_2D));
-
             Texture *curr2DTexture = glState->getSamplerTexture(i, TextureType::_2D);
             if (curr2DTexture)
             {
-                tex2DFormats[i] = gl::GetUnsizedFormat(
+                texFormats[i] = gl::GetUnsizedFormat(
                     curr2DTexture->getFormat(TextureTarget::_2D, 0).info->internalFormat);
 
                 const gl::Rectangle &cropRect = curr2DTexture->getCrop();
@@ -132,29 +171,35 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
 
                 if (textureWidth > 0.0f && textureHeight > 0.0f)
                 {
-                    cropRectBuffer[i][0] = cropRect.x / textureWidth;
-                    cropRectBuffer[i][1] = cropRect.y / textureHeight;
-                    cropRectBuffer[i][2] = cropRect.width / textureWidth;
-                    cropRectBuffer[i][3] = cropRect.height / textureHeight;
+                    cropRects[i][0] = cropRect.x / textureWidth;
+                    cropRects[i][1] = cropRect.y / textureHeight;
+                    cropRects[i][2] = cropRect.width / textureWidth;
+                    cropRects[i][3] = cropRect.height / textureHeight;
                 }
             }
         }
 
-        setUniform1iv(context, programObject, mProgramState.enableTexture2DLoc, kTexUnitCount,
-                      tex2DEnables.data());
-        setUniform1iv(context, programObject, mProgramState.enableTextureCubeMapLoc, kTexUnitCount,
-                      texCubeEnables.data());
-
-        setUniform1iv(context, programObject, mProgramState.textureFormatLoc, kTexUnitCount,
-                      tex2DFormats.data());
+        if (programChanged || texFormats != uniformBuffers.texFormats)
+        {
+            uniformBuffers.texFormats = texFormats;
+            setUniform1iv(context, programObject, mProgramState->textureFormatLoc, kTexUnitCount,
+                          texFormats.data());
+        }
 
-        setUniform4fv(programObject, mProgramState.drawTextureNormalizedCropRectLoc, kTexUnitCount,
-                      reinterpret_cast<GLfloat *>(cropRectBuffer));
+        if (programChanged ||
+            memcmp(cropRects.data(), uniformBuffers.texCropRects.data(), sizeof(cropRects)) != 0)
+        {
+            memcpy(uniformBuffers.texCropRects.data(), cropRects.data(), sizeof(cropRects));
+            setUniform4fv(programObject, mProgramState->drawTextureNormalizedCropRectLoc,
+                          kTexUnitCount,
+                          reinterpret_cast<GLfloat *>(uniformBuffers.texCropRects.data()));
+        }
     }
 
     // Client state / current vector enables
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_CLIENT_STATE_ENABLE) ||
-        gles1State.isDirty(GLES1State::DIRTY_GLES1_CURRENT_VECTOR))
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_CURRENT_VECTOR) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_POINT_PARAMETERS))
     {
         if (!gles1State.isClientStateEnabled(ClientVertexArrayType::Normal))
         {
@@ -190,14 +235,14 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_MATRICES))
     {
         angle::Mat4 proj = gles1State.mProjectionMatrices.back();
-        setUniformMatrix4fv(programObject, mProgramState.projMatrixLoc, 1, GL_FALSE, proj.data());
+        setUniformMatrix4fv(programObject, mProgramState->projMatrixLoc, 1, GL_FALSE, proj.data());
 
         angle::Mat4 modelview = gles1State.mModelviewMatrices.back();
-        setUniformMatrix4fv(programObject, mProgramState.modelviewMatrixLoc, 1, GL_FALSE,
+        setUniformMatrix4fv(programObject, mProgramState->modelviewMatrixLoc, 1, GL_FALSE,
                             modelview.data());
 
         angle::Mat4 modelviewInvTr = modelview.transpose().inverse();
-        setUniformMatrix4fv(programObject, mProgramState.modelviewInvTrLoc, 1, GL_FALSE,
+        setUniformMatrix4fv(programObject, mProgramState->modelviewInvTrLoc, 1, GL_FALSE,
                             modelviewInvTr.data());
 
         Mat4Uniform *textureMatrixBuffer = uniformBuffers.textureMatrices.data();
@@ -208,7 +253,7 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
             memcpy(textureMatrixBuffer + i, textureMatrix.data(), sizeof(Mat4Uniform));
         }
 
-        setUniformMatrix4fv(programObject, mProgramState.textureMatrixLoc, kTexUnitCount, GL_FALSE,
+        setUniformMatrix4fv(programObject, mProgramState->textureMatrixLoc, kTexUnitCount, GL_FALSE,
                             reinterpret_cast<float *>(uniformBuffers.textureMatrices.data()));
     }
 
@@ -216,9 +261,8 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     {
         for (int i = 0; i < kTexUnitCount; i++)
         {
-            const auto &env = gles1State.textureEnvironment(i);
+            const auto &env = gles1State.mTextureEnvironments[i];
 
-            uniformBuffers.texEnvModes[i]      = ToGLenum(env.mode);
             uniformBuffers.texCombineRgbs[i]   = ToGLenum(env.combineRgb);
             uniformBuffers.texCombineAlphas[i] = ToGLenum(env.combineAlpha);
 
@@ -247,62 +291,58 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
             uniformBuffers.pointSpriteCoordReplaces[i] = env.pointSpriteCoordReplace;
         }
 
-        setUniform1iv(context, programObject, mProgramState.textureEnvModeLoc, kTexUnitCount,
-                      uniformBuffers.texEnvModes.data());
-        setUniform1iv(context, programObject, mProgramState.combineRgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->combineRgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineRgbs.data());
-        setUniform1iv(context, programObject, mProgramState.combineAlphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->combineAlphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineAlphas.data());
 
-        setUniform1iv(context, programObject, mProgramState.src0rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->src0rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc0Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src0alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->src0alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc0Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.src1rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->src1rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc1Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src1alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->src1alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc1Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.src2rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->src2rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc2Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.src2alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->src2alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineSrc2Alphas.data());
 
-        setUniform1iv(context, programObject, mProgramState.op0rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->op0rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp0Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op0alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->op0alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp0Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.op1rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->op1rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp1Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op1alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->op1alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp1Alphas.data());
-        setUniform1iv(context, programObject, mProgramState.op2rgbLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->op2rgbLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp2Rgbs.data());
-        setUniform1iv(context, programObject, mProgramState.op2alphaLoc, kTexUnitCount,
+        setUniform1iv(context, programObject, mProgramState->op2alphaLoc, kTexUnitCount,
                       uniformBuffers.texCombineOp2Alphas.data());
 
-        setUniform4fv(programObject, mProgramState.textureEnvColorLoc, kTexUnitCount,
+        setUniform4fv(programObject, mProgramState->textureEnvColorLoc, kTexUnitCount,
                       reinterpret_cast<float *>(uniformBuffers.texEnvColors.data()));
-        setUniform1fv(programObject, mProgramState.rgbScaleLoc, kTexUnitCount,
+        setUniform1fv(programObject, mProgramState->rgbScaleLoc, kTexUnitCount,
                       uniformBuffers.texEnvRgbScales.data());
-        setUniform1fv(programObject, mProgramState.alphaScaleLoc, kTexUnitCount,
+        setUniform1fv(programObject, mProgramState->alphaScaleLoc, kTexUnitCount,
                       uniformBuffers.texEnvAlphaScales.data());
 
-        setUniform1iv(context, programObject, mProgramState.pointSpriteCoordReplaceLoc,
+        setUniform1iv(context, programObject, mProgramState->pointSpriteCoordReplaceLoc,
                       kTexUnitCount, uniformBuffers.pointSpriteCoordReplaces.data());
     }
 
     // Alpha test
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_ALPHA_TEST))
     {
-        setUniform1i(context, programObject, mProgramState.alphaFuncLoc,
-                     ToGLenum(gles1State.mAlphaTestFunc));
-        setUniform1f(programObject, mProgramState.alphaTestRefLoc, gles1State.mAlphaTestRef);
+        setUniform1f(programObject, mProgramState->alphaTestRefLoc, gles1State.mAlphaTestRef);
     }
 
     // Shading, materials, and lighting
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_SHADE_MODEL))
     {
-        setUniform1i(context, programObject, mProgramState.shadeModelFlatLoc,
+        setUniform1i(context, programObject, mProgramState->shadeModelFlatLoc,
                      gles1State.mShadeModel == ShadingModel::Flat);
     }
 
@@ -310,13 +350,13 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     {
         const auto &material = gles1State.mMaterial;
 
-        setUniform4fv(programObject, mProgramState.materialAmbientLoc, 1, material.ambient.data());
-        setUniform4fv(programObject, mProgramState.materialDiffuseLoc, 1, material.diffuse.data());
-        setUniform4fv(programObject, mProgramState.materialSpecularLoc, 1,
+        setUniform4fv(programObject, mProgramState->materialAmbientLoc, 1, material.ambient.data());
+        setUniform4fv(programObject, mProgramState->materialDiffuseLoc, 1, material.diffuse.data());
+        setUniform4fv(programObject, mProgramState->materialSpecularLoc, 1,
                       material.specular.data());
-        setUniform4fv(programObject, mProgramState.materialEmissiveLoc, 1,
+        setUniform4fv(programObject, mProgramState->materialEmissiveLoc, 1,
                       material.emissive.data());
-        setUniform1f(programObject, mProgramState.materialSpecularExponentLoc,
+        setUniform1f(programObject, mProgramState->materialSpecularExponentLoc,
                      material.specularExponent);
     }
 
@@ -324,16 +364,15 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     {
         const auto &lightModel = gles1State.mLightModel;
 
-        setUniform4fv(programObject, mProgramState.lightModelSceneAmbientLoc, 1,
+        setUniform4fv(programObject, mProgramState->lightModelSceneAmbientLoc, 1,
                       lightModel.color.data());
 
         // TODO (lfy@google.com): Implement two-sided lighting model
-        // gl->uniform1i(mProgramState.lightModelTwoSidedLoc, lightModel.twoSided);
+        // gl->uniform1i(mProgramState->lightModelTwoSidedLoc, lightModel.twoSided);
 
         for (int i = 0; i < kLightCount; i++)
         {
-            const auto &light              = gles1State.mLights[i];
-            uniformBuffers.lightEnables[i] = light.enabled;
+            const auto &light = gles1State.mLights[i];
             memcpy(uniformBuffers.lightAmbients.data() + i, light.ambient.data(),
                    sizeof(Vec4Uniform));
             memcpy(uniformBuffers.lightDiffuses.data() + i, light.diffuse.data(),
@@ -351,79 +390,82 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
             uniformBuffers.attenuationQuadratics[i] = light.attenuationQuadratic;
         }
 
-        setUniform1iv(context, programObject, mProgramState.lightEnablesLoc, kLightCount,
-                      uniformBuffers.lightEnables.data());
-        setUniform4fv(programObject, mProgramState.lightAmbientsLoc, kLightCount,
+        setUniform4fv(programObject, mProgramState->lightAmbientsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightAmbients.data()));
-        setUniform4fv(programObject, mProgramState.lightDiffusesLoc, kLightCount,
+        setUniform4fv(programObject, mProgramState->lightDiffusesLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightDiffuses.data()));
-        setUniform4fv(programObject, mProgramState.lightSpecularsLoc, kLightCount,
+        setUniform4fv(programObject, mProgramState->lightSpecularsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightSpeculars.data()));
-        setUniform4fv(programObject, mProgramState.lightPositionsLoc, kLightCount,
+        setUniform4fv(programObject, mProgramState->lightPositionsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightPositions.data()));
-        setUniform3fv(programObject, mProgramState.lightDirectionsLoc, kLightCount,
+        setUniform3fv(programObject, mProgramState->lightDirectionsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.lightDirections.data()));
-        setUniform1fv(programObject, mProgramState.lightSpotlightExponentsLoc, kLightCount,
+        setUniform1fv(programObject, mProgramState->lightSpotlightExponentsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.spotlightExponents.data()));
-        setUniform1fv(programObject, mProgramState.lightSpotlightCutoffAnglesLoc, kLightCount,
+        setUniform1fv(programObject, mProgramState->lightSpotlightCutoffAnglesLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.spotlightCutoffAngles.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationConstsLoc, kLightCount,
+        setUniform1fv(programObject, mProgramState->lightAttenuationConstsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.attenuationConsts.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationLinearsLoc, kLightCount,
+        setUniform1fv(programObject, mProgramState->lightAttenuationLinearsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.attenuationLinears.data()));
-        setUniform1fv(programObject, mProgramState.lightAttenuationQuadraticsLoc, kLightCount,
+        setUniform1fv(programObject, mProgramState->lightAttenuationQuadraticsLoc, kLightCount,
                       reinterpret_cast<float *>(uniformBuffers.attenuationQuadratics.data()));
     }
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_FOG))
     {
-        const FogParameters &fog = gles1State.fogParameters();
-        setUniform1i(context, programObject, mProgramState.fogModeLoc, ToGLenum(fog.mode));
-        setUniform1f(programObject, mProgramState.fogDensityLoc, fog.density);
-        setUniform1f(programObject, mProgramState.fogStartLoc, fog.start);
-        setUniform1f(programObject, mProgramState.fogEndLoc, fog.end);
-        setUniform4fv(programObject, mProgramState.fogColorLoc, 1, fog.color.data());
+        const FogParameters &fog = gles1State.mFog;
+        setUniform1f(programObject, mProgramState->fogDensityLoc, fog.density);
+        setUniform1f(programObject, mProgramState->fogStartLoc, fog.start);
+        setUniform1f(programObject, mProgramState->fogEndLoc, fog.end);
+        setUniform4fv(programObject, mProgramState->fogColorLoc, 1, fog.color.data());
     }
 
     // Clip planes
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_CLIP_PLANES))
     {
-        bool enableClipPlanes = false;
         for (int i = 0; i < kClipPlaneCount; i++)
         {
-            uniformBuffers.clipPlaneEnables[i] = glState->getEnableFeature(GL_CLIP_PLANE0 + i);
-            enableClipPlanes = enableClipPlanes || uniformBuffers.clipPlaneEnables[i];
             gles1State.getClipPlane(
                 i, reinterpret_cast<float *>(uniformBuffers.clipPlanes.data() + i));
         }
 
-        setUniform1i(context, programObject, mProgramState.enableClipPlanesLoc, enableClipPlanes);
-        setUniform1iv(context, programObject, mProgramState.clipPlaneEnablesLoc, kClipPlaneCount,
-                      uniformBuffers.clipPlaneEnables.data());
-        setUniform4fv(programObject, mProgramState.clipPlanesLoc, kClipPlaneCount,
+        setUniform4fv(programObject, mProgramState->clipPlanesLoc, kClipPlaneCount,
                       reinterpret_cast<float *>(uniformBuffers.clipPlanes.data()));
     }
 
     // Point rasterization
+    GLint pointRasterization = mode == PrimitiveMode::Points;
+    if (programChanged || pointRasterization != uniformBuffers.pointRasterization)
+    {
+        uniformBuffers.pointRasterization = pointRasterization;
+        setUniform1i(context, programObject, mProgramState->pointRasterizationLoc,
+                     pointRasterization);
+    }
+
+    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_POINT_PARAMETERS))
     {
         const PointParameters &pointParams = gles1State.mPointParameters;
 
-        setUniform1i(context, programObject, mProgramState.pointRasterizationLoc,
-                     mode == PrimitiveMode::Points);
-        setUniform1i(context, programObject, mProgramState.pointSpriteEnabledLoc,
-                     glState->getEnableFeature(GL_POINT_SPRITE_OES));
-        setUniform1f(programObject, mProgramState.pointSizeMinLoc, pointParams.pointSizeMin);
-        setUniform1f(programObject, mProgramState.pointSizeMaxLoc, pointParams.pointSizeMax);
-        setUniform3fv(programObject, mProgramState.pointDistanceAttenuationLoc, 1,
+        setUniform1f(programObject, mProgramState->pointSizeMinLoc, pointParams.pointSizeMin);
+        setUniform1f(programObject, mProgramState->pointSizeMaxLoc, pointParams.pointSizeMax);
+        setUniform3fv(programObject, mProgramState->pointDistanceAttenuationLoc, 1,
                       pointParams.pointDistanceAttenuation.data());
     }
 
     // Draw texture
+    GLint drawTextureEnabled = mDrawTextureEnabled ? 1 : 0;
+    if (programChanged || drawTextureEnabled != uniformBuffers.drawTextureEnabled)
     {
-        setUniform1i(context, programObject, mProgramState.enableDrawTextureLoc,
-                     mDrawTextureEnabled ? 1 : 0);
-        setUniform4fv(programObject, mProgramState.drawTextureCoordsLoc, 1, mDrawTextureCoords);
-        setUniform2fv(programObject, mProgramState.drawTextureDimsLoc, 1, mDrawTextureDims);
+        uniformBuffers.drawTextureEnabled = drawTextureEnabled;
+        setUniform1i(context, programObject, mProgramState->enableDrawTextureLoc,
+                     drawTextureEnabled);
+    }
+
+    if (mDrawTextureEnabled)
+    {
+        setUniform4fv(programObject, mProgramState->drawTextureCoordsLoc, 1, mDrawTextureCoords);
+        setUniform2fv(programObject, mProgramState->drawTextureDimsLoc, 1, mDrawTextureDims);
     }
 
     gles1State.clearDirty();
@@ -600,18 +642,174 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
 
     mShaderPrograms = new ShaderProgramManager();
 
-    GLuint vertexShader;
-    GLuint fragmentShader;
+    ANGLE_TRY(compileShader(context, ShaderType::Vertex, kGLES1DrawVShader, &mVertexShader));
+
+    mRendererProgramInitialized = true;
+    return angle::Result::Continue;
+}
 
-    ANGLE_TRY(compileShader(context, ShaderType::Vertex, kGLES1DrawVShader, &vertexShader));
+void GLES1Renderer::updateShaderState(const State &glState, GLES1ShaderState *shaderStateOut) const
+{
+    const GLES1State &gles1State  = glState.gles1();
+    GLES1ShaderState &shaderState = *shaderStateOut;
+
+    shaderState.lightingEnabled = gles1State.mLightingEnabled;
+    if (shaderState.lightingEnabled)
+    {
+        shaderState.colorMaterialEnabled = gles1State.mColorMaterialEnabled;
+        for (int i = 0; i < kLightCount; i++)
+        {
+            shaderState.lightEnables[i] = gles1State.mLights[i].enabled;
+        }
+    }
+
+    shaderState.fogEnabled = gles1State.mFogEnabled;
+    if (shaderState.fogEnabled)
+    {
+        shaderState.fogMode = ToGLenum(gles1State.mFog.mode);
+    }
+
+    shaderState.alphaTestEnabled = gles1State.mAlphaTestEnabled;
+    if (shaderState.alphaTestEnabled)
+    {
+        shaderState.alphaFunc = ToGLenum(gles1State.mAlphaTestFunc);
+    }
+
+    for (int i = 0; i < kClipPlaneCount; i++)
+    {
+        shaderState.clipPlaneEnables[i] = gles1State.mClipPlanes[i].enabled;
+    }
+
+    for (int i = 0; i < kTexUnitCount; i++)
+    {
+        // GL_OES_cube_map allows only one of TEXTURE_2D / TEXTURE_CUBE_MAP
+        // to be enabled per unit, thankfully. From the extension text:
+        //
+        //  --  Section 3.8.10 "Texture Application"
+        //
+        //      Replace the beginning sentences of the first paragraph (page 138)
+        //      with:
+        //
+        //      "Texturing is enabled or disabled using the generic Enable
+        //      and Disable commands, respectively, with the symbolic constants
+        //      TEXTURE_2D or TEXTURE_CUBE_MAP_OES to enable the two-dimensional or cube
+        //      map texturing respectively.  If the cube map texture and the two-
+        //      dimensional texture are enabled, then cube map texturing is used.  If
+        //      texturing is disabled, a rasterized fragment is passed on unaltered to the
+        //      next stage of the GL (although its texture coordinates may be discarded).
+        //      Otherwise, a texture value is found according to the parameter values of
+        //      the currently bound texture image of the appropriate dimensionality.
+
+        shaderState.texCubeEnables[i] = gles1State.isTextureTargetEnabled(i, TextureType::CubeMap);
+        shaderState.tex2DEnables[i] = !shaderState.texCubeEnables[i] &&
+                                      gles1State.isTextureTargetEnabled(i, TextureType::_2D);
+
+        if (shaderState.texCubeEnables[i] || shaderState.tex2DEnables[i])
+        {
+            shaderState.texEnvModes[i] = ToGLenum(gles1State.mTextureEnvironments[i].mode);
+        }
+    }
+}
+
+angle::Result GLES1Renderer::bindProgramForShaderState(Context *context,
+                                                       State *glState,
+                                                       bool *changedOut)
+{
+    GLES1ShaderState shaderState;
+    updateShaderState(*glState, &shaderState);
+
+    if (mProgramState && shaderState == mShaderState)
+    {
+        return angle::Result::Continue;
+    }
+
+    bool newProgram = false;
+    auto iter       = mProgramStates.Get(shaderState);
+    if (iter == mProgramStates.end())
+    {
+        GLES1ProgramState programState;
+        ANGLE_TRY(linkShaderStateProgram(context, glState, shaderState, &programState));
+
+        // The current program was moved to the front when it was bound, so it isn't the one
+        // evicted here.
+        if (mProgramStates.size() >= kMaxPrograms)
+        {
+            auto oldest = mProgramStates.rbegin();
+            mShaderPrograms->deleteProgram(context, oldest->second.program);
+            mProgramStates.Erase(oldest);
+        }
+
+        iter       = mProgramStates.Put(shaderState, programState);
+        newProgram = true;
+    }
+
+    mShaderState  = shaderState;
+    mProgramState = &iter->second;
+    *changedOut   = true;
+
+    Program *programObject = getProgram(mProgramState->program);
+    ANGLE_TRY(glState->setProgram(context, programObject));
+
+    if (newProgram)
+    {
+        for (int i = 0; i < kTexUnitCount; i++)
+        {
+            setUniform1i(context, programObject, mProgramState->tex2DSamplerLocs[i], i);
+            setUniform1i(context, programObject, mProgramState->texCubeSamplerLocs[i],
+                         i + kTexUnitCount);
+        }
+
+        glState->setObjectDirty(GL_PROGRAM);
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::linkShaderStateProgram(Context *context,
+                                                    State *glState,
+                                                    const GLES1ShaderState &shaderState,
+                                                    GLES1ProgramState *programStateOut)
+{
+    GLES1ProgramState &programState = *programStateOut;
+
+    int activeTexUnits = 0;
+    for (int i = 0; i < kTexUnitCount; i++)
+    {
+        if (shaderState.tex2DEnables[i] || shaderState.texCubeEnables[i])
+        {
+            activeTexUnits = i + 1;
+        }
+    }
+
+    bool clipPlanesEnabled = false;
+    for (bool enabled : shaderState.clipPlaneEnables)
+    {
+        clipPlanesEnabled = clipPlanesEnabled || enabled;
+    }
 
     std::stringstream fragmentStream;
-    fragmentStream << kGLES1DrawFShaderHeader;
+    fragmentStream << kGLES1DrawFShaderHeader << "\n\n";
+
+    fragmentStream << "#define kActiveTexUnits " << activeTexUnits << "\n";
+    AddBoolArrayDefine(fragmentStream, "kTexture2DEnables", shaderState.tex2DEnables);
+    AddBoolArrayDefine(fragmentStream, "kTextureCubeMapEnables", shaderState.texCubeEnables);
+    AddEnumArrayDefine(fragmentStream, "kTextureEnvModes", shaderState.texEnvModes);
+    AddBoolDefine(fragmentStream, "kEnableAlphaTest", shaderState.alphaTestEnabled);
+    AddEnumDefine(fragmentStream, "kAlphaFunc", shaderState.alphaFunc);
+    AddBoolDefine(fragmentStream, "kEnableLighting", shaderState.lightingEnabled);
+    AddBoolDefine(fragmentStream, "kEnableColorMaterial", shaderState.colorMaterialEnabled);
+    AddBoolArrayDefine(fragmentStream, "kLightEnables", shaderState.lightEnables);
+    AddBoolDefine(fragmentStream, "kEnableFog", shaderState.fogEnabled);
+    AddEnumDefine(fragmentStream, "kFogMode", shaderState.fogMode);
+    AddBoolDefine(fragmentStream, "kEnableClipPlanes", clipPlanesEnabled);
+    AddBoolArrayDefine(fragmentStream, "kClipPlaneEnables", shaderState.clipPlaneEnables);
+
     fragmentStream << kGLES1DrawFShaderUniformDefs;
     fragmentStream << kGLES1DrawFShaderFunctions;
     fragmentStream << kGLES1DrawFShaderMultitexturing;
     fragmentStream << kGLES1DrawFShaderMain;
 
+    GLuint fragmentShader;
     ANGLE_TRY(compileShader(context, ShaderType::Fragment, fragmentStream.str().c_str(),
                             &fragmentShader));
 
@@ -629,18 +827,17 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
         attribLocs[kTextureCoordAttribIndexBase + i] = ss.str();
     }
 
-    ANGLE_TRY(linkProgram(context, glState, vertexShader, fragmentShader, attribLocs,
-                          &mProgramState.program));
+    ANGLE_TRY(linkProgram(context, glState, mVertexShader, fragmentShader, attribLocs,
+                          &programState.program));
 
-    mShaderPrograms->deleteShader(context, vertexShader);
     mShaderPrograms->deleteShader(context, fragmentShader);
 
-    Program *programObject = getProgram(mProgramState.program);
+    Program *programObject = getProgram(programState.program);
 
-    mProgramState.projMatrixLoc      = programObject->getUniformLocation("projection");
-    mProgramState.modelviewMatrixLoc = programObject->getUniformLocation("modelview");
-    mProgramState.textureMatrixLoc   = programObject->getUniformLocation("texture_matrix");
-    mProgramState.modelviewInvTrLoc  = programObject->getUniformLocation("modelview_invtr");
+    programState.projMatrixLoc      = programObject->getUniformLocation("projection");
+    programState.modelviewMatrixLoc = programObject->getUniformLocation("modelview");
+    programState.textureMatrixLoc   = programObject->getUniformLocation("texture_matrix");
+    programState.modelviewInvTrLoc  = programObject->getUniformLocation("modelview_invtr");
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
@@ -650,114 +847,87 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
         ss2d << "tex_sampler" << i;
         sscube << "tex_cube_sampler" << i;
 
-        mProgramState.tex2DSamplerLocs[i] = programObject->getUniformLocation(ss2d.str().c_str());
-        mProgramState.texCubeSamplerLocs[i] =
+        programState.tex2DSamplerLocs[i] = programObject->getUniformLocation(ss2d.str().c_str());
+        programState.texCubeSamplerLocs[i] =
             programObject->getUniformLocation(sscube.str().c_str());
     }
 
-    mProgramState.enableTexture2DLoc = programObject->getUniformLocation("enable_texture_2d");
-    mProgramState.enableTextureCubeMapLoc =
-        programObject->getUniformLocation("enable_texture_cube_map");
-
-    mProgramState.textureFormatLoc   = programObject->getUniformLocation("texture_format");
-    mProgramState.textureEnvModeLoc  = programObject->getUniformLocation("texture_env_mode");
-    mProgramState.combineRgbLoc      = programObject->getUniformLocation("combine_rgb");
-    mProgramState.combineAlphaLoc    = programObject->getUniformLocation("combine_alpha");
-    mProgramState.src0rgbLoc         = programObject->getUniformLocation("src0_rgb");
-    mProgramState.src0alphaLoc       = programObject->getUniformLocation("src0_alpha");
-    mProgramState.src1rgbLoc         = programObject->getUniformLocation("src1_rgb");
-    mProgramState.src1alphaLoc       = programObject->getUniformLocation("src1_alpha");
-    mProgramState.src2rgbLoc         = programObject->getUniformLocation("src2_rgb");
-    mProgramState.src2alphaLoc       = programObject->getUniformLocation("src2_alpha");
-    mProgramState.op0rgbLoc          = programObject->getUniformLocation("op0_rgb");
-    mProgramState.op0alphaLoc        = programObject->getUniformLocation("op0_alpha");
-    mProgramState.op1rgbLoc          = programObject->getUniformLocation("op1_rgb");
-    mProgramState.op1alphaLoc        = programObject->getUniformLocation("op1_alpha");
-    mProgramState.op2rgbLoc          = programObject->getUniformLocation("op2_rgb");
-    mProgramState.op2alphaLoc        = programObject->getUniformLocation("op2_alpha");
-    mProgramState.textureEnvColorLoc = programObject->getUniformLocation("texture_env_color");
-    mProgramState.rgbScaleLoc        = programObject->getUniformLocation("texture_env_rgb_scale");
-    mProgramState.alphaScaleLoc      = programObject->getUniformLocation("texture_env_alpha_scale");
-    mProgramState.pointSpriteCoordReplaceLoc =
+    programState.textureFormatLoc   = programObject->getUniformLocation("texture_format");
+    programState.combineRgbLoc      = programObject->getUniformLocation("combine_rgb");
+    programState.combineAlphaLoc    = programObject->getUniformLocation("combine_alpha");
+    programState.src0rgbLoc         = programObject->getUniformLocation("src0_rgb");
+    programState.src0alphaLoc       = programObject->getUniformLocation("src0_alpha");
+    programState.src1rgbLoc         = programObject->getUniformLocation("src1_rgb");
+    programState.src1alphaLoc       = programObject->getUniformLocation("src1_alpha");
+    programState.src2rgbLoc         = programObject->getUniformLocation("src2_rgb");
+    programState.src2alphaLoc       = programObject->getUniformLocation("src2_alpha");
+    programState.op0rgbLoc          = programObject->getUniformLocation("op0_rgb");
+    programState.op0alphaLoc        = programObject->getUniformLocation("op0_alpha");
+    programState.op1rgbLoc          = programObject->getUniformLocation("op1_rgb");
+    programState.op1alphaLoc        = programObject->getUniformLocation("op1_alpha");
+    programState.op2rgbLoc          = programObject->getUniformLocation("op2_rgb");
+    programState.op2alphaLoc        = programObject->getUniformLocation("op2_alpha");
+    programState.textureEnvColorLoc = programObject->getUniformLocation("texture_env_color");
+    programState.rgbScaleLoc        = programObject->getUniformLocation("texture_env_rgb_scale");
+    programState.alphaScaleLoc      = programObject->getUniformLocation("texture_env_alpha_scale");
+    programState.pointSpriteCoordReplaceLoc =
         programObject->getUniformLocation("point_sprite_coord_replace");
 
-    mProgramState.enableAlphaTestLoc = programObject->getUniformLocation("enable_alpha_test");
-    mProgramState.alphaFuncLoc       = programObject->getUniformLocation("alpha_func");
-    mProgramState.alphaTestRefLoc    = programObject->getUniformLocation("alpha_test_ref");
+    programState.alphaTestRefLoc = programObject->getUniformLocation("alpha_test_ref");
 
-    mProgramState.shadeModelFlatLoc = programObject->getUniformLocation("shade_model_flat");
-    mProgramState.enableLightingLoc = programObject->getUniformLocation("enable_lighting");
-    mProgramState.enableRescaleNormalLoc =
+    programState.shadeModelFlatLoc = programObject->getUniformLocation("shade_model_flat");
+    programState.enableRescaleNormalLoc =
         programObject->getUniformLocation("enable_rescale_normal");
-    mProgramState.enableNormalizeLoc = programObject->getUniformLocation("enable_normalize");
-    mProgramState.enableColorMaterialLoc =
-        programObject->getUniformLocation("enable_color_material");
-
-    mProgramState.materialAmbientLoc  = programObject->getUniformLocation("material_ambient");
-    mProgramState.materialDiffuseLoc  = programObject->getUniformLocation("material_diffuse");
-    mProgramState.materialSpecularLoc = programObject->getUniformLocation("material_specular");
-    mProgramState.materialEmissiveLoc = programObject->getUniformLocation("material_emissive");
-    mProgramState.materialSpecularExponentLoc =
+    programState.enableNormalizeLoc = programObject->getUniformLocation("enable_normalize");
+
+    programState.materialAmbientLoc  = programObject->getUniformLocation("material_ambient");
+    programState.materialDiffuseLoc  = programObject->getUniformLocation("material_diffuse");
+    programState.materialSpecularLoc = programObject->getUniformLocation("material_specular");
+    programState.materialEmissiveLoc = programObject->getUniformLocation("material_emissive");
+    programState.materialSpecularExponentLoc =
         programObject->getUniformLocation("material_specular_exponent");
 
-    mProgramState.lightModelSceneAmbientLoc =
+    programState.lightModelSceneAmbientLoc =
         programObject->getUniformLocation("light_model_scene_ambient");
-    mProgramState.lightModelTwoSidedLoc =
+    programState.lightModelTwoSidedLoc =
         programObject->getUniformLocation("light_model_two_sided");
 
-    mProgramState.lightEnablesLoc    = programObject->getUniformLocation("light_enables");
-    mProgramState.lightAmbientsLoc   = programObject->getUniformLocation("light_ambients");
-    mProgramState.lightDiffusesLoc   = programObject->getUniformLocation("light_diffuses");
-    mProgramState.lightSpecularsLoc  = programObject->getUniformLocation("light_speculars");
-    mProgramState.lightPositionsLoc  = programObject->getUniformLocation("light_positions");
-    mProgramState.lightDirectionsLoc = programObject->getUniformLocation("light_directions");
-    mProgramState.lightSpotlightExponentsLoc =
+    programState.lightAmbientsLoc   = programObject->getUniformLocation("light_ambients");
+    programState.lightDiffusesLoc   = programObject->getUniformLocation("light_diffuses");
+    programState.lightSpecularsLoc  = programObject->getUniformLocation("light_speculars");
+    programState.lightPositionsLoc  = programObject->getUniformLocation("light_positions");
+    programState.lightDirectionsLoc = programObject->getUniformLocation("light_directions");
+    programState.lightSpotlightExponentsLoc =
         programObject->getUniformLocation("light_spotlight_exponents");
-    mProgramState.lightSpotlightCutoffAnglesLoc =
+    programState.lightSpotlightCutoffAnglesLoc =
         programObject->getUniformLocation("light_spotlight_cutoff_angles");
-    mProgramState.lightAttenuationConstsLoc =
+    programState.lightAttenuationConstsLoc =
         programObject->getUniformLocation("light_attenuation_consts");
-    mProgramState.lightAttenuationLinearsLoc =
+    programState.lightAttenuationLinearsLoc =
         programObject->getUniformLocation("light_attenuation_linears");
-    mProgramState.lightAttenuationQuadraticsLoc =
+    programState.lightAttenuationQuadraticsLoc =
         programObject->getUniformLocation("light_attenuation_quadratics");
 
-    mProgramState.fogEnableLoc  = programObject->getUniformLocation("enable_fog");
-    mProgramState.fogModeLoc    = programObject->getUniformLocation("fog_mode");
-    mProgramState.fogDensityLoc = programObject->getUniformLocation("fog_density");
-    mProgramState.fogStartLoc   = programObject->getUniformLocation("fog_start");
-    mProgramState.fogEndLoc     = programObject->getUniformLocation("fog_end");
-    mProgramState.fogColorLoc   = programObject->getUniformLocation("fog_color");
-
-    mProgramState.enableClipPlanesLoc = programObject->getUniformLocation("enable_clip_planes");
-    mProgramState.clipPlaneEnablesLoc = programObject->getUniformLocation("clip_plane_enables");
-    mProgramState.clipPlanesLoc       = programObject->getUniformLocation("clip_planes");
-
-    mProgramState.pointRasterizationLoc = programObject->getUniformLocation("point_rasterization");
-    mProgramState.pointSizeMinLoc       = programObject->getUniformLocation("point_size_min");
-    mProgramState.pointSizeMaxLoc       = programObject->getUniformLocation("point_size_max");
-    mProgramState.pointDistanceAttenuationLoc =
-        programObject->getUniformLocation("point_distance_attenuation");
-    mProgramState.pointSpriteEnabledLoc = programObject->getUniformLocation("point_sprite_enabled");
-
-    mProgramState.enableDrawTextureLoc = programObject->getUniformLocation("enable_draw_texture");
-    mProgramState.drawTextureCoordsLoc = programObject->getUniformLocation("draw_texture_coords");
-    mProgramState.drawTextureDimsLoc   = programObject->getUniformLocation("draw_texture_dims");
-    mProgramState.drawTextureNormalizedCropRectLoc =
-        programObject->getUniformLocation("draw_texture_normalized_crop_rect");
+    programState.fogDensityLoc = programObject->getUniformLocation("fog_density");
+    programState.fogStartLoc   = programObject->getUniformLocation("fog_start");
+    programState.fogEndLoc     = programObject->getUniformLocation("fog_end");
+    programState.fogColorLoc   = programObject->getUniformLocation("fog_color");
 
-    ANGLE_TRY(glState->setProgram(context, programObject));
+    programState.clipPlanesLoc = programObject->getUniformLocation("clip_planes");
 
-    for (int i = 0; i < kTexUnitCount; i++)
-    {
-        setUniform1i(context, programObject, mProgramState.tex2DSamplerLocs[i], i);
-        setUniform1i(context, programObject, mProgramState.texCubeSamplerLocs[i],
-                     i + kTexUnitCount);
-    }
+    programState.pointRasterizationLoc = programObject->getUniformLocation("point_rasterization");
+    programState.pointSizeMinLoc       = programObject->getUniformLocation("point_size_min");
+    programState.pointSizeMaxLoc       = programObject->getUniformLocation("point_size_max");
+    programState.pointDistanceAttenuationLoc =
+        programObject->getUniformLocation("point_distance_attenuation");
+    programState.pointSpriteEnabledLoc = programObject->getUniformLocation("point_sprite_enabled");
 
-    glState->setObjectDirty(GL_PROGRAM);
+    programState.enableDrawTextureLoc = programObject->getUniformLocation("enable_draw_texture");
+    programState.drawTextureCoordsLoc = programObject->getUniformLocation("draw_texture_coords");
+    programState.drawTextureDimsLoc   = programObject->getUniformLocation("draw_texture_dims");
+    programState.drawTextureNormalizedCropRectLoc =
+        programObject->getUniformLocation("draw_texture_normalized_crop_rect");
 
-    mRendererProgramInitialized = true;
     return angle::Result::Continue;
 }
 
@@ -14,6 +14,8 @@
 #include "common/angleutils.h"
 #include "libANGLE/angletypes.h"
 
+#include <anglebase/containers/mru_cache.h>
+
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -70,6 +72,16 @@ class GLES1Renderer final : angle::NonCopyable
                               GLuint *programOut);
     angle::Result initializeRendererProgram(Context *context, State *glState);
 
+    struct GLES1ProgramState;
+    struct GLES1ShaderState;
+
+    void updateShaderState(const State &glState, GLES1ShaderState *shaderStateOut) const;
+    angle::Result bindProgramForShaderState(Context *context, State *glState, bool *changedOut);
+    angle::Result linkShaderStateProgram(Context *context,
+                                         State *glState,
+                                         const GLES1ShaderState &shaderState,
+                                         GLES1ProgramState *programStateOut);
+
     void setUniform1i(Context *context, Program *programObject, GLint loc, GLint value);
     void setUniform1iv(Context *context,
                        Program *programObject,
@@ -101,6 +113,33 @@ class GLES1Renderer final : angle::NonCopyable
     bool mRendererProgramInitialized;
     ShaderProgramManager *mShaderPrograms;
 
+    // The fixed-function features the fragment shader is specialized on. Everything else, like
+    // the light colors or the combiner sources, is read from uniforms. Disabled features are left
+    // zeroed so that they don't split otherwise identical programs.
+    struct GLES1ShaderState
+    {
+        GLES1ShaderState();
+
+        bool operator==(const GLES1ShaderState &other) const;
+
+        bool lightingEnabled;
+        bool colorMaterialEnabled;
+        bool fogEnabled;
+        bool alphaTestEnabled;
+        std::array<bool, kLightCount> lightEnables;
+        std::array<bool, kClipPlaneCount> clipPlaneEnables;
+        std::array<bool, kTexUnitCount> tex2DEnables;
+        std::array<bool, kTexUnitCount> texCubeEnables;
+        std::array<GLenum, kTexUnitCount> texEnvModes;
+        GLenum fogMode;
+        GLenum alphaFunc;
+    };
+
+    struct GLES1ShaderStateHash
+    {
+        size_t operator()(const GLES1ShaderState &shaderState) const;
+    };
+
     struct GLES1ProgramState
     {
         GLuint program;
@@ -111,14 +150,11 @@ class GLES1Renderer final : angle::NonCopyable
         GLint modelviewInvTrLoc;
 
         // Texturing
-        GLint enableTexture2DLoc;
-        GLint enableTextureCubeMapLoc;
         std::array<GLint, kTexUnitCount> tex2DSamplerLocs;
         std::array<GLint, kTexUnitCount> texCubeSamplerLocs;
 
         GLint textureFormatLoc;
 
-        GLint textureEnvModeLoc;
         GLint combineRgbLoc;
         GLint combineAlphaLoc;
         GLint src0rgbLoc;
@@ -139,16 +175,12 @@ class GLES1Renderer final : angle::NonCopyable
         GLint pointSpriteCoordReplaceLoc;
 
         // Alpha test
-        GLint enableAlphaTestLoc;
-        GLint alphaFuncLoc;
         GLint alphaTestRefLoc;
 
         // Shading, materials, and lighting
         GLint shadeModelFlatLoc;
-        GLint enableLightingLoc;
         GLint enableRescaleNormalLoc;
         GLint enableNormalizeLoc;
-        GLint enableColorMaterialLoc;
 
         GLint materialAmbientLoc;
         GLint materialDiffuseLoc;
@@ -159,7 +191,6 @@ class GLES1Renderer final : angle::NonCopyable
         GLint lightModelSceneAmbientLoc;
         GLint lightModelTwoSidedLoc;
 
-        GLint lightEnablesLoc;
         GLint lightAmbientsLoc;
         GLint lightDiffusesLoc;
         GLint lightSpecularsLoc;
@@ -172,16 +203,12 @@ class GLES1Renderer final : angle::NonCopyable
         GLint lightAttenuationQuadraticsLoc;
 
         // Fog
-        GLint fogEnableLoc;
-        GLint fogModeLoc;
         GLint fogDensityLoc;
         GLint fogStartLoc;
         GLint fogEndLoc;
         GLint fogColorLoc;
 
         // Clip planes
-        GLint enableClipPlanesLoc;
-        GLint clipPlaneEnablesLoc;
         GLint clipPlanesLoc;
 
         // Point rasterization
@@ -201,10 +228,7 @@ class GLES1Renderer final : angle::NonCopyable
     struct GLES1UniformBuffers
     {
         std::array<Mat4Uniform, kTexUnitCount> textureMatrices;
-        std::array<GLint, kTexUnitCount> tex2DEnables;
-        std::array<GLint, kTexUnitCount> texCubeEnables;
 
-        std::array<GLint, kTexUnitCount> texEnvModes;
         std::array<GLint, kTexUnitCount> texCombineRgbs;
         std::array<GLint, kTexUnitCount> texCombineAlphas;
 
@@ -226,7 +250,6 @@ class GLES1Renderer final : angle::NonCopyable
         std::array<GLint, kTexUnitCount> pointSpriteCoordReplaces;
 
         // Lighting
-        std::array<GLint, kLightCount> lightEnables;
         std::array<Vec4Uniform, kLightCount> lightAmbients;
         std::array<Vec4Uniform, kLightCount> lightDiffuses;
         std::array<Vec4Uniform, kLightCount> lightSpeculars;
@@ -239,15 +262,27 @@ class GLES1Renderer final : angle::NonCopyable
         std::array<GLfloat, kLightCount> attenuationQuadratics;
 
         // Clip planes
-        std::array<GLint, kClipPlaneCount> clipPlaneEnables;
         std::array<Vec4Uniform, kClipPlaneCount> clipPlanes;
 
-        // Texture crop rectangles
+        // Uniforms that no GLES1State dirty bit covers. They are compared with the values last
+        // uploaded to the current program instead.
+        std::array<GLint, kTexUnitCount> texFormats;
         std::array<Vec4Uniform, kTexUnitCount> texCropRects;
+        GLint pointRasterization;
+        GLint drawTextureEnabled;
     };
 
     GLES1UniformBuffers mUniformBuffers;
-    GLES1ProgramState mProgramState;
+
+    // The programs of the most recently used combinations of specialized features, and the shared
+    // vertex shader they are linked with. The least recently used program is deleted once there
+    // are kMaxPrograms.
+    static constexpr size_t kMaxPrograms = 64;
+    GLuint mVertexShader;
+    angle::base::HashingMRUCache<GLES1ShaderState, GLES1ProgramState, GLES1ShaderStateHash>
+        mProgramStates;
+    GLES1ShaderState mShaderState;
+    GLES1ProgramState *mProgramState;
 
     bool mDrawTextureEnabled      = false;
     GLfloat mDrawTextureCoords[4] = {0.0f, 0.0f, 0.0f, 0.0f};
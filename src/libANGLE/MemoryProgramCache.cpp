@@ -15,7 +15,9 @@
 #include "common/utilities.h"
 #include "common/version.h"
 #include "libANGLE/BinaryStream.h"
+#include "libANGLE/Constants.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Shader.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/ProgramImpl.h"
@@ -85,7 +87,7 @@ HashStream &operator<<(HashStream &stream, const std::vector<gl::VariableLocatio
 }  // anonymous namespace
 
 MemoryProgramCache::MemoryProgramCache(egl::BlobCache &blobCache)
-    : mBlobCache(blobCache), mIssuedWarnings(0)
+    : mBlobCache(blobCache), mShaderCache(kMaxShaderCacheMemoryBytes), mIssuedWarnings(0)
 {}
 
 MemoryProgramCache::~MemoryProgramCache() {}
@@ -210,6 +212,85 @@ void MemoryProgramCache::updateProgram(const Context *context, const Program *pr
     putProgram(programHash, context, program);
 }
 
+// static
+void MemoryProgramCache::ComputeShaderHash(const Context *context,
+                                           const Shader *shader,
+                                           const std::string &sourcePath,
+                                           const std::string &source,
+                                           ShCompileOptions compileOptions,
+                                           egl::BlobCache::Key *hashOut)
+{
+    // The source may contain null characters, so it's hashed as a whole.
+    HashStream hashStream;
+    hashStream << "Shader" << static_cast<int>(shader->getType()) << source << sourcePath
+               << compileOptions << shader->getCompilerResourcesString().c_str();
+
+    // Add some ANGLE metadata and Context properties that the translator or the backend use.
+    hashStream << ANGLE_COMMIT_HASH << context->getClientMajorVersion()
+               << context->getClientMinorVersion() << context->getString(GL_RENDERER)
+               << context->getExtensions().webglCompatibility
+               << context->getCaps().maxComputeWorkGroupInvocations;
+
+    const std::string &shaderKey = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(shaderKey.c_str()),
+                               shaderKey.length(), hashOut->data());
+}
+
+bool MemoryProgramCache::getShader(const Context *context,
+                                   Shader *shader,
+                                   const std::string &sourcePath,
+                                   const std::string &source,
+                                   ShCompileOptions compileOptions,
+                                   egl::BlobCache::Key *hashOut)
+{
+    // If caching is effectively disabled, don't bother calculating the hash.
+    if (!isShaderCachingEnabled())
+    {
+        return false;
+    }
+
+    ComputeShaderHash(context, shader, sourcePath, source, compileOptions, hashOut);
+    egl::BlobCache::Value binaryShader;
+    if (!mShaderCache.get(context->getScratchBuffer(), *hashOut, &binaryShader))
+    {
+        return false;
+    }
+
+    if (shader->deserialize(binaryShader.data(), binaryShader.size()))
+    {
+        return true;
+    }
+
+    // Cache load failed, evict.
+    if (mIssuedWarnings++ < kWarningLimit)
+    {
+        WARN() << "Failed to load compiled shader from cache.";
+
+        if (mIssuedWarnings == kWarningLimit)
+        {
+            WARN() << "Reaching warning limit for cache load failures, silencing "
+                      "subsequent warnings.";
+        }
+    }
+    mShaderCache.remove(*hashOut);
+    return false;
+}
+
+void MemoryProgramCache::putShader(const egl::BlobCache::Key &shaderHash, const Shader *shader)
+{
+    // If caching is effectively disabled, don't bother serializing the shader.
+    if (!isShaderCachingEnabled())
+    {
+        return;
+    }
+
+    // Unlike programs, shaders are not passed to the platform's cacheProgram or the application's
+    // blob cache, which are only expected to be called with program binaries.
+    angle::MemoryBuffer serializedShader;
+    shader->serialize(&serializedShader);
+    mShaderCache.put(shaderHash, std::move(serializedShader));
+}
+
 void MemoryProgramCache::putBinary(const egl::BlobCache::Key &programHash,
                                    const uint8_t *binary,
                                    size_t length)
@@ -226,12 +307,14 @@ void MemoryProgramCache::putBinary(const egl::BlobCache::Key &programHash,
 void MemoryProgramCache::clear()
 {
     mBlobCache.clear();
+    mShaderCache.clear();
     mIssuedWarnings = 0;
 }
 
 void MemoryProgramCache::resize(size_t maxCacheSizeBytes)
 {
     mBlobCache.resize(maxCacheSizeBytes);
+    mShaderCache.clear();
 }
 
 size_t MemoryProgramCache::entryCount() const
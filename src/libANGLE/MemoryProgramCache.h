@@ -5,13 +5,17 @@
 //
 // MemoryProgramCache: Stores compiled and linked programs in memory so they don't
 //   always have to be re-compiled. Can be used in conjunction with the platform
-//   layer to warm up the cache from disk.
+//   layer to warm up the cache from disk. Also stores the results of compiling
+//   shaders in memory, so that a shader can skip the translator even if the
+//   program it's linked into is not in the cache.
 
 #ifndef LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 #define LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 
 #include <array>
 
+#include <GLSLANG/ShaderLang.h>
+
 #include "common/MemoryBuffer.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/Error.h"
@@ -21,6 +25,7 @@ namespace gl
 class Context;
 class Program;
 class ProgramState;
+class Shader;
 
 class MemoryProgramCache final : angle::NonCopyable
 {
@@ -63,13 +68,33 @@ class MemoryProgramCache final : angle::NonCopyable
                              Program *program,
                              egl::BlobCache::Key *hashOut);
 
-    // Empty the cache.
+    // Computes the hash of compiling |shader| with the source and options prepared by the backend.
+    static void ComputeShaderHash(const Context *context,
+                                  const Shader *shader,
+                                  const std::string &sourcePath,
+                                  const std::string &source,
+                                  ShCompileOptions compileOptions,
+                                  egl::BlobCache::Key *hashOut);
+
+    // Check the cache, and deserialize and load the results of compiling the shader if found.
+    // Evict existing hash if load fails.
+    bool getShader(const Context *context,
+                   Shader *shader,
+                   const std::string &sourcePath,
+                   const std::string &source,
+                   ShCompileOptions compileOptions,
+                   egl::BlobCache::Key *hashOut);
+
+    // Helper method that serializes the results of compiling a shader.
+    void putShader(const egl::BlobCache::Key &shaderHash, const Shader *shader);
+
+    // Empty the cache, including the compiled shaders.
     void clear();
 
-    // Resize the cache. Discards current contents.
+    // Resize the cache. Discards current contents, including the compiled shaders.
     void resize(size_t maxCacheSizeBytes);
 
-    // Returns the number of entries in the cache.
+    // Returns the number of program entries in the cache.
     size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
@@ -82,7 +107,14 @@ class MemoryProgramCache final : angle::NonCopyable
     size_t maxSize() const;
 
   private:
+    bool isShaderCachingEnabled() const { return mBlobCache.isCachingEnabled(); }
+
     egl::BlobCache &mBlobCache;
+
+    // The compiled shaders are kept apart from the program binaries. Only the programs are
+    // exposed through EGL_ANGLE_program_cache_control and the application's blob cache.
+    egl::BlobCache mShaderCache;
+
     unsigned int mIssuedWarnings;
 };
 
@@ -108,74 +108,17 @@ void UniformStateQueryCastLoop(DestT *dataOut, const uint8_t *srcPointer, int co
     }
 }
 
-template <typename VarT>
-GLuint GetResourceIndexFromName(const std::vector<VarT> &list, const std::string &name)
+// FNV-1a. Variable names are short, so hashing them byte by byte is cheaper than setting up a
+// general purpose hash.
+size_t HashVariableName(const char *name, size_t nameLength)
 {
-    std::string nameAsArrayName = name + "[0]";
-    for (size_t index = 0; index < list.size(); index++)
+    size_t hash = 2166136261u;
+    for (size_t index = 0; index < nameLength; ++index)
     {
-        const VarT &resource = list[index];
-        if (resource.name == name || (resource.isArray() && resource.name == nameAsArrayName))
-        {
-            return static_cast<GLuint>(index);
-        }
-    }
-
-    return GL_INVALID_INDEX;
-}
-
-template <typename VarT>
-GLint GetVariableLocation(const std::vector<VarT> &list,
-                          const std::vector<VariableLocation> &locationList,
-                          const std::string &name)
-{
-    size_t nameLengthWithoutArrayIndex;
-    unsigned int arrayIndex = ParseArrayIndex(name, &nameLengthWithoutArrayIndex);
-
-    for (size_t location = 0u; location < locationList.size(); ++location)
-    {
-        const VariableLocation &variableLocation = locationList[location];
-        if (!variableLocation.used())
-        {
-            continue;
-        }
-
-        const VarT &variable = list[variableLocation.index];
-
-        if (angle::BeginsWith(variable.name, name))
-        {
-            if (name.length() == variable.name.length())
-            {
-                ASSERT(name == variable.name);
-                // GLES 3.1 November 2016 page 87.
-                // The string exactly matches the name of the active variable.
-                return static_cast<GLint>(location);
-            }
-            if (name.length() + 3u == variable.name.length() && variable.isArray())
-            {
-                ASSERT(name + "[0]" == variable.name);
-                // The string identifies the base name of an active array, where the string would
-                // exactly match the name of the variable if the suffix "[0]" were appended to the
-                // string.
-                return static_cast<GLint>(location);
-            }
-        }
-        if (variable.isArray() && variableLocation.arrayIndex == arrayIndex &&
-            nameLengthWithoutArrayIndex + 3u == variable.name.length() &&
-            angle::BeginsWith(variable.name, name, nameLengthWithoutArrayIndex))
-        {
-            ASSERT(name.substr(0u, nameLengthWithoutArrayIndex) + "[0]" == variable.name);
-            // The string identifies an active element of the array, where the string ends with the
-            // concatenation of the "[" character, an integer (with no "+" sign, extra leading
-            // zeroes, or whitespace) identifying an array element, and the "]" character, the
-            // integer is less than the number of active elements of the array variable, and where
-            // the string would exactly match the enumerated name of the array if the decimal
-            // integer were replaced with zero.
-            return static_cast<GLint>(location);
-        }
+        hash ^= static_cast<unsigned char>(name[index]);
+        hash *= 16777619u;
     }
-
-    return -1;
+    return hash;
 }
 
 void CopyStringToBuffer(GLchar *buffer, const std::string &string, GLsizei bufSize, GLsizei *length)
@@ -839,6 +782,326 @@ VariableLocation::VariableLocation(unsigned int arrayIndex, unsigned int index)
     ASSERT(arrayIndex != GL_INVALID_INDEX);
 }
 
+// VariableNameIndex implementation.
+VariableNameIndex::VariableNameIndex() = default;
+
+VariableNameIndex::~VariableNameIndex() = default;
+
+constexpr uint32_t VariableNameIndex::kInvalidEntry;
+
+template <typename VarT>
+void VariableNameIndex::buildFromLocations(const std::vector<VarT> &list,
+                                           const std::vector<VariableLocation> &locationList)
+{
+    clear();
+    initBuckets(list.size());
+
+    // The first used location of a variable answers queries for its name and, for arrays, for its
+    // base name.
+    std::vector<uint32_t> variableEntries(list.size(), kInvalidEntry);
+    for (size_t location = 0u; location < locationList.size(); ++location)
+    {
+        const VariableLocation &variableLocation = locationList[location];
+        if (!variableLocation.used())
+        {
+            continue;
+        }
+
+        uint32_t &entryIndex = variableEntries[variableLocation.index];
+        if (entryIndex == kInvalidEntry)
+        {
+            const VarT &variable = list[variableLocation.index];
+            entryIndex = insert(variable.name, variable.isArray(), static_cast<GLint>(location));
+        }
+
+        Entry &entry = mEntries[entryIndex];
+        if (entry.isArray)
+        {
+            entry.elementCount = std::max(entry.elementCount, variableLocation.arrayIndex + 1u);
+        }
+    }
+
+    for (Entry &entry : mEntries)
+    {
+        entry.elementOffset = static_cast<uint32_t>(mElementLocations.size());
+        mElementLocations.resize(mElementLocations.size() + entry.elementCount, -1);
+    }
+
+    for (size_t location = 0u; location < locationList.size(); ++location)
+    {
+        const VariableLocation &variableLocation = locationList[location];
+        if (!variableLocation.used())
+        {
+            continue;
+        }
+
+        const Entry &entry = mEntries[variableEntries[variableLocation.index]];
+        if (!entry.isArray)
+        {
+            continue;
+        }
+
+        GLint &elementLocation =
+            mElementLocations[entry.elementOffset + variableLocation.arrayIndex];
+        if (elementLocation == -1)
+        {
+            elementLocation = static_cast<GLint>(location);
+        }
+    }
+}
+
+template <typename VarT>
+void VariableNameIndex::buildFromResources(const std::vector<VarT> &list)
+{
+    clear();
+    initBuckets(list.size());
+
+    for (size_t index = 0; index < list.size(); ++index)
+    {
+        insert(list[index].name, list[index].isArray(), static_cast<GLint>(index));
+    }
+}
+
+// Instantiated for the variable lists a program indexes.
+template void VariableNameIndex::buildFromLocations(const std::vector<LinkedUniform> &,
+                                                    const std::vector<VariableLocation> &);
+template void VariableNameIndex::buildFromLocations(const std::vector<sh::OutputVariable> &,
+                                                    const std::vector<VariableLocation> &);
+template void VariableNameIndex::buildFromResources(const std::vector<sh::Attribute> &);
+template void VariableNameIndex::buildFromResources(const std::vector<LinkedUniform> &);
+template void VariableNameIndex::buildFromResources(const std::vector<BufferVariable> &);
+template void VariableNameIndex::buildFromResources(const std::vector<sh::OutputVariable> &);
+
+void VariableNameIndex::clear()
+{
+    mEntries.clear();
+    mBuckets.clear();
+    mElementLocations.clear();
+}
+
+GLint VariableNameIndex::findLocation(const std::string &name) const
+{
+    // GLES 3.1 November 2016 page 87.
+    // The string exactly matches the name of the active variable, or identifies the base name of
+    // an active array.
+    const Entry *entry = find(name.c_str(), name.length());
+    if (entry)
+    {
+        return entry->value;
+    }
+
+    // The string identifies an active element of the array, where the string ends with the
+    // concatenation of the "[" character, an integer identifying an array element, and the "]"
+    // character, and the integer is less than the number of active elements of the array variable.
+    size_t nameLengthWithoutArrayIndex;
+    unsigned int arrayIndex = ParseArrayIndex(name, &nameLengthWithoutArrayIndex);
+    if (arrayIndex == GL_INVALID_INDEX)
+    {
+        return -1;
+    }
+
+    entry = find(name.c_str(), nameLengthWithoutArrayIndex);
+    if (!entry || !entry->isArray || arrayIndex >= entry->elementCount)
+    {
+        return -1;
+    }
+
+    return mElementLocations[entry->elementOffset + arrayIndex];
+}
+
+GLuint VariableNameIndex::findIndex(const char *name, size_t nameLength) const
+{
+    const Entry *entry = find(name, nameLength);
+    if (entry)
+    {
+        return static_cast<GLuint>(entry->value);
+    }
+
+    // Array resources are also found by their full name, including the "[0]" suffix.
+    if (nameLength > 3u && strncmp(name + nameLength - 3u, "[0]", 3u) == 0)
+    {
+        entry = find(name, nameLength - 3u);
+        if (entry && entry->isArray)
+        {
+            return static_cast<GLuint>(entry->value);
+        }
+    }
+
+    return GL_INVALID_INDEX;
+}
+
+void VariableNameIndex::save(BinaryOutputStream *stream) const
+{
+    stream->writeInt(mEntries.size());
+    for (const Entry &entry : mEntries)
+    {
+        stream->writeString(entry.name);
+        stream->writeInt(entry.value);
+        stream->writeInt(entry.isArray);
+        stream->writeInt(entry.elementOffset);
+        stream->writeInt(entry.elementCount);
+        stream->writeIntOrNegOne(entry.next);
+    }
+    stream->writeIntVector(mBuckets);
+    stream->writeIntVector(mElementLocations);
+}
+
+bool VariableNameIndex::load(BinaryInputStream *stream)
+{
+    ASSERT(mEntries.empty());
+
+    // Counts are read one element at a time so that a truncated or corrupted stream fails on the
+    // first read past its end instead of allocating the count up front.
+    unsigned int entryCount = stream->readInt<unsigned int>();
+    for (unsigned int entryIndex = 0; entryIndex < entryCount && !stream->error(); ++entryIndex)
+    {
+        Entry entry;
+        stream->readString(&entry.name);
+        stream->readInt(&entry.value);
+        stream->readBool(&entry.isArray);
+        stream->readInt(&entry.elementOffset);
+        stream->readInt(&entry.elementCount);
+        stream->readInt(&entry.next);
+        mEntries.push_back(std::move(entry));
+    }
+
+    unsigned int bucketCount = stream->readInt<unsigned int>();
+    for (unsigned int bucket = 0; bucket < bucketCount && !stream->error(); ++bucket)
+    {
+        mBuckets.push_back(stream->readInt<uint32_t>());
+    }
+
+    unsigned int elementLocationCount = stream->readInt<unsigned int>();
+    for (unsigned int element = 0; element < elementLocationCount && !stream->error(); ++element)
+    {
+        mElementLocations.push_back(stream->readInt<GLint>());
+    }
+
+    if (stream->error() || !validate())
+    {
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool VariableNameIndex::validate() const
+{
+    // An index that was never built has no buckets.
+    if (mBuckets.empty())
+    {
+        return mEntries.empty() && mElementLocations.empty();
+    }
+
+    // find() masks the hash with the bucket count.
+    if (!gl::isPow2(mBuckets.size()) || mEntries.size() >= kInvalidEntry)
+    {
+        return false;
+    }
+
+    for (const Entry &entry : mEntries)
+    {
+        uint64_t elementEnd = static_cast<uint64_t>(entry.elementOffset) + entry.elementCount;
+        if (entry.value < 0 || (!entry.isArray && entry.elementCount != 0u) ||
+            elementEnd > mElementLocations.size())
+        {
+            return false;
+        }
+    }
+
+    // Every entry must be reached exactly once, from the bucket its name hashes to. This also
+    // rules out cycles in the chains.
+    std::vector<bool> reached(mEntries.size(), false);
+    for (size_t bucket = 0; bucket < mBuckets.size(); ++bucket)
+    {
+        for (uint32_t entryIndex = mBuckets[bucket]; entryIndex != kInvalidEntry;
+             entryIndex          = mEntries[entryIndex].next)
+        {
+            if (entryIndex >= mEntries.size() || reached[entryIndex])
+            {
+                return false;
+            }
+            reached[entryIndex] = true;
+
+            const Entry &entry = mEntries[entryIndex];
+            if ((HashVariableName(entry.name.c_str(), entry.name.length()) &
+                 (mBuckets.size() - 1u)) != bucket)
+            {
+                return false;
+            }
+        }
+    }
+
+    return std::find(reached.begin(), reached.end(), false) == reached.end();
+}
+
+const VariableNameIndex::Entry *VariableNameIndex::find(const char *name, size_t nameLength) const
+{
+    if (mBuckets.empty())
+    {
+        return nullptr;
+    }
+
+    size_t bucket = HashVariableName(name, nameLength) & (mBuckets.size() - 1u);
+    for (uint32_t entryIndex = mBuckets[bucket]; entryIndex != kInvalidEntry;
+         entryIndex          = mEntries[entryIndex].next)
+    {
+        const Entry &entry = mEntries[entryIndex];
+        if (entry.name.length() == nameLength &&
+            entry.name.compare(0u, nameLength, name, nameLength) == 0)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+uint32_t VariableNameIndex::insert(const std::string &variableName, bool isArray, GLint value)
+{
+    // Names of arrays end in "[0]". Dropping it lets element queries match on the base name.
+    size_t nameLength = variableName.length();
+    if (isArray)
+    {
+        ASSERT(angle::EndsWith(variableName, "[0]"));
+        nameLength -= 3u;
+    }
+
+    // Duplicate names resolve to the first variable, as a scan of the list would.
+    const Entry *existing = find(variableName.c_str(), nameLength);
+    if (existing)
+    {
+        return static_cast<uint32_t>(existing - mEntries.data());
+    }
+
+    size_t bucket = HashVariableName(variableName.c_str(), nameLength) & (mBuckets.size() - 1u);
+
+    Entry entry;
+    entry.name          = variableName.substr(0u, nameLength);
+    entry.value         = value;
+    entry.isArray       = isArray;
+    entry.elementOffset = 0u;
+    entry.elementCount  = 0u;
+    entry.next          = mBuckets[bucket];
+
+    mBuckets[bucket] = static_cast<uint32_t>(mEntries.size());
+    mEntries.push_back(std::move(entry));
+    return mBuckets[bucket];
+}
+
+void VariableNameIndex::initBuckets(size_t entryCount)
+{
+    // Keep the load factor at or below one half. The bucket count is a power of two so that the
+    // hash can be masked instead of divided.
+    size_t bucketCount = 1u;
+    while (bucketCount < entryCount * 2u)
+    {
+        bucketCount <<= 1u;
+    }
+    mBuckets.assign(bucketCount, kInvalidEntry);
+}
+
 // SamplerBindings implementation.
 SamplerBinding::SamplerBinding(TextureType textureTypeIn,
                                SamplerFormat formatIn,
@@ -936,12 +1199,12 @@ Shader *ProgramState::getAttachedShader(ShaderType shaderType) const
 
 GLuint ProgramState::getUniformIndexFromName(const std::string &name) const
 {
-    return GetResourceIndexFromName(mUniforms, name);
+    return mUniformNameIndex.findIndex(name);
 }
 
 GLuint ProgramState::getBufferVariableIndexFromName(const std::string &name) const
 {
-    return GetResourceIndexFromName(mBufferVariables, name);
+    return mBufferVariableNameIndex.findIndex(name);
 }
 
 GLuint ProgramState::getUniformIndexFromLocation(GLint location) const
@@ -985,15 +1248,14 @@ GLuint ProgramState::getImageIndexFromUniformIndex(GLuint uniformIndex) const
 
 GLuint ProgramState::getAttributeLocation(const std::string &name) const
 {
-    for (const sh::Attribute &attribute : mAttributes)
+    GLuint index = mAttributeNameIndex.findIndex(name);
+    if (index == GL_INVALID_INDEX)
     {
-        if (attribute.name == name)
-        {
-            return attribute.location;
-        }
+        return static_cast<GLuint>(-1);
     }
 
-    return static_cast<GLuint>(-1);
+    ASSERT(mAttributes[index].name == name);
+    return mAttributes[index].location;
 }
 
 bool ProgramState::hasAttachedShader() const
@@ -1413,6 +1675,9 @@ void Program::resolveLinkImpl(const Context *context)
     mProgram->markUnusedUniformLocations(&mState.mUniformLocations, &mState.mSamplerBindings,
                                          &mState.mImageBindings);
 
+    // Must be called after markUnusedUniformLocations, and before the program is cached.
+    mState.updateVariableNameIndices();
+
     // Must be called after markUnusedUniformLocations.
     postResolveLink(context);
 
@@ -1467,6 +1732,17 @@ void ProgramState::updateTransformFeedbackStrides()
     }
 }
 
+void ProgramState::updateVariableNameIndices()
+{
+    mUniformNameIndex.buildFromResources(mUniforms);
+    mUniformLocationNameIndex.buildFromLocations(mUniforms, mUniformLocations);
+    mBufferVariableNameIndex.buildFromResources(mBufferVariables);
+    mOutputVariableNameIndex.buildFromResources(mOutputVariables);
+    mOutputLocationNameIndex.buildFromLocations(mOutputVariables, mOutputLocations);
+    mSecondaryOutputLocationNameIndex.buildFromLocations(mOutputVariables,
+                                                         mSecondaryOutputLocations);
+}
+
 void ProgramState::updateActiveSamplers()
 {
     mActiveSamplerRefCounts.fill(0);
@@ -1542,6 +1818,13 @@ void Program::unlink()
     mState.mGeometryShaderInvocations         = 1;
     mState.mGeometryShaderMaxVertices         = 0;
     mState.mDrawIDLocation                    = -1;
+    mState.mAttributeNameIndex.clear();
+    mState.mUniformNameIndex.clear();
+    mState.mUniformLocationNameIndex.clear();
+    mState.mBufferVariableNameIndex.clear();
+    mState.mOutputVariableNameIndex.clear();
+    mState.mOutputLocationNameIndex.clear();
+    mState.mSecondaryOutputLocationNameIndex.clear();
 
     mValidated = false;
 
@@ -1849,13 +2132,13 @@ GLint Program::getGeometryShaderMaxVertices() const
 GLuint Program::getInputResourceIndex(const GLchar *name) const
 {
     ASSERT(mLinkResolved);
-    return GetResourceIndexFromName(mState.mAttributes, std::string(name));
+    return mState.mAttributeNameIndex.findIndex(name, strlen(name));
 }
 
 GLuint Program::getOutputResourceIndex(const GLchar *name) const
 {
     ASSERT(mLinkResolved);
-    return GetResourceIndexFromName(mState.mOutputVariables, std::string(name));
+    return mState.mOutputVariableNameIndex.findIndex(name, strlen(name));
 }
 
 size_t Program::getOutputResourceCount() const
@@ -1990,23 +2273,22 @@ const std::vector<GLsizei> &Program::getTransformFeedbackStrides() const
 GLint Program::getFragDataLocation(const std::string &name) const
 {
     ASSERT(mLinkResolved);
-    GLint primaryLocation =
-        GetVariableLocation(mState.mOutputVariables, mState.mOutputLocations, name);
+    GLint primaryLocation = mState.mOutputLocationNameIndex.findLocation(name);
     if (primaryLocation != -1)
     {
         return primaryLocation;
     }
-    return GetVariableLocation(mState.mOutputVariables, mState.mSecondaryOutputLocations, name);
+    return mState.mSecondaryOutputLocationNameIndex.findLocation(name);
 }
 
 GLint Program::getFragDataIndex(const std::string &name) const
 {
     ASSERT(mLinkResolved);
-    if (GetVariableLocation(mState.mOutputVariables, mState.mOutputLocations, name) != -1)
+    if (mState.mOutputLocationNameIndex.findLocation(name) != -1)
     {
         return 0;
     }
-    if (GetVariableLocation(mState.mOutputVariables, mState.mSecondaryOutputLocations, name) != -1)
+    if (mState.mSecondaryOutputLocationNameIndex.findLocation(name) != -1)
     {
         return 1;
     }
@@ -2128,7 +2410,7 @@ const BufferVariable &Program::getBufferVariableByIndex(GLuint index) const
 GLint Program::getUniformLocation(const std::string &name) const
 {
     ASSERT(mLinkResolved);
-    return GetVariableLocation(mState.mUniforms, mState.mUniformLocations, name);
+    return mState.mUniformLocationNameIndex.findLocation(name);
 }
 
 GLuint Program::getUniformIndex(const std::string &name) const
@@ -3218,6 +3500,9 @@ bool Program::linkAttributes(const Caps &caps, InfoLog &infoLog)
         }
     }
 
+    // Back-ends look up attribute locations while linking, so this can't wait for link resolution.
+    mState.mAttributeNameIndex.buildFromResources(mState.mAttributes);
+
     return true;
 }
 
@@ -4434,6 +4719,14 @@ void Program::serialize(const Context *context, angle::MemoryBuffer *binaryOut)
 
     stream.writeInt(mState.getLinkedShaderStages().to_ulong());
 
+    mState.mAttributeNameIndex.save(&stream);
+    mState.mUniformNameIndex.save(&stream);
+    mState.mUniformLocationNameIndex.save(&stream);
+    mState.mBufferVariableNameIndex.save(&stream);
+    mState.mOutputVariableNameIndex.save(&stream);
+    mState.mOutputLocationNameIndex.save(&stream);
+    mState.mSecondaryOutputLocationNameIndex.save(&stream);
+
     mProgram->save(context, &stream);
 
     ASSERT(binaryOut);
@@ -4676,6 +4969,17 @@ angle::Result Program::deserialize(const Context *context,
                   "Too many shader types");
     mState.mLinkedShaderStages = ShaderBitSet(stream.readInt<uint8_t>());
 
+    if (!mState.mAttributeNameIndex.load(&stream) || !mState.mUniformNameIndex.load(&stream) ||
+        !mState.mUniformLocationNameIndex.load(&stream) ||
+        !mState.mBufferVariableNameIndex.load(&stream) ||
+        !mState.mOutputVariableNameIndex.load(&stream) ||
+        !mState.mOutputLocationNameIndex.load(&stream) ||
+        !mState.mSecondaryOutputLocationNameIndex.load(&stream))
+    {
+        infoLog << "Invalid variable name index in program binary.";
+        return angle::Result::Incomplete;
+    }
+
     postResolveLink(context);
 
     return mProgram->load(context, infoLog, &stream);
@@ -14,6 +14,7 @@
 #include <GLSLANG/ShaderVars.h>
 
 #include <array>
+#include <limits>
 #include <map>
 #include <set>
 #include <sstream>
@@ -41,6 +42,8 @@ struct TranslatedAttribute;
 
 namespace gl
 {
+class BinaryInputStream;
+class BinaryOutputStream;
 class Buffer;
 struct Caps;
 class Context;
@@ -189,6 +192,67 @@ struct VariableLocation
     bool ignored;
 };
 
+// Hashed index from the names of a program's active variables to their locations or resource
+// indices. It's built once per link and stored in the program binary, so name queries don't scan
+// the variable lists. Array names are stored without their "[0]" suffix, which lets "name[N]"
+// queries look up the base name in place without building a temporary string.
+class VariableNameIndex final
+{
+  public:
+    VariableNameIndex();
+    ~VariableNameIndex();
+
+    // Indexes the variables referenced from a location list. findLocation() then follows the
+    // GLES 3.1 rules for GetUniformLocation and GetFragDataLocation.
+    template <typename VarT>
+    void buildFromLocations(const std::vector<VarT> &list,
+                            const std::vector<VariableLocation> &locationList);
+
+    // Indexes a list of active resources. findIndex() then follows the rules for
+    // GetProgramResourceIndex.
+    template <typename VarT>
+    void buildFromResources(const std::vector<VarT> &list);
+
+    void clear();
+
+    GLint findLocation(const std::string &name) const;
+    GLuint findIndex(const char *name, size_t nameLength) const;
+    GLuint findIndex(const std::string &name) const
+    {
+        return findIndex(name.c_str(), name.length());
+    }
+
+    void save(BinaryOutputStream *stream) const;
+    // Returns false and leaves the index empty if the stream is truncated or inconsistent.
+    bool load(BinaryInputStream *stream);
+
+  private:
+    static constexpr uint32_t kInvalidEntry = std::numeric_limits<uint32_t>::max();
+
+    struct Entry
+    {
+        // The variable name, without the trailing "[0]" of arrays.
+        std::string name;
+        // The location or resource index of the variable.
+        GLint value;
+        bool isArray;
+        // Range of per-element locations in mElementLocations.
+        uint32_t elementOffset;
+        uint32_t elementCount;
+        // Next entry in the same hash bucket.
+        uint32_t next;
+    };
+
+    bool validate() const;
+    const Entry *find(const char *name, size_t nameLength) const;
+    uint32_t insert(const std::string &variableName, bool isArray, GLint value);
+    void initBuckets(size_t entryCount);
+
+    std::vector<Entry> mEntries;
+    std::vector<uint32_t> mBuckets;
+    std::vector<GLint> mElementLocations;
+};
+
 // Information about a variable binding.
 // Currently used by CHROMIUM_path_rendering
 struct BindingInfo
@@ -295,6 +359,10 @@ class ProgramState final : angle::NonCopyable
         return mTransformFeedbackVaryingNames;
     }
     GLint getTransformFeedbackBufferMode() const { return mTransformFeedbackBufferMode; }
+    const std::vector<GLsizei> &getTransformFeedbackStrides() const
+    {
+        return mTransformFeedbackStrides;
+    }
     GLuint getUniformBlockBinding(GLuint uniformBlockIndex) const
     {
         ASSERT(uniformBlockIndex < mUniformBlocks.size());
@@ -375,6 +443,7 @@ class ProgramState final : angle::NonCopyable
     friend class Program;
 
     void updateTransformFeedbackStrides();
+    void updateVariableNameIndices();
     void updateActiveSamplers();
     void updateActiveImages();
 
@@ -437,6 +506,16 @@ class ProgramState final : angle::NonCopyable
     // EXT_blend_func_extended secondary outputs (ones with index 1) in ESSL 3.00 shaders.
     std::vector<VariableLocation> mSecondaryOutputLocations;
 
+    // Name lookups for the location and program interface queries. The attribute index is built
+    // with the attributes, since back-ends query attribute locations while linking.
+    VariableNameIndex mAttributeNameIndex;
+    VariableNameIndex mUniformNameIndex;
+    VariableNameIndex mUniformLocationNameIndex;
+    VariableNameIndex mBufferVariableNameIndex;
+    VariableNameIndex mOutputVariableNameIndex;
+    VariableNameIndex mOutputLocationNameIndex;
+    VariableNameIndex mSecondaryOutputLocationNameIndex;
+
     DrawBufferMask mActiveOutputVariables;
 
     // Fragment output variable base types: FLOAT, INT, or UINT.  Ordered by location.
@@ -8,6 +8,7 @@
 
 #include <gtest/gtest.h>
 
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Program.h"
 
 using namespace gl;
@@ -39,4 +40,216 @@ TEST(InfoLogTest, AppendingNewline)
     EXPECT_EQ(expected, infoLog.str());
 }
 
+// Writes a name index with a single entry, hashed to the only bucket.
+void WriteSingleEntryIndex(BinaryOutputStream *stream,
+                           uint32_t next,
+                           uint32_t bucketCount,
+                           uint32_t bucketHead,
+                           uint32_t elementCount,
+                           uint32_t elementLocationCount)
+{
+    stream->writeInt(1u);
+    stream->writeString("color");
+    stream->writeInt(0);
+    stream->writeInt(true);
+    stream->writeInt(0u);
+    stream->writeInt(elementCount);
+    stream->writeIntOrNegOne(next);
+    stream->writeInt(bucketCount);
+    for (uint32_t bucket = 0; bucket < bucketCount; ++bucket)
+    {
+        stream->writeIntOrNegOne(bucket == 0 ? bucketHead : GL_INVALID_INDEX);
+    }
+    stream->writeInt(elementLocationCount);
+    for (uint32_t element = 0; element < elementLocationCount; ++element)
+    {
+        stream->writeInt(element);
+    }
+}
+
+bool LoadIndex(const BinaryOutputStream &output, VariableNameIndex *index)
+{
+    BinaryInputStream input(output.data(), output.length());
+    return index->load(&input);
+}
+
+std::vector<sh::OutputVariable> MakeOutputVariables()
+{
+    std::vector<sh::OutputVariable> variables(3);
+    variables[0].name = "color[0]";
+    variables[0].arraySizes.push_back(4u);
+    variables[1].name = "depth";
+    variables[2].name = "unused";
+    return variables;
+}
+
+std::vector<VariableLocation> MakeOutputLocations()
+{
+    // color[0..2] at locations 0-2, depth at location 4. color[3] and unused are inactive.
+    std::vector<VariableLocation> locations(5);
+    locations[0] = VariableLocation(0u, 0u);
+    locations[1] = VariableLocation(1u, 0u);
+    locations[2] = VariableLocation(2u, 0u);
+    locations[4] = VariableLocation(0u, 1u);
+    return locations;
+}
+
+// Tests location queries against an index built from a location list.
+TEST(VariableNameIndexTest, FindLocation)
+{
+    VariableNameIndex index;
+    index.buildFromLocations(MakeOutputVariables(), MakeOutputLocations());
+
+    EXPECT_EQ(0, index.findLocation("color"));
+    EXPECT_EQ(0, index.findLocation("color[0]"));
+    EXPECT_EQ(2, index.findLocation("color[2]"));
+    EXPECT_EQ(-1, index.findLocation("color[3]"));
+    EXPECT_EQ(4, index.findLocation("depth"));
+    EXPECT_EQ(-1, index.findLocation("depth[0]"));
+    EXPECT_EQ(-1, index.findLocation("unused"));
+    EXPECT_EQ(-1, index.findLocation("colo"));
+}
+
+// Tests resource index queries against an index built from a resource list.
+TEST(VariableNameIndexTest, FindIndex)
+{
+    VariableNameIndex index;
+    index.buildFromResources(MakeOutputVariables());
+
+    EXPECT_EQ(0u, index.findIndex("color"));
+    EXPECT_EQ(0u, index.findIndex("color[0]"));
+    EXPECT_EQ(GL_INVALID_INDEX, index.findIndex("color[1]"));
+    EXPECT_EQ(1u, index.findIndex("depth"));
+    EXPECT_EQ(GL_INVALID_INDEX, index.findIndex("depth[0]"));
+    EXPECT_EQ(2u, index.findIndex("unused"));
+}
+
+// Tests that an index answers the same queries after a save and load.
+TEST(VariableNameIndexTest, SaveLoadRoundTrip)
+{
+    VariableNameIndex locationIndex;
+    locationIndex.buildFromLocations(MakeOutputVariables(), MakeOutputLocations());
+    VariableNameIndex resourceIndex;
+    resourceIndex.buildFromResources(MakeOutputVariables());
+    VariableNameIndex emptyIndex;
+
+    BinaryOutputStream output;
+    locationIndex.save(&output);
+    resourceIndex.save(&output);
+    emptyIndex.save(&output);
+
+    BinaryInputStream input(output.data(), output.length());
+    VariableNameIndex loadedLocationIndex;
+    VariableNameIndex loadedResourceIndex;
+    VariableNameIndex loadedEmptyIndex;
+    ASSERT_TRUE(loadedLocationIndex.load(&input));
+    ASSERT_TRUE(loadedResourceIndex.load(&input));
+    ASSERT_TRUE(loadedEmptyIndex.load(&input));
+    EXPECT_TRUE(input.endOfStream());
+
+    for (const char *name : {"color", "color[0]", "color[1]", "color[2]", "color[3]", "depth",
+                             "depth[0]", "unused", "missing"})
+    {
+        EXPECT_EQ(locationIndex.findLocation(name), loadedLocationIndex.findLocation(name))
+            << name;
+        EXPECT_EQ(resourceIndex.findIndex(name), loadedResourceIndex.findIndex(name)) << name;
+        EXPECT_EQ(GL_INVALID_INDEX, loadedEmptyIndex.findIndex(name)) << name;
+    }
+}
+
+// Tests that a well-formed hand-written index loads, so the failures below are due to the one
+// field each of them corrupts.
+TEST(VariableNameIndexTest, LoadValid)
+{
+    BinaryOutputStream output;
+    WriteSingleEntryIndex(&output, GL_INVALID_INDEX, 1u, 0u, 2u, 2u);
+
+    VariableNameIndex index;
+    ASSERT_TRUE(LoadIndex(output, &index));
+    EXPECT_EQ(0, index.findLocation("color"));
+    EXPECT_EQ(1, index.findLocation("color[1]"));
+}
+
+// Tests that loading a truncated index fails and leaves the index empty.
+TEST(VariableNameIndexTest, LoadTruncated)
+{
+    BinaryOutputStream output;
+    WriteSingleEntryIndex(&output, GL_INVALID_INDEX, 1u, 0u, 2u, 2u);
+
+    BinaryInputStream input(output.data(), output.length() - 1u);
+    VariableNameIndex index;
+    EXPECT_FALSE(index.load(&input));
+    EXPECT_EQ(-1, index.findLocation("color"));
+}
+
+// Tests that a huge entry count in a short stream fails without allocating the count.
+TEST(VariableNameIndexTest, LoadHugeCount)
+{
+    BinaryOutputStream output;
+    output.writeInt(std::numeric_limits<int>::max());
+
+    VariableNameIndex index;
+    EXPECT_FALSE(LoadIndex(output, &index));
+}
+
+// Tests that loading fails if the bucket count is not a power of two.
+TEST(VariableNameIndexTest, LoadNonPowerOfTwoBuckets)
+{
+    BinaryOutputStream output;
+    WriteSingleEntryIndex(&output, GL_INVALID_INDEX, 3u, 0u, 2u, 2u);
+
+    VariableNameIndex index;
+    EXPECT_FALSE(LoadIndex(output, &index));
+}
+
+// Tests that loading fails if a bucket head is out of range.
+TEST(VariableNameIndexTest, LoadBucketHeadOutOfRange)
+{
+    BinaryOutputStream output;
+    WriteSingleEntryIndex(&output, GL_INVALID_INDEX, 1u, 1u, 2u, 2u);
+
+    VariableNameIndex index;
+    EXPECT_FALSE(LoadIndex(output, &index));
+}
+
+// Tests that loading fails if a chain link is out of range.
+TEST(VariableNameIndexTest, LoadNextOutOfRange)
+{
+    BinaryOutputStream output;
+    WriteSingleEntryIndex(&output, 7u, 1u, 0u, 2u, 2u);
+
+    VariableNameIndex index;
+    EXPECT_FALSE(LoadIndex(output, &index));
+}
+
+// Tests that loading fails if a chain loops back on itself.
+TEST(VariableNameIndexTest, LoadChainCycle)
+{
+    BinaryOutputStream output;
+    WriteSingleEntryIndex(&output, 0u, 1u, 0u, 2u, 2u);
+
+    VariableNameIndex index;
+    EXPECT_FALSE(LoadIndex(output, &index));
+}
+
+// Tests that loading fails if an entry is not reachable from any bucket.
+TEST(VariableNameIndexTest, LoadUnreachableEntry)
+{
+    BinaryOutputStream output;
+    WriteSingleEntryIndex(&output, GL_INVALID_INDEX, 1u, GL_INVALID_INDEX, 2u, 2u);
+
+    VariableNameIndex index;
+    EXPECT_FALSE(LoadIndex(output, &index));
+}
+
+// Tests that loading fails if an array's element locations run past the end of the list.
+TEST(VariableNameIndexTest, LoadElementsOutOfRange)
+{
+    BinaryOutputStream output;
+    WriteSingleEntryIndex(&output, GL_INVALID_INDEX, 1u, 0u, 3u, 2u);
+
+    VariableNameIndex index;
+    EXPECT_FALSE(LoadIndex(output, &index));
+}
+
 }  // namespace
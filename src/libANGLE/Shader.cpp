@@ -15,10 +15,13 @@
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/utilities.h"
+#include "common/version.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/GLImplFactory.h"
@@ -52,6 +55,185 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
     return *variableList;
 }
 
+// Unlike the variables of a linked program, the variables of a compiled shader keep their struct
+// fields, so they are written in full.
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::ShaderVariable &var)
+{
+    stream->writeInt(var.type);
+    stream->writeInt(var.precision);
+    stream->writeString(var.name);
+    stream->writeString(var.mappedName);
+    stream->writeIntVector(var.arraySizes);
+    stream->writeInt(var.staticUse);
+    stream->writeInt(var.active);
+    stream->writeInt(var.fields.size());
+    for (const sh::ShaderVariable &field : var.fields)
+    {
+        WriteShaderVariable(stream, field);
+    }
+    stream->writeString(var.structName);
+    stream->writeInt(var.isRowMajorLayout);
+    stream->writeInt(var.hasParentArrayIndex() ? var.parentArrayIndex() : -1);
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::ShaderVariable *var)
+{
+    var->type       = stream->readInt<GLenum>();
+    var->precision  = stream->readInt<GLenum>();
+    var->name       = stream->readString();
+    var->mappedName = stream->readString();
+    stream->readIntVector<unsigned int>(&var->arraySizes);
+    var->staticUse    = stream->readBool();
+    var->active       = stream->readBool();
+    size_t fieldCount = stream->readInt<size_t>();
+    for (size_t fieldIndex = 0; fieldIndex < fieldCount && !stream->error(); ++fieldIndex)
+    {
+        var->fields.emplace_back();
+        LoadShaderVariable(stream, &var->fields.back());
+    }
+    var->structName       = stream->readString();
+    var->isRowMajorLayout = stream->readBool();
+    var->setParentArrayIndex(stream->readInt<int>());
+}
+
+void WriteVariable(BinaryOutputStream *stream, const sh::Uniform &uniform)
+{
+    WriteShaderVariable(stream, uniform);
+    stream->writeInt(uniform.location);
+    stream->writeInt(uniform.binding);
+    stream->writeInt(uniform.imageUnitFormat);
+    stream->writeInt(uniform.offset);
+    stream->writeInt(uniform.readonly);
+    stream->writeInt(uniform.writeonly);
+}
+
+void LoadVariable(BinaryInputStream *stream, sh::Uniform *uniform)
+{
+    LoadShaderVariable(stream, uniform);
+    uniform->location        = stream->readInt<int>();
+    uniform->binding         = stream->readInt<int>();
+    uniform->imageUnitFormat = stream->readInt<GLenum>();
+    uniform->offset          = stream->readInt<int>();
+    uniform->readonly        = stream->readBool();
+    uniform->writeonly       = stream->readBool();
+}
+
+void WriteVariable(BinaryOutputStream *stream, const sh::Varying &varying)
+{
+    WriteShaderVariable(stream, varying);
+    stream->writeInt(varying.location);
+    stream->writeEnum(varying.interpolation);
+    stream->writeInt(varying.isInvariant);
+}
+
+void LoadVariable(BinaryInputStream *stream, sh::Varying *varying)
+{
+    LoadShaderVariable(stream, varying);
+    varying->location      = stream->readInt<int>();
+    varying->interpolation = stream->readEnum<sh::InterpolationType>();
+    varying->isInvariant   = stream->readBool();
+}
+
+void WriteVariable(BinaryOutputStream *stream, const sh::Attribute &attribute)
+{
+    WriteShaderVariable(stream, attribute);
+    stream->writeInt(attribute.location);
+}
+
+void LoadVariable(BinaryInputStream *stream, sh::Attribute *attribute)
+{
+    LoadShaderVariable(stream, attribute);
+    attribute->location = stream->readInt<int>();
+}
+
+void WriteVariable(BinaryOutputStream *stream, const sh::OutputVariable &output)
+{
+    WriteShaderVariable(stream, output);
+    stream->writeInt(output.location);
+    stream->writeInt(output.index);
+}
+
+void LoadVariable(BinaryInputStream *stream, sh::OutputVariable *output)
+{
+    LoadShaderVariable(stream, output);
+    output->location = stream->readInt<int>();
+    output->index    = stream->readInt<int>();
+}
+
+void WriteVariable(BinaryOutputStream *stream, const sh::InterfaceBlock &block)
+{
+    stream->writeString(block.name);
+    stream->writeString(block.mappedName);
+    stream->writeString(block.instanceName);
+    stream->writeInt(block.arraySize);
+    stream->writeEnum(block.layout);
+    stream->writeInt(block.isRowMajorLayout);
+    stream->writeInt(block.binding);
+    stream->writeInt(block.staticUse);
+    stream->writeInt(block.active);
+    stream->writeEnum(block.blockType);
+    stream->writeInt(block.fields.size());
+    for (const sh::InterfaceBlockField &field : block.fields)
+    {
+        WriteShaderVariable(stream, field);
+    }
+}
+
+void LoadVariable(BinaryInputStream *stream, sh::InterfaceBlock *block)
+{
+    block->name             = stream->readString();
+    block->mappedName       = stream->readString();
+    block->instanceName     = stream->readString();
+    block->arraySize        = stream->readInt<unsigned int>();
+    block->layout           = stream->readEnum<sh::BlockLayoutType>();
+    block->isRowMajorLayout = stream->readBool();
+    block->binding          = stream->readInt<int>();
+    block->staticUse        = stream->readBool();
+    block->active           = stream->readBool();
+    block->blockType        = stream->readEnum<sh::BlockType>();
+    size_t fieldCount       = stream->readInt<size_t>();
+    for (size_t fieldIndex = 0; fieldIndex < fieldCount && !stream->error(); ++fieldIndex)
+    {
+        block->fields.emplace_back();
+        LoadShaderVariable(stream, &block->fields.back());
+    }
+}
+
+template <typename VarT>
+void WriteVariables(BinaryOutputStream *stream, const std::vector<VarT> &variables)
+{
+    stream->writeInt(variables.size());
+    for (const VarT &variable : variables)
+    {
+        WriteVariable(stream, variable);
+    }
+}
+
+template <typename VarT>
+void LoadVariables(BinaryInputStream *stream, std::vector<VarT> *variables)
+{
+    variables->clear();
+    size_t count = stream->readInt<size_t>();
+    for (size_t index = 0; index < count && !stream->error(); ++index)
+    {
+        variables->emplace_back();
+        LoadVariable(stream, &variables->back());
+    }
+}
+
+void WritePrimitiveMode(BinaryOutputStream *stream, const Optional<PrimitiveMode> &mode)
+{
+    stream->writeInt(mode.valid());
+    stream->writeEnum(mode.value());
+}
+
+Optional<PrimitiveMode> LoadPrimitiveMode(BinaryInputStream *stream)
+{
+    bool valid         = stream->readBool();
+    PrimitiveMode mode = stream->readEnum<PrimitiveMode>();
+    return valid ? Optional<PrimitiveMode>(mode) : Optional<PrimitiveMode>::Invalid();
+}
+
 }  // anonymous namespace
 
 // true if varying x has a higher priority in packing than y
@@ -162,6 +344,169 @@ ShaderState::ShaderState(ShaderType shaderType)
 
 ShaderState::~ShaderState() {}
 
+void ShaderState::gatherCompileResults(ShHandle compilerHandle)
+{
+    mTranslatedSource = sh::GetObjectCode(compilerHandle);
+
+#if !defined(NDEBUG)
+    // Prefix translated shader with commented out un-translated shader.
+    // Useful in diagnostics tools which capture the shader source.
+    std::ostringstream shaderStream;
+    shaderStream << "// GLSL\n";
+    shaderStream << "//\n";
+
+    std::istringstream inputSourceStream(mSource);
+    std::string line;
+    while (std::getline(inputSourceStream, line))
+    {
+        // Remove null characters from the source line
+        line.erase(std::remove(line.begin(), line.end(), '\0'), line.end());
+
+        shaderStream << "// " << line << std::endl;
+    }
+    shaderStream << "\n\n";
+    shaderStream << mTranslatedSource;
+    mTranslatedSource = shaderStream.str();
+#endif  // !defined(NDEBUG)
+
+    // Gather the shader information
+    mShaderVersion = sh::GetShaderVersion(compilerHandle);
+
+    mUniforms            = GetShaderVariables(sh::GetUniforms(compilerHandle));
+    mUniformBlocks       = GetShaderVariables(sh::GetUniformBlocks(compilerHandle));
+    mShaderStorageBlocks = GetShaderVariables(sh::GetShaderStorageBlocks(compilerHandle));
+
+    switch (mShaderType)
+    {
+        case ShaderType::Compute:
+        {
+            mLocalSize = sh::GetComputeShaderLocalGroupSize(compilerHandle);
+            break;
+        }
+        case ShaderType::Vertex:
+        {
+            {
+                mOutputVaryings   = GetShaderVariables(sh::GetOutputVaryings(compilerHandle));
+                mAllAttributes    = GetShaderVariables(sh::GetAttributes(compilerHandle));
+                mActiveAttributes = GetActiveShaderVariables(&mAllAttributes);
+                mNumViews         = sh::GetVertexShaderNumViews(compilerHandle);
+            }
+            break;
+        }
+        case ShaderType::Fragment:
+        {
+            mInputVaryings = GetShaderVariables(sh::GetInputVaryings(compilerHandle));
+            // TODO(jmadill): Figure out why we only sort in the FS, and if we need to.
+            std::sort(mInputVaryings.begin(), mInputVaryings.end(), CompareShaderVar);
+            mActiveOutputVariables =
+                GetActiveShaderVariables(sh::GetOutputVariables(compilerHandle));
+            break;
+        }
+        case ShaderType::Geometry:
+        {
+            mInputVaryings  = GetShaderVariables(sh::GetInputVaryings(compilerHandle));
+            mOutputVaryings = GetShaderVariables(sh::GetOutputVaryings(compilerHandle));
+
+            if (sh::HasValidGeometryShaderInputPrimitiveType(compilerHandle))
+            {
+                mGeometryShaderInputPrimitiveType = FromGLenum<PrimitiveMode>(
+                    sh::GetGeometryShaderInputPrimitiveType(compilerHandle));
+            }
+            if (sh::HasValidGeometryShaderOutputPrimitiveType(compilerHandle))
+            {
+                mGeometryShaderOutputPrimitiveType = FromGLenum<PrimitiveMode>(
+                    sh::GetGeometryShaderOutputPrimitiveType(compilerHandle));
+            }
+            if (sh::HasValidGeometryShaderMaxVertices(compilerHandle))
+            {
+                mGeometryShaderMaxVertices = sh::GetGeometryShaderMaxVertices(compilerHandle);
+            }
+            mGeometryShaderInvocations = sh::GetGeometryShaderInvocations(compilerHandle);
+            break;
+        }
+        default:
+            UNREACHABLE();
+    }
+}
+
+void ShaderState::serialize(BinaryOutputStream *stream) const
+{
+    stream->writeString(mTranslatedSource);
+    stream->writeInt(mShaderVersion);
+
+    for (size_t dimension = 0; dimension < mLocalSize.size(); ++dimension)
+    {
+        stream->writeInt(mLocalSize[dimension]);
+    }
+
+    WriteVariables(stream, mInputVaryings);
+    WriteVariables(stream, mOutputVaryings);
+    WriteVariables(stream, mUniforms);
+    WriteVariables(stream, mUniformBlocks);
+    WriteVariables(stream, mShaderStorageBlocks);
+    WriteVariables(stream, mAllAttributes);
+    WriteVariables(stream, mActiveAttributes);
+    WriteVariables(stream, mActiveOutputVariables);
+
+    stream->writeInt(mNumViews);
+
+    WritePrimitiveMode(stream, mGeometryShaderInputPrimitiveType);
+    WritePrimitiveMode(stream, mGeometryShaderOutputPrimitiveType);
+    stream->writeInt(mGeometryShaderMaxVertices.valid());
+    stream->writeInt(mGeometryShaderMaxVertices.value());
+    stream->writeInt(mGeometryShaderInvocations);
+}
+
+void ShaderState::deserialize(BinaryInputStream *stream)
+{
+    mTranslatedSource = stream->readString();
+    mShaderVersion    = stream->readInt<int>();
+
+    for (size_t dimension = 0; dimension < mLocalSize.size(); ++dimension)
+    {
+        mLocalSize[dimension] = stream->readInt<int>();
+    }
+
+    LoadVariables(stream, &mInputVaryings);
+    LoadVariables(stream, &mOutputVaryings);
+    LoadVariables(stream, &mUniforms);
+    LoadVariables(stream, &mUniformBlocks);
+    LoadVariables(stream, &mShaderStorageBlocks);
+    LoadVariables(stream, &mAllAttributes);
+    LoadVariables(stream, &mActiveAttributes);
+    LoadVariables(stream, &mActiveOutputVariables);
+
+    mNumViews = stream->readInt<int>();
+
+    mGeometryShaderInputPrimitiveType  = LoadPrimitiveMode(stream);
+    mGeometryShaderOutputPrimitiveType = LoadPrimitiveMode(stream);
+    bool maxVerticesValid              = stream->readBool();
+    GLint maxVertices                  = stream->readInt<GLint>();
+    mGeometryShaderMaxVertices =
+        maxVerticesValid ? Optional<GLint>(maxVertices) : Optional<GLint>::Invalid();
+    mGeometryShaderInvocations = stream->readInt<int>();
+}
+
+void ShaderState::clearCompileResults()
+{
+    mTranslatedSource.clear();
+    mShaderVersion = 100;
+    mInputVaryings.clear();
+    mOutputVaryings.clear();
+    mUniforms.clear();
+    mUniformBlocks.clear();
+    mShaderStorageBlocks.clear();
+    mAllAttributes.clear();
+    mActiveAttributes.clear();
+    mActiveOutputVariables.clear();
+    mLocalSize.fill(-1);
+    mNumViews = -1;
+    mGeometryShaderInputPrimitiveType.reset();
+    mGeometryShaderOutputPrimitiveType.reset();
+    mGeometryShaderMaxVertices.reset();
+    mGeometryShaderInvocations = 1;
+}
+
 Shader::Shader(ShaderProgramManager *manager,
                rx::GLImplFactory *implFactory,
                const gl::Limitations &rendererLimitations,
@@ -174,6 +519,8 @@ Shader::Shader(ShaderProgramManager *manager,
       mType(type),
       mRefCount(0),
       mDeleteStatus(false),
+      mCompileOptions(0),
+      mMemoryProgramCache(nullptr),
       mResourceManager(manager),
       mCurrentMaxComputeWorkGroupInvocations(0u)
 {
@@ -334,25 +681,55 @@ void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length,
     GetSourceImpl(debugInfo, bufSize, length, buffer);
 }
 
+const std::string &Shader::getTranslatedSourceWithoutOutputs(
+    const std::vector<std::string> &unusedOutputs)
+{
+    ASSERT(mType == ShaderType::Vertex);
+    resolveCompile();
+
+    if (unusedOutputs.empty() || mState.mCompileStatus != CompileStatus::COMPILED)
+    {
+        return mState.mTranslatedSource;
+    }
+
+    // A vertex shader is usually linked with the same few fragment shaders, so the translation is
+    // only done once for each set of unused outputs.
+    auto cached = mTranslatedSourcesWithoutOutputs.find(unusedOutputs);
+    if (cached != mTranslatedSourcesWithoutOutputs.end())
+    {
+        return cached->second;
+    }
+
+    ShCompilerInstance compilerInstance = mBoundCompiler->getInstance(mState.mShaderType);
+    ShHandle compilerHandle             = compilerInstance.getHandle();
+    ASSERT(compilerHandle);
+
+    std::vector<const char *> srcStrings;
+    if (!mCompiledSourcePath.empty())
+    {
+        srcStrings.push_back(mCompiledSourcePath.c_str());
+    }
+    srcStrings.push_back(mCompiledSource.c_str());
+
+    // Only the translated source is used, so the SPIR-V isn't generated again.
+    ShCompileOptions options = (mCompileOptions & ~SH_GENERATE_SPIRV);
+    options |= SH_REMOVE_UNUSED_OUTPUT_VARYINGS;
+
+    sh::SetUnusedOutputVaryings(compilerHandle, unusedOutputs);
+    bool translated = sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), options);
+    std::string translatedSource =
+        translated ? sh::GetObjectCode(compilerHandle) : mState.mTranslatedSource;
+
+    mBoundCompiler->putInstance(std::move(compilerInstance));
+    return mTranslatedSourcesWithoutOutputs[unusedOutputs] = std::move(translatedSource);
+}
+
 void Shader::compile(const Context *context)
 {
     resolveCompile();
 
-    mState.mTranslatedSource.clear();
+    mState.clearCompileResults();
     mInfoLog.clear();
-    mState.mShaderVersion = 100;
-    mState.mInputVaryings.clear();
-    mState.mOutputVaryings.clear();
-    mState.mUniforms.clear();
-    mState.mUniformBlocks.clear();
-    mState.mShaderStorageBlocks.clear();
-    mState.mActiveAttributes.clear();
-    mState.mActiveOutputVariables.clear();
-    mState.mNumViews = -1;
-    mState.mGeometryShaderInputPrimitiveType.reset();
-    mState.mGeometryShaderOutputPrimitiveType.reset();
-    mState.mGeometryShaderMaxVertices.reset();
-    mState.mGeometryShaderInvocations = 1;
 
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
     mBoundCompiler.set(context, context->getCompiler());
@@ -387,12 +764,28 @@ void Shader::compile(const Context *context)
 
     mCurrentMaxComputeWorkGroupInvocations = context->getCaps().maxComputeWorkGroupInvocations;
 
+    mCompiledSourcePath = sourcePath;
+    mCompiledSource     = source;
+    mCompileOptions     = options;
+    mTranslatedSourcesWithoutOutputs.clear();
+
     ASSERT(mBoundCompiler.get());
     mShCompilerInstance     = mBoundCompiler->getInstance(mState.mShaderType);
     ShHandle compilerHandle = mShCompilerInstance.getHandle();
     ASSERT(compilerHandle);
     mCompilerResourcesString = mShCompilerInstance.getBuiltinResourcesString();
 
+    // Skip the translator if the results of compiling the same source with the same options are
+    // in the cache. Otherwise, the results of this compile are stored when it's resolved.
+    mMemoryProgramCache = context->getMemoryProgramCache();
+    if (mMemoryProgramCache != nullptr &&
+        mMemoryProgramCache->getShader(context, this, sourcePath, source, options, &mShaderHash))
+    {
+        mMemoryProgramCache = nullptr;
+        mBoundCompiler->putInstance(std::move(mShCompilerInstance));
+        return;
+    }
+
     mWorkerPool   = context->getWorkerThreadPool();
     std::function<void(const std::string &)> compileImplFunctor;
     if (mWorkerPool->isAsync())
@@ -440,117 +833,41 @@ void Shader::resolveCompile()
         return;
     }
 
-    mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
-
-#if !defined(NDEBUG)
-    // Prefix translated shader with commented out un-translated shader.
-    // Useful in diagnostics tools which capture the shader source.
-    std::ostringstream shaderStream;
-    shaderStream << "// GLSL\n";
-    shaderStream << "//\n";
+    mState.gatherCompileResults(compilerHandle);
 
-    std::istringstream inputSourceStream(mState.mSource);
-    std::string line;
-    while (std::getline(inputSourceStream, line))
+    if (mState.mShaderType == ShaderType::Compute && mState.mLocalSize.isDeclared())
     {
-        // Remove null characters from the source line
-        line.erase(std::remove(line.begin(), line.end(), '\0'), line.end());
-
-        shaderStream << "// " << line << std::endl;
-    }
-    shaderStream << "\n\n";
-    shaderStream << mState.mTranslatedSource;
-    mState.mTranslatedSource = shaderStream.str();
-#endif  // !defined(NDEBUG)
-
-    // Gather the shader information
-    mState.mShaderVersion = sh::GetShaderVersion(compilerHandle);
+        angle::CheckedNumeric<uint32_t> checked_local_size_product(mState.mLocalSize[0]);
+        checked_local_size_product *= mState.mLocalSize[1];
+        checked_local_size_product *= mState.mLocalSize[2];
 
-    mState.mUniforms            = GetShaderVariables(sh::GetUniforms(compilerHandle));
-    mState.mUniformBlocks       = GetShaderVariables(sh::GetUniformBlocks(compilerHandle));
-    mState.mShaderStorageBlocks = GetShaderVariables(sh::GetShaderStorageBlocks(compilerHandle));
-
-    switch (mState.mShaderType)
-    {
-        case ShaderType::Compute:
-        {
-            mState.mLocalSize = sh::GetComputeShaderLocalGroupSize(compilerHandle);
-            if (mState.mLocalSize.isDeclared())
-            {
-                angle::CheckedNumeric<uint32_t> checked_local_size_product(mState.mLocalSize[0]);
-                checked_local_size_product *= mState.mLocalSize[1];
-                checked_local_size_product *= mState.mLocalSize[2];
-
-                if (!checked_local_size_product.IsValid())
-                {
-                    WARN() << std::endl
-                           << "Integer overflow when computing the product of local_size_x, "
-                           << "local_size_y and local_size_z.";
-                    mState.mCompileStatus = CompileStatus::NOT_COMPILED;
-                    return;
-                }
-                if (checked_local_size_product.ValueOrDie() >
-                    mCurrentMaxComputeWorkGroupInvocations)
-                {
-                    WARN() << std::endl
-                           << "The total number of invocations within a work group exceeds "
-                           << "MAX_COMPUTE_WORK_GROUP_INVOCATIONS.";
-                    mState.mCompileStatus = CompileStatus::NOT_COMPILED;
-                    return;
-                }
-            }
-            break;
-        }
-        case ShaderType::Vertex:
-        {
-            {
-                mState.mOutputVaryings = GetShaderVariables(sh::GetOutputVaryings(compilerHandle));
-                mState.mAllAttributes    = GetShaderVariables(sh::GetAttributes(compilerHandle));
-                mState.mActiveAttributes = GetActiveShaderVariables(&mState.mAllAttributes);
-                mState.mNumViews         = sh::GetVertexShaderNumViews(compilerHandle);
-            }
-            break;
-        }
-        case ShaderType::Fragment:
+        if (!checked_local_size_product.IsValid())
         {
-            mState.mInputVaryings = GetShaderVariables(sh::GetInputVaryings(compilerHandle));
-            // TODO(jmadill): Figure out why we only sort in the FS, and if we need to.
-            std::sort(mState.mInputVaryings.begin(), mState.mInputVaryings.end(), CompareShaderVar);
-            mState.mActiveOutputVariables =
-                GetActiveShaderVariables(sh::GetOutputVariables(compilerHandle));
-            break;
+            WARN() << std::endl
+                   << "Integer overflow when computing the product of local_size_x, "
+                   << "local_size_y and local_size_z.";
+            mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+            return;
         }
-        case ShaderType::Geometry:
+        if (checked_local_size_product.ValueOrDie() > mCurrentMaxComputeWorkGroupInvocations)
         {
-            mState.mInputVaryings  = GetShaderVariables(sh::GetInputVaryings(compilerHandle));
-            mState.mOutputVaryings = GetShaderVariables(sh::GetOutputVaryings(compilerHandle));
-
-            if (sh::HasValidGeometryShaderInputPrimitiveType(compilerHandle))
-            {
-                mState.mGeometryShaderInputPrimitiveType = FromGLenum<PrimitiveMode>(
-                    sh::GetGeometryShaderInputPrimitiveType(compilerHandle));
-            }
-            if (sh::HasValidGeometryShaderOutputPrimitiveType(compilerHandle))
-            {
-                mState.mGeometryShaderOutputPrimitiveType = FromGLenum<PrimitiveMode>(
-                    sh::GetGeometryShaderOutputPrimitiveType(compilerHandle));
-            }
-            if (sh::HasValidGeometryShaderMaxVertices(compilerHandle))
-            {
-                mState.mGeometryShaderMaxVertices =
-                    sh::GetGeometryShaderMaxVertices(compilerHandle);
-            }
-            mState.mGeometryShaderInvocations = sh::GetGeometryShaderInvocations(compilerHandle);
-            break;
+            WARN() << std::endl
+                   << "The total number of invocations within a work group exceeds "
+                   << "MAX_COMPUTE_WORK_GROUP_INVOCATIONS.";
+            mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+            return;
         }
-        default:
-            UNREACHABLE();
     }
 
     ASSERT(!mState.mTranslatedSource.empty());
 
     bool success          = mImplementation->postTranslateCompile(&mShCompilerInstance, &mInfoLog);
     mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+
+    if (success && mMemoryProgramCache != nullptr)
+    {
+        mMemoryProgramCache->putShader(mShaderHash, this);
+    }
 }
 
 void Shader::addRef()
@@ -728,4 +1045,52 @@ const std::string &Shader::getCompilerResourcesString() const
     return mCompilerResourcesString;
 }
 
+void Shader::serialize(angle::MemoryBuffer *binaryOut) const
+{
+    ASSERT(mState.mCompileStatus == CompileStatus::COMPILED);
+
+    BinaryOutputStream stream;
+
+    stream.writeBytes(reinterpret_cast<const unsigned char *>(ANGLE_COMMIT_HASH),
+                      ANGLE_COMMIT_HASH_SIZE);
+    stream.writeEnum(mType);
+
+    mState.serialize(&stream);
+    mImplementation->save(&stream);
+
+    ASSERT(binaryOut);
+    binaryOut->resize(stream.length());
+    memcpy(binaryOut->data(), stream.data(), stream.length());
+}
+
+bool Shader::deserialize(const uint8_t *binary, size_t length)
+{
+    ASSERT(mState.compilePending());
+
+    BinaryInputStream stream(binary, length);
+
+    unsigned char commitString[ANGLE_COMMIT_HASH_SIZE];
+    stream.readBytes(commitString, ANGLE_COMMIT_HASH_SIZE);
+    if (memcmp(commitString, ANGLE_COMMIT_HASH, sizeof(unsigned char) * ANGLE_COMMIT_HASH_SIZE) !=
+        0)
+    {
+        return false;
+    }
+    if (stream.readEnum<ShaderType>() != mType)
+    {
+        return false;
+    }
+
+    mState.deserialize(&stream);
+    if (stream.error() || !mImplementation->load(&stream, &mInfoLog) || stream.error())
+    {
+        mState.clearCompileResults();
+        mInfoLog.clear();
+        return false;
+    }
+
+    mState.mCompileStatus = CompileStatus::COMPILED;
+    return true;
+}
+
 }  // namespace gl
@@ -13,6 +13,7 @@
 #define LIBANGLE_SHADER_H_
 
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,6 +23,7 @@
 
 #include "common/Optional.h"
 #include "common/angleutils.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/angletypes.h"
@@ -41,9 +43,12 @@ class WorkerThreadPool;
 
 namespace gl
 {
+class BinaryInputStream;
+class BinaryOutputStream;
 class CompileTask;
 class Context;
 struct Limitations;
+class MemoryProgramCache;
 class ShaderProgramManager;
 class State;
 
@@ -86,9 +91,19 @@ class ShaderState final : angle::NonCopyable
 
     bool compilePending() const { return mCompileStatus == CompileStatus::COMPILE_REQUESTED; }
 
+    // Copies the results of a successful compile out of the translator.
+    void gatherCompileResults(ShHandle compilerHandle);
+
+    // Writes and loads the results of a successful compile, so that compiling the same shader again
+    // can load them from the program cache instead of running the translator.
+    void serialize(BinaryOutputStream *stream) const;
+    void deserialize(BinaryInputStream *stream);
+
   private:
     friend class Shader;
 
+    void clearCompileResults();
+
     std::string mLabel;
 
     ShaderType mShaderType;
@@ -151,6 +166,13 @@ class Shader final : angle::NonCopyable, public LabeledObject
     void getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer);
     void getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer);
 
+    // Translates the source of the last compile again without the vertex shader outputs in
+    // |unusedOutputs| and the code that only computes them. Returns the translated source of the
+    // last compile if there are no such outputs or if translating fails. The result is kept for
+    // each set of outputs until the shader is compiled again.
+    const std::string &getTranslatedSourceWithoutOutputs(
+        const std::vector<std::string> &unusedOutputs);
+
     void compile(const Context *context);
     bool isCompiled();
     bool isCompleted();
@@ -188,6 +210,13 @@ class Shader final : angle::NonCopyable, public LabeledObject
 
     const std::string &getCompilerResourcesString() const;
 
+    // Serializes the results of a successful compile, including those of the backend.
+    void serialize(angle::MemoryBuffer *binaryOut) const;
+
+    // Loads the results of an earlier compile of the same source with the same options. Returns
+    // false if they can't be used, in which case the shader is left to be compiled.
+    bool deserialize(const uint8_t *binary, size_t length);
+
   private:
     ~Shader() override;
     static void GetSourceImpl(const std::string &source,
@@ -214,6 +243,19 @@ class Shader final : angle::NonCopyable, public LabeledObject
     std::shared_ptr<angle::WaitableEvent> mCompileEvent;
     std::string mCompilerResourcesString;
 
+    // The source and options of the last compile, which the source of the shader may have changed
+    // since.
+    std::string mCompiledSourcePath;
+    std::string mCompiledSource;
+    ShCompileOptions mCompileOptions;
+
+    // The results of getTranslatedSourceWithoutOutputs for the last compile, by unused outputs.
+    std::map<std::vector<std::string>, std::string> mTranslatedSourcesWithoutOutputs;
+
+    // The cache the results of the pending compile are stored in, if any.
+    MemoryProgramCache *mMemoryProgramCache;
+    egl::BlobCache::Key mShaderHash;
+
     ShaderProgramManager *mResourceManager;
 
     GLuint mCurrentMaxComputeWorkGroupInvocations;
@@ -889,15 +889,19 @@ void State::setEnableFeature(GLenum feature, bool enabled)
         // GLES1 emulation
         case GL_ALPHA_TEST:
             mGLES1State.mAlphaTestEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_ALPHA_TEST);
             break;
         case GL_TEXTURE_2D:
             mGLES1State.mTexUnitEnables[mActiveSampler].set(TextureType::_2D, enabled);
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_TEXTURE_UNIT_ENABLE);
             break;
         case GL_TEXTURE_CUBE_MAP:
             mGLES1State.mTexUnitEnables[mActiveSampler].set(TextureType::CubeMap, enabled);
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_TEXTURE_UNIT_ENABLE);
             break;
         case GL_LIGHTING:
             mGLES1State.mLightingEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         case GL_LIGHT0:
         case GL_LIGHT1:
@@ -908,15 +912,19 @@ void State::setEnableFeature(GLenum feature, bool enabled)
         case GL_LIGHT6:
         case GL_LIGHT7:
             mGLES1State.mLights[feature - GL_LIGHT0].enabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_LIGHTS);
             break;
         case GL_NORMALIZE:
             mGLES1State.mNormalizeEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         case GL_RESCALE_NORMAL:
             mGLES1State.mRescaleNormalEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         case GL_COLOR_MATERIAL:
             mGLES1State.mColorMaterialEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         case GL_CLIP_PLANE0:
         case GL_CLIP_PLANE1:
@@ -925,21 +933,27 @@ void State::setEnableFeature(GLenum feature, bool enabled)
         case GL_CLIP_PLANE4:
         case GL_CLIP_PLANE5:
             mGLES1State.mClipPlanes[feature - GL_CLIP_PLANE0].enabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_CLIP_PLANES);
             break;
         case GL_FOG:
             mGLES1State.mFogEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         case GL_POINT_SMOOTH:
             mGLES1State.mPointSmoothEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         case GL_LINE_SMOOTH:
             mGLES1State.mLineSmoothEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         case GL_POINT_SPRITE_OES:
             mGLES1State.mPointSpriteEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         case GL_COLOR_LOGIC_OP:
             mGLES1State.mLogicOpEnabled = enabled;
+            mGLES1State.setDirty(GLES1State::DIRTY_GLES1_FEATURE_ENABLE);
             break;
         default:
             UNREACHABLE();
@@ -73,7 +73,7 @@ class State : angle::NonCopyable
     GLint getClientMinorVersion() const { return mClientVersion.minor; }
     const Version &getClientVersion() const { return mClientVersion; }
     const Caps &getCaps() const { return mCaps; }
-    const TextureCapsMap &getTextureCaps() const { return mTextureCaps; }
+    const TextureCapsMap &getTextureCaps() const { return *mTextureCaps; }
     const Extensions &getExtensions() const { return mExtensions; }
     const Limitations &getLimitations() const { return mLimitations; }
 
@@ -83,7 +83,7 @@ class State : angle::NonCopyable
 
     const TextureCaps &getTextureCap(GLenum internalFormat) const
     {
-        return mTextureCaps.get(internalFormat);
+        return mTextureCaps->get(internalFormat);
     }
 
     // State chunk getters
@@ -693,9 +693,10 @@ class State : angle::NonCopyable
     Version mClientVersion;
     ContextID mContext;
 
-    // Caps to use for validation
+    // Caps to use for validation. The texture caps are large, so they're shared with the other
+    // contexts created with the same attributes instead of being copied.
     Caps mCaps;
-    TextureCapsMap mTextureCaps;
+    std::shared_ptr<const TextureCapsMap> mTextureCaps;
     Extensions mExtensions;
     Limitations mLimitations;
 
@@ -11,6 +11,7 @@
 
 #include "common/PackedEnums.h"
 #include "common/angleutils.h"
+#include "common/mathutil.h"
 #include "libANGLE/Debug.h"
 
 #include "angle_gl.h"
@@ -28,6 +29,11 @@ struct Caps;
 class Context;
 class Program;
 
+// Returns the number of vertices captured by a draw call, which only includes complete primitives.
+angle::CheckedNumeric<GLsizeiptr> GetVerticesNeededForDraw(PrimitiveMode primitiveMode,
+                                                           GLsizei count,
+                                                           GLsizei primcount);
+
 class TransformFeedbackState final : angle::NonCopyable
 {
   public:
@@ -36,6 +42,7 @@ class TransformFeedbackState final : angle::NonCopyable
 
     const OffsetBindingPointer<Buffer> &getIndexedBuffer(size_t idx) const;
     const std::vector<OffsetBindingPointer<Buffer>> &getIndexedBuffers() const;
+    GLsizeiptr getVerticesDrawn() const { return mVerticesDrawn; }
 
   private:
     friend class TransformFeedback;
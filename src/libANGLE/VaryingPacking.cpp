@@ -338,6 +338,7 @@ bool VaryingPacking::collectAndPackUserVaryings(gl::InfoLog &infoLog,
         }
 
         // Keep Transform FB varyings in the merged list always.
+        const size_t packedCountBeforeCapture = mPackedVaryings.size();
         for (const std::string &tfVarying : tfVaryings)
         {
             std::vector<unsigned int> subscripts;
@@ -389,6 +390,13 @@ bool VaryingPacking::collectAndPackUserVaryings(gl::InfoLog &infoLog,
         {
             mInactiveVaryingNames.push_back(ref.first);
         }
+
+        // Nothing reads the vertex output if the fragment shader doesn't and none of it is
+        // captured.
+        if (mPackedVaryings.size() == packedCountBeforeCapture && !input->isBuiltIn())
+        {
+            mUnusedVertexOutputNames.push_back(ref.first);
+        }
     }
 
     std::sort(mPackedVaryings.begin(), mPackedVaryings.end(), ComparePackedVarying);
@@ -430,4 +438,9 @@ const std::vector<std::string> &VaryingPacking::getInactiveVaryingNames() const
 {
     return mInactiveVaryingNames;
 }
+
+const std::vector<std::string> &VaryingPacking::getUnusedVertexOutputNames() const
+{
+    return mUnusedVertexOutputNames;
+}
 }  // namespace gl
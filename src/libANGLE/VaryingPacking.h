@@ -173,6 +173,10 @@ class VaryingPacking final : angle::NonCopyable
 
     const std::vector<std::string> &getInactiveVaryingNames() const;
 
+    // The user-defined vertex shader outputs that the fragment shader doesn't read and that aren't
+    // captured with transform feedback.
+    const std::vector<std::string> &getUnusedVertexOutputNames() const;
+
   private:
     bool packVarying(const PackedVarying &packedVarying);
     bool isFree(unsigned int registerRow,
@@ -187,6 +191,7 @@ class VaryingPacking final : angle::NonCopyable
     std::vector<PackedVaryingRegister> mRegisterList;
     std::vector<PackedVarying> mPackedVaryings;
     std::vector<std::string> mInactiveVaryingNames;
+    std::vector<std::string> mUnusedVertexOutputNames;
 
     PackMode mPackMode;
 };
@@ -160,6 +160,73 @@ TEST_P(VaryingPackingTest, MaxPlusOneMat2VaryingsFailsWebGL)
     ASSERT_FALSE(packVaryingsStrict(kMaxVaryings, varyings));
 }
 
+// Test that the vertex outputs that the fragment shader doesn't read and that aren't captured with
+// transform feedback are the unused ones.
+TEST_P(VaryingPackingTest, UnusedVertexOutputs)
+{
+    std::vector<sh::Varying> vertexOutputs  = MakeVaryings(GL_FLOAT, 4, 0);
+    std::vector<sh::Varying> fragmentInputs = MakeVaryings(GL_FLOAT, 2, 0);
+    fragmentInputs[1].staticUse             = false;
+
+    sh::Varying pointSize;
+    pointSize.type       = GL_FLOAT;
+    pointSize.precision  = GL_MEDIUM_FLOAT;
+    pointSize.name       = "gl_PointSize";
+    pointSize.mappedName = "gl_PointSize";
+    pointSize.staticUse  = true;
+    vertexOutputs.push_back(pointSize);
+
+    ProgramMergedVaryings mergedVaryings;
+    for (const sh::Varying &varying : vertexOutputs)
+    {
+        mergedVaryings[varying.name].vertex = &varying;
+    }
+    for (const sh::Varying &varying : fragmentInputs)
+    {
+        mergedVaryings[varying.name].fragment = &varying;
+    }
+
+    VaryingPacking varyingPacking(kMaxVaryings, PackMode::ANGLE_RELAXED);
+    InfoLog infoLog;
+    ASSERT_TRUE(varyingPacking.collectAndPackUserVaryings(infoLog, mergedVaryings,
+                                                          {vertexOutputs[3].name}));
+
+    // The output that is declared but not statically used in the fragment shader is unused too.
+    std::vector<std::string> expected = {vertexOutputs[1].name, vertexOutputs[2].name};
+    EXPECT_EQ(expected, varyingPacking.getUnusedVertexOutputNames());
+}
+
+// Test that a struct vertex output is used if only one of its fields is captured with transform
+// feedback.
+TEST_P(VaryingPackingTest, CapturedStructFieldIsUsed)
+{
+    sh::ShaderVariable field;
+    field.type       = GL_FLOAT;
+    field.precision  = GL_MEDIUM_FLOAT;
+    field.name       = "field";
+    field.mappedName = "field";
+    field.staticUse  = true;
+
+    sh::Varying vertexOutput;
+    vertexOutput.type          = GL_NONE;
+    vertexOutput.name          = "outputStruct";
+    vertexOutput.mappedName    = "outputStruct";
+    vertexOutput.structName    = "S";
+    vertexOutput.staticUse     = true;
+    vertexOutput.interpolation = sh::INTERPOLATION_SMOOTH;
+    vertexOutput.fields.push_back(field);
+
+    ProgramMergedVaryings mergedVaryings;
+    mergedVaryings[vertexOutput.name].vertex = &vertexOutput;
+
+    VaryingPacking varyingPacking(kMaxVaryings, PackMode::ANGLE_RELAXED);
+    InfoLog infoLog;
+    ASSERT_TRUE(varyingPacking.collectAndPackUserVaryings(infoLog, mergedVaryings,
+                                                          {"outputStruct.field"}));
+
+    EXPECT_TRUE(varyingPacking.getUnusedVertexOutputNames().empty());
+}
+
 // Makes separate tests for different values of kMaxVaryings.
 INSTANTIATE_TEST_CASE_P(, VaryingPackingTest, ::testing::Values(1, 4, 8));
 
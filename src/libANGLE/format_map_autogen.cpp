@@ -1,20 +1,315 @@
 // GENERATED FILE - DO NOT EDIT.
 // Generated by gen_format_map.py using data from format_map_data.json.
 // ES3 format info from es3_format_type_combinations.json.
+// Internal format index from formatutils.cpp.
 //
-// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
 // format_map:
 //   Determining the sized internal format from a (format,type) pair.
-//   Also check es3 format combinations for validity.
+//   Also check es3 format combinations for validity, and index the InternalFormat table.
 
 #include "angle_gl.h"
 #include "common/debug.h"
+#include "libANGLE/formatutils.h"
 
 namespace gl
 {
+namespace
+{
+// Perfect hash of the internal formats in formatutils.cpp. The bucket of a
+// format selects the seed that places every format of that bucket in a distinct slot.
+constexpr uint32_t kInternalFormatHashBucketShift = 27;
+constexpr uint32_t kInternalFormatHashSlotShift   = 24;
+
+constexpr uint16_t kInternalFormatHashSeeds[32] = {
+    2, 3, 21, 0, 20, 0, 5, 1, 1, 1, 1, 4, 26, 22, 17, 8,
+    0, 4, 18, 2, 2, 3, 29, 0, 25, 0, 3, 1, 19, 1, 28, 0,
+};
+
+constexpr GLenum kInternalFormatHashKeys[256] = {
+    GL_RG8UI,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR,
+    GL_NONE,
+    GL_RGB16I,
+    GL_COMPRESSED_SIGNED_RG11_EAC,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR,
+    GL_DEPTH_COMPONENT,
+    GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_EXT,
+    GL_RG16UI,
+    GL_COMPRESSED_RGBA_ASTC_5x5_KHR,
+    GL_NONE,
+    GL_NONE,
+    GL_RG16I,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR,
+    GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE,
+    GL_RGBA16I,
+    GL_NONE,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR,
+    GL_RED,
+    GL_NONE,
+    GL_COMPRESSED_RGBA_ASTC_8x5_KHR,
+    GL_NONE,
+    GL_ETC1_RGB8_OES,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_STENCIL_INDEX8,
+    GL_NONE,
+    GL_COMPRESSED_RG11_EAC,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR,
+    GL_BGRA8_SRGB_ANGLEX,
+    GL_RGB16UI,
+    GL_COMPRESSED_RGBA_ASTC_8x6_KHR,
+    GL_NONE,
+    GL_RGB565,
+    GL_R8UI,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_RGB8I,
+    GL_NONE,
+    GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE,
+    GL_RGBA8UI,
+    GL_R16_EXT,
+    GL_NONE,
+    GL_DEPTH_COMPONENT32_OES,
+    GL_RGBA8_SNORM,
+    GL_R8,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_RGB_INTEGER,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR,
+    GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,
+    GL_LUMINANCE_ALPHA,
+    GL_NONE,
+    GL_COMPRESSED_RGBA_ASTC_6x5_KHR,
+    GL_NONE,
+    GL_COMPRESSED_SRGB_S3TC_DXT1_EXT,
+    GL_RG8,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_RGBA8_ETC2_EAC,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR,
+    GL_NONE,
+    GL_RGB8UI,
+    GL_NONE,
+    GL_RGB8,
+    GL_RGB16_SNORM_EXT,
+    GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,
+    GL_R16F,
+    GL_NONE,
+    GL_R8_SNORM,
+    GL_R11F_G11F_B10F,
+    GL_RGBA32F,
+    GL_NONE,
+    GL_RGBA,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_RGBA_ASTC_12x10_KHR,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_RGBA_ASTC_10x5_KHR,
+    GL_NONE,
+    GL_NONE,
+    GL_RED_INTEGER,
+    GL_LUMINANCE32F_EXT,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR,
+    GL_NONE,
+    GL_NONE,
+    GL_RGB32F,
+    GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE,
+    GL_NONE,
+    GL_SRGB,
+    GL_NONE,
+    GL_NONE,
+    GL_RGB9_E5,
+    GL_NONE,
+    GL_RGB16F,
+    GL_NONE,
+    GL_NONE,
+    GL_RGB32I,
+    GL_COMPRESSED_SRGB8_ETC2,
+    GL_RGB5_A1,
+    GL_NONE,
+    GL_RG32F,
+    GL_NONE,
+    GL_BGR5_A1_ANGLEX,
+    GL_RGB8_SNORM,
+    GL_NONE,
+    GL_LUMINANCE_ALPHA16F_EXT,
+    GL_NONE,
+    GL_ALPHA,
+    GL_NONE,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR,
+    GL_RGB10_A2,
+    GL_BGRX8_ANGLEX,
+    GL_R16UI,
+    GL_COMPRESSED_RGBA_ASTC_5x4_KHR,
+    GL_NONE,
+    GL_NONE,
+    GL_R8I,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR,
+    GL_NONE,
+    GL_ETC1_RGB8_LOSSY_DECODE_ANGLE,
+    GL_NONE,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR,
+    GL_RGBA16_EXT,
+    GL_NONE,
+    GL_RG8I,
+    GL_COMPRESSED_RGBA_ASTC_4x4_KHR,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,
+    GL_NONE,
+    GL_BGR565_ANGLEX,
+    GL_COMPRESSED_RGBA_BPTC_UNORM_EXT,
+    GL_RG32I,
+    GL_COMPRESSED_RGBA_ASTC_6x6_KHR,
+    GL_DEPTH_COMPONENT24,
+    GL_STENCIL,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE,
+    GL_NONE,
+    GL_COMPRESSED_R11_EAC,
+    GL_LUMINANCE8_ALPHA8_EXT,
+    GL_NONE,
+    GL_BGRA_EXT,
+    GL_RG_INTEGER,
+    GL_NONE,
+    GL_DEPTH_COMPONENT16,
+    GL_RG,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+    GL_NONE,
+    GL_RG32UI,
+    GL_NONE,
+    GL_DEPTH_STENCIL,
+    GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT,
+    GL_RG16_EXT,
+    GL_NONE,
+    GL_RG8_SNORM,
+    GL_NONE,
+    GL_RGBA8I,
+    GL_COMPRESSED_RGB8_ETC2,
+    GL_NONE,
+    GL_RGB,
+    GL_NONE,
+    GL_COMPRESSED_RGBA_ASTC_10x8_KHR,
+    GL_RGB10_A2UI,
+    GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,
+    GL_RG16F,
+    GL_BGRA8_EXT,
+    GL_NONE,
+    GL_NONE,
+    GL_RGBA32I,
+    GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2,
+    GL_NONE,
+    GL_LUMINANCE,
+    GL_NONE,
+    GL_COMPRESSED_RGBA_ASTC_10x6_KHR,
+    GL_R16_SNORM_EXT,
+    GL_NONE,
+    GL_R32F,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_SIGNED_R11_EAC,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR,
+    GL_COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE,
+    GL_RGBA16UI,
+    GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,
+    GL_COMPRESSED_RGBA_ASTC_12x12_KHR,
+    GL_RGBA16_SNORM_EXT,
+    GL_RGBA32UI,
+    GL_R16I,
+    GL_NONE,
+    GL_NONE,
+    GL_DEPTH24_STENCIL8,
+    GL_LUMINANCE_ALPHA32F_EXT,
+    GL_NONE,
+    GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE,
+    GL_NONE,
+    GL_ALPHA32F_EXT,
+    GL_NONE,
+    GL_RG16_SNORM_EXT,
+    GL_RGB32UI,
+    GL_COMPRESSED_RGBA_ASTC_8x8_KHR,
+    GL_ALPHA8_EXT,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR,
+    GL_NONE,
+    GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT_EXT,
+    GL_ALPHA16F_EXT,
+    GL_RGB16_EXT,
+    GL_NONE,
+    GL_R32UI,
+    GL_COMPRESSED_RGBA_ASTC_10x10_KHR,
+    GL_LUMINANCE8_EXT,
+    GL_NONE,
+    GL_RGBA_INTEGER,
+    GL_LUMINANCE16F_EXT,
+    GL_NONE,
+    GL_NONE,
+    GL_NONE,
+    GL_DEPTH32F_STENCIL8,
+    GL_RGBA8,
+    GL_SRGB_ALPHA_EXT,
+    GL_R32I,
+    GL_NONE,
+    GL_NONE,
+    GL_SRGB8,
+    GL_NONE,
+    GL_RGBA16F,
+    GL_NONE,
+    GL_NONE,
+    GL_DEPTH_COMPONENT32F,
+    GL_NONE,
+    GL_BGRA4_ANGLEX,
+    GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT_EXT,
+    GL_NONE,
+    GL_RGBA4,
+    GL_NONE,
+    GL_SRGB8_ALPHA8,
+};
+
+constexpr uint8_t kInternalFormatHashIndices[256] = {
+    25, 109, 153, 32, 74, 114, 150, 119, 27, 92, 153, 0, 26, 116, 125, 38,
+    153, 104, 136, 153, 95, 153, 85, 153, 153, 153, 122, 153, 73, 117, 45, 33,
+    96, 153, 7, 19, 153, 153, 153, 30, 153, 83, 37, 128, 153, 59, 11, 1,
+    153, 153, 153, 145, 106, 82, 149, 153, 93, 153, 86, 3, 153, 153, 153, 79,
+    107, 153, 31, 153, 5, 133, 89, 48, 153, 2, 16, 55, 153, 139, 153, 153,
+    102, 153, 153, 98, 153, 153, 143, 69, 110, 153, 153, 54, 84, 153, 140, 153,
+    153, 17, 153, 50, 153, 153, 34, 76, 9, 153, 53, 153, 44, 6, 153, 67,
+    153, 147, 153, 113, 12, 46, 21, 91, 153, 153, 18, 112, 153, 123, 153, 108,
+    134, 153, 24, 90, 153, 153, 153, 115, 153, 153, 80, 153, 47, 118, 28, 94,
+    57, 152, 153, 153, 126, 153, 71, 64, 153, 142, 144, 153, 56, 137, 153, 153,
+    153, 153, 153, 81, 153, 29, 153, 151, 88, 130, 153, 4, 153, 36, 75, 153,
+    138, 153, 100, 13, 87, 49, 42, 153, 153, 40, 78, 153, 148, 153, 99, 129,
+    153, 52, 153, 153, 153, 72, 105, 124, 39, 77, 103, 135, 41, 20, 153, 153,
+    60, 70, 153, 127, 153, 68, 153, 131, 35, 97, 62, 153, 153, 153, 111, 153,
+    121, 65, 132, 153, 23, 101, 63, 153, 146, 66, 153, 153, 153, 61, 10, 141,
+    22, 153, 153, 14, 153, 51, 153, 153, 58, 153, 43, 120, 153, 8, 153, 15,
+};
+}  // anonymous namespace
+
+static_assert(kInternalFormatCount == 153,
+              "kInternalFormatCount doesn't match formatutils.cpp");
 
 GLenum GetSizedFormatInternal(GLenum format, GLenum type)
 {
@@ -1607,4 +1902,18 @@ bool ValidES3FormatCombination(GLenum format, GLenum type, GLenum internalFormat
     return false;
 }
 
+size_t GetInternalFormatIndex(GLenum internalFormat)
+{
+    uint32_t bucket = (internalFormat * 0x9E3779B1u) >> kInternalFormatHashBucketShift;
+    uint32_t slot   = ((internalFormat ^ kInternalFormatHashSeeds[bucket]) * 0x85EBCA6Bu) >>
+                    kInternalFormatHashSlotShift;
+
+    // Unused slots hold GL_NONE, whose own slot is always used.
+    if (kInternalFormatHashKeys[slot] != internalFormat)
+    {
+        return kInvalidInternalFormatIndex;
+    }
+    return kInternalFormatHashIndices[slot];
+}
+
 }  // namespace gl
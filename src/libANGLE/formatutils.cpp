@@ -24,9 +24,6 @@ GLenum GetSizedFormatInternal(GLenum format, GLenum type);
 
 namespace
 {
-using InternalFormatInfoMap =
-    std::unordered_map<GLenum, std::unordered_map<GLenum, InternalFormat>>;
-
 bool CheckedMathResult(const CheckedNumeric<GLuint> &value, GLuint *resultOut)
 {
     if (!value.IsValid())
@@ -542,14 +539,23 @@ bool InternalFormat::operator!=(const InternalFormat &other) const
     return !(*this == other);
 }
 
-void InsertFormatInfo(InternalFormatInfoMap *map, const InternalFormat &formatInfo)
+void InsertFormatInfo(InternalFormatInfoTable *map, const InternalFormat &formatInfo)
 {
-    ASSERT(!formatInfo.sized || (*map).count(formatInfo.internalFormat) == 0);
-    ASSERT((*map)[formatInfo.internalFormat].count(formatInfo.type) == 0);
-    (*map)[formatInfo.internalFormat][formatInfo.type] = formatInfo;
+    // gen_format_map.py indexes the formats added by BuildInternalFormatInfoTable. Rerun it after
+    // adding a format.
+    size_t index = GetInternalFormatIndex(formatInfo.internalFormat);
+    ASSERT(index != kInvalidInternalFormatIndex);
+
+    std::vector<InternalFormat> &typeInfos = (*map)[index];
+    ASSERT(!formatInfo.sized || typeInfos.empty());
+    for (const InternalFormat &typeInfo : typeInfos)
+    {
+        ASSERT(typeInfo.type != formatInfo.type);
+    }
+    typeInfos.push_back(formatInfo);
 }
 
-void AddRGBAFormat(InternalFormatInfoMap *map,
+void AddRGBAFormat(InternalFormatInfoTable *map,
                    GLenum internalFormat,
                    bool sized,
                    GLuint red,
@@ -591,7 +597,7 @@ void AddRGBAFormat(InternalFormatInfoMap *map,
     InsertFormatInfo(map, formatInfo);
 }
 
-static void AddLUMAFormat(InternalFormatInfoMap *map,
+static void AddLUMAFormat(InternalFormatInfoTable *map,
                           GLenum internalFormat,
                           bool sized,
                           GLuint luminance,
@@ -625,7 +631,7 @@ static void AddLUMAFormat(InternalFormatInfoMap *map,
     InsertFormatInfo(map, formatInfo);
 }
 
-void AddDepthStencilFormat(InternalFormatInfoMap *map,
+void AddDepthStencilFormat(InternalFormatInfoTable *map,
                            GLenum internalFormat,
                            bool sized,
                            GLuint depthBits,
@@ -660,7 +666,7 @@ void AddDepthStencilFormat(InternalFormatInfoMap *map,
     InsertFormatInfo(map, formatInfo);
 }
 
-void AddCompressedFormat(InternalFormatInfoMap *map,
+void AddCompressedFormat(InternalFormatInfoTable *map,
                          GLenum internalFormat,
                          GLuint compressedBlockWidth,
                          GLuint compressedBlockHeight,
@@ -705,12 +711,12 @@ void AddCompressedFormat(InternalFormatInfoMap *map,
 //
 // TODO(ynovikov): http://anglebug.com/2846 Verify support fields of BGRA, depth, stencil
 // and compressed formats. Perform texturable check as part of filterable and attachment checks.
-static InternalFormatInfoMap BuildInternalFormatInfoMap()
+static InternalFormatInfoTable BuildInternalFormatInfoTable()
 {
-    InternalFormatInfoMap map;
+    InternalFormatInfoTable map;
 
     // From ES 3.0.1 spec, table 3.12
-    map[GL_NONE][GL_NONE] = InternalFormat();
+    InsertFormatInfo(&map, InternalFormat());
 
     // clang-format off
 
@@ -994,9 +1000,9 @@ static InternalFormatInfoMap BuildInternalFormatInfoMap()
     return map;
 }
 
-static const InternalFormatInfoMap &GetInternalFormatMap()
+const InternalFormatInfoTable &GetInternalFormatInfoTable()
 {
-    static const InternalFormatInfoMap formatMap = BuildInternalFormatInfoMap();
+    static const InternalFormatInfoTable formatMap = BuildInternalFormatInfoTable();
     return formatMap;
 }
 
@@ -1004,17 +1010,17 @@ static FormatSet BuildAllSizedInternalFormatSet()
 {
     FormatSet result;
 
-    for (const auto &internalFormat : GetInternalFormatMap())
+    for (const std::vector<InternalFormat> &typeInfos : GetInternalFormatInfoTable())
     {
-        for (const auto &type : internalFormat.second)
+        for (const InternalFormat &info : typeInfos)
         {
-            if (type.second.sized)
+            if (info.sized)
             {
                 // TODO(jmadill): Fix this hack.
-                if (internalFormat.first == GL_BGR565_ANGLEX)
+                if (info.internalFormat == GL_BGR565_ANGLEX)
                     continue;
 
-                result.insert(internalFormat.first);
+                result.insert(info.internalFormat);
             }
         }
     }
@@ -1080,16 +1086,20 @@ uint32_t GetPackedTypeInfo(GLenum type)
 const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    auto iter                              = formatMap.find(internalFormat);
+    size_t index = GetInternalFormatIndex(internalFormat);
+    if (index == kInvalidInternalFormatIndex)
+    {
+        return defaultInternalFormat;
+    }
 
     // Sized internal formats only have one type per entry
-    if (iter == formatMap.end() || iter->second.size() != 1)
+    const std::vector<InternalFormat> &typeInfos = GetInternalFormatInfoTable()[index];
+    if (typeInfos.size() != 1)
     {
         return defaultInternalFormat;
     }
 
-    const InternalFormat &internalFormatInfo = iter->second.begin()->second;
+    const InternalFormat &internalFormatInfo = typeInfos[0];
     if (!internalFormatInfo.sized)
     {
         return defaultInternalFormat;
@@ -1101,27 +1111,30 @@ const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, GLenum type)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-
-    auto internalFormatIter = formatMap.find(internalFormat);
-    if (internalFormatIter == formatMap.end())
+    size_t index = GetInternalFormatIndex(internalFormat);
+    if (index == kInvalidInternalFormatIndex)
     {
         return defaultInternalFormat;
     }
 
+    const std::vector<InternalFormat> &typeInfos = GetInternalFormatInfoTable()[index];
+
     // If the internal format is sized, simply return it without the type check.
-    if (internalFormatIter->second.size() == 1 && internalFormatIter->second.begin()->second.sized)
+    if (typeInfos.size() == 1 && typeInfos[0].sized)
     {
-        return internalFormatIter->second.begin()->second;
+        return typeInfos[0];
     }
 
-    auto typeIter = internalFormatIter->second.find(type);
-    if (typeIter == internalFormatIter->second.end())
+    // Unsized internal formats accept a handful of types at most.
+    for (const InternalFormat &info : typeInfos)
     {
-        return defaultInternalFormat;
+        if (info.type == type)
+        {
+            return info;
+        }
     }
 
-    return typeIter->second;
+    return defaultInternalFormat;
 }
 
 GLuint InternalFormat::computePixelBytes(GLenum formatType) const
@@ -2213,8 +2226,8 @@ size_t GetVertexFormatSize(angle::FormatID vertexFormatID)
 
 bool ValidES3InternalFormat(GLenum internalFormat)
 {
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    return internalFormat != GL_NONE && formatMap.find(internalFormat) != formatMap.end();
+    return internalFormat != GL_NONE &&
+           GetInternalFormatIndex(internalFormat) != kInvalidInternalFormatIndex;
 }
 
 VertexFormat::VertexFormat(GLenum typeIn,
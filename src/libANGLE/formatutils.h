@@ -10,8 +10,10 @@
 #define LIBANGLE_FORMATUTILS_H_
 
 #include <stdint.h>
+#include <array>
 #include <cstddef>
 #include <ostream>
+#include <vector>
 
 #include "angle_gl.h"
 #include "libANGLE/Caps.h"
@@ -197,6 +199,18 @@ struct Format
 const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat);
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, GLenum type);
 
+// The InternalFormat table holds one entry per type accepted by each internal format, indexed by
+// GetInternalFormatIndex. Sized internal formats have exactly one entry. gen_format_map.py
+// generates the index from the formats BuildInternalFormatInfoTable adds, and
+// format_map_autogen.cpp checks the count.
+constexpr size_t kInternalFormatCount        = 153;
+constexpr size_t kInvalidInternalFormatIndex = kInternalFormatCount;
+using InternalFormatInfoTable = std::array<std::vector<InternalFormat>, kInternalFormatCount>;
+const InternalFormatInfoTable &GetInternalFormatInfoTable();
+
+// Implemented in format_map_autogen.cpp. Returns kInvalidInternalFormatIndex for unknown formats.
+size_t GetInternalFormatIndex(GLenum internalFormat);
+
 // Strip sizing information from an internal format.  Doesn't necessarily validate that the internal
 // format is valid.
 GLenum GetUnsizedFormat(GLenum internalFormat);
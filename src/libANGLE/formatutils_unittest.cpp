@@ -0,0 +1,143 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// formatutils_unittest.cpp: Tests the generated internal format index against the nested
+// std::unordered_map lookups it replaced.
+
+#include <set>
+#include <unordered_map>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/formatutils.h"
+
+using namespace gl;
+
+namespace
+{
+// Larger than every GL enum used as an internal format or type.
+constexpr GLenum kMaxEnumToTest = 0x10000;
+
+using ReferenceFormatMap =
+    std::unordered_map<GLenum, std::unordered_map<GLenum, const InternalFormat *>>;
+
+ReferenceFormatMap BuildReferenceFormatMap()
+{
+    ReferenceFormatMap map;
+    for (const std::vector<InternalFormat> &typeInfos : GetInternalFormatInfoTable())
+    {
+        for (const InternalFormat &info : typeInfos)
+        {
+            map[info.internalFormat][info.type] = &info;
+        }
+    }
+    return map;
+}
+
+// The previous implementation of GetSizedInternalFormatInfo, returning nullptr for the default.
+const InternalFormat *ReferenceGetSizedInternalFormatInfo(const ReferenceFormatMap &map,
+                                                          GLenum internalFormat)
+{
+    auto iter = map.find(internalFormat);
+    if (iter == map.end() || iter->second.size() != 1)
+    {
+        return nullptr;
+    }
+
+    const InternalFormat *info = iter->second.begin()->second;
+    return info->sized ? info : nullptr;
+}
+
+// The previous implementation of GetInternalFormatInfo, returning nullptr for the default.
+const InternalFormat *ReferenceGetInternalFormatInfo(const ReferenceFormatMap &map,
+                                                     GLenum internalFormat,
+                                                     GLenum type)
+{
+    auto internalFormatIter = map.find(internalFormat);
+    if (internalFormatIter == map.end())
+    {
+        return nullptr;
+    }
+
+    if (internalFormatIter->second.size() == 1 && internalFormatIter->second.begin()->second->sized)
+    {
+        return internalFormatIter->second.begin()->second;
+    }
+
+    auto typeIter = internalFormatIter->second.find(type);
+    return typeIter == internalFormatIter->second.end() ? nullptr : typeIter->second;
+}
+
+void ExpectSameInfo(const InternalFormat *expected, const InternalFormat &actual)
+{
+    if (expected)
+    {
+        EXPECT_EQ(expected, &actual);
+    }
+    else
+    {
+        EXPECT_EQ(InternalFormat(), actual);
+    }
+}
+
+// Tests that every internal format has exactly one index, and that no other enum has one.
+TEST(FormatUtilsTest, InternalFormatIndexIsPerfect)
+{
+    const InternalFormatInfoTable &table = GetInternalFormatInfoTable();
+    std::vector<int> indexHits(kInternalFormatCount, 0);
+
+    for (GLenum value = 0; value < kMaxEnumToTest; ++value)
+    {
+        size_t index = GetInternalFormatIndex(value);
+        if (index == kInvalidInternalFormatIndex)
+        {
+            continue;
+        }
+
+        ASSERT_LT(index, kInternalFormatCount);
+        ASSERT_FALSE(table[index].empty()) << "No InternalFormat entry for 0x" << std::hex << value;
+        EXPECT_EQ(value, table[index][0].internalFormat);
+        indexHits[index]++;
+    }
+
+    for (size_t index = 0; index < kInternalFormatCount; ++index)
+    {
+        EXPECT_EQ(1, indexHits[index]) << "Index " << index;
+    }
+
+    EXPECT_EQ(kInvalidInternalFormatIndex, GetInternalFormatIndex(0xFFFFFFFFu));
+}
+
+// Tests that lookups through the index match lookups through a nested std::unordered_map.
+TEST(FormatUtilsTest, LookupsMatchUnorderedMap)
+{
+    ReferenceFormatMap referenceMap = BuildReferenceFormatMap();
+
+    std::set<GLenum> types = {GL_NONE, GL_RGBA};
+    for (const auto &internalFormat : referenceMap)
+    {
+        for (const auto &type : internalFormat.second)
+        {
+            types.insert(type.first);
+        }
+    }
+
+    for (GLenum internalFormat = 0; internalFormat < kMaxEnumToTest; ++internalFormat)
+    {
+        ExpectSameInfo(ReferenceGetSizedInternalFormatInfo(referenceMap, internalFormat),
+                       GetSizedInternalFormatInfo(internalFormat));
+
+        bool referenceValid =
+            internalFormat != GL_NONE && referenceMap.find(internalFormat) != referenceMap.end();
+        EXPECT_EQ(referenceValid, ValidES3InternalFormat(internalFormat));
+
+        for (GLenum type : types)
+        {
+            ExpectSameInfo(ReferenceGetInternalFormatInfo(referenceMap, internalFormat, type),
+                           GetInternalFormatInfo(internalFormat, type));
+        }
+    }
+}
+}  // anonymous namespace
@@ -5,9 +5,11 @@
 #
 # gen_format_map.py:
 #  Code generation for GL format map. The format map matches between
-#  {format,type} and internal format.
+#  {format,type} and internal format. Also generates the perfect hash that
+#  gives each internal format a dense index into the InternalFormat table.
 
 from datetime import date
+import re
 import sys
 
 sys.path.append('renderer')
@@ -16,6 +18,7 @@ import angle_format
 template_cpp = """// GENERATED FILE - DO NOT EDIT.
 // Generated by {script_name} using data from {data_source_name}.
 // ES3 format info from {es3_data_source_name}.
+// Internal format index from {internal_format_data_source_name}.
 //
 // Copyright {copyright_year} The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
@@ -23,13 +26,33 @@ template_cpp = """// GENERATED FILE - DO NOT EDIT.
 //
 // format_map:
 //   Determining the sized internal format from a (format,type) pair.
-//   Also check es3 format combinations for validity.
+//   Also check es3 format combinations for validity, and index the InternalFormat table.
 
 #include "angle_gl.h"
 #include "common/debug.h"
+#include "libANGLE/formatutils.h"
 
 namespace gl
 {{
+namespace
+{{
+// Perfect hash of the internal formats in {internal_format_data_source_name}. The bucket of a
+// format selects the seed that places every format of that bucket in a distinct slot.
+constexpr uint32_t kInternalFormatHashBucketShift = {bucket_shift};
+constexpr uint32_t kInternalFormatHashSlotShift   = {slot_shift};
+
+constexpr uint16_t kInternalFormatHashSeeds[{bucket_count}] = {{
+{hash_seeds}}};
+
+constexpr GLenum kInternalFormatHashKeys[{slot_count}] = {{
+{hash_keys}}};
+
+constexpr {index_type} kInternalFormatHashIndices[{slot_count}] = {{
+{hash_indices}}};
+}}  // anonymous namespace
+
+static_assert(kInternalFormatCount == {internal_format_count},
+              "kInternalFormatCount doesn't match {internal_format_data_source_name}");
 
 GLenum GetSizedFormatInternal(GLenum format, GLenum type)
 {{
@@ -81,6 +104,20 @@ bool ValidES3FormatCombination(GLenum format, GLenum type, GLenum internalFormat
     return false;
 }}
 
+size_t GetInternalFormatIndex(GLenum internalFormat)
+{{
+    uint32_t bucket = (internalFormat * {bucket_multiplier}u) >> kInternalFormatHashBucketShift;
+    uint32_t slot   = ((internalFormat ^ kInternalFormatHashSeeds[bucket]) * {slot_multiplier}u) >>
+                    kInternalFormatHashSlotShift;
+
+    // Unused slots hold GL_NONE, whose own slot is always used.
+    if (kInternalFormatHashKeys[slot] != internalFormat)
+    {{
+        return kInvalidInternalFormatIndex;
+    }}
+    return kInternalFormatHashIndices[slot];
+}}
+
 }}  // namespace gl
 """
 
@@ -121,6 +158,90 @@ def parse_format_case(format, type_map):
     return template_format_case.format(
         format = format, type_cases = type_cases)
 
+# Both multipliers are odd, so each hash step is a bijection on 32-bit values.
+hash_bucket_multiplier = 0x9E3779B1
+hash_slot_multiplier = 0x85EBCA6B
+hash_bucket_bits = 5
+hash_slot_bits = 8
+
+# Headers that define the values of the GL enums used as internal formats.
+gl_enum_headers = [
+    '../../include/GLES2/gl2.h',
+    '../../include/GLES2/gl2ext.h',
+    '../../include/GLES2/gl2ext_angle.h',
+    '../../include/GLES3/gl3.h',
+    '../../include/GLES3/gl31.h',
+    '../../include/GLES3/gl32.h',
+    '../common/angleutils.h',
+]
+
+def load_gl_enum_values(headers):
+    values = {'GL_NONE': 0}
+    define_re = re.compile(r'^#define\s+(GL_\w+)\s+(0x[0-9A-Fa-f]+)\s*$', re.MULTILINE)
+    for header in headers:
+        with open(header) as header_file:
+            for name, value in define_re.findall(header_file.read()):
+                values[name] = int(value, 16)
+    return values
+
+def load_internal_formats(format_table_source):
+    # Index the formats in the order BuildInternalFormatInfoTable first adds them. Its first
+    # entry is the default InternalFormat, for GL_NONE.
+    with open(format_table_source) as source_file:
+        source = source_file.read()
+    start = source.index('static InternalFormatInfoTable BuildInternalFormatInfoTable()')
+    body = source[start:source.index('\n}\n', start)]
+    internal_formats = ['GL_NONE']
+    for internal_format in re.findall(r'\bAdd\w+Format\(&map,\s*(GL_\w+)', body):
+        if internal_format not in internal_formats:
+            internal_formats.append(internal_format)
+    return internal_formats
+
+def hash_bucket(value):
+    return ((value * hash_bucket_multiplier) & 0xFFFFFFFF) >> (32 - hash_bucket_bits)
+
+def hash_slot(value, seed):
+    return (((value ^ seed) * hash_slot_multiplier) & 0xFFFFFFFF) >> (32 - hash_slot_bits)
+
+def build_perfect_hash(internal_formats, enum_values):
+    # Hash and displace: place the largest buckets first, searching for a seed that puts all of
+    # a bucket's keys in distinct free slots.
+    buckets = [[] for _ in range(1 << hash_bucket_bits)]
+    for index, internal_format in enumerate(internal_formats):
+        value = enum_values[internal_format]
+        buckets[hash_bucket(value)].append((value, internal_format, index))
+
+    slot_count = 1 << hash_slot_bits
+    keys = ['GL_NONE'] * slot_count
+    indices = [len(internal_formats)] * slot_count
+    used = [False] * slot_count
+    seeds = [0] * len(buckets)
+
+    for bucket_index in sorted(range(len(buckets)), key = lambda b: (-len(buckets[b]), b)):
+        bucket = buckets[bucket_index]
+        for seed in range(1 << 16):
+            slots = [hash_slot(value, seed) for value, _, _ in bucket]
+            if len(set(slots)) == len(slots) and not any(used[slot] for slot in slots):
+                break
+        else:
+            raise Exception('No perfect hash seed found; increase hash_slot_bits')
+
+        seeds[bucket_index] = seed
+        for slot, (_, internal_format, index) in zip(slots, bucket):
+            used[slot] = True
+            keys[slot] = internal_format
+            indices[slot] = index
+
+    # GL_NONE must have a slot of its own, since unused slots hold it as a key.
+    assert keys[hash_slot(0, seeds[hash_bucket(0)])] == 'GL_NONE'
+    return seeds, keys, indices
+
+def format_table(entries, per_line):
+    lines = ""
+    for start in range(0, len(entries), per_line):
+        lines += "    " + " ".join(entry + "," for entry in entries[start:start + per_line]) + "\n"
+    return lines
+
 input_script = 'format_map_data.json'
 
 format_map = angle_format.load_json(input_script)
@@ -173,6 +294,11 @@ for format, type_combos in combos.iteritems():
     es3_combo_cases += template_format_case.format(
         format = format, type_cases = this_type_cases)
 
+internal_format_data_file = 'formatutils.cpp'
+internal_formats = load_internal_formats(internal_format_data_file)
+
+seeds, keys, indices = build_perfect_hash(internal_formats, load_gl_enum_values(gl_enum_headers))
+
 with open('format_map_autogen.cpp', 'wt') as out_file:
     output_cpp = template_cpp.format(
         script_name = sys.argv[0],
@@ -182,5 +308,17 @@ with open('format_map_autogen.cpp', 'wt') as out_file:
         format_cases = format_cases,
         es3_format_cases = es3_format_cases,
         es3_type_cases = es3_type_cases,
-        es3_combo_cases = es3_combo_cases)
+        es3_combo_cases = es3_combo_cases,
+        internal_format_data_source_name = internal_format_data_file,
+        internal_format_count = len(internal_formats),
+        bucket_shift = 32 - hash_bucket_bits,
+        slot_shift = 32 - hash_slot_bits,
+        bucket_count = len(seeds),
+        slot_count = len(keys),
+        bucket_multiplier = '0x%08X' % hash_bucket_multiplier,
+        slot_multiplier = '0x%08X' % hash_slot_multiplier,
+        index_type = 'uint8_t' if len(internal_formats) < 256 else 'uint16_t',
+        hash_seeds = format_table([str(seed) for seed in seeds], 16),
+        hash_keys = format_table(keys, 1),
+        hash_indices = format_table([str(index) for index in indices], 16))
     out_file.write(output_cpp)
@@ -33,6 +33,11 @@ class ExternalImageSiblingImpl : public FramebufferAttachmentObjectImpl
   public:
     ~ExternalImageSiblingImpl() override {}
 
+    // Called when the owning EGL image is initialized and destroyed, for back-ends that need the
+    // display to import the buffer into their own objects.
+    virtual egl::Error initialize(const egl::Display *display);
+    virtual void onDestroy(const egl::Display *display) {}
+
     virtual gl::Format getFormat() const                        = 0;
     virtual bool isRenderable(const gl::Context *context) const = 0;
     virtual bool isTexturable(const gl::Context *context) const = 0;
@@ -40,6 +45,11 @@ class ExternalImageSiblingImpl : public FramebufferAttachmentObjectImpl
     virtual size_t getSamples() const                           = 0;
 };
 
+inline egl::Error ExternalImageSiblingImpl::initialize(const egl::Display *display)
+{
+    return egl::NoError();
+}
+
 class ImageImpl : angle::NonCopyable
 {
   public:
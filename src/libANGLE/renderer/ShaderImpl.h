@@ -34,6 +34,14 @@ class ShaderImpl : angle::NonCopyable
     // Returns success for compiling on the driver. Returns success.
     virtual bool postTranslateCompile(gl::ShCompilerInstance *compiler, std::string *infoLog) = 0;
 
+    // Writes what postTranslateCompile gathered from the translator, so that compiling the same
+    // shader again can load it from the program cache instead of running the translator.
+    virtual void save(gl::BinaryOutputStream *stream) const = 0;
+
+    // Called instead of postTranslateCompile when the results of the compile are loaded from the
+    // program cache. Returns success.
+    virtual bool load(gl::BinaryInputStream *stream, std::string *infoLog) = 0;
+
     virtual std::string getDebugInfo() const = 0;
 
     const gl::ShaderState &getData() const { return mData; }
@@ -9,6 +9,7 @@
 #include "libANGLE/renderer/d3d/ShaderD3D.h"
 
 #include "common/utilities.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Shader.h"
@@ -19,6 +20,32 @@
 namespace rx
 {
 
+namespace
+{
+void WriteRegisterMap(gl::BinaryOutputStream *stream,
+                      const std::map<std::string, unsigned int> &registerMap)
+{
+    stream->writeInt(registerMap.size());
+    for (const auto &nameAndRegister : registerMap)
+    {
+        stream->writeString(nameAndRegister.first);
+        stream->writeInt(nameAndRegister.second);
+    }
+}
+
+void LoadRegisterMap(gl::BinaryInputStream *stream,
+                     std::map<std::string, unsigned int> *registerMap)
+{
+    registerMap->clear();
+    size_t count = stream->readInt<size_t>();
+    for (size_t index = 0; index < count && !stream->error(); ++index)
+    {
+        std::string name     = stream->readString();
+        (*registerMap)[name] = stream->readInt<unsigned int>();
+    }
+}
+}  // anonymous namespace
+
 ShaderD3D::ShaderD3D(const gl::ShaderState &data,
                      const angle::WorkaroundsD3D &workarounds,
                      const gl::Extensions &extensions)
@@ -203,26 +230,6 @@ bool ShaderD3D::postTranslateCompile(gl::ShCompilerInstance *compiler, std::stri
     // TODO(jmadill): We shouldn't need to cache this.
     mCompilerOutputType = compiler->getShaderOutputType();
 
-    const std::string &translatedSource = mData.getTranslatedSource();
-
-    mUsesMultipleRenderTargets = translatedSource.find("GL_USES_MRT") != std::string::npos;
-    mUsesFragColor             = translatedSource.find("GL_USES_FRAG_COLOR") != std::string::npos;
-    mUsesFragData              = translatedSource.find("GL_USES_FRAG_DATA") != std::string::npos;
-    mUsesFragCoord             = translatedSource.find("GL_USES_FRAG_COORD") != std::string::npos;
-    mUsesFrontFacing           = translatedSource.find("GL_USES_FRONT_FACING") != std::string::npos;
-    mUsesPointSize             = translatedSource.find("GL_USES_POINT_SIZE") != std::string::npos;
-    mUsesPointCoord            = translatedSource.find("GL_USES_POINT_COORD") != std::string::npos;
-    mUsesDepthRange            = translatedSource.find("GL_USES_DEPTH_RANGE") != std::string::npos;
-    mUsesFragDepth             = translatedSource.find("GL_USES_FRAG_DEPTH") != std::string::npos;
-    mHasANGLEMultiviewEnabled =
-        translatedSource.find("GL_ANGLE_MULTIVIEW_ENABLED") != std::string::npos;
-    mUsesViewID = translatedSource.find("GL_USES_VIEW_ID") != std::string::npos;
-    mUsesDiscardRewriting =
-        translatedSource.find("ANGLE_USES_DISCARD_REWRITING") != std::string::npos;
-    mUsesNestedBreak = translatedSource.find("ANGLE_USES_NESTED_BREAK") != std::string::npos;
-    mRequiresIEEEStrictCompiling =
-        translatedSource.find("ANGLE_REQUIRES_IEEE_STRICT_COMPILING") != std::string::npos;
-
     ShHandle compilerHandle = compiler->getHandle();
 
     mUniformRegisterMap = GetUniformRegisterMap(sh::GetUniformRegisterMap(compilerHandle));
@@ -257,12 +264,78 @@ bool ShaderD3D::postTranslateCompile(gl::ShCompilerInstance *compiler, std::stri
         }
     }
 
+    parseTranslatedSource();
+    return true;
+}
+
+void ShaderD3D::save(gl::BinaryOutputStream *stream) const
+{
+    stream->writeEnum(mCompilerOutputType);
+    WriteRegisterMap(stream, mUniformRegisterMap);
+    WriteRegisterMap(stream, mUniformBlockRegisterMap);
+    WriteRegisterMap(stream, mShaderStorageBlockRegisterMap);
+    stream->writeInt(mReadonlyImage2DRegisterIndex);
+    stream->writeInt(mImage2DRegisterIndex);
+
+    stream->writeInt(mUsedImage2DFunctionNames.size());
+    for (const std::string &functionName : mUsedImage2DFunctionNames)
+    {
+        stream->writeString(functionName);
+    }
+}
+
+bool ShaderD3D::load(gl::BinaryInputStream *stream, std::string *infoLog)
+{
+    mCompilerOutputType = stream->readEnum<ShShaderOutput>();
+    LoadRegisterMap(stream, &mUniformRegisterMap);
+    LoadRegisterMap(stream, &mUniformBlockRegisterMap);
+    LoadRegisterMap(stream, &mShaderStorageBlockRegisterMap);
+    mReadonlyImage2DRegisterIndex = stream->readInt<unsigned int>();
+    mImage2DRegisterIndex         = stream->readInt<unsigned int>();
+
+    mUsedImage2DFunctionNames.clear();
+    size_t functionNameCount = stream->readInt<size_t>();
+    for (size_t index = 0; index < functionNameCount && !stream->error(); ++index)
+    {
+        mUsedImage2DFunctionNames.insert(stream->readString());
+    }
+
+    if (stream->error())
+    {
+        return false;
+    }
+
+    parseTranslatedSource();
+    return true;
+}
+
+void ShaderD3D::parseTranslatedSource()
+{
+    const std::string &translatedSource = mData.getTranslatedSource();
+
+    mUsesMultipleRenderTargets = translatedSource.find("GL_USES_MRT") != std::string::npos;
+    mUsesFragColor             = translatedSource.find("GL_USES_FRAG_COLOR") != std::string::npos;
+    mUsesFragData              = translatedSource.find("GL_USES_FRAG_DATA") != std::string::npos;
+    mUsesFragCoord             = translatedSource.find("GL_USES_FRAG_COORD") != std::string::npos;
+    mUsesFrontFacing           = translatedSource.find("GL_USES_FRONT_FACING") != std::string::npos;
+    mUsesPointSize             = translatedSource.find("GL_USES_POINT_SIZE") != std::string::npos;
+    mUsesPointCoord            = translatedSource.find("GL_USES_POINT_COORD") != std::string::npos;
+    mUsesDepthRange            = translatedSource.find("GL_USES_DEPTH_RANGE") != std::string::npos;
+    mUsesFragDepth             = translatedSource.find("GL_USES_FRAG_DEPTH") != std::string::npos;
+    mHasANGLEMultiviewEnabled =
+        translatedSource.find("GL_ANGLE_MULTIVIEW_ENABLED") != std::string::npos;
+    mUsesViewID = translatedSource.find("GL_USES_VIEW_ID") != std::string::npos;
+    mUsesDiscardRewriting =
+        translatedSource.find("ANGLE_USES_DISCARD_REWRITING") != std::string::npos;
+    mUsesNestedBreak = translatedSource.find("ANGLE_USES_NESTED_BREAK") != std::string::npos;
+    mRequiresIEEEStrictCompiling =
+        translatedSource.find("ANGLE_REQUIRES_IEEE_STRICT_COMPILING") != std::string::npos;
+
     mDebugInfo +=
         std::string("// ") + gl::GetShaderTypeString(mData.getShaderType()) + " SHADER BEGIN\n";
     mDebugInfo += "\n// GLSL BEGIN\n\n" + mData.getSource() + "\n\n// GLSL END\n\n\n";
     mDebugInfo += "// INITIAL HLSL BEGIN\n\n" + translatedSource + "\n// INITIAL HLSL END\n\n\n";
     // Successive steps will append more info
-    return true;
 }
 
 }  // namespace rx
@@ -43,6 +43,8 @@ class ShaderD3D : public ShaderImpl
                                                    std::stringstream *sourceStream,
                                                    std::string *sourcePath) override;
     bool postTranslateCompile(gl::ShCompilerInstance *compiler, std::string *infoLog) override;
+    void save(gl::BinaryOutputStream *stream) const override;
+    bool load(gl::BinaryInputStream *stream, std::string *infoLog) override;
     std::string getDebugInfo() const override;
 
     // D3D-specific methods
@@ -78,6 +80,9 @@ class ShaderD3D : public ShaderImpl
     ShShaderOutput getCompilerOutputType() const;
 
   private:
+    // Sets the flags that depend on the translated source and starts the debug info.
+    void parseTranslatedSource();
+
     bool mUsesMultipleRenderTargets;
     bool mUsesFragColor;
     bool mUsesFragData;
@@ -9,7 +9,11 @@
 
 #include "libANGLE/renderer/gl/ContextGL.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "libANGLE/Context.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/gl/BufferGL.h"
 #include "libANGLE/renderer/gl/CompilerGL.h"
 #include "libANGLE/renderer/gl/FenceNVGL.h"
@@ -28,23 +32,69 @@
 #include "libANGLE/renderer/gl/TextureGL.h"
 #include "libANGLE/renderer/gl/TransformFeedbackGL.h"
 #include "libANGLE/renderer/gl/VertexArrayGL.h"
+#include "libANGLE/renderer/renderer_utils.h"
 
 namespace rx
 {
+namespace
+{
+int ClampToHistogramSample(uint64_t value)
+{
+    return static_cast<int>(std::min<uint64_t>(value, std::numeric_limits<int>::max()));
+}
+}  // anonymous namespace
 
 ContextGL::ContextGL(const gl::State &state,
                      gl::ErrorSet *errorSet,
                      const std::shared_ptr<RendererGL> &renderer)
-    : ContextImpl(state, errorSet), mRenderer(renderer)
+    : ContextImpl(state, errorSet),
+      mDrawCallCount(0),
+      mBindingCallCountAtCreation(0),
+      mRenderer(renderer)
 {}
 
 ContextGL::~ContextGL() {}
 
 angle::Result ContextGL::initialize()
 {
+    mBindingCallCountAtCreation = getStateManager()->getBindingCallCount();
+
+#if defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+    const CallCounterTableGL *callCounterTable = getFunctions()->getCallCounterTable();
+    if (callCounterTable)
+    {
+        mCallCountersAtCreation = callCounterTable->getCounters();
+    }
+#endif  // defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+
     return angle::Result::Continue;
 }
 
+void ContextGL::onDestroy(const gl::Context *context)
+{
+    // The state manager is shared with the other contexts of the display, so only the binding calls
+    // made while this context existed are reported.
+    if (mDrawCallCount > 0)
+    {
+        uint64_t bindingCalls =
+            getStateManager()->getBindingCallCount() - mBindingCallCountAtCreation;
+        ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.GLBindingCalls", ClampToHistogramSample(bindingCalls));
+        ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.GLDrawCalls", ClampToHistogramSample(mDrawCallCount));
+    }
+
+#if defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+    // The counters are shared with the other contexts of the display, so they aren't reset. Only
+    // the calls made while this context existed are reported.
+    const CallCounterTableGL *callCounterTable = getFunctions()->getCallCounterTable();
+    if (callCounterTable)
+    {
+        DumpCallCounters(
+            GetCallCountersSince(callCounterTable->getCounters(), mCallCountersAtCreation),
+            callCounterTable->isTimingEnabled());
+    }
+#endif  // defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+}
+
 CompilerImpl *ContextGL::createCompiler()
 {
     return new CompilerGL(getFunctions());
@@ -183,6 +233,8 @@ ANGLE_INLINE angle::Result ContextGL::setDrawArraysState(const gl::Context *cont
                                                          GLsizei count,
                                                          GLsizei instanceCount)
 {
+    mDrawCallCount++;
+
     if (context->getStateCache().hasAnyActiveClientAttrib())
     {
         const gl::State &glState   = context->getState();
@@ -211,6 +263,8 @@ ANGLE_INLINE angle::Result ContextGL::setDrawElementsState(const gl::Context *co
                                                            GLsizei instanceCount,
                                                            const void **outIndices)
 {
+    mDrawCallCount++;
+
     const gl::State &glState = context->getState();
 
     const gl::Program *program = glState.getProgram();
@@ -241,6 +295,8 @@ ANGLE_INLINE angle::Result ContextGL::setDrawElementsState(const gl::Context *co
 
 ANGLE_INLINE angle::Result ContextGL::setDrawIndirectState(const gl::Context *context)
 {
+    mDrawCallCount++;
+
     if (context->getExtensions().webglCompatibility)
     {
         const gl::State &glState     = context->getState();
@@ -384,6 +440,83 @@ angle::Result ContextGL::drawElementsIndirect(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+bool ContextGL::canUseNativeMultiDraw(const gl::Context *context, bool isIndexed) const
+{
+    const gl::State &glState   = context->getState();
+    const gl::Program *program = glState.getProgram();
+
+    // gl_DrawID is emulated with a uniform that is updated between sub-draws, multiview and client
+    // side data need per-draw state setup, and transform feedback needs per-draw accounting.
+    if (program->hasDrawIDUniform() || program->usesMultiview() ||
+        context->getStateCache().hasAnyActiveClientAttrib() ||
+        context->getStateCache().isTransformFeedbackActiveUnpaused())
+    {
+        return false;
+    }
+
+    return !isIndexed || glState.getVertexArray()->getElementArrayBuffer() != nullptr;
+}
+
+angle::Result ContextGL::multiDrawArrays(const gl::Context *context,
+                                         gl::PrimitiveMode mode,
+                                         const GLint *firsts,
+                                         const GLsizei *counts,
+                                         GLsizei drawcount)
+{
+    const FunctionsGL *functions = getFunctions();
+    if (!functions->multiDrawArrays || !canUseNativeMultiDraw(context, false))
+    {
+        return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
+    }
+
+    ANGLE_TRY(setDrawIndirectState(context));
+    functions->multiDrawArrays(ToGLenum(mode), firsts, counts, drawcount);
+    return angle::Result::Continue;
+}
+
+angle::Result ContextGL::multiDrawArraysInstanced(const gl::Context *context,
+                                                  gl::PrimitiveMode mode,
+                                                  const GLint *firsts,
+                                                  const GLsizei *counts,
+                                                  const GLsizei *instanceCounts,
+                                                  GLsizei drawcount)
+{
+    // There is no native entry point for this without staging the draws in an indirect buffer.
+    return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts, instanceCounts,
+                                               drawcount);
+}
+
+angle::Result ContextGL::multiDrawElements(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLsizei *counts,
+                                           gl::DrawElementsType type,
+                                           const GLvoid *const *indices,
+                                           GLsizei drawcount)
+{
+    const FunctionsGL *functions = getFunctions();
+    if (!functions->multiDrawElements || !canUseNativeMultiDraw(context, true))
+    {
+        return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
+    }
+
+    ANGLE_TRY(setDrawIndirectState(context));
+    functions->multiDrawElements(ToGLenum(mode), counts, ToGLenum(type), indices, drawcount);
+    return angle::Result::Continue;
+}
+
+angle::Result ContextGL::multiDrawElementsInstanced(const gl::Context *context,
+                                                    gl::PrimitiveMode mode,
+                                                    const GLsizei *counts,
+                                                    gl::DrawElementsType type,
+                                                    const GLvoid *const *indices,
+                                                    const GLsizei *instanceCounts,
+                                                    GLsizei drawcount)
+{
+    // There is no native entry point for this without staging the draws in an indirect buffer.
+    return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
+                                                 instanceCounts, drawcount);
+}
+
 void ContextGL::stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask)
 {
     mRenderer->stencilFillPath(mState, path, fillMode, mask);
@@ -13,6 +13,10 @@
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/gl/RendererGL.h"
 
+#if defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+#    include "libANGLE/renderer/gl/call_counters.h"
+#endif  // defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+
 namespace sh
 {
 struct BlockMemberInfo;
@@ -36,6 +40,7 @@ class ContextGL : public ContextImpl
     ~ContextGL() override;
 
     angle::Result initialize() override;
+    void onDestroy(const gl::Context *context) override;
 
     // Shader creation
     CompilerImpl *createCompiler() override;
@@ -116,6 +121,32 @@ class ContextGL : public ContextImpl
                                        gl::DrawElementsType type,
                                        const void *indirect) override;
 
+    // ANGLE_multi_draw
+    angle::Result multiDrawArrays(const gl::Context *context,
+                                  gl::PrimitiveMode mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  GLsizei drawcount) override;
+    angle::Result multiDrawArraysInstanced(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLint *firsts,
+                                           const GLsizei *counts,
+                                           const GLsizei *instanceCounts,
+                                           GLsizei drawcount) override;
+    angle::Result multiDrawElements(const gl::Context *context,
+                                    gl::PrimitiveMode mode,
+                                    const GLsizei *counts,
+                                    gl::DrawElementsType type,
+                                    const GLvoid *const *indices,
+                                    GLsizei drawcount) override;
+    angle::Result multiDrawElementsInstanced(const gl::Context *context,
+                                             gl::PrimitiveMode mode,
+                                             const GLsizei *counts,
+                                             gl::DrawElementsType type,
+                                             const GLvoid *const *indices,
+                                             const GLsizei *instanceCounts,
+                                             GLsizei drawcount) override;
+
     // CHROMIUM_path_rendering implementation
     void stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask) override;
     void stencilStrokePath(const gl::Path *path, GLint reference, GLuint mask) override;
@@ -228,6 +259,19 @@ class ContextGL : public ContextImpl
 
     angle::Result setDrawIndirectState(const gl::Context *context);
 
+    // Whether the sub-draws of a multi-draw call can be issued with a single native call.
+    bool canUseNativeMultiDraw(const gl::Context *context, bool isIndexed) const;
+
+    // Number of draws set up by this context, and the binding call count of the display's state
+    // manager when it was created.  Reported when the context is destroyed.
+    uint64_t mDrawCallCount;
+    uint64_t mBindingCallCountAtCreation;
+
+#if defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+    // The native call counts of the display when this context was created.
+    CallCountersGL mCallCountersAtCreation;
+#endif  // defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+
   protected:
     std::shared_ptr<RendererGL> mRenderer;
 };
@@ -14,6 +14,10 @@
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 
+#if defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+#    include "libANGLE/renderer/gl/call_counters.h"
+#endif  // defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+
 namespace rx
 {
 
@@ -194,6 +198,10 @@ void FunctionsGL::initialize(const egl::AttributeMap &displayAttributes)
     {
         initProcsSharedExtensions(extensionSet);
     }
+
+#if defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+    mCallCounterTable = CallCounterTableGL::Install(this);
+#endif  // defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
 }
 
 bool FunctionsGL::isAtLeastGL(const gl::Version &glVersion) const
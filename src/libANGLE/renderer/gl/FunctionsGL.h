@@ -9,6 +9,8 @@
 #ifndef LIBANGLE_RENDERER_GL_FUNCTIONSGL_H_
 #define LIBANGLE_RENDERER_GL_FUNCTIONSGL_H_
 
+#include <memory>
+
 #include "common/debug.h"
 #include "libANGLE/Version.h"
 #include "libANGLE/renderer/gl/DispatchTableGL_autogen.h"
@@ -22,6 +24,7 @@ class AttributeMap;
 
 namespace rx
 {
+class CallCounterTableGL;
 
 enum StandardGL
 {
@@ -52,9 +55,19 @@ class FunctionsGL : public DispatchTableGL
     bool hasGLExtension(const std::string &ext) const;
     bool hasGLESExtension(const std::string &ext) const;
 
+#if defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+    // Counts the native calls made through this table. Null if they aren't counted.
+    const CallCounterTableGL *getCallCounterTable() const { return mCallCounterTable.get(); }
+#endif  // defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+
   private:
     void *loadProcAddress(const std::string &function) const override = 0;
     void initializeDummyFunctionsForNULLDriver(const std::set<std::string> &extensionSet);
+
+#if defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
+    // The loaded functions that the call counting hooks in this table forward to.
+    std::unique_ptr<CallCounterTableGL> mCallCounterTable;
+#endif  // defined(ANGLE_ENABLE_GL_CALL_COUNTERS)
 };
 
 }  // namespace rx
@@ -210,6 +210,21 @@ bool ShaderGL::postTranslateCompile(gl::ShCompilerInstance *compiler, std::strin
     return true;
 }
 
+void ShaderGL::save(gl::BinaryOutputStream *stream) const {}
+
+bool ShaderGL::load(gl::BinaryInputStream *stream, std::string *infoLog)
+{
+    // Only the translator is skipped. The driver compiles the translated source again.
+    compileAndCheckShader(mData.getTranslatedSource().c_str());
+    if (mCompileStatus == GL_FALSE)
+    {
+        *infoLog = mInfoLog;
+        return false;
+    }
+
+    return true;
+}
+
 std::string ShaderGL::getDebugInfo() const
 {
     return mData.getTranslatedSource();
@@ -34,6 +34,8 @@ class ShaderGL : public ShaderImpl
                                                    std::string *sourcePath) override;
     void compileAsync(const std::string &source) override;
     bool postTranslateCompile(gl::ShCompilerInstance *compiler, std::string *infoLog) override;
+    void save(gl::BinaryOutputStream *stream) const override;
+    bool load(gl::BinaryInputStream *stream, std::string *infoLog) override;
     std::string getDebugInfo() const override;
 
     GLuint getShaderID() const;
@@ -159,6 +159,9 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions,
       mPathStencilMask(std::numeric_limits<GLuint>::max()),
       mIsSideBySideDrawFramebuffer(false),
       mIsMultiviewEnabled(extensions.multiview),
+      mSupportsMultiBind(functions->isAtLeastGL(gl::Version(4, 4)) ||
+                         functions->hasGLExtension("GL_ARB_multi_bind")),
+      mBindingCallCount(0),
       mProvokingVertex(GL_LAST_VERTEX_CONVENTION),
       mLocalDirtyBits()
 {
@@ -380,6 +383,7 @@ void StateManagerGL::bindBuffer(gl::BufferBinding target, GLuint buffer)
     if (mBuffers[target] != buffer)
     {
         mBuffers[target] = buffer;
+        mBindingCallCount++;
         mFunctions->bindBuffer(gl::ToGLenum(target), buffer);
     }
 }
@@ -394,6 +398,7 @@ void StateManagerGL::bindBufferBase(gl::BufferBinding target, size_t index, GLui
         binding.buffer = buffer;
         binding.offset = static_cast<size_t>(-1);
         binding.size   = static_cast<size_t>(-1);
+        mBindingCallCount++;
         mFunctions->bindBufferBase(gl::ToGLenum(target), static_cast<GLuint>(index), buffer);
     }
 }
@@ -410,6 +415,7 @@ void StateManagerGL::bindBufferRange(gl::BufferBinding target,
         binding.buffer = buffer;
         binding.offset = offset;
         binding.size   = size;
+        mBindingCallCount++;
         mFunctions->bindBufferRange(gl::ToGLenum(target), static_cast<GLuint>(index), buffer,
                                     offset, size);
     }
@@ -420,6 +426,7 @@ void StateManagerGL::activeTexture(size_t unit)
     if (mTextureUnitIndex != unit)
     {
         mTextureUnitIndex = unit;
+        mBindingCallCount++;
         mFunctions->activeTexture(GL_TEXTURE0 + static_cast<GLenum>(mTextureUnitIndex));
     }
 }
@@ -429,6 +436,7 @@ void StateManagerGL::bindTexture(gl::TextureType type, GLuint texture)
     if (mTextures[type][mTextureUnitIndex] != texture)
     {
         mTextures[type][mTextureUnitIndex] = texture;
+        mBindingCallCount++;
         mFunctions->bindTexture(ToGLenum(type), texture);
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
     }
@@ -439,6 +447,7 @@ void StateManagerGL::bindSampler(size_t unit, GLuint sampler)
     if (mSamplers[unit] != sampler)
     {
         mSamplers[unit] = sampler;
+        mBindingCallCount++;
         mFunctions->bindSampler(static_cast<GLuint>(unit), sampler);
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_SAMPLER_BINDINGS);
     }
@@ -462,6 +471,7 @@ void StateManagerGL::bindImageTexture(size_t unit,
         binding.layer   = layer;
         binding.access  = access;
         binding.format  = format;
+        mBindingCallCount++;
         mFunctions->bindImageTexture(angle::base::checked_cast<GLuint>(unit), texture, level,
                                      layered, layer, access, format);
     }
@@ -820,27 +830,96 @@ void StateManagerGL::updateProgramTextureBindings(const gl::Context *context)
     const gl::ActiveTextureMask &activeTextures    = program->getActiveSamplersMask();
     const gl::ActiveTextureTypeArray &textureTypes = program->getActiveSamplerTypes();
 
+    // Only units whose shadowed binding differs are touched, so unchanged units don't cost a
+    // glActiveTexture either.
+    gl::ActiveTextureMask changedUnits;
+    gl::ActiveTextureArray<GLuint> textureIDs;
+
     for (size_t textureUnitIndex : activeTextures)
     {
         gl::TextureType textureType = textureTypes[textureUnitIndex];
         gl::Texture *texture        = textures[textureUnitIndex];
 
         // A nullptr texture indicates incomplete.
+        GLuint textureID = 0;
         if (texture != nullptr)
         {
             const TextureGL *textureGL = GetImplAs<TextureGL>(texture);
             ASSERT(!texture->hasAnyDirtyBit());
             ASSERT(!textureGL->hasAnyDirtyBit());
 
-            activeTexture(textureUnitIndex);
-            bindTexture(textureType, textureGL->getTextureID());
+            textureID = textureGL->getTextureID();
         }
-        else
+
+        if (mTextures[textureType][textureUnitIndex] != textureID)
+        {
+            textureIDs[textureUnitIndex] = textureID;
+            changedUnits.set(textureUnitIndex);
+        }
+    }
+
+    if (changedUnits.none())
+    {
+        return;
+    }
+
+    if (mSupportsMultiBind)
+    {
+        bindTexturesForDraw(changedUnits, textureTypes, textureIDs);
+        return;
+    }
+
+    for (size_t textureUnitIndex : changedUnits)
+    {
+        activeTexture(textureUnitIndex);
+        bindTexture(textureTypes[textureUnitIndex], textureIDs[textureUnitIndex]);
+    }
+}
+
+void StateManagerGL::bindTexturesForDraw(const gl::ActiveTextureMask &changedUnits,
+                                         const gl::ActiveTextureTypeArray &textureTypes,
+                                         const gl::ActiveTextureArray<GLuint> &textureIDs)
+{
+    // glBindTextures binds each texture to its own target, so consecutive units can be sent in a
+    // single call. Binding zero through it would reset every target of the unit, which the
+    // shadowed state doesn't track, so those units still go through glBindTexture.
+    size_t first = 0;
+    size_t count = 0;
+
+    auto flushRange = [this, &textureIDs](size_t rangeFirst, size_t rangeCount) {
+        if (rangeCount > 0)
+        {
+            mBindingCallCount++;
+            mFunctions->bindTextures(static_cast<GLuint>(rangeFirst),
+                                     static_cast<GLsizei>(rangeCount), &textureIDs[rangeFirst]);
+        }
+    };
+
+    for (size_t textureUnitIndex : changedUnits)
+    {
+        gl::TextureType textureType = textureTypes[textureUnitIndex];
+        GLuint textureID            = textureIDs[textureUnitIndex];
+
+        if (textureID == 0)
         {
             activeTexture(textureUnitIndex);
             bindTexture(textureType, 0);
+            continue;
+        }
+
+        if (count == 0 || textureUnitIndex != first + count)
+        {
+            flushRange(first, count);
+            first = textureUnitIndex;
+            count = 0;
         }
+        count++;
+
+        mTextures[textureType][textureUnitIndex] = textureID;
     }
+
+    flushRange(first, count);
+    mLocalDirtyBits.set(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
 }
 
 void StateManagerGL::updateProgramStorageBufferBindings(const gl::Context *context)
@@ -852,6 +931,7 @@ void StateManagerGL::updateProgramStorageBufferBindings(const gl::Context *conte
     if (!program)
         return;
 
+    PendingBufferRanges pendingRanges;
     for (size_t blockIndex = 0; blockIndex < program->getActiveShaderStorageBlockCount();
          blockIndex++)
     {
@@ -860,19 +940,11 @@ void StateManagerGL::updateProgramStorageBufferBindings(const gl::Context *conte
 
         if (shaderStorageBuffer.get() != nullptr)
         {
-            BufferGL *bufferGL = GetImplAs<BufferGL>(shaderStorageBuffer.get());
-
-            if (shaderStorageBuffer.getSize() == 0)
-            {
-                bindBufferBase(gl::BufferBinding::ShaderStorage, binding, bufferGL->getBufferID());
-            }
-            else
-            {
-                bindBufferRange(gl::BufferBinding::ShaderStorage, binding, bufferGL->getBufferID(),
-                                shaderStorageBuffer.getOffset(), shaderStorageBuffer.getSize());
-            }
+            addPendingBufferBinding(gl::BufferBinding::ShaderStorage, binding, shaderStorageBuffer,
+                                    &pendingRanges);
         }
     }
+    bindPendingBufferRanges(gl::BufferBinding::ShaderStorage, &pendingRanges);
 }
 
 void StateManagerGL::updateProgramUniformBufferBindings(const gl::Context *context)
@@ -885,6 +957,7 @@ void StateManagerGL::updateProgramUniformBufferBindings(const gl::Context *conte
     if (!program)
         return;
 
+    PendingBufferRanges pendingRanges;
     for (size_t uniformBlockIndex = 0; uniformBlockIndex < program->getActiveUniformBlockCount();
          uniformBlockIndex++)
     {
@@ -893,19 +966,11 @@ void StateManagerGL::updateProgramUniformBufferBindings(const gl::Context *conte
 
         if (uniformBuffer.get() != nullptr)
         {
-            BufferGL *bufferGL = GetImplAs<BufferGL>(uniformBuffer.get());
-
-            if (uniformBuffer.getSize() == 0)
-            {
-                bindBufferBase(gl::BufferBinding::Uniform, binding, bufferGL->getBufferID());
-            }
-            else
-            {
-                bindBufferRange(gl::BufferBinding::Uniform, binding, bufferGL->getBufferID(),
-                                uniformBuffer.getOffset(), uniformBuffer.getSize());
-            }
+            addPendingBufferBinding(gl::BufferBinding::Uniform, binding, uniformBuffer,
+                                    &pendingRanges);
         }
     }
+    bindPendingBufferRanges(gl::BufferBinding::Uniform, &pendingRanges);
 }
 
 void StateManagerGL::updateProgramAtomicCounterBufferBindings(const gl::Context *context)
@@ -917,6 +982,7 @@ void StateManagerGL::updateProgramAtomicCounterBufferBindings(const gl::Context
     if (!program)
         return;
 
+    PendingBufferRanges pendingRanges;
     for (const auto &atomicCounterBuffer : program->getState().getAtomicCounterBuffers())
     {
         GLuint binding     = atomicCounterBuffer.binding;
@@ -924,19 +990,106 @@ void StateManagerGL::updateProgramAtomicCounterBufferBindings(const gl::Context
 
         if (buffer.get() != nullptr)
         {
-            BufferGL *bufferGL = GetImplAs<BufferGL>(buffer.get());
+            addPendingBufferBinding(gl::BufferBinding::AtomicCounter, binding, buffer,
+                                    &pendingRanges);
+        }
+    }
+    bindPendingBufferRanges(gl::BufferBinding::AtomicCounter, &pendingRanges);
+}
 
-            if (buffer.getSize() == 0)
-            {
-                bindBufferBase(gl::BufferBinding::AtomicCounter, binding, bufferGL->getBufferID());
-            }
-            else
-            {
-                bindBufferRange(gl::BufferBinding::AtomicCounter, binding, bufferGL->getBufferID(),
-                                buffer.getOffset(), buffer.getSize());
-            }
+void StateManagerGL::addPendingBufferBinding(gl::BufferBinding target,
+                                             GLuint index,
+                                             const gl::OffsetBindingPointer<gl::Buffer> &binding,
+                                             PendingBufferRanges *pendingRanges)
+{
+    BufferGL *bufferGL = GetImplAs<BufferGL>(binding.get());
+    GLuint bufferID    = bufferGL->getBufferID();
+
+    // Whole-buffer bindings have no multi-bind equivalent that follows the buffer's size.
+    if (binding.getSize() == 0)
+    {
+        bindBufferBase(target, index, bufferID);
+        return;
+    }
+
+    size_t offset = static_cast<size_t>(binding.getOffset());
+    size_t size   = static_cast<size_t>(binding.getSize());
+
+    if (!mSupportsMultiBind)
+    {
+        bindBufferRange(target, index, bufferID, offset, size);
+        return;
+    }
+
+    const IndexedBufferBinding &current = mIndexedBuffers[target][index];
+    if (current.buffer != bufferID || current.offset != offset || current.size != size)
+    {
+        pendingRanges->push_back({index, bufferID, offset, size});
+    }
+}
+
+void StateManagerGL::bindPendingBufferRanges(gl::BufferBinding target,
+                                             PendingBufferRanges *pendingRanges)
+{
+    if (pendingRanges->empty())
+    {
+        return;
+    }
+
+    std::sort(pendingRanges->begin(), pendingRanges->end(),
+              [](const PendingBufferRange &a, const PendingBufferRange &b) {
+                  return a.index < b.index;
+              });
+
+    angle::FastVector<GLuint, 16> buffers;
+    angle::FastVector<GLintptr, 16> offsets;
+    angle::FastVector<GLsizeiptr, 16> sizes;
+    GLuint first = 0;
+
+    auto flushRange = [this, target, &buffers, &offsets, &sizes, &first]() {
+        if (buffers.size() == 1)
+        {
+            mBindingCallCount++;
+            mFunctions->bindBufferRange(gl::ToGLenum(target), first, buffers[0], offsets[0],
+                                        sizes[0]);
+        }
+        else if (buffers.size() > 1)
+        {
+            mBindingCallCount++;
+            mFunctions->bindBuffersRange(gl::ToGLenum(target), first,
+                                         static_cast<GLsizei>(buffers.size()), buffers.data(),
+                                         offsets.data(), sizes.data());
+        }
+        buffers.clear();
+        offsets.clear();
+        sizes.clear();
+    };
+
+    for (const PendingBufferRange &range : *pendingRanges)
+    {
+        // Several blocks can share a binding, in which case they all need the same range.
+        if (!buffers.empty() && range.index == first + buffers.size() - 1)
+        {
+            continue;
+        }
+
+        if (buffers.empty() || range.index != first + buffers.size())
+        {
+            flushRange();
+            first = range.index;
         }
+
+        buffers.push_back(range.buffer);
+        offsets.push_back(static_cast<GLintptr>(range.offset));
+        sizes.push_back(static_cast<GLsizeiptr>(range.size));
+
+        IndexedBufferBinding &binding = mIndexedBuffers[target][range.index];
+        binding.buffer                = range.buffer;
+        binding.offset                = range.offset;
+        binding.size                  = range.size;
     }
+
+    flushRange();
 }
 
 void StateManagerGL::updateProgramImageBindings(const gl::Context *context)
@@ -2221,19 +2374,61 @@ void StateManagerGL::syncSamplersState(const gl::Context *context)
     const gl::State::SamplerBindingVector &samplers = context->getState().getSamplers();
 
     // This could be optimized by using a separate binding dirty bit per sampler.
+    if (!mSupportsMultiBind)
+    {
+        for (size_t samplerIndex = 0; samplerIndex < samplers.size(); ++samplerIndex)
+        {
+            const gl::Sampler *sampler = samplers[samplerIndex].get();
+            if (sampler != nullptr)
+            {
+                SamplerGL *samplerGL = GetImplAs<SamplerGL>(sampler);
+                bindSampler(samplerIndex, samplerGL->getSamplerID());
+            }
+            else
+            {
+                bindSampler(samplerIndex, 0);
+            }
+        }
+        return;
+    }
+
+    // Update the shadowed bindings in place and send every run of changed units with a single
+    // glBindSamplers. Unlike glBindTextures, binding zero here only affects the given unit.
+    size_t first = 0;
+    size_t count = 0;
+
+    auto flushRange = [this](size_t rangeFirst, size_t rangeCount) {
+        if (rangeCount > 0)
+        {
+            mBindingCallCount++;
+            mFunctions->bindSamplers(static_cast<GLuint>(rangeFirst),
+                                     static_cast<GLsizei>(rangeCount), &mSamplers[rangeFirst]);
+            mLocalDirtyBits.set(gl::State::DIRTY_BIT_SAMPLER_BINDINGS);
+        }
+    };
+
     for (size_t samplerIndex = 0; samplerIndex < samplers.size(); ++samplerIndex)
     {
         const gl::Sampler *sampler = samplers[samplerIndex].get();
-        if (sampler != nullptr)
+        GLuint samplerID = sampler != nullptr ? GetImplAs<SamplerGL>(sampler)->getSamplerID() : 0;
+
+        if (mSamplers[samplerIndex] == samplerID)
         {
-            SamplerGL *samplerGL = GetImplAs<SamplerGL>(sampler);
-            bindSampler(samplerIndex, samplerGL->getSamplerID());
+            continue;
         }
-        else
+
+        if (count == 0 || samplerIndex != first + count)
         {
-            bindSampler(samplerIndex, 0);
+            flushRange(first, count);
+            first = samplerIndex;
+            count = 0;
         }
+        count++;
+
+        mSamplers[samplerIndex] = samplerID;
     }
+
+    flushRange(first, count);
 }
 
 void StateManagerGL::syncTransformFeedbackState(const gl::Context *context)
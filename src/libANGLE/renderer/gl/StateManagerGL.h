@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_RENDERER_GL_STATEMANAGERGL_H_
 #define LIBANGLE_RENDERER_GL_STATEMANAGERGL_H_
 
+#include "common/FastVector.h"
 #include "common/debug.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/State.h"
@@ -179,6 +180,11 @@ class StateManagerGL final : angle::NonCopyable
         return mFramebuffers[binding];
     }
 
+    // Number of native calls made to select a texture unit or to bind buffers, textures, samplers
+    // or images.  Bindings that didn't change aren't sent again, so this only grows when
+    // the bindings a draw needs differ from the previous ones.
+    uint64_t getBindingCallCount() const { return mBindingCallCount; }
+
   private:
     void setTextureCubemapSeamlessEnabled(bool enabled);
 
@@ -189,11 +195,28 @@ class StateManagerGL final : angle::NonCopyable
     void propagateProgramToVAO(const gl::Program *program, VertexArrayGL *vao);
 
     void updateProgramTextureBindings(const gl::Context *context);
+    void bindTexturesForDraw(const gl::ActiveTextureMask &changedUnits,
+                             const gl::ActiveTextureTypeArray &textureTypes,
+                             const gl::ActiveTextureArray<GLuint> &textureIDs);
     void updateProgramStorageBufferBindings(const gl::Context *context);
     void updateProgramUniformBufferBindings(const gl::Context *context);
     void updateProgramAtomicCounterBufferBindings(const gl::Context *context);
     void updateProgramImageBindings(const gl::Context *context);
 
+    struct PendingBufferRange
+    {
+        GLuint index;
+        GLuint buffer;
+        size_t offset;
+        size_t size;
+    };
+    using PendingBufferRanges = angle::FastVector<PendingBufferRange, 16>;
+    void addPendingBufferBinding(gl::BufferBinding target,
+                                 GLuint index,
+                                 const gl::OffsetBindingPointer<gl::Buffer> &binding,
+                                 PendingBufferRanges *pendingRanges);
+    void bindPendingBufferRanges(gl::BufferBinding target, PendingBufferRanges *pendingRanges);
+
     void updateDispatchIndirectBufferBinding(const gl::Context *context);
     void updateDrawIndirectBufferBinding(const gl::Context *context);
 
@@ -348,6 +371,11 @@ class StateManagerGL final : angle::NonCopyable
     bool mIsSideBySideDrawFramebuffer;
     const bool mIsMultiviewEnabled;
 
+    // GL 4.4 or ARB_multi_bind: texture, sampler and indexed buffer bindings that change for a
+    // draw are sent to the driver as ranges instead of one call per unit.
+    const bool mSupportsMultiBind;
+    uint64_t mBindingCallCount;
+
     GLenum mProvokingVertex;
 
     gl::State::DirtyBits mLocalDirtyBits;
@@ -0,0 +1,228 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// call_counters.cpp: Per-function counters for the native calls made by the OpenGL back-end.
+
+#include "libANGLE/renderer/gl/call_counters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+#include "libANGLE/histogram_macros.h"
+#include "platform/Platform.h"
+
+namespace rx
+{
+namespace
+{
+// The mutex serializes Install and table destruction. The hooks read the slots without it, so each
+// slot is an atomic that is published with release and read with acquire.
+std::mutex gSlotsMutex;
+std::array<std::atomic<CallCounterTableGL *>, kMaxCallCounterTables> gSlots;
+
+double GetCurrentTimeSeconds()
+{
+    using Seconds = std::chrono::duration<double>;
+    return std::chrono::duration_cast<Seconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+bool IsDrawEntryPoint(EntryPointGL entryPoint)
+{
+    switch (entryPoint)
+    {
+        case EntryPointGL::DrawArrays:
+        case EntryPointGL::DrawArraysIndirect:
+        case EntryPointGL::DrawArraysInstanced:
+        case EntryPointGL::DrawArraysInstancedBaseInstance:
+        case EntryPointGL::DrawElements:
+        case EntryPointGL::DrawElementsBaseVertex:
+        case EntryPointGL::DrawElementsIndirect:
+        case EntryPointGL::DrawElementsInstanced:
+        case EntryPointGL::DrawElementsInstancedBaseInstance:
+        case EntryPointGL::DrawElementsInstancedBaseVertex:
+        case EntryPointGL::DrawElementsInstancedBaseVertexBaseInstance:
+        case EntryPointGL::DrawRangeElements:
+        case EntryPointGL::DrawRangeElementsBaseVertex:
+        case EntryPointGL::DrawTransformFeedback:
+        case EntryPointGL::DrawTransformFeedbackInstanced:
+        case EntryPointGL::DrawTransformFeedbackStream:
+        case EntryPointGL::DrawTransformFeedbackStreamInstanced:
+        case EntryPointGL::MultiDrawArrays:
+        case EntryPointGL::MultiDrawArraysIndirect:
+        case EntryPointGL::MultiDrawElements:
+        case EntryPointGL::MultiDrawElementsBaseVertex:
+        case EntryPointGL::MultiDrawElementsIndirect:
+            return true;
+        default:
+            return false;
+    }
+}
+
+int ClampToHistogramSample(uint64_t value)
+{
+    return static_cast<int>(std::min<uint64_t>(value, std::numeric_limits<int>::max()));
+}
+}  // anonymous namespace
+
+CallCounterTableGL::CallCounterTableGL(size_t slot)
+    : mSlot(slot), mTimingEnabled(!angle::GetEnvironmentVar("ANGLE_GL_CALL_TIMING").empty())
+{
+    for (AtomicCallCounterGL &counter : mCounters)
+    {
+        counter.calls.store(0, std::memory_order_relaxed);
+        counter.nanoseconds.store(0, std::memory_order_relaxed);
+    }
+}
+
+CallCounterTableGL::~CallCounterTableGL()
+{
+    std::lock_guard<std::mutex> lock(gSlotsMutex);
+    gSlots[mSlot].store(nullptr, std::memory_order_release);
+}
+
+// static
+std::unique_ptr<CallCounterTableGL> CallCounterTableGL::Install(DispatchTableGL *functions)
+{
+    std::lock_guard<std::mutex> lock(gSlotsMutex);
+    for (size_t slot = 0; slot < gSlots.size(); ++slot)
+    {
+        if (gSlots[slot].load(std::memory_order_relaxed) == nullptr)
+        {
+            std::unique_ptr<CallCounterTableGL> table(new CallCounterTableGL(slot));
+            InstallCallCounterHooks(slot, functions, table.get());
+            // Publish the table once it holds the original functions, so that a hook that finds
+            // it also sees what it forwards to.
+            gSlots[slot].store(table.get(), std::memory_order_release);
+            return table;
+        }
+    }
+
+    WARN() << "Native GL calls are only counted for the first " << kMaxCallCounterTables
+           << " displays.";
+    return nullptr;
+}
+
+// static
+CallCounterTableGL *CallCounterTableGL::FromSlot(size_t slot)
+{
+    return gSlots[slot].load(std::memory_order_acquire);
+}
+
+CallCountersGL CallCounterTableGL::getCounters() const
+{
+    CallCountersGL counters;
+    for (size_t index = 0; index < mCounters.size(); ++index)
+    {
+        counters[index].calls = mCounters[index].calls.load(std::memory_order_relaxed);
+        counters[index].seconds =
+            static_cast<double>(mCounters[index].nanoseconds.load(std::memory_order_relaxed)) *
+            1e-9;
+    }
+    return counters;
+}
+
+CallCountersGL GetCallCountersSince(const CallCountersGL &counters, const CallCountersGL &start)
+{
+    CallCountersGL since;
+    for (size_t index = 0; index < counters.size(); ++index)
+    {
+        since[index].calls   = counters[index].calls - start[index].calls;
+        since[index].seconds = counters[index].seconds - start[index].seconds;
+    }
+    return since;
+}
+
+uint64_t GetNativeDrawCallCount(const CallCountersGL &counters)
+{
+    uint64_t drawCalls = 0;
+    for (size_t index = 0; index < counters.size(); ++index)
+    {
+        if (IsDrawEntryPoint(static_cast<EntryPointGL>(index)))
+        {
+            drawCalls += counters[index].calls;
+        }
+    }
+    return drawCalls;
+}
+
+uint64_t GetNativeCallCount(const CallCountersGL &counters)
+{
+    uint64_t calls = 0;
+    for (const CallCounterGL &counter : counters)
+    {
+        calls += counter.calls;
+    }
+    return calls;
+}
+
+void DumpCallCounters(const CallCountersGL &counters, bool withTiming)
+{
+    uint64_t calls     = GetNativeCallCount(counters);
+    uint64_t drawCalls = GetNativeDrawCallCount(counters);
+
+    if (calls == 0)
+    {
+        return;
+    }
+
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.GLNativeCalls", ClampToHistogramSample(calls));
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.GLNativeDrawCalls", ClampToHistogramSample(drawCalls));
+
+    std::vector<size_t> indices;
+    for (size_t index = 0; index < counters.size(); ++index)
+    {
+        if (counters[index].calls > 0)
+        {
+            indices.push_back(index);
+        }
+    }
+
+    std::sort(indices.begin(), indices.end(), [&counters](size_t a, size_t b) {
+        return counters[a].calls > counters[b].calls;
+    });
+
+    std::ostringstream stream;
+    stream << "Native GL calls: " << calls << ", draw calls: " << drawCalls;
+    for (size_t index : indices)
+    {
+        const CallCounterGL &counter = counters[index];
+        stream << "\n  " << GetEntryPointGLName(static_cast<EntryPointGL>(index)) << ": "
+               << counter.calls;
+        if (withTiming)
+        {
+            stream << " (" << counter.seconds * 1e3 << " ms)";
+        }
+    }
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    platform->logInfo(platform, stream.str().c_str());
+}
+
+ScopedCallCounter::ScopedCallCounter(CallCounterTableGL *table, EntryPointGL entryPoint)
+    : mCounter(table->getCounter(entryPoint)),
+      mTimingEnabled(table->isTimingEnabled()),
+      mStartTime(mTimingEnabled ? GetCurrentTimeSeconds() : 0.0)
+{
+    mCounter->calls.fetch_add(1, std::memory_order_relaxed);
+}
+
+ScopedCallCounter::~ScopedCallCounter()
+{
+    if (mTimingEnabled)
+    {
+        double seconds = GetCurrentTimeSeconds() - mStartTime;
+        mCounter->nanoseconds.fetch_add(static_cast<uint64_t>(seconds * 1e9),
+                                        std::memory_order_relaxed);
+    }
+}
+}  // namespace rx
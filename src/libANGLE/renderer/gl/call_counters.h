@@ -0,0 +1,96 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// call_counters.h: Per-function counters for the native calls made by the OpenGL back-end. Only
+// built with angle_enable_gl_call_counters, which hooks every loaded function at display
+// initialization. Set ANGLE_GL_CALL_TIMING in the environment to also time each call.
+
+#ifndef LIBANGLE_RENDERER_GL_CALL_COUNTERS_H_
+#define LIBANGLE_RENDERER_GL_CALL_COUNTERS_H_
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include "common/angleutils.h"
+#include "libANGLE/renderer/gl/DispatchTableGL_autogen.h"
+#include "libANGLE/renderer/gl/call_counters_autogen.h"
+
+namespace rx
+{
+struct CallCounterGL
+{
+    uint64_t calls;
+    double seconds;
+};
+
+using CallCountersGL = std::array<CallCounterGL, static_cast<size_t>(EntryPointGL::EnumCount)>;
+
+// The hooks can be called from any thread that has a context of the display current, so the
+// counters they update are atomic.
+struct AtomicCallCounterGL
+{
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> nanoseconds;
+};
+
+// The native functions that the hooks installed in one FunctionsGL forward to, and the counts of
+// the calls made through them. The hooks are plain function pointers, so each hooked table takes
+// one of kMaxCallCounterTables slots, and the hooks instantiated for that slot look it up there.
+class CallCounterTableGL final : public DispatchTableGL
+{
+  public:
+    ~CallCounterTableGL() override;
+
+    // Hooks every loaded function in |functions|. Returns nullptr and leaves |functions| unchanged
+    // if every slot is taken.
+    static std::unique_ptr<CallCounterTableGL> Install(DispatchTableGL *functions);
+
+    static CallCounterTableGL *FromSlot(size_t slot);
+
+    // Returns a copy of the counters.
+    CallCountersGL getCounters() const;
+    AtomicCallCounterGL *getCounter(EntryPointGL entryPoint)
+    {
+        return &mCounters[static_cast<size_t>(entryPoint)];
+    }
+    bool isTimingEnabled() const { return mTimingEnabled; }
+
+  private:
+    explicit CallCounterTableGL(size_t slot);
+
+    void *loadProcAddress(const std::string &function) const override { return nullptr; }
+
+    size_t mSlot;
+    bool mTimingEnabled;
+    std::array<AtomicCallCounterGL, static_cast<size_t>(EntryPointGL::EnumCount)> mCounters;
+};
+
+// Returns the calls counted in |counters| since |start| was copied from it.
+CallCountersGL GetCallCountersSince(const CallCountersGL &counters, const CallCountersGL &start);
+
+// Native draw calls in |counters|, summed over every draw entry point.
+uint64_t GetNativeDrawCallCount(const CallCountersGL &counters);
+uint64_t GetNativeCallCount(const CallCountersGL &counters);
+
+// Logs every function called in |counters|, most called first, as info through the platform, and
+// reports the totals through the platform's histograms.
+void DumpCallCounters(const CallCountersGL &counters, bool withTiming);
+
+class ScopedCallCounter final : angle::NonCopyable
+{
+  public:
+    ScopedCallCounter(CallCounterTableGL *table, EntryPointGL entryPoint);
+    ~ScopedCallCounter();
+
+  private:
+    AtomicCallCounterGL *mCounter;
+    bool mTimingEnabled;
+    double mStartTime;
+};
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_CALL_COUNTERS_H_
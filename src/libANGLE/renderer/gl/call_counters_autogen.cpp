@@ -0,0 +1,12448 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by generate_gl_dispatch_table.py using data from gl_bindings_data.json and gl.xml.
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// call_counters_autogen.cpp:
+//   Defines the call counting hooks for the instrumented OpenGL back-end.
+
+#include "libANGLE/renderer/gl/call_counters_autogen.h"
+
+#include "common/debug.h"
+#include "libANGLE/renderer/gl/DispatchTableGL_autogen.h"
+#include "libANGLE/renderer/gl/call_counters.h"
+
+namespace rx
+{
+namespace
+{
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glActiveShaderProgramHook(GLuint pipeline, GLuint program)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ActiveShaderProgram);
+    return table->activeShaderProgram(pipeline, program);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glActiveTextureHook(GLenum texture)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ActiveTexture);
+    return table->activeTexture(texture);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glAttachShaderHook(GLuint program, GLuint shader)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::AttachShader);
+    return table->attachShader(program, shader);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBeginConditionalRenderHook(GLuint id, GLenum mode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BeginConditionalRender);
+    return table->beginConditionalRender(id, mode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBeginQueryHook(GLenum target, GLuint id)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BeginQuery);
+    return table->beginQuery(target, id);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBeginQueryIndexedHook(GLenum target, GLuint index, GLuint id)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BeginQueryIndexed);
+    return table->beginQueryIndexed(target, index, id);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBeginTransformFeedbackHook(GLenum primitiveMode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BeginTransformFeedback);
+    return table->beginTransformFeedback(primitiveMode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindAttribLocationHook(GLuint program, GLuint index, const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindAttribLocation);
+    return table->bindAttribLocation(program, index, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindBufferHook(GLenum target, GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindBuffer);
+    return table->bindBuffer(target, buffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindBufferBaseHook(GLenum target, GLuint index, GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindBufferBase);
+    return table->bindBufferBase(target, index, buffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glBindBufferRangeHook(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindBufferRange);
+    return table->bindBufferRange(target, index, buffer, offset, size);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindBuffersBaseHook(GLenum target,
+                                                GLuint first,
+                                                GLsizei count,
+                                                const GLuint *buffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindBuffersBase);
+    return table->bindBuffersBase(target, first, count, buffers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindBuffersRangeHook(GLenum target,
+                                                 GLuint first,
+                                                 GLsizei count,
+                                                 const GLuint *buffers,
+                                                 const GLintptr *offsets,
+                                                 const GLsizeiptr *sizes)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindBuffersRange);
+    return table->bindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindFragDataLocationHook(GLuint program,
+                                                     GLuint color,
+                                                     const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindFragDataLocation);
+    return table->bindFragDataLocation(program, color, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindFragDataLocationIndexedHook(GLuint program,
+                                                            GLuint colorNumber,
+                                                            GLuint index,
+                                                            const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindFragDataLocationIndexed);
+    return table->bindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindFramebufferHook(GLenum target, GLuint framebuffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindFramebuffer);
+    return table->bindFramebuffer(target, framebuffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindImageTextureHook(GLuint unit,
+                                                 GLuint texture,
+                                                 GLint level,
+                                                 GLboolean layered,
+                                                 GLint layer,
+                                                 GLenum access,
+                                                 GLenum format)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindImageTexture);
+    return table->bindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindImageTexturesHook(GLuint first,
+                                                  GLsizei count,
+                                                  const GLuint *textures)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindImageTextures);
+    return table->bindImageTextures(first, count, textures);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindProgramPipelineHook(GLuint pipeline)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindProgramPipeline);
+    return table->bindProgramPipeline(pipeline);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindRenderbufferHook(GLenum target, GLuint renderbuffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindRenderbuffer);
+    return table->bindRenderbuffer(target, renderbuffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindSamplerHook(GLuint unit, GLuint sampler)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindSampler);
+    return table->bindSampler(unit, sampler);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindSamplersHook(GLuint first, GLsizei count, const GLuint *samplers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindSamplers);
+    return table->bindSamplers(first, count, samplers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindTextureHook(GLenum target, GLuint texture)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindTexture);
+    return table->bindTexture(target, texture);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindTextureUnitHook(GLuint unit, GLuint texture)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindTextureUnit);
+    return table->bindTextureUnit(unit, texture);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindTexturesHook(GLuint first, GLsizei count, const GLuint *textures)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindTextures);
+    return table->bindTextures(first, count, textures);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindTransformFeedbackHook(GLenum target, GLuint id)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindTransformFeedback);
+    return table->bindTransformFeedback(target, id);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindVertexArrayHook(GLuint array)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindVertexArray);
+    return table->bindVertexArray(array);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindVertexBufferHook(GLuint bindingindex,
+                                                 GLuint buffer,
+                                                 GLintptr offset,
+                                                 GLsizei stride)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindVertexBuffer);
+    return table->bindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBindVertexBuffersHook(GLuint first,
+                                                  GLsizei count,
+                                                  const GLuint *buffers,
+                                                  const GLintptr *offsets,
+                                                  const GLsizei *strides)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BindVertexBuffers);
+    return table->bindVertexBuffers(first, count, buffers, offsets, strides);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendBarrierHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendBarrier);
+    return table->blendBarrier();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendColorHook(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendColor);
+    return table->blendColor(red, green, blue, alpha);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendEquationHook(GLenum mode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendEquation);
+    return table->blendEquation(mode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendEquationSeparateHook(GLenum modeRGB, GLenum modeAlpha)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendEquationSeparate);
+    return table->blendEquationSeparate(modeRGB, modeAlpha);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendEquationSeparateiHook(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendEquationSeparatei);
+    return table->blendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendEquationiHook(GLuint buf, GLenum mode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendEquationi);
+    return table->blendEquationi(buf, mode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendFuncHook(GLenum sfactor, GLenum dfactor)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendFunc);
+    return table->blendFunc(sfactor, dfactor);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendFuncSeparateHook(GLenum sfactorRGB,
+                                                  GLenum dfactorRGB,
+                                                  GLenum sfactorAlpha,
+                                                  GLenum dfactorAlpha)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendFuncSeparate);
+    return table->blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glBlendFuncSeparateiHook(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendFuncSeparatei);
+    return table->blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlendFunciHook(GLuint buf, GLenum src, GLenum dst)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlendFunci);
+    return table->blendFunci(buf, src, dst);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlitFramebufferHook(GLint srcX0,
+                                                GLint srcY0,
+                                                GLint srcX1,
+                                                GLint srcY1,
+                                                GLint dstX0,
+                                                GLint dstY0,
+                                                GLint dstX1,
+                                                GLint dstY1,
+                                                GLbitfield mask,
+                                                GLenum filter)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlitFramebuffer);
+    return table->blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask,
+                                  filter);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBlitNamedFramebufferHook(GLuint readFramebuffer,
+                                                     GLuint drawFramebuffer,
+                                                     GLint srcX0,
+                                                     GLint srcY0,
+                                                     GLint srcX1,
+                                                     GLint srcY1,
+                                                     GLint dstX0,
+                                                     GLint dstY0,
+                                                     GLint dstX1,
+                                                     GLint dstY1,
+                                                     GLbitfield mask,
+                                                     GLenum filter)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BlitNamedFramebuffer);
+    return table->blitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1,
+                                       dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBufferDataHook(GLenum target,
+                                           GLsizeiptr size,
+                                           const void *data,
+                                           GLenum usage)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BufferData);
+    return table->bufferData(target, size, data, usage);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBufferStorageHook(GLenum target,
+                                              GLsizeiptr size,
+                                              const void *data,
+                                              GLbitfield flags)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BufferStorage);
+    return table->bufferStorage(target, size, data, flags);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glBufferSubDataHook(GLenum target,
+                                              GLintptr offset,
+                                              GLsizeiptr size,
+                                              const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::BufferSubData);
+    return table->bufferSubData(target, offset, size, data);
+}
+
+template <size_t Slot>
+GLenum INTERNAL_GL_APIENTRY glCheckFramebufferStatusHook(GLenum target)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CheckFramebufferStatus);
+    return table->checkFramebufferStatus(target);
+}
+
+template <size_t Slot>
+GLenum INTERNAL_GL_APIENTRY glCheckNamedFramebufferStatusHook(GLuint framebuffer, GLenum target)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CheckNamedFramebufferStatus);
+    return table->checkNamedFramebufferStatus(framebuffer, target);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClampColorHook(GLenum target, GLenum clamp)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClampColor);
+    return table->clampColor(target, clamp);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearHook(GLbitfield mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Clear);
+    return table->clear(mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearBufferDataHook(GLenum target,
+                                                GLenum internalformat,
+                                                GLenum format,
+                                                GLenum type,
+                                                const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearBufferData);
+    return table->clearBufferData(target, internalformat, format, type, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearBufferSubDataHook(GLenum target,
+                                                   GLenum internalformat,
+                                                   GLintptr offset,
+                                                   GLsizeiptr size,
+                                                   GLenum format,
+                                                   GLenum type,
+                                                   const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearBufferSubData);
+    return table->clearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearBufferfiHook(GLenum buffer,
+                                              GLint drawbuffer,
+                                              GLfloat depth,
+                                              GLint stencil)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearBufferfi);
+    return table->clearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearBufferfvHook(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearBufferfv);
+    return table->clearBufferfv(buffer, drawbuffer, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearBufferivHook(GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearBufferiv);
+    return table->clearBufferiv(buffer, drawbuffer, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearBufferuivHook(GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearBufferuiv);
+    return table->clearBufferuiv(buffer, drawbuffer, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearColorHook(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearColor);
+    return table->clearColor(red, green, blue, alpha);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearDepthHook(GLdouble depth)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearDepth);
+    return table->clearDepth(depth);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearDepthfHook(GLfloat d)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearDepthf);
+    return table->clearDepthf(d);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearNamedBufferDataHook(GLuint buffer,
+                                                     GLenum internalformat,
+                                                     GLenum format,
+                                                     GLenum type,
+                                                     const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearNamedBufferData);
+    return table->clearNamedBufferData(buffer, internalformat, format, type, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearNamedBufferSubDataHook(GLuint buffer,
+                                                        GLenum internalformat,
+                                                        GLintptr offset,
+                                                        GLsizeiptr size,
+                                                        GLenum format,
+                                                        GLenum type,
+                                                        const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearNamedBufferSubData);
+    return table->clearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearNamedFramebufferfiHook(GLuint framebuffer,
+                                                        GLenum buffer,
+                                                        GLint drawbuffer,
+                                                        GLfloat depth,
+                                                        GLint stencil)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearNamedFramebufferfi);
+    return table->clearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearNamedFramebufferfvHook(GLuint framebuffer,
+                                                        GLenum buffer,
+                                                        GLint drawbuffer,
+                                                        const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearNamedFramebufferfv);
+    return table->clearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearNamedFramebufferivHook(GLuint framebuffer,
+                                                        GLenum buffer,
+                                                        GLint drawbuffer,
+                                                        const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearNamedFramebufferiv);
+    return table->clearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearNamedFramebufferuivHook(GLuint framebuffer,
+                                                         GLenum buffer,
+                                                         GLint drawbuffer,
+                                                         const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearNamedFramebufferuiv);
+    return table->clearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearStencilHook(GLint s)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearStencil);
+    return table->clearStencil(s);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glClearTexImageHook(GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearTexImage);
+    return table->clearTexImage(texture, level, format, type, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClearTexSubImageHook(GLuint texture,
+                                                 GLint level,
+                                                 GLint xoffset,
+                                                 GLint yoffset,
+                                                 GLint zoffset,
+                                                 GLsizei width,
+                                                 GLsizei height,
+                                                 GLsizei depth,
+                                                 GLenum format,
+                                                 GLenum type,
+                                                 const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClearTexSubImage);
+    return table->clearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth,
+                                   format, type, data);
+}
+
+template <size_t Slot>
+GLenum INTERNAL_GL_APIENTRY glClientWaitSyncHook(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClientWaitSync);
+    return table->clientWaitSync(sync, flags, timeout);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glClipControlHook(GLenum origin, GLenum depth)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ClipControl);
+    return table->clipControl(origin, depth);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glColorMaskHook(GLboolean red,
+                                          GLboolean green,
+                                          GLboolean blue,
+                                          GLboolean alpha)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ColorMask);
+    return table->colorMask(red, green, blue, alpha);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glColorMaskiHook(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ColorMaski);
+    return table->colorMaski(index, r, g, b, a);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompileShaderHook(GLuint shader)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompileShader);
+    return table->compileShader(shader);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTexImage1DHook(GLenum target,
+                                                     GLint level,
+                                                     GLenum internalformat,
+                                                     GLsizei width,
+                                                     GLint border,
+                                                     GLsizei imageSize,
+                                                     const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTexImage1D);
+    return table->compressedTexImage1D(target, level, internalformat, width, border, imageSize,
+                                       data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTexImage2DHook(GLenum target,
+                                                     GLint level,
+                                                     GLenum internalformat,
+                                                     GLsizei width,
+                                                     GLsizei height,
+                                                     GLint border,
+                                                     GLsizei imageSize,
+                                                     const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTexImage2D);
+    return table->compressedTexImage2D(target, level, internalformat, width, height, border,
+                                       imageSize, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTexImage3DHook(GLenum target,
+                                                     GLint level,
+                                                     GLenum internalformat,
+                                                     GLsizei width,
+                                                     GLsizei height,
+                                                     GLsizei depth,
+                                                     GLint border,
+                                                     GLsizei imageSize,
+                                                     const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTexImage3D);
+    return table->compressedTexImage3D(target, level, internalformat, width, height, depth, border,
+                                       imageSize, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTexSubImage1DHook(GLenum target,
+                                                        GLint level,
+                                                        GLint xoffset,
+                                                        GLsizei width,
+                                                        GLenum format,
+                                                        GLsizei imageSize,
+                                                        const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTexSubImage1D);
+    return table->compressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTexSubImage2DHook(GLenum target,
+                                                        GLint level,
+                                                        GLint xoffset,
+                                                        GLint yoffset,
+                                                        GLsizei width,
+                                                        GLsizei height,
+                                                        GLenum format,
+                                                        GLsizei imageSize,
+                                                        const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTexSubImage2D);
+    return table->compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format,
+                                          imageSize, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTexSubImage3DHook(GLenum target,
+                                                        GLint level,
+                                                        GLint xoffset,
+                                                        GLint yoffset,
+                                                        GLint zoffset,
+                                                        GLsizei width,
+                                                        GLsizei height,
+                                                        GLsizei depth,
+                                                        GLenum format,
+                                                        GLsizei imageSize,
+                                                        const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTexSubImage3D);
+    return table->compressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height,
+                                          depth, format, imageSize, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTextureSubImage1DHook(GLuint texture,
+                                                            GLint level,
+                                                            GLint xoffset,
+                                                            GLsizei width,
+                                                            GLenum format,
+                                                            GLsizei imageSize,
+                                                            const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTextureSubImage1D);
+    return table->compressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize,
+                                              data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTextureSubImage2DHook(GLuint texture,
+                                                            GLint level,
+                                                            GLint xoffset,
+                                                            GLint yoffset,
+                                                            GLsizei width,
+                                                            GLsizei height,
+                                                            GLenum format,
+                                                            GLsizei imageSize,
+                                                            const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTextureSubImage2D);
+    return table->compressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height,
+                                              format, imageSize, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCompressedTextureSubImage3DHook(GLuint texture,
+                                                            GLint level,
+                                                            GLint xoffset,
+                                                            GLint yoffset,
+                                                            GLint zoffset,
+                                                            GLsizei width,
+                                                            GLsizei height,
+                                                            GLsizei depth,
+                                                            GLenum format,
+                                                            GLsizei imageSize,
+                                                            const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CompressedTextureSubImage3D);
+    return table->compressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width,
+                                              height, depth, format, imageSize, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyBufferSubDataHook(GLenum readTarget,
+                                                  GLenum writeTarget,
+                                                  GLintptr readOffset,
+                                                  GLintptr writeOffset,
+                                                  GLsizeiptr size)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyBufferSubData);
+    return table->copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyImageSubDataHook(GLuint srcName,
+                                                 GLenum srcTarget,
+                                                 GLint srcLevel,
+                                                 GLint srcX,
+                                                 GLint srcY,
+                                                 GLint srcZ,
+                                                 GLuint dstName,
+                                                 GLenum dstTarget,
+                                                 GLint dstLevel,
+                                                 GLint dstX,
+                                                 GLint dstY,
+                                                 GLint dstZ,
+                                                 GLsizei srcWidth,
+                                                 GLsizei srcHeight,
+                                                 GLsizei srcDepth)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyImageSubData);
+    return table->copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName,
+                                   dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight,
+                                   srcDepth);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyNamedBufferSubDataHook(GLuint readBuffer,
+                                                       GLuint writeBuffer,
+                                                       GLintptr readOffset,
+                                                       GLintptr writeOffset,
+                                                       GLsizeiptr size)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyNamedBufferSubData);
+    return table->copyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyTexImage1DHook(GLenum target,
+                                               GLint level,
+                                               GLenum internalformat,
+                                               GLint x,
+                                               GLint y,
+                                               GLsizei width,
+                                               GLint border)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyTexImage1D);
+    return table->copyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyTexImage2DHook(GLenum target,
+                                               GLint level,
+                                               GLenum internalformat,
+                                               GLint x,
+                                               GLint y,
+                                               GLsizei width,
+                                               GLsizei height,
+                                               GLint border)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyTexImage2D);
+    return table->copyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glCopyTexSubImage1DHook(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyTexSubImage1D);
+    return table->copyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyTexSubImage2DHook(GLenum target,
+                                                  GLint level,
+                                                  GLint xoffset,
+                                                  GLint yoffset,
+                                                  GLint x,
+                                                  GLint y,
+                                                  GLsizei width,
+                                                  GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyTexSubImage2D);
+    return table->copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyTexSubImage3DHook(GLenum target,
+                                                  GLint level,
+                                                  GLint xoffset,
+                                                  GLint yoffset,
+                                                  GLint zoffset,
+                                                  GLint x,
+                                                  GLint y,
+                                                  GLsizei width,
+                                                  GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyTexSubImage3D);
+    return table->copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyTextureSubImage1DHook(GLuint texture,
+                                                      GLint level,
+                                                      GLint xoffset,
+                                                      GLint x,
+                                                      GLint y,
+                                                      GLsizei width)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyTextureSubImage1D);
+    return table->copyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyTextureSubImage2DHook(GLuint texture,
+                                                      GLint level,
+                                                      GLint xoffset,
+                                                      GLint yoffset,
+                                                      GLint x,
+                                                      GLint y,
+                                                      GLsizei width,
+                                                      GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyTextureSubImage2D);
+    return table->copyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCopyTextureSubImage3DHook(GLuint texture,
+                                                      GLint level,
+                                                      GLint xoffset,
+                                                      GLint yoffset,
+                                                      GLint zoffset,
+                                                      GLint x,
+                                                      GLint y,
+                                                      GLsizei width,
+                                                      GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CopyTextureSubImage3D);
+    return table->copyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width,
+                                        height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCoverFillPathInstancedNVHook(GLsizei numPaths,
+                                                         GLenum pathNameType,
+                                                         const void *paths,
+                                                         GLuint pathBase,
+                                                         GLenum coverMode,
+                                                         GLenum transformType,
+                                                         const GLfloat *transformValues)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CoverFillPathInstancedNV);
+    return table->coverFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, coverMode,
+                                           transformType, transformValues);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCoverFillPathNVHook(GLuint path, GLenum coverMode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CoverFillPathNV);
+    return table->coverFillPathNV(path, coverMode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCoverStrokePathInstancedNVHook(GLsizei numPaths,
+                                                           GLenum pathNameType,
+                                                           const void *paths,
+                                                           GLuint pathBase,
+                                                           GLenum coverMode,
+                                                           GLenum transformType,
+                                                           const GLfloat *transformValues)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CoverStrokePathInstancedNV);
+    return table->coverStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, coverMode,
+                                             transformType, transformValues);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCoverStrokePathNVHook(GLuint path, GLenum coverMode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CoverStrokePathNV);
+    return table->coverStrokePathNV(path, coverMode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCoverageModulationNVHook(GLenum components)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CoverageModulationNV);
+    return table->coverageModulationNV(components);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateBuffersHook(GLsizei n, GLuint *buffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateBuffers);
+    return table->createBuffers(n, buffers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateFramebuffersHook(GLsizei n, GLuint *framebuffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateFramebuffers);
+    return table->createFramebuffers(n, framebuffers);
+}
+
+template <size_t Slot>
+GLuint INTERNAL_GL_APIENTRY glCreateProgramHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateProgram);
+    return table->createProgram();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateProgramPipelinesHook(GLsizei n, GLuint *pipelines)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateProgramPipelines);
+    return table->createProgramPipelines(n, pipelines);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateQueriesHook(GLenum target, GLsizei n, GLuint *ids)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateQueries);
+    return table->createQueries(target, n, ids);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateRenderbuffersHook(GLsizei n, GLuint *renderbuffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateRenderbuffers);
+    return table->createRenderbuffers(n, renderbuffers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateSamplersHook(GLsizei n, GLuint *samplers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateSamplers);
+    return table->createSamplers(n, samplers);
+}
+
+template <size_t Slot>
+GLuint INTERNAL_GL_APIENTRY glCreateShaderHook(GLenum type)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateShader);
+    return table->createShader(type);
+}
+
+template <size_t Slot>
+GLuint INTERNAL_GL_APIENTRY glCreateShaderProgramvHook(GLenum type,
+                                                       GLsizei count,
+                                                       const GLchar *const *strings)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateShaderProgramv);
+    return table->createShaderProgramv(type, count, strings);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateTexturesHook(GLenum target, GLsizei n, GLuint *textures)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateTextures);
+    return table->createTextures(target, n, textures);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateTransformFeedbacksHook(GLsizei n, GLuint *ids)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateTransformFeedbacks);
+    return table->createTransformFeedbacks(n, ids);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCreateVertexArraysHook(GLsizei n, GLuint *arrays)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CreateVertexArrays);
+    return table->createVertexArrays(n, arrays);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glCullFaceHook(GLenum mode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::CullFace);
+    return table->cullFace(mode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDebugMessageCallbackHook(GLDEBUGPROC callback, const void *userParam)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DebugMessageCallback);
+    return table->debugMessageCallback(callback, userParam);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDebugMessageControlHook(GLenum source,
+                                                    GLenum type,
+                                                    GLenum severity,
+                                                    GLsizei count,
+                                                    const GLuint *ids,
+                                                    GLboolean enabled)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DebugMessageControl);
+    return table->debugMessageControl(source, type, severity, count, ids, enabled);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDebugMessageInsertHook(GLenum source,
+                                                   GLenum type,
+                                                   GLuint id,
+                                                   GLenum severity,
+                                                   GLsizei length,
+                                                   const GLchar *buf)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DebugMessageInsert);
+    return table->debugMessageInsert(source, type, id, severity, length, buf);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteBuffersHook(GLsizei n, const GLuint *buffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteBuffers);
+    return table->deleteBuffers(n, buffers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteFencesNVHook(GLsizei n, const GLuint *fences)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteFencesNV);
+    return table->deleteFencesNV(n, fences);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteFramebuffersHook(GLsizei n, const GLuint *framebuffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteFramebuffers);
+    return table->deleteFramebuffers(n, framebuffers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeletePathsNVHook(GLuint path, GLsizei range)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeletePathsNV);
+    return table->deletePathsNV(path, range);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteProgramHook(GLuint program)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteProgram);
+    return table->deleteProgram(program);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteProgramPipelinesHook(GLsizei n, const GLuint *pipelines)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteProgramPipelines);
+    return table->deleteProgramPipelines(n, pipelines);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteQueriesHook(GLsizei n, const GLuint *ids)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteQueries);
+    return table->deleteQueries(n, ids);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteRenderbuffersHook(GLsizei n, const GLuint *renderbuffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteRenderbuffers);
+    return table->deleteRenderbuffers(n, renderbuffers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteSamplersHook(GLsizei count, const GLuint *samplers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteSamplers);
+    return table->deleteSamplers(count, samplers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteShaderHook(GLuint shader)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteShader);
+    return table->deleteShader(shader);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteSyncHook(GLsync sync)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteSync);
+    return table->deleteSync(sync);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteTexturesHook(GLsizei n, const GLuint *textures)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteTextures);
+    return table->deleteTextures(n, textures);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteTransformFeedbacksHook(GLsizei n, const GLuint *ids)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteTransformFeedbacks);
+    return table->deleteTransformFeedbacks(n, ids);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDeleteVertexArraysHook(GLsizei n, const GLuint *arrays)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DeleteVertexArrays);
+    return table->deleteVertexArrays(n, arrays);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDepthFuncHook(GLenum func)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DepthFunc);
+    return table->depthFunc(func);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDepthMaskHook(GLboolean flag)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DepthMask);
+    return table->depthMask(flag);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDepthRangeHook(GLdouble n, GLdouble f)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DepthRange);
+    return table->depthRange(n, f);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDepthRangeArrayvHook(GLuint first, GLsizei count, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DepthRangeArrayv);
+    return table->depthRangeArrayv(first, count, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDepthRangeIndexedHook(GLuint index, GLdouble n, GLdouble f)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DepthRangeIndexed);
+    return table->depthRangeIndexed(index, n, f);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDepthRangefHook(GLfloat n, GLfloat f)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DepthRangef);
+    return table->depthRangef(n, f);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDetachShaderHook(GLuint program, GLuint shader)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DetachShader);
+    return table->detachShader(program, shader);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDisableHook(GLenum cap)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Disable);
+    return table->disable(cap);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDisableVertexArrayAttribHook(GLuint vaobj, GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DisableVertexArrayAttrib);
+    return table->disableVertexArrayAttrib(vaobj, index);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDisableVertexAttribArrayHook(GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DisableVertexAttribArray);
+    return table->disableVertexAttribArray(index);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDisableiHook(GLenum target, GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Disablei);
+    return table->disablei(target, index);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDiscardFramebufferEXTHook(GLenum target,
+                                                      GLsizei numAttachments,
+                                                      const GLenum *attachments)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DiscardFramebufferEXT);
+    return table->discardFramebufferEXT(target, numAttachments, attachments);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDispatchComputeHook(GLuint num_groups_x,
+                                                GLuint num_groups_y,
+                                                GLuint num_groups_z)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DispatchCompute);
+    return table->dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDispatchComputeIndirectHook(GLintptr indirect)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DispatchComputeIndirect);
+    return table->dispatchComputeIndirect(indirect);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawArraysHook(GLenum mode, GLint first, GLsizei count)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawArrays);
+    return table->drawArrays(mode, first, count);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawArraysIndirectHook(GLenum mode, const void *indirect)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawArraysIndirect);
+    return table->drawArraysIndirect(mode, indirect);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawArraysInstancedHook(GLenum mode,
+                                                    GLint first,
+                                                    GLsizei count,
+                                                    GLsizei instancecount)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawArraysInstanced);
+    return table->drawArraysInstanced(mode, first, count, instancecount);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawArraysInstancedBaseInstanceHook(GLenum mode,
+                                                                GLint first,
+                                                                GLsizei count,
+                                                                GLsizei instancecount,
+                                                                GLuint baseinstance)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawArraysInstancedBaseInstance);
+    return table->drawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawBufferHook(GLenum buf)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawBuffer);
+    return table->drawBuffer(buf);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawBuffersHook(GLsizei n, const GLenum *bufs)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawBuffers);
+    return table->drawBuffers(n, bufs);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawElementsHook(GLenum mode,
+                                             GLsizei count,
+                                             GLenum type,
+                                             const void *indices)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawElements);
+    return table->drawElements(mode, count, type, indices);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawElementsBaseVertexHook(GLenum mode,
+                                                       GLsizei count,
+                                                       GLenum type,
+                                                       const void *indices,
+                                                       GLint basevertex)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawElementsBaseVertex);
+    return table->drawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawElementsIndirectHook(GLenum mode, GLenum type, const void *indirect)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawElementsIndirect);
+    return table->drawElementsIndirect(mode, type, indirect);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawElementsInstancedHook(GLenum mode,
+                                                      GLsizei count,
+                                                      GLenum type,
+                                                      const void *indices,
+                                                      GLsizei instancecount)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawElementsInstanced);
+    return table->drawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseInstanceHook(GLenum mode,
+                                                                  GLsizei count,
+                                                                  GLenum type,
+                                                                  const void *indices,
+                                                                  GLsizei instancecount,
+                                                                  GLuint baseinstance)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawElementsInstancedBaseInstance);
+    return table->drawElementsInstancedBaseInstance(mode, count, type, indices, instancecount,
+                                                    baseinstance);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexHook(GLenum mode,
+                                                                GLsizei count,
+                                                                GLenum type,
+                                                                const void *indices,
+                                                                GLsizei instancecount,
+                                                                GLint basevertex)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawElementsInstancedBaseVertex);
+    return table->drawElementsInstancedBaseVertex(mode, count, type, indices, instancecount,
+                                                  basevertex);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexBaseInstanceHook(GLenum mode,
+                                                                            GLsizei count,
+                                                                            GLenum type,
+                                                                            const void *indices,
+                                                                            GLsizei instancecount,
+                                                                            GLint basevertex,
+                                                                            GLuint baseinstance)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawElementsInstancedBaseVertexBaseInstance);
+    return table->drawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices,
+                                                              instancecount, basevertex,
+                                                              baseinstance);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawRangeElementsHook(GLenum mode,
+                                                  GLuint start,
+                                                  GLuint end,
+                                                  GLsizei count,
+                                                  GLenum type,
+                                                  const void *indices)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawRangeElements);
+    return table->drawRangeElements(mode, start, end, count, type, indices);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawRangeElementsBaseVertexHook(GLenum mode,
+                                                            GLuint start,
+                                                            GLuint end,
+                                                            GLsizei count,
+                                                            GLenum type,
+                                                            const void *indices,
+                                                            GLint basevertex)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawRangeElementsBaseVertex);
+    return table->drawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawTransformFeedbackHook(GLenum mode, GLuint id)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawTransformFeedback);
+    return table->drawTransformFeedback(mode, id);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawTransformFeedbackInstancedHook(GLenum mode,
+                                                               GLuint id,
+                                                               GLsizei instancecount)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawTransformFeedbackInstanced);
+    return table->drawTransformFeedbackInstanced(mode, id, instancecount);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawTransformFeedbackStreamHook(GLenum mode, GLuint id, GLuint stream)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawTransformFeedbackStream);
+    return table->drawTransformFeedbackStream(mode, id, stream);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glDrawTransformFeedbackStreamInstancedHook(GLenum mode,
+                                                                     GLuint id,
+                                                                     GLuint stream,
+                                                                     GLsizei instancecount)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::DrawTransformFeedbackStreamInstanced);
+    return table->drawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEGLImageTargetRenderbufferStorageOESHook(GLenum target,
+                                                                     GLeglImageOES image)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::EGLImageTargetRenderbufferStorageOES);
+    return table->eGLImageTargetRenderbufferStorageOES(target, image);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEGLImageTargetTexture2DOESHook(GLenum target, GLeglImageOES image)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::EGLImageTargetTexture2DOES);
+    return table->eGLImageTargetTexture2DOES(target, image);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEnableHook(GLenum cap)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Enable);
+    return table->enable(cap);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEnableVertexArrayAttribHook(GLuint vaobj, GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::EnableVertexArrayAttrib);
+    return table->enableVertexArrayAttrib(vaobj, index);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEnableVertexAttribArrayHook(GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::EnableVertexAttribArray);
+    return table->enableVertexAttribArray(index);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEnableiHook(GLenum target, GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Enablei);
+    return table->enablei(target, index);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEndConditionalRenderHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::EndConditionalRender);
+    return table->endConditionalRender();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEndQueryHook(GLenum target)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::EndQuery);
+    return table->endQuery(target);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEndQueryIndexedHook(GLenum target, GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::EndQueryIndexed);
+    return table->endQueryIndexed(target, index);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glEndTransformFeedbackHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::EndTransformFeedback);
+    return table->endTransformFeedback();
+}
+
+template <size_t Slot>
+GLsync INTERNAL_GL_APIENTRY glFenceSyncHook(GLenum condition, GLbitfield flags)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FenceSync);
+    return table->fenceSync(condition, flags);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFinishHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Finish);
+    return table->finish();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFinishFenceNVHook(GLuint fence)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FinishFenceNV);
+    return table->finishFenceNV(fence);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFlushHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Flush);
+    return table->flush();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFlushMappedBufferRangeHook(GLenum target,
+                                                       GLintptr offset,
+                                                       GLsizeiptr length)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FlushMappedBufferRange);
+    return table->flushMappedBufferRange(target, offset, length);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFlushMappedNamedBufferRangeHook(GLuint buffer,
+                                                            GLintptr offset,
+                                                            GLsizeiptr length)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FlushMappedNamedBufferRange);
+    return table->flushMappedNamedBufferRange(buffer, offset, length);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFramebufferParameteriHook(GLenum target, GLenum pname, GLint param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FramebufferParameteri);
+    return table->framebufferParameteri(target, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFramebufferRenderbufferHook(GLenum target,
+                                                        GLenum attachment,
+                                                        GLenum renderbuffertarget,
+                                                        GLuint renderbuffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FramebufferRenderbuffer);
+    return table->framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFramebufferTextureHook(GLenum target,
+                                                   GLenum attachment,
+                                                   GLuint texture,
+                                                   GLint level)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FramebufferTexture);
+    return table->framebufferTexture(target, attachment, texture, level);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFramebufferTexture1DHook(GLenum target,
+                                                     GLenum attachment,
+                                                     GLenum textarget,
+                                                     GLuint texture,
+                                                     GLint level)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FramebufferTexture1D);
+    return table->framebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFramebufferTexture2DHook(GLenum target,
+                                                     GLenum attachment,
+                                                     GLenum textarget,
+                                                     GLuint texture,
+                                                     GLint level)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FramebufferTexture2D);
+    return table->framebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFramebufferTexture3DHook(GLenum target,
+                                                     GLenum attachment,
+                                                     GLenum textarget,
+                                                     GLuint texture,
+                                                     GLint level,
+                                                     GLint zoffset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FramebufferTexture3D);
+    return table->framebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFramebufferTextureLayerHook(GLenum target,
+                                                        GLenum attachment,
+                                                        GLuint texture,
+                                                        GLint level,
+                                                        GLint layer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FramebufferTextureLayer);
+    return table->framebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glFrontFaceHook(GLenum mode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::FrontFace);
+    return table->frontFace(mode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenBuffersHook(GLsizei n, GLuint *buffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenBuffers);
+    return table->genBuffers(n, buffers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenFencesNVHook(GLsizei n, GLuint *fences)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenFencesNV);
+    return table->genFencesNV(n, fences);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenFramebuffersHook(GLsizei n, GLuint *framebuffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenFramebuffers);
+    return table->genFramebuffers(n, framebuffers);
+}
+
+template <size_t Slot>
+GLuint INTERNAL_GL_APIENTRY glGenPathsNVHook(GLsizei range)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenPathsNV);
+    return table->genPathsNV(range);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenProgramPipelinesHook(GLsizei n, GLuint *pipelines)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenProgramPipelines);
+    return table->genProgramPipelines(n, pipelines);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenQueriesHook(GLsizei n, GLuint *ids)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenQueries);
+    return table->genQueries(n, ids);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenRenderbuffersHook(GLsizei n, GLuint *renderbuffers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenRenderbuffers);
+    return table->genRenderbuffers(n, renderbuffers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenSamplersHook(GLsizei count, GLuint *samplers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenSamplers);
+    return table->genSamplers(count, samplers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenTexturesHook(GLsizei n, GLuint *textures)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenTextures);
+    return table->genTextures(n, textures);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenTransformFeedbacksHook(GLsizei n, GLuint *ids)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenTransformFeedbacks);
+    return table->genTransformFeedbacks(n, ids);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenVertexArraysHook(GLsizei n, GLuint *arrays)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenVertexArrays);
+    return table->genVertexArrays(n, arrays);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenerateMipmapHook(GLenum target)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenerateMipmap);
+    return table->generateMipmap(target);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGenerateTextureMipmapHook(GLuint texture)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GenerateTextureMipmap);
+    return table->generateTextureMipmap(texture);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveAtomicCounterBufferivHook(GLuint program,
+                                                               GLuint bufferIndex,
+                                                               GLenum pname,
+                                                               GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveAtomicCounterBufferiv);
+    return table->getActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveAttribHook(GLuint program,
+                                                GLuint index,
+                                                GLsizei bufSize,
+                                                GLsizei *length,
+                                                GLint *size,
+                                                GLenum *type,
+                                                GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveAttrib);
+    return table->getActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveSubroutineNameHook(GLuint program,
+                                                        GLenum shadertype,
+                                                        GLuint index,
+                                                        GLsizei bufsize,
+                                                        GLsizei *length,
+                                                        GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveSubroutineName);
+    return table->getActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveSubroutineUniformNameHook(GLuint program,
+                                                               GLenum shadertype,
+                                                               GLuint index,
+                                                               GLsizei bufsize,
+                                                               GLsizei *length,
+                                                               GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveSubroutineUniformName);
+    return table->getActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveSubroutineUniformivHook(GLuint program,
+                                                             GLenum shadertype,
+                                                             GLuint index,
+                                                             GLenum pname,
+                                                             GLint *values)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveSubroutineUniformiv);
+    return table->getActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveUniformHook(GLuint program,
+                                                 GLuint index,
+                                                 GLsizei bufSize,
+                                                 GLsizei *length,
+                                                 GLint *size,
+                                                 GLenum *type,
+                                                 GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveUniform);
+    return table->getActiveUniform(program, index, bufSize, length, size, type, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveUniformBlockNameHook(GLuint program,
+                                                          GLuint uniformBlockIndex,
+                                                          GLsizei bufSize,
+                                                          GLsizei *length,
+                                                          GLchar *uniformBlockName)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveUniformBlockName);
+    return table->getActiveUniformBlockName(program, uniformBlockIndex, bufSize, length,
+                                            uniformBlockName);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveUniformBlockivHook(GLuint program,
+                                                        GLuint uniformBlockIndex,
+                                                        GLenum pname,
+                                                        GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveUniformBlockiv);
+    return table->getActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveUniformNameHook(GLuint program,
+                                                     GLuint uniformIndex,
+                                                     GLsizei bufSize,
+                                                     GLsizei *length,
+                                                     GLchar *uniformName)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveUniformName);
+    return table->getActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetActiveUniformsivHook(GLuint program,
+                                                    GLsizei uniformCount,
+                                                    const GLuint *uniformIndices,
+                                                    GLenum pname,
+                                                    GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetActiveUniformsiv);
+    return table->getActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetAttachedShadersHook(GLuint program,
+                                                   GLsizei maxCount,
+                                                   GLsizei *count,
+                                                   GLuint *shaders)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetAttachedShaders);
+    return table->getAttachedShaders(program, maxCount, count, shaders);
+}
+
+template <size_t Slot>
+GLint INTERNAL_GL_APIENTRY glGetAttribLocationHook(GLuint program, const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetAttribLocation);
+    return table->getAttribLocation(program, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetBooleani_vHook(GLenum target, GLuint index, GLboolean *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetBooleani_v);
+    return table->getBooleani_v(target, index, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetBooleanvHook(GLenum pname, GLboolean *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetBooleanv);
+    return table->getBooleanv(pname, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetBufferParameteri64vHook(GLenum target, GLenum pname, GLint64 *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetBufferParameteri64v);
+    return table->getBufferParameteri64v(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetBufferParameterivHook(GLenum target, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetBufferParameteriv);
+    return table->getBufferParameteriv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetBufferPointervHook(GLenum target, GLenum pname, void **params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetBufferPointerv);
+    return table->getBufferPointerv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetBufferSubDataHook(GLenum target,
+                                                 GLintptr offset,
+                                                 GLsizeiptr size,
+                                                 void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetBufferSubData);
+    return table->getBufferSubData(target, offset, size, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetCompressedTexImageHook(GLenum target, GLint level, void *img)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetCompressedTexImage);
+    return table->getCompressedTexImage(target, level, img);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetCompressedTextureImageHook(GLuint texture,
+                                                          GLint level,
+                                                          GLsizei bufSize,
+                                                          void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetCompressedTextureImage);
+    return table->getCompressedTextureImage(texture, level, bufSize, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetCompressedTextureSubImageHook(GLuint texture,
+                                                             GLint level,
+                                                             GLint xoffset,
+                                                             GLint yoffset,
+                                                             GLint zoffset,
+                                                             GLsizei width,
+                                                             GLsizei height,
+                                                             GLsizei depth,
+                                                             GLsizei bufSize,
+                                                             void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetCompressedTextureSubImage);
+    return table->getCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width,
+                                               height, depth, bufSize, pixels);
+}
+
+template <size_t Slot>
+GLuint INTERNAL_GL_APIENTRY glGetDebugMessageLogHook(GLuint count,
+                                                     GLsizei bufSize,
+                                                     GLenum *sources,
+                                                     GLenum *types,
+                                                     GLuint *ids,
+                                                     GLenum *severities,
+                                                     GLsizei *lengths,
+                                                     GLchar *messageLog)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetDebugMessageLog);
+    return table->getDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths,
+                                     messageLog);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetDoublei_vHook(GLenum target, GLuint index, GLdouble *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetDoublei_v);
+    return table->getDoublei_v(target, index, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetDoublevHook(GLenum pname, GLdouble *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetDoublev);
+    return table->getDoublev(pname, data);
+}
+
+template <size_t Slot>
+GLenum INTERNAL_GL_APIENTRY glGetErrorHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetError);
+    return table->getError();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetFenceivNVHook(GLuint fence, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetFenceivNV);
+    return table->getFenceivNV(fence, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetFloati_vHook(GLenum target, GLuint index, GLfloat *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetFloati_v);
+    return table->getFloati_v(target, index, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetFloatvHook(GLenum pname, GLfloat *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetFloatv);
+    return table->getFloatv(pname, data);
+}
+
+template <size_t Slot>
+GLint INTERNAL_GL_APIENTRY glGetFragDataIndexHook(GLuint program, const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetFragDataIndex);
+    return table->getFragDataIndex(program, name);
+}
+
+template <size_t Slot>
+GLint INTERNAL_GL_APIENTRY glGetFragDataLocationHook(GLuint program, const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetFragDataLocation);
+    return table->getFragDataLocation(program, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetFramebufferAttachmentParameterivHook(GLenum target,
+                                                                    GLenum attachment,
+                                                                    GLenum pname,
+                                                                    GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetFramebufferAttachmentParameteriv);
+    return table->getFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetFramebufferParameterivHook(GLenum target,
+                                                          GLenum pname,
+                                                          GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetFramebufferParameteriv);
+    return table->getFramebufferParameteriv(target, pname, params);
+}
+
+template <size_t Slot>
+GLenum INTERNAL_GL_APIENTRY glGetGraphicsResetStatusHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetGraphicsResetStatus);
+    return table->getGraphicsResetStatus();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetInteger64i_vHook(GLenum target, GLuint index, GLint64 *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetInteger64i_v);
+    return table->getInteger64i_v(target, index, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetInteger64vHook(GLenum pname, GLint64 *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetInteger64v);
+    return table->getInteger64v(pname, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetIntegeri_vHook(GLenum target, GLuint index, GLint *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetIntegeri_v);
+    return table->getIntegeri_v(target, index, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetIntegervHook(GLenum pname, GLint *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetIntegerv);
+    return table->getIntegerv(pname, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetInternalformatSampleivNVHook(GLenum target,
+                                                            GLenum internalformat,
+                                                            GLsizei samples,
+                                                            GLenum pname,
+                                                            GLsizei bufSize,
+                                                            GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetInternalformatSampleivNV);
+    return table->getInternalformatSampleivNV(target, internalformat, samples, pname, bufSize,
+                                              params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetInternalformati64vHook(GLenum target,
+                                                      GLenum internalformat,
+                                                      GLenum pname,
+                                                      GLsizei bufSize,
+                                                      GLint64 *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetInternalformati64v);
+    return table->getInternalformati64v(target, internalformat, pname, bufSize, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetInternalformativHook(GLenum target,
+                                                    GLenum internalformat,
+                                                    GLenum pname,
+                                                    GLsizei bufSize,
+                                                    GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetInternalformativ);
+    return table->getInternalformativ(target, internalformat, pname, bufSize, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetMultisamplefvHook(GLenum pname, GLuint index, GLfloat *val)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetMultisamplefv);
+    return table->getMultisamplefv(pname, index, val);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetNamedBufferParameteri64vHook(GLuint buffer,
+                                                            GLenum pname,
+                                                            GLint64 *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetNamedBufferParameteri64v);
+    return table->getNamedBufferParameteri64v(buffer, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetNamedBufferParameterivHook(GLuint buffer,
+                                                          GLenum pname,
+                                                          GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetNamedBufferParameteriv);
+    return table->getNamedBufferParameteriv(buffer, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetNamedBufferPointervHook(GLuint buffer, GLenum pname, void **params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetNamedBufferPointerv);
+    return table->getNamedBufferPointerv(buffer, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetNamedBufferSubDataHook(GLuint buffer,
+                                                      GLintptr offset,
+                                                      GLsizeiptr size,
+                                                      void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetNamedBufferSubData);
+    return table->getNamedBufferSubData(buffer, offset, size, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetNamedFramebufferAttachmentParameterivHook(GLuint framebuffer,
+                                                                         GLenum attachment,
+                                                                         GLenum pname,
+                                                                         GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetNamedFramebufferAttachmentParameteriv);
+    return table->getNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetNamedFramebufferParameterivHook(GLuint framebuffer,
+                                                               GLenum pname,
+                                                               GLint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetNamedFramebufferParameteriv);
+    return table->getNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetNamedRenderbufferParameterivHook(GLuint renderbuffer,
+                                                                GLenum pname,
+                                                                GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetNamedRenderbufferParameteriv);
+    return table->getNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetObjectLabelHook(GLenum identifier,
+                                               GLuint name,
+                                               GLsizei bufSize,
+                                               GLsizei *length,
+                                               GLchar *label)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetObjectLabel);
+    return table->getObjectLabel(identifier, name, bufSize, length, label);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetObjectPtrLabelHook(const void *ptr,
+                                                  GLsizei bufSize,
+                                                  GLsizei *length,
+                                                  GLchar *label)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetObjectPtrLabel);
+    return table->getObjectPtrLabel(ptr, bufSize, length, label);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetPathParameterfvNVHook(GLuint path, GLenum pname, GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetPathParameterfvNV);
+    return table->getPathParameterfvNV(path, pname, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetPathParameterivNVHook(GLuint path, GLenum pname, GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetPathParameterivNV);
+    return table->getPathParameterivNV(path, pname, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetPointervHook(GLenum pname, void **params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetPointerv);
+    return table->getPointerv(pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramBinaryHook(GLuint program,
+                                                 GLsizei bufSize,
+                                                 GLsizei *length,
+                                                 GLenum *binaryFormat,
+                                                 void *binary)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramBinary);
+    return table->getProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramInfoLogHook(GLuint program,
+                                                  GLsizei bufSize,
+                                                  GLsizei *length,
+                                                  GLchar *infoLog)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramInfoLog);
+    return table->getProgramInfoLog(program, bufSize, length, infoLog);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramInterfaceivHook(GLuint program,
+                                                      GLenum programInterface,
+                                                      GLenum pname,
+                                                      GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramInterfaceiv);
+    return table->getProgramInterfaceiv(program, programInterface, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramPipelineInfoLogHook(GLuint pipeline,
+                                                          GLsizei bufSize,
+                                                          GLsizei *length,
+                                                          GLchar *infoLog)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramPipelineInfoLog);
+    return table->getProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramPipelineivHook(GLuint pipeline, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramPipelineiv);
+    return table->getProgramPipelineiv(pipeline, pname, params);
+}
+
+template <size_t Slot>
+GLuint INTERNAL_GL_APIENTRY glGetProgramResourceIndexHook(GLuint program,
+                                                          GLenum programInterface,
+                                                          const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramResourceIndex);
+    return table->getProgramResourceIndex(program, programInterface, name);
+}
+
+template <size_t Slot>
+GLint INTERNAL_GL_APIENTRY glGetProgramResourceLocationHook(GLuint program,
+                                                            GLenum programInterface,
+                                                            const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramResourceLocation);
+    return table->getProgramResourceLocation(program, programInterface, name);
+}
+
+template <size_t Slot>
+GLint INTERNAL_GL_APIENTRY glGetProgramResourceLocationIndexHook(GLuint program,
+                                                                 GLenum programInterface,
+                                                                 const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramResourceLocationIndex);
+    return table->getProgramResourceLocationIndex(program, programInterface, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramResourceNameHook(GLuint program,
+                                                       GLenum programInterface,
+                                                       GLuint index,
+                                                       GLsizei bufSize,
+                                                       GLsizei *length,
+                                                       GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramResourceName);
+    return table->getProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramResourceivHook(GLuint program,
+                                                     GLenum programInterface,
+                                                     GLuint index,
+                                                     GLsizei propCount,
+                                                     const GLenum *props,
+                                                     GLsizei bufSize,
+                                                     GLsizei *length,
+                                                     GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramResourceiv);
+    return table->getProgramResourceiv(program, programInterface, index, propCount, props, bufSize,
+                                       length, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramStageivHook(GLuint program,
+                                                  GLenum shadertype,
+                                                  GLenum pname,
+                                                  GLint *values)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramStageiv);
+    return table->getProgramStageiv(program, shadertype, pname, values);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetProgramivHook(GLuint program, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetProgramiv);
+    return table->getProgramiv(program, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryBufferObjecti64vHook(GLuint id,
+                                                         GLuint buffer,
+                                                         GLenum pname,
+                                                         GLintptr offset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryBufferObjecti64v);
+    return table->getQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryBufferObjectivHook(GLuint id,
+                                                       GLuint buffer,
+                                                       GLenum pname,
+                                                       GLintptr offset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryBufferObjectiv);
+    return table->getQueryBufferObjectiv(id, buffer, pname, offset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryBufferObjectui64vHook(GLuint id,
+                                                          GLuint buffer,
+                                                          GLenum pname,
+                                                          GLintptr offset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryBufferObjectui64v);
+    return table->getQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryBufferObjectuivHook(GLuint id,
+                                                        GLuint buffer,
+                                                        GLenum pname,
+                                                        GLintptr offset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryBufferObjectuiv);
+    return table->getQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryIndexedivHook(GLenum target,
+                                                  GLuint index,
+                                                  GLenum pname,
+                                                  GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryIndexediv);
+    return table->getQueryIndexediv(target, index, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryObjecti64vHook(GLuint id, GLenum pname, GLint64 *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryObjecti64v);
+    return table->getQueryObjecti64v(id, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryObjectivHook(GLuint id, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryObjectiv);
+    return table->getQueryObjectiv(id, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryObjectui64vHook(GLuint id, GLenum pname, GLuint64 *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryObjectui64v);
+    return table->getQueryObjectui64v(id, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryObjectuivHook(GLuint id, GLenum pname, GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryObjectuiv);
+    return table->getQueryObjectuiv(id, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetQueryivHook(GLenum target, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetQueryiv);
+    return table->getQueryiv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetRenderbufferParameterivHook(GLenum target,
+                                                           GLenum pname,
+                                                           GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetRenderbufferParameteriv);
+    return table->getRenderbufferParameteriv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetSamplerParameterIivHook(GLuint sampler, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetSamplerParameterIiv);
+    return table->getSamplerParameterIiv(sampler, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetSamplerParameterIuivHook(GLuint sampler,
+                                                        GLenum pname,
+                                                        GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetSamplerParameterIuiv);
+    return table->getSamplerParameterIuiv(sampler, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetSamplerParameterfvHook(GLuint sampler, GLenum pname, GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetSamplerParameterfv);
+    return table->getSamplerParameterfv(sampler, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetSamplerParameterivHook(GLuint sampler, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetSamplerParameteriv);
+    return table->getSamplerParameteriv(sampler, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetShaderInfoLogHook(GLuint shader,
+                                                 GLsizei bufSize,
+                                                 GLsizei *length,
+                                                 GLchar *infoLog)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetShaderInfoLog);
+    return table->getShaderInfoLog(shader, bufSize, length, infoLog);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetShaderPrecisionFormatHook(GLenum shadertype,
+                                                         GLenum precisiontype,
+                                                         GLint *range,
+                                                         GLint *precision)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetShaderPrecisionFormat);
+    return table->getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetShaderSourceHook(GLuint shader,
+                                                GLsizei bufSize,
+                                                GLsizei *length,
+                                                GLchar *source)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetShaderSource);
+    return table->getShaderSource(shader, bufSize, length, source);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetShaderivHook(GLuint shader, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetShaderiv);
+    return table->getShaderiv(shader, pname, params);
+}
+
+template <size_t Slot>
+const GLubyte * INTERNAL_GL_APIENTRY glGetStringHook(GLenum name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetString);
+    return table->getString(name);
+}
+
+template <size_t Slot>
+const GLubyte * INTERNAL_GL_APIENTRY glGetStringiHook(GLenum name, GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetStringi);
+    return table->getStringi(name, index);
+}
+
+template <size_t Slot>
+GLuint INTERNAL_GL_APIENTRY glGetSubroutineIndexHook(GLuint program,
+                                                     GLenum shadertype,
+                                                     const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetSubroutineIndex);
+    return table->getSubroutineIndex(program, shadertype, name);
+}
+
+template <size_t Slot>
+GLint INTERNAL_GL_APIENTRY glGetSubroutineUniformLocationHook(GLuint program,
+                                                              GLenum shadertype,
+                                                              const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetSubroutineUniformLocation);
+    return table->getSubroutineUniformLocation(program, shadertype, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glGetSyncivHook(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetSynciv);
+    return table->getSynciv(sync, pname, bufSize, length, values);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glGetTexImageHook(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTexImage);
+    return table->getTexImage(target, level, format, type, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTexLevelParameterfvHook(GLenum target,
+                                                       GLint level,
+                                                       GLenum pname,
+                                                       GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTexLevelParameterfv);
+    return table->getTexLevelParameterfv(target, level, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTexLevelParameterivHook(GLenum target,
+                                                       GLint level,
+                                                       GLenum pname,
+                                                       GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTexLevelParameteriv);
+    return table->getTexLevelParameteriv(target, level, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTexParameterIivHook(GLenum target, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTexParameterIiv);
+    return table->getTexParameterIiv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTexParameterIuivHook(GLenum target, GLenum pname, GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTexParameterIuiv);
+    return table->getTexParameterIuiv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTexParameterfvHook(GLenum target, GLenum pname, GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTexParameterfv);
+    return table->getTexParameterfv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTexParameterivHook(GLenum target, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTexParameteriv);
+    return table->getTexParameteriv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTextureImageHook(GLuint texture,
+                                                GLint level,
+                                                GLenum format,
+                                                GLenum type,
+                                                GLsizei bufSize,
+                                                void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTextureImage);
+    return table->getTextureImage(texture, level, format, type, bufSize, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTextureLevelParameterfvHook(GLuint texture,
+                                                           GLint level,
+                                                           GLenum pname,
+                                                           GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTextureLevelParameterfv);
+    return table->getTextureLevelParameterfv(texture, level, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTextureLevelParameterivHook(GLuint texture,
+                                                           GLint level,
+                                                           GLenum pname,
+                                                           GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTextureLevelParameteriv);
+    return table->getTextureLevelParameteriv(texture, level, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTextureParameterIivHook(GLuint texture, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTextureParameterIiv);
+    return table->getTextureParameterIiv(texture, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTextureParameterIuivHook(GLuint texture,
+                                                        GLenum pname,
+                                                        GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTextureParameterIuiv);
+    return table->getTextureParameterIuiv(texture, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTextureParameterfvHook(GLuint texture, GLenum pname, GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTextureParameterfv);
+    return table->getTextureParameterfv(texture, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTextureParameterivHook(GLuint texture, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTextureParameteriv);
+    return table->getTextureParameteriv(texture, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTextureSubImageHook(GLuint texture,
+                                                   GLint level,
+                                                   GLint xoffset,
+                                                   GLint yoffset,
+                                                   GLint zoffset,
+                                                   GLsizei width,
+                                                   GLsizei height,
+                                                   GLsizei depth,
+                                                   GLenum format,
+                                                   GLenum type,
+                                                   GLsizei bufSize,
+                                                   void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTextureSubImage);
+    return table->getTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height,
+                                     depth, format, type, bufSize, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTransformFeedbackVaryingHook(GLuint program,
+                                                            GLuint index,
+                                                            GLsizei bufSize,
+                                                            GLsizei *length,
+                                                            GLsizei *size,
+                                                            GLenum *type,
+                                                            GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTransformFeedbackVarying);
+    return table->getTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTransformFeedbacki64_vHook(GLuint xfb,
+                                                          GLenum pname,
+                                                          GLuint index,
+                                                          GLint64 *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTransformFeedbacki64_v);
+    return table->getTransformFeedbacki64_v(xfb, pname, index, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTransformFeedbacki_vHook(GLuint xfb,
+                                                        GLenum pname,
+                                                        GLuint index,
+                                                        GLint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTransformFeedbacki_v);
+    return table->getTransformFeedbacki_v(xfb, pname, index, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetTransformFeedbackivHook(GLuint xfb, GLenum pname, GLint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetTransformFeedbackiv);
+    return table->getTransformFeedbackiv(xfb, pname, param);
+}
+
+template <size_t Slot>
+GLuint INTERNAL_GL_APIENTRY glGetUniformBlockIndexHook(GLuint program,
+                                                       const GLchar *uniformBlockName)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetUniformBlockIndex);
+    return table->getUniformBlockIndex(program, uniformBlockName);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetUniformIndicesHook(GLuint program,
+                                                  GLsizei uniformCount,
+                                                  const GLchar *const *uniformNames,
+                                                  GLuint *uniformIndices)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetUniformIndices);
+    return table->getUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+
+template <size_t Slot>
+GLint INTERNAL_GL_APIENTRY glGetUniformLocationHook(GLuint program, const GLchar *name)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetUniformLocation);
+    return table->getUniformLocation(program, name);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetUniformSubroutineuivHook(GLenum shadertype,
+                                                        GLint location,
+                                                        GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetUniformSubroutineuiv);
+    return table->getUniformSubroutineuiv(shadertype, location, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetUniformdvHook(GLuint program, GLint location, GLdouble *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetUniformdv);
+    return table->getUniformdv(program, location, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetUniformfvHook(GLuint program, GLint location, GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetUniformfv);
+    return table->getUniformfv(program, location, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetUniformivHook(GLuint program, GLint location, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetUniformiv);
+    return table->getUniformiv(program, location, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetUniformuivHook(GLuint program, GLint location, GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetUniformuiv);
+    return table->getUniformuiv(program, location, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexArrayIndexed64ivHook(GLuint vaobj,
+                                                          GLuint index,
+                                                          GLenum pname,
+                                                          GLint64 *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexArrayIndexed64iv);
+    return table->getVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexArrayIndexedivHook(GLuint vaobj,
+                                                        GLuint index,
+                                                        GLenum pname,
+                                                        GLint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexArrayIndexediv);
+    return table->getVertexArrayIndexediv(vaobj, index, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexArrayivHook(GLuint vaobj, GLenum pname, GLint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexArrayiv);
+    return table->getVertexArrayiv(vaobj, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexAttribIivHook(GLuint index, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexAttribIiv);
+    return table->getVertexAttribIiv(index, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexAttribIuivHook(GLuint index, GLenum pname, GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexAttribIuiv);
+    return table->getVertexAttribIuiv(index, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexAttribLdvHook(GLuint index, GLenum pname, GLdouble *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexAttribLdv);
+    return table->getVertexAttribLdv(index, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexAttribPointervHook(GLuint index, GLenum pname, void **pointer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexAttribPointerv);
+    return table->getVertexAttribPointerv(index, pname, pointer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexAttribdvHook(GLuint index, GLenum pname, GLdouble *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexAttribdv);
+    return table->getVertexAttribdv(index, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexAttribfvHook(GLuint index, GLenum pname, GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexAttribfv);
+    return table->getVertexAttribfv(index, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetVertexAttribivHook(GLuint index, GLenum pname, GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetVertexAttribiv);
+    return table->getVertexAttribiv(index, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetnCompressedTexImageHook(GLenum target,
+                                                       GLint lod,
+                                                       GLsizei bufSize,
+                                                       void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetnCompressedTexImage);
+    return table->getnCompressedTexImage(target, lod, bufSize, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetnTexImageHook(GLenum target,
+                                             GLint level,
+                                             GLenum format,
+                                             GLenum type,
+                                             GLsizei bufSize,
+                                             void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetnTexImage);
+    return table->getnTexImage(target, level, format, type, bufSize, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetnUniformdvHook(GLuint program,
+                                              GLint location,
+                                              GLsizei bufSize,
+                                              GLdouble *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetnUniformdv);
+    return table->getnUniformdv(program, location, bufSize, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetnUniformfvHook(GLuint program,
+                                              GLint location,
+                                              GLsizei bufSize,
+                                              GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetnUniformfv);
+    return table->getnUniformfv(program, location, bufSize, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetnUniformivHook(GLuint program,
+                                              GLint location,
+                                              GLsizei bufSize,
+                                              GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetnUniformiv);
+    return table->getnUniformiv(program, location, bufSize, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glGetnUniformuivHook(GLuint program,
+                                               GLint location,
+                                               GLsizei bufSize,
+                                               GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::GetnUniformuiv);
+    return table->getnUniformuiv(program, location, bufSize, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glHintHook(GLenum target, GLenum mode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Hint);
+    return table->hint(target, mode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInsertEventMarkerEXTHook(GLsizei length, const GLchar *marker)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InsertEventMarkerEXT);
+    return table->insertEventMarkerEXT(length, marker);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInvalidateBufferDataHook(GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InvalidateBufferData);
+    return table->invalidateBufferData(buffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInvalidateBufferSubDataHook(GLuint buffer,
+                                                        GLintptr offset,
+                                                        GLsizeiptr length)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InvalidateBufferSubData);
+    return table->invalidateBufferSubData(buffer, offset, length);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInvalidateFramebufferHook(GLenum target,
+                                                      GLsizei numAttachments,
+                                                      const GLenum *attachments)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InvalidateFramebuffer);
+    return table->invalidateFramebuffer(target, numAttachments, attachments);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInvalidateNamedFramebufferDataHook(GLuint framebuffer,
+                                                               GLsizei numAttachments,
+                                                               const GLenum *attachments)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InvalidateNamedFramebufferData);
+    return table->invalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInvalidateNamedFramebufferSubDataHook(GLuint framebuffer,
+                                                                  GLsizei numAttachments,
+                                                                  const GLenum *attachments,
+                                                                  GLint x,
+                                                                  GLint y,
+                                                                  GLsizei width,
+                                                                  GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InvalidateNamedFramebufferSubData);
+    return table->invalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y,
+                                                    width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInvalidateSubFramebufferHook(GLenum target,
+                                                         GLsizei numAttachments,
+                                                         const GLenum *attachments,
+                                                         GLint x,
+                                                         GLint y,
+                                                         GLsizei width,
+                                                         GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InvalidateSubFramebuffer);
+    return table->invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width,
+                                           height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInvalidateTexImageHook(GLuint texture, GLint level)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InvalidateTexImage);
+    return table->invalidateTexImage(texture, level);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glInvalidateTexSubImageHook(GLuint texture,
+                                                      GLint level,
+                                                      GLint xoffset,
+                                                      GLint yoffset,
+                                                      GLint zoffset,
+                                                      GLsizei width,
+                                                      GLsizei height,
+                                                      GLsizei depth)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::InvalidateTexSubImage);
+    return table->invalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height,
+                                        depth);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsBufferHook(GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsBuffer);
+    return table->isBuffer(buffer);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsEnabledHook(GLenum cap)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsEnabled);
+    return table->isEnabled(cap);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsEnablediHook(GLenum target, GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsEnabledi);
+    return table->isEnabledi(target, index);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsFenceNVHook(GLuint fence)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsFenceNV);
+    return table->isFenceNV(fence);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsFramebufferHook(GLuint framebuffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsFramebuffer);
+    return table->isFramebuffer(framebuffer);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsPathNVHook(GLuint path)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsPathNV);
+    return table->isPathNV(path);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsProgramHook(GLuint program)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsProgram);
+    return table->isProgram(program);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsProgramPipelineHook(GLuint pipeline)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsProgramPipeline);
+    return table->isProgramPipeline(pipeline);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsQueryHook(GLuint id)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsQuery);
+    return table->isQuery(id);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsRenderbufferHook(GLuint renderbuffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsRenderbuffer);
+    return table->isRenderbuffer(renderbuffer);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsSamplerHook(GLuint sampler)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsSampler);
+    return table->isSampler(sampler);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsShaderHook(GLuint shader)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsShader);
+    return table->isShader(shader);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsSyncHook(GLsync sync)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsSync);
+    return table->isSync(sync);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsTextureHook(GLuint texture)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsTexture);
+    return table->isTexture(texture);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsTransformFeedbackHook(GLuint id)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsTransformFeedback);
+    return table->isTransformFeedback(id);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glIsVertexArrayHook(GLuint array)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::IsVertexArray);
+    return table->isVertexArray(array);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glLineWidthHook(GLfloat width)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::LineWidth);
+    return table->lineWidth(width);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glLinkProgramHook(GLuint program)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::LinkProgram);
+    return table->linkProgram(program);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glLogicOpHook(GLenum opcode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::LogicOp);
+    return table->logicOp(opcode);
+}
+
+template <size_t Slot>
+void *INTERNAL_GL_APIENTRY glMapBufferHook(GLenum target, GLenum access)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MapBuffer);
+    return table->mapBuffer(target, access);
+}
+
+template <size_t Slot>
+void *INTERNAL_GL_APIENTRY glMapBufferRangeHook(GLenum target,
+                                                GLintptr offset,
+                                                GLsizeiptr length,
+                                                GLbitfield access)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MapBufferRange);
+    return table->mapBufferRange(target, offset, length, access);
+}
+
+template <size_t Slot>
+void *INTERNAL_GL_APIENTRY glMapNamedBufferHook(GLuint buffer, GLenum access)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MapNamedBuffer);
+    return table->mapNamedBuffer(buffer, access);
+}
+
+template <size_t Slot>
+void *INTERNAL_GL_APIENTRY glMapNamedBufferRangeHook(GLuint buffer,
+                                                     GLintptr offset,
+                                                     GLsizeiptr length,
+                                                     GLbitfield access)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MapNamedBufferRange);
+    return table->mapNamedBufferRange(buffer, offset, length, access);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMatrixLoadfEXTHook(GLenum mode, const GLfloat *m)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MatrixLoadfEXT);
+    return table->matrixLoadfEXT(mode, m);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMemoryBarrierHook(GLbitfield barriers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MemoryBarrier);
+    return table->memoryBarrier(barriers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMemoryBarrierByRegionHook(GLbitfield barriers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MemoryBarrierByRegion);
+    return table->memoryBarrierByRegion(barriers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMinSampleShadingHook(GLfloat value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MinSampleShading);
+    return table->minSampleShading(value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMultiDrawArraysHook(GLenum mode,
+                                                const GLint *first,
+                                                const GLsizei *count,
+                                                GLsizei drawcount)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MultiDrawArrays);
+    return table->multiDrawArrays(mode, first, count, drawcount);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMultiDrawArraysIndirectHook(GLenum mode,
+                                                        const void *indirect,
+                                                        GLsizei drawcount,
+                                                        GLsizei stride)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MultiDrawArraysIndirect);
+    return table->multiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMultiDrawElementsHook(GLenum mode,
+                                                  const GLsizei *count,
+                                                  GLenum type,
+                                                  const void *const *indices,
+                                                  GLsizei drawcount)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MultiDrawElements);
+    return table->multiDrawElements(mode, count, type, indices, drawcount);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMultiDrawElementsBaseVertexHook(GLenum mode,
+                                                            const GLsizei *count,
+                                                            GLenum type,
+                                                            const void *const *indices,
+                                                            GLsizei drawcount,
+                                                            const GLint *basevertex)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MultiDrawElementsBaseVertex);
+    return table->multiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glMultiDrawElementsIndirectHook(GLenum mode,
+                                                          GLenum type,
+                                                          const void *indirect,
+                                                          GLsizei drawcount,
+                                                          GLsizei stride)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::MultiDrawElementsIndirect);
+    return table->multiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedBufferDataHook(GLuint buffer,
+                                                GLsizeiptr size,
+                                                const void *data,
+                                                GLenum usage)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedBufferData);
+    return table->namedBufferData(buffer, size, data, usage);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedBufferStorageHook(GLuint buffer,
+                                                   GLsizeiptr size,
+                                                   const void *data,
+                                                   GLbitfield flags)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedBufferStorage);
+    return table->namedBufferStorage(buffer, size, data, flags);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedBufferSubDataHook(GLuint buffer,
+                                                   GLintptr offset,
+                                                   GLsizeiptr size,
+                                                   const void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedBufferSubData);
+    return table->namedBufferSubData(buffer, offset, size, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedFramebufferDrawBufferHook(GLuint framebuffer, GLenum buf)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedFramebufferDrawBuffer);
+    return table->namedFramebufferDrawBuffer(framebuffer, buf);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedFramebufferDrawBuffersHook(GLuint framebuffer,
+                                                            GLsizei n,
+                                                            const GLenum *bufs)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedFramebufferDrawBuffers);
+    return table->namedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedFramebufferParameteriHook(GLuint framebuffer,
+                                                           GLenum pname,
+                                                           GLint param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedFramebufferParameteri);
+    return table->namedFramebufferParameteri(framebuffer, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedFramebufferReadBufferHook(GLuint framebuffer, GLenum src)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedFramebufferReadBuffer);
+    return table->namedFramebufferReadBuffer(framebuffer, src);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedFramebufferRenderbufferHook(GLuint framebuffer,
+                                                             GLenum attachment,
+                                                             GLenum renderbuffertarget,
+                                                             GLuint renderbuffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedFramebufferRenderbuffer);
+    return table->namedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget,
+                                               renderbuffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedFramebufferTextureHook(GLuint framebuffer,
+                                                        GLenum attachment,
+                                                        GLuint texture,
+                                                        GLint level)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedFramebufferTexture);
+    return table->namedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedFramebufferTextureLayerHook(GLuint framebuffer,
+                                                             GLenum attachment,
+                                                             GLuint texture,
+                                                             GLint level,
+                                                             GLint layer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedFramebufferTextureLayer);
+    return table->namedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedRenderbufferStorageHook(GLuint renderbuffer,
+                                                         GLenum internalformat,
+                                                         GLsizei width,
+                                                         GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedRenderbufferStorage);
+    return table->namedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glNamedRenderbufferStorageMultisampleHook(GLuint renderbuffer,
+                                                                    GLsizei samples,
+                                                                    GLenum internalformat,
+                                                                    GLsizei width,
+                                                                    GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::NamedRenderbufferStorageMultisample);
+    return table->namedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width,
+                                                      height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glObjectLabelHook(GLenum identifier,
+                                            GLuint name,
+                                            GLsizei length,
+                                            const GLchar *label)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ObjectLabel);
+    return table->objectLabel(identifier, name, length, label);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glObjectPtrLabelHook(const void *ptr, GLsizei length, const GLchar *label)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ObjectPtrLabel);
+    return table->objectPtrLabel(ptr, length, label);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPatchParameterfvHook(GLenum pname, const GLfloat *values)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PatchParameterfv);
+    return table->patchParameterfv(pname, values);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPatchParameteriHook(GLenum pname, GLint value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PatchParameteri);
+    return table->patchParameteri(pname, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPathCommandsNVHook(GLuint path,
+                                               GLsizei numCommands,
+                                               const GLubyte *commands,
+                                               GLsizei numCoords,
+                                               GLenum coordType,
+                                               const void *coords)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PathCommandsNV);
+    return table->pathCommandsNV(path, numCommands, commands, numCoords, coordType, coords);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPathParameterfNVHook(GLuint path, GLenum pname, GLfloat value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PathParameterfNV);
+    return table->pathParameterfNV(path, pname, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPathParameteriNVHook(GLuint path, GLenum pname, GLint value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PathParameteriNV);
+    return table->pathParameteriNV(path, pname, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPathStencilFuncNVHook(GLenum func, GLint ref, GLuint mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PathStencilFuncNV);
+    return table->pathStencilFuncNV(func, ref, mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPauseTransformFeedbackHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PauseTransformFeedback);
+    return table->pauseTransformFeedback();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPixelStorefHook(GLenum pname, GLfloat param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PixelStoref);
+    return table->pixelStoref(pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPixelStoreiHook(GLenum pname, GLint param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PixelStorei);
+    return table->pixelStorei(pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPointParameterfHook(GLenum pname, GLfloat param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PointParameterf);
+    return table->pointParameterf(pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPointParameterfvHook(GLenum pname, const GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PointParameterfv);
+    return table->pointParameterfv(pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPointParameteriHook(GLenum pname, GLint param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PointParameteri);
+    return table->pointParameteri(pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPointParameterivHook(GLenum pname, const GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PointParameteriv);
+    return table->pointParameteriv(pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPointSizeHook(GLfloat size)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PointSize);
+    return table->pointSize(size);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPolygonModeHook(GLenum face, GLenum mode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PolygonMode);
+    return table->polygonMode(face, mode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPolygonOffsetHook(GLfloat factor, GLfloat units)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PolygonOffset);
+    return table->polygonOffset(factor, units);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPopDebugGroupHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PopDebugGroup);
+    return table->popDebugGroup();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPopGroupMarkerEXTHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PopGroupMarkerEXT);
+    return table->popGroupMarkerEXT();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPrimitiveBoundingBoxHook(GLfloat minX,
+                                                     GLfloat minY,
+                                                     GLfloat minZ,
+                                                     GLfloat minW,
+                                                     GLfloat maxX,
+                                                     GLfloat maxY,
+                                                     GLfloat maxZ,
+                                                     GLfloat maxW)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PrimitiveBoundingBox);
+    return table->primitiveBoundingBox(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPrimitiveRestartIndexHook(GLuint index)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PrimitiveRestartIndex);
+    return table->primitiveRestartIndex(index);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramBinaryHook(GLuint program,
+                                              GLenum binaryFormat,
+                                              const void *binary,
+                                              GLsizei length)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramBinary);
+    return table->programBinary(program, binaryFormat, binary, length);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramParameteriHook(GLuint program, GLenum pname, GLint value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramParameteri);
+    return table->programParameteri(program, pname, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramPathFragmentInputGenNVHook(GLuint program,
+                                                              GLint location,
+                                                              GLenum genMode,
+                                                              GLint components,
+                                                              const GLfloat *coeffs)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramPathFragmentInputGenNV);
+    return table->programPathFragmentInputGenNV(program, location, genMode, components, coeffs);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform1dHook(GLuint program, GLint location, GLdouble v0)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform1d);
+    return table->programUniform1d(program, location, v0);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform1dvHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform1dv);
+    return table->programUniform1dv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform1fHook(GLuint program, GLint location, GLfloat v0)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform1f);
+    return table->programUniform1f(program, location, v0);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform1fvHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform1fv);
+    return table->programUniform1fv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform1iHook(GLuint program, GLint location, GLint v0)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform1i);
+    return table->programUniform1i(program, location, v0);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform1ivHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform1iv);
+    return table->programUniform1iv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform1uiHook(GLuint program, GLint location, GLuint v0)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform1ui);
+    return table->programUniform1ui(program, location, v0);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform1uivHook(GLuint program,
+                                                   GLint location,
+                                                   GLsizei count,
+                                                   const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform1uiv);
+    return table->programUniform1uiv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform2dHook(GLuint program,
+                                                 GLint location,
+                                                 GLdouble v0,
+                                                 GLdouble v1)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform2d);
+    return table->programUniform2d(program, location, v0, v1);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform2dvHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform2dv);
+    return table->programUniform2dv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform2fHook(GLuint program,
+                                                 GLint location,
+                                                 GLfloat v0,
+                                                 GLfloat v1)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform2f);
+    return table->programUniform2f(program, location, v0, v1);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform2fvHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform2fv);
+    return table->programUniform2fv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform2iHook(GLuint program, GLint location, GLint v0, GLint v1)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform2i);
+    return table->programUniform2i(program, location, v0, v1);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform2ivHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform2iv);
+    return table->programUniform2iv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform2uiHook(GLuint program,
+                                                  GLint location,
+                                                  GLuint v0,
+                                                  GLuint v1)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform2ui);
+    return table->programUniform2ui(program, location, v0, v1);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform2uivHook(GLuint program,
+                                                   GLint location,
+                                                   GLsizei count,
+                                                   const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform2uiv);
+    return table->programUniform2uiv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glProgramUniform3dHook(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform3d);
+    return table->programUniform3d(program, location, v0, v1, v2);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform3dvHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform3dv);
+    return table->programUniform3dv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glProgramUniform3fHook(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform3f);
+    return table->programUniform3f(program, location, v0, v1, v2);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform3fvHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform3fv);
+    return table->programUniform3fv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glProgramUniform3iHook(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform3i);
+    return table->programUniform3i(program, location, v0, v1, v2);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform3ivHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform3iv);
+    return table->programUniform3iv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glProgramUniform3uiHook(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform3ui);
+    return table->programUniform3ui(program, location, v0, v1, v2);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform3uivHook(GLuint program,
+                                                   GLint location,
+                                                   GLsizei count,
+                                                   const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform3uiv);
+    return table->programUniform3uiv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform4dHook(GLuint program,
+                                                 GLint location,
+                                                 GLdouble v0,
+                                                 GLdouble v1,
+                                                 GLdouble v2,
+                                                 GLdouble v3)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform4d);
+    return table->programUniform4d(program, location, v0, v1, v2, v3);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform4dvHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform4dv);
+    return table->programUniform4dv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform4fHook(GLuint program,
+                                                 GLint location,
+                                                 GLfloat v0,
+                                                 GLfloat v1,
+                                                 GLfloat v2,
+                                                 GLfloat v3)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform4f);
+    return table->programUniform4f(program, location, v0, v1, v2, v3);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform4fvHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform4fv);
+    return table->programUniform4fv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glProgramUniform4iHook(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform4i);
+    return table->programUniform4i(program, location, v0, v1, v2, v3);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform4ivHook(GLuint program,
+                                                  GLint location,
+                                                  GLsizei count,
+                                                  const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform4iv);
+    return table->programUniform4iv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glProgramUniform4uiHook(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform4ui);
+    return table->programUniform4ui(program, location, v0, v1, v2, v3);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniform4uivHook(GLuint program,
+                                                   GLint location,
+                                                   GLsizei count,
+                                                   const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniform4uiv);
+    return table->programUniform4uiv(program, location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix2dvHook(GLuint program,
+                                                        GLint location,
+                                                        GLsizei count,
+                                                        GLboolean transpose,
+                                                        const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix2dv);
+    return table->programUniformMatrix2dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix2fvHook(GLuint program,
+                                                        GLint location,
+                                                        GLsizei count,
+                                                        GLboolean transpose,
+                                                        const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix2fv);
+    return table->programUniformMatrix2fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x3dvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix2x3dv);
+    return table->programUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x3fvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix2x3fv);
+    return table->programUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x4dvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix2x4dv);
+    return table->programUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x4fvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix2x4fv);
+    return table->programUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix3dvHook(GLuint program,
+                                                        GLint location,
+                                                        GLsizei count,
+                                                        GLboolean transpose,
+                                                        const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix3dv);
+    return table->programUniformMatrix3dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix3fvHook(GLuint program,
+                                                        GLint location,
+                                                        GLsizei count,
+                                                        GLboolean transpose,
+                                                        const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix3fv);
+    return table->programUniformMatrix3fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x2dvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix3x2dv);
+    return table->programUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x2fvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix3x2fv);
+    return table->programUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x4dvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix3x4dv);
+    return table->programUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x4fvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix3x4fv);
+    return table->programUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix4dvHook(GLuint program,
+                                                        GLint location,
+                                                        GLsizei count,
+                                                        GLboolean transpose,
+                                                        const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix4dv);
+    return table->programUniformMatrix4dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix4fvHook(GLuint program,
+                                                        GLint location,
+                                                        GLsizei count,
+                                                        GLboolean transpose,
+                                                        const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix4fv);
+    return table->programUniformMatrix4fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x2dvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix4x2dv);
+    return table->programUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x2fvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix4x2fv);
+    return table->programUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x3dvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix4x3dv);
+    return table->programUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x3fvHook(GLuint program,
+                                                          GLint location,
+                                                          GLsizei count,
+                                                          GLboolean transpose,
+                                                          const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProgramUniformMatrix4x3fv);
+    return table->programUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glProvokingVertexHook(GLenum mode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ProvokingVertex);
+    return table->provokingVertex(mode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPushDebugGroupHook(GLenum source,
+                                               GLuint id,
+                                               GLsizei length,
+                                               const GLchar *message)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PushDebugGroup);
+    return table->pushDebugGroup(source, id, length, message);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glPushGroupMarkerEXTHook(GLsizei length, const GLchar *marker)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::PushGroupMarkerEXT);
+    return table->pushGroupMarkerEXT(length, marker);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glQueryCounterHook(GLuint id, GLenum target)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::QueryCounter);
+    return table->queryCounter(id, target);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glReadBufferHook(GLenum src)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ReadBuffer);
+    return table->readBuffer(src);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glReadPixelsHook(GLint x,
+                                           GLint y,
+                                           GLsizei width,
+                                           GLsizei height,
+                                           GLenum format,
+                                           GLenum type,
+                                           void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ReadPixels);
+    return table->readPixels(x, y, width, height, format, type, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glReadnPixelsHook(GLint x,
+                                            GLint y,
+                                            GLsizei width,
+                                            GLsizei height,
+                                            GLenum format,
+                                            GLenum type,
+                                            GLsizei bufSize,
+                                            void *data)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ReadnPixels);
+    return table->readnPixels(x, y, width, height, format, type, bufSize, data);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glReleaseShaderCompilerHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ReleaseShaderCompiler);
+    return table->releaseShaderCompiler();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glRenderbufferStorageHook(GLenum target,
+                                                    GLenum internalformat,
+                                                    GLsizei width,
+                                                    GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::RenderbufferStorage);
+    return table->renderbufferStorage(target, internalformat, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glRenderbufferStorageMultisampleHook(GLenum target,
+                                                               GLsizei samples,
+                                                               GLenum internalformat,
+                                                               GLsizei width,
+                                                               GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::RenderbufferStorageMultisample);
+    return table->renderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glResumeTransformFeedbackHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ResumeTransformFeedback);
+    return table->resumeTransformFeedback();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSampleCoverageHook(GLfloat value, GLboolean invert)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SampleCoverage);
+    return table->sampleCoverage(value, invert);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSampleMaskiHook(GLuint maskNumber, GLbitfield mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SampleMaski);
+    return table->sampleMaski(maskNumber, mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSamplerParameterIivHook(GLuint sampler,
+                                                    GLenum pname,
+                                                    const GLint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SamplerParameterIiv);
+    return table->samplerParameterIiv(sampler, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSamplerParameterIuivHook(GLuint sampler,
+                                                     GLenum pname,
+                                                     const GLuint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SamplerParameterIuiv);
+    return table->samplerParameterIuiv(sampler, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSamplerParameterfHook(GLuint sampler, GLenum pname, GLfloat param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SamplerParameterf);
+    return table->samplerParameterf(sampler, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSamplerParameterfvHook(GLuint sampler,
+                                                   GLenum pname,
+                                                   const GLfloat *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SamplerParameterfv);
+    return table->samplerParameterfv(sampler, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSamplerParameteriHook(GLuint sampler, GLenum pname, GLint param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SamplerParameteri);
+    return table->samplerParameteri(sampler, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSamplerParameterivHook(GLuint sampler, GLenum pname, const GLint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SamplerParameteriv);
+    return table->samplerParameteriv(sampler, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glScissorHook(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Scissor);
+    return table->scissor(x, y, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glScissorArrayvHook(GLuint first, GLsizei count, const GLint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ScissorArrayv);
+    return table->scissorArrayv(first, count, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glScissorIndexedHook(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ScissorIndexed);
+    return table->scissorIndexed(index, left, bottom, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glScissorIndexedvHook(GLuint index, const GLint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ScissorIndexedv);
+    return table->scissorIndexedv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glSetFenceNVHook(GLuint fence, GLenum condition)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::SetFenceNV);
+    return table->setFenceNV(fence, condition);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glShaderBinaryHook(GLsizei count,
+                                             const GLuint *shaders,
+                                             GLenum binaryformat,
+                                             const void *binary,
+                                             GLsizei length)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ShaderBinary);
+    return table->shaderBinary(count, shaders, binaryformat, binary, length);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glShaderSourceHook(GLuint shader,
+                                             GLsizei count,
+                                             const GLchar *const *string,
+                                             const GLint *length)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ShaderSource);
+    return table->shaderSource(shader, count, string, length);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glShaderStorageBlockBindingHook(GLuint program,
+                                                          GLuint storageBlockIndex,
+                                                          GLuint storageBlockBinding)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ShaderStorageBlockBinding);
+    return table->shaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilFillPathInstancedNVHook(GLsizei numPaths,
+                                                           GLenum pathNameType,
+                                                           const void *paths,
+                                                           GLuint pathBase,
+                                                           GLenum fillMode,
+                                                           GLuint mask,
+                                                           GLenum transformType,
+                                                           const GLfloat *transformValues)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilFillPathInstancedNV);
+    return table->stencilFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, fillMode,
+                                             mask, transformType, transformValues);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilFillPathNVHook(GLuint path, GLenum fillMode, GLuint mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilFillPathNV);
+    return table->stencilFillPathNV(path, fillMode, mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilFuncHook(GLenum func, GLint ref, GLuint mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilFunc);
+    return table->stencilFunc(func, ref, mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilFuncSeparateHook(GLenum face,
+                                                    GLenum func,
+                                                    GLint ref,
+                                                    GLuint mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilFuncSeparate);
+    return table->stencilFuncSeparate(face, func, ref, mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilMaskHook(GLuint mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilMask);
+    return table->stencilMask(mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilMaskSeparateHook(GLenum face, GLuint mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilMaskSeparate);
+    return table->stencilMaskSeparate(face, mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilOpHook(GLenum fail, GLenum zfail, GLenum zpass)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilOp);
+    return table->stencilOp(fail, zfail, zpass);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilOpSeparateHook(GLenum face,
+                                                  GLenum sfail,
+                                                  GLenum dpfail,
+                                                  GLenum dppass)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilOpSeparate);
+    return table->stencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilStrokePathInstancedNVHook(GLsizei numPaths,
+                                                             GLenum pathNameType,
+                                                             const void *paths,
+                                                             GLuint pathBase,
+                                                             GLint reference,
+                                                             GLuint mask,
+                                                             GLenum transformType,
+                                                             const GLfloat *transformValues)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilStrokePathInstancedNV);
+    return table->stencilStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, reference,
+                                               mask, transformType, transformValues);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilStrokePathNVHook(GLuint path, GLint reference, GLuint mask)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilStrokePathNV);
+    return table->stencilStrokePathNV(path, reference, mask);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilThenCoverFillPathInstancedNVHook(GLsizei numPaths,
+                                                                    GLenum pathNameType,
+                                                                    const void *paths,
+                                                                    GLuint pathBase,
+                                                                    GLenum fillMode,
+                                                                    GLuint mask,
+                                                                    GLenum coverMode,
+                                                                    GLenum transformType,
+                                                                    const GLfloat *transformValues)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilThenCoverFillPathInstancedNV);
+    return table->stencilThenCoverFillPathInstancedNV(numPaths, pathNameType, paths, pathBase,
+                                                      fillMode, mask, coverMode, transformType,
+                                                      transformValues);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilThenCoverFillPathNVHook(GLuint path,
+                                                           GLenum fillMode,
+                                                           GLuint mask,
+                                                           GLenum coverMode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilThenCoverFillPathNV);
+    return table->stencilThenCoverFillPathNV(path, fillMode, mask, coverMode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glStencilThenCoverStrokePathInstancedNVHook(GLsizei numPaths,
+                                            GLenum pathNameType,
+                                            const void *paths,
+                                            GLuint pathBase,
+                                            GLint reference,
+                                            GLuint mask,
+                                            GLenum coverMode,
+                                            GLenum transformType,
+                                            const GLfloat *transformValues)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilThenCoverStrokePathInstancedNV);
+    return table->stencilThenCoverStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase,
+                                                        reference, mask, coverMode, transformType,
+                                                        transformValues);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glStencilThenCoverStrokePathNVHook(GLuint path,
+                                                             GLint reference,
+                                                             GLuint mask,
+                                                             GLenum coverMode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::StencilThenCoverStrokePathNV);
+    return table->stencilThenCoverStrokePathNV(path, reference, mask, coverMode);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glTestFenceNVHook(GLuint fence)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TestFenceNV);
+    return table->testFenceNV(fence);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexBufferHook(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexBuffer);
+    return table->texBuffer(target, internalformat, buffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexBufferRangeHook(GLenum target,
+                                               GLenum internalformat,
+                                               GLuint buffer,
+                                               GLintptr offset,
+                                               GLsizeiptr size)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexBufferRange);
+    return table->texBufferRange(target, internalformat, buffer, offset, size);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexImage1DHook(GLenum target,
+                                           GLint level,
+                                           GLint internalformat,
+                                           GLsizei width,
+                                           GLint border,
+                                           GLenum format,
+                                           GLenum type,
+                                           const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexImage1D);
+    return table->texImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexImage2DHook(GLenum target,
+                                           GLint level,
+                                           GLint internalformat,
+                                           GLsizei width,
+                                           GLsizei height,
+                                           GLint border,
+                                           GLenum format,
+                                           GLenum type,
+                                           const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexImage2D);
+    return table->texImage2D(target, level, internalformat, width, height, border, format, type,
+                             pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexImage2DMultisampleHook(GLenum target,
+                                                      GLsizei samples,
+                                                      GLenum internalformat,
+                                                      GLsizei width,
+                                                      GLsizei height,
+                                                      GLboolean fixedsamplelocations)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexImage2DMultisample);
+    return table->texImage2DMultisample(target, samples, internalformat, width, height,
+                                        fixedsamplelocations);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexImage3DHook(GLenum target,
+                                           GLint level,
+                                           GLint internalformat,
+                                           GLsizei width,
+                                           GLsizei height,
+                                           GLsizei depth,
+                                           GLint border,
+                                           GLenum format,
+                                           GLenum type,
+                                           const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexImage3D);
+    return table->texImage3D(target, level, internalformat, width, height, depth, border, format,
+                             type, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexImage3DMultisampleHook(GLenum target,
+                                                      GLsizei samples,
+                                                      GLenum internalformat,
+                                                      GLsizei width,
+                                                      GLsizei height,
+                                                      GLsizei depth,
+                                                      GLboolean fixedsamplelocations)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexImage3DMultisample);
+    return table->texImage3DMultisample(target, samples, internalformat, width, height, depth,
+                                        fixedsamplelocations);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexParameterIivHook(GLenum target, GLenum pname, const GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexParameterIiv);
+    return table->texParameterIiv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexParameterIuivHook(GLenum target, GLenum pname, const GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexParameterIuiv);
+    return table->texParameterIuiv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexParameterfHook(GLenum target, GLenum pname, GLfloat param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexParameterf);
+    return table->texParameterf(target, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexParameterfvHook(GLenum target, GLenum pname, const GLfloat *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexParameterfv);
+    return table->texParameterfv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexParameteriHook(GLenum target, GLenum pname, GLint param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexParameteri);
+    return table->texParameteri(target, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexParameterivHook(GLenum target, GLenum pname, const GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexParameteriv);
+    return table->texParameteriv(target, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexStorage1DHook(GLenum target,
+                                             GLsizei levels,
+                                             GLenum internalformat,
+                                             GLsizei width)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexStorage1D);
+    return table->texStorage1D(target, levels, internalformat, width);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexStorage2DHook(GLenum target,
+                                             GLsizei levels,
+                                             GLenum internalformat,
+                                             GLsizei width,
+                                             GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexStorage2D);
+    return table->texStorage2D(target, levels, internalformat, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexStorage2DMultisampleHook(GLenum target,
+                                                        GLsizei samples,
+                                                        GLenum internalformat,
+                                                        GLsizei width,
+                                                        GLsizei height,
+                                                        GLboolean fixedsamplelocations)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexStorage2DMultisample);
+    return table->texStorage2DMultisample(target, samples, internalformat, width, height,
+                                          fixedsamplelocations);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexStorage3DHook(GLenum target,
+                                             GLsizei levels,
+                                             GLenum internalformat,
+                                             GLsizei width,
+                                             GLsizei height,
+                                             GLsizei depth)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexStorage3D);
+    return table->texStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexStorage3DMultisampleHook(GLenum target,
+                                                        GLsizei samples,
+                                                        GLenum internalformat,
+                                                        GLsizei width,
+                                                        GLsizei height,
+                                                        GLsizei depth,
+                                                        GLboolean fixedsamplelocations)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexStorage3DMultisample);
+    return table->texStorage3DMultisample(target, samples, internalformat, width, height, depth,
+                                          fixedsamplelocations);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexSubImage1DHook(GLenum target,
+                                              GLint level,
+                                              GLint xoffset,
+                                              GLsizei width,
+                                              GLenum format,
+                                              GLenum type,
+                                              const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexSubImage1D);
+    return table->texSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexSubImage2DHook(GLenum target,
+                                              GLint level,
+                                              GLint xoffset,
+                                              GLint yoffset,
+                                              GLsizei width,
+                                              GLsizei height,
+                                              GLenum format,
+                                              GLenum type,
+                                              const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexSubImage2D);
+    return table->texSubImage2D(target, level, xoffset, yoffset, width, height, format, type,
+                                pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTexSubImage3DHook(GLenum target,
+                                              GLint level,
+                                              GLint xoffset,
+                                              GLint yoffset,
+                                              GLint zoffset,
+                                              GLsizei width,
+                                              GLsizei height,
+                                              GLsizei depth,
+                                              GLenum format,
+                                              GLenum type,
+                                              const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TexSubImage3D);
+    return table->texSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth,
+                                format, type, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureBarrierHook()
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureBarrier);
+    return table->textureBarrier();
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureBufferHook(GLuint texture, GLenum internalformat, GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureBuffer);
+    return table->textureBuffer(texture, internalformat, buffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureBufferRangeHook(GLuint texture,
+                                                   GLenum internalformat,
+                                                   GLuint buffer,
+                                                   GLintptr offset,
+                                                   GLsizeiptr size)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureBufferRange);
+    return table->textureBufferRange(texture, internalformat, buffer, offset, size);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureParameterIivHook(GLuint texture,
+                                                    GLenum pname,
+                                                    const GLint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureParameterIiv);
+    return table->textureParameterIiv(texture, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureParameterIuivHook(GLuint texture,
+                                                     GLenum pname,
+                                                     const GLuint *params)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureParameterIuiv);
+    return table->textureParameterIuiv(texture, pname, params);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureParameterfHook(GLuint texture, GLenum pname, GLfloat param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureParameterf);
+    return table->textureParameterf(texture, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureParameterfvHook(GLuint texture,
+                                                   GLenum pname,
+                                                   const GLfloat *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureParameterfv);
+    return table->textureParameterfv(texture, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureParameteriHook(GLuint texture, GLenum pname, GLint param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureParameteri);
+    return table->textureParameteri(texture, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureParameterivHook(GLuint texture, GLenum pname, const GLint *param)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureParameteriv);
+    return table->textureParameteriv(texture, pname, param);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureStorage1DHook(GLuint texture,
+                                                 GLsizei levels,
+                                                 GLenum internalformat,
+                                                 GLsizei width)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureStorage1D);
+    return table->textureStorage1D(texture, levels, internalformat, width);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureStorage2DHook(GLuint texture,
+                                                 GLsizei levels,
+                                                 GLenum internalformat,
+                                                 GLsizei width,
+                                                 GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureStorage2D);
+    return table->textureStorage2D(texture, levels, internalformat, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureStorage2DMultisampleHook(GLuint texture,
+                                                            GLsizei samples,
+                                                            GLenum internalformat,
+                                                            GLsizei width,
+                                                            GLsizei height,
+                                                            GLboolean fixedsamplelocations)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureStorage2DMultisample);
+    return table->textureStorage2DMultisample(texture, samples, internalformat, width, height,
+                                              fixedsamplelocations);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureStorage3DHook(GLuint texture,
+                                                 GLsizei levels,
+                                                 GLenum internalformat,
+                                                 GLsizei width,
+                                                 GLsizei height,
+                                                 GLsizei depth)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureStorage3D);
+    return table->textureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureStorage3DMultisampleHook(GLuint texture,
+                                                            GLsizei samples,
+                                                            GLenum internalformat,
+                                                            GLsizei width,
+                                                            GLsizei height,
+                                                            GLsizei depth,
+                                                            GLboolean fixedsamplelocations)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureStorage3DMultisample);
+    return table->textureStorage3DMultisample(texture, samples, internalformat, width, height,
+                                              depth, fixedsamplelocations);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureSubImage1DHook(GLuint texture,
+                                                  GLint level,
+                                                  GLint xoffset,
+                                                  GLsizei width,
+                                                  GLenum format,
+                                                  GLenum type,
+                                                  const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureSubImage1D);
+    return table->textureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureSubImage2DHook(GLuint texture,
+                                                  GLint level,
+                                                  GLint xoffset,
+                                                  GLint yoffset,
+                                                  GLsizei width,
+                                                  GLsizei height,
+                                                  GLenum format,
+                                                  GLenum type,
+                                                  const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureSubImage2D);
+    return table->textureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type,
+                                    pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureSubImage3DHook(GLuint texture,
+                                                  GLint level,
+                                                  GLint xoffset,
+                                                  GLint yoffset,
+                                                  GLint zoffset,
+                                                  GLsizei width,
+                                                  GLsizei height,
+                                                  GLsizei depth,
+                                                  GLenum format,
+                                                  GLenum type,
+                                                  const void *pixels)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureSubImage3D);
+    return table->textureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth,
+                                    format, type, pixels);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTextureViewHook(GLuint texture,
+                                            GLenum target,
+                                            GLuint origtexture,
+                                            GLenum internalformat,
+                                            GLuint minlevel,
+                                            GLuint numlevels,
+                                            GLuint minlayer,
+                                            GLuint numlayers)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TextureView);
+    return table->textureView(texture, target, origtexture, internalformat, minlevel, numlevels,
+                              minlayer, numlayers);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTransformFeedbackBufferBaseHook(GLuint xfb, GLuint index, GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TransformFeedbackBufferBase);
+    return table->transformFeedbackBufferBase(xfb, index, buffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTransformFeedbackBufferRangeHook(GLuint xfb,
+                                                             GLuint index,
+                                                             GLuint buffer,
+                                                             GLintptr offset,
+                                                             GLsizeiptr size)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TransformFeedbackBufferRange);
+    return table->transformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glTransformFeedbackVaryingsHook(GLuint program,
+                                                          GLsizei count,
+                                                          const GLchar *const *varyings,
+                                                          GLenum bufferMode)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::TransformFeedbackVaryings);
+    return table->transformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform1dHook(GLint location, GLdouble x)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform1d);
+    return table->uniform1d(location, x);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform1dvHook(GLint location, GLsizei count, const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform1dv);
+    return table->uniform1dv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform1fHook(GLint location, GLfloat v0)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform1f);
+    return table->uniform1f(location, v0);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform1fvHook(GLint location, GLsizei count, const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform1fv);
+    return table->uniform1fv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform1iHook(GLint location, GLint v0)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform1i);
+    return table->uniform1i(location, v0);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform1ivHook(GLint location, GLsizei count, const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform1iv);
+    return table->uniform1iv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform1uiHook(GLint location, GLuint v0)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform1ui);
+    return table->uniform1ui(location, v0);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform1uivHook(GLint location, GLsizei count, const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform1uiv);
+    return table->uniform1uiv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform2dHook(GLint location, GLdouble x, GLdouble y)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform2d);
+    return table->uniform2d(location, x, y);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform2dvHook(GLint location, GLsizei count, const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform2dv);
+    return table->uniform2dv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform2fHook(GLint location, GLfloat v0, GLfloat v1)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform2f);
+    return table->uniform2f(location, v0, v1);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform2fvHook(GLint location, GLsizei count, const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform2fv);
+    return table->uniform2fv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform2iHook(GLint location, GLint v0, GLint v1)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform2i);
+    return table->uniform2i(location, v0, v1);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform2ivHook(GLint location, GLsizei count, const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform2iv);
+    return table->uniform2iv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform2uiHook(GLint location, GLuint v0, GLuint v1)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform2ui);
+    return table->uniform2ui(location, v0, v1);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform2uivHook(GLint location, GLsizei count, const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform2uiv);
+    return table->uniform2uiv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform3dHook(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform3d);
+    return table->uniform3d(location, x, y, z);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform3dvHook(GLint location, GLsizei count, const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform3dv);
+    return table->uniform3dv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform3fHook(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform3f);
+    return table->uniform3f(location, v0, v1, v2);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform3fvHook(GLint location, GLsizei count, const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform3fv);
+    return table->uniform3fv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform3iHook(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform3i);
+    return table->uniform3i(location, v0, v1, v2);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform3ivHook(GLint location, GLsizei count, const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform3iv);
+    return table->uniform3iv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform3uiHook(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform3ui);
+    return table->uniform3ui(location, v0, v1, v2);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform3uivHook(GLint location, GLsizei count, const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform3uiv);
+    return table->uniform3uiv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glUniform4dHook(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform4d);
+    return table->uniform4d(location, x, y, z, w);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform4dvHook(GLint location, GLsizei count, const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform4dv);
+    return table->uniform4dv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glUniform4fHook(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform4f);
+    return table->uniform4f(location, v0, v1, v2, v3);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform4fvHook(GLint location, GLsizei count, const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform4fv);
+    return table->uniform4fv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform4iHook(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform4i);
+    return table->uniform4i(location, v0, v1, v2, v3);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform4ivHook(GLint location, GLsizei count, const GLint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform4iv);
+    return table->uniform4iv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glUniform4uiHook(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform4ui);
+    return table->uniform4ui(location, v0, v1, v2, v3);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniform4uivHook(GLint location, GLsizei count, const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Uniform4uiv);
+    return table->uniform4uiv(location, count, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformBlockBindingHook(GLuint program,
+                                                    GLuint uniformBlockIndex,
+                                                    GLuint uniformBlockBinding)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformBlockBinding);
+    return table->uniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix2dvHook(GLint location,
+                                                 GLsizei count,
+                                                 GLboolean transpose,
+                                                 const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix2dv);
+    return table->uniformMatrix2dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix2fvHook(GLint location,
+                                                 GLsizei count,
+                                                 GLboolean transpose,
+                                                 const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix2fv);
+    return table->uniformMatrix2fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix2x3dvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix2x3dv);
+    return table->uniformMatrix2x3dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix2x3fvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix2x3fv);
+    return table->uniformMatrix2x3fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix2x4dvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix2x4dv);
+    return table->uniformMatrix2x4dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix2x4fvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix2x4fv);
+    return table->uniformMatrix2x4fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix3dvHook(GLint location,
+                                                 GLsizei count,
+                                                 GLboolean transpose,
+                                                 const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix3dv);
+    return table->uniformMatrix3dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix3fvHook(GLint location,
+                                                 GLsizei count,
+                                                 GLboolean transpose,
+                                                 const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix3fv);
+    return table->uniformMatrix3fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix3x2dvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix3x2dv);
+    return table->uniformMatrix3x2dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix3x2fvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix3x2fv);
+    return table->uniformMatrix3x2fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix3x4dvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix3x4dv);
+    return table->uniformMatrix3x4dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix3x4fvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix3x4fv);
+    return table->uniformMatrix3x4fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix4dvHook(GLint location,
+                                                 GLsizei count,
+                                                 GLboolean transpose,
+                                                 const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix4dv);
+    return table->uniformMatrix4dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix4fvHook(GLint location,
+                                                 GLsizei count,
+                                                 GLboolean transpose,
+                                                 const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix4fv);
+    return table->uniformMatrix4fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix4x2dvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix4x2dv);
+    return table->uniformMatrix4x2dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix4x2fvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix4x2fv);
+    return table->uniformMatrix4x2fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix4x3dvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLdouble *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix4x3dv);
+    return table->uniformMatrix4x3dv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformMatrix4x3fvHook(GLint location,
+                                                   GLsizei count,
+                                                   GLboolean transpose,
+                                                   const GLfloat *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformMatrix4x3fv);
+    return table->uniformMatrix4x3fv(location, count, transpose, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUniformSubroutinesuivHook(GLenum shadertype,
+                                                      GLsizei count,
+                                                      const GLuint *indices)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UniformSubroutinesuiv);
+    return table->uniformSubroutinesuiv(shadertype, count, indices);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glUnmapBufferHook(GLenum target)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UnmapBuffer);
+    return table->unmapBuffer(target);
+}
+
+template <size_t Slot>
+GLboolean INTERNAL_GL_APIENTRY glUnmapNamedBufferHook(GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UnmapNamedBuffer);
+    return table->unmapNamedBuffer(buffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUseProgramHook(GLuint program)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UseProgram);
+    return table->useProgram(program);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glUseProgramStagesHook(GLuint pipeline, GLbitfield stages, GLuint program)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::UseProgramStages);
+    return table->useProgramStages(pipeline, stages, program);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glValidateProgramHook(GLuint program)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ValidateProgram);
+    return table->validateProgram(program);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glValidateProgramPipelineHook(GLuint pipeline)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ValidateProgramPipeline);
+    return table->validateProgramPipeline(pipeline);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexArrayAttribBindingHook(GLuint vaobj,
+                                                         GLuint attribindex,
+                                                         GLuint bindingindex)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexArrayAttribBinding);
+    return table->vertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexArrayAttribFormatHook(GLuint vaobj,
+                                                        GLuint attribindex,
+                                                        GLint size,
+                                                        GLenum type,
+                                                        GLboolean normalized,
+                                                        GLuint relativeoffset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexArrayAttribFormat);
+    return table->vertexArrayAttribFormat(vaobj, attribindex, size, type, normalized,
+                                          relativeoffset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexArrayAttribIFormatHook(GLuint vaobj,
+                                                         GLuint attribindex,
+                                                         GLint size,
+                                                         GLenum type,
+                                                         GLuint relativeoffset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexArrayAttribIFormat);
+    return table->vertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexArrayAttribLFormatHook(GLuint vaobj,
+                                                         GLuint attribindex,
+                                                         GLint size,
+                                                         GLenum type,
+                                                         GLuint relativeoffset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexArrayAttribLFormat);
+    return table->vertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexArrayBindingDivisorHook(GLuint vaobj,
+                                                          GLuint bindingindex,
+                                                          GLuint divisor)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexArrayBindingDivisor);
+    return table->vertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexArrayElementBufferHook(GLuint vaobj, GLuint buffer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexArrayElementBuffer);
+    return table->vertexArrayElementBuffer(vaobj, buffer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexArrayVertexBufferHook(GLuint vaobj,
+                                                        GLuint bindingindex,
+                                                        GLuint buffer,
+                                                        GLintptr offset,
+                                                        GLsizei stride)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexArrayVertexBuffer);
+    return table->vertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexArrayVertexBuffersHook(GLuint vaobj,
+                                                         GLuint first,
+                                                         GLsizei count,
+                                                         const GLuint *buffers,
+                                                         const GLintptr *offsets,
+                                                         const GLsizei *strides)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexArrayVertexBuffers);
+    return table->vertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib1dHook(GLuint index, GLdouble x)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib1d);
+    return table->vertexAttrib1d(index, x);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib1dvHook(GLuint index, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib1dv);
+    return table->vertexAttrib1dv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib1fHook(GLuint index, GLfloat x)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib1f);
+    return table->vertexAttrib1f(index, x);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib1fvHook(GLuint index, const GLfloat *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib1fv);
+    return table->vertexAttrib1fv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib1sHook(GLuint index, GLshort x)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib1s);
+    return table->vertexAttrib1s(index, x);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib1svHook(GLuint index, const GLshort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib1sv);
+    return table->vertexAttrib1sv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib2dHook(GLuint index, GLdouble x, GLdouble y)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib2d);
+    return table->vertexAttrib2d(index, x, y);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib2dvHook(GLuint index, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib2dv);
+    return table->vertexAttrib2dv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib2fHook(GLuint index, GLfloat x, GLfloat y)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib2f);
+    return table->vertexAttrib2f(index, x, y);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib2fvHook(GLuint index, const GLfloat *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib2fv);
+    return table->vertexAttrib2fv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib2sHook(GLuint index, GLshort x, GLshort y)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib2s);
+    return table->vertexAttrib2s(index, x, y);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib2svHook(GLuint index, const GLshort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib2sv);
+    return table->vertexAttrib2sv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib3dHook(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib3d);
+    return table->vertexAttrib3d(index, x, y, z);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib3dvHook(GLuint index, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib3dv);
+    return table->vertexAttrib3dv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib3fHook(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib3f);
+    return table->vertexAttrib3f(index, x, y, z);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib3fvHook(GLuint index, const GLfloat *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib3fv);
+    return table->vertexAttrib3fv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib3sHook(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib3s);
+    return table->vertexAttrib3s(index, x, y, z);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib3svHook(GLuint index, const GLshort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib3sv);
+    return table->vertexAttrib3sv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4NbvHook(GLuint index, const GLbyte *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4Nbv);
+    return table->vertexAttrib4Nbv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4NivHook(GLuint index, const GLint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4Niv);
+    return table->vertexAttrib4Niv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4NsvHook(GLuint index, const GLshort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4Nsv);
+    return table->vertexAttrib4Nsv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glVertexAttrib4NubHook(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4Nub);
+    return table->vertexAttrib4Nub(index, x, y, z, w);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4NubvHook(GLuint index, const GLubyte *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4Nubv);
+    return table->vertexAttrib4Nubv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4NuivHook(GLuint index, const GLuint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4Nuiv);
+    return table->vertexAttrib4Nuiv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4NusvHook(GLuint index, const GLushort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4Nusv);
+    return table->vertexAttrib4Nusv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4bvHook(GLuint index, const GLbyte *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4bv);
+    return table->vertexAttrib4bv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glVertexAttrib4dHook(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4d);
+    return table->vertexAttrib4d(index, x, y, z, w);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4dvHook(GLuint index, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4dv);
+    return table->vertexAttrib4dv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glVertexAttrib4fHook(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4f);
+    return table->vertexAttrib4f(index, x, y, z, w);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4fvHook(GLuint index, const GLfloat *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4fv);
+    return table->vertexAttrib4fv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4ivHook(GLuint index, const GLint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4iv);
+    return table->vertexAttrib4iv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glVertexAttrib4sHook(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4s);
+    return table->vertexAttrib4s(index, x, y, z, w);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4svHook(GLuint index, const GLshort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4sv);
+    return table->vertexAttrib4sv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4ubvHook(GLuint index, const GLubyte *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4ubv);
+    return table->vertexAttrib4ubv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4uivHook(GLuint index, const GLuint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4uiv);
+    return table->vertexAttrib4uiv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttrib4usvHook(GLuint index, const GLushort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttrib4usv);
+    return table->vertexAttrib4usv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribBindingHook(GLuint attribindex, GLuint bindingindex)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribBinding);
+    return table->vertexAttribBinding(attribindex, bindingindex);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribDivisorHook(GLuint index, GLuint divisor)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribDivisor);
+    return table->vertexAttribDivisor(index, divisor);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribFormatHook(GLuint attribindex,
+                                                   GLint size,
+                                                   GLenum type,
+                                                   GLboolean normalized,
+                                                   GLuint relativeoffset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribFormat);
+    return table->vertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI1iHook(GLuint index, GLint x)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI1i);
+    return table->vertexAttribI1i(index, x);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI1ivHook(GLuint index, const GLint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI1iv);
+    return table->vertexAttribI1iv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI1uiHook(GLuint index, GLuint x)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI1ui);
+    return table->vertexAttribI1ui(index, x);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI1uivHook(GLuint index, const GLuint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI1uiv);
+    return table->vertexAttribI1uiv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI2iHook(GLuint index, GLint x, GLint y)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI2i);
+    return table->vertexAttribI2i(index, x, y);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI2ivHook(GLuint index, const GLint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI2iv);
+    return table->vertexAttribI2iv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI2uiHook(GLuint index, GLuint x, GLuint y)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI2ui);
+    return table->vertexAttribI2ui(index, x, y);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI2uivHook(GLuint index, const GLuint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI2uiv);
+    return table->vertexAttribI2uiv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI3iHook(GLuint index, GLint x, GLint y, GLint z)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI3i);
+    return table->vertexAttribI3i(index, x, y, z);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI3ivHook(GLuint index, const GLint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI3iv);
+    return table->vertexAttribI3iv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI3uiHook(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI3ui);
+    return table->vertexAttribI3ui(index, x, y, z);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI3uivHook(GLuint index, const GLuint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI3uiv);
+    return table->vertexAttribI3uiv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI4bvHook(GLuint index, const GLbyte *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI4bv);
+    return table->vertexAttribI4bv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI4iHook(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI4i);
+    return table->vertexAttribI4i(index, x, y, z, w);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI4ivHook(GLuint index, const GLint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI4iv);
+    return table->vertexAttribI4iv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI4svHook(GLuint index, const GLshort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI4sv);
+    return table->vertexAttribI4sv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI4ubvHook(GLuint index, const GLubyte *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI4ubv);
+    return table->vertexAttribI4ubv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glVertexAttribI4uiHook(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI4ui);
+    return table->vertexAttribI4ui(index, x, y, z, w);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI4uivHook(GLuint index, const GLuint *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI4uiv);
+    return table->vertexAttribI4uiv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribI4usvHook(GLuint index, const GLushort *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribI4usv);
+    return table->vertexAttribI4usv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribIFormatHook(GLuint attribindex,
+                                                    GLint size,
+                                                    GLenum type,
+                                                    GLuint relativeoffset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribIFormat);
+    return table->vertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribIPointerHook(GLuint index,
+                                                     GLint size,
+                                                     GLenum type,
+                                                     GLsizei stride,
+                                                     const void *pointer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribIPointer);
+    return table->vertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribL1dHook(GLuint index, GLdouble x)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribL1d);
+    return table->vertexAttribL1d(index, x);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribL1dvHook(GLuint index, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribL1dv);
+    return table->vertexAttribL1dv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribL2dHook(GLuint index, GLdouble x, GLdouble y)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribL2d);
+    return table->vertexAttribL2d(index, x, y);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribL2dvHook(GLuint index, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribL2dv);
+    return table->vertexAttribL2dv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribL3dHook(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribL3d);
+    return table->vertexAttribL3d(index, x, y, z);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribL3dvHook(GLuint index, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribL3dv);
+    return table->vertexAttribL3dv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glVertexAttribL4dHook(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribL4d);
+    return table->vertexAttribL4d(index, x, y, z, w);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribL4dvHook(GLuint index, const GLdouble *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribL4dv);
+    return table->vertexAttribL4dv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribLFormatHook(GLuint attribindex,
+                                                    GLint size,
+                                                    GLenum type,
+                                                    GLuint relativeoffset)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribLFormat);
+    return table->vertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribLPointerHook(GLuint index,
+                                                     GLint size,
+                                                     GLenum type,
+                                                     GLsizei stride,
+                                                     const void *pointer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribLPointer);
+    return table->vertexAttribLPointer(index, size, type, stride, pointer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribP1uiHook(GLuint index,
+                                                 GLenum type,
+                                                 GLboolean normalized,
+                                                 GLuint value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribP1ui);
+    return table->vertexAttribP1ui(index, type, normalized, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribP1uivHook(GLuint index,
+                                                  GLenum type,
+                                                  GLboolean normalized,
+                                                  const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribP1uiv);
+    return table->vertexAttribP1uiv(index, type, normalized, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribP2uiHook(GLuint index,
+                                                 GLenum type,
+                                                 GLboolean normalized,
+                                                 GLuint value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribP2ui);
+    return table->vertexAttribP2ui(index, type, normalized, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribP2uivHook(GLuint index,
+                                                  GLenum type,
+                                                  GLboolean normalized,
+                                                  const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribP2uiv);
+    return table->vertexAttribP2uiv(index, type, normalized, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribP3uiHook(GLuint index,
+                                                 GLenum type,
+                                                 GLboolean normalized,
+                                                 GLuint value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribP3ui);
+    return table->vertexAttribP3ui(index, type, normalized, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribP3uivHook(GLuint index,
+                                                  GLenum type,
+                                                  GLboolean normalized,
+                                                  const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribP3uiv);
+    return table->vertexAttribP3uiv(index, type, normalized, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribP4uiHook(GLuint index,
+                                                 GLenum type,
+                                                 GLboolean normalized,
+                                                 GLuint value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribP4ui);
+    return table->vertexAttribP4ui(index, type, normalized, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribP4uivHook(GLuint index,
+                                                  GLenum type,
+                                                  GLboolean normalized,
+                                                  const GLuint *value)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribP4uiv);
+    return table->vertexAttribP4uiv(index, type, normalized, value);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexAttribPointerHook(GLuint index,
+                                                    GLint size,
+                                                    GLenum type,
+                                                    GLboolean normalized,
+                                                    GLsizei stride,
+                                                    const void *pointer)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexAttribPointer);
+    return table->vertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glVertexBindingDivisorHook(GLuint bindingindex, GLuint divisor)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::VertexBindingDivisor);
+    return table->vertexBindingDivisor(bindingindex, divisor);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glViewportHook(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::Viewport);
+    return table->viewport(x, y, width, height);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glViewportArrayvHook(GLuint first, GLsizei count, const GLfloat *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ViewportArrayv);
+    return table->viewportArrayv(first, count, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY
+glViewportIndexedfHook(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ViewportIndexedf);
+    return table->viewportIndexedf(index, x, y, w, h);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glViewportIndexedfvHook(GLuint index, const GLfloat *v)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::ViewportIndexedfv);
+    return table->viewportIndexedfv(index, v);
+}
+
+template <size_t Slot>
+void INTERNAL_GL_APIENTRY glWaitSyncHook(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);
+    ScopedCallCounter counter(table, EntryPointGL::WaitSync);
+    return table->waitSync(sync, flags, timeout);
+}
+
+template <size_t Slot>
+void InstallHooks(DispatchTableGL *table, CallCounterTableGL *originals)
+{
+    if (table->activeShaderProgram)
+    {
+        originals->activeShaderProgram = table->activeShaderProgram;
+        table->activeShaderProgram     = &glActiveShaderProgramHook<Slot>;
+    }
+
+    if (table->activeTexture)
+    {
+        originals->activeTexture = table->activeTexture;
+        table->activeTexture     = &glActiveTextureHook<Slot>;
+    }
+
+    if (table->attachShader)
+    {
+        originals->attachShader = table->attachShader;
+        table->attachShader     = &glAttachShaderHook<Slot>;
+    }
+
+    if (table->beginConditionalRender)
+    {
+        originals->beginConditionalRender = table->beginConditionalRender;
+        table->beginConditionalRender     = &glBeginConditionalRenderHook<Slot>;
+    }
+
+    if (table->beginQuery)
+    {
+        originals->beginQuery = table->beginQuery;
+        table->beginQuery     = &glBeginQueryHook<Slot>;
+    }
+
+    if (table->beginQueryIndexed)
+    {
+        originals->beginQueryIndexed = table->beginQueryIndexed;
+        table->beginQueryIndexed     = &glBeginQueryIndexedHook<Slot>;
+    }
+
+    if (table->beginTransformFeedback)
+    {
+        originals->beginTransformFeedback = table->beginTransformFeedback;
+        table->beginTransformFeedback     = &glBeginTransformFeedbackHook<Slot>;
+    }
+
+    if (table->bindAttribLocation)
+    {
+        originals->bindAttribLocation = table->bindAttribLocation;
+        table->bindAttribLocation     = &glBindAttribLocationHook<Slot>;
+    }
+
+    if (table->bindBuffer)
+    {
+        originals->bindBuffer = table->bindBuffer;
+        table->bindBuffer     = &glBindBufferHook<Slot>;
+    }
+
+    if (table->bindBufferBase)
+    {
+        originals->bindBufferBase = table->bindBufferBase;
+        table->bindBufferBase     = &glBindBufferBaseHook<Slot>;
+    }
+
+    if (table->bindBufferRange)
+    {
+        originals->bindBufferRange = table->bindBufferRange;
+        table->bindBufferRange     = &glBindBufferRangeHook<Slot>;
+    }
+
+    if (table->bindBuffersBase)
+    {
+        originals->bindBuffersBase = table->bindBuffersBase;
+        table->bindBuffersBase     = &glBindBuffersBaseHook<Slot>;
+    }
+
+    if (table->bindBuffersRange)
+    {
+        originals->bindBuffersRange = table->bindBuffersRange;
+        table->bindBuffersRange     = &glBindBuffersRangeHook<Slot>;
+    }
+
+    if (table->bindFragDataLocation)
+    {
+        originals->bindFragDataLocation = table->bindFragDataLocation;
+        table->bindFragDataLocation     = &glBindFragDataLocationHook<Slot>;
+    }
+
+    if (table->bindFragDataLocationIndexed)
+    {
+        originals->bindFragDataLocationIndexed = table->bindFragDataLocationIndexed;
+        table->bindFragDataLocationIndexed     = &glBindFragDataLocationIndexedHook<Slot>;
+    }
+
+    if (table->bindFramebuffer)
+    {
+        originals->bindFramebuffer = table->bindFramebuffer;
+        table->bindFramebuffer     = &glBindFramebufferHook<Slot>;
+    }
+
+    if (table->bindImageTexture)
+    {
+        originals->bindImageTexture = table->bindImageTexture;
+        table->bindImageTexture     = &glBindImageTextureHook<Slot>;
+    }
+
+    if (table->bindImageTextures)
+    {
+        originals->bindImageTextures = table->bindImageTextures;
+        table->bindImageTextures     = &glBindImageTexturesHook<Slot>;
+    }
+
+    if (table->bindProgramPipeline)
+    {
+        originals->bindProgramPipeline = table->bindProgramPipeline;
+        table->bindProgramPipeline     = &glBindProgramPipelineHook<Slot>;
+    }
+
+    if (table->bindRenderbuffer)
+    {
+        originals->bindRenderbuffer = table->bindRenderbuffer;
+        table->bindRenderbuffer     = &glBindRenderbufferHook<Slot>;
+    }
+
+    if (table->bindSampler)
+    {
+        originals->bindSampler = table->bindSampler;
+        table->bindSampler     = &glBindSamplerHook<Slot>;
+    }
+
+    if (table->bindSamplers)
+    {
+        originals->bindSamplers = table->bindSamplers;
+        table->bindSamplers     = &glBindSamplersHook<Slot>;
+    }
+
+    if (table->bindTexture)
+    {
+        originals->bindTexture = table->bindTexture;
+        table->bindTexture     = &glBindTextureHook<Slot>;
+    }
+
+    if (table->bindTextureUnit)
+    {
+        originals->bindTextureUnit = table->bindTextureUnit;
+        table->bindTextureUnit     = &glBindTextureUnitHook<Slot>;
+    }
+
+    if (table->bindTextures)
+    {
+        originals->bindTextures = table->bindTextures;
+        table->bindTextures     = &glBindTexturesHook<Slot>;
+    }
+
+    if (table->bindTransformFeedback)
+    {
+        originals->bindTransformFeedback = table->bindTransformFeedback;
+        table->bindTransformFeedback     = &glBindTransformFeedbackHook<Slot>;
+    }
+
+    if (table->bindVertexArray)
+    {
+        originals->bindVertexArray = table->bindVertexArray;
+        table->bindVertexArray     = &glBindVertexArrayHook<Slot>;
+    }
+
+    if (table->bindVertexBuffer)
+    {
+        originals->bindVertexBuffer = table->bindVertexBuffer;
+        table->bindVertexBuffer     = &glBindVertexBufferHook<Slot>;
+    }
+
+    if (table->bindVertexBuffers)
+    {
+        originals->bindVertexBuffers = table->bindVertexBuffers;
+        table->bindVertexBuffers     = &glBindVertexBuffersHook<Slot>;
+    }
+
+    if (table->blendBarrier)
+    {
+        originals->blendBarrier = table->blendBarrier;
+        table->blendBarrier     = &glBlendBarrierHook<Slot>;
+    }
+
+    if (table->blendColor)
+    {
+        originals->blendColor = table->blendColor;
+        table->blendColor     = &glBlendColorHook<Slot>;
+    }
+
+    if (table->blendEquation)
+    {
+        originals->blendEquation = table->blendEquation;
+        table->blendEquation     = &glBlendEquationHook<Slot>;
+    }
+
+    if (table->blendEquationSeparate)
+    {
+        originals->blendEquationSeparate = table->blendEquationSeparate;
+        table->blendEquationSeparate     = &glBlendEquationSeparateHook<Slot>;
+    }
+
+    if (table->blendEquationSeparatei)
+    {
+        originals->blendEquationSeparatei = table->blendEquationSeparatei;
+        table->blendEquationSeparatei     = &glBlendEquationSeparateiHook<Slot>;
+    }
+
+    if (table->blendEquationi)
+    {
+        originals->blendEquationi = table->blendEquationi;
+        table->blendEquationi     = &glBlendEquationiHook<Slot>;
+    }
+
+    if (table->blendFunc)
+    {
+        originals->blendFunc = table->blendFunc;
+        table->blendFunc     = &glBlendFuncHook<Slot>;
+    }
+
+    if (table->blendFuncSeparate)
+    {
+        originals->blendFuncSeparate = table->blendFuncSeparate;
+        table->blendFuncSeparate     = &glBlendFuncSeparateHook<Slot>;
+    }
+
+    if (table->blendFuncSeparatei)
+    {
+        originals->blendFuncSeparatei = table->blendFuncSeparatei;
+        table->blendFuncSeparatei     = &glBlendFuncSeparateiHook<Slot>;
+    }
+
+    if (table->blendFunci)
+    {
+        originals->blendFunci = table->blendFunci;
+        table->blendFunci     = &glBlendFunciHook<Slot>;
+    }
+
+    if (table->blitFramebuffer)
+    {
+        originals->blitFramebuffer = table->blitFramebuffer;
+        table->blitFramebuffer     = &glBlitFramebufferHook<Slot>;
+    }
+
+    if (table->blitNamedFramebuffer)
+    {
+        originals->blitNamedFramebuffer = table->blitNamedFramebuffer;
+        table->blitNamedFramebuffer     = &glBlitNamedFramebufferHook<Slot>;
+    }
+
+    if (table->bufferData)
+    {
+        originals->bufferData = table->bufferData;
+        table->bufferData     = &glBufferDataHook<Slot>;
+    }
+
+    if (table->bufferStorage)
+    {
+        originals->bufferStorage = table->bufferStorage;
+        table->bufferStorage     = &glBufferStorageHook<Slot>;
+    }
+
+    if (table->bufferSubData)
+    {
+        originals->bufferSubData = table->bufferSubData;
+        table->bufferSubData     = &glBufferSubDataHook<Slot>;
+    }
+
+    if (table->checkFramebufferStatus)
+    {
+        originals->checkFramebufferStatus = table->checkFramebufferStatus;
+        table->checkFramebufferStatus     = &glCheckFramebufferStatusHook<Slot>;
+    }
+
+    if (table->checkNamedFramebufferStatus)
+    {
+        originals->checkNamedFramebufferStatus = table->checkNamedFramebufferStatus;
+        table->checkNamedFramebufferStatus     = &glCheckNamedFramebufferStatusHook<Slot>;
+    }
+
+    if (table->clampColor)
+    {
+        originals->clampColor = table->clampColor;
+        table->clampColor     = &glClampColorHook<Slot>;
+    }
+
+    if (table->clear)
+    {
+        originals->clear = table->clear;
+        table->clear     = &glClearHook<Slot>;
+    }
+
+    if (table->clearBufferData)
+    {
+        originals->clearBufferData = table->clearBufferData;
+        table->clearBufferData     = &glClearBufferDataHook<Slot>;
+    }
+
+    if (table->clearBufferSubData)
+    {
+        originals->clearBufferSubData = table->clearBufferSubData;
+        table->clearBufferSubData     = &glClearBufferSubDataHook<Slot>;
+    }
+
+    if (table->clearBufferfi)
+    {
+        originals->clearBufferfi = table->clearBufferfi;
+        table->clearBufferfi     = &glClearBufferfiHook<Slot>;
+    }
+
+    if (table->clearBufferfv)
+    {
+        originals->clearBufferfv = table->clearBufferfv;
+        table->clearBufferfv     = &glClearBufferfvHook<Slot>;
+    }
+
+    if (table->clearBufferiv)
+    {
+        originals->clearBufferiv = table->clearBufferiv;
+        table->clearBufferiv     = &glClearBufferivHook<Slot>;
+    }
+
+    if (table->clearBufferuiv)
+    {
+        originals->clearBufferuiv = table->clearBufferuiv;
+        table->clearBufferuiv     = &glClearBufferuivHook<Slot>;
+    }
+
+    if (table->clearColor)
+    {
+        originals->clearColor = table->clearColor;
+        table->clearColor     = &glClearColorHook<Slot>;
+    }
+
+    if (table->clearDepth)
+    {
+        originals->clearDepth = table->clearDepth;
+        table->clearDepth     = &glClearDepthHook<Slot>;
+    }
+
+    if (table->clearDepthf)
+    {
+        originals->clearDepthf = table->clearDepthf;
+        table->clearDepthf     = &glClearDepthfHook<Slot>;
+    }
+
+    if (table->clearNamedBufferData)
+    {
+        originals->clearNamedBufferData = table->clearNamedBufferData;
+        table->clearNamedBufferData     = &glClearNamedBufferDataHook<Slot>;
+    }
+
+    if (table->clearNamedBufferSubData)
+    {
+        originals->clearNamedBufferSubData = table->clearNamedBufferSubData;
+        table->clearNamedBufferSubData     = &glClearNamedBufferSubDataHook<Slot>;
+    }
+
+    if (table->clearNamedFramebufferfi)
+    {
+        originals->clearNamedFramebufferfi = table->clearNamedFramebufferfi;
+        table->clearNamedFramebufferfi     = &glClearNamedFramebufferfiHook<Slot>;
+    }
+
+    if (table->clearNamedFramebufferfv)
+    {
+        originals->clearNamedFramebufferfv = table->clearNamedFramebufferfv;
+        table->clearNamedFramebufferfv     = &glClearNamedFramebufferfvHook<Slot>;
+    }
+
+    if (table->clearNamedFramebufferiv)
+    {
+        originals->clearNamedFramebufferiv = table->clearNamedFramebufferiv;
+        table->clearNamedFramebufferiv     = &glClearNamedFramebufferivHook<Slot>;
+    }
+
+    if (table->clearNamedFramebufferuiv)
+    {
+        originals->clearNamedFramebufferuiv = table->clearNamedFramebufferuiv;
+        table->clearNamedFramebufferuiv     = &glClearNamedFramebufferuivHook<Slot>;
+    }
+
+    if (table->clearStencil)
+    {
+        originals->clearStencil = table->clearStencil;
+        table->clearStencil     = &glClearStencilHook<Slot>;
+    }
+
+    if (table->clearTexImage)
+    {
+        originals->clearTexImage = table->clearTexImage;
+        table->clearTexImage     = &glClearTexImageHook<Slot>;
+    }
+
+    if (table->clearTexSubImage)
+    {
+        originals->clearTexSubImage = table->clearTexSubImage;
+        table->clearTexSubImage     = &glClearTexSubImageHook<Slot>;
+    }
+
+    if (table->clientWaitSync)
+    {
+        originals->clientWaitSync = table->clientWaitSync;
+        table->clientWaitSync     = &glClientWaitSyncHook<Slot>;
+    }
+
+    if (table->clipControl)
+    {
+        originals->clipControl = table->clipControl;
+        table->clipControl     = &glClipControlHook<Slot>;
+    }
+
+    if (table->colorMask)
+    {
+        originals->colorMask = table->colorMask;
+        table->colorMask     = &glColorMaskHook<Slot>;
+    }
+
+    if (table->colorMaski)
+    {
+        originals->colorMaski = table->colorMaski;
+        table->colorMaski     = &glColorMaskiHook<Slot>;
+    }
+
+    if (table->compileShader)
+    {
+        originals->compileShader = table->compileShader;
+        table->compileShader     = &glCompileShaderHook<Slot>;
+    }
+
+    if (table->compressedTexImage1D)
+    {
+        originals->compressedTexImage1D = table->compressedTexImage1D;
+        table->compressedTexImage1D     = &glCompressedTexImage1DHook<Slot>;
+    }
+
+    if (table->compressedTexImage2D)
+    {
+        originals->compressedTexImage2D = table->compressedTexImage2D;
+        table->compressedTexImage2D     = &glCompressedTexImage2DHook<Slot>;
+    }
+
+    if (table->compressedTexImage3D)
+    {
+        originals->compressedTexImage3D = table->compressedTexImage3D;
+        table->compressedTexImage3D     = &glCompressedTexImage3DHook<Slot>;
+    }
+
+    if (table->compressedTexSubImage1D)
+    {
+        originals->compressedTexSubImage1D = table->compressedTexSubImage1D;
+        table->compressedTexSubImage1D     = &glCompressedTexSubImage1DHook<Slot>;
+    }
+
+    if (table->compressedTexSubImage2D)
+    {
+        originals->compressedTexSubImage2D = table->compressedTexSubImage2D;
+        table->compressedTexSubImage2D     = &glCompressedTexSubImage2DHook<Slot>;
+    }
+
+    if (table->compressedTexSubImage3D)
+    {
+        originals->compressedTexSubImage3D = table->compressedTexSubImage3D;
+        table->compressedTexSubImage3D     = &glCompressedTexSubImage3DHook<Slot>;
+    }
+
+    if (table->compressedTextureSubImage1D)
+    {
+        originals->compressedTextureSubImage1D = table->compressedTextureSubImage1D;
+        table->compressedTextureSubImage1D     = &glCompressedTextureSubImage1DHook<Slot>;
+    }
+
+    if (table->compressedTextureSubImage2D)
+    {
+        originals->compressedTextureSubImage2D = table->compressedTextureSubImage2D;
+        table->compressedTextureSubImage2D     = &glCompressedTextureSubImage2DHook<Slot>;
+    }
+
+    if (table->compressedTextureSubImage3D)
+    {
+        originals->compressedTextureSubImage3D = table->compressedTextureSubImage3D;
+        table->compressedTextureSubImage3D     = &glCompressedTextureSubImage3DHook<Slot>;
+    }
+
+    if (table->copyBufferSubData)
+    {
+        originals->copyBufferSubData = table->copyBufferSubData;
+        table->copyBufferSubData     = &glCopyBufferSubDataHook<Slot>;
+    }
+
+    if (table->copyImageSubData)
+    {
+        originals->copyImageSubData = table->copyImageSubData;
+        table->copyImageSubData     = &glCopyImageSubDataHook<Slot>;
+    }
+
+    if (table->copyNamedBufferSubData)
+    {
+        originals->copyNamedBufferSubData = table->copyNamedBufferSubData;
+        table->copyNamedBufferSubData     = &glCopyNamedBufferSubDataHook<Slot>;
+    }
+
+    if (table->copyTexImage1D)
+    {
+        originals->copyTexImage1D = table->copyTexImage1D;
+        table->copyTexImage1D     = &glCopyTexImage1DHook<Slot>;
+    }
+
+    if (table->copyTexImage2D)
+    {
+        originals->copyTexImage2D = table->copyTexImage2D;
+        table->copyTexImage2D     = &glCopyTexImage2DHook<Slot>;
+    }
+
+    if (table->copyTexSubImage1D)
+    {
+        originals->copyTexSubImage1D = table->copyTexSubImage1D;
+        table->copyTexSubImage1D     = &glCopyTexSubImage1DHook<Slot>;
+    }
+
+    if (table->copyTexSubImage2D)
+    {
+        originals->copyTexSubImage2D = table->copyTexSubImage2D;
+        table->copyTexSubImage2D     = &glCopyTexSubImage2DHook<Slot>;
+    }
+
+    if (table->copyTexSubImage3D)
+    {
+        originals->copyTexSubImage3D = table->copyTexSubImage3D;
+        table->copyTexSubImage3D     = &glCopyTexSubImage3DHook<Slot>;
+    }
+
+    if (table->copyTextureSubImage1D)
+    {
+        originals->copyTextureSubImage1D = table->copyTextureSubImage1D;
+        table->copyTextureSubImage1D     = &glCopyTextureSubImage1DHook<Slot>;
+    }
+
+    if (table->copyTextureSubImage2D)
+    {
+        originals->copyTextureSubImage2D = table->copyTextureSubImage2D;
+        table->copyTextureSubImage2D     = &glCopyTextureSubImage2DHook<Slot>;
+    }
+
+    if (table->copyTextureSubImage3D)
+    {
+        originals->copyTextureSubImage3D = table->copyTextureSubImage3D;
+        table->copyTextureSubImage3D     = &glCopyTextureSubImage3DHook<Slot>;
+    }
+
+    if (table->coverFillPathInstancedNV)
+    {
+        originals->coverFillPathInstancedNV = table->coverFillPathInstancedNV;
+        table->coverFillPathInstancedNV     = &glCoverFillPathInstancedNVHook<Slot>;
+    }
+
+    if (table->coverFillPathNV)
+    {
+        originals->coverFillPathNV = table->coverFillPathNV;
+        table->coverFillPathNV     = &glCoverFillPathNVHook<Slot>;
+    }
+
+    if (table->coverStrokePathInstancedNV)
+    {
+        originals->coverStrokePathInstancedNV = table->coverStrokePathInstancedNV;
+        table->coverStrokePathInstancedNV     = &glCoverStrokePathInstancedNVHook<Slot>;
+    }
+
+    if (table->coverStrokePathNV)
+    {
+        originals->coverStrokePathNV = table->coverStrokePathNV;
+        table->coverStrokePathNV     = &glCoverStrokePathNVHook<Slot>;
+    }
+
+    if (table->coverageModulationNV)
+    {
+        originals->coverageModulationNV = table->coverageModulationNV;
+        table->coverageModulationNV     = &glCoverageModulationNVHook<Slot>;
+    }
+
+    if (table->createBuffers)
+    {
+        originals->createBuffers = table->createBuffers;
+        table->createBuffers     = &glCreateBuffersHook<Slot>;
+    }
+
+    if (table->createFramebuffers)
+    {
+        originals->createFramebuffers = table->createFramebuffers;
+        table->createFramebuffers     = &glCreateFramebuffersHook<Slot>;
+    }
+
+    if (table->createProgram)
+    {
+        originals->createProgram = table->createProgram;
+        table->createProgram     = &glCreateProgramHook<Slot>;
+    }
+
+    if (table->createProgramPipelines)
+    {
+        originals->createProgramPipelines = table->createProgramPipelines;
+        table->createProgramPipelines     = &glCreateProgramPipelinesHook<Slot>;
+    }
+
+    if (table->createQueries)
+    {
+        originals->createQueries = table->createQueries;
+        table->createQueries     = &glCreateQueriesHook<Slot>;
+    }
+
+    if (table->createRenderbuffers)
+    {
+        originals->createRenderbuffers = table->createRenderbuffers;
+        table->createRenderbuffers     = &glCreateRenderbuffersHook<Slot>;
+    }
+
+    if (table->createSamplers)
+    {
+        originals->createSamplers = table->createSamplers;
+        table->createSamplers     = &glCreateSamplersHook<Slot>;
+    }
+
+    if (table->createShader)
+    {
+        originals->createShader = table->createShader;
+        table->createShader     = &glCreateShaderHook<Slot>;
+    }
+
+    if (table->createShaderProgramv)
+    {
+        originals->createShaderProgramv = table->createShaderProgramv;
+        table->createShaderProgramv     = &glCreateShaderProgramvHook<Slot>;
+    }
+
+    if (table->createTextures)
+    {
+        originals->createTextures = table->createTextures;
+        table->createTextures     = &glCreateTexturesHook<Slot>;
+    }
+
+    if (table->createTransformFeedbacks)
+    {
+        originals->createTransformFeedbacks = table->createTransformFeedbacks;
+        table->createTransformFeedbacks     = &glCreateTransformFeedbacksHook<Slot>;
+    }
+
+    if (table->createVertexArrays)
+    {
+        originals->createVertexArrays = table->createVertexArrays;
+        table->createVertexArrays     = &glCreateVertexArraysHook<Slot>;
+    }
+
+    if (table->cullFace)
+    {
+        originals->cullFace = table->cullFace;
+        table->cullFace     = &glCullFaceHook<Slot>;
+    }
+
+    if (table->debugMessageCallback)
+    {
+        originals->debugMessageCallback = table->debugMessageCallback;
+        table->debugMessageCallback     = &glDebugMessageCallbackHook<Slot>;
+    }
+
+    if (table->debugMessageControl)
+    {
+        originals->debugMessageControl = table->debugMessageControl;
+        table->debugMessageControl     = &glDebugMessageControlHook<Slot>;
+    }
+
+    if (table->debugMessageInsert)
+    {
+        originals->debugMessageInsert = table->debugMessageInsert;
+        table->debugMessageInsert     = &glDebugMessageInsertHook<Slot>;
+    }
+
+    if (table->deleteBuffers)
+    {
+        originals->deleteBuffers = table->deleteBuffers;
+        table->deleteBuffers     = &glDeleteBuffersHook<Slot>;
+    }
+
+    if (table->deleteFencesNV)
+    {
+        originals->deleteFencesNV = table->deleteFencesNV;
+        table->deleteFencesNV     = &glDeleteFencesNVHook<Slot>;
+    }
+
+    if (table->deleteFramebuffers)
+    {
+        originals->deleteFramebuffers = table->deleteFramebuffers;
+        table->deleteFramebuffers     = &glDeleteFramebuffersHook<Slot>;
+    }
+
+    if (table->deletePathsNV)
+    {
+        originals->deletePathsNV = table->deletePathsNV;
+        table->deletePathsNV     = &glDeletePathsNVHook<Slot>;
+    }
+
+    if (table->deleteProgram)
+    {
+        originals->deleteProgram = table->deleteProgram;
+        table->deleteProgram     = &glDeleteProgramHook<Slot>;
+    }
+
+    if (table->deleteProgramPipelines)
+    {
+        originals->deleteProgramPipelines = table->deleteProgramPipelines;
+        table->deleteProgramPipelines     = &glDeleteProgramPipelinesHook<Slot>;
+    }
+
+    if (table->deleteQueries)
+    {
+        originals->deleteQueries = table->deleteQueries;
+        table->deleteQueries     = &glDeleteQueriesHook<Slot>;
+    }
+
+    if (table->deleteRenderbuffers)
+    {
+        originals->deleteRenderbuffers = table->deleteRenderbuffers;
+        table->deleteRenderbuffers     = &glDeleteRenderbuffersHook<Slot>;
+    }
+
+    if (table->deleteSamplers)
+    {
+        originals->deleteSamplers = table->deleteSamplers;
+        table->deleteSamplers     = &glDeleteSamplersHook<Slot>;
+    }
+
+    if (table->deleteShader)
+    {
+        originals->deleteShader = table->deleteShader;
+        table->deleteShader     = &glDeleteShaderHook<Slot>;
+    }
+
+    if (table->deleteSync)
+    {
+        originals->deleteSync = table->deleteSync;
+        table->deleteSync     = &glDeleteSyncHook<Slot>;
+    }
+
+    if (table->deleteTextures)
+    {
+        originals->deleteTextures = table->deleteTextures;
+        table->deleteTextures     = &glDeleteTexturesHook<Slot>;
+    }
+
+    if (table->deleteTransformFeedbacks)
+    {
+        originals->deleteTransformFeedbacks = table->deleteTransformFeedbacks;
+        table->deleteTransformFeedbacks     = &glDeleteTransformFeedbacksHook<Slot>;
+    }
+
+    if (table->deleteVertexArrays)
+    {
+        originals->deleteVertexArrays = table->deleteVertexArrays;
+        table->deleteVertexArrays     = &glDeleteVertexArraysHook<Slot>;
+    }
+
+    if (table->depthFunc)
+    {
+        originals->depthFunc = table->depthFunc;
+        table->depthFunc     = &glDepthFuncHook<Slot>;
+    }
+
+    if (table->depthMask)
+    {
+        originals->depthMask = table->depthMask;
+        table->depthMask     = &glDepthMaskHook<Slot>;
+    }
+
+    if (table->depthRange)
+    {
+        originals->depthRange = table->depthRange;
+        table->depthRange     = &glDepthRangeHook<Slot>;
+    }
+
+    if (table->depthRangeArrayv)
+    {
+        originals->depthRangeArrayv = table->depthRangeArrayv;
+        table->depthRangeArrayv     = &glDepthRangeArrayvHook<Slot>;
+    }
+
+    if (table->depthRangeIndexed)
+    {
+        originals->depthRangeIndexed = table->depthRangeIndexed;
+        table->depthRangeIndexed     = &glDepthRangeIndexedHook<Slot>;
+    }
+
+    if (table->depthRangef)
+    {
+        originals->depthRangef = table->depthRangef;
+        table->depthRangef     = &glDepthRangefHook<Slot>;
+    }
+
+    if (table->detachShader)
+    {
+        originals->detachShader = table->detachShader;
+        table->detachShader     = &glDetachShaderHook<Slot>;
+    }
+
+    if (table->disable)
+    {
+        originals->disable = table->disable;
+        table->disable     = &glDisableHook<Slot>;
+    }
+
+    if (table->disableVertexArrayAttrib)
+    {
+        originals->disableVertexArrayAttrib = table->disableVertexArrayAttrib;
+        table->disableVertexArrayAttrib     = &glDisableVertexArrayAttribHook<Slot>;
+    }
+
+    if (table->disableVertexAttribArray)
+    {
+        originals->disableVertexAttribArray = table->disableVertexAttribArray;
+        table->disableVertexAttribArray     = &glDisableVertexAttribArrayHook<Slot>;
+    }
+
+    if (table->disablei)
+    {
+        originals->disablei = table->disablei;
+        table->disablei     = &glDisableiHook<Slot>;
+    }
+
+    if (table->discardFramebufferEXT)
+    {
+        originals->discardFramebufferEXT = table->discardFramebufferEXT;
+        table->discardFramebufferEXT     = &glDiscardFramebufferEXTHook<Slot>;
+    }
+
+    if (table->dispatchCompute)
+    {
+        originals->dispatchCompute = table->dispatchCompute;
+        table->dispatchCompute     = &glDispatchComputeHook<Slot>;
+    }
+
+    if (table->dispatchComputeIndirect)
+    {
+        originals->dispatchComputeIndirect = table->dispatchComputeIndirect;
+        table->dispatchComputeIndirect     = &glDispatchComputeIndirectHook<Slot>;
+    }
+
+    if (table->drawArrays)
+    {
+        originals->drawArrays = table->drawArrays;
+        table->drawArrays     = &glDrawArraysHook<Slot>;
+    }
+
+    if (table->drawArraysIndirect)
+    {
+        originals->drawArraysIndirect = table->drawArraysIndirect;
+        table->drawArraysIndirect     = &glDrawArraysIndirectHook<Slot>;
+    }
+
+    if (table->drawArraysInstanced)
+    {
+        originals->drawArraysInstanced = table->drawArraysInstanced;
+        table->drawArraysInstanced     = &glDrawArraysInstancedHook<Slot>;
+    }
+
+    if (table->drawArraysInstancedBaseInstance)
+    {
+        originals->drawArraysInstancedBaseInstance = table->drawArraysInstancedBaseInstance;
+        table->drawArraysInstancedBaseInstance     = &glDrawArraysInstancedBaseInstanceHook<Slot>;
+    }
+
+    if (table->drawBuffer)
+    {
+        originals->drawBuffer = table->drawBuffer;
+        table->drawBuffer     = &glDrawBufferHook<Slot>;
+    }
+
+    if (table->drawBuffers)
+    {
+        originals->drawBuffers = table->drawBuffers;
+        table->drawBuffers     = &glDrawBuffersHook<Slot>;
+    }
+
+    if (table->drawElements)
+    {
+        originals->drawElements = table->drawElements;
+        table->drawElements     = &glDrawElementsHook<Slot>;
+    }
+
+    if (table->drawElementsBaseVertex)
+    {
+        originals->drawElementsBaseVertex = table->drawElementsBaseVertex;
+        table->drawElementsBaseVertex     = &glDrawElementsBaseVertexHook<Slot>;
+    }
+
+    if (table->drawElementsIndirect)
+    {
+        originals->drawElementsIndirect = table->drawElementsIndirect;
+        table->drawElementsIndirect     = &glDrawElementsIndirectHook<Slot>;
+    }
+
+    if (table->drawElementsInstanced)
+    {
+        originals->drawElementsInstanced = table->drawElementsInstanced;
+        table->drawElementsInstanced     = &glDrawElementsInstancedHook<Slot>;
+    }
+
+    if (table->drawElementsInstancedBaseInstance)
+    {
+        originals->drawElementsInstancedBaseInstance = table->drawElementsInstancedBaseInstance;
+        table->drawElementsInstancedBaseInstance = &glDrawElementsInstancedBaseInstanceHook<Slot>;
+    }
+
+    if (table->drawElementsInstancedBaseVertex)
+    {
+        originals->drawElementsInstancedBaseVertex = table->drawElementsInstancedBaseVertex;
+        table->drawElementsInstancedBaseVertex     = &glDrawElementsInstancedBaseVertexHook<Slot>;
+    }
+
+    if (table->drawElementsInstancedBaseVertexBaseInstance)
+    {
+        originals->drawElementsInstancedBaseVertexBaseInstance =
+            table->drawElementsInstancedBaseVertexBaseInstance;
+        table->drawElementsInstancedBaseVertexBaseInstance =
+            &glDrawElementsInstancedBaseVertexBaseInstanceHook<Slot>;
+    }
+
+    if (table->drawRangeElements)
+    {
+        originals->drawRangeElements = table->drawRangeElements;
+        table->drawRangeElements     = &glDrawRangeElementsHook<Slot>;
+    }
+
+    if (table->drawRangeElementsBaseVertex)
+    {
+        originals->drawRangeElementsBaseVertex = table->drawRangeElementsBaseVertex;
+        table->drawRangeElementsBaseVertex     = &glDrawRangeElementsBaseVertexHook<Slot>;
+    }
+
+    if (table->drawTransformFeedback)
+    {
+        originals->drawTransformFeedback = table->drawTransformFeedback;
+        table->drawTransformFeedback     = &glDrawTransformFeedbackHook<Slot>;
+    }
+
+    if (table->drawTransformFeedbackInstanced)
+    {
+        originals->drawTransformFeedbackInstanced = table->drawTransformFeedbackInstanced;
+        table->drawTransformFeedbackInstanced     = &glDrawTransformFeedbackInstancedHook<Slot>;
+    }
+
+    if (table->drawTransformFeedbackStream)
+    {
+        originals->drawTransformFeedbackStream = table->drawTransformFeedbackStream;
+        table->drawTransformFeedbackStream     = &glDrawTransformFeedbackStreamHook<Slot>;
+    }
+
+    if (table->drawTransformFeedbackStreamInstanced)
+    {
+        originals->drawTransformFeedbackStreamInstanced =
+            table->drawTransformFeedbackStreamInstanced;
+        table->drawTransformFeedbackStreamInstanced =
+            &glDrawTransformFeedbackStreamInstancedHook<Slot>;
+    }
+
+    if (table->eGLImageTargetRenderbufferStorageOES)
+    {
+        originals->eGLImageTargetRenderbufferStorageOES =
+            table->eGLImageTargetRenderbufferStorageOES;
+        table->eGLImageTargetRenderbufferStorageOES =
+            &glEGLImageTargetRenderbufferStorageOESHook<Slot>;
+    }
+
+    if (table->eGLImageTargetTexture2DOES)
+    {
+        originals->eGLImageTargetTexture2DOES = table->eGLImageTargetTexture2DOES;
+        table->eGLImageTargetTexture2DOES     = &glEGLImageTargetTexture2DOESHook<Slot>;
+    }
+
+    if (table->enable)
+    {
+        originals->enable = table->enable;
+        table->enable     = &glEnableHook<Slot>;
+    }
+
+    if (table->enableVertexArrayAttrib)
+    {
+        originals->enableVertexArrayAttrib = table->enableVertexArrayAttrib;
+        table->enableVertexArrayAttrib     = &glEnableVertexArrayAttribHook<Slot>;
+    }
+
+    if (table->enableVertexAttribArray)
+    {
+        originals->enableVertexAttribArray = table->enableVertexAttribArray;
+        table->enableVertexAttribArray     = &glEnableVertexAttribArrayHook<Slot>;
+    }
+
+    if (table->enablei)
+    {
+        originals->enablei = table->enablei;
+        table->enablei     = &glEnableiHook<Slot>;
+    }
+
+    if (table->endConditionalRender)
+    {
+        originals->endConditionalRender = table->endConditionalRender;
+        table->endConditionalRender     = &glEndConditionalRenderHook<Slot>;
+    }
+
+    if (table->endQuery)
+    {
+        originals->endQuery = table->endQuery;
+        table->endQuery     = &glEndQueryHook<Slot>;
+    }
+
+    if (table->endQueryIndexed)
+    {
+        originals->endQueryIndexed = table->endQueryIndexed;
+        table->endQueryIndexed     = &glEndQueryIndexedHook<Slot>;
+    }
+
+    if (table->endTransformFeedback)
+    {
+        originals->endTransformFeedback = table->endTransformFeedback;
+        table->endTransformFeedback     = &glEndTransformFeedbackHook<Slot>;
+    }
+
+    if (table->fenceSync)
+    {
+        originals->fenceSync = table->fenceSync;
+        table->fenceSync     = &glFenceSyncHook<Slot>;
+    }
+
+    if (table->finish)
+    {
+        originals->finish = table->finish;
+        table->finish     = &glFinishHook<Slot>;
+    }
+
+    if (table->finishFenceNV)
+    {
+        originals->finishFenceNV = table->finishFenceNV;
+        table->finishFenceNV     = &glFinishFenceNVHook<Slot>;
+    }
+
+    if (table->flush)
+    {
+        originals->flush = table->flush;
+        table->flush     = &glFlushHook<Slot>;
+    }
+
+    if (table->flushMappedBufferRange)
+    {
+        originals->flushMappedBufferRange = table->flushMappedBufferRange;
+        table->flushMappedBufferRange     = &glFlushMappedBufferRangeHook<Slot>;
+    }
+
+    if (table->flushMappedNamedBufferRange)
+    {
+        originals->flushMappedNamedBufferRange = table->flushMappedNamedBufferRange;
+        table->flushMappedNamedBufferRange     = &glFlushMappedNamedBufferRangeHook<Slot>;
+    }
+
+    if (table->framebufferParameteri)
+    {
+        originals->framebufferParameteri = table->framebufferParameteri;
+        table->framebufferParameteri     = &glFramebufferParameteriHook<Slot>;
+    }
+
+    if (table->framebufferRenderbuffer)
+    {
+        originals->framebufferRenderbuffer = table->framebufferRenderbuffer;
+        table->framebufferRenderbuffer     = &glFramebufferRenderbufferHook<Slot>;
+    }
+
+    if (table->framebufferTexture)
+    {
+        originals->framebufferTexture = table->framebufferTexture;
+        table->framebufferTexture     = &glFramebufferTextureHook<Slot>;
+    }
+
+    if (table->framebufferTexture1D)
+    {
+        originals->framebufferTexture1D = table->framebufferTexture1D;
+        table->framebufferTexture1D     = &glFramebufferTexture1DHook<Slot>;
+    }
+
+    if (table->framebufferTexture2D)
+    {
+        originals->framebufferTexture2D = table->framebufferTexture2D;
+        table->framebufferTexture2D     = &glFramebufferTexture2DHook<Slot>;
+    }
+
+    if (table->framebufferTexture3D)
+    {
+        originals->framebufferTexture3D = table->framebufferTexture3D;
+        table->framebufferTexture3D     = &glFramebufferTexture3DHook<Slot>;
+    }
+
+    if (table->framebufferTextureLayer)
+    {
+        originals->framebufferTextureLayer = table->framebufferTextureLayer;
+        table->framebufferTextureLayer     = &glFramebufferTextureLayerHook<Slot>;
+    }
+
+    if (table->frontFace)
+    {
+        originals->frontFace = table->frontFace;
+        table->frontFace     = &glFrontFaceHook<Slot>;
+    }
+
+    if (table->genBuffers)
+    {
+        originals->genBuffers = table->genBuffers;
+        table->genBuffers     = &glGenBuffersHook<Slot>;
+    }
+
+    if (table->genFencesNV)
+    {
+        originals->genFencesNV = table->genFencesNV;
+        table->genFencesNV     = &glGenFencesNVHook<Slot>;
+    }
+
+    if (table->genFramebuffers)
+    {
+        originals->genFramebuffers = table->genFramebuffers;
+        table->genFramebuffers     = &glGenFramebuffersHook<Slot>;
+    }
+
+    if (table->genPathsNV)
+    {
+        originals->genPathsNV = table->genPathsNV;
+        table->genPathsNV     = &glGenPathsNVHook<Slot>;
+    }
+
+    if (table->genProgramPipelines)
+    {
+        originals->genProgramPipelines = table->genProgramPipelines;
+        table->genProgramPipelines     = &glGenProgramPipelinesHook<Slot>;
+    }
+
+    if (table->genQueries)
+    {
+        originals->genQueries = table->genQueries;
+        table->genQueries     = &glGenQueriesHook<Slot>;
+    }
+
+    if (table->genRenderbuffers)
+    {
+        originals->genRenderbuffers = table->genRenderbuffers;
+        table->genRenderbuffers     = &glGenRenderbuffersHook<Slot>;
+    }
+
+    if (table->genSamplers)
+    {
+        originals->genSamplers = table->genSamplers;
+        table->genSamplers     = &glGenSamplersHook<Slot>;
+    }
+
+    if (table->genTextures)
+    {
+        originals->genTextures = table->genTextures;
+        table->genTextures     = &glGenTexturesHook<Slot>;
+    }
+
+    if (table->genTransformFeedbacks)
+    {
+        originals->genTransformFeedbacks = table->genTransformFeedbacks;
+        table->genTransformFeedbacks     = &glGenTransformFeedbacksHook<Slot>;
+    }
+
+    if (table->genVertexArrays)
+    {
+        originals->genVertexArrays = table->genVertexArrays;
+        table->genVertexArrays     = &glGenVertexArraysHook<Slot>;
+    }
+
+    if (table->generateMipmap)
+    {
+        originals->generateMipmap = table->generateMipmap;
+        table->generateMipmap     = &glGenerateMipmapHook<Slot>;
+    }
+
+    if (table->generateTextureMipmap)
+    {
+        originals->generateTextureMipmap = table->generateTextureMipmap;
+        table->generateTextureMipmap     = &glGenerateTextureMipmapHook<Slot>;
+    }
+
+    if (table->getActiveAtomicCounterBufferiv)
+    {
+        originals->getActiveAtomicCounterBufferiv = table->getActiveAtomicCounterBufferiv;
+        table->getActiveAtomicCounterBufferiv     = &glGetActiveAtomicCounterBufferivHook<Slot>;
+    }
+
+    if (table->getActiveAttrib)
+    {
+        originals->getActiveAttrib = table->getActiveAttrib;
+        table->getActiveAttrib     = &glGetActiveAttribHook<Slot>;
+    }
+
+    if (table->getActiveSubroutineName)
+    {
+        originals->getActiveSubroutineName = table->getActiveSubroutineName;
+        table->getActiveSubroutineName     = &glGetActiveSubroutineNameHook<Slot>;
+    }
+
+    if (table->getActiveSubroutineUniformName)
+    {
+        originals->getActiveSubroutineUniformName = table->getActiveSubroutineUniformName;
+        table->getActiveSubroutineUniformName     = &glGetActiveSubroutineUniformNameHook<Slot>;
+    }
+
+    if (table->getActiveSubroutineUniformiv)
+    {
+        originals->getActiveSubroutineUniformiv = table->getActiveSubroutineUniformiv;
+        table->getActiveSubroutineUniformiv     = &glGetActiveSubroutineUniformivHook<Slot>;
+    }
+
+    if (table->getActiveUniform)
+    {
+        originals->getActiveUniform = table->getActiveUniform;
+        table->getActiveUniform     = &glGetActiveUniformHook<Slot>;
+    }
+
+    if (table->getActiveUniformBlockName)
+    {
+        originals->getActiveUniformBlockName = table->getActiveUniformBlockName;
+        table->getActiveUniformBlockName     = &glGetActiveUniformBlockNameHook<Slot>;
+    }
+
+    if (table->getActiveUniformBlockiv)
+    {
+        originals->getActiveUniformBlockiv = table->getActiveUniformBlockiv;
+        table->getActiveUniformBlockiv     = &glGetActiveUniformBlockivHook<Slot>;
+    }
+
+    if (table->getActiveUniformName)
+    {
+        originals->getActiveUniformName = table->getActiveUniformName;
+        table->getActiveUniformName     = &glGetActiveUniformNameHook<Slot>;
+    }
+
+    if (table->getActiveUniformsiv)
+    {
+        originals->getActiveUniformsiv = table->getActiveUniformsiv;
+        table->getActiveUniformsiv     = &glGetActiveUniformsivHook<Slot>;
+    }
+
+    if (table->getAttachedShaders)
+    {
+        originals->getAttachedShaders = table->getAttachedShaders;
+        table->getAttachedShaders     = &glGetAttachedShadersHook<Slot>;
+    }
+
+    if (table->getAttribLocation)
+    {
+        originals->getAttribLocation = table->getAttribLocation;
+        table->getAttribLocation     = &glGetAttribLocationHook<Slot>;
+    }
+
+    if (table->getBooleani_v)
+    {
+        originals->getBooleani_v = table->getBooleani_v;
+        table->getBooleani_v     = &glGetBooleani_vHook<Slot>;
+    }
+
+    if (table->getBooleanv)
+    {
+        originals->getBooleanv = table->getBooleanv;
+        table->getBooleanv     = &glGetBooleanvHook<Slot>;
+    }
+
+    if (table->getBufferParameteri64v)
+    {
+        originals->getBufferParameteri64v = table->getBufferParameteri64v;
+        table->getBufferParameteri64v     = &glGetBufferParameteri64vHook<Slot>;
+    }
+
+    if (table->getBufferParameteriv)
+    {
+        originals->getBufferParameteriv = table->getBufferParameteriv;
+        table->getBufferParameteriv     = &glGetBufferParameterivHook<Slot>;
+    }
+
+    if (table->getBufferPointerv)
+    {
+        originals->getBufferPointerv = table->getBufferPointerv;
+        table->getBufferPointerv     = &glGetBufferPointervHook<Slot>;
+    }
+
+    if (table->getBufferSubData)
+    {
+        originals->getBufferSubData = table->getBufferSubData;
+        table->getBufferSubData     = &glGetBufferSubDataHook<Slot>;
+    }
+
+    if (table->getCompressedTexImage)
+    {
+        originals->getCompressedTexImage = table->getCompressedTexImage;
+        table->getCompressedTexImage     = &glGetCompressedTexImageHook<Slot>;
+    }
+
+    if (table->getCompressedTextureImage)
+    {
+        originals->getCompressedTextureImage = table->getCompressedTextureImage;
+        table->getCompressedTextureImage     = &glGetCompressedTextureImageHook<Slot>;
+    }
+
+    if (table->getCompressedTextureSubImage)
+    {
+        originals->getCompressedTextureSubImage = table->getCompressedTextureSubImage;
+        table->getCompressedTextureSubImage     = &glGetCompressedTextureSubImageHook<Slot>;
+    }
+
+    if (table->getDebugMessageLog)
+    {
+        originals->getDebugMessageLog = table->getDebugMessageLog;
+        table->getDebugMessageLog     = &glGetDebugMessageLogHook<Slot>;
+    }
+
+    if (table->getDoublei_v)
+    {
+        originals->getDoublei_v = table->getDoublei_v;
+        table->getDoublei_v     = &glGetDoublei_vHook<Slot>;
+    }
+
+    if (table->getDoublev)
+    {
+        originals->getDoublev = table->getDoublev;
+        table->getDoublev     = &glGetDoublevHook<Slot>;
+    }
+
+    if (table->getError)
+    {
+        originals->getError = table->getError;
+        table->getError     = &glGetErrorHook<Slot>;
+    }
+
+    if (table->getFenceivNV)
+    {
+        originals->getFenceivNV = table->getFenceivNV;
+        table->getFenceivNV     = &glGetFenceivNVHook<Slot>;
+    }
+
+    if (table->getFloati_v)
+    {
+        originals->getFloati_v = table->getFloati_v;
+        table->getFloati_v     = &glGetFloati_vHook<Slot>;
+    }
+
+    if (table->getFloatv)
+    {
+        originals->getFloatv = table->getFloatv;
+        table->getFloatv     = &glGetFloatvHook<Slot>;
+    }
+
+    if (table->getFragDataIndex)
+    {
+        originals->getFragDataIndex = table->getFragDataIndex;
+        table->getFragDataIndex     = &glGetFragDataIndexHook<Slot>;
+    }
+
+    if (table->getFragDataLocation)
+    {
+        originals->getFragDataLocation = table->getFragDataLocation;
+        table->getFragDataLocation     = &glGetFragDataLocationHook<Slot>;
+    }
+
+    if (table->getFramebufferAttachmentParameteriv)
+    {
+        originals->getFramebufferAttachmentParameteriv =
+            table->getFramebufferAttachmentParameteriv;
+        table->getFramebufferAttachmentParameteriv =
+            &glGetFramebufferAttachmentParameterivHook<Slot>;
+    }
+
+    if (table->getFramebufferParameteriv)
+    {
+        originals->getFramebufferParameteriv = table->getFramebufferParameteriv;
+        table->getFramebufferParameteriv     = &glGetFramebufferParameterivHook<Slot>;
+    }
+
+    if (table->getGraphicsResetStatus)
+    {
+        originals->getGraphicsResetStatus = table->getGraphicsResetStatus;
+        table->getGraphicsResetStatus     = &glGetGraphicsResetStatusHook<Slot>;
+    }
+
+    if (table->getInteger64i_v)
+    {
+        originals->getInteger64i_v = table->getInteger64i_v;
+        table->getInteger64i_v     = &glGetInteger64i_vHook<Slot>;
+    }
+
+    if (table->getInteger64v)
+    {
+        originals->getInteger64v = table->getInteger64v;
+        table->getInteger64v     = &glGetInteger64vHook<Slot>;
+    }
+
+    if (table->getIntegeri_v)
+    {
+        originals->getIntegeri_v = table->getIntegeri_v;
+        table->getIntegeri_v     = &glGetIntegeri_vHook<Slot>;
+    }
+
+    if (table->getIntegerv)
+    {
+        originals->getIntegerv = table->getIntegerv;
+        table->getIntegerv     = &glGetIntegervHook<Slot>;
+    }
+
+    if (table->getInternalformatSampleivNV)
+    {
+        originals->getInternalformatSampleivNV = table->getInternalformatSampleivNV;
+        table->getInternalformatSampleivNV     = &glGetInternalformatSampleivNVHook<Slot>;
+    }
+
+    if (table->getInternalformati64v)
+    {
+        originals->getInternalformati64v = table->getInternalformati64v;
+        table->getInternalformati64v     = &glGetInternalformati64vHook<Slot>;
+    }
+
+    if (table->getInternalformativ)
+    {
+        originals->getInternalformativ = table->getInternalformativ;
+        table->getInternalformativ     = &glGetInternalformativHook<Slot>;
+    }
+
+    if (table->getMultisamplefv)
+    {
+        originals->getMultisamplefv = table->getMultisamplefv;
+        table->getMultisamplefv     = &glGetMultisamplefvHook<Slot>;
+    }
+
+    if (table->getNamedBufferParameteri64v)
+    {
+        originals->getNamedBufferParameteri64v = table->getNamedBufferParameteri64v;
+        table->getNamedBufferParameteri64v     = &glGetNamedBufferParameteri64vHook<Slot>;
+    }
+
+    if (table->getNamedBufferParameteriv)
+    {
+        originals->getNamedBufferParameteriv = table->getNamedBufferParameteriv;
+        table->getNamedBufferParameteriv     = &glGetNamedBufferParameterivHook<Slot>;
+    }
+
+    if (table->getNamedBufferPointerv)
+    {
+        originals->getNamedBufferPointerv = table->getNamedBufferPointerv;
+        table->getNamedBufferPointerv     = &glGetNamedBufferPointervHook<Slot>;
+    }
+
+    if (table->getNamedBufferSubData)
+    {
+        originals->getNamedBufferSubData = table->getNamedBufferSubData;
+        table->getNamedBufferSubData     = &glGetNamedBufferSubDataHook<Slot>;
+    }
+
+    if (table->getNamedFramebufferAttachmentParameteriv)
+    {
+        originals->getNamedFramebufferAttachmentParameteriv =
+            table->getNamedFramebufferAttachmentParameteriv;
+        table->getNamedFramebufferAttachmentParameteriv =
+            &glGetNamedFramebufferAttachmentParameterivHook<Slot>;
+    }
+
+    if (table->getNamedFramebufferParameteriv)
+    {
+        originals->getNamedFramebufferParameteriv = table->getNamedFramebufferParameteriv;
+        table->getNamedFramebufferParameteriv     = &glGetNamedFramebufferParameterivHook<Slot>;
+    }
+
+    if (table->getNamedRenderbufferParameteriv)
+    {
+        originals->getNamedRenderbufferParameteriv = table->getNamedRenderbufferParameteriv;
+        table->getNamedRenderbufferParameteriv     = &glGetNamedRenderbufferParameterivHook<Slot>;
+    }
+
+    if (table->getObjectLabel)
+    {
+        originals->getObjectLabel = table->getObjectLabel;
+        table->getObjectLabel     = &glGetObjectLabelHook<Slot>;
+    }
+
+    if (table->getObjectPtrLabel)
+    {
+        originals->getObjectPtrLabel = table->getObjectPtrLabel;
+        table->getObjectPtrLabel     = &glGetObjectPtrLabelHook<Slot>;
+    }
+
+    if (table->getPathParameterfvNV)
+    {
+        originals->getPathParameterfvNV = table->getPathParameterfvNV;
+        table->getPathParameterfvNV     = &glGetPathParameterfvNVHook<Slot>;
+    }
+
+    if (table->getPathParameterivNV)
+    {
+        originals->getPathParameterivNV = table->getPathParameterivNV;
+        table->getPathParameterivNV     = &glGetPathParameterivNVHook<Slot>;
+    }
+
+    if (table->getPointerv)
+    {
+        originals->getPointerv = table->getPointerv;
+        table->getPointerv     = &glGetPointervHook<Slot>;
+    }
+
+    if (table->getProgramBinary)
+    {
+        originals->getProgramBinary = table->getProgramBinary;
+        table->getProgramBinary     = &glGetProgramBinaryHook<Slot>;
+    }
+
+    if (table->getProgramInfoLog)
+    {
+        originals->getProgramInfoLog = table->getProgramInfoLog;
+        table->getProgramInfoLog     = &glGetProgramInfoLogHook<Slot>;
+    }
+
+    if (table->getProgramInterfaceiv)
+    {
+        originals->getProgramInterfaceiv = table->getProgramInterfaceiv;
+        table->getProgramInterfaceiv     = &glGetProgramInterfaceivHook<Slot>;
+    }
+
+    if (table->getProgramPipelineInfoLog)
+    {
+        originals->getProgramPipelineInfoLog = table->getProgramPipelineInfoLog;
+        table->getProgramPipelineInfoLog     = &glGetProgramPipelineInfoLogHook<Slot>;
+    }
+
+    if (table->getProgramPipelineiv)
+    {
+        originals->getProgramPipelineiv = table->getProgramPipelineiv;
+        table->getProgramPipelineiv     = &glGetProgramPipelineivHook<Slot>;
+    }
+
+    if (table->getProgramResourceIndex)
+    {
+        originals->getProgramResourceIndex = table->getProgramResourceIndex;
+        table->getProgramResourceIndex     = &glGetProgramResourceIndexHook<Slot>;
+    }
+
+    if (table->getProgramResourceLocation)
+    {
+        originals->getProgramResourceLocation = table->getProgramResourceLocation;
+        table->getProgramResourceLocation     = &glGetProgramResourceLocationHook<Slot>;
+    }
+
+    if (table->getProgramResourceLocationIndex)
+    {
+        originals->getProgramResourceLocationIndex = table->getProgramResourceLocationIndex;
+        table->getProgramResourceLocationIndex     = &glGetProgramResourceLocationIndexHook<Slot>;
+    }
+
+    if (table->getProgramResourceName)
+    {
+        originals->getProgramResourceName = table->getProgramResourceName;
+        table->getProgramResourceName     = &glGetProgramResourceNameHook<Slot>;
+    }
+
+    if (table->getProgramResourceiv)
+    {
+        originals->getProgramResourceiv = table->getProgramResourceiv;
+        table->getProgramResourceiv     = &glGetProgramResourceivHook<Slot>;
+    }
+
+    if (table->getProgramStageiv)
+    {
+        originals->getProgramStageiv = table->getProgramStageiv;
+        table->getProgramStageiv     = &glGetProgramStageivHook<Slot>;
+    }
+
+    if (table->getProgramiv)
+    {
+        originals->getProgramiv = table->getProgramiv;
+        table->getProgramiv     = &glGetProgramivHook<Slot>;
+    }
+
+    if (table->getQueryBufferObjecti64v)
+    {
+        originals->getQueryBufferObjecti64v = table->getQueryBufferObjecti64v;
+        table->getQueryBufferObjecti64v     = &glGetQueryBufferObjecti64vHook<Slot>;
+    }
+
+    if (table->getQueryBufferObjectiv)
+    {
+        originals->getQueryBufferObjectiv = table->getQueryBufferObjectiv;
+        table->getQueryBufferObjectiv     = &glGetQueryBufferObjectivHook<Slot>;
+    }
+
+    if (table->getQueryBufferObjectui64v)
+    {
+        originals->getQueryBufferObjectui64v = table->getQueryBufferObjectui64v;
+        table->getQueryBufferObjectui64v     = &glGetQueryBufferObjectui64vHook<Slot>;
+    }
+
+    if (table->getQueryBufferObjectuiv)
+    {
+        originals->getQueryBufferObjectuiv = table->getQueryBufferObjectuiv;
+        table->getQueryBufferObjectuiv     = &glGetQueryBufferObjectuivHook<Slot>;
+    }
+
+    if (table->getQueryIndexediv)
+    {
+        originals->getQueryIndexediv = table->getQueryIndexediv;
+        table->getQueryIndexediv     = &glGetQueryIndexedivHook<Slot>;
+    }
+
+    if (table->getQueryObjecti64v)
+    {
+        originals->getQueryObjecti64v = table->getQueryObjecti64v;
+        table->getQueryObjecti64v     = &glGetQueryObjecti64vHook<Slot>;
+    }
+
+    if (table->getQueryObjectiv)
+    {
+        originals->getQueryObjectiv = table->getQueryObjectiv;
+        table->getQueryObjectiv     = &glGetQueryObjectivHook<Slot>;
+    }
+
+    if (table->getQueryObjectui64v)
+    {
+        originals->getQueryObjectui64v = table->getQueryObjectui64v;
+        table->getQueryObjectui64v     = &glGetQueryObjectui64vHook<Slot>;
+    }
+
+    if (table->getQueryObjectuiv)
+    {
+        originals->getQueryObjectuiv = table->getQueryObjectuiv;
+        table->getQueryObjectuiv     = &glGetQueryObjectuivHook<Slot>;
+    }
+
+    if (table->getQueryiv)
+    {
+        originals->getQueryiv = table->getQueryiv;
+        table->getQueryiv     = &glGetQueryivHook<Slot>;
+    }
+
+    if (table->getRenderbufferParameteriv)
+    {
+        originals->getRenderbufferParameteriv = table->getRenderbufferParameteriv;
+        table->getRenderbufferParameteriv     = &glGetRenderbufferParameterivHook<Slot>;
+    }
+
+    if (table->getSamplerParameterIiv)
+    {
+        originals->getSamplerParameterIiv = table->getSamplerParameterIiv;
+        table->getSamplerParameterIiv     = &glGetSamplerParameterIivHook<Slot>;
+    }
+
+    if (table->getSamplerParameterIuiv)
+    {
+        originals->getSamplerParameterIuiv = table->getSamplerParameterIuiv;
+        table->getSamplerParameterIuiv     = &glGetSamplerParameterIuivHook<Slot>;
+    }
+
+    if (table->getSamplerParameterfv)
+    {
+        originals->getSamplerParameterfv = table->getSamplerParameterfv;
+        table->getSamplerParameterfv     = &glGetSamplerParameterfvHook<Slot>;
+    }
+
+    if (table->getSamplerParameteriv)
+    {
+        originals->getSamplerParameteriv = table->getSamplerParameteriv;
+        table->getSamplerParameteriv     = &glGetSamplerParameterivHook<Slot>;
+    }
+
+    if (table->getShaderInfoLog)
+    {
+        originals->getShaderInfoLog = table->getShaderInfoLog;
+        table->getShaderInfoLog     = &glGetShaderInfoLogHook<Slot>;
+    }
+
+    if (table->getShaderPrecisionFormat)
+    {
+        originals->getShaderPrecisionFormat = table->getShaderPrecisionFormat;
+        table->getShaderPrecisionFormat     = &glGetShaderPrecisionFormatHook<Slot>;
+    }
+
+    if (table->getShaderSource)
+    {
+        originals->getShaderSource = table->getShaderSource;
+        table->getShaderSource     = &glGetShaderSourceHook<Slot>;
+    }
+
+    if (table->getShaderiv)
+    {
+        originals->getShaderiv = table->getShaderiv;
+        table->getShaderiv     = &glGetShaderivHook<Slot>;
+    }
+
+    if (table->getString)
+    {
+        originals->getString = table->getString;
+        table->getString     = &glGetStringHook<Slot>;
+    }
+
+    if (table->getStringi)
+    {
+        originals->getStringi = table->getStringi;
+        table->getStringi     = &glGetStringiHook<Slot>;
+    }
+
+    if (table->getSubroutineIndex)
+    {
+        originals->getSubroutineIndex = table->getSubroutineIndex;
+        table->getSubroutineIndex     = &glGetSubroutineIndexHook<Slot>;
+    }
+
+    if (table->getSubroutineUniformLocation)
+    {
+        originals->getSubroutineUniformLocation = table->getSubroutineUniformLocation;
+        table->getSubroutineUniformLocation     = &glGetSubroutineUniformLocationHook<Slot>;
+    }
+
+    if (table->getSynciv)
+    {
+        originals->getSynciv = table->getSynciv;
+        table->getSynciv     = &glGetSyncivHook<Slot>;
+    }
+
+    if (table->getTexImage)
+    {
+        originals->getTexImage = table->getTexImage;
+        table->getTexImage     = &glGetTexImageHook<Slot>;
+    }
+
+    if (table->getTexLevelParameterfv)
+    {
+        originals->getTexLevelParameterfv = table->getTexLevelParameterfv;
+        table->getTexLevelParameterfv     = &glGetTexLevelParameterfvHook<Slot>;
+    }
+
+    if (table->getTexLevelParameteriv)
+    {
+        originals->getTexLevelParameteriv = table->getTexLevelParameteriv;
+        table->getTexLevelParameteriv     = &glGetTexLevelParameterivHook<Slot>;
+    }
+
+    if (table->getTexParameterIiv)
+    {
+        originals->getTexParameterIiv = table->getTexParameterIiv;
+        table->getTexParameterIiv     = &glGetTexParameterIivHook<Slot>;
+    }
+
+    if (table->getTexParameterIuiv)
+    {
+        originals->getTexParameterIuiv = table->getTexParameterIuiv;
+        table->getTexParameterIuiv     = &glGetTexParameterIuivHook<Slot>;
+    }
+
+    if (table->getTexParameterfv)
+    {
+        originals->getTexParameterfv = table->getTexParameterfv;
+        table->getTexParameterfv     = &glGetTexParameterfvHook<Slot>;
+    }
+
+    if (table->getTexParameteriv)
+    {
+        originals->getTexParameteriv = table->getTexParameteriv;
+        table->getTexParameteriv     = &glGetTexParameterivHook<Slot>;
+    }
+
+    if (table->getTextureImage)
+    {
+        originals->getTextureImage = table->getTextureImage;
+        table->getTextureImage     = &glGetTextureImageHook<Slot>;
+    }
+
+    if (table->getTextureLevelParameterfv)
+    {
+        originals->getTextureLevelParameterfv = table->getTextureLevelParameterfv;
+        table->getTextureLevelParameterfv     = &glGetTextureLevelParameterfvHook<Slot>;
+    }
+
+    if (table->getTextureLevelParameteriv)
+    {
+        originals->getTextureLevelParameteriv = table->getTextureLevelParameteriv;
+        table->getTextureLevelParameteriv     = &glGetTextureLevelParameterivHook<Slot>;
+    }
+
+    if (table->getTextureParameterIiv)
+    {
+        originals->getTextureParameterIiv = table->getTextureParameterIiv;
+        table->getTextureParameterIiv     = &glGetTextureParameterIivHook<Slot>;
+    }
+
+    if (table->getTextureParameterIuiv)
+    {
+        originals->getTextureParameterIuiv = table->getTextureParameterIuiv;
+        table->getTextureParameterIuiv     = &glGetTextureParameterIuivHook<Slot>;
+    }
+
+    if (table->getTextureParameterfv)
+    {
+        originals->getTextureParameterfv = table->getTextureParameterfv;
+        table->getTextureParameterfv     = &glGetTextureParameterfvHook<Slot>;
+    }
+
+    if (table->getTextureParameteriv)
+    {
+        originals->getTextureParameteriv = table->getTextureParameteriv;
+        table->getTextureParameteriv     = &glGetTextureParameterivHook<Slot>;
+    }
+
+    if (table->getTextureSubImage)
+    {
+        originals->getTextureSubImage = table->getTextureSubImage;
+        table->getTextureSubImage     = &glGetTextureSubImageHook<Slot>;
+    }
+
+    if (table->getTransformFeedbackVarying)
+    {
+        originals->getTransformFeedbackVarying = table->getTransformFeedbackVarying;
+        table->getTransformFeedbackVarying     = &glGetTransformFeedbackVaryingHook<Slot>;
+    }
+
+    if (table->getTransformFeedbacki64_v)
+    {
+        originals->getTransformFeedbacki64_v = table->getTransformFeedbacki64_v;
+        table->getTransformFeedbacki64_v     = &glGetTransformFeedbacki64_vHook<Slot>;
+    }
+
+    if (table->getTransformFeedbacki_v)
+    {
+        originals->getTransformFeedbacki_v = table->getTransformFeedbacki_v;
+        table->getTransformFeedbacki_v     = &glGetTransformFeedbacki_vHook<Slot>;
+    }
+
+    if (table->getTransformFeedbackiv)
+    {
+        originals->getTransformFeedbackiv = table->getTransformFeedbackiv;
+        table->getTransformFeedbackiv     = &glGetTransformFeedbackivHook<Slot>;
+    }
+
+    if (table->getUniformBlockIndex)
+    {
+        originals->getUniformBlockIndex = table->getUniformBlockIndex;
+        table->getUniformBlockIndex     = &glGetUniformBlockIndexHook<Slot>;
+    }
+
+    if (table->getUniformIndices)
+    {
+        originals->getUniformIndices = table->getUniformIndices;
+        table->getUniformIndices     = &glGetUniformIndicesHook<Slot>;
+    }
+
+    if (table->getUniformLocation)
+    {
+        originals->getUniformLocation = table->getUniformLocation;
+        table->getUniformLocation     = &glGetUniformLocationHook<Slot>;
+    }
+
+    if (table->getUniformSubroutineuiv)
+    {
+        originals->getUniformSubroutineuiv = table->getUniformSubroutineuiv;
+        table->getUniformSubroutineuiv     = &glGetUniformSubroutineuivHook<Slot>;
+    }
+
+    if (table->getUniformdv)
+    {
+        originals->getUniformdv = table->getUniformdv;
+        table->getUniformdv     = &glGetUniformdvHook<Slot>;
+    }
+
+    if (table->getUniformfv)
+    {
+        originals->getUniformfv = table->getUniformfv;
+        table->getUniformfv     = &glGetUniformfvHook<Slot>;
+    }
+
+    if (table->getUniformiv)
+    {
+        originals->getUniformiv = table->getUniformiv;
+        table->getUniformiv     = &glGetUniformivHook<Slot>;
+    }
+
+    if (table->getUniformuiv)
+    {
+        originals->getUniformuiv = table->getUniformuiv;
+        table->getUniformuiv     = &glGetUniformuivHook<Slot>;
+    }
+
+    if (table->getVertexArrayIndexed64iv)
+    {
+        originals->getVertexArrayIndexed64iv = table->getVertexArrayIndexed64iv;
+        table->getVertexArrayIndexed64iv     = &glGetVertexArrayIndexed64ivHook<Slot>;
+    }
+
+    if (table->getVertexArrayIndexediv)
+    {
+        originals->getVertexArrayIndexediv = table->getVertexArrayIndexediv;
+        table->getVertexArrayIndexediv     = &glGetVertexArrayIndexedivHook<Slot>;
+    }
+
+    if (table->getVertexArrayiv)
+    {
+        originals->getVertexArrayiv = table->getVertexArrayiv;
+        table->getVertexArrayiv     = &glGetVertexArrayivHook<Slot>;
+    }
+
+    if (table->getVertexAttribIiv)
+    {
+        originals->getVertexAttribIiv = table->getVertexAttribIiv;
+        table->getVertexAttribIiv     = &glGetVertexAttribIivHook<Slot>;
+    }
+
+    if (table->getVertexAttribIuiv)
+    {
+        originals->getVertexAttribIuiv = table->getVertexAttribIuiv;
+        table->getVertexAttribIuiv     = &glGetVertexAttribIuivHook<Slot>;
+    }
+
+    if (table->getVertexAttribLdv)
+    {
+        originals->getVertexAttribLdv = table->getVertexAttribLdv;
+        table->getVertexAttribLdv     = &glGetVertexAttribLdvHook<Slot>;
+    }
+
+    if (table->getVertexAttribPointerv)
+    {
+        originals->getVertexAttribPointerv = table->getVertexAttribPointerv;
+        table->getVertexAttribPointerv     = &glGetVertexAttribPointervHook<Slot>;
+    }
+
+    if (table->getVertexAttribdv)
+    {
+        originals->getVertexAttribdv = table->getVertexAttribdv;
+        table->getVertexAttribdv     = &glGetVertexAttribdvHook<Slot>;
+    }
+
+    if (table->getVertexAttribfv)
+    {
+        originals->getVertexAttribfv = table->getVertexAttribfv;
+        table->getVertexAttribfv     = &glGetVertexAttribfvHook<Slot>;
+    }
+
+    if (table->getVertexAttribiv)
+    {
+        originals->getVertexAttribiv = table->getVertexAttribiv;
+        table->getVertexAttribiv     = &glGetVertexAttribivHook<Slot>;
+    }
+
+    if (table->getnCompressedTexImage)
+    {
+        originals->getnCompressedTexImage = table->getnCompressedTexImage;
+        table->getnCompressedTexImage     = &glGetnCompressedTexImageHook<Slot>;
+    }
+
+    if (table->getnTexImage)
+    {
+        originals->getnTexImage = table->getnTexImage;
+        table->getnTexImage     = &glGetnTexImageHook<Slot>;
+    }
+
+    if (table->getnUniformdv)
+    {
+        originals->getnUniformdv = table->getnUniformdv;
+        table->getnUniformdv     = &glGetnUniformdvHook<Slot>;
+    }
+
+    if (table->getnUniformfv)
+    {
+        originals->getnUniformfv = table->getnUniformfv;
+        table->getnUniformfv     = &glGetnUniformfvHook<Slot>;
+    }
+
+    if (table->getnUniformiv)
+    {
+        originals->getnUniformiv = table->getnUniformiv;
+        table->getnUniformiv     = &glGetnUniformivHook<Slot>;
+    }
+
+    if (table->getnUniformuiv)
+    {
+        originals->getnUniformuiv = table->getnUniformuiv;
+        table->getnUniformuiv     = &glGetnUniformuivHook<Slot>;
+    }
+
+    if (table->hint)
+    {
+        originals->hint = table->hint;
+        table->hint     = &glHintHook<Slot>;
+    }
+
+    if (table->insertEventMarkerEXT)
+    {
+        originals->insertEventMarkerEXT = table->insertEventMarkerEXT;
+        table->insertEventMarkerEXT     = &glInsertEventMarkerEXTHook<Slot>;
+    }
+
+    if (table->invalidateBufferData)
+    {
+        originals->invalidateBufferData = table->invalidateBufferData;
+        table->invalidateBufferData     = &glInvalidateBufferDataHook<Slot>;
+    }
+
+    if (table->invalidateBufferSubData)
+    {
+        originals->invalidateBufferSubData = table->invalidateBufferSubData;
+        table->invalidateBufferSubData     = &glInvalidateBufferSubDataHook<Slot>;
+    }
+
+    if (table->invalidateFramebuffer)
+    {
+        originals->invalidateFramebuffer = table->invalidateFramebuffer;
+        table->invalidateFramebuffer     = &glInvalidateFramebufferHook<Slot>;
+    }
+
+    if (table->invalidateNamedFramebufferData)
+    {
+        originals->invalidateNamedFramebufferData = table->invalidateNamedFramebufferData;
+        table->invalidateNamedFramebufferData     = &glInvalidateNamedFramebufferDataHook<Slot>;
+    }
+
+    if (table->invalidateNamedFramebufferSubData)
+    {
+        originals->invalidateNamedFramebufferSubData = table->invalidateNamedFramebufferSubData;
+        table->invalidateNamedFramebufferSubData = &glInvalidateNamedFramebufferSubDataHook<Slot>;
+    }
+
+    if (table->invalidateSubFramebuffer)
+    {
+        originals->invalidateSubFramebuffer = table->invalidateSubFramebuffer;
+        table->invalidateSubFramebuffer     = &glInvalidateSubFramebufferHook<Slot>;
+    }
+
+    if (table->invalidateTexImage)
+    {
+        originals->invalidateTexImage = table->invalidateTexImage;
+        table->invalidateTexImage     = &glInvalidateTexImageHook<Slot>;
+    }
+
+    if (table->invalidateTexSubImage)
+    {
+        originals->invalidateTexSubImage = table->invalidateTexSubImage;
+        table->invalidateTexSubImage     = &glInvalidateTexSubImageHook<Slot>;
+    }
+
+    if (table->isBuffer)
+    {
+        originals->isBuffer = table->isBuffer;
+        table->isBuffer     = &glIsBufferHook<Slot>;
+    }
+
+    if (table->isEnabled)
+    {
+        originals->isEnabled = table->isEnabled;
+        table->isEnabled     = &glIsEnabledHook<Slot>;
+    }
+
+    if (table->isEnabledi)
+    {
+        originals->isEnabledi = table->isEnabledi;
+        table->isEnabledi     = &glIsEnablediHook<Slot>;
+    }
+
+    if (table->isFenceNV)
+    {
+        originals->isFenceNV = table->isFenceNV;
+        table->isFenceNV     = &glIsFenceNVHook<Slot>;
+    }
+
+    if (table->isFramebuffer)
+    {
+        originals->isFramebuffer = table->isFramebuffer;
+        table->isFramebuffer     = &glIsFramebufferHook<Slot>;
+    }
+
+    if (table->isPathNV)
+    {
+        originals->isPathNV = table->isPathNV;
+        table->isPathNV     = &glIsPathNVHook<Slot>;
+    }
+
+    if (table->isProgram)
+    {
+        originals->isProgram = table->isProgram;
+        table->isProgram     = &glIsProgramHook<Slot>;
+    }
+
+    if (table->isProgramPipeline)
+    {
+        originals->isProgramPipeline = table->isProgramPipeline;
+        table->isProgramPipeline     = &glIsProgramPipelineHook<Slot>;
+    }
+
+    if (table->isQuery)
+    {
+        originals->isQuery = table->isQuery;
+        table->isQuery     = &glIsQueryHook<Slot>;
+    }
+
+    if (table->isRenderbuffer)
+    {
+        originals->isRenderbuffer = table->isRenderbuffer;
+        table->isRenderbuffer     = &glIsRenderbufferHook<Slot>;
+    }
+
+    if (table->isSampler)
+    {
+        originals->isSampler = table->isSampler;
+        table->isSampler     = &glIsSamplerHook<Slot>;
+    }
+
+    if (table->isShader)
+    {
+        originals->isShader = table->isShader;
+        table->isShader     = &glIsShaderHook<Slot>;
+    }
+
+    if (table->isSync)
+    {
+        originals->isSync = table->isSync;
+        table->isSync     = &glIsSyncHook<Slot>;
+    }
+
+    if (table->isTexture)
+    {
+        originals->isTexture = table->isTexture;
+        table->isTexture     = &glIsTextureHook<Slot>;
+    }
+
+    if (table->isTransformFeedback)
+    {
+        originals->isTransformFeedback = table->isTransformFeedback;
+        table->isTransformFeedback     = &glIsTransformFeedbackHook<Slot>;
+    }
+
+    if (table->isVertexArray)
+    {
+        originals->isVertexArray = table->isVertexArray;
+        table->isVertexArray     = &glIsVertexArrayHook<Slot>;
+    }
+
+    if (table->lineWidth)
+    {
+        originals->lineWidth = table->lineWidth;
+        table->lineWidth     = &glLineWidthHook<Slot>;
+    }
+
+    if (table->linkProgram)
+    {
+        originals->linkProgram = table->linkProgram;
+        table->linkProgram     = &glLinkProgramHook<Slot>;
+    }
+
+    if (table->logicOp)
+    {
+        originals->logicOp = table->logicOp;
+        table->logicOp     = &glLogicOpHook<Slot>;
+    }
+
+    if (table->mapBuffer)
+    {
+        originals->mapBuffer = table->mapBuffer;
+        table->mapBuffer     = &glMapBufferHook<Slot>;
+    }
+
+    if (table->mapBufferRange)
+    {
+        originals->mapBufferRange = table->mapBufferRange;
+        table->mapBufferRange     = &glMapBufferRangeHook<Slot>;
+    }
+
+    if (table->mapNamedBuffer)
+    {
+        originals->mapNamedBuffer = table->mapNamedBuffer;
+        table->mapNamedBuffer     = &glMapNamedBufferHook<Slot>;
+    }
+
+    if (table->mapNamedBufferRange)
+    {
+        originals->mapNamedBufferRange = table->mapNamedBufferRange;
+        table->mapNamedBufferRange     = &glMapNamedBufferRangeHook<Slot>;
+    }
+
+    if (table->matrixLoadfEXT)
+    {
+        originals->matrixLoadfEXT = table->matrixLoadfEXT;
+        table->matrixLoadfEXT     = &glMatrixLoadfEXTHook<Slot>;
+    }
+
+    if (table->memoryBarrier)
+    {
+        originals->memoryBarrier = table->memoryBarrier;
+        table->memoryBarrier     = &glMemoryBarrierHook<Slot>;
+    }
+
+    if (table->memoryBarrierByRegion)
+    {
+        originals->memoryBarrierByRegion = table->memoryBarrierByRegion;
+        table->memoryBarrierByRegion     = &glMemoryBarrierByRegionHook<Slot>;
+    }
+
+    if (table->minSampleShading)
+    {
+        originals->minSampleShading = table->minSampleShading;
+        table->minSampleShading     = &glMinSampleShadingHook<Slot>;
+    }
+
+    if (table->multiDrawArrays)
+    {
+        originals->multiDrawArrays = table->multiDrawArrays;
+        table->multiDrawArrays     = &glMultiDrawArraysHook<Slot>;
+    }
+
+    if (table->multiDrawArraysIndirect)
+    {
+        originals->multiDrawArraysIndirect = table->multiDrawArraysIndirect;
+        table->multiDrawArraysIndirect     = &glMultiDrawArraysIndirectHook<Slot>;
+    }
+
+    if (table->multiDrawElements)
+    {
+        originals->multiDrawElements = table->multiDrawElements;
+        table->multiDrawElements     = &glMultiDrawElementsHook<Slot>;
+    }
+
+    if (table->multiDrawElementsBaseVertex)
+    {
+        originals->multiDrawElementsBaseVertex = table->multiDrawElementsBaseVertex;
+        table->multiDrawElementsBaseVertex     = &glMultiDrawElementsBaseVertexHook<Slot>;
+    }
+
+    if (table->multiDrawElementsIndirect)
+    {
+        originals->multiDrawElementsIndirect = table->multiDrawElementsIndirect;
+        table->multiDrawElementsIndirect     = &glMultiDrawElementsIndirectHook<Slot>;
+    }
+
+    if (table->namedBufferData)
+    {
+        originals->namedBufferData = table->namedBufferData;
+        table->namedBufferData     = &glNamedBufferDataHook<Slot>;
+    }
+
+    if (table->namedBufferStorage)
+    {
+        originals->namedBufferStorage = table->namedBufferStorage;
+        table->namedBufferStorage     = &glNamedBufferStorageHook<Slot>;
+    }
+
+    if (table->namedBufferSubData)
+    {
+        originals->namedBufferSubData = table->namedBufferSubData;
+        table->namedBufferSubData     = &glNamedBufferSubDataHook<Slot>;
+    }
+
+    if (table->namedFramebufferDrawBuffer)
+    {
+        originals->namedFramebufferDrawBuffer = table->namedFramebufferDrawBuffer;
+        table->namedFramebufferDrawBuffer     = &glNamedFramebufferDrawBufferHook<Slot>;
+    }
+
+    if (table->namedFramebufferDrawBuffers)
+    {
+        originals->namedFramebufferDrawBuffers = table->namedFramebufferDrawBuffers;
+        table->namedFramebufferDrawBuffers     = &glNamedFramebufferDrawBuffersHook<Slot>;
+    }
+
+    if (table->namedFramebufferParameteri)
+    {
+        originals->namedFramebufferParameteri = table->namedFramebufferParameteri;
+        table->namedFramebufferParameteri     = &glNamedFramebufferParameteriHook<Slot>;
+    }
+
+    if (table->namedFramebufferReadBuffer)
+    {
+        originals->namedFramebufferReadBuffer = table->namedFramebufferReadBuffer;
+        table->namedFramebufferReadBuffer     = &glNamedFramebufferReadBufferHook<Slot>;
+    }
+
+    if (table->namedFramebufferRenderbuffer)
+    {
+        originals->namedFramebufferRenderbuffer = table->namedFramebufferRenderbuffer;
+        table->namedFramebufferRenderbuffer     = &glNamedFramebufferRenderbufferHook<Slot>;
+    }
+
+    if (table->namedFramebufferTexture)
+    {
+        originals->namedFramebufferTexture = table->namedFramebufferTexture;
+        table->namedFramebufferTexture     = &glNamedFramebufferTextureHook<Slot>;
+    }
+
+    if (table->namedFramebufferTextureLayer)
+    {
+        originals->namedFramebufferTextureLayer = table->namedFramebufferTextureLayer;
+        table->namedFramebufferTextureLayer     = &glNamedFramebufferTextureLayerHook<Slot>;
+    }
+
+    if (table->namedRenderbufferStorage)
+    {
+        originals->namedRenderbufferStorage = table->namedRenderbufferStorage;
+        table->namedRenderbufferStorage     = &glNamedRenderbufferStorageHook<Slot>;
+    }
+
+    if (table->namedRenderbufferStorageMultisample)
+    {
+        originals->namedRenderbufferStorageMultisample =
+            table->namedRenderbufferStorageMultisample;
+        table->namedRenderbufferStorageMultisample =
+            &glNamedRenderbufferStorageMultisampleHook<Slot>;
+    }
+
+    if (table->objectLabel)
+    {
+        originals->objectLabel = table->objectLabel;
+        table->objectLabel     = &glObjectLabelHook<Slot>;
+    }
+
+    if (table->objectPtrLabel)
+    {
+        originals->objectPtrLabel = table->objectPtrLabel;
+        table->objectPtrLabel     = &glObjectPtrLabelHook<Slot>;
+    }
+
+    if (table->patchParameterfv)
+    {
+        originals->patchParameterfv = table->patchParameterfv;
+        table->patchParameterfv     = &glPatchParameterfvHook<Slot>;
+    }
+
+    if (table->patchParameteri)
+    {
+        originals->patchParameteri = table->patchParameteri;
+        table->patchParameteri     = &glPatchParameteriHook<Slot>;
+    }
+
+    if (table->pathCommandsNV)
+    {
+        originals->pathCommandsNV = table->pathCommandsNV;
+        table->pathCommandsNV     = &glPathCommandsNVHook<Slot>;
+    }
+
+    if (table->pathParameterfNV)
+    {
+        originals->pathParameterfNV = table->pathParameterfNV;
+        table->pathParameterfNV     = &glPathParameterfNVHook<Slot>;
+    }
+
+    if (table->pathParameteriNV)
+    {
+        originals->pathParameteriNV = table->pathParameteriNV;
+        table->pathParameteriNV     = &glPathParameteriNVHook<Slot>;
+    }
+
+    if (table->pathStencilFuncNV)
+    {
+        originals->pathStencilFuncNV = table->pathStencilFuncNV;
+        table->pathStencilFuncNV     = &glPathStencilFuncNVHook<Slot>;
+    }
+
+    if (table->pauseTransformFeedback)
+    {
+        originals->pauseTransformFeedback = table->pauseTransformFeedback;
+        table->pauseTransformFeedback     = &glPauseTransformFeedbackHook<Slot>;
+    }
+
+    if (table->pixelStoref)
+    {
+        originals->pixelStoref = table->pixelStoref;
+        table->pixelStoref     = &glPixelStorefHook<Slot>;
+    }
+
+    if (table->pixelStorei)
+    {
+        originals->pixelStorei = table->pixelStorei;
+        table->pixelStorei     = &glPixelStoreiHook<Slot>;
+    }
+
+    if (table->pointParameterf)
+    {
+        originals->pointParameterf = table->pointParameterf;
+        table->pointParameterf     = &glPointParameterfHook<Slot>;
+    }
+
+    if (table->pointParameterfv)
+    {
+        originals->pointParameterfv = table->pointParameterfv;
+        table->pointParameterfv     = &glPointParameterfvHook<Slot>;
+    }
+
+    if (table->pointParameteri)
+    {
+        originals->pointParameteri = table->pointParameteri;
+        table->pointParameteri     = &glPointParameteriHook<Slot>;
+    }
+
+    if (table->pointParameteriv)
+    {
+        originals->pointParameteriv = table->pointParameteriv;
+        table->pointParameteriv     = &glPointParameterivHook<Slot>;
+    }
+
+    if (table->pointSize)
+    {
+        originals->pointSize = table->pointSize;
+        table->pointSize     = &glPointSizeHook<Slot>;
+    }
+
+    if (table->polygonMode)
+    {
+        originals->polygonMode = table->polygonMode;
+        table->polygonMode     = &glPolygonModeHook<Slot>;
+    }
+
+    if (table->polygonOffset)
+    {
+        originals->polygonOffset = table->polygonOffset;
+        table->polygonOffset     = &glPolygonOffsetHook<Slot>;
+    }
+
+    if (table->popDebugGroup)
+    {
+        originals->popDebugGroup = table->popDebugGroup;
+        table->popDebugGroup     = &glPopDebugGroupHook<Slot>;
+    }
+
+    if (table->popGroupMarkerEXT)
+    {
+        originals->popGroupMarkerEXT = table->popGroupMarkerEXT;
+        table->popGroupMarkerEXT     = &glPopGroupMarkerEXTHook<Slot>;
+    }
+
+    if (table->primitiveBoundingBox)
+    {
+        originals->primitiveBoundingBox = table->primitiveBoundingBox;
+        table->primitiveBoundingBox     = &glPrimitiveBoundingBoxHook<Slot>;
+    }
+
+    if (table->primitiveRestartIndex)
+    {
+        originals->primitiveRestartIndex = table->primitiveRestartIndex;
+        table->primitiveRestartIndex     = &glPrimitiveRestartIndexHook<Slot>;
+    }
+
+    if (table->programBinary)
+    {
+        originals->programBinary = table->programBinary;
+        table->programBinary     = &glProgramBinaryHook<Slot>;
+    }
+
+    if (table->programParameteri)
+    {
+        originals->programParameteri = table->programParameteri;
+        table->programParameteri     = &glProgramParameteriHook<Slot>;
+    }
+
+    if (table->programPathFragmentInputGenNV)
+    {
+        originals->programPathFragmentInputGenNV = table->programPathFragmentInputGenNV;
+        table->programPathFragmentInputGenNV     = &glProgramPathFragmentInputGenNVHook<Slot>;
+    }
+
+    if (table->programUniform1d)
+    {
+        originals->programUniform1d = table->programUniform1d;
+        table->programUniform1d     = &glProgramUniform1dHook<Slot>;
+    }
+
+    if (table->programUniform1dv)
+    {
+        originals->programUniform1dv = table->programUniform1dv;
+        table->programUniform1dv     = &glProgramUniform1dvHook<Slot>;
+    }
+
+    if (table->programUniform1f)
+    {
+        originals->programUniform1f = table->programUniform1f;
+        table->programUniform1f     = &glProgramUniform1fHook<Slot>;
+    }
+
+    if (table->programUniform1fv)
+    {
+        originals->programUniform1fv = table->programUniform1fv;
+        table->programUniform1fv     = &glProgramUniform1fvHook<Slot>;
+    }
+
+    if (table->programUniform1i)
+    {
+        originals->programUniform1i = table->programUniform1i;
+        table->programUniform1i     = &glProgramUniform1iHook<Slot>;
+    }
+
+    if (table->programUniform1iv)
+    {
+        originals->programUniform1iv = table->programUniform1iv;
+        table->programUniform1iv     = &glProgramUniform1ivHook<Slot>;
+    }
+
+    if (table->programUniform1ui)
+    {
+        originals->programUniform1ui = table->programUniform1ui;
+        table->programUniform1ui     = &glProgramUniform1uiHook<Slot>;
+    }
+
+    if (table->programUniform1uiv)
+    {
+        originals->programUniform1uiv = table->programUniform1uiv;
+        table->programUniform1uiv     = &glProgramUniform1uivHook<Slot>;
+    }
+
+    if (table->programUniform2d)
+    {
+        originals->programUniform2d = table->programUniform2d;
+        table->programUniform2d     = &glProgramUniform2dHook<Slot>;
+    }
+
+    if (table->programUniform2dv)
+    {
+        originals->programUniform2dv = table->programUniform2dv;
+        table->programUniform2dv     = &glProgramUniform2dvHook<Slot>;
+    }
+
+    if (table->programUniform2f)
+    {
+        originals->programUniform2f = table->programUniform2f;
+        table->programUniform2f     = &glProgramUniform2fHook<Slot>;
+    }
+
+    if (table->programUniform2fv)
+    {
+        originals->programUniform2fv = table->programUniform2fv;
+        table->programUniform2fv     = &glProgramUniform2fvHook<Slot>;
+    }
+
+    if (table->programUniform2i)
+    {
+        originals->programUniform2i = table->programUniform2i;
+        table->programUniform2i     = &glProgramUniform2iHook<Slot>;
+    }
+
+    if (table->programUniform2iv)
+    {
+        originals->programUniform2iv = table->programUniform2iv;
+        table->programUniform2iv     = &glProgramUniform2ivHook<Slot>;
+    }
+
+    if (table->programUniform2ui)
+    {
+        originals->programUniform2ui = table->programUniform2ui;
+        table->programUniform2ui     = &glProgramUniform2uiHook<Slot>;
+    }
+
+    if (table->programUniform2uiv)
+    {
+        originals->programUniform2uiv = table->programUniform2uiv;
+        table->programUniform2uiv     = &glProgramUniform2uivHook<Slot>;
+    }
+
+    if (table->programUniform3d)
+    {
+        originals->programUniform3d = table->programUniform3d;
+        table->programUniform3d     = &glProgramUniform3dHook<Slot>;
+    }
+
+    if (table->programUniform3dv)
+    {
+        originals->programUniform3dv = table->programUniform3dv;
+        table->programUniform3dv     = &glProgramUniform3dvHook<Slot>;
+    }
+
+    if (table->programUniform3f)
+    {
+        originals->programUniform3f = table->programUniform3f;
+        table->programUniform3f     = &glProgramUniform3fHook<Slot>;
+    }
+
+    if (table->programUniform3fv)
+    {
+        originals->programUniform3fv = table->programUniform3fv;
+        table->programUniform3fv     = &glProgramUniform3fvHook<Slot>;
+    }
+
+    if (table->programUniform3i)
+    {
+        originals->programUniform3i = table->programUniform3i;
+        table->programUniform3i     = &glProgramUniform3iHook<Slot>;
+    }
+
+    if (table->programUniform3iv)
+    {
+        originals->programUniform3iv = table->programUniform3iv;
+        table->programUniform3iv     = &glProgramUniform3ivHook<Slot>;
+    }
+
+    if (table->programUniform3ui)
+    {
+        originals->programUniform3ui = table->programUniform3ui;
+        table->programUniform3ui     = &glProgramUniform3uiHook<Slot>;
+    }
+
+    if (table->programUniform3uiv)
+    {
+        originals->programUniform3uiv = table->programUniform3uiv;
+        table->programUniform3uiv     = &glProgramUniform3uivHook<Slot>;
+    }
+
+    if (table->programUniform4d)
+    {
+        originals->programUniform4d = table->programUniform4d;
+        table->programUniform4d     = &glProgramUniform4dHook<Slot>;
+    }
+
+    if (table->programUniform4dv)
+    {
+        originals->programUniform4dv = table->programUniform4dv;
+        table->programUniform4dv     = &glProgramUniform4dvHook<Slot>;
+    }
+
+    if (table->programUniform4f)
+    {
+        originals->programUniform4f = table->programUniform4f;
+        table->programUniform4f     = &glProgramUniform4fHook<Slot>;
+    }
+
+    if (table->programUniform4fv)
+    {
+        originals->programUniform4fv = table->programUniform4fv;
+        table->programUniform4fv     = &glProgramUniform4fvHook<Slot>;
+    }
+
+    if (table->programUniform4i)
+    {
+        originals->programUniform4i = table->programUniform4i;
+        table->programUniform4i     = &glProgramUniform4iHook<Slot>;
+    }
+
+    if (table->programUniform4iv)
+    {
+        originals->programUniform4iv = table->programUniform4iv;
+        table->programUniform4iv     = &glProgramUniform4ivHook<Slot>;
+    }
+
+    if (table->programUniform4ui)
+    {
+        originals->programUniform4ui = table->programUniform4ui;
+        table->programUniform4ui     = &glProgramUniform4uiHook<Slot>;
+    }
+
+    if (table->programUniform4uiv)
+    {
+        originals->programUniform4uiv = table->programUniform4uiv;
+        table->programUniform4uiv     = &glProgramUniform4uivHook<Slot>;
+    }
+
+    if (table->programUniformMatrix2dv)
+    {
+        originals->programUniformMatrix2dv = table->programUniformMatrix2dv;
+        table->programUniformMatrix2dv     = &glProgramUniformMatrix2dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix2fv)
+    {
+        originals->programUniformMatrix2fv = table->programUniformMatrix2fv;
+        table->programUniformMatrix2fv     = &glProgramUniformMatrix2fvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix2x3dv)
+    {
+        originals->programUniformMatrix2x3dv = table->programUniformMatrix2x3dv;
+        table->programUniformMatrix2x3dv     = &glProgramUniformMatrix2x3dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix2x3fv)
+    {
+        originals->programUniformMatrix2x3fv = table->programUniformMatrix2x3fv;
+        table->programUniformMatrix2x3fv     = &glProgramUniformMatrix2x3fvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix2x4dv)
+    {
+        originals->programUniformMatrix2x4dv = table->programUniformMatrix2x4dv;
+        table->programUniformMatrix2x4dv     = &glProgramUniformMatrix2x4dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix2x4fv)
+    {
+        originals->programUniformMatrix2x4fv = table->programUniformMatrix2x4fv;
+        table->programUniformMatrix2x4fv     = &glProgramUniformMatrix2x4fvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix3dv)
+    {
+        originals->programUniformMatrix3dv = table->programUniformMatrix3dv;
+        table->programUniformMatrix3dv     = &glProgramUniformMatrix3dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix3fv)
+    {
+        originals->programUniformMatrix3fv = table->programUniformMatrix3fv;
+        table->programUniformMatrix3fv     = &glProgramUniformMatrix3fvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix3x2dv)
+    {
+        originals->programUniformMatrix3x2dv = table->programUniformMatrix3x2dv;
+        table->programUniformMatrix3x2dv     = &glProgramUniformMatrix3x2dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix3x2fv)
+    {
+        originals->programUniformMatrix3x2fv = table->programUniformMatrix3x2fv;
+        table->programUniformMatrix3x2fv     = &glProgramUniformMatrix3x2fvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix3x4dv)
+    {
+        originals->programUniformMatrix3x4dv = table->programUniformMatrix3x4dv;
+        table->programUniformMatrix3x4dv     = &glProgramUniformMatrix3x4dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix3x4fv)
+    {
+        originals->programUniformMatrix3x4fv = table->programUniformMatrix3x4fv;
+        table->programUniformMatrix3x4fv     = &glProgramUniformMatrix3x4fvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix4dv)
+    {
+        originals->programUniformMatrix4dv = table->programUniformMatrix4dv;
+        table->programUniformMatrix4dv     = &glProgramUniformMatrix4dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix4fv)
+    {
+        originals->programUniformMatrix4fv = table->programUniformMatrix4fv;
+        table->programUniformMatrix4fv     = &glProgramUniformMatrix4fvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix4x2dv)
+    {
+        originals->programUniformMatrix4x2dv = table->programUniformMatrix4x2dv;
+        table->programUniformMatrix4x2dv     = &glProgramUniformMatrix4x2dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix4x2fv)
+    {
+        originals->programUniformMatrix4x2fv = table->programUniformMatrix4x2fv;
+        table->programUniformMatrix4x2fv     = &glProgramUniformMatrix4x2fvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix4x3dv)
+    {
+        originals->programUniformMatrix4x3dv = table->programUniformMatrix4x3dv;
+        table->programUniformMatrix4x3dv     = &glProgramUniformMatrix4x3dvHook<Slot>;
+    }
+
+    if (table->programUniformMatrix4x3fv)
+    {
+        originals->programUniformMatrix4x3fv = table->programUniformMatrix4x3fv;
+        table->programUniformMatrix4x3fv     = &glProgramUniformMatrix4x3fvHook<Slot>;
+    }
+
+    if (table->provokingVertex)
+    {
+        originals->provokingVertex = table->provokingVertex;
+        table->provokingVertex     = &glProvokingVertexHook<Slot>;
+    }
+
+    if (table->pushDebugGroup)
+    {
+        originals->pushDebugGroup = table->pushDebugGroup;
+        table->pushDebugGroup     = &glPushDebugGroupHook<Slot>;
+    }
+
+    if (table->pushGroupMarkerEXT)
+    {
+        originals->pushGroupMarkerEXT = table->pushGroupMarkerEXT;
+        table->pushGroupMarkerEXT     = &glPushGroupMarkerEXTHook<Slot>;
+    }
+
+    if (table->queryCounter)
+    {
+        originals->queryCounter = table->queryCounter;
+        table->queryCounter     = &glQueryCounterHook<Slot>;
+    }
+
+    if (table->readBuffer)
+    {
+        originals->readBuffer = table->readBuffer;
+        table->readBuffer     = &glReadBufferHook<Slot>;
+    }
+
+    if (table->readPixels)
+    {
+        originals->readPixels = table->readPixels;
+        table->readPixels     = &glReadPixelsHook<Slot>;
+    }
+
+    if (table->readnPixels)
+    {
+        originals->readnPixels = table->readnPixels;
+        table->readnPixels     = &glReadnPixelsHook<Slot>;
+    }
+
+    if (table->releaseShaderCompiler)
+    {
+        originals->releaseShaderCompiler = table->releaseShaderCompiler;
+        table->releaseShaderCompiler     = &glReleaseShaderCompilerHook<Slot>;
+    }
+
+    if (table->renderbufferStorage)
+    {
+        originals->renderbufferStorage = table->renderbufferStorage;
+        table->renderbufferStorage     = &glRenderbufferStorageHook<Slot>;
+    }
+
+    if (table->renderbufferStorageMultisample)
+    {
+        originals->renderbufferStorageMultisample = table->renderbufferStorageMultisample;
+        table->renderbufferStorageMultisample     = &glRenderbufferStorageMultisampleHook<Slot>;
+    }
+
+    if (table->resumeTransformFeedback)
+    {
+        originals->resumeTransformFeedback = table->resumeTransformFeedback;
+        table->resumeTransformFeedback     = &glResumeTransformFeedbackHook<Slot>;
+    }
+
+    if (table->sampleCoverage)
+    {
+        originals->sampleCoverage = table->sampleCoverage;
+        table->sampleCoverage     = &glSampleCoverageHook<Slot>;
+    }
+
+    if (table->sampleMaski)
+    {
+        originals->sampleMaski = table->sampleMaski;
+        table->sampleMaski     = &glSampleMaskiHook<Slot>;
+    }
+
+    if (table->samplerParameterIiv)
+    {
+        originals->samplerParameterIiv = table->samplerParameterIiv;
+        table->samplerParameterIiv     = &glSamplerParameterIivHook<Slot>;
+    }
+
+    if (table->samplerParameterIuiv)
+    {
+        originals->samplerParameterIuiv = table->samplerParameterIuiv;
+        table->samplerParameterIuiv     = &glSamplerParameterIuivHook<Slot>;
+    }
+
+    if (table->samplerParameterf)
+    {
+        originals->samplerParameterf = table->samplerParameterf;
+        table->samplerParameterf     = &glSamplerParameterfHook<Slot>;
+    }
+
+    if (table->samplerParameterfv)
+    {
+        originals->samplerParameterfv = table->samplerParameterfv;
+        table->samplerParameterfv     = &glSamplerParameterfvHook<Slot>;
+    }
+
+    if (table->samplerParameteri)
+    {
+        originals->samplerParameteri = table->samplerParameteri;
+        table->samplerParameteri     = &glSamplerParameteriHook<Slot>;
+    }
+
+    if (table->samplerParameteriv)
+    {
+        originals->samplerParameteriv = table->samplerParameteriv;
+        table->samplerParameteriv     = &glSamplerParameterivHook<Slot>;
+    }
+
+    if (table->scissor)
+    {
+        originals->scissor = table->scissor;
+        table->scissor     = &glScissorHook<Slot>;
+    }
+
+    if (table->scissorArrayv)
+    {
+        originals->scissorArrayv = table->scissorArrayv;
+        table->scissorArrayv     = &glScissorArrayvHook<Slot>;
+    }
+
+    if (table->scissorIndexed)
+    {
+        originals->scissorIndexed = table->scissorIndexed;
+        table->scissorIndexed     = &glScissorIndexedHook<Slot>;
+    }
+
+    if (table->scissorIndexedv)
+    {
+        originals->scissorIndexedv = table->scissorIndexedv;
+        table->scissorIndexedv     = &glScissorIndexedvHook<Slot>;
+    }
+
+    if (table->setFenceNV)
+    {
+        originals->setFenceNV = table->setFenceNV;
+        table->setFenceNV     = &glSetFenceNVHook<Slot>;
+    }
+
+    if (table->shaderBinary)
+    {
+        originals->shaderBinary = table->shaderBinary;
+        table->shaderBinary     = &glShaderBinaryHook<Slot>;
+    }
+
+    if (table->shaderSource)
+    {
+        originals->shaderSource = table->shaderSource;
+        table->shaderSource     = &glShaderSourceHook<Slot>;
+    }
+
+    if (table->shaderStorageBlockBinding)
+    {
+        originals->shaderStorageBlockBinding = table->shaderStorageBlockBinding;
+        table->shaderStorageBlockBinding     = &glShaderStorageBlockBindingHook<Slot>;
+    }
+
+    if (table->stencilFillPathInstancedNV)
+    {
+        originals->stencilFillPathInstancedNV = table->stencilFillPathInstancedNV;
+        table->stencilFillPathInstancedNV     = &glStencilFillPathInstancedNVHook<Slot>;
+    }
+
+    if (table->stencilFillPathNV)
+    {
+        originals->stencilFillPathNV = table->stencilFillPathNV;
+        table->stencilFillPathNV     = &glStencilFillPathNVHook<Slot>;
+    }
+
+    if (table->stencilFunc)
+    {
+        originals->stencilFunc = table->stencilFunc;
+        table->stencilFunc     = &glStencilFuncHook<Slot>;
+    }
+
+    if (table->stencilFuncSeparate)
+    {
+        originals->stencilFuncSeparate = table->stencilFuncSeparate;
+        table->stencilFuncSeparate     = &glStencilFuncSeparateHook<Slot>;
+    }
+
+    if (table->stencilMask)
+    {
+        originals->stencilMask = table->stencilMask;
+        table->stencilMask     = &glStencilMaskHook<Slot>;
+    }
+
+    if (table->stencilMaskSeparate)
+    {
+        originals->stencilMaskSeparate = table->stencilMaskSeparate;
+        table->stencilMaskSeparate     = &glStencilMaskSeparateHook<Slot>;
+    }
+
+    if (table->stencilOp)
+    {
+        originals->stencilOp = table->stencilOp;
+        table->stencilOp     = &glStencilOpHook<Slot>;
+    }
+
+    if (table->stencilOpSeparate)
+    {
+        originals->stencilOpSeparate = table->stencilOpSeparate;
+        table->stencilOpSeparate     = &glStencilOpSeparateHook<Slot>;
+    }
+
+    if (table->stencilStrokePathInstancedNV)
+    {
+        originals->stencilStrokePathInstancedNV = table->stencilStrokePathInstancedNV;
+        table->stencilStrokePathInstancedNV     = &glStencilStrokePathInstancedNVHook<Slot>;
+    }
+
+    if (table->stencilStrokePathNV)
+    {
+        originals->stencilStrokePathNV = table->stencilStrokePathNV;
+        table->stencilStrokePathNV     = &glStencilStrokePathNVHook<Slot>;
+    }
+
+    if (table->stencilThenCoverFillPathInstancedNV)
+    {
+        originals->stencilThenCoverFillPathInstancedNV =
+            table->stencilThenCoverFillPathInstancedNV;
+        table->stencilThenCoverFillPathInstancedNV =
+            &glStencilThenCoverFillPathInstancedNVHook<Slot>;
+    }
+
+    if (table->stencilThenCoverFillPathNV)
+    {
+        originals->stencilThenCoverFillPathNV = table->stencilThenCoverFillPathNV;
+        table->stencilThenCoverFillPathNV     = &glStencilThenCoverFillPathNVHook<Slot>;
+    }
+
+    if (table->stencilThenCoverStrokePathInstancedNV)
+    {
+        originals->stencilThenCoverStrokePathInstancedNV =
+            table->stencilThenCoverStrokePathInstancedNV;
+        table->stencilThenCoverStrokePathInstancedNV =
+            &glStencilThenCoverStrokePathInstancedNVHook<Slot>;
+    }
+
+    if (table->stencilThenCoverStrokePathNV)
+    {
+        originals->stencilThenCoverStrokePathNV = table->stencilThenCoverStrokePathNV;
+        table->stencilThenCoverStrokePathNV     = &glStencilThenCoverStrokePathNVHook<Slot>;
+    }
+
+    if (table->testFenceNV)
+    {
+        originals->testFenceNV = table->testFenceNV;
+        table->testFenceNV     = &glTestFenceNVHook<Slot>;
+    }
+
+    if (table->texBuffer)
+    {
+        originals->texBuffer = table->texBuffer;
+        table->texBuffer     = &glTexBufferHook<Slot>;
+    }
+
+    if (table->texBufferRange)
+    {
+        originals->texBufferRange = table->texBufferRange;
+        table->texBufferRange     = &glTexBufferRangeHook<Slot>;
+    }
+
+    if (table->texImage1D)
+    {
+        originals->texImage1D = table->texImage1D;
+        table->texImage1D     = &glTexImage1DHook<Slot>;
+    }
+
+    if (table->texImage2D)
+    {
+        originals->texImage2D = table->texImage2D;
+        table->texImage2D     = &glTexImage2DHook<Slot>;
+    }
+
+    if (table->texImage2DMultisample)
+    {
+        originals->texImage2DMultisample = table->texImage2DMultisample;
+        table->texImage2DMultisample     = &glTexImage2DMultisampleHook<Slot>;
+    }
+
+    if (table->texImage3D)
+    {
+        originals->texImage3D = table->texImage3D;
+        table->texImage3D     = &glTexImage3DHook<Slot>;
+    }
+
+    if (table->texImage3DMultisample)
+    {
+        originals->texImage3DMultisample = table->texImage3DMultisample;
+        table->texImage3DMultisample     = &glTexImage3DMultisampleHook<Slot>;
+    }
+
+    if (table->texParameterIiv)
+    {
+        originals->texParameterIiv = table->texParameterIiv;
+        table->texParameterIiv     = &glTexParameterIivHook<Slot>;
+    }
+
+    if (table->texParameterIuiv)
+    {
+        originals->texParameterIuiv = table->texParameterIuiv;
+        table->texParameterIuiv     = &glTexParameterIuivHook<Slot>;
+    }
+
+    if (table->texParameterf)
+    {
+        originals->texParameterf = table->texParameterf;
+        table->texParameterf     = &glTexParameterfHook<Slot>;
+    }
+
+    if (table->texParameterfv)
+    {
+        originals->texParameterfv = table->texParameterfv;
+        table->texParameterfv     = &glTexParameterfvHook<Slot>;
+    }
+
+    if (table->texParameteri)
+    {
+        originals->texParameteri = table->texParameteri;
+        table->texParameteri     = &glTexParameteriHook<Slot>;
+    }
+
+    if (table->texParameteriv)
+    {
+        originals->texParameteriv = table->texParameteriv;
+        table->texParameteriv     = &glTexParameterivHook<Slot>;
+    }
+
+    if (table->texStorage1D)
+    {
+        originals->texStorage1D = table->texStorage1D;
+        table->texStorage1D     = &glTexStorage1DHook<Slot>;
+    }
+
+    if (table->texStorage2D)
+    {
+        originals->texStorage2D = table->texStorage2D;
+        table->texStorage2D     = &glTexStorage2DHook<Slot>;
+    }
+
+    if (table->texStorage2DMultisample)
+    {
+        originals->texStorage2DMultisample = table->texStorage2DMultisample;
+        table->texStorage2DMultisample     = &glTexStorage2DMultisampleHook<Slot>;
+    }
+
+    if (table->texStorage3D)
+    {
+        originals->texStorage3D = table->texStorage3D;
+        table->texStorage3D     = &glTexStorage3DHook<Slot>;
+    }
+
+    if (table->texStorage3DMultisample)
+    {
+        originals->texStorage3DMultisample = table->texStorage3DMultisample;
+        table->texStorage3DMultisample     = &glTexStorage3DMultisampleHook<Slot>;
+    }
+
+    if (table->texSubImage1D)
+    {
+        originals->texSubImage1D = table->texSubImage1D;
+        table->texSubImage1D     = &glTexSubImage1DHook<Slot>;
+    }
+
+    if (table->texSubImage2D)
+    {
+        originals->texSubImage2D = table->texSubImage2D;
+        table->texSubImage2D     = &glTexSubImage2DHook<Slot>;
+    }
+
+    if (table->texSubImage3D)
+    {
+        originals->texSubImage3D = table->texSubImage3D;
+        table->texSubImage3D     = &glTexSubImage3DHook<Slot>;
+    }
+
+    if (table->textureBarrier)
+    {
+        originals->textureBarrier = table->textureBarrier;
+        table->textureBarrier     = &glTextureBarrierHook<Slot>;
+    }
+
+    if (table->textureBuffer)
+    {
+        originals->textureBuffer = table->textureBuffer;
+        table->textureBuffer     = &glTextureBufferHook<Slot>;
+    }
+
+    if (table->textureBufferRange)
+    {
+        originals->textureBufferRange = table->textureBufferRange;
+        table->textureBufferRange     = &glTextureBufferRangeHook<Slot>;
+    }
+
+    if (table->textureParameterIiv)
+    {
+        originals->textureParameterIiv = table->textureParameterIiv;
+        table->textureParameterIiv     = &glTextureParameterIivHook<Slot>;
+    }
+
+    if (table->textureParameterIuiv)
+    {
+        originals->textureParameterIuiv = table->textureParameterIuiv;
+        table->textureParameterIuiv     = &glTextureParameterIuivHook<Slot>;
+    }
+
+    if (table->textureParameterf)
+    {
+        originals->textureParameterf = table->textureParameterf;
+        table->textureParameterf     = &glTextureParameterfHook<Slot>;
+    }
+
+    if (table->textureParameterfv)
+    {
+        originals->textureParameterfv = table->textureParameterfv;
+        table->textureParameterfv     = &glTextureParameterfvHook<Slot>;
+    }
+
+    if (table->textureParameteri)
+    {
+        originals->textureParameteri = table->textureParameteri;
+        table->textureParameteri     = &glTextureParameteriHook<Slot>;
+    }
+
+    if (table->textureParameteriv)
+    {
+        originals->textureParameteriv = table->textureParameteriv;
+        table->textureParameteriv     = &glTextureParameterivHook<Slot>;
+    }
+
+    if (table->textureStorage1D)
+    {
+        originals->textureStorage1D = table->textureStorage1D;
+        table->textureStorage1D     = &glTextureStorage1DHook<Slot>;
+    }
+
+    if (table->textureStorage2D)
+    {
+        originals->textureStorage2D = table->textureStorage2D;
+        table->textureStorage2D     = &glTextureStorage2DHook<Slot>;
+    }
+
+    if (table->textureStorage2DMultisample)
+    {
+        originals->textureStorage2DMultisample = table->textureStorage2DMultisample;
+        table->textureStorage2DMultisample     = &glTextureStorage2DMultisampleHook<Slot>;
+    }
+
+    if (table->textureStorage3D)
+    {
+        originals->textureStorage3D = table->textureStorage3D;
+        table->textureStorage3D     = &glTextureStorage3DHook<Slot>;
+    }
+
+    if (table->textureStorage3DMultisample)
+    {
+        originals->textureStorage3DMultisample = table->textureStorage3DMultisample;
+        table->textureStorage3DMultisample     = &glTextureStorage3DMultisampleHook<Slot>;
+    }
+
+    if (table->textureSubImage1D)
+    {
+        originals->textureSubImage1D = table->textureSubImage1D;
+        table->textureSubImage1D     = &glTextureSubImage1DHook<Slot>;
+    }
+
+    if (table->textureSubImage2D)
+    {
+        originals->textureSubImage2D = table->textureSubImage2D;
+        table->textureSubImage2D     = &glTextureSubImage2DHook<Slot>;
+    }
+
+    if (table->textureSubImage3D)
+    {
+        originals->textureSubImage3D = table->textureSubImage3D;
+        table->textureSubImage3D     = &glTextureSubImage3DHook<Slot>;
+    }
+
+    if (table->textureView)
+    {
+        originals->textureView = table->textureView;
+        table->textureView     = &glTextureViewHook<Slot>;
+    }
+
+    if (table->transformFeedbackBufferBase)
+    {
+        originals->transformFeedbackBufferBase = table->transformFeedbackBufferBase;
+        table->transformFeedbackBufferBase     = &glTransformFeedbackBufferBaseHook<Slot>;
+    }
+
+    if (table->transformFeedbackBufferRange)
+    {
+        originals->transformFeedbackBufferRange = table->transformFeedbackBufferRange;
+        table->transformFeedbackBufferRange     = &glTransformFeedbackBufferRangeHook<Slot>;
+    }
+
+    if (table->transformFeedbackVaryings)
+    {
+        originals->transformFeedbackVaryings = table->transformFeedbackVaryings;
+        table->transformFeedbackVaryings     = &glTransformFeedbackVaryingsHook<Slot>;
+    }
+
+    if (table->uniform1d)
+    {
+        originals->uniform1d = table->uniform1d;
+        table->uniform1d     = &glUniform1dHook<Slot>;
+    }
+
+    if (table->uniform1dv)
+    {
+        originals->uniform1dv = table->uniform1dv;
+        table->uniform1dv     = &glUniform1dvHook<Slot>;
+    }
+
+    if (table->uniform1f)
+    {
+        originals->uniform1f = table->uniform1f;
+        table->uniform1f     = &glUniform1fHook<Slot>;
+    }
+
+    if (table->uniform1fv)
+    {
+        originals->uniform1fv = table->uniform1fv;
+        table->uniform1fv     = &glUniform1fvHook<Slot>;
+    }
+
+    if (table->uniform1i)
+    {
+        originals->uniform1i = table->uniform1i;
+        table->uniform1i     = &glUniform1iHook<Slot>;
+    }
+
+    if (table->uniform1iv)
+    {
+        originals->uniform1iv = table->uniform1iv;
+        table->uniform1iv     = &glUniform1ivHook<Slot>;
+    }
+
+    if (table->uniform1ui)
+    {
+        originals->uniform1ui = table->uniform1ui;
+        table->uniform1ui     = &glUniform1uiHook<Slot>;
+    }
+
+    if (table->uniform1uiv)
+    {
+        originals->uniform1uiv = table->uniform1uiv;
+        table->uniform1uiv     = &glUniform1uivHook<Slot>;
+    }
+
+    if (table->uniform2d)
+    {
+        originals->uniform2d = table->uniform2d;
+        table->uniform2d     = &glUniform2dHook<Slot>;
+    }
+
+    if (table->uniform2dv)
+    {
+        originals->uniform2dv = table->uniform2dv;
+        table->uniform2dv     = &glUniform2dvHook<Slot>;
+    }
+
+    if (table->uniform2f)
+    {
+        originals->uniform2f = table->uniform2f;
+        table->uniform2f     = &glUniform2fHook<Slot>;
+    }
+
+    if (table->uniform2fv)
+    {
+        originals->uniform2fv = table->uniform2fv;
+        table->uniform2fv     = &glUniform2fvHook<Slot>;
+    }
+
+    if (table->uniform2i)
+    {
+        originals->uniform2i = table->uniform2i;
+        table->uniform2i     = &glUniform2iHook<Slot>;
+    }
+
+    if (table->uniform2iv)
+    {
+        originals->uniform2iv = table->uniform2iv;
+        table->uniform2iv     = &glUniform2ivHook<Slot>;
+    }
+
+    if (table->uniform2ui)
+    {
+        originals->uniform2ui = table->uniform2ui;
+        table->uniform2ui     = &glUniform2uiHook<Slot>;
+    }
+
+    if (table->uniform2uiv)
+    {
+        originals->uniform2uiv = table->uniform2uiv;
+        table->uniform2uiv     = &glUniform2uivHook<Slot>;
+    }
+
+    if (table->uniform3d)
+    {
+        originals->uniform3d = table->uniform3d;
+        table->uniform3d     = &glUniform3dHook<Slot>;
+    }
+
+    if (table->uniform3dv)
+    {
+        originals->uniform3dv = table->uniform3dv;
+        table->uniform3dv     = &glUniform3dvHook<Slot>;
+    }
+
+    if (table->uniform3f)
+    {
+        originals->uniform3f = table->uniform3f;
+        table->uniform3f     = &glUniform3fHook<Slot>;
+    }
+
+    if (table->uniform3fv)
+    {
+        originals->uniform3fv = table->uniform3fv;
+        table->uniform3fv     = &glUniform3fvHook<Slot>;
+    }
+
+    if (table->uniform3i)
+    {
+        originals->uniform3i = table->uniform3i;
+        table->uniform3i     = &glUniform3iHook<Slot>;
+    }
+
+    if (table->uniform3iv)
+    {
+        originals->uniform3iv = table->uniform3iv;
+        table->uniform3iv     = &glUniform3ivHook<Slot>;
+    }
+
+    if (table->uniform3ui)
+    {
+        originals->uniform3ui = table->uniform3ui;
+        table->uniform3ui     = &glUniform3uiHook<Slot>;
+    }
+
+    if (table->uniform3uiv)
+    {
+        originals->uniform3uiv = table->uniform3uiv;
+        table->uniform3uiv     = &glUniform3uivHook<Slot>;
+    }
+
+    if (table->uniform4d)
+    {
+        originals->uniform4d = table->uniform4d;
+        table->uniform4d     = &glUniform4dHook<Slot>;
+    }
+
+    if (table->uniform4dv)
+    {
+        originals->uniform4dv = table->uniform4dv;
+        table->uniform4dv     = &glUniform4dvHook<Slot>;
+    }
+
+    if (table->uniform4f)
+    {
+        originals->uniform4f = table->uniform4f;
+        table->uniform4f     = &glUniform4fHook<Slot>;
+    }
+
+    if (table->uniform4fv)
+    {
+        originals->uniform4fv = table->uniform4fv;
+        table->uniform4fv     = &glUniform4fvHook<Slot>;
+    }
+
+    if (table->uniform4i)
+    {
+        originals->uniform4i = table->uniform4i;
+        table->uniform4i     = &glUniform4iHook<Slot>;
+    }
+
+    if (table->uniform4iv)
+    {
+        originals->uniform4iv = table->uniform4iv;
+        table->uniform4iv     = &glUniform4ivHook<Slot>;
+    }
+
+    if (table->uniform4ui)
+    {
+        originals->uniform4ui = table->uniform4ui;
+        table->uniform4ui     = &glUniform4uiHook<Slot>;
+    }
+
+    if (table->uniform4uiv)
+    {
+        originals->uniform4uiv = table->uniform4uiv;
+        table->uniform4uiv     = &glUniform4uivHook<Slot>;
+    }
+
+    if (table->uniformBlockBinding)
+    {
+        originals->uniformBlockBinding = table->uniformBlockBinding;
+        table->uniformBlockBinding     = &glUniformBlockBindingHook<Slot>;
+    }
+
+    if (table->uniformMatrix2dv)
+    {
+        originals->uniformMatrix2dv = table->uniformMatrix2dv;
+        table->uniformMatrix2dv     = &glUniformMatrix2dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix2fv)
+    {
+        originals->uniformMatrix2fv = table->uniformMatrix2fv;
+        table->uniformMatrix2fv     = &glUniformMatrix2fvHook<Slot>;
+    }
+
+    if (table->uniformMatrix2x3dv)
+    {
+        originals->uniformMatrix2x3dv = table->uniformMatrix2x3dv;
+        table->uniformMatrix2x3dv     = &glUniformMatrix2x3dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix2x3fv)
+    {
+        originals->uniformMatrix2x3fv = table->uniformMatrix2x3fv;
+        table->uniformMatrix2x3fv     = &glUniformMatrix2x3fvHook<Slot>;
+    }
+
+    if (table->uniformMatrix2x4dv)
+    {
+        originals->uniformMatrix2x4dv = table->uniformMatrix2x4dv;
+        table->uniformMatrix2x4dv     = &glUniformMatrix2x4dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix2x4fv)
+    {
+        originals->uniformMatrix2x4fv = table->uniformMatrix2x4fv;
+        table->uniformMatrix2x4fv     = &glUniformMatrix2x4fvHook<Slot>;
+    }
+
+    if (table->uniformMatrix3dv)
+    {
+        originals->uniformMatrix3dv = table->uniformMatrix3dv;
+        table->uniformMatrix3dv     = &glUniformMatrix3dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix3fv)
+    {
+        originals->uniformMatrix3fv = table->uniformMatrix3fv;
+        table->uniformMatrix3fv     = &glUniformMatrix3fvHook<Slot>;
+    }
+
+    if (table->uniformMatrix3x2dv)
+    {
+        originals->uniformMatrix3x2dv = table->uniformMatrix3x2dv;
+        table->uniformMatrix3x2dv     = &glUniformMatrix3x2dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix3x2fv)
+    {
+        originals->uniformMatrix3x2fv = table->uniformMatrix3x2fv;
+        table->uniformMatrix3x2fv     = &glUniformMatrix3x2fvHook<Slot>;
+    }
+
+    if (table->uniformMatrix3x4dv)
+    {
+        originals->uniformMatrix3x4dv = table->uniformMatrix3x4dv;
+        table->uniformMatrix3x4dv     = &glUniformMatrix3x4dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix3x4fv)
+    {
+        originals->uniformMatrix3x4fv = table->uniformMatrix3x4fv;
+        table->uniformMatrix3x4fv     = &glUniformMatrix3x4fvHook<Slot>;
+    }
+
+    if (table->uniformMatrix4dv)
+    {
+        originals->uniformMatrix4dv = table->uniformMatrix4dv;
+        table->uniformMatrix4dv     = &glUniformMatrix4dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix4fv)
+    {
+        originals->uniformMatrix4fv = table->uniformMatrix4fv;
+        table->uniformMatrix4fv     = &glUniformMatrix4fvHook<Slot>;
+    }
+
+    if (table->uniformMatrix4x2dv)
+    {
+        originals->uniformMatrix4x2dv = table->uniformMatrix4x2dv;
+        table->uniformMatrix4x2dv     = &glUniformMatrix4x2dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix4x2fv)
+    {
+        originals->uniformMatrix4x2fv = table->uniformMatrix4x2fv;
+        table->uniformMatrix4x2fv     = &glUniformMatrix4x2fvHook<Slot>;
+    }
+
+    if (table->uniformMatrix4x3dv)
+    {
+        originals->uniformMatrix4x3dv = table->uniformMatrix4x3dv;
+        table->uniformMatrix4x3dv     = &glUniformMatrix4x3dvHook<Slot>;
+    }
+
+    if (table->uniformMatrix4x3fv)
+    {
+        originals->uniformMatrix4x3fv = table->uniformMatrix4x3fv;
+        table->uniformMatrix4x3fv     = &glUniformMatrix4x3fvHook<Slot>;
+    }
+
+    if (table->uniformSubroutinesuiv)
+    {
+        originals->uniformSubroutinesuiv = table->uniformSubroutinesuiv;
+        table->uniformSubroutinesuiv     = &glUniformSubroutinesuivHook<Slot>;
+    }
+
+    if (table->unmapBuffer)
+    {
+        originals->unmapBuffer = table->unmapBuffer;
+        table->unmapBuffer     = &glUnmapBufferHook<Slot>;
+    }
+
+    if (table->unmapNamedBuffer)
+    {
+        originals->unmapNamedBuffer = table->unmapNamedBuffer;
+        table->unmapNamedBuffer     = &glUnmapNamedBufferHook<Slot>;
+    }
+
+    if (table->useProgram)
+    {
+        originals->useProgram = table->useProgram;
+        table->useProgram     = &glUseProgramHook<Slot>;
+    }
+
+    if (table->useProgramStages)
+    {
+        originals->useProgramStages = table->useProgramStages;
+        table->useProgramStages     = &glUseProgramStagesHook<Slot>;
+    }
+
+    if (table->validateProgram)
+    {
+        originals->validateProgram = table->validateProgram;
+        table->validateProgram     = &glValidateProgramHook<Slot>;
+    }
+
+    if (table->validateProgramPipeline)
+    {
+        originals->validateProgramPipeline = table->validateProgramPipeline;
+        table->validateProgramPipeline     = &glValidateProgramPipelineHook<Slot>;
+    }
+
+    if (table->vertexArrayAttribBinding)
+    {
+        originals->vertexArrayAttribBinding = table->vertexArrayAttribBinding;
+        table->vertexArrayAttribBinding     = &glVertexArrayAttribBindingHook<Slot>;
+    }
+
+    if (table->vertexArrayAttribFormat)
+    {
+        originals->vertexArrayAttribFormat = table->vertexArrayAttribFormat;
+        table->vertexArrayAttribFormat     = &glVertexArrayAttribFormatHook<Slot>;
+    }
+
+    if (table->vertexArrayAttribIFormat)
+    {
+        originals->vertexArrayAttribIFormat = table->vertexArrayAttribIFormat;
+        table->vertexArrayAttribIFormat     = &glVertexArrayAttribIFormatHook<Slot>;
+    }
+
+    if (table->vertexArrayAttribLFormat)
+    {
+        originals->vertexArrayAttribLFormat = table->vertexArrayAttribLFormat;
+        table->vertexArrayAttribLFormat     = &glVertexArrayAttribLFormatHook<Slot>;
+    }
+
+    if (table->vertexArrayBindingDivisor)
+    {
+        originals->vertexArrayBindingDivisor = table->vertexArrayBindingDivisor;
+        table->vertexArrayBindingDivisor     = &glVertexArrayBindingDivisorHook<Slot>;
+    }
+
+    if (table->vertexArrayElementBuffer)
+    {
+        originals->vertexArrayElementBuffer = table->vertexArrayElementBuffer;
+        table->vertexArrayElementBuffer     = &glVertexArrayElementBufferHook<Slot>;
+    }
+
+    if (table->vertexArrayVertexBuffer)
+    {
+        originals->vertexArrayVertexBuffer = table->vertexArrayVertexBuffer;
+        table->vertexArrayVertexBuffer     = &glVertexArrayVertexBufferHook<Slot>;
+    }
+
+    if (table->vertexArrayVertexBuffers)
+    {
+        originals->vertexArrayVertexBuffers = table->vertexArrayVertexBuffers;
+        table->vertexArrayVertexBuffers     = &glVertexArrayVertexBuffersHook<Slot>;
+    }
+
+    if (table->vertexAttrib1d)
+    {
+        originals->vertexAttrib1d = table->vertexAttrib1d;
+        table->vertexAttrib1d     = &glVertexAttrib1dHook<Slot>;
+    }
+
+    if (table->vertexAttrib1dv)
+    {
+        originals->vertexAttrib1dv = table->vertexAttrib1dv;
+        table->vertexAttrib1dv     = &glVertexAttrib1dvHook<Slot>;
+    }
+
+    if (table->vertexAttrib1f)
+    {
+        originals->vertexAttrib1f = table->vertexAttrib1f;
+        table->vertexAttrib1f     = &glVertexAttrib1fHook<Slot>;
+    }
+
+    if (table->vertexAttrib1fv)
+    {
+        originals->vertexAttrib1fv = table->vertexAttrib1fv;
+        table->vertexAttrib1fv     = &glVertexAttrib1fvHook<Slot>;
+    }
+
+    if (table->vertexAttrib1s)
+    {
+        originals->vertexAttrib1s = table->vertexAttrib1s;
+        table->vertexAttrib1s     = &glVertexAttrib1sHook<Slot>;
+    }
+
+    if (table->vertexAttrib1sv)
+    {
+        originals->vertexAttrib1sv = table->vertexAttrib1sv;
+        table->vertexAttrib1sv     = &glVertexAttrib1svHook<Slot>;
+    }
+
+    if (table->vertexAttrib2d)
+    {
+        originals->vertexAttrib2d = table->vertexAttrib2d;
+        table->vertexAttrib2d     = &glVertexAttrib2dHook<Slot>;
+    }
+
+    if (table->vertexAttrib2dv)
+    {
+        originals->vertexAttrib2dv = table->vertexAttrib2dv;
+        table->vertexAttrib2dv     = &glVertexAttrib2dvHook<Slot>;
+    }
+
+    if (table->vertexAttrib2f)
+    {
+        originals->vertexAttrib2f = table->vertexAttrib2f;
+        table->vertexAttrib2f     = &glVertexAttrib2fHook<Slot>;
+    }
+
+    if (table->vertexAttrib2fv)
+    {
+        originals->vertexAttrib2fv = table->vertexAttrib2fv;
+        table->vertexAttrib2fv     = &glVertexAttrib2fvHook<Slot>;
+    }
+
+    if (table->vertexAttrib2s)
+    {
+        originals->vertexAttrib2s = table->vertexAttrib2s;
+        table->vertexAttrib2s     = &glVertexAttrib2sHook<Slot>;
+    }
+
+    if (table->vertexAttrib2sv)
+    {
+        originals->vertexAttrib2sv = table->vertexAttrib2sv;
+        table->vertexAttrib2sv     = &glVertexAttrib2svHook<Slot>;
+    }
+
+    if (table->vertexAttrib3d)
+    {
+        originals->vertexAttrib3d = table->vertexAttrib3d;
+        table->vertexAttrib3d     = &glVertexAttrib3dHook<Slot>;
+    }
+
+    if (table->vertexAttrib3dv)
+    {
+        originals->vertexAttrib3dv = table->vertexAttrib3dv;
+        table->vertexAttrib3dv     = &glVertexAttrib3dvHook<Slot>;
+    }
+
+    if (table->vertexAttrib3f)
+    {
+        originals->vertexAttrib3f = table->vertexAttrib3f;
+        table->vertexAttrib3f     = &glVertexAttrib3fHook<Slot>;
+    }
+
+    if (table->vertexAttrib3fv)
+    {
+        originals->vertexAttrib3fv = table->vertexAttrib3fv;
+        table->vertexAttrib3fv     = &glVertexAttrib3fvHook<Slot>;
+    }
+
+    if (table->vertexAttrib3s)
+    {
+        originals->vertexAttrib3s = table->vertexAttrib3s;
+        table->vertexAttrib3s     = &glVertexAttrib3sHook<Slot>;
+    }
+
+    if (table->vertexAttrib3sv)
+    {
+        originals->vertexAttrib3sv = table->vertexAttrib3sv;
+        table->vertexAttrib3sv     = &glVertexAttrib3svHook<Slot>;
+    }
+
+    if (table->vertexAttrib4Nbv)
+    {
+        originals->vertexAttrib4Nbv = table->vertexAttrib4Nbv;
+        table->vertexAttrib4Nbv     = &glVertexAttrib4NbvHook<Slot>;
+    }
+
+    if (table->vertexAttrib4Niv)
+    {
+        originals->vertexAttrib4Niv = table->vertexAttrib4Niv;
+        table->vertexAttrib4Niv     = &glVertexAttrib4NivHook<Slot>;
+    }
+
+    if (table->vertexAttrib4Nsv)
+    {
+        originals->vertexAttrib4Nsv = table->vertexAttrib4Nsv;
+        table->vertexAttrib4Nsv     = &glVertexAttrib4NsvHook<Slot>;
+    }
+
+    if (table->vertexAttrib4Nub)
+    {
+        originals->vertexAttrib4Nub = table->vertexAttrib4Nub;
+        table->vertexAttrib4Nub     = &glVertexAttrib4NubHook<Slot>;
+    }
+
+    if (table->vertexAttrib4Nubv)
+    {
+        originals->vertexAttrib4Nubv = table->vertexAttrib4Nubv;
+        table->vertexAttrib4Nubv     = &glVertexAttrib4NubvHook<Slot>;
+    }
+
+    if (table->vertexAttrib4Nuiv)
+    {
+        originals->vertexAttrib4Nuiv = table->vertexAttrib4Nuiv;
+        table->vertexAttrib4Nuiv     = &glVertexAttrib4NuivHook<Slot>;
+    }
+
+    if (table->vertexAttrib4Nusv)
+    {
+        originals->vertexAttrib4Nusv = table->vertexAttrib4Nusv;
+        table->vertexAttrib4Nusv     = &glVertexAttrib4NusvHook<Slot>;
+    }
+
+    if (table->vertexAttrib4bv)
+    {
+        originals->vertexAttrib4bv = table->vertexAttrib4bv;
+        table->vertexAttrib4bv     = &glVertexAttrib4bvHook<Slot>;
+    }
+
+    if (table->vertexAttrib4d)
+    {
+        originals->vertexAttrib4d = table->vertexAttrib4d;
+        table->vertexAttrib4d     = &glVertexAttrib4dHook<Slot>;
+    }
+
+    if (table->vertexAttrib4dv)
+    {
+        originals->vertexAttrib4dv = table->vertexAttrib4dv;
+        table->vertexAttrib4dv     = &glVertexAttrib4dvHook<Slot>;
+    }
+
+    if (table->vertexAttrib4f)
+    {
+        originals->vertexAttrib4f = table->vertexAttrib4f;
+        table->vertexAttrib4f     = &glVertexAttrib4fHook<Slot>;
+    }
+
+    if (table->vertexAttrib4fv)
+    {
+        originals->vertexAttrib4fv = table->vertexAttrib4fv;
+        table->vertexAttrib4fv     = &glVertexAttrib4fvHook<Slot>;
+    }
+
+    if (table->vertexAttrib4iv)
+    {
+        originals->vertexAttrib4iv = table->vertexAttrib4iv;
+        table->vertexAttrib4iv     = &glVertexAttrib4ivHook<Slot>;
+    }
+
+    if (table->vertexAttrib4s)
+    {
+        originals->vertexAttrib4s = table->vertexAttrib4s;
+        table->vertexAttrib4s     = &glVertexAttrib4sHook<Slot>;
+    }
+
+    if (table->vertexAttrib4sv)
+    {
+        originals->vertexAttrib4sv = table->vertexAttrib4sv;
+        table->vertexAttrib4sv     = &glVertexAttrib4svHook<Slot>;
+    }
+
+    if (table->vertexAttrib4ubv)
+    {
+        originals->vertexAttrib4ubv = table->vertexAttrib4ubv;
+        table->vertexAttrib4ubv     = &glVertexAttrib4ubvHook<Slot>;
+    }
+
+    if (table->vertexAttrib4uiv)
+    {
+        originals->vertexAttrib4uiv = table->vertexAttrib4uiv;
+        table->vertexAttrib4uiv     = &glVertexAttrib4uivHook<Slot>;
+    }
+
+    if (table->vertexAttrib4usv)
+    {
+        originals->vertexAttrib4usv = table->vertexAttrib4usv;
+        table->vertexAttrib4usv     = &glVertexAttrib4usvHook<Slot>;
+    }
+
+    if (table->vertexAttribBinding)
+    {
+        originals->vertexAttribBinding = table->vertexAttribBinding;
+        table->vertexAttribBinding     = &glVertexAttribBindingHook<Slot>;
+    }
+
+    if (table->vertexAttribDivisor)
+    {
+        originals->vertexAttribDivisor = table->vertexAttribDivisor;
+        table->vertexAttribDivisor     = &glVertexAttribDivisorHook<Slot>;
+    }
+
+    if (table->vertexAttribFormat)
+    {
+        originals->vertexAttribFormat = table->vertexAttribFormat;
+        table->vertexAttribFormat     = &glVertexAttribFormatHook<Slot>;
+    }
+
+    if (table->vertexAttribI1i)
+    {
+        originals->vertexAttribI1i = table->vertexAttribI1i;
+        table->vertexAttribI1i     = &glVertexAttribI1iHook<Slot>;
+    }
+
+    if (table->vertexAttribI1iv)
+    {
+        originals->vertexAttribI1iv = table->vertexAttribI1iv;
+        table->vertexAttribI1iv     = &glVertexAttribI1ivHook<Slot>;
+    }
+
+    if (table->vertexAttribI1ui)
+    {
+        originals->vertexAttribI1ui = table->vertexAttribI1ui;
+        table->vertexAttribI1ui     = &glVertexAttribI1uiHook<Slot>;
+    }
+
+    if (table->vertexAttribI1uiv)
+    {
+        originals->vertexAttribI1uiv = table->vertexAttribI1uiv;
+        table->vertexAttribI1uiv     = &glVertexAttribI1uivHook<Slot>;
+    }
+
+    if (table->vertexAttribI2i)
+    {
+        originals->vertexAttribI2i = table->vertexAttribI2i;
+        table->vertexAttribI2i     = &glVertexAttribI2iHook<Slot>;
+    }
+
+    if (table->vertexAttribI2iv)
+    {
+        originals->vertexAttribI2iv = table->vertexAttribI2iv;
+        table->vertexAttribI2iv     = &glVertexAttribI2ivHook<Slot>;
+    }
+
+    if (table->vertexAttribI2ui)
+    {
+        originals->vertexAttribI2ui = table->vertexAttribI2ui;
+        table->vertexAttribI2ui     = &glVertexAttribI2uiHook<Slot>;
+    }
+
+    if (table->vertexAttribI2uiv)
+    {
+        originals->vertexAttribI2uiv = table->vertexAttribI2uiv;
+        table->vertexAttribI2uiv     = &glVertexAttribI2uivHook<Slot>;
+    }
+
+    if (table->vertexAttribI3i)
+    {
+        originals->vertexAttribI3i = table->vertexAttribI3i;
+        table->vertexAttribI3i     = &glVertexAttribI3iHook<Slot>;
+    }
+
+    if (table->vertexAttribI3iv)
+    {
+        originals->vertexAttribI3iv = table->vertexAttribI3iv;
+        table->vertexAttribI3iv     = &glVertexAttribI3ivHook<Slot>;
+    }
+
+    if (table->vertexAttribI3ui)
+    {
+        originals->vertexAttribI3ui = table->vertexAttribI3ui;
+        table->vertexAttribI3ui     = &glVertexAttribI3uiHook<Slot>;
+    }
+
+    if (table->vertexAttribI3uiv)
+    {
+        originals->vertexAttribI3uiv = table->vertexAttribI3uiv;
+        table->vertexAttribI3uiv     = &glVertexAttribI3uivHook<Slot>;
+    }
+
+    if (table->vertexAttribI4bv)
+    {
+        originals->vertexAttribI4bv = table->vertexAttribI4bv;
+        table->vertexAttribI4bv     = &glVertexAttribI4bvHook<Slot>;
+    }
+
+    if (table->vertexAttribI4i)
+    {
+        originals->vertexAttribI4i = table->vertexAttribI4i;
+        table->vertexAttribI4i     = &glVertexAttribI4iHook<Slot>;
+    }
+
+    if (table->vertexAttribI4iv)
+    {
+        originals->vertexAttribI4iv = table->vertexAttribI4iv;
+        table->vertexAttribI4iv     = &glVertexAttribI4ivHook<Slot>;
+    }
+
+    if (table->vertexAttribI4sv)
+    {
+        originals->vertexAttribI4sv = table->vertexAttribI4sv;
+        table->vertexAttribI4sv     = &glVertexAttribI4svHook<Slot>;
+    }
+
+    if (table->vertexAttribI4ubv)
+    {
+        originals->vertexAttribI4ubv = table->vertexAttribI4ubv;
+        table->vertexAttribI4ubv     = &glVertexAttribI4ubvHook<Slot>;
+    }
+
+    if (table->vertexAttribI4ui)
+    {
+        originals->vertexAttribI4ui = table->vertexAttribI4ui;
+        table->vertexAttribI4ui     = &glVertexAttribI4uiHook<Slot>;
+    }
+
+    if (table->vertexAttribI4uiv)
+    {
+        originals->vertexAttribI4uiv = table->vertexAttribI4uiv;
+        table->vertexAttribI4uiv     = &glVertexAttribI4uivHook<Slot>;
+    }
+
+    if (table->vertexAttribI4usv)
+    {
+        originals->vertexAttribI4usv = table->vertexAttribI4usv;
+        table->vertexAttribI4usv     = &glVertexAttribI4usvHook<Slot>;
+    }
+
+    if (table->vertexAttribIFormat)
+    {
+        originals->vertexAttribIFormat = table->vertexAttribIFormat;
+        table->vertexAttribIFormat     = &glVertexAttribIFormatHook<Slot>;
+    }
+
+    if (table->vertexAttribIPointer)
+    {
+        originals->vertexAttribIPointer = table->vertexAttribIPointer;
+        table->vertexAttribIPointer     = &glVertexAttribIPointerHook<Slot>;
+    }
+
+    if (table->vertexAttribL1d)
+    {
+        originals->vertexAttribL1d = table->vertexAttribL1d;
+        table->vertexAttribL1d     = &glVertexAttribL1dHook<Slot>;
+    }
+
+    if (table->vertexAttribL1dv)
+    {
+        originals->vertexAttribL1dv = table->vertexAttribL1dv;
+        table->vertexAttribL1dv     = &glVertexAttribL1dvHook<Slot>;
+    }
+
+    if (table->vertexAttribL2d)
+    {
+        originals->vertexAttribL2d = table->vertexAttribL2d;
+        table->vertexAttribL2d     = &glVertexAttribL2dHook<Slot>;
+    }
+
+    if (table->vertexAttribL2dv)
+    {
+        originals->vertexAttribL2dv = table->vertexAttribL2dv;
+        table->vertexAttribL2dv     = &glVertexAttribL2dvHook<Slot>;
+    }
+
+    if (table->vertexAttribL3d)
+    {
+        originals->vertexAttribL3d = table->vertexAttribL3d;
+        table->vertexAttribL3d     = &glVertexAttribL3dHook<Slot>;
+    }
+
+    if (table->vertexAttribL3dv)
+    {
+        originals->vertexAttribL3dv = table->vertexAttribL3dv;
+        table->vertexAttribL3dv     = &glVertexAttribL3dvHook<Slot>;
+    }
+
+    if (table->vertexAttribL4d)
+    {
+        originals->vertexAttribL4d = table->vertexAttribL4d;
+        table->vertexAttribL4d     = &glVertexAttribL4dHook<Slot>;
+    }
+
+    if (table->vertexAttribL4dv)
+    {
+        originals->vertexAttribL4dv = table->vertexAttribL4dv;
+        table->vertexAttribL4dv     = &glVertexAttribL4dvHook<Slot>;
+    }
+
+    if (table->vertexAttribLFormat)
+    {
+        originals->vertexAttribLFormat = table->vertexAttribLFormat;
+        table->vertexAttribLFormat     = &glVertexAttribLFormatHook<Slot>;
+    }
+
+    if (table->vertexAttribLPointer)
+    {
+        originals->vertexAttribLPointer = table->vertexAttribLPointer;
+        table->vertexAttribLPointer     = &glVertexAttribLPointerHook<Slot>;
+    }
+
+    if (table->vertexAttribP1ui)
+    {
+        originals->vertexAttribP1ui = table->vertexAttribP1ui;
+        table->vertexAttribP1ui     = &glVertexAttribP1uiHook<Slot>;
+    }
+
+    if (table->vertexAttribP1uiv)
+    {
+        originals->vertexAttribP1uiv = table->vertexAttribP1uiv;
+        table->vertexAttribP1uiv     = &glVertexAttribP1uivHook<Slot>;
+    }
+
+    if (table->vertexAttribP2ui)
+    {
+        originals->vertexAttribP2ui = table->vertexAttribP2ui;
+        table->vertexAttribP2ui     = &glVertexAttribP2uiHook<Slot>;
+    }
+
+    if (table->vertexAttribP2uiv)
+    {
+        originals->vertexAttribP2uiv = table->vertexAttribP2uiv;
+        table->vertexAttribP2uiv     = &glVertexAttribP2uivHook<Slot>;
+    }
+
+    if (table->vertexAttribP3ui)
+    {
+        originals->vertexAttribP3ui = table->vertexAttribP3ui;
+        table->vertexAttribP3ui     = &glVertexAttribP3uiHook<Slot>;
+    }
+
+    if (table->vertexAttribP3uiv)
+    {
+        originals->vertexAttribP3uiv = table->vertexAttribP3uiv;
+        table->vertexAttribP3uiv     = &glVertexAttribP3uivHook<Slot>;
+    }
+
+    if (table->vertexAttribP4ui)
+    {
+        originals->vertexAttribP4ui = table->vertexAttribP4ui;
+        table->vertexAttribP4ui     = &glVertexAttribP4uiHook<Slot>;
+    }
+
+    if (table->vertexAttribP4uiv)
+    {
+        originals->vertexAttribP4uiv = table->vertexAttribP4uiv;
+        table->vertexAttribP4uiv     = &glVertexAttribP4uivHook<Slot>;
+    }
+
+    if (table->vertexAttribPointer)
+    {
+        originals->vertexAttribPointer = table->vertexAttribPointer;
+        table->vertexAttribPointer     = &glVertexAttribPointerHook<Slot>;
+    }
+
+    if (table->vertexBindingDivisor)
+    {
+        originals->vertexBindingDivisor = table->vertexBindingDivisor;
+        table->vertexBindingDivisor     = &glVertexBindingDivisorHook<Slot>;
+    }
+
+    if (table->viewport)
+    {
+        originals->viewport = table->viewport;
+        table->viewport     = &glViewportHook<Slot>;
+    }
+
+    if (table->viewportArrayv)
+    {
+        originals->viewportArrayv = table->viewportArrayv;
+        table->viewportArrayv     = &glViewportArrayvHook<Slot>;
+    }
+
+    if (table->viewportIndexedf)
+    {
+        originals->viewportIndexedf = table->viewportIndexedf;
+        table->viewportIndexedf     = &glViewportIndexedfHook<Slot>;
+    }
+
+    if (table->viewportIndexedfv)
+    {
+        originals->viewportIndexedfv = table->viewportIndexedfv;
+        table->viewportIndexedfv     = &glViewportIndexedfvHook<Slot>;
+    }
+
+    if (table->waitSync)
+    {
+        originals->waitSync = table->waitSync;
+        table->waitSync     = &glWaitSyncHook<Slot>;
+    }
+}
+}  // anonymous namespace
+
+const char *GetEntryPointGLName(EntryPointGL entryPoint)
+{
+    switch (entryPoint)
+    {
+        case EntryPointGL::ActiveShaderProgram:
+            return "glActiveShaderProgram";
+        case EntryPointGL::ActiveTexture:
+            return "glActiveTexture";
+        case EntryPointGL::AttachShader:
+            return "glAttachShader";
+        case EntryPointGL::BeginConditionalRender:
+            return "glBeginConditionalRender";
+        case EntryPointGL::BeginQuery:
+            return "glBeginQuery";
+        case EntryPointGL::BeginQueryIndexed:
+            return "glBeginQueryIndexed";
+        case EntryPointGL::BeginTransformFeedback:
+            return "glBeginTransformFeedback";
+        case EntryPointGL::BindAttribLocation:
+            return "glBindAttribLocation";
+        case EntryPointGL::BindBuffer:
+            return "glBindBuffer";
+        case EntryPointGL::BindBufferBase:
+            return "glBindBufferBase";
+        case EntryPointGL::BindBufferRange:
+            return "glBindBufferRange";
+        case EntryPointGL::BindBuffersBase:
+            return "glBindBuffersBase";
+        case EntryPointGL::BindBuffersRange:
+            return "glBindBuffersRange";
+        case EntryPointGL::BindFragDataLocation:
+            return "glBindFragDataLocation";
+        case EntryPointGL::BindFragDataLocationIndexed:
+            return "glBindFragDataLocationIndexed";
+        case EntryPointGL::BindFramebuffer:
+            return "glBindFramebuffer";
+        case EntryPointGL::BindImageTexture:
+            return "glBindImageTexture";
+        case EntryPointGL::BindImageTextures:
+            return "glBindImageTextures";
+        case EntryPointGL::BindProgramPipeline:
+            return "glBindProgramPipeline";
+        case EntryPointGL::BindRenderbuffer:
+            return "glBindRenderbuffer";
+        case EntryPointGL::BindSampler:
+            return "glBindSampler";
+        case EntryPointGL::BindSamplers:
+            return "glBindSamplers";
+        case EntryPointGL::BindTexture:
+            return "glBindTexture";
+        case EntryPointGL::BindTextureUnit:
+            return "glBindTextureUnit";
+        case EntryPointGL::BindTextures:
+            return "glBindTextures";
+        case EntryPointGL::BindTransformFeedback:
+            return "glBindTransformFeedback";
+        case EntryPointGL::BindVertexArray:
+            return "glBindVertexArray";
+        case EntryPointGL::BindVertexBuffer:
+            return "glBindVertexBuffer";
+        case EntryPointGL::BindVertexBuffers:
+            return "glBindVertexBuffers";
+        case EntryPointGL::BlendBarrier:
+            return "glBlendBarrier";
+        case EntryPointGL::BlendColor:
+            return "glBlendColor";
+        case EntryPointGL::BlendEquation:
+            return "glBlendEquation";
+        case EntryPointGL::BlendEquationSeparate:
+            return "glBlendEquationSeparate";
+        case EntryPointGL::BlendEquationSeparatei:
+            return "glBlendEquationSeparatei";
+        case EntryPointGL::BlendEquationi:
+            return "glBlendEquationi";
+        case EntryPointGL::BlendFunc:
+            return "glBlendFunc";
+        case EntryPointGL::BlendFuncSeparate:
+            return "glBlendFuncSeparate";
+        case EntryPointGL::BlendFuncSeparatei:
+            return "glBlendFuncSeparatei";
+        case EntryPointGL::BlendFunci:
+            return "glBlendFunci";
+        case EntryPointGL::BlitFramebuffer:
+            return "glBlitFramebuffer";
+        case EntryPointGL::BlitNamedFramebuffer:
+            return "glBlitNamedFramebuffer";
+        case EntryPointGL::BufferData:
+            return "glBufferData";
+        case EntryPointGL::BufferStorage:
+            return "glBufferStorage";
+        case EntryPointGL::BufferSubData:
+            return "glBufferSubData";
+        case EntryPointGL::CheckFramebufferStatus:
+            return "glCheckFramebufferStatus";
+        case EntryPointGL::CheckNamedFramebufferStatus:
+            return "glCheckNamedFramebufferStatus";
+        case EntryPointGL::ClampColor:
+            return "glClampColor";
+        case EntryPointGL::Clear:
+            return "glClear";
+        case EntryPointGL::ClearBufferData:
+            return "glClearBufferData";
+        case EntryPointGL::ClearBufferSubData:
+            return "glClearBufferSubData";
+        case EntryPointGL::ClearBufferfi:
+            return "glClearBufferfi";
+        case EntryPointGL::ClearBufferfv:
+            return "glClearBufferfv";
+        case EntryPointGL::ClearBufferiv:
+            return "glClearBufferiv";
+        case EntryPointGL::ClearBufferuiv:
+            return "glClearBufferuiv";
+        case EntryPointGL::ClearColor:
+            return "glClearColor";
+        case EntryPointGL::ClearDepth:
+            return "glClearDepth";
+        case EntryPointGL::ClearDepthf:
+            return "glClearDepthf";
+        case EntryPointGL::ClearNamedBufferData:
+            return "glClearNamedBufferData";
+        case EntryPointGL::ClearNamedBufferSubData:
+            return "glClearNamedBufferSubData";
+        case EntryPointGL::ClearNamedFramebufferfi:
+            return "glClearNamedFramebufferfi";
+        case EntryPointGL::ClearNamedFramebufferfv:
+            return "glClearNamedFramebufferfv";
+        case EntryPointGL::ClearNamedFramebufferiv:
+            return "glClearNamedFramebufferiv";
+        case EntryPointGL::ClearNamedFramebufferuiv:
+            return "glClearNamedFramebufferuiv";
+        case EntryPointGL::ClearStencil:
+            return "glClearStencil";
+        case EntryPointGL::ClearTexImage:
+            return "glClearTexImage";
+        case EntryPointGL::ClearTexSubImage:
+            return "glClearTexSubImage";
+        case EntryPointGL::ClientWaitSync:
+            return "glClientWaitSync";
+        case EntryPointGL::ClipControl:
+            return "glClipControl";
+        case EntryPointGL::ColorMask:
+            return "glColorMask";
+        case EntryPointGL::ColorMaski:
+            return "glColorMaski";
+        case EntryPointGL::CompileShader:
+            return "glCompileShader";
+        case EntryPointGL::CompressedTexImage1D:
+            return "glCompressedTexImage1D";
+        case EntryPointGL::CompressedTexImage2D:
+            return "glCompressedTexImage2D";
+        case EntryPointGL::CompressedTexImage3D:
+            return "glCompressedTexImage3D";
+        case EntryPointGL::CompressedTexSubImage1D:
+            return "glCompressedTexSubImage1D";
+        case EntryPointGL::CompressedTexSubImage2D:
+            return "glCompressedTexSubImage2D";
+        case EntryPointGL::CompressedTexSubImage3D:
+            return "glCompressedTexSubImage3D";
+        case EntryPointGL::CompressedTextureSubImage1D:
+            return "glCompressedTextureSubImage1D";
+        case EntryPointGL::CompressedTextureSubImage2D:
+            return "glCompressedTextureSubImage2D";
+        case EntryPointGL::CompressedTextureSubImage3D:
+            return "glCompressedTextureSubImage3D";
+        case EntryPointGL::CopyBufferSubData:
+            return "glCopyBufferSubData";
+        case EntryPointGL::CopyImageSubData:
+            return "glCopyImageSubData";
+        case EntryPointGL::CopyNamedBufferSubData:
+            return "glCopyNamedBufferSubData";
+        case EntryPointGL::CopyTexImage1D:
+            return "glCopyTexImage1D";
+        case EntryPointGL::CopyTexImage2D:
+            return "glCopyTexImage2D";
+        case EntryPointGL::CopyTexSubImage1D:
+            return "glCopyTexSubImage1D";
+        case EntryPointGL::CopyTexSubImage2D:
+            return "glCopyTexSubImage2D";
+        case EntryPointGL::CopyTexSubImage3D:
+            return "glCopyTexSubImage3D";
+        case EntryPointGL::CopyTextureSubImage1D:
+            return "glCopyTextureSubImage1D";
+        case EntryPointGL::CopyTextureSubImage2D:
+            return "glCopyTextureSubImage2D";
+        case EntryPointGL::CopyTextureSubImage3D:
+            return "glCopyTextureSubImage3D";
+        case EntryPointGL::CoverFillPathInstancedNV:
+            return "glCoverFillPathInstancedNV";
+        case EntryPointGL::CoverFillPathNV:
+            return "glCoverFillPathNV";
+        case EntryPointGL::CoverStrokePathInstancedNV:
+            return "glCoverStrokePathInstancedNV";
+        case EntryPointGL::CoverStrokePathNV:
+            return "glCoverStrokePathNV";
+        case EntryPointGL::CoverageModulationNV:
+            return "glCoverageModulationNV";
+        case EntryPointGL::CreateBuffers:
+            return "glCreateBuffers";
+        case EntryPointGL::CreateFramebuffers:
+            return "glCreateFramebuffers";
+        case EntryPointGL::CreateProgram:
+            return "glCreateProgram";
+        case EntryPointGL::CreateProgramPipelines:
+            return "glCreateProgramPipelines";
+        case EntryPointGL::CreateQueries:
+            return "glCreateQueries";
+        case EntryPointGL::CreateRenderbuffers:
+            return "glCreateRenderbuffers";
+        case EntryPointGL::CreateSamplers:
+            return "glCreateSamplers";
+        case EntryPointGL::CreateShader:
+            return "glCreateShader";
+        case EntryPointGL::CreateShaderProgramv:
+            return "glCreateShaderProgramv";
+        case EntryPointGL::CreateTextures:
+            return "glCreateTextures";
+        case EntryPointGL::CreateTransformFeedbacks:
+            return "glCreateTransformFeedbacks";
+        case EntryPointGL::CreateVertexArrays:
+            return "glCreateVertexArrays";
+        case EntryPointGL::CullFace:
+            return "glCullFace";
+        case EntryPointGL::DebugMessageCallback:
+            return "glDebugMessageCallback";
+        case EntryPointGL::DebugMessageControl:
+            return "glDebugMessageControl";
+        case EntryPointGL::DebugMessageInsert:
+            return "glDebugMessageInsert";
+        case EntryPointGL::DeleteBuffers:
+            return "glDeleteBuffers";
+        case EntryPointGL::DeleteFencesNV:
+            return "glDeleteFencesNV";
+        case EntryPointGL::DeleteFramebuffers:
+            return "glDeleteFramebuffers";
+        case EntryPointGL::DeletePathsNV:
+            return "glDeletePathsNV";
+        case EntryPointGL::DeleteProgram:
+            return "glDeleteProgram";
+        case EntryPointGL::DeleteProgramPipelines:
+            return "glDeleteProgramPipelines";
+        case EntryPointGL::DeleteQueries:
+            return "glDeleteQueries";
+        case EntryPointGL::DeleteRenderbuffers:
+            return "glDeleteRenderbuffers";
+        case EntryPointGL::DeleteSamplers:
+            return "glDeleteSamplers";
+        case EntryPointGL::DeleteShader:
+            return "glDeleteShader";
+        case EntryPointGL::DeleteSync:
+            return "glDeleteSync";
+        case EntryPointGL::DeleteTextures:
+            return "glDeleteTextures";
+        case EntryPointGL::DeleteTransformFeedbacks:
+            return "glDeleteTransformFeedbacks";
+        case EntryPointGL::DeleteVertexArrays:
+            return "glDeleteVertexArrays";
+        case EntryPointGL::DepthFunc:
+            return "glDepthFunc";
+        case EntryPointGL::DepthMask:
+            return "glDepthMask";
+        case EntryPointGL::DepthRange:
+            return "glDepthRange";
+        case EntryPointGL::DepthRangeArrayv:
+            return "glDepthRangeArrayv";
+        case EntryPointGL::DepthRangeIndexed:
+            return "glDepthRangeIndexed";
+        case EntryPointGL::DepthRangef:
+            return "glDepthRangef";
+        case EntryPointGL::DetachShader:
+            return "glDetachShader";
+        case EntryPointGL::Disable:
+            return "glDisable";
+        case EntryPointGL::DisableVertexArrayAttrib:
+            return "glDisableVertexArrayAttrib";
+        case EntryPointGL::DisableVertexAttribArray:
+            return "glDisableVertexAttribArray";
+        case EntryPointGL::Disablei:
+            return "glDisablei";
+        case EntryPointGL::DiscardFramebufferEXT:
+            return "glDiscardFramebufferEXT";
+        case EntryPointGL::DispatchCompute:
+            return "glDispatchCompute";
+        case EntryPointGL::DispatchComputeIndirect:
+            return "glDispatchComputeIndirect";
+        case EntryPointGL::DrawArrays:
+            return "glDrawArrays";
+        case EntryPointGL::DrawArraysIndirect:
+            return "glDrawArraysIndirect";
+        case EntryPointGL::DrawArraysInstanced:
+            return "glDrawArraysInstanced";
+        case EntryPointGL::DrawArraysInstancedBaseInstance:
+            return "glDrawArraysInstancedBaseInstance";
+        case EntryPointGL::DrawBuffer:
+            return "glDrawBuffer";
+        case EntryPointGL::DrawBuffers:
+            return "glDrawBuffers";
+        case EntryPointGL::DrawElements:
+            return "glDrawElements";
+        case EntryPointGL::DrawElementsBaseVertex:
+            return "glDrawElementsBaseVertex";
+        case EntryPointGL::DrawElementsIndirect:
+            return "glDrawElementsIndirect";
+        case EntryPointGL::DrawElementsInstanced:
+            return "glDrawElementsInstanced";
+        case EntryPointGL::DrawElementsInstancedBaseInstance:
+            return "glDrawElementsInstancedBaseInstance";
+        case EntryPointGL::DrawElementsInstancedBaseVertex:
+            return "glDrawElementsInstancedBaseVertex";
+        case EntryPointGL::DrawElementsInstancedBaseVertexBaseInstance:
+            return "glDrawElementsInstancedBaseVertexBaseInstance";
+        case EntryPointGL::DrawRangeElements:
+            return "glDrawRangeElements";
+        case EntryPointGL::DrawRangeElementsBaseVertex:
+            return "glDrawRangeElementsBaseVertex";
+        case EntryPointGL::DrawTransformFeedback:
+            return "glDrawTransformFeedback";
+        case EntryPointGL::DrawTransformFeedbackInstanced:
+            return "glDrawTransformFeedbackInstanced";
+        case EntryPointGL::DrawTransformFeedbackStream:
+            return "glDrawTransformFeedbackStream";
+        case EntryPointGL::DrawTransformFeedbackStreamInstanced:
+            return "glDrawTransformFeedbackStreamInstanced";
+        case EntryPointGL::EGLImageTargetRenderbufferStorageOES:
+            return "glEGLImageTargetRenderbufferStorageOES";
+        case EntryPointGL::EGLImageTargetTexture2DOES:
+            return "glEGLImageTargetTexture2DOES";
+        case EntryPointGL::Enable:
+            return "glEnable";
+        case EntryPointGL::EnableVertexArrayAttrib:
+            return "glEnableVertexArrayAttrib";
+        case EntryPointGL::EnableVertexAttribArray:
+            return "glEnableVertexAttribArray";
+        case EntryPointGL::Enablei:
+            return "glEnablei";
+        case EntryPointGL::EndConditionalRender:
+            return "glEndConditionalRender";
+        case EntryPointGL::EndQuery:
+            return "glEndQuery";
+        case EntryPointGL::EndQueryIndexed:
+            return "glEndQueryIndexed";
+        case EntryPointGL::EndTransformFeedback:
+            return "glEndTransformFeedback";
+        case EntryPointGL::FenceSync:
+            return "glFenceSync";
+        case EntryPointGL::Finish:
+            return "glFinish";
+        case EntryPointGL::FinishFenceNV:
+            return "glFinishFenceNV";
+        case EntryPointGL::Flush:
+            return "glFlush";
+        case EntryPointGL::FlushMappedBufferRange:
+            return "glFlushMappedBufferRange";
+        case EntryPointGL::FlushMappedNamedBufferRange:
+            return "glFlushMappedNamedBufferRange";
+        case EntryPointGL::FramebufferParameteri:
+            return "glFramebufferParameteri";
+        case EntryPointGL::FramebufferRenderbuffer:
+            return "glFramebufferRenderbuffer";
+        case EntryPointGL::FramebufferTexture:
+            return "glFramebufferTexture";
+        case EntryPointGL::FramebufferTexture1D:
+            return "glFramebufferTexture1D";
+        case EntryPointGL::FramebufferTexture2D:
+            return "glFramebufferTexture2D";
+        case EntryPointGL::FramebufferTexture3D:
+            return "glFramebufferTexture3D";
+        case EntryPointGL::FramebufferTextureLayer:
+            return "glFramebufferTextureLayer";
+        case EntryPointGL::FrontFace:
+            return "glFrontFace";
+        case EntryPointGL::GenBuffers:
+            return "glGenBuffers";
+        case EntryPointGL::GenFencesNV:
+            return "glGenFencesNV";
+        case EntryPointGL::GenFramebuffers:
+            return "glGenFramebuffers";
+        case EntryPointGL::GenPathsNV:
+            return "glGenPathsNV";
+        case EntryPointGL::GenProgramPipelines:
+            return "glGenProgramPipelines";
+        case EntryPointGL::GenQueries:
+            return "glGenQueries";
+        case EntryPointGL::GenRenderbuffers:
+            return "glGenRenderbuffers";
+        case EntryPointGL::GenSamplers:
+            return "glGenSamplers";
+        case EntryPointGL::GenTextures:
+            return "glGenTextures";
+        case EntryPointGL::GenTransformFeedbacks:
+            return "glGenTransformFeedbacks";
+        case EntryPointGL::GenVertexArrays:
+            return "glGenVertexArrays";
+        case EntryPointGL::GenerateMipmap:
+            return "glGenerateMipmap";
+        case EntryPointGL::GenerateTextureMipmap:
+            return "glGenerateTextureMipmap";
+        case EntryPointGL::GetActiveAtomicCounterBufferiv:
+            return "glGetActiveAtomicCounterBufferiv";
+        case EntryPointGL::GetActiveAttrib:
+            return "glGetActiveAttrib";
+        case EntryPointGL::GetActiveSubroutineName:
+            return "glGetActiveSubroutineName";
+        case EntryPointGL::GetActiveSubroutineUniformName:
+            return "glGetActiveSubroutineUniformName";
+        case EntryPointGL::GetActiveSubroutineUniformiv:
+            return "glGetActiveSubroutineUniformiv";
+        case EntryPointGL::GetActiveUniform:
+            return "glGetActiveUniform";
+        case EntryPointGL::GetActiveUniformBlockName:
+            return "glGetActiveUniformBlockName";
+        case EntryPointGL::GetActiveUniformBlockiv:
+            return "glGetActiveUniformBlockiv";
+        case EntryPointGL::GetActiveUniformName:
+            return "glGetActiveUniformName";
+        case EntryPointGL::GetActiveUniformsiv:
+            return "glGetActiveUniformsiv";
+        case EntryPointGL::GetAttachedShaders:
+            return "glGetAttachedShaders";
+        case EntryPointGL::GetAttribLocation:
+            return "glGetAttribLocation";
+        case EntryPointGL::GetBooleani_v:
+            return "glGetBooleani_v";
+        case EntryPointGL::GetBooleanv:
+            return "glGetBooleanv";
+        case EntryPointGL::GetBufferParameteri64v:
+            return "glGetBufferParameteri64v";
+        case EntryPointGL::GetBufferParameteriv:
+            return "glGetBufferParameteriv";
+        case EntryPointGL::GetBufferPointerv:
+            return "glGetBufferPointerv";
+        case EntryPointGL::GetBufferSubData:
+            return "glGetBufferSubData";
+        case EntryPointGL::GetCompressedTexImage:
+            return "glGetCompressedTexImage";
+        case EntryPointGL::GetCompressedTextureImage:
+            return "glGetCompressedTextureImage";
+        case EntryPointGL::GetCompressedTextureSubImage:
+            return "glGetCompressedTextureSubImage";
+        case EntryPointGL::GetDebugMessageLog:
+            return "glGetDebugMessageLog";
+        case EntryPointGL::GetDoublei_v:
+            return "glGetDoublei_v";
+        case EntryPointGL::GetDoublev:
+            return "glGetDoublev";
+        case EntryPointGL::GetError:
+            return "glGetError";
+        case EntryPointGL::GetFenceivNV:
+            return "glGetFenceivNV";
+        case EntryPointGL::GetFloati_v:
+            return "glGetFloati_v";
+        case EntryPointGL::GetFloatv:
+            return "glGetFloatv";
+        case EntryPointGL::GetFragDataIndex:
+            return "glGetFragDataIndex";
+        case EntryPointGL::GetFragDataLocation:
+            return "glGetFragDataLocation";
+        case EntryPointGL::GetFramebufferAttachmentParameteriv:
+            return "glGetFramebufferAttachmentParameteriv";
+        case EntryPointGL::GetFramebufferParameteriv:
+            return "glGetFramebufferParameteriv";
+        case EntryPointGL::GetGraphicsResetStatus:
+            return "glGetGraphicsResetStatus";
+        case EntryPointGL::GetInteger64i_v:
+            return "glGetInteger64i_v";
+        case EntryPointGL::GetInteger64v:
+            return "glGetInteger64v";
+        case EntryPointGL::GetIntegeri_v:
+            return "glGetIntegeri_v";
+        case EntryPointGL::GetIntegerv:
+            return "glGetIntegerv";
+        case EntryPointGL::GetInternalformatSampleivNV:
+            return "glGetInternalformatSampleivNV";
+        case EntryPointGL::GetInternalformati64v:
+            return "glGetInternalformati64v";
+        case EntryPointGL::GetInternalformativ:
+            return "glGetInternalformativ";
+        case EntryPointGL::GetMultisamplefv:
+            return "glGetMultisamplefv";
+        case EntryPointGL::GetNamedBufferParameteri64v:
+            return "glGetNamedBufferParameteri64v";
+        case EntryPointGL::GetNamedBufferParameteriv:
+            return "glGetNamedBufferParameteriv";
+        case EntryPointGL::GetNamedBufferPointerv:
+            return "glGetNamedBufferPointerv";
+        case EntryPointGL::GetNamedBufferSubData:
+            return "glGetNamedBufferSubData";
+        case EntryPointGL::GetNamedFramebufferAttachmentParameteriv:
+            return "glGetNamedFramebufferAttachmentParameteriv";
+        case EntryPointGL::GetNamedFramebufferParameteriv:
+            return "glGetNamedFramebufferParameteriv";
+        case EntryPointGL::GetNamedRenderbufferParameteriv:
+            return "glGetNamedRenderbufferParameteriv";
+        case EntryPointGL::GetObjectLabel:
+            return "glGetObjectLabel";
+        case EntryPointGL::GetObjectPtrLabel:
+            return "glGetObjectPtrLabel";
+        case EntryPointGL::GetPathParameterfvNV:
+            return "glGetPathParameterfvNV";
+        case EntryPointGL::GetPathParameterivNV:
+            return "glGetPathParameterivNV";
+        case EntryPointGL::GetPointerv:
+            return "glGetPointerv";
+        case EntryPointGL::GetProgramBinary:
+            return "glGetProgramBinary";
+        case EntryPointGL::GetProgramInfoLog:
+            return "glGetProgramInfoLog";
+        case EntryPointGL::GetProgramInterfaceiv:
+            return "glGetProgramInterfaceiv";
+        case EntryPointGL::GetProgramPipelineInfoLog:
+            return "glGetProgramPipelineInfoLog";
+        case EntryPointGL::GetProgramPipelineiv:
+            return "glGetProgramPipelineiv";
+        case EntryPointGL::GetProgramResourceIndex:
+            return "glGetProgramResourceIndex";
+        case EntryPointGL::GetProgramResourceLocation:
+            return "glGetProgramResourceLocation";
+        case EntryPointGL::GetProgramResourceLocationIndex:
+            return "glGetProgramResourceLocationIndex";
+        case EntryPointGL::GetProgramResourceName:
+            return "glGetProgramResourceName";
+        case EntryPointGL::GetProgramResourceiv:
+            return "glGetProgramResourceiv";
+        case EntryPointGL::GetProgramStageiv:
+            return "glGetProgramStageiv";
+        case EntryPointGL::GetProgramiv:
+            return "glGetProgramiv";
+        case EntryPointGL::GetQueryBufferObjecti64v:
+            return "glGetQueryBufferObjecti64v";
+        case EntryPointGL::GetQueryBufferObjectiv:
+            return "glGetQueryBufferObjectiv";
+        case EntryPointGL::GetQueryBufferObjectui64v:
+            return "glGetQueryBufferObjectui64v";
+        case EntryPointGL::GetQueryBufferObjectuiv:
+            return "glGetQueryBufferObjectuiv";
+        case EntryPointGL::GetQueryIndexediv:
+            return "glGetQueryIndexediv";
+        case EntryPointGL::GetQueryObjecti64v:
+            return "glGetQueryObjecti64v";
+        case EntryPointGL::GetQueryObjectiv:
+            return "glGetQueryObjectiv";
+        case EntryPointGL::GetQueryObjectui64v:
+            return "glGetQueryObjectui64v";
+        case EntryPointGL::GetQueryObjectuiv:
+            return "glGetQueryObjectuiv";
+        case EntryPointGL::GetQueryiv:
+            return "glGetQueryiv";
+        case EntryPointGL::GetRenderbufferParameteriv:
+            return "glGetRenderbufferParameteriv";
+        case EntryPointGL::GetSamplerParameterIiv:
+            return "glGetSamplerParameterIiv";
+        case EntryPointGL::GetSamplerParameterIuiv:
+            return "glGetSamplerParameterIuiv";
+        case EntryPointGL::GetSamplerParameterfv:
+            return "glGetSamplerParameterfv";
+        case EntryPointGL::GetSamplerParameteriv:
+            return "glGetSamplerParameteriv";
+        case EntryPointGL::GetShaderInfoLog:
+            return "glGetShaderInfoLog";
+        case EntryPointGL::GetShaderPrecisionFormat:
+            return "glGetShaderPrecisionFormat";
+        case EntryPointGL::GetShaderSource:
+            return "glGetShaderSource";
+        case EntryPointGL::GetShaderiv:
+            return "glGetShaderiv";
+        case EntryPointGL::GetString:
+            return "glGetString";
+        case EntryPointGL::GetStringi:
+            return "glGetStringi";
+        case EntryPointGL::GetSubroutineIndex:
+            return "glGetSubroutineIndex";
+        case EntryPointGL::GetSubroutineUniformLocation:
+            return "glGetSubroutineUniformLocation";
+        case EntryPointGL::GetSynciv:
+            return "glGetSynciv";
+        case EntryPointGL::GetTexImage:
+            return "glGetTexImage";
+        case EntryPointGL::GetTexLevelParameterfv:
+            return "glGetTexLevelParameterfv";
+        case EntryPointGL::GetTexLevelParameteriv:
+            return "glGetTexLevelParameteriv";
+        case EntryPointGL::GetTexParameterIiv:
+            return "glGetTexParameterIiv";
+        case EntryPointGL::GetTexParameterIuiv:
+            return "glGetTexParameterIuiv";
+        case EntryPointGL::GetTexParameterfv:
+            return "glGetTexParameterfv";
+        case EntryPointGL::GetTexParameteriv:
+            return "glGetTexParameteriv";
+        case EntryPointGL::GetTextureImage:
+            return "glGetTextureImage";
+        case EntryPointGL::GetTextureLevelParameterfv:
+            return "glGetTextureLevelParameterfv";
+        case EntryPointGL::GetTextureLevelParameteriv:
+            return "glGetTextureLevelParameteriv";
+        case EntryPointGL::GetTextureParameterIiv:
+            return "glGetTextureParameterIiv";
+        case EntryPointGL::GetTextureParameterIuiv:
+            return "glGetTextureParameterIuiv";
+        case EntryPointGL::GetTextureParameterfv:
+            return "glGetTextureParameterfv";
+        case EntryPointGL::GetTextureParameteriv:
+            return "glGetTextureParameteriv";
+        case EntryPointGL::GetTextureSubImage:
+            return "glGetTextureSubImage";
+        case EntryPointGL::GetTransformFeedbackVarying:
+            return "glGetTransformFeedbackVarying";
+        case EntryPointGL::GetTransformFeedbacki64_v:
+            return "glGetTransformFeedbacki64_v";
+        case EntryPointGL::GetTransformFeedbacki_v:
+            return "glGetTransformFeedbacki_v";
+        case EntryPointGL::GetTransformFeedbackiv:
+            return "glGetTransformFeedbackiv";
+        case EntryPointGL::GetUniformBlockIndex:
+            return "glGetUniformBlockIndex";
+        case EntryPointGL::GetUniformIndices:
+            return "glGetUniformIndices";
+        case EntryPointGL::GetUniformLocation:
+            return "glGetUniformLocation";
+        case EntryPointGL::GetUniformSubroutineuiv:
+            return "glGetUniformSubroutineuiv";
+        case EntryPointGL::GetUniformdv:
+            return "glGetUniformdv";
+        case EntryPointGL::GetUniformfv:
+            return "glGetUniformfv";
+        case EntryPointGL::GetUniformiv:
+            return "glGetUniformiv";
+        case EntryPointGL::GetUniformuiv:
+            return "glGetUniformuiv";
+        case EntryPointGL::GetVertexArrayIndexed64iv:
+            return "glGetVertexArrayIndexed64iv";
+        case EntryPointGL::GetVertexArrayIndexediv:
+            return "glGetVertexArrayIndexediv";
+        case EntryPointGL::GetVertexArrayiv:
+            return "glGetVertexArrayiv";
+        case EntryPointGL::GetVertexAttribIiv:
+            return "glGetVertexAttribIiv";
+        case EntryPointGL::GetVertexAttribIuiv:
+            return "glGetVertexAttribIuiv";
+        case EntryPointGL::GetVertexAttribLdv:
+            return "glGetVertexAttribLdv";
+        case EntryPointGL::GetVertexAttribPointerv:
+            return "glGetVertexAttribPointerv";
+        case EntryPointGL::GetVertexAttribdv:
+            return "glGetVertexAttribdv";
+        case EntryPointGL::GetVertexAttribfv:
+            return "glGetVertexAttribfv";
+        case EntryPointGL::GetVertexAttribiv:
+            return "glGetVertexAttribiv";
+        case EntryPointGL::GetnCompressedTexImage:
+            return "glGetnCompressedTexImage";
+        case EntryPointGL::GetnTexImage:
+            return "glGetnTexImage";
+        case EntryPointGL::GetnUniformdv:
+            return "glGetnUniformdv";
+        case EntryPointGL::GetnUniformfv:
+            return "glGetnUniformfv";
+        case EntryPointGL::GetnUniformiv:
+            return "glGetnUniformiv";
+        case EntryPointGL::GetnUniformuiv:
+            return "glGetnUniformuiv";
+        case EntryPointGL::Hint:
+            return "glHint";
+        case EntryPointGL::InsertEventMarkerEXT:
+            return "glInsertEventMarkerEXT";
+        case EntryPointGL::InvalidateBufferData:
+            return "glInvalidateBufferData";
+        case EntryPointGL::InvalidateBufferSubData:
+            return "glInvalidateBufferSubData";
+        case EntryPointGL::InvalidateFramebuffer:
+            return "glInvalidateFramebuffer";
+        case EntryPointGL::InvalidateNamedFramebufferData:
+            return "glInvalidateNamedFramebufferData";
+        case EntryPointGL::InvalidateNamedFramebufferSubData:
+            return "glInvalidateNamedFramebufferSubData";
+        case EntryPointGL::InvalidateSubFramebuffer:
+            return "glInvalidateSubFramebuffer";
+        case EntryPointGL::InvalidateTexImage:
+            return "glInvalidateTexImage";
+        case EntryPointGL::InvalidateTexSubImage:
+            return "glInvalidateTexSubImage";
+        case EntryPointGL::IsBuffer:
+            return "glIsBuffer";
+        case EntryPointGL::IsEnabled:
+            return "glIsEnabled";
+        case EntryPointGL::IsEnabledi:
+            return "glIsEnabledi";
+        case EntryPointGL::IsFenceNV:
+            return "glIsFenceNV";
+        case EntryPointGL::IsFramebuffer:
+            return "glIsFramebuffer";
+        case EntryPointGL::IsPathNV:
+            return "glIsPathNV";
+        case EntryPointGL::IsProgram:
+            return "glIsProgram";
+        case EntryPointGL::IsProgramPipeline:
+            return "glIsProgramPipeline";
+        case EntryPointGL::IsQuery:
+            return "glIsQuery";
+        case EntryPointGL::IsRenderbuffer:
+            return "glIsRenderbuffer";
+        case EntryPointGL::IsSampler:
+            return "glIsSampler";
+        case EntryPointGL::IsShader:
+            return "glIsShader";
+        case EntryPointGL::IsSync:
+            return "glIsSync";
+        case EntryPointGL::IsTexture:
+            return "glIsTexture";
+        case EntryPointGL::IsTransformFeedback:
+            return "glIsTransformFeedback";
+        case EntryPointGL::IsVertexArray:
+            return "glIsVertexArray";
+        case EntryPointGL::LineWidth:
+            return "glLineWidth";
+        case EntryPointGL::LinkProgram:
+            return "glLinkProgram";
+        case EntryPointGL::LogicOp:
+            return "glLogicOp";
+        case EntryPointGL::MapBuffer:
+            return "glMapBuffer";
+        case EntryPointGL::MapBufferRange:
+            return "glMapBufferRange";
+        case EntryPointGL::MapNamedBuffer:
+            return "glMapNamedBuffer";
+        case EntryPointGL::MapNamedBufferRange:
+            return "glMapNamedBufferRange";
+        case EntryPointGL::MatrixLoadfEXT:
+            return "glMatrixLoadfEXT";
+        case EntryPointGL::MemoryBarrier:
+            return "glMemoryBarrier";
+        case EntryPointGL::MemoryBarrierByRegion:
+            return "glMemoryBarrierByRegion";
+        case EntryPointGL::MinSampleShading:
+            return "glMinSampleShading";
+        case EntryPointGL::MultiDrawArrays:
+            return "glMultiDrawArrays";
+        case EntryPointGL::MultiDrawArraysIndirect:
+            return "glMultiDrawArraysIndirect";
+        case EntryPointGL::MultiDrawElements:
+            return "glMultiDrawElements";
+        case EntryPointGL::MultiDrawElementsBaseVertex:
+            return "glMultiDrawElementsBaseVertex";
+        case EntryPointGL::MultiDrawElementsIndirect:
+            return "glMultiDrawElementsIndirect";
+        case EntryPointGL::NamedBufferData:
+            return "glNamedBufferData";
+        case EntryPointGL::NamedBufferStorage:
+            return "glNamedBufferStorage";
+        case EntryPointGL::NamedBufferSubData:
+            return "glNamedBufferSubData";
+        case EntryPointGL::NamedFramebufferDrawBuffer:
+            return "glNamedFramebufferDrawBuffer";
+        case EntryPointGL::NamedFramebufferDrawBuffers:
+            return "glNamedFramebufferDrawBuffers";
+        case EntryPointGL::NamedFramebufferParameteri:
+            return "glNamedFramebufferParameteri";
+        case EntryPointGL::NamedFramebufferReadBuffer:
+            return "glNamedFramebufferReadBuffer";
+        case EntryPointGL::NamedFramebufferRenderbuffer:
+            return "glNamedFramebufferRenderbuffer";
+        case EntryPointGL::NamedFramebufferTexture:
+            return "glNamedFramebufferTexture";
+        case EntryPointGL::NamedFramebufferTextureLayer:
+            return "glNamedFramebufferTextureLayer";
+        case EntryPointGL::NamedRenderbufferStorage:
+            return "glNamedRenderbufferStorage";
+        case EntryPointGL::NamedRenderbufferStorageMultisample:
+            return "glNamedRenderbufferStorageMultisample";
+        case EntryPointGL::ObjectLabel:
+            return "glObjectLabel";
+        case EntryPointGL::ObjectPtrLabel:
+            return "glObjectPtrLabel";
+        case EntryPointGL::PatchParameterfv:
+            return "glPatchParameterfv";
+        case EntryPointGL::PatchParameteri:
+            return "glPatchParameteri";
+        case EntryPointGL::PathCommandsNV:
+            return "glPathCommandsNV";
+        case EntryPointGL::PathParameterfNV:
+            return "glPathParameterfNV";
+        case EntryPointGL::PathParameteriNV:
+            return "glPathParameteriNV";
+        case EntryPointGL::PathStencilFuncNV:
+            return "glPathStencilFuncNV";
+        case EntryPointGL::PauseTransformFeedback:
+            return "glPauseTransformFeedback";
+        case EntryPointGL::PixelStoref:
+            return "glPixelStoref";
+        case EntryPointGL::PixelStorei:
+            return "glPixelStorei";
+        case EntryPointGL::PointParameterf:
+            return "glPointParameterf";
+        case EntryPointGL::PointParameterfv:
+            return "glPointParameterfv";
+        case EntryPointGL::PointParameteri:
+            return "glPointParameteri";
+        case EntryPointGL::PointParameteriv:
+            return "glPointParameteriv";
+        case EntryPointGL::PointSize:
+            return "glPointSize";
+        case EntryPointGL::PolygonMode:
+            return "glPolygonMode";
+        case EntryPointGL::PolygonOffset:
+            return "glPolygonOffset";
+        case EntryPointGL::PopDebugGroup:
+            return "glPopDebugGroup";
+        case EntryPointGL::PopGroupMarkerEXT:
+            return "glPopGroupMarkerEXT";
+        case EntryPointGL::PrimitiveBoundingBox:
+            return "glPrimitiveBoundingBox";
+        case EntryPointGL::PrimitiveRestartIndex:
+            return "glPrimitiveRestartIndex";
+        case EntryPointGL::ProgramBinary:
+            return "glProgramBinary";
+        case EntryPointGL::ProgramParameteri:
+            return "glProgramParameteri";
+        case EntryPointGL::ProgramPathFragmentInputGenNV:
+            return "glProgramPathFragmentInputGenNV";
+        case EntryPointGL::ProgramUniform1d:
+            return "glProgramUniform1d";
+        case EntryPointGL::ProgramUniform1dv:
+            return "glProgramUniform1dv";
+        case EntryPointGL::ProgramUniform1f:
+            return "glProgramUniform1f";
+        case EntryPointGL::ProgramUniform1fv:
+            return "glProgramUniform1fv";
+        case EntryPointGL::ProgramUniform1i:
+            return "glProgramUniform1i";
+        case EntryPointGL::ProgramUniform1iv:
+            return "glProgramUniform1iv";
+        case EntryPointGL::ProgramUniform1ui:
+            return "glProgramUniform1ui";
+        case EntryPointGL::ProgramUniform1uiv:
+            return "glProgramUniform1uiv";
+        case EntryPointGL::ProgramUniform2d:
+            return "glProgramUniform2d";
+        case EntryPointGL::ProgramUniform2dv:
+            return "glProgramUniform2dv";
+        case EntryPointGL::ProgramUniform2f:
+            return "glProgramUniform2f";
+        case EntryPointGL::ProgramUniform2fv:
+            return "glProgramUniform2fv";
+        case EntryPointGL::ProgramUniform2i:
+            return "glProgramUniform2i";
+        case EntryPointGL::ProgramUniform2iv:
+            return "glProgramUniform2iv";
+        case EntryPointGL::ProgramUniform2ui:
+            return "glProgramUniform2ui";
+        case EntryPointGL::ProgramUniform2uiv:
+            return "glProgramUniform2uiv";
+        case EntryPointGL::ProgramUniform3d:
+            return "glProgramUniform3d";
+        case EntryPointGL::ProgramUniform3dv:
+            return "glProgramUniform3dv";
+        case EntryPointGL::ProgramUniform3f:
+            return "glProgramUniform3f";
+        case EntryPointGL::ProgramUniform3fv:
+            return "glProgramUniform3fv";
+        case EntryPointGL::ProgramUniform3i:
+            return "glProgramUniform3i";
+        case EntryPointGL::ProgramUniform3iv:
+            return "glProgramUniform3iv";
+        case EntryPointGL::ProgramUniform3ui:
+            return "glProgramUniform3ui";
+        case EntryPointGL::ProgramUniform3uiv:
+            return "glProgramUniform3uiv";
+        case EntryPointGL::ProgramUniform4d:
+            return "glProgramUniform4d";
+        case EntryPointGL::ProgramUniform4dv:
+            return "glProgramUniform4dv";
+        case EntryPointGL::ProgramUniform4f:
+            return "glProgramUniform4f";
+        case EntryPointGL::ProgramUniform4fv:
+            return "glProgramUniform4fv";
+        case EntryPointGL::ProgramUniform4i:
+            return "glProgramUniform4i";
+        case EntryPointGL::ProgramUniform4iv:
+            return "glProgramUniform4iv";
+        case EntryPointGL::ProgramUniform4ui:
+            return "glProgramUniform4ui";
+        case EntryPointGL::ProgramUniform4uiv:
+            return "glProgramUniform4uiv";
+        case EntryPointGL::ProgramUniformMatrix2dv:
+            return "glProgramUniformMatrix2dv";
+        case EntryPointGL::ProgramUniformMatrix2fv:
+            return "glProgramUniformMatrix2fv";
+        case EntryPointGL::ProgramUniformMatrix2x3dv:
+            return "glProgramUniformMatrix2x3dv";
+        case EntryPointGL::ProgramUniformMatrix2x3fv:
+            return "glProgramUniformMatrix2x3fv";
+        case EntryPointGL::ProgramUniformMatrix2x4dv:
+            return "glProgramUniformMatrix2x4dv";
+        case EntryPointGL::ProgramUniformMatrix2x4fv:
+            return "glProgramUniformMatrix2x4fv";
+        case EntryPointGL::ProgramUniformMatrix3dv:
+            return "glProgramUniformMatrix3dv";
+        case EntryPointGL::ProgramUniformMatrix3fv:
+            return "glProgramUniformMatrix3fv";
+        case EntryPointGL::ProgramUniformMatrix3x2dv:
+            return "glProgramUniformMatrix3x2dv";
+        case EntryPointGL::ProgramUniformMatrix3x2fv:
+            return "glProgramUniformMatrix3x2fv";
+        case EntryPointGL::ProgramUniformMatrix3x4dv:
+            return "glProgramUniformMatrix3x4dv";
+        case EntryPointGL::ProgramUniformMatrix3x4fv:
+            return "glProgramUniformMatrix3x4fv";
+        case EntryPointGL::ProgramUniformMatrix4dv:
+            return "glProgramUniformMatrix4dv";
+        case EntryPointGL::ProgramUniformMatrix4fv:
+            return "glProgramUniformMatrix4fv";
+        case EntryPointGL::ProgramUniformMatrix4x2dv:
+            return "glProgramUniformMatrix4x2dv";
+        case EntryPointGL::ProgramUniformMatrix4x2fv:
+            return "glProgramUniformMatrix4x2fv";
+        case EntryPointGL::ProgramUniformMatrix4x3dv:
+            return "glProgramUniformMatrix4x3dv";
+        case EntryPointGL::ProgramUniformMatrix4x3fv:
+            return "glProgramUniformMatrix4x3fv";
+        case EntryPointGL::ProvokingVertex:
+            return "glProvokingVertex";
+        case EntryPointGL::PushDebugGroup:
+            return "glPushDebugGroup";
+        case EntryPointGL::PushGroupMarkerEXT:
+            return "glPushGroupMarkerEXT";
+        case EntryPointGL::QueryCounter:
+            return "glQueryCounter";
+        case EntryPointGL::ReadBuffer:
+            return "glReadBuffer";
+        case EntryPointGL::ReadPixels:
+            return "glReadPixels";
+        case EntryPointGL::ReadnPixels:
+            return "glReadnPixels";
+        case EntryPointGL::ReleaseShaderCompiler:
+            return "glReleaseShaderCompiler";
+        case EntryPointGL::RenderbufferStorage:
+            return "glRenderbufferStorage";
+        case EntryPointGL::RenderbufferStorageMultisample:
+            return "glRenderbufferStorageMultisample";
+        case EntryPointGL::ResumeTransformFeedback:
+            return "glResumeTransformFeedback";
+        case EntryPointGL::SampleCoverage:
+            return "glSampleCoverage";
+        case EntryPointGL::SampleMaski:
+            return "glSampleMaski";
+        case EntryPointGL::SamplerParameterIiv:
+            return "glSamplerParameterIiv";
+        case EntryPointGL::SamplerParameterIuiv:
+            return "glSamplerParameterIuiv";
+        case EntryPointGL::SamplerParameterf:
+            return "glSamplerParameterf";
+        case EntryPointGL::SamplerParameterfv:
+            return "glSamplerParameterfv";
+        case EntryPointGL::SamplerParameteri:
+            return "glSamplerParameteri";
+        case EntryPointGL::SamplerParameteriv:
+            return "glSamplerParameteriv";
+        case EntryPointGL::Scissor:
+            return "glScissor";
+        case EntryPointGL::ScissorArrayv:
+            return "glScissorArrayv";
+        case EntryPointGL::ScissorIndexed:
+            return "glScissorIndexed";
+        case EntryPointGL::ScissorIndexedv:
+            return "glScissorIndexedv";
+        case EntryPointGL::SetFenceNV:
+            return "glSetFenceNV";
+        case EntryPointGL::ShaderBinary:
+            return "glShaderBinary";
+        case EntryPointGL::ShaderSource:
+            return "glShaderSource";
+        case EntryPointGL::ShaderStorageBlockBinding:
+            return "glShaderStorageBlockBinding";
+        case EntryPointGL::StencilFillPathInstancedNV:
+            return "glStencilFillPathInstancedNV";
+        case EntryPointGL::StencilFillPathNV:
+            return "glStencilFillPathNV";
+        case EntryPointGL::StencilFunc:
+            return "glStencilFunc";
+        case EntryPointGL::StencilFuncSeparate:
+            return "glStencilFuncSeparate";
+        case EntryPointGL::StencilMask:
+            return "glStencilMask";
+        case EntryPointGL::StencilMaskSeparate:
+            return "glStencilMaskSeparate";
+        case EntryPointGL::StencilOp:
+            return "glStencilOp";
+        case EntryPointGL::StencilOpSeparate:
+            return "glStencilOpSeparate";
+        case EntryPointGL::StencilStrokePathInstancedNV:
+            return "glStencilStrokePathInstancedNV";
+        case EntryPointGL::StencilStrokePathNV:
+            return "glStencilStrokePathNV";
+        case EntryPointGL::StencilThenCoverFillPathInstancedNV:
+            return "glStencilThenCoverFillPathInstancedNV";
+        case EntryPointGL::StencilThenCoverFillPathNV:
+            return "glStencilThenCoverFillPathNV";
+        case EntryPointGL::StencilThenCoverStrokePathInstancedNV:
+            return "glStencilThenCoverStrokePathInstancedNV";
+        case EntryPointGL::StencilThenCoverStrokePathNV:
+            return "glStencilThenCoverStrokePathNV";
+        case EntryPointGL::TestFenceNV:
+            return "glTestFenceNV";
+        case EntryPointGL::TexBuffer:
+            return "glTexBuffer";
+        case EntryPointGL::TexBufferRange:
+            return "glTexBufferRange";
+        case EntryPointGL::TexImage1D:
+            return "glTexImage1D";
+        case EntryPointGL::TexImage2D:
+            return "glTexImage2D";
+        case EntryPointGL::TexImage2DMultisample:
+            return "glTexImage2DMultisample";
+        case EntryPointGL::TexImage3D:
+            return "glTexImage3D";
+        case EntryPointGL::TexImage3DMultisample:
+            return "glTexImage3DMultisample";
+        case EntryPointGL::TexParameterIiv:
+            return "glTexParameterIiv";
+        case EntryPointGL::TexParameterIuiv:
+            return "glTexParameterIuiv";
+        case EntryPointGL::TexParameterf:
+            return "glTexParameterf";
+        case EntryPointGL::TexParameterfv:
+            return "glTexParameterfv";
+        case EntryPointGL::TexParameteri:
+            return "glTexParameteri";
+        case EntryPointGL::TexParameteriv:
+            return "glTexParameteriv";
+        case EntryPointGL::TexStorage1D:
+            return "glTexStorage1D";
+        case EntryPointGL::TexStorage2D:
+            return "glTexStorage2D";
+        case EntryPointGL::TexStorage2DMultisample:
+            return "glTexStorage2DMultisample";
+        case EntryPointGL::TexStorage3D:
+            return "glTexStorage3D";
+        case EntryPointGL::TexStorage3DMultisample:
+            return "glTexStorage3DMultisample";
+        case EntryPointGL::TexSubImage1D:
+            return "glTexSubImage1D";
+        case EntryPointGL::TexSubImage2D:
+            return "glTexSubImage2D";
+        case EntryPointGL::TexSubImage3D:
+            return "glTexSubImage3D";
+        case EntryPointGL::TextureBarrier:
+            return "glTextureBarrier";
+        case EntryPointGL::TextureBuffer:
+            return "glTextureBuffer";
+        case EntryPointGL::TextureBufferRange:
+            return "glTextureBufferRange";
+        case EntryPointGL::TextureParameterIiv:
+            return "glTextureParameterIiv";
+        case EntryPointGL::TextureParameterIuiv:
+            return "glTextureParameterIuiv";
+        case EntryPointGL::TextureParameterf:
+            return "glTextureParameterf";
+        case EntryPointGL::TextureParameterfv:
+            return "glTextureParameterfv";
+        case EntryPointGL::TextureParameteri:
+            return "glTextureParameteri";
+        case EntryPointGL::TextureParameteriv:
+            return "glTextureParameteriv";
+        case EntryPointGL::TextureStorage1D:
+            return "glTextureStorage1D";
+        case EntryPointGL::TextureStorage2D:
+            return "glTextureStorage2D";
+        case EntryPointGL::TextureStorage2DMultisample:
+            return "glTextureStorage2DMultisample";
+        case EntryPointGL::TextureStorage3D:
+            return "glTextureStorage3D";
+        case EntryPointGL::TextureStorage3DMultisample:
+            return "glTextureStorage3DMultisample";
+        case EntryPointGL::TextureSubImage1D:
+            return "glTextureSubImage1D";
+        case EntryPointGL::TextureSubImage2D:
+            return "glTextureSubImage2D";
+        case EntryPointGL::TextureSubImage3D:
+            return "glTextureSubImage3D";
+        case EntryPointGL::TextureView:
+            return "glTextureView";
+        case EntryPointGL::TransformFeedbackBufferBase:
+            return "glTransformFeedbackBufferBase";
+        case EntryPointGL::TransformFeedbackBufferRange:
+            return "glTransformFeedbackBufferRange";
+        case EntryPointGL::TransformFeedbackVaryings:
+            return "glTransformFeedbackVaryings";
+        case EntryPointGL::Uniform1d:
+            return "glUniform1d";
+        case EntryPointGL::Uniform1dv:
+            return "glUniform1dv";
+        case EntryPointGL::Uniform1f:
+            return "glUniform1f";
+        case EntryPointGL::Uniform1fv:
+            return "glUniform1fv";
+        case EntryPointGL::Uniform1i:
+            return "glUniform1i";
+        case EntryPointGL::Uniform1iv:
+            return "glUniform1iv";
+        case EntryPointGL::Uniform1ui:
+            return "glUniform1ui";
+        case EntryPointGL::Uniform1uiv:
+            return "glUniform1uiv";
+        case EntryPointGL::Uniform2d:
+            return "glUniform2d";
+        case EntryPointGL::Uniform2dv:
+            return "glUniform2dv";
+        case EntryPointGL::Uniform2f:
+            return "glUniform2f";
+        case EntryPointGL::Uniform2fv:
+            return "glUniform2fv";
+        case EntryPointGL::Uniform2i:
+            return "glUniform2i";
+        case EntryPointGL::Uniform2iv:
+            return "glUniform2iv";
+        case EntryPointGL::Uniform2ui:
+            return "glUniform2ui";
+        case EntryPointGL::Uniform2uiv:
+            return "glUniform2uiv";
+        case EntryPointGL::Uniform3d:
+            return "glUniform3d";
+        case EntryPointGL::Uniform3dv:
+            return "glUniform3dv";
+        case EntryPointGL::Uniform3f:
+            return "glUniform3f";
+        case EntryPointGL::Uniform3fv:
+            return "glUniform3fv";
+        case EntryPointGL::Uniform3i:
+            return "glUniform3i";
+        case EntryPointGL::Uniform3iv:
+            return "glUniform3iv";
+        case EntryPointGL::Uniform3ui:
+            return "glUniform3ui";
+        case EntryPointGL::Uniform3uiv:
+            return "glUniform3uiv";
+        case EntryPointGL::Uniform4d:
+            return "glUniform4d";
+        case EntryPointGL::Uniform4dv:
+            return "glUniform4dv";
+        case EntryPointGL::Uniform4f:
+            return "glUniform4f";
+        case EntryPointGL::Uniform4fv:
+            return "glUniform4fv";
+        case EntryPointGL::Uniform4i:
+            return "glUniform4i";
+        case EntryPointGL::Uniform4iv:
+            return "glUniform4iv";
+        case EntryPointGL::Uniform4ui:
+            return "glUniform4ui";
+        case EntryPointGL::Uniform4uiv:
+            return "glUniform4uiv";
+        case EntryPointGL::UniformBlockBinding:
+            return "glUniformBlockBinding";
+        case EntryPointGL::UniformMatrix2dv:
+            return "glUniformMatrix2dv";
+        case EntryPointGL::UniformMatrix2fv:
+            return "glUniformMatrix2fv";
+        case EntryPointGL::UniformMatrix2x3dv:
+            return "glUniformMatrix2x3dv";
+        case EntryPointGL::UniformMatrix2x3fv:
+            return "glUniformMatrix2x3fv";
+        case EntryPointGL::UniformMatrix2x4dv:
+            return "glUniformMatrix2x4dv";
+        case EntryPointGL::UniformMatrix2x4fv:
+            return "glUniformMatrix2x4fv";
+        case EntryPointGL::UniformMatrix3dv:
+            return "glUniformMatrix3dv";
+        case EntryPointGL::UniformMatrix3fv:
+            return "glUniformMatrix3fv";
+        case EntryPointGL::UniformMatrix3x2dv:
+            return "glUniformMatrix3x2dv";
+        case EntryPointGL::UniformMatrix3x2fv:
+            return "glUniformMatrix3x2fv";
+        case EntryPointGL::UniformMatrix3x4dv:
+            return "glUniformMatrix3x4dv";
+        case EntryPointGL::UniformMatrix3x4fv:
+            return "glUniformMatrix3x4fv";
+        case EntryPointGL::UniformMatrix4dv:
+            return "glUniformMatrix4dv";
+        case EntryPointGL::UniformMatrix4fv:
+            return "glUniformMatrix4fv";
+        case EntryPointGL::UniformMatrix4x2dv:
+            return "glUniformMatrix4x2dv";
+        case EntryPointGL::UniformMatrix4x2fv:
+            return "glUniformMatrix4x2fv";
+        case EntryPointGL::UniformMatrix4x3dv:
+            return "glUniformMatrix4x3dv";
+        case EntryPointGL::UniformMatrix4x3fv:
+            return "glUniformMatrix4x3fv";
+        case EntryPointGL::UniformSubroutinesuiv:
+            return "glUniformSubroutinesuiv";
+        case EntryPointGL::UnmapBuffer:
+            return "glUnmapBuffer";
+        case EntryPointGL::UnmapNamedBuffer:
+            return "glUnmapNamedBuffer";
+        case EntryPointGL::UseProgram:
+            return "glUseProgram";
+        case EntryPointGL::UseProgramStages:
+            return "glUseProgramStages";
+        case EntryPointGL::ValidateProgram:
+            return "glValidateProgram";
+        case EntryPointGL::ValidateProgramPipeline:
+            return "glValidateProgramPipeline";
+        case EntryPointGL::VertexArrayAttribBinding:
+            return "glVertexArrayAttribBinding";
+        case EntryPointGL::VertexArrayAttribFormat:
+            return "glVertexArrayAttribFormat";
+        case EntryPointGL::VertexArrayAttribIFormat:
+            return "glVertexArrayAttribIFormat";
+        case EntryPointGL::VertexArrayAttribLFormat:
+            return "glVertexArrayAttribLFormat";
+        case EntryPointGL::VertexArrayBindingDivisor:
+            return "glVertexArrayBindingDivisor";
+        case EntryPointGL::VertexArrayElementBuffer:
+            return "glVertexArrayElementBuffer";
+        case EntryPointGL::VertexArrayVertexBuffer:
+            return "glVertexArrayVertexBuffer";
+        case EntryPointGL::VertexArrayVertexBuffers:
+            return "glVertexArrayVertexBuffers";
+        case EntryPointGL::VertexAttrib1d:
+            return "glVertexAttrib1d";
+        case EntryPointGL::VertexAttrib1dv:
+            return "glVertexAttrib1dv";
+        case EntryPointGL::VertexAttrib1f:
+            return "glVertexAttrib1f";
+        case EntryPointGL::VertexAttrib1fv:
+            return "glVertexAttrib1fv";
+        case EntryPointGL::VertexAttrib1s:
+            return "glVertexAttrib1s";
+        case EntryPointGL::VertexAttrib1sv:
+            return "glVertexAttrib1sv";
+        case EntryPointGL::VertexAttrib2d:
+            return "glVertexAttrib2d";
+        case EntryPointGL::VertexAttrib2dv:
+            return "glVertexAttrib2dv";
+        case EntryPointGL::VertexAttrib2f:
+            return "glVertexAttrib2f";
+        case EntryPointGL::VertexAttrib2fv:
+            return "glVertexAttrib2fv";
+        case EntryPointGL::VertexAttrib2s:
+            return "glVertexAttrib2s";
+        case EntryPointGL::VertexAttrib2sv:
+            return "glVertexAttrib2sv";
+        case EntryPointGL::VertexAttrib3d:
+            return "glVertexAttrib3d";
+        case EntryPointGL::VertexAttrib3dv:
+            return "glVertexAttrib3dv";
+        case EntryPointGL::VertexAttrib3f:
+            return "glVertexAttrib3f";
+        case EntryPointGL::VertexAttrib3fv:
+            return "glVertexAttrib3fv";
+        case EntryPointGL::VertexAttrib3s:
+            return "glVertexAttrib3s";
+        case EntryPointGL::VertexAttrib3sv:
+            return "glVertexAttrib3sv";
+        case EntryPointGL::VertexAttrib4Nbv:
+            return "glVertexAttrib4Nbv";
+        case EntryPointGL::VertexAttrib4Niv:
+            return "glVertexAttrib4Niv";
+        case EntryPointGL::VertexAttrib4Nsv:
+            return "glVertexAttrib4Nsv";
+        case EntryPointGL::VertexAttrib4Nub:
+            return "glVertexAttrib4Nub";
+        case EntryPointGL::VertexAttrib4Nubv:
+            return "glVertexAttrib4Nubv";
+        case EntryPointGL::VertexAttrib4Nuiv:
+            return "glVertexAttrib4Nuiv";
+        case EntryPointGL::VertexAttrib4Nusv:
+            return "glVertexAttrib4Nusv";
+        case EntryPointGL::VertexAttrib4bv:
+            return "glVertexAttrib4bv";
+        case EntryPointGL::VertexAttrib4d:
+            return "glVertexAttrib4d";
+        case EntryPointGL::VertexAttrib4dv:
+            return "glVertexAttrib4dv";
+        case EntryPointGL::VertexAttrib4f:
+            return "glVertexAttrib4f";
+        case EntryPointGL::VertexAttrib4fv:
+            return "glVertexAttrib4fv";
+        case EntryPointGL::VertexAttrib4iv:
+            return "glVertexAttrib4iv";
+        case EntryPointGL::VertexAttrib4s:
+            return "glVertexAttrib4s";
+        case EntryPointGL::VertexAttrib4sv:
+            return "glVertexAttrib4sv";
+        case EntryPointGL::VertexAttrib4ubv:
+            return "glVertexAttrib4ubv";
+        case EntryPointGL::VertexAttrib4uiv:
+            return "glVertexAttrib4uiv";
+        case EntryPointGL::VertexAttrib4usv:
+            return "glVertexAttrib4usv";
+        case EntryPointGL::VertexAttribBinding:
+            return "glVertexAttribBinding";
+        case EntryPointGL::VertexAttribDivisor:
+            return "glVertexAttribDivisor";
+        case EntryPointGL::VertexAttribFormat:
+            return "glVertexAttribFormat";
+        case EntryPointGL::VertexAttribI1i:
+            return "glVertexAttribI1i";
+        case EntryPointGL::VertexAttribI1iv:
+            return "glVertexAttribI1iv";
+        case EntryPointGL::VertexAttribI1ui:
+            return "glVertexAttribI1ui";
+        case EntryPointGL::VertexAttribI1uiv:
+            return "glVertexAttribI1uiv";
+        case EntryPointGL::VertexAttribI2i:
+            return "glVertexAttribI2i";
+        case EntryPointGL::VertexAttribI2iv:
+            return "glVertexAttribI2iv";
+        case EntryPointGL::VertexAttribI2ui:
+            return "glVertexAttribI2ui";
+        case EntryPointGL::VertexAttribI2uiv:
+            return "glVertexAttribI2uiv";
+        case EntryPointGL::VertexAttribI3i:
+            return "glVertexAttribI3i";
+        case EntryPointGL::VertexAttribI3iv:
+            return "glVertexAttribI3iv";
+        case EntryPointGL::VertexAttribI3ui:
+            return "glVertexAttribI3ui";
+        case EntryPointGL::VertexAttribI3uiv:
+            return "glVertexAttribI3uiv";
+        case EntryPointGL::VertexAttribI4bv:
+            return "glVertexAttribI4bv";
+        case EntryPointGL::VertexAttribI4i:
+            return "glVertexAttribI4i";
+        case EntryPointGL::VertexAttribI4iv:
+            return "glVertexAttribI4iv";
+        case EntryPointGL::VertexAttribI4sv:
+            return "glVertexAttribI4sv";
+        case EntryPointGL::VertexAttribI4ubv:
+            return "glVertexAttribI4ubv";
+        case EntryPointGL::VertexAttribI4ui:
+            return "glVertexAttribI4ui";
+        case EntryPointGL::VertexAttribI4uiv:
+            return "glVertexAttribI4uiv";
+        case EntryPointGL::VertexAttribI4usv:
+            return "glVertexAttribI4usv";
+        case EntryPointGL::VertexAttribIFormat:
+            return "glVertexAttribIFormat";
+        case EntryPointGL::VertexAttribIPointer:
+            return "glVertexAttribIPointer";
+        case EntryPointGL::VertexAttribL1d:
+            return "glVertexAttribL1d";
+        case EntryPointGL::VertexAttribL1dv:
+            return "glVertexAttribL1dv";
+        case EntryPointGL::VertexAttribL2d:
+            return "glVertexAttribL2d";
+        case EntryPointGL::VertexAttribL2dv:
+            return "glVertexAttribL2dv";
+        case EntryPointGL::VertexAttribL3d:
+            return "glVertexAttribL3d";
+        case EntryPointGL::VertexAttribL3dv:
+            return "glVertexAttribL3dv";
+        case EntryPointGL::VertexAttribL4d:
+            return "glVertexAttribL4d";
+        case EntryPointGL::VertexAttribL4dv:
+            return "glVertexAttribL4dv";
+        case EntryPointGL::VertexAttribLFormat:
+            return "glVertexAttribLFormat";
+        case EntryPointGL::VertexAttribLPointer:
+            return "glVertexAttribLPointer";
+        case EntryPointGL::VertexAttribP1ui:
+            return "glVertexAttribP1ui";
+        case EntryPointGL::VertexAttribP1uiv:
+            return "glVertexAttribP1uiv";
+        case EntryPointGL::VertexAttribP2ui:
+            return "glVertexAttribP2ui";
+        case EntryPointGL::VertexAttribP2uiv:
+            return "glVertexAttribP2uiv";
+        case EntryPointGL::VertexAttribP3ui:
+            return "glVertexAttribP3ui";
+        case EntryPointGL::VertexAttribP3uiv:
+            return "glVertexAttribP3uiv";
+        case EntryPointGL::VertexAttribP4ui:
+            return "glVertexAttribP4ui";
+        case EntryPointGL::VertexAttribP4uiv:
+            return "glVertexAttribP4uiv";
+        case EntryPointGL::VertexAttribPointer:
+            return "glVertexAttribPointer";
+        case EntryPointGL::VertexBindingDivisor:
+            return "glVertexBindingDivisor";
+        case EntryPointGL::Viewport:
+            return "glViewport";
+        case EntryPointGL::ViewportArrayv:
+            return "glViewportArrayv";
+        case EntryPointGL::ViewportIndexedf:
+            return "glViewportIndexedf";
+        case EntryPointGL::ViewportIndexedfv:
+            return "glViewportIndexedfv";
+        case EntryPointGL::WaitSync:
+            return "glWaitSync";
+        default:
+            UNREACHABLE();
+            return "invalid";
+    }
+}
+
+void InstallCallCounterHooks(size_t slot, DispatchTableGL *table, CallCounterTableGL *originals)
+{
+    switch (slot)
+    {
+        case 0:
+            InstallHooks<0>(table, originals);
+            break;
+        case 1:
+            InstallHooks<1>(table, originals);
+            break;
+        case 2:
+            InstallHooks<2>(table, originals);
+            break;
+        case 3:
+            InstallHooks<3>(table, originals);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+}  // namespace rx
@@ -0,0 +1,732 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by generate_gl_dispatch_table.py using data from gl_bindings_data.json and gl.xml.
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// call_counters_autogen.h:
+//   Declares the native entry points counted by the instrumented OpenGL back-end.
+
+#ifndef LIBGLESV2_RENDERER_GL_CALL_COUNTERS_AUTOGEN_H_
+#define LIBGLESV2_RENDERER_GL_CALL_COUNTERS_AUTOGEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace rx
+{
+class CallCounterTableGL;
+class DispatchTableGL;
+
+enum class EntryPointGL : uint16_t
+{
+    ActiveShaderProgram,
+    ActiveTexture,
+    AttachShader,
+    BeginConditionalRender,
+    BeginQuery,
+    BeginQueryIndexed,
+    BeginTransformFeedback,
+    BindAttribLocation,
+    BindBuffer,
+    BindBufferBase,
+    BindBufferRange,
+    BindBuffersBase,
+    BindBuffersRange,
+    BindFragDataLocation,
+    BindFragDataLocationIndexed,
+    BindFramebuffer,
+    BindImageTexture,
+    BindImageTextures,
+    BindProgramPipeline,
+    BindRenderbuffer,
+    BindSampler,
+    BindSamplers,
+    BindTexture,
+    BindTextureUnit,
+    BindTextures,
+    BindTransformFeedback,
+    BindVertexArray,
+    BindVertexBuffer,
+    BindVertexBuffers,
+    BlendBarrier,
+    BlendColor,
+    BlendEquation,
+    BlendEquationSeparate,
+    BlendEquationSeparatei,
+    BlendEquationi,
+    BlendFunc,
+    BlendFuncSeparate,
+    BlendFuncSeparatei,
+    BlendFunci,
+    BlitFramebuffer,
+    BlitNamedFramebuffer,
+    BufferData,
+    BufferStorage,
+    BufferSubData,
+    CheckFramebufferStatus,
+    CheckNamedFramebufferStatus,
+    ClampColor,
+    Clear,
+    ClearBufferData,
+    ClearBufferSubData,
+    ClearBufferfi,
+    ClearBufferfv,
+    ClearBufferiv,
+    ClearBufferuiv,
+    ClearColor,
+    ClearDepth,
+    ClearDepthf,
+    ClearNamedBufferData,
+    ClearNamedBufferSubData,
+    ClearNamedFramebufferfi,
+    ClearNamedFramebufferfv,
+    ClearNamedFramebufferiv,
+    ClearNamedFramebufferuiv,
+    ClearStencil,
+    ClearTexImage,
+    ClearTexSubImage,
+    ClientWaitSync,
+    ClipControl,
+    ColorMask,
+    ColorMaski,
+    CompileShader,
+    CompressedTexImage1D,
+    CompressedTexImage2D,
+    CompressedTexImage3D,
+    CompressedTexSubImage1D,
+    CompressedTexSubImage2D,
+    CompressedTexSubImage3D,
+    CompressedTextureSubImage1D,
+    CompressedTextureSubImage2D,
+    CompressedTextureSubImage3D,
+    CopyBufferSubData,
+    CopyImageSubData,
+    CopyNamedBufferSubData,
+    CopyTexImage1D,
+    CopyTexImage2D,
+    CopyTexSubImage1D,
+    CopyTexSubImage2D,
+    CopyTexSubImage3D,
+    CopyTextureSubImage1D,
+    CopyTextureSubImage2D,
+    CopyTextureSubImage3D,
+    CoverFillPathInstancedNV,
+    CoverFillPathNV,
+    CoverStrokePathInstancedNV,
+    CoverStrokePathNV,
+    CoverageModulationNV,
+    CreateBuffers,
+    CreateFramebuffers,
+    CreateProgram,
+    CreateProgramPipelines,
+    CreateQueries,
+    CreateRenderbuffers,
+    CreateSamplers,
+    CreateShader,
+    CreateShaderProgramv,
+    CreateTextures,
+    CreateTransformFeedbacks,
+    CreateVertexArrays,
+    CullFace,
+    DebugMessageCallback,
+    DebugMessageControl,
+    DebugMessageInsert,
+    DeleteBuffers,
+    DeleteFencesNV,
+    DeleteFramebuffers,
+    DeletePathsNV,
+    DeleteProgram,
+    DeleteProgramPipelines,
+    DeleteQueries,
+    DeleteRenderbuffers,
+    DeleteSamplers,
+    DeleteShader,
+    DeleteSync,
+    DeleteTextures,
+    DeleteTransformFeedbacks,
+    DeleteVertexArrays,
+    DepthFunc,
+    DepthMask,
+    DepthRange,
+    DepthRangeArrayv,
+    DepthRangeIndexed,
+    DepthRangef,
+    DetachShader,
+    Disable,
+    DisableVertexArrayAttrib,
+    DisableVertexAttribArray,
+    Disablei,
+    DiscardFramebufferEXT,
+    DispatchCompute,
+    DispatchComputeIndirect,
+    DrawArrays,
+    DrawArraysIndirect,
+    DrawArraysInstanced,
+    DrawArraysInstancedBaseInstance,
+    DrawBuffer,
+    DrawBuffers,
+    DrawElements,
+    DrawElementsBaseVertex,
+    DrawElementsIndirect,
+    DrawElementsInstanced,
+    DrawElementsInstancedBaseInstance,
+    DrawElementsInstancedBaseVertex,
+    DrawElementsInstancedBaseVertexBaseInstance,
+    DrawRangeElements,
+    DrawRangeElementsBaseVertex,
+    DrawTransformFeedback,
+    DrawTransformFeedbackInstanced,
+    DrawTransformFeedbackStream,
+    DrawTransformFeedbackStreamInstanced,
+    EGLImageTargetRenderbufferStorageOES,
+    EGLImageTargetTexture2DOES,
+    Enable,
+    EnableVertexArrayAttrib,
+    EnableVertexAttribArray,
+    Enablei,
+    EndConditionalRender,
+    EndQuery,
+    EndQueryIndexed,
+    EndTransformFeedback,
+    FenceSync,
+    Finish,
+    FinishFenceNV,
+    Flush,
+    FlushMappedBufferRange,
+    FlushMappedNamedBufferRange,
+    FramebufferParameteri,
+    FramebufferRenderbuffer,
+    FramebufferTexture,
+    FramebufferTexture1D,
+    FramebufferTexture2D,
+    FramebufferTexture3D,
+    FramebufferTextureLayer,
+    FrontFace,
+    GenBuffers,
+    GenFencesNV,
+    GenFramebuffers,
+    GenPathsNV,
+    GenProgramPipelines,
+    GenQueries,
+    GenRenderbuffers,
+    GenSamplers,
+    GenTextures,
+    GenTransformFeedbacks,
+    GenVertexArrays,
+    GenerateMipmap,
+    GenerateTextureMipmap,
+    GetActiveAtomicCounterBufferiv,
+    GetActiveAttrib,
+    GetActiveSubroutineName,
+    GetActiveSubroutineUniformName,
+    GetActiveSubroutineUniformiv,
+    GetActiveUniform,
+    GetActiveUniformBlockName,
+    GetActiveUniformBlockiv,
+    GetActiveUniformName,
+    GetActiveUniformsiv,
+    GetAttachedShaders,
+    GetAttribLocation,
+    GetBooleani_v,
+    GetBooleanv,
+    GetBufferParameteri64v,
+    GetBufferParameteriv,
+    GetBufferPointerv,
+    GetBufferSubData,
+    GetCompressedTexImage,
+    GetCompressedTextureImage,
+    GetCompressedTextureSubImage,
+    GetDebugMessageLog,
+    GetDoublei_v,
+    GetDoublev,
+    GetError,
+    GetFenceivNV,
+    GetFloati_v,
+    GetFloatv,
+    GetFragDataIndex,
+    GetFragDataLocation,
+    GetFramebufferAttachmentParameteriv,
+    GetFramebufferParameteriv,
+    GetGraphicsResetStatus,
+    GetInteger64i_v,
+    GetInteger64v,
+    GetIntegeri_v,
+    GetIntegerv,
+    GetInternalformatSampleivNV,
+    GetInternalformati64v,
+    GetInternalformativ,
+    GetMultisamplefv,
+    GetNamedBufferParameteri64v,
+    GetNamedBufferParameteriv,
+    GetNamedBufferPointerv,
+    GetNamedBufferSubData,
+    GetNamedFramebufferAttachmentParameteriv,
+    GetNamedFramebufferParameteriv,
+    GetNamedRenderbufferParameteriv,
+    GetObjectLabel,
+    GetObjectPtrLabel,
+    GetPathParameterfvNV,
+    GetPathParameterivNV,
+    GetPointerv,
+    GetProgramBinary,
+    GetProgramInfoLog,
+    GetProgramInterfaceiv,
+    GetProgramPipelineInfoLog,
+    GetProgramPipelineiv,
+    GetProgramResourceIndex,
+    GetProgramResourceLocation,
+    GetProgramResourceLocationIndex,
+    GetProgramResourceName,
+    GetProgramResourceiv,
+    GetProgramStageiv,
+    GetProgramiv,
+    GetQueryBufferObjecti64v,
+    GetQueryBufferObjectiv,
+    GetQueryBufferObjectui64v,
+    GetQueryBufferObjectuiv,
+    GetQueryIndexediv,
+    GetQueryObjecti64v,
+    GetQueryObjectiv,
+    GetQueryObjectui64v,
+    GetQueryObjectuiv,
+    GetQueryiv,
+    GetRenderbufferParameteriv,
+    GetSamplerParameterIiv,
+    GetSamplerParameterIuiv,
+    GetSamplerParameterfv,
+    GetSamplerParameteriv,
+    GetShaderInfoLog,
+    GetShaderPrecisionFormat,
+    GetShaderSource,
+    GetShaderiv,
+    GetString,
+    GetStringi,
+    GetSubroutineIndex,
+    GetSubroutineUniformLocation,
+    GetSynciv,
+    GetTexImage,
+    GetTexLevelParameterfv,
+    GetTexLevelParameteriv,
+    GetTexParameterIiv,
+    GetTexParameterIuiv,
+    GetTexParameterfv,
+    GetTexParameteriv,
+    GetTextureImage,
+    GetTextureLevelParameterfv,
+    GetTextureLevelParameteriv,
+    GetTextureParameterIiv,
+    GetTextureParameterIuiv,
+    GetTextureParameterfv,
+    GetTextureParameteriv,
+    GetTextureSubImage,
+    GetTransformFeedbackVarying,
+    GetTransformFeedbacki64_v,
+    GetTransformFeedbacki_v,
+    GetTransformFeedbackiv,
+    GetUniformBlockIndex,
+    GetUniformIndices,
+    GetUniformLocation,
+    GetUniformSubroutineuiv,
+    GetUniformdv,
+    GetUniformfv,
+    GetUniformiv,
+    GetUniformuiv,
+    GetVertexArrayIndexed64iv,
+    GetVertexArrayIndexediv,
+    GetVertexArrayiv,
+    GetVertexAttribIiv,
+    GetVertexAttribIuiv,
+    GetVertexAttribLdv,
+    GetVertexAttribPointerv,
+    GetVertexAttribdv,
+    GetVertexAttribfv,
+    GetVertexAttribiv,
+    GetnCompressedTexImage,
+    GetnTexImage,
+    GetnUniformdv,
+    GetnUniformfv,
+    GetnUniformiv,
+    GetnUniformuiv,
+    Hint,
+    InsertEventMarkerEXT,
+    InvalidateBufferData,
+    InvalidateBufferSubData,
+    InvalidateFramebuffer,
+    InvalidateNamedFramebufferData,
+    InvalidateNamedFramebufferSubData,
+    InvalidateSubFramebuffer,
+    InvalidateTexImage,
+    InvalidateTexSubImage,
+    IsBuffer,
+    IsEnabled,
+    IsEnabledi,
+    IsFenceNV,
+    IsFramebuffer,
+    IsPathNV,
+    IsProgram,
+    IsProgramPipeline,
+    IsQuery,
+    IsRenderbuffer,
+    IsSampler,
+    IsShader,
+    IsSync,
+    IsTexture,
+    IsTransformFeedback,
+    IsVertexArray,
+    LineWidth,
+    LinkProgram,
+    LogicOp,
+    MapBuffer,
+    MapBufferRange,
+    MapNamedBuffer,
+    MapNamedBufferRange,
+    MatrixLoadfEXT,
+    MemoryBarrier,
+    MemoryBarrierByRegion,
+    MinSampleShading,
+    MultiDrawArrays,
+    MultiDrawArraysIndirect,
+    MultiDrawElements,
+    MultiDrawElementsBaseVertex,
+    MultiDrawElementsIndirect,
+    NamedBufferData,
+    NamedBufferStorage,
+    NamedBufferSubData,
+    NamedFramebufferDrawBuffer,
+    NamedFramebufferDrawBuffers,
+    NamedFramebufferParameteri,
+    NamedFramebufferReadBuffer,
+    NamedFramebufferRenderbuffer,
+    NamedFramebufferTexture,
+    NamedFramebufferTextureLayer,
+    NamedRenderbufferStorage,
+    NamedRenderbufferStorageMultisample,
+    ObjectLabel,
+    ObjectPtrLabel,
+    PatchParameterfv,
+    PatchParameteri,
+    PathCommandsNV,
+    PathParameterfNV,
+    PathParameteriNV,
+    PathStencilFuncNV,
+    PauseTransformFeedback,
+    PixelStoref,
+    PixelStorei,
+    PointParameterf,
+    PointParameterfv,
+    PointParameteri,
+    PointParameteriv,
+    PointSize,
+    PolygonMode,
+    PolygonOffset,
+    PopDebugGroup,
+    PopGroupMarkerEXT,
+    PrimitiveBoundingBox,
+    PrimitiveRestartIndex,
+    ProgramBinary,
+    ProgramParameteri,
+    ProgramPathFragmentInputGenNV,
+    ProgramUniform1d,
+    ProgramUniform1dv,
+    ProgramUniform1f,
+    ProgramUniform1fv,
+    ProgramUniform1i,
+    ProgramUniform1iv,
+    ProgramUniform1ui,
+    ProgramUniform1uiv,
+    ProgramUniform2d,
+    ProgramUniform2dv,
+    ProgramUniform2f,
+    ProgramUniform2fv,
+    ProgramUniform2i,
+    ProgramUniform2iv,
+    ProgramUniform2ui,
+    ProgramUniform2uiv,
+    ProgramUniform3d,
+    ProgramUniform3dv,
+    ProgramUniform3f,
+    ProgramUniform3fv,
+    ProgramUniform3i,
+    ProgramUniform3iv,
+    ProgramUniform3ui,
+    ProgramUniform3uiv,
+    ProgramUniform4d,
+    ProgramUniform4dv,
+    ProgramUniform4f,
+    ProgramUniform4fv,
+    ProgramUniform4i,
+    ProgramUniform4iv,
+    ProgramUniform4ui,
+    ProgramUniform4uiv,
+    ProgramUniformMatrix2dv,
+    ProgramUniformMatrix2fv,
+    ProgramUniformMatrix2x3dv,
+    ProgramUniformMatrix2x3fv,
+    ProgramUniformMatrix2x4dv,
+    ProgramUniformMatrix2x4fv,
+    ProgramUniformMatrix3dv,
+    ProgramUniformMatrix3fv,
+    ProgramUniformMatrix3x2dv,
+    ProgramUniformMatrix3x2fv,
+    ProgramUniformMatrix3x4dv,
+    ProgramUniformMatrix3x4fv,
+    ProgramUniformMatrix4dv,
+    ProgramUniformMatrix4fv,
+    ProgramUniformMatrix4x2dv,
+    ProgramUniformMatrix4x2fv,
+    ProgramUniformMatrix4x3dv,
+    ProgramUniformMatrix4x3fv,
+    ProvokingVertex,
+    PushDebugGroup,
+    PushGroupMarkerEXT,
+    QueryCounter,
+    ReadBuffer,
+    ReadPixels,
+    ReadnPixels,
+    ReleaseShaderCompiler,
+    RenderbufferStorage,
+    RenderbufferStorageMultisample,
+    ResumeTransformFeedback,
+    SampleCoverage,
+    SampleMaski,
+    SamplerParameterIiv,
+    SamplerParameterIuiv,
+    SamplerParameterf,
+    SamplerParameterfv,
+    SamplerParameteri,
+    SamplerParameteriv,
+    Scissor,
+    ScissorArrayv,
+    ScissorIndexed,
+    ScissorIndexedv,
+    SetFenceNV,
+    ShaderBinary,
+    ShaderSource,
+    ShaderStorageBlockBinding,
+    StencilFillPathInstancedNV,
+    StencilFillPathNV,
+    StencilFunc,
+    StencilFuncSeparate,
+    StencilMask,
+    StencilMaskSeparate,
+    StencilOp,
+    StencilOpSeparate,
+    StencilStrokePathInstancedNV,
+    StencilStrokePathNV,
+    StencilThenCoverFillPathInstancedNV,
+    StencilThenCoverFillPathNV,
+    StencilThenCoverStrokePathInstancedNV,
+    StencilThenCoverStrokePathNV,
+    TestFenceNV,
+    TexBuffer,
+    TexBufferRange,
+    TexImage1D,
+    TexImage2D,
+    TexImage2DMultisample,
+    TexImage3D,
+    TexImage3DMultisample,
+    TexParameterIiv,
+    TexParameterIuiv,
+    TexParameterf,
+    TexParameterfv,
+    TexParameteri,
+    TexParameteriv,
+    TexStorage1D,
+    TexStorage2D,
+    TexStorage2DMultisample,
+    TexStorage3D,
+    TexStorage3DMultisample,
+    TexSubImage1D,
+    TexSubImage2D,
+    TexSubImage3D,
+    TextureBarrier,
+    TextureBuffer,
+    TextureBufferRange,
+    TextureParameterIiv,
+    TextureParameterIuiv,
+    TextureParameterf,
+    TextureParameterfv,
+    TextureParameteri,
+    TextureParameteriv,
+    TextureStorage1D,
+    TextureStorage2D,
+    TextureStorage2DMultisample,
+    TextureStorage3D,
+    TextureStorage3DMultisample,
+    TextureSubImage1D,
+    TextureSubImage2D,
+    TextureSubImage3D,
+    TextureView,
+    TransformFeedbackBufferBase,
+    TransformFeedbackBufferRange,
+    TransformFeedbackVaryings,
+    Uniform1d,
+    Uniform1dv,
+    Uniform1f,
+    Uniform1fv,
+    Uniform1i,
+    Uniform1iv,
+    Uniform1ui,
+    Uniform1uiv,
+    Uniform2d,
+    Uniform2dv,
+    Uniform2f,
+    Uniform2fv,
+    Uniform2i,
+    Uniform2iv,
+    Uniform2ui,
+    Uniform2uiv,
+    Uniform3d,
+    Uniform3dv,
+    Uniform3f,
+    Uniform3fv,
+    Uniform3i,
+    Uniform3iv,
+    Uniform3ui,
+    Uniform3uiv,
+    Uniform4d,
+    Uniform4dv,
+    Uniform4f,
+    Uniform4fv,
+    Uniform4i,
+    Uniform4iv,
+    Uniform4ui,
+    Uniform4uiv,
+    UniformBlockBinding,
+    UniformMatrix2dv,
+    UniformMatrix2fv,
+    UniformMatrix2x3dv,
+    UniformMatrix2x3fv,
+    UniformMatrix2x4dv,
+    UniformMatrix2x4fv,
+    UniformMatrix3dv,
+    UniformMatrix3fv,
+    UniformMatrix3x2dv,
+    UniformMatrix3x2fv,
+    UniformMatrix3x4dv,
+    UniformMatrix3x4fv,
+    UniformMatrix4dv,
+    UniformMatrix4fv,
+    UniformMatrix4x2dv,
+    UniformMatrix4x2fv,
+    UniformMatrix4x3dv,
+    UniformMatrix4x3fv,
+    UniformSubroutinesuiv,
+    UnmapBuffer,
+    UnmapNamedBuffer,
+    UseProgram,
+    UseProgramStages,
+    ValidateProgram,
+    ValidateProgramPipeline,
+    VertexArrayAttribBinding,
+    VertexArrayAttribFormat,
+    VertexArrayAttribIFormat,
+    VertexArrayAttribLFormat,
+    VertexArrayBindingDivisor,
+    VertexArrayElementBuffer,
+    VertexArrayVertexBuffer,
+    VertexArrayVertexBuffers,
+    VertexAttrib1d,
+    VertexAttrib1dv,
+    VertexAttrib1f,
+    VertexAttrib1fv,
+    VertexAttrib1s,
+    VertexAttrib1sv,
+    VertexAttrib2d,
+    VertexAttrib2dv,
+    VertexAttrib2f,
+    VertexAttrib2fv,
+    VertexAttrib2s,
+    VertexAttrib2sv,
+    VertexAttrib3d,
+    VertexAttrib3dv,
+    VertexAttrib3f,
+    VertexAttrib3fv,
+    VertexAttrib3s,
+    VertexAttrib3sv,
+    VertexAttrib4Nbv,
+    VertexAttrib4Niv,
+    VertexAttrib4Nsv,
+    VertexAttrib4Nub,
+    VertexAttrib4Nubv,
+    VertexAttrib4Nuiv,
+    VertexAttrib4Nusv,
+    VertexAttrib4bv,
+    VertexAttrib4d,
+    VertexAttrib4dv,
+    VertexAttrib4f,
+    VertexAttrib4fv,
+    VertexAttrib4iv,
+    VertexAttrib4s,
+    VertexAttrib4sv,
+    VertexAttrib4ubv,
+    VertexAttrib4uiv,
+    VertexAttrib4usv,
+    VertexAttribBinding,
+    VertexAttribDivisor,
+    VertexAttribFormat,
+    VertexAttribI1i,
+    VertexAttribI1iv,
+    VertexAttribI1ui,
+    VertexAttribI1uiv,
+    VertexAttribI2i,
+    VertexAttribI2iv,
+    VertexAttribI2ui,
+    VertexAttribI2uiv,
+    VertexAttribI3i,
+    VertexAttribI3iv,
+    VertexAttribI3ui,
+    VertexAttribI3uiv,
+    VertexAttribI4bv,
+    VertexAttribI4i,
+    VertexAttribI4iv,
+    VertexAttribI4sv,
+    VertexAttribI4ubv,
+    VertexAttribI4ui,
+    VertexAttribI4uiv,
+    VertexAttribI4usv,
+    VertexAttribIFormat,
+    VertexAttribIPointer,
+    VertexAttribL1d,
+    VertexAttribL1dv,
+    VertexAttribL2d,
+    VertexAttribL2dv,
+    VertexAttribL3d,
+    VertexAttribL3dv,
+    VertexAttribL4d,
+    VertexAttribL4dv,
+    VertexAttribLFormat,
+    VertexAttribLPointer,
+    VertexAttribP1ui,
+    VertexAttribP1uiv,
+    VertexAttribP2ui,
+    VertexAttribP2uiv,
+    VertexAttribP3ui,
+    VertexAttribP3uiv,
+    VertexAttribP4ui,
+    VertexAttribP4uiv,
+    VertexAttribPointer,
+    VertexBindingDivisor,
+    Viewport,
+    ViewportArrayv,
+    ViewportIndexedf,
+    ViewportIndexedfv,
+    WaitSync,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+const char *GetEntryPointGLName(EntryPointGL entryPoint);
+
+// The number of dispatch tables whose calls can be counted at the same time.
+constexpr size_t kMaxCallCounterTables = 4;
+
+// Moves every loaded function in |table| to |originals|, which must be the table of |slot|, and
+// replaces it with a hook that counts the call before forwarding it to the original function.
+void InstallCallCounterHooks(size_t slot, DispatchTableGL *table, CallCounterTableGL *originals);
+}  // namespace rx
+
+#endif  // LIBGLESV2_RENDERER_GL_CALL_COUNTERS_AUTOGEN_H_
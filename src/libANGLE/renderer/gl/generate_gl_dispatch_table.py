@@ -384,6 +384,7 @@ for command in xml_root.findall('commands/command'):
     command_decls[command_name] = entry + ';'
 
     entry += '\n{\n'
+    entry += '    gNullFunctionCallCount++;\n'
     if return_type != 'void ':
         entry += '    return static_cast<' + return_type + '>(0);\n'
     entry += '}'
@@ -410,6 +411,11 @@ null_functions_header_template = """// GENERATED FILE - DO NOT EDIT.
 
 namespace rx
 {{
+// Every NULL/stub binding increments a shared counter, giving a deterministic count of the native
+// calls the back-end makes on the NULL device.
+size_t GetNullFunctionCallCount();
+void ResetNullFunctionCallCount();
+
 {table_data}
 }}  // namespace rx
 
@@ -438,8 +444,25 @@ null_functions_source_template = """// GENERATED FILE - DO NOT EDIT.
 
 #include "libANGLE/renderer/gl/null_functions.h"
 
+#include <atomic>
+
 namespace rx
 {{
+namespace
+{{
+std::atomic<size_t> gNullFunctionCallCount(0);
+}}  // anonymous namespace
+
+size_t GetNullFunctionCallCount()
+{{
+    return gNullFunctionCallCount;
+}}
+
+void ResetNullFunctionCallCount()
+{{
+    gNullFunctionCallCount = 0;
+}}
+
 {table_data}
 }}  // namespace rx
 """
@@ -453,3 +476,173 @@ null_functions_source = null_functions_source_template.format(
 
 with open(null_functions_source_path, "w") as out:
     out.write(null_functions_source)
+
+# Generate the call counting hooks used by the instrumented back-end.
+
+call_counters_header_path = 'call_counters_autogen.h'
+call_counters_source_path = 'call_counters_autogen.cpp'
+
+# The hooks are instantiated once for each slot, see CallCounterTableGL.
+max_call_counter_tables = 4
+
+command_hooks = {}
+
+for command in xml_root.findall('commands/command'):
+    proto = command.find('proto')
+    command_name = proto.find('name').text
+    entry = ''.join(proto.itertext())
+    return_type = entry[:-len(command_name)]
+    entry = 'template <size_t Slot>\n' + return_type + ' INTERNAL_GL_APIENTRY ' + entry[len(return_type):] + 'Hook('
+
+    param_text = [format_param(param) for param in command.findall('param')]
+    param_names = [param.find('name').text for param in command.findall('param')]
+    entry += ', '.join(param_text) + ')'
+
+    entry += '\n{\n'
+    entry += '    CallCounterTableGL *table = CallCounterTableGL::FromSlot(Slot);\n'
+    entry += '    ScopedCallCounter counter(table, EntryPointGL::' + command_name[2:] + ');\n'
+    entry += '    return table->' + first_lower(command_name[2:]) + '(' + ', '.join(param_names) + ');\n'
+    entry += '}'
+
+    command_hooks[command_name] = entry
+
+def format_hook_install(entry_point):
+    member = first_lower(entry_point[2:])
+    return '\n'.join([
+        '    if (table->' + member + ')',
+        '    {',
+        '        originals->' + member + ' = table->' + member + ';',
+        '        table->' + member + ' = &' + entry_point + 'Hook<Slot>;',
+        '    }'])
+
+call_counters_header_template = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name} and gl.xml.
+//
+// Copyright {year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// {file_name}:
+//   Declares the native entry points counted by the instrumented OpenGL back-end.
+
+#ifndef LIBGLESV2_RENDERER_GL_CALL_COUNTERS_AUTOGEN_H_
+#define LIBGLESV2_RENDERER_GL_CALL_COUNTERS_AUTOGEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace rx
+{{
+class CallCounterTableGL;
+class DispatchTableGL;
+
+enum class EntryPointGL : uint16_t
+{{
+{enum_data}
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+}};
+
+const char *GetEntryPointGLName(EntryPointGL entryPoint);
+
+// The number of dispatch tables whose calls can be counted at the same time.
+constexpr size_t kMaxCallCounterTables = {max_tables};
+
+// Moves every loaded function in |table| to |originals|, which must be the table of |slot|, and
+// replaces it with a hook that counts the call before forwarding it to the original function.
+void InstallCallCounterHooks(size_t slot, DispatchTableGL *table, CallCounterTableGL *originals);
+}}  // namespace rx
+
+#endif  // LIBGLESV2_RENDERER_GL_CALL_COUNTERS_AUTOGEN_H_
+"""
+
+call_counters_source_template = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name} and gl.xml.
+//
+// Copyright {year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// {file_name}:
+//   Defines the call counting hooks for the instrumented OpenGL back-end.
+
+#include "libANGLE/renderer/gl/call_counters_autogen.h"
+
+#include "common/debug.h"
+#include "libANGLE/renderer/gl/DispatchTableGL_autogen.h"
+#include "libANGLE/renderer/gl/call_counters.h"
+
+namespace rx
+{{
+namespace
+{{
+{hook_data}
+
+template <size_t Slot>
+void InstallHooks(DispatchTableGL *table, CallCounterTableGL *originals)
+{{
+{install_data}
+}}
+}}  // anonymous namespace
+
+const char *GetEntryPointGLName(EntryPointGL entryPoint)
+{{
+    switch (entryPoint)
+    {{
+{name_data}
+        default:
+            UNREACHABLE();
+            return "invalid";
+    }}
+}}
+
+void InstallCallCounterHooks(size_t slot, DispatchTableGL *table, CallCounterTableGL *originals)
+{{
+    switch (slot)
+    {{
+{slot_data}
+        default:
+            UNREACHABLE();
+            break;
+    }}
+}}
+}}  // namespace rx
+"""
+
+sorted_entry_points = sorted(all_entry_points)
+
+call_counters_header = call_counters_header_template.format(
+    script_name = os.path.basename(sys.argv[0]),
+    data_source_name = data_source_name,
+    year = date.today().year,
+    file_name = call_counters_header_path,
+    max_tables = max_call_counter_tables,
+    enum_data = "\n".join(['    ' + entry_point[2:] + ',' for entry_point in sorted_entry_points]))
+
+with open(call_counters_header_path, "w") as out:
+    out.write(call_counters_header)
+
+name_data = []
+for entry_point in sorted_entry_points:
+    name_data.append('        case EntryPointGL::' + entry_point[2:] + ':')
+    name_data.append('            return "' + entry_point + '";')
+
+slot_data = []
+for slot in range(max_call_counter_tables):
+    slot_data.append('        case ' + str(slot) + ':')
+    slot_data.append('            InstallHooks<' + str(slot) + '>(table, originals);')
+    slot_data.append('            break;')
+
+call_counters_source = call_counters_source_template.format(
+    script_name = os.path.basename(sys.argv[0]),
+    data_source_name = data_source_name,
+    year = date.today().year,
+    file_name = call_counters_source_path,
+    hook_data = "\n\n".join([command_hooks[entry_point] for entry_point in sorted_entry_points]),
+    name_data = "\n".join(name_data),
+    slot_data = "\n".join(slot_data),
+    install_data = "\n\n".join([format_hook_install(entry_point) for entry_point in sorted_entry_points]))
+
+with open(call_counters_source_path, "w") as out:
+    out.write(call_counters_source)
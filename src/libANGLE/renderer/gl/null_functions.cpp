@@ -10,38 +10,88 @@
 
 #include "libANGLE/renderer/gl/null_functions.h"
 
+#include <atomic>
+
 namespace rx
 {
-void INTERNAL_GL_APIENTRY glActiveShaderProgramNULL(GLuint pipeline, GLuint program) {}
+namespace
+{
+std::atomic<size_t> gNullFunctionCallCount(0);
+}  // anonymous namespace
+
+size_t GetNullFunctionCallCount()
+{
+    return gNullFunctionCallCount;
+}
+
+void ResetNullFunctionCallCount()
+{
+    gNullFunctionCallCount = 0;
+}
+
+void INTERNAL_GL_APIENTRY glActiveShaderProgramNULL(GLuint pipeline, GLuint program)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glActiveTextureNULL(GLenum texture) {}
+void INTERNAL_GL_APIENTRY glActiveTextureNULL(GLenum texture)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glAttachShaderNULL(GLuint program, GLuint shader) {}
+void INTERNAL_GL_APIENTRY glAttachShaderNULL(GLuint program, GLuint shader)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBeginConditionalRenderNULL(GLuint id, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glBeginConditionalRenderNULL(GLuint id, GLenum mode)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBeginQueryNULL(GLenum target, GLuint id) {}
+void INTERNAL_GL_APIENTRY glBeginQueryNULL(GLenum target, GLuint id)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBeginQueryIndexedNULL(GLenum target, GLuint index, GLuint id) {}
+void INTERNAL_GL_APIENTRY glBeginQueryIndexedNULL(GLenum target, GLuint index, GLuint id)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBeginTransformFeedbackNULL(GLenum primitiveMode) {}
+void INTERNAL_GL_APIENTRY glBeginTransformFeedbackNULL(GLenum primitiveMode)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindAttribLocationNULL(GLuint program, GLuint index, const GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindBufferNULL(GLenum target, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glBindBufferNULL(GLenum target, GLuint buffer)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindBufferBaseNULL(GLenum target, GLuint index, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glBindBufferBaseNULL(GLenum target, GLuint index, GLuint buffer)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glBindBufferRangeNULL(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindBuffersBaseNULL(GLenum target,
                                                 GLuint first,
                                                 GLsizei count,
                                                 const GLuint *buffers)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindBuffersRangeNULL(GLenum target,
                                                  GLuint first,
@@ -49,20 +99,29 @@ void INTERNAL_GL_APIENTRY glBindBuffersRangeNULL(GLenum target,
                                                  const GLuint *buffers,
                                                  const GLintptr *offsets,
                                                  const GLsizeiptr *sizes)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindFragDataLocationNULL(GLuint program,
                                                      GLuint color,
                                                      const GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindFragDataLocationIndexedNULL(GLuint program,
                                                             GLuint colorNumber,
                                                             GLuint index,
                                                             const GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindFramebufferNULL(GLenum target, GLuint framebuffer) {}
+void INTERNAL_GL_APIENTRY glBindFramebufferNULL(GLenum target, GLuint framebuffer)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindImageTextureNULL(GLuint unit,
                                                  GLuint texture,
@@ -71,71 +130,132 @@ void INTERNAL_GL_APIENTRY glBindImageTextureNULL(GLuint unit,
                                                  GLint layer,
                                                  GLenum access,
                                                  GLenum format)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindImageTexturesNULL(GLuint first,
                                                   GLsizei count,
                                                   const GLuint *textures)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindProgramPipelineNULL(GLuint pipeline) {}
+void INTERNAL_GL_APIENTRY glBindProgramPipelineNULL(GLuint pipeline)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindRenderbufferNULL(GLenum target, GLuint renderbuffer) {}
+void INTERNAL_GL_APIENTRY glBindRenderbufferNULL(GLenum target, GLuint renderbuffer)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindSamplerNULL(GLuint unit, GLuint sampler) {}
+void INTERNAL_GL_APIENTRY glBindSamplerNULL(GLuint unit, GLuint sampler)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindSamplersNULL(GLuint first, GLsizei count, const GLuint *samplers) {}
+void INTERNAL_GL_APIENTRY glBindSamplersNULL(GLuint first, GLsizei count, const GLuint *samplers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindTextureNULL(GLenum target, GLuint texture) {}
+void INTERNAL_GL_APIENTRY glBindTextureNULL(GLenum target, GLuint texture)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindTextureUnitNULL(GLuint unit, GLuint texture) {}
+void INTERNAL_GL_APIENTRY glBindTextureUnitNULL(GLuint unit, GLuint texture)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindTexturesNULL(GLuint first, GLsizei count, const GLuint *textures) {}
+void INTERNAL_GL_APIENTRY glBindTexturesNULL(GLuint first, GLsizei count, const GLuint *textures)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindTransformFeedbackNULL(GLenum target, GLuint id) {}
+void INTERNAL_GL_APIENTRY glBindTransformFeedbackNULL(GLenum target, GLuint id)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBindVertexArrayNULL(GLuint array) {}
+void INTERNAL_GL_APIENTRY glBindVertexArrayNULL(GLuint array)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindVertexBufferNULL(GLuint bindingindex,
                                                  GLuint buffer,
                                                  GLintptr offset,
                                                  GLsizei stride)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBindVertexBuffersNULL(GLuint first,
                                                   GLsizei count,
                                                   const GLuint *buffers,
                                                   const GLintptr *offsets,
                                                   const GLsizei *strides)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBlendBarrierNULL() {}
+void INTERNAL_GL_APIENTRY glBlendBarrierNULL()
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBlendColorNULL(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBlendEquationNULL(GLenum mode) {}
+void INTERNAL_GL_APIENTRY glBlendEquationNULL(GLenum mode)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBlendEquationSeparateNULL(GLenum modeRGB, GLenum modeAlpha) {}
+void INTERNAL_GL_APIENTRY glBlendEquationSeparateNULL(GLenum modeRGB, GLenum modeAlpha)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBlendEquationSeparateiNULL(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBlendEquationiNULL(GLuint buf, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glBlendEquationiNULL(GLuint buf, GLenum mode)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBlendFuncNULL(GLenum sfactor, GLenum dfactor) {}
+void INTERNAL_GL_APIENTRY glBlendFuncNULL(GLenum sfactor, GLenum dfactor)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBlendFuncSeparateNULL(GLenum sfactorRGB,
                                                   GLenum dfactorRGB,
                                                   GLenum sfactorAlpha,
                                                   GLenum dfactorAlpha)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glBlendFuncSeparateiNULL(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glBlendFunciNULL(GLuint buf, GLenum src, GLenum dst) {}
+void INTERNAL_GL_APIENTRY glBlendFunciNULL(GLuint buf, GLenum src, GLenum dst)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBlitFramebufferNULL(GLint srcX0,
                                                 GLint srcY0,
@@ -147,7 +267,9 @@ void INTERNAL_GL_APIENTRY glBlitFramebufferNULL(GLint srcX0,
                                                 GLint dstY1,
                                                 GLbitfield mask,
                                                 GLenum filter)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBlitNamedFramebufferNULL(GLuint readFramebuffer,
                                                      GLuint drawFramebuffer,
@@ -161,46 +283,64 @@ void INTERNAL_GL_APIENTRY glBlitNamedFramebufferNULL(GLuint readFramebuffer,
                                                      GLint dstY1,
                                                      GLbitfield mask,
                                                      GLenum filter)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBufferDataNULL(GLenum target,
                                            GLsizeiptr size,
                                            const void *data,
                                            GLenum usage)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBufferStorageNULL(GLenum target,
                                               GLsizeiptr size,
                                               const void *data,
                                               GLbitfield flags)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glBufferSubDataNULL(GLenum target,
                                               GLintptr offset,
                                               GLsizeiptr size,
                                               const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLenum INTERNAL_GL_APIENTRY glCheckFramebufferStatusNULL(GLenum target)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLenum>(0);
 }
 
 GLenum INTERNAL_GL_APIENTRY glCheckNamedFramebufferStatusNULL(GLuint framebuffer, GLenum target)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLenum>(0);
 }
 
-void INTERNAL_GL_APIENTRY glClampColorNULL(GLenum target, GLenum clamp) {}
+void INTERNAL_GL_APIENTRY glClampColorNULL(GLenum target, GLenum clamp)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glClearNULL(GLbitfield mask) {}
+void INTERNAL_GL_APIENTRY glClearNULL(GLbitfield mask)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferDataNULL(GLenum target,
                                                 GLenum internalformat,
                                                 GLenum format,
                                                 GLenum type,
                                                 const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferSubDataNULL(GLenum target,
                                                    GLenum internalformat,
@@ -209,36 +349,56 @@ void INTERNAL_GL_APIENTRY glClearBufferSubDataNULL(GLenum target,
                                                    GLenum format,
                                                    GLenum type,
                                                    const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferfiNULL(GLenum buffer,
                                               GLint drawbuffer,
                                               GLfloat depth,
                                               GLint stencil)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferfvNULL(GLenum buffer, GLint drawbuffer, const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferivNULL(GLenum buffer, GLint drawbuffer, const GLint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearBufferuivNULL(GLenum buffer, GLint drawbuffer, const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearColorNULL(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glClearDepthNULL(GLdouble depth) {}
+void INTERNAL_GL_APIENTRY glClearDepthNULL(GLdouble depth)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glClearDepthfNULL(GLfloat d) {}
+void INTERNAL_GL_APIENTRY glClearDepthfNULL(GLfloat d)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedBufferDataNULL(GLuint buffer,
                                                      GLenum internalformat,
                                                      GLenum format,
                                                      GLenum type,
                                                      const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedBufferSubDataNULL(GLuint buffer,
                                                         GLenum internalformat,
@@ -247,38 +407,53 @@ void INTERNAL_GL_APIENTRY glClearNamedBufferSubDataNULL(GLuint buffer,
                                                         GLenum format,
                                                         GLenum type,
                                                         const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedFramebufferfiNULL(GLuint framebuffer,
                                                         GLenum buffer,
                                                         GLint drawbuffer,
                                                         GLfloat depth,
                                                         GLint stencil)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedFramebufferfvNULL(GLuint framebuffer,
                                                         GLenum buffer,
                                                         GLint drawbuffer,
                                                         const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedFramebufferivNULL(GLuint framebuffer,
                                                         GLenum buffer,
                                                         GLint drawbuffer,
                                                         const GLint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearNamedFramebufferuivNULL(GLuint framebuffer,
                                                          GLenum buffer,
                                                          GLint drawbuffer,
                                                          const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glClearStencilNULL(GLint s) {}
+void INTERNAL_GL_APIENTRY glClearStencilNULL(GLint s)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glClearTexImageNULL(GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glClearTexSubImageNULL(GLuint texture,
                                                  GLint level,
@@ -291,26 +466,39 @@ void INTERNAL_GL_APIENTRY glClearTexSubImageNULL(GLuint texture,
                                                  GLenum format,
                                                  GLenum type,
                                                  const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLenum INTERNAL_GL_APIENTRY glClientWaitSyncNULL(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLenum>(0);
 }
 
-void INTERNAL_GL_APIENTRY glClipControlNULL(GLenum origin, GLenum depth) {}
+void INTERNAL_GL_APIENTRY glClipControlNULL(GLenum origin, GLenum depth)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glColorMaskNULL(GLboolean red,
                                           GLboolean green,
                                           GLboolean blue,
                                           GLboolean alpha)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glColorMaskiNULL(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCompileShaderNULL(GLuint shader) {}
+void INTERNAL_GL_APIENTRY glCompileShaderNULL(GLuint shader)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexImage1DNULL(GLenum target,
                                                      GLint level,
@@ -319,7 +507,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexImage1DNULL(GLenum target,
                                                      GLint border,
                                                      GLsizei imageSize,
                                                      const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexImage2DNULL(GLenum target,
                                                      GLint level,
@@ -329,7 +519,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexImage2DNULL(GLenum target,
                                                      GLint border,
                                                      GLsizei imageSize,
                                                      const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexImage3DNULL(GLenum target,
                                                      GLint level,
@@ -340,7 +532,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexImage3DNULL(GLenum target,
                                                      GLint border,
                                                      GLsizei imageSize,
                                                      const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexSubImage1DNULL(GLenum target,
                                                         GLint level,
@@ -349,7 +543,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexSubImage1DNULL(GLenum target,
                                                         GLenum format,
                                                         GLsizei imageSize,
                                                         const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexSubImage2DNULL(GLenum target,
                                                         GLint level,
@@ -360,7 +556,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexSubImage2DNULL(GLenum target,
                                                         GLenum format,
                                                         GLsizei imageSize,
                                                         const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTexSubImage3DNULL(GLenum target,
                                                         GLint level,
@@ -373,7 +571,9 @@ void INTERNAL_GL_APIENTRY glCompressedTexSubImage3DNULL(GLenum target,
                                                         GLenum format,
                                                         GLsizei imageSize,
                                                         const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTextureSubImage1DNULL(GLuint texture,
                                                             GLint level,
@@ -382,7 +582,9 @@ void INTERNAL_GL_APIENTRY glCompressedTextureSubImage1DNULL(GLuint texture,
                                                             GLenum format,
                                                             GLsizei imageSize,
                                                             const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTextureSubImage2DNULL(GLuint texture,
                                                             GLint level,
@@ -393,7 +595,9 @@ void INTERNAL_GL_APIENTRY glCompressedTextureSubImage2DNULL(GLuint texture,
                                                             GLenum format,
                                                             GLsizei imageSize,
                                                             const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCompressedTextureSubImage3DNULL(GLuint texture,
                                                             GLint level,
@@ -406,14 +610,18 @@ void INTERNAL_GL_APIENTRY glCompressedTextureSubImage3DNULL(GLuint texture,
                                                             GLenum format,
                                                             GLsizei imageSize,
                                                             const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyBufferSubDataNULL(GLenum readTarget,
                                                   GLenum writeTarget,
                                                   GLintptr readOffset,
                                                   GLintptr writeOffset,
                                                   GLsizeiptr size)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyImageSubDataNULL(GLuint srcName,
                                                  GLenum srcTarget,
@@ -430,14 +638,18 @@ void INTERNAL_GL_APIENTRY glCopyImageSubDataNULL(GLuint srcName,
                                                  GLsizei srcWidth,
                                                  GLsizei srcHeight,
                                                  GLsizei srcDepth)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyNamedBufferSubDataNULL(GLuint readBuffer,
                                                        GLuint writeBuffer,
                                                        GLintptr readOffset,
                                                        GLintptr writeOffset,
                                                        GLsizeiptr size)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyTexImage1DNULL(GLenum target,
                                                GLint level,
@@ -446,7 +658,9 @@ void INTERNAL_GL_APIENTRY glCopyTexImage1DNULL(GLenum target,
                                                GLint y,
                                                GLsizei width,
                                                GLint border)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyTexImage2DNULL(GLenum target,
                                                GLint level,
@@ -456,11 +670,15 @@ void INTERNAL_GL_APIENTRY glCopyTexImage2DNULL(GLenum target,
                                                GLsizei width,
                                                GLsizei height,
                                                GLint border)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glCopyTexSubImage1DNULL(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyTexSubImage2DNULL(GLenum target,
                                                   GLint level,
@@ -470,7 +688,9 @@ void INTERNAL_GL_APIENTRY glCopyTexSubImage2DNULL(GLenum target,
                                                   GLint y,
                                                   GLsizei width,
                                                   GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyTexSubImage3DNULL(GLenum target,
                                                   GLint level,
@@ -481,7 +701,9 @@ void INTERNAL_GL_APIENTRY glCopyTexSubImage3DNULL(GLenum target,
                                                   GLint y,
                                                   GLsizei width,
                                                   GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyTextureSubImage1DNULL(GLuint texture,
                                                       GLint level,
@@ -489,7 +711,9 @@ void INTERNAL_GL_APIENTRY glCopyTextureSubImage1DNULL(GLuint texture,
                                                       GLint x,
                                                       GLint y,
                                                       GLsizei width)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyTextureSubImage2DNULL(GLuint texture,
                                                       GLint level,
@@ -499,7 +723,9 @@ void INTERNAL_GL_APIENTRY glCopyTextureSubImage2DNULL(GLuint texture,
                                                       GLint y,
                                                       GLsizei width,
                                                       GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCopyTextureSubImage3DNULL(GLuint texture,
                                                       GLint level,
@@ -510,7 +736,9 @@ void INTERNAL_GL_APIENTRY glCopyTextureSubImage3DNULL(GLuint texture,
                                                       GLint y,
                                                       GLsizei width,
                                                       GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCoverFillPathInstancedNVNULL(GLsizei numPaths,
                                                          GLenum pathNameType,
@@ -519,9 +747,14 @@ void INTERNAL_GL_APIENTRY glCoverFillPathInstancedNVNULL(GLsizei numPaths,
                                                          GLenum coverMode,
                                                          GLenum transformType,
                                                          const GLfloat *transformValues)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCoverFillPathNVNULL(GLuint path, GLenum coverMode) {}
+void INTERNAL_GL_APIENTRY glCoverFillPathNVNULL(GLuint path, GLenum coverMode)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glCoverStrokePathInstancedNVNULL(GLsizei numPaths,
                                                            GLenum pathNameType,
@@ -530,31 +763,59 @@ void INTERNAL_GL_APIENTRY glCoverStrokePathInstancedNVNULL(GLsizei numPaths,
                                                            GLenum coverMode,
                                                            GLenum transformType,
                                                            const GLfloat *transformValues)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCoverStrokePathNVNULL(GLuint path, GLenum coverMode) {}
+void INTERNAL_GL_APIENTRY glCoverStrokePathNVNULL(GLuint path, GLenum coverMode)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCoverageModulationNVNULL(GLenum components) {}
+void INTERNAL_GL_APIENTRY glCoverageModulationNVNULL(GLenum components)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCreateBuffersNULL(GLsizei n, GLuint *buffers) {}
+void INTERNAL_GL_APIENTRY glCreateBuffersNULL(GLsizei n, GLuint *buffers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCreateFramebuffersNULL(GLsizei n, GLuint *framebuffers) {}
+void INTERNAL_GL_APIENTRY glCreateFramebuffersNULL(GLsizei n, GLuint *framebuffers)
+{
+    gNullFunctionCallCount++;
+}
 
 GLuint INTERNAL_GL_APIENTRY glCreateProgramNULL()
 {
+    gNullFunctionCallCount++;
     return static_cast<GLuint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glCreateProgramPipelinesNULL(GLsizei n, GLuint *pipelines) {}
+void INTERNAL_GL_APIENTRY glCreateProgramPipelinesNULL(GLsizei n, GLuint *pipelines)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCreateQueriesNULL(GLenum target, GLsizei n, GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glCreateQueriesNULL(GLenum target, GLsizei n, GLuint *ids)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCreateRenderbuffersNULL(GLsizei n, GLuint *renderbuffers) {}
+void INTERNAL_GL_APIENTRY glCreateRenderbuffersNULL(GLsizei n, GLuint *renderbuffers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCreateSamplersNULL(GLsizei n, GLuint *samplers) {}
+void INTERNAL_GL_APIENTRY glCreateSamplersNULL(GLsizei n, GLuint *samplers)
+{
+    gNullFunctionCallCount++;
+}
 
 GLuint INTERNAL_GL_APIENTRY glCreateShaderNULL(GLenum type)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLuint>(0);
 }
 
@@ -562,18 +823,34 @@ GLuint INTERNAL_GL_APIENTRY glCreateShaderProgramvNULL(GLenum type,
                                                        GLsizei count,
                                                        const GLchar *const *strings)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLuint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glCreateTexturesNULL(GLenum target, GLsizei n, GLuint *textures) {}
+void INTERNAL_GL_APIENTRY glCreateTexturesNULL(GLenum target, GLsizei n, GLuint *textures)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCreateTransformFeedbacksNULL(GLsizei n, GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glCreateTransformFeedbacksNULL(GLsizei n, GLuint *ids)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCreateVertexArraysNULL(GLsizei n, GLuint *arrays) {}
+void INTERNAL_GL_APIENTRY glCreateVertexArraysNULL(GLsizei n, GLuint *arrays)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glCullFaceNULL(GLenum mode) {}
+void INTERNAL_GL_APIENTRY glCullFaceNULL(GLenum mode)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDebugMessageCallbackNULL(GLDEBUGPROC callback, const void *userParam) {}
+void INTERNAL_GL_APIENTRY glDebugMessageCallbackNULL(GLDEBUGPROC callback, const void *userParam)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDebugMessageControlNULL(GLenum source,
                                                     GLenum type,
@@ -581,7 +858,9 @@ void INTERNAL_GL_APIENTRY glDebugMessageControlNULL(GLenum source,
                                                     GLsizei count,
                                                     const GLuint *ids,
                                                     GLboolean enabled)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDebugMessageInsertNULL(GLenum source,
                                                    GLenum type,
@@ -589,113 +868,221 @@ void INTERNAL_GL_APIENTRY glDebugMessageInsertNULL(GLenum source,
                                                    GLenum severity,
                                                    GLsizei length,
                                                    const GLchar *buf)
-{}
-
-void INTERNAL_GL_APIENTRY glDeleteBuffersNULL(GLsizei n, const GLuint *buffers) {}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteFencesNVNULL(GLsizei n, const GLuint *fences) {}
+void INTERNAL_GL_APIENTRY glDeleteBuffersNULL(GLsizei n, const GLuint *buffers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteFramebuffersNULL(GLsizei n, const GLuint *framebuffers) {}
+void INTERNAL_GL_APIENTRY glDeleteFencesNVNULL(GLsizei n, const GLuint *fences)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeletePathsNVNULL(GLuint path, GLsizei range) {}
+void INTERNAL_GL_APIENTRY glDeleteFramebuffersNULL(GLsizei n, const GLuint *framebuffers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteProgramNULL(GLuint program) {}
+void INTERNAL_GL_APIENTRY glDeletePathsNVNULL(GLuint path, GLsizei range)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteProgramPipelinesNULL(GLsizei n, const GLuint *pipelines) {}
+void INTERNAL_GL_APIENTRY glDeleteProgramNULL(GLuint program)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteQueriesNULL(GLsizei n, const GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glDeleteProgramPipelinesNULL(GLsizei n, const GLuint *pipelines)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteRenderbuffersNULL(GLsizei n, const GLuint *renderbuffers) {}
+void INTERNAL_GL_APIENTRY glDeleteQueriesNULL(GLsizei n, const GLuint *ids)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteSamplersNULL(GLsizei count, const GLuint *samplers) {}
+void INTERNAL_GL_APIENTRY glDeleteRenderbuffersNULL(GLsizei n, const GLuint *renderbuffers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteShaderNULL(GLuint shader) {}
+void INTERNAL_GL_APIENTRY glDeleteSamplersNULL(GLsizei count, const GLuint *samplers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteSyncNULL(GLsync sync) {}
+void INTERNAL_GL_APIENTRY glDeleteShaderNULL(GLuint shader)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteTexturesNULL(GLsizei n, const GLuint *textures) {}
+void INTERNAL_GL_APIENTRY glDeleteSyncNULL(GLsync sync)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteTransformFeedbacksNULL(GLsizei n, const GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glDeleteTexturesNULL(GLsizei n, const GLuint *textures)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDeleteVertexArraysNULL(GLsizei n, const GLuint *arrays) {}
+void INTERNAL_GL_APIENTRY glDeleteTransformFeedbacksNULL(GLsizei n, const GLuint *ids)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDepthFuncNULL(GLenum func) {}
+void INTERNAL_GL_APIENTRY glDeleteVertexArraysNULL(GLsizei n, const GLuint *arrays)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDepthMaskNULL(GLboolean flag) {}
+void INTERNAL_GL_APIENTRY glDepthFuncNULL(GLenum func)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDepthRangeNULL(GLdouble n, GLdouble f) {}
+void INTERNAL_GL_APIENTRY glDepthMaskNULL(GLboolean flag)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDepthRangeArrayvNULL(GLuint first, GLsizei count, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glDepthRangeNULL(GLdouble n, GLdouble f)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDepthRangeIndexedNULL(GLuint index, GLdouble n, GLdouble f) {}
+void INTERNAL_GL_APIENTRY glDepthRangeArrayvNULL(GLuint first, GLsizei count, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
+
+void INTERNAL_GL_APIENTRY glDepthRangeIndexedNULL(GLuint index, GLdouble n, GLdouble f)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDepthRangefNULL(GLfloat n, GLfloat f) {}
+void INTERNAL_GL_APIENTRY glDepthRangefNULL(GLfloat n, GLfloat f)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDetachShaderNULL(GLuint program, GLuint shader) {}
+void INTERNAL_GL_APIENTRY glDetachShaderNULL(GLuint program, GLuint shader)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDisableNULL(GLenum cap) {}
+void INTERNAL_GL_APIENTRY glDisableNULL(GLenum cap)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDisableVertexArrayAttribNULL(GLuint vaobj, GLuint index) {}
+void INTERNAL_GL_APIENTRY glDisableVertexArrayAttribNULL(GLuint vaobj, GLuint index)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDisableVertexAttribArrayNULL(GLuint index) {}
+void INTERNAL_GL_APIENTRY glDisableVertexAttribArrayNULL(GLuint index)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDisableiNULL(GLenum target, GLuint index) {}
+void INTERNAL_GL_APIENTRY glDisableiNULL(GLenum target, GLuint index)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDiscardFramebufferEXTNULL(GLenum target,
                                                       GLsizei numAttachments,
                                                       const GLenum *attachments)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDispatchComputeNULL(GLuint num_groups_x,
                                                 GLuint num_groups_y,
                                                 GLuint num_groups_z)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDispatchComputeIndirectNULL(GLintptr indirect) {}
+void INTERNAL_GL_APIENTRY glDispatchComputeIndirectNULL(GLintptr indirect)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDrawArraysNULL(GLenum mode, GLint first, GLsizei count) {}
+void INTERNAL_GL_APIENTRY glDrawArraysNULL(GLenum mode, GLint first, GLsizei count)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDrawArraysIndirectNULL(GLenum mode, const void *indirect) {}
+void INTERNAL_GL_APIENTRY glDrawArraysIndirectNULL(GLenum mode, const void *indirect)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawArraysInstancedNULL(GLenum mode,
                                                     GLint first,
                                                     GLsizei count,
                                                     GLsizei instancecount)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawArraysInstancedBaseInstanceNULL(GLenum mode,
                                                                 GLint first,
                                                                 GLsizei count,
                                                                 GLsizei instancecount,
                                                                 GLuint baseinstance)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDrawBufferNULL(GLenum buf) {}
+void INTERNAL_GL_APIENTRY glDrawBufferNULL(GLenum buf)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDrawBuffersNULL(GLsizei n, const GLenum *bufs) {}
+void INTERNAL_GL_APIENTRY glDrawBuffersNULL(GLsizei n, const GLenum *bufs)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsNULL(GLenum mode,
                                              GLsizei count,
                                              GLenum type,
                                              const void *indices)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsBaseVertexNULL(GLenum mode,
                                                        GLsizei count,
                                                        GLenum type,
                                                        const void *indices,
                                                        GLint basevertex)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsIndirectNULL(GLenum mode, GLenum type, const void *indirect)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsInstancedNULL(GLenum mode,
                                                       GLsizei count,
                                                       GLenum type,
                                                       const void *indices,
                                                       GLsizei instancecount)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseInstanceNULL(GLenum mode,
                                                                   GLsizei count,
@@ -703,7 +1090,9 @@ void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseInstanceNULL(GLenum mode,
                                                                   const void *indices,
                                                                   GLsizei instancecount,
                                                                   GLuint baseinstance)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexNULL(GLenum mode,
                                                                 GLsizei count,
@@ -711,7 +1100,9 @@ void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexNULL(GLenum mode,
                                                                 const void *indices,
                                                                 GLsizei instancecount,
                                                                 GLint basevertex)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexBaseInstanceNULL(GLenum mode,
                                                                             GLsizei count,
@@ -720,7 +1111,9 @@ void INTERNAL_GL_APIENTRY glDrawElementsInstancedBaseVertexBaseInstanceNULL(GLen
                                                                             GLsizei instancecount,
                                                                             GLint basevertex,
                                                                             GLuint baseinstance)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawRangeElementsNULL(GLenum mode,
                                                   GLuint start,
@@ -728,7 +1121,9 @@ void INTERNAL_GL_APIENTRY glDrawRangeElementsNULL(GLenum mode,
                                                   GLsizei count,
                                                   GLenum type,
                                                   const void *indices)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawRangeElementsBaseVertexNULL(GLenum mode,
                                                             GLuint start,
@@ -737,94 +1132,159 @@ void INTERNAL_GL_APIENTRY glDrawRangeElementsBaseVertexNULL(GLenum mode,
                                                             GLenum type,
                                                             const void *indices,
                                                             GLint basevertex)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glDrawTransformFeedbackNULL(GLenum mode, GLuint id) {}
+void INTERNAL_GL_APIENTRY glDrawTransformFeedbackNULL(GLenum mode, GLuint id)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawTransformFeedbackInstancedNULL(GLenum mode,
                                                                GLuint id,
                                                                GLsizei instancecount)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawTransformFeedbackStreamNULL(GLenum mode, GLuint id, GLuint stream)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glDrawTransformFeedbackStreamInstancedNULL(GLenum mode,
                                                                      GLuint id,
                                                                      GLuint stream,
                                                                      GLsizei instancecount)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glEGLImageTargetRenderbufferStorageOESNULL(GLenum target,
                                                                      GLeglImageOES image)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEGLImageTargetTexture2DOESNULL(GLenum target, GLeglImageOES image) {}
+void INTERNAL_GL_APIENTRY glEGLImageTargetTexture2DOESNULL(GLenum target, GLeglImageOES image)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEnableNULL(GLenum cap) {}
+void INTERNAL_GL_APIENTRY glEnableNULL(GLenum cap)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEnableVertexArrayAttribNULL(GLuint vaobj, GLuint index) {}
+void INTERNAL_GL_APIENTRY glEnableVertexArrayAttribNULL(GLuint vaobj, GLuint index)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEnableVertexAttribArrayNULL(GLuint index) {}
+void INTERNAL_GL_APIENTRY glEnableVertexAttribArrayNULL(GLuint index)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEnableiNULL(GLenum target, GLuint index) {}
+void INTERNAL_GL_APIENTRY glEnableiNULL(GLenum target, GLuint index)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEndConditionalRenderNULL() {}
+void INTERNAL_GL_APIENTRY glEndConditionalRenderNULL()
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEndQueryNULL(GLenum target) {}
+void INTERNAL_GL_APIENTRY glEndQueryNULL(GLenum target)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEndQueryIndexedNULL(GLenum target, GLuint index) {}
+void INTERNAL_GL_APIENTRY glEndQueryIndexedNULL(GLenum target, GLuint index)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glEndTransformFeedbackNULL() {}
+void INTERNAL_GL_APIENTRY glEndTransformFeedbackNULL()
+{
+    gNullFunctionCallCount++;
+}
 
 GLsync INTERNAL_GL_APIENTRY glFenceSyncNULL(GLenum condition, GLbitfield flags)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLsync>(0);
 }
 
-void INTERNAL_GL_APIENTRY glFinishNULL() {}
+void INTERNAL_GL_APIENTRY glFinishNULL()
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glFinishFenceNVNULL(GLuint fence) {}
+void INTERNAL_GL_APIENTRY glFinishFenceNVNULL(GLuint fence)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glFlushNULL() {}
+void INTERNAL_GL_APIENTRY glFlushNULL()
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glFlushMappedBufferRangeNULL(GLenum target,
                                                        GLintptr offset,
                                                        GLsizeiptr length)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glFlushMappedNamedBufferRangeNULL(GLuint buffer,
                                                             GLintptr offset,
                                                             GLsizeiptr length)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glFramebufferParameteriNULL(GLenum target, GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glFramebufferParameteriNULL(GLenum target, GLenum pname, GLint param)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferRenderbufferNULL(GLenum target,
                                                         GLenum attachment,
                                                         GLenum renderbuffertarget,
                                                         GLuint renderbuffer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTextureNULL(GLenum target,
                                                    GLenum attachment,
                                                    GLuint texture,
                                                    GLint level)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTexture1DNULL(GLenum target,
                                                      GLenum attachment,
                                                      GLenum textarget,
                                                      GLuint texture,
                                                      GLint level)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTexture2DNULL(GLenum target,
                                                      GLenum attachment,
                                                      GLenum textarget,
                                                      GLuint texture,
                                                      GLint level)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTexture3DNULL(GLenum target,
                                                      GLenum attachment,
@@ -832,51 +1292,97 @@ void INTERNAL_GL_APIENTRY glFramebufferTexture3DNULL(GLenum target,
                                                      GLuint texture,
                                                      GLint level,
                                                      GLint zoffset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glFramebufferTextureLayerNULL(GLenum target,
                                                         GLenum attachment,
                                                         GLuint texture,
                                                         GLint level,
                                                         GLint layer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glFrontFaceNULL(GLenum mode) {}
+void INTERNAL_GL_APIENTRY glFrontFaceNULL(GLenum mode)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenBuffersNULL(GLsizei n, GLuint *buffers) {}
+void INTERNAL_GL_APIENTRY glGenBuffersNULL(GLsizei n, GLuint *buffers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenFencesNVNULL(GLsizei n, GLuint *fences) {}
+void INTERNAL_GL_APIENTRY glGenFencesNVNULL(GLsizei n, GLuint *fences)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenFramebuffersNULL(GLsizei n, GLuint *framebuffers) {}
+void INTERNAL_GL_APIENTRY glGenFramebuffersNULL(GLsizei n, GLuint *framebuffers)
+{
+    gNullFunctionCallCount++;
+}
 
 GLuint INTERNAL_GL_APIENTRY glGenPathsNVNULL(GLsizei range)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLuint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGenProgramPipelinesNULL(GLsizei n, GLuint *pipelines) {}
+void INTERNAL_GL_APIENTRY glGenProgramPipelinesNULL(GLsizei n, GLuint *pipelines)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenQueriesNULL(GLsizei n, GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glGenQueriesNULL(GLsizei n, GLuint *ids)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenRenderbuffersNULL(GLsizei n, GLuint *renderbuffers) {}
+void INTERNAL_GL_APIENTRY glGenRenderbuffersNULL(GLsizei n, GLuint *renderbuffers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenSamplersNULL(GLsizei count, GLuint *samplers) {}
+void INTERNAL_GL_APIENTRY glGenSamplersNULL(GLsizei count, GLuint *samplers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenTexturesNULL(GLsizei n, GLuint *textures) {}
+void INTERNAL_GL_APIENTRY glGenTexturesNULL(GLsizei n, GLuint *textures)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenTransformFeedbacksNULL(GLsizei n, GLuint *ids) {}
+void INTERNAL_GL_APIENTRY glGenTransformFeedbacksNULL(GLsizei n, GLuint *ids)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenVertexArraysNULL(GLsizei n, GLuint *arrays) {}
+void INTERNAL_GL_APIENTRY glGenVertexArraysNULL(GLsizei n, GLuint *arrays)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenerateMipmapNULL(GLenum target) {}
+void INTERNAL_GL_APIENTRY glGenerateMipmapNULL(GLenum target)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGenerateTextureMipmapNULL(GLuint texture) {}
+void INTERNAL_GL_APIENTRY glGenerateTextureMipmapNULL(GLuint texture)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveAtomicCounterBufferivNULL(GLuint program,
                                                                GLuint bufferIndex,
                                                                GLenum pname,
                                                                GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveAttribNULL(GLuint program,
                                                 GLuint index,
@@ -885,7 +1391,9 @@ void INTERNAL_GL_APIENTRY glGetActiveAttribNULL(GLuint program,
                                                 GLint *size,
                                                 GLenum *type,
                                                 GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveSubroutineNameNULL(GLuint program,
                                                         GLenum shadertype,
@@ -893,7 +1401,9 @@ void INTERNAL_GL_APIENTRY glGetActiveSubroutineNameNULL(GLuint program,
                                                         GLsizei bufsize,
                                                         GLsizei *length,
                                                         GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveSubroutineUniformNameNULL(GLuint program,
                                                                GLenum shadertype,
@@ -901,14 +1411,18 @@ void INTERNAL_GL_APIENTRY glGetActiveSubroutineUniformNameNULL(GLuint program,
                                                                GLsizei bufsize,
                                                                GLsizei *length,
                                                                GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveSubroutineUniformivNULL(GLuint program,
                                                              GLenum shadertype,
                                                              GLuint index,
                                                              GLenum pname,
                                                              GLint *values)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformNULL(GLuint program,
                                                  GLuint index,
@@ -917,70 +1431,104 @@ void INTERNAL_GL_APIENTRY glGetActiveUniformNULL(GLuint program,
                                                  GLint *size,
                                                  GLenum *type,
                                                  GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformBlockNameNULL(GLuint program,
                                                           GLuint uniformBlockIndex,
                                                           GLsizei bufSize,
                                                           GLsizei *length,
                                                           GLchar *uniformBlockName)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformBlockivNULL(GLuint program,
                                                         GLuint uniformBlockIndex,
                                                         GLenum pname,
                                                         GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformNameNULL(GLuint program,
                                                      GLuint uniformIndex,
                                                      GLsizei bufSize,
                                                      GLsizei *length,
                                                      GLchar *uniformName)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetActiveUniformsivNULL(GLuint program,
                                                     GLsizei uniformCount,
                                                     const GLuint *uniformIndices,
                                                     GLenum pname,
                                                     GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetAttachedShadersNULL(GLuint program,
                                                    GLsizei maxCount,
                                                    GLsizei *count,
                                                    GLuint *shaders)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLint INTERNAL_GL_APIENTRY glGetAttribLocationNULL(GLuint program, const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGetBooleani_vNULL(GLenum target, GLuint index, GLboolean *data) {}
+void INTERNAL_GL_APIENTRY glGetBooleani_vNULL(GLenum target, GLuint index, GLboolean *data)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetBooleanvNULL(GLenum pname, GLboolean *data) {}
+void INTERNAL_GL_APIENTRY glGetBooleanvNULL(GLenum pname, GLboolean *data)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetBufferParameteri64vNULL(GLenum target, GLenum pname, GLint64 *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetBufferParameterivNULL(GLenum target, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetBufferParameterivNULL(GLenum target, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetBufferPointervNULL(GLenum target, GLenum pname, void **params) {}
+void INTERNAL_GL_APIENTRY glGetBufferPointervNULL(GLenum target, GLenum pname, void **params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetBufferSubDataNULL(GLenum target,
                                                  GLintptr offset,
                                                  GLsizeiptr size,
                                                  void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetCompressedTexImageNULL(GLenum target, GLint level, void *img) {}
+void INTERNAL_GL_APIENTRY glGetCompressedTexImageNULL(GLenum target, GLint level, void *img)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetCompressedTextureImageNULL(GLuint texture,
                                                           GLint level,
                                                           GLsizei bufSize,
                                                           void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetCompressedTextureSubImageNULL(GLuint texture,
                                                              GLint level,
@@ -992,7 +1540,9 @@ void INTERNAL_GL_APIENTRY glGetCompressedTextureSubImageNULL(GLuint texture,
                                                              GLsizei depth,
                                                              GLsizei bufSize,
                                                              void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLuint INTERNAL_GL_APIENTRY glGetDebugMessageLogNULL(GLuint count,
                                                      GLsizei bufSize,
@@ -1003,31 +1553,50 @@ GLuint INTERNAL_GL_APIENTRY glGetDebugMessageLogNULL(GLuint count,
                                                      GLsizei *lengths,
                                                      GLchar *messageLog)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLuint>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGetDoublei_vNULL(GLenum target, GLuint index, GLdouble *data) {}
+void INTERNAL_GL_APIENTRY glGetDoublei_vNULL(GLenum target, GLuint index, GLdouble *data)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetDoublevNULL(GLenum pname, GLdouble *data) {}
+void INTERNAL_GL_APIENTRY glGetDoublevNULL(GLenum pname, GLdouble *data)
+{
+    gNullFunctionCallCount++;
+}
 
 GLenum INTERNAL_GL_APIENTRY glGetErrorNULL()
 {
+    gNullFunctionCallCount++;
     return static_cast<GLenum>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGetFenceivNVNULL(GLuint fence, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetFenceivNVNULL(GLuint fence, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetFloati_vNULL(GLenum target, GLuint index, GLfloat *data) {}
+void INTERNAL_GL_APIENTRY glGetFloati_vNULL(GLenum target, GLuint index, GLfloat *data)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetFloatvNULL(GLenum pname, GLfloat *data) {}
+void INTERNAL_GL_APIENTRY glGetFloatvNULL(GLenum pname, GLfloat *data)
+{
+    gNullFunctionCallCount++;
+}
 
 GLint INTERNAL_GL_APIENTRY glGetFragDataIndexNULL(GLuint program, const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLint>(0);
 }
 
 GLint INTERNAL_GL_APIENTRY glGetFragDataLocationNULL(GLuint program, const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLint>(0);
 }
 
@@ -1035,25 +1604,42 @@ void INTERNAL_GL_APIENTRY glGetFramebufferAttachmentParameterivNULL(GLenum targe
                                                                     GLenum attachment,
                                                                     GLenum pname,
                                                                     GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetFramebufferParameterivNULL(GLenum target,
                                                           GLenum pname,
                                                           GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLenum INTERNAL_GL_APIENTRY glGetGraphicsResetStatusNULL()
 {
+    gNullFunctionCallCount++;
     return static_cast<GLenum>(0);
 }
 
-void INTERNAL_GL_APIENTRY glGetInteger64i_vNULL(GLenum target, GLuint index, GLint64 *data) {}
+void INTERNAL_GL_APIENTRY glGetInteger64i_vNULL(GLenum target, GLuint index, GLint64 *data)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetInteger64vNULL(GLenum pname, GLint64 *data) {}
+void INTERNAL_GL_APIENTRY glGetInteger64vNULL(GLenum pname, GLint64 *data)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetIntegeri_vNULL(GLenum target, GLuint index, GLint *data) {}
+void INTERNAL_GL_APIENTRY glGetIntegeri_vNULL(GLenum target, GLuint index, GLint *data)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetIntegervNULL(GLenum pname, GLint *data) {}
+void INTERNAL_GL_APIENTRY glGetIntegervNULL(GLenum pname, GLint *data)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetInternalformatSampleivNVNULL(GLenum target,
                                                             GLenum internalformat,
@@ -1061,110 +1647,157 @@ void INTERNAL_GL_APIENTRY glGetInternalformatSampleivNVNULL(GLenum target,
                                                             GLenum pname,
                                                             GLsizei bufSize,
                                                             GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetInternalformati64vNULL(GLenum target,
                                                       GLenum internalformat,
                                                       GLenum pname,
                                                       GLsizei bufSize,
                                                       GLint64 *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetInternalformativNULL(GLenum target,
                                                     GLenum internalformat,
                                                     GLenum pname,
                                                     GLsizei bufSize,
                                                     GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetMultisamplefvNULL(GLenum pname, GLuint index, GLfloat *val) {}
+void INTERNAL_GL_APIENTRY glGetMultisamplefvNULL(GLenum pname, GLuint index, GLfloat *val)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedBufferParameteri64vNULL(GLuint buffer,
                                                             GLenum pname,
                                                             GLint64 *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedBufferParameterivNULL(GLuint buffer,
                                                           GLenum pname,
                                                           GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedBufferPointervNULL(GLuint buffer, GLenum pname, void **params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedBufferSubDataNULL(GLuint buffer,
                                                       GLintptr offset,
                                                       GLsizeiptr size,
                                                       void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedFramebufferAttachmentParameterivNULL(GLuint framebuffer,
                                                                          GLenum attachment,
                                                                          GLenum pname,
                                                                          GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedFramebufferParameterivNULL(GLuint framebuffer,
                                                                GLenum pname,
                                                                GLint *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetNamedRenderbufferParameterivNULL(GLuint renderbuffer,
                                                                 GLenum pname,
                                                                 GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetObjectLabelNULL(GLenum identifier,
                                                GLuint name,
                                                GLsizei bufSize,
                                                GLsizei *length,
                                                GLchar *label)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetObjectPtrLabelNULL(const void *ptr,
                                                   GLsizei bufSize,
                                                   GLsizei *length,
                                                   GLchar *label)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetPathParameterfvNVNULL(GLuint path, GLenum pname, GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glGetPathParameterfvNVNULL(GLuint path, GLenum pname, GLfloat *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetPathParameterivNVNULL(GLuint path, GLenum pname, GLint *value) {}
+void INTERNAL_GL_APIENTRY glGetPathParameterivNVNULL(GLuint path, GLenum pname, GLint *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetPointervNULL(GLenum pname, void **params) {}
+void INTERNAL_GL_APIENTRY glGetPointervNULL(GLenum pname, void **params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramBinaryNULL(GLuint program,
                                                  GLsizei bufSize,
                                                  GLsizei *length,
                                                  GLenum *binaryFormat,
                                                  void *binary)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramInfoLogNULL(GLuint program,
                                                   GLsizei bufSize,
                                                   GLsizei *length,
                                                   GLchar *infoLog)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramInterfaceivNULL(GLuint program,
                                                       GLenum programInterface,
                                                       GLenum pname,
                                                       GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramPipelineInfoLogNULL(GLuint pipeline,
                                                           GLsizei bufSize,
                                                           GLsizei *length,
                                                           GLchar *infoLog)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramPipelineivNULL(GLuint pipeline, GLenum pname, GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLuint INTERNAL_GL_APIENTRY glGetProgramResourceIndexNULL(GLuint program,
                                                           GLenum programInterface,
                                                           const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLuint>(0);
 }
 
@@ -1172,6 +1805,7 @@ GLint INTERNAL_GL_APIENTRY glGetProgramResourceLocationNULL(GLuint program,
                                                             GLenum programInterface,
                                                             const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLint>(0);
 }
 
@@ -1179,6 +1813,7 @@ GLint INTERNAL_GL_APIENTRY glGetProgramResourceLocationIndexNULL(GLuint program,
                                                                  GLenum programInterface,
                                                                  const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLint>(0);
 }
 
@@ -1188,7 +1823,9 @@ void INTERNAL_GL_APIENTRY glGetProgramResourceNameNULL(GLuint program,
                                                        GLsizei bufSize,
                                                        GLsizei *length,
                                                        GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramResourceivNULL(GLuint program,
                                                      GLenum programInterface,
@@ -1198,102 +1835,155 @@ void INTERNAL_GL_APIENTRY glGetProgramResourceivNULL(GLuint program,
                                                      GLsizei bufSize,
                                                      GLsizei *length,
                                                      GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetProgramStageivNULL(GLuint program,
                                                   GLenum shadertype,
                                                   GLenum pname,
                                                   GLint *values)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetProgramivNULL(GLuint program, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetProgramivNULL(GLuint program, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryBufferObjecti64vNULL(GLuint id,
                                                          GLuint buffer,
                                                          GLenum pname,
                                                          GLintptr offset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryBufferObjectivNULL(GLuint id,
                                                        GLuint buffer,
                                                        GLenum pname,
                                                        GLintptr offset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryBufferObjectui64vNULL(GLuint id,
                                                           GLuint buffer,
                                                           GLenum pname,
                                                           GLintptr offset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryBufferObjectuivNULL(GLuint id,
                                                         GLuint buffer,
                                                         GLenum pname,
                                                         GLintptr offset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetQueryIndexedivNULL(GLenum target,
                                                   GLuint index,
                                                   GLenum pname,
                                                   GLint *params)
-{}
-
-void INTERNAL_GL_APIENTRY glGetQueryObjecti64vNULL(GLuint id, GLenum pname, GLint64 *params) {}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryObjectivNULL(GLuint id, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryObjecti64vNULL(GLuint id, GLenum pname, GLint64 *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryObjectui64vNULL(GLuint id, GLenum pname, GLuint64 *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryObjectivNULL(GLuint id, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
+
+void INTERNAL_GL_APIENTRY glGetQueryObjectui64vNULL(GLuint id, GLenum pname, GLuint64 *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryObjectuivNULL(GLuint id, GLenum pname, GLuint *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryObjectuivNULL(GLuint id, GLenum pname, GLuint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetQueryivNULL(GLenum target, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetQueryivNULL(GLenum target, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetRenderbufferParameterivNULL(GLenum target,
                                                            GLenum pname,
                                                            GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetSamplerParameterIivNULL(GLuint sampler, GLenum pname, GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetSamplerParameterIuivNULL(GLuint sampler,
                                                         GLenum pname,
                                                         GLuint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetSamplerParameterfvNULL(GLuint sampler, GLenum pname, GLfloat *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetSamplerParameterivNULL(GLuint sampler, GLenum pname, GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetShaderInfoLogNULL(GLuint shader,
                                                  GLsizei bufSize,
                                                  GLsizei *length,
                                                  GLchar *infoLog)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetShaderPrecisionFormatNULL(GLenum shadertype,
                                                          GLenum precisiontype,
                                                          GLint *range,
                                                          GLint *precision)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetShaderSourceNULL(GLuint shader,
                                                 GLsizei bufSize,
                                                 GLsizei *length,
                                                 GLchar *source)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetShaderivNULL(GLuint shader, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetShaderivNULL(GLuint shader, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
 const GLubyte *INTERNAL_GL_APIENTRY glGetStringNULL(GLenum name)
 {
+    gNullFunctionCallCount++;
     return static_cast<const GLubyte *>(0);
 }
 
 const GLubyte *INTERNAL_GL_APIENTRY glGetStringiNULL(GLenum name, GLuint index)
 {
+    gNullFunctionCallCount++;
     return static_cast<const GLubyte *>(0);
 }
 
@@ -1301,6 +1991,7 @@ GLuint INTERNAL_GL_APIENTRY glGetSubroutineIndexNULL(GLuint program,
                                                      GLenum shadertype,
                                                      const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLuint>(0);
 }
 
@@ -1308,36 +1999,57 @@ GLint INTERNAL_GL_APIENTRY glGetSubroutineUniformLocationNULL(GLuint program,
                                                               GLenum shadertype,
                                                               const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLint>(0);
 }
 
 void INTERNAL_GL_APIENTRY
 glGetSyncivNULL(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glGetTexImageNULL(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTexLevelParameterfvNULL(GLenum target,
                                                        GLint level,
                                                        GLenum pname,
                                                        GLfloat *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTexLevelParameterivNULL(GLenum target,
                                                        GLint level,
                                                        GLenum pname,
                                                        GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetTexParameterIivNULL(GLenum target, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetTexParameterIivNULL(GLenum target, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetTexParameterIuivNULL(GLenum target, GLenum pname, GLuint *params) {}
+void INTERNAL_GL_APIENTRY glGetTexParameterIuivNULL(GLenum target, GLenum pname, GLuint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetTexParameterfvNULL(GLenum target, GLenum pname, GLfloat *params) {}
+void INTERNAL_GL_APIENTRY glGetTexParameterfvNULL(GLenum target, GLenum pname, GLfloat *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetTexParameterivNULL(GLenum target, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetTexParameterivNULL(GLenum target, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureImageNULL(GLuint texture,
                                                 GLint level,
@@ -1345,33 +2057,47 @@ void INTERNAL_GL_APIENTRY glGetTextureImageNULL(GLuint texture,
                                                 GLenum type,
                                                 GLsizei bufSize,
                                                 void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureLevelParameterfvNULL(GLuint texture,
                                                            GLint level,
                                                            GLenum pname,
                                                            GLfloat *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureLevelParameterivNULL(GLuint texture,
                                                            GLint level,
                                                            GLenum pname,
                                                            GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureParameterIivNULL(GLuint texture, GLenum pname, GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureParameterIuivNULL(GLuint texture,
                                                         GLenum pname,
                                                         GLuint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureParameterfvNULL(GLuint texture, GLenum pname, GLfloat *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureParameterivNULL(GLuint texture, GLenum pname, GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTextureSubImageNULL(GLuint texture,
                                                    GLint level,
@@ -1385,7 +2111,9 @@ void INTERNAL_GL_APIENTRY glGetTextureSubImageNULL(GLuint texture,
                                                    GLenum type,
                                                    GLsizei bufSize,
                                                    void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTransformFeedbackVaryingNULL(GLuint program,
                                                             GLuint index,
@@ -1394,25 +2122,35 @@ void INTERNAL_GL_APIENTRY glGetTransformFeedbackVaryingNULL(GLuint program,
                                                             GLsizei *size,
                                                             GLenum *type,
                                                             GLchar *name)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTransformFeedbacki64_vNULL(GLuint xfb,
                                                           GLenum pname,
                                                           GLuint index,
                                                           GLint64 *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetTransformFeedbacki_vNULL(GLuint xfb,
                                                         GLenum pname,
                                                         GLuint index,
                                                         GLint *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetTransformFeedbackivNULL(GLuint xfb, GLenum pname, GLint *param) {}
+void INTERNAL_GL_APIENTRY glGetTransformFeedbackivNULL(GLuint xfb, GLenum pname, GLint *param)
+{
+    gNullFunctionCallCount++;
+}
 
 GLuint INTERNAL_GL_APIENTRY glGetUniformBlockIndexNULL(GLuint program,
                                                        const GLchar *uniformBlockName)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLuint>(0);
 }
 
@@ -1420,60 +2158,106 @@ void INTERNAL_GL_APIENTRY glGetUniformIndicesNULL(GLuint program,
                                                   GLsizei uniformCount,
                                                   const GLchar *const *uniformNames,
                                                   GLuint *uniformIndices)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLint INTERNAL_GL_APIENTRY glGetUniformLocationNULL(GLuint program, const GLchar *name)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLint>(0);
 }
 
 void INTERNAL_GL_APIENTRY glGetUniformSubroutineuivNULL(GLenum shadertype,
                                                         GLint location,
                                                         GLuint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetUniformdvNULL(GLuint program, GLint location, GLdouble *params) {}
+void INTERNAL_GL_APIENTRY glGetUniformdvNULL(GLuint program, GLint location, GLdouble *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetUniformfvNULL(GLuint program, GLint location, GLfloat *params) {}
+void INTERNAL_GL_APIENTRY glGetUniformfvNULL(GLuint program, GLint location, GLfloat *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetUniformivNULL(GLuint program, GLint location, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetUniformivNULL(GLuint program, GLint location, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetUniformuivNULL(GLuint program, GLint location, GLuint *params) {}
+void INTERNAL_GL_APIENTRY glGetUniformuivNULL(GLuint program, GLint location, GLuint *params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetVertexArrayIndexed64ivNULL(GLuint vaobj,
                                                           GLuint index,
                                                           GLenum pname,
                                                           GLint64 *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetVertexArrayIndexedivNULL(GLuint vaobj,
                                                         GLuint index,
                                                         GLenum pname,
                                                         GLint *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexArrayivNULL(GLuint vaobj, GLenum pname, GLint *param) {}
+void INTERNAL_GL_APIENTRY glGetVertexArrayivNULL(GLuint vaobj, GLenum pname, GLint *param)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribIivNULL(GLuint index, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribIivNULL(GLuint index, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribIuivNULL(GLuint index, GLenum pname, GLuint *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribIuivNULL(GLuint index, GLenum pname, GLuint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribLdvNULL(GLuint index, GLenum pname, GLdouble *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribLdvNULL(GLuint index, GLenum pname, GLdouble *params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetVertexAttribPointervNULL(GLuint index, GLenum pname, void **pointer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribdvNULL(GLuint index, GLenum pname, GLdouble *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribdvNULL(GLuint index, GLenum pname, GLdouble *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribfvNULL(GLuint index, GLenum pname, GLfloat *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribfvNULL(GLuint index, GLenum pname, GLfloat *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glGetVertexAttribivNULL(GLuint index, GLenum pname, GLint *params) {}
+void INTERNAL_GL_APIENTRY glGetVertexAttribivNULL(GLuint index, GLenum pname, GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetnCompressedTexImageNULL(GLenum target,
                                                        GLint lod,
                                                        GLsizei bufSize,
                                                        void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetnTexImageNULL(GLenum target,
                                              GLint level,
@@ -1481,52 +2265,77 @@ void INTERNAL_GL_APIENTRY glGetnTexImageNULL(GLenum target,
                                              GLenum type,
                                              GLsizei bufSize,
                                              void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetnUniformdvNULL(GLuint program,
                                               GLint location,
                                               GLsizei bufSize,
                                               GLdouble *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetnUniformfvNULL(GLuint program,
                                               GLint location,
                                               GLsizei bufSize,
                                               GLfloat *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetnUniformivNULL(GLuint program,
                                               GLint location,
                                               GLsizei bufSize,
                                               GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glGetnUniformuivNULL(GLuint program,
                                                GLint location,
                                                GLsizei bufSize,
                                                GLuint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glHintNULL(GLenum target, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glHintNULL(GLenum target, GLenum mode)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glInsertEventMarkerEXTNULL(GLsizei length, const GLchar *marker) {}
+void INTERNAL_GL_APIENTRY glInsertEventMarkerEXTNULL(GLsizei length, const GLchar *marker)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glInvalidateBufferDataNULL(GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glInvalidateBufferDataNULL(GLuint buffer)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateBufferSubDataNULL(GLuint buffer,
                                                         GLintptr offset,
                                                         GLsizeiptr length)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateFramebufferNULL(GLenum target,
                                                       GLsizei numAttachments,
                                                       const GLenum *attachments)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateNamedFramebufferDataNULL(GLuint framebuffer,
                                                                GLsizei numAttachments,
                                                                const GLenum *attachments)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateNamedFramebufferSubDataNULL(GLuint framebuffer,
                                                                   GLsizei numAttachments,
@@ -1535,7 +2344,9 @@ void INTERNAL_GL_APIENTRY glInvalidateNamedFramebufferSubDataNULL(GLuint framebu
                                                                   GLint y,
                                                                   GLsizei width,
                                                                   GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateSubFramebufferNULL(GLenum target,
                                                          GLsizei numAttachments,
@@ -1544,9 +2355,14 @@ void INTERNAL_GL_APIENTRY glInvalidateSubFramebufferNULL(GLenum target,
                                                          GLint y,
                                                          GLsizei width,
                                                          GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glInvalidateTexImageNULL(GLuint texture, GLint level) {}
+void INTERNAL_GL_APIENTRY glInvalidateTexImageNULL(GLuint texture, GLint level)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glInvalidateTexSubImageNULL(GLuint texture,
                                                       GLint level,
@@ -1556,96 +2372,124 @@ void INTERNAL_GL_APIENTRY glInvalidateTexSubImageNULL(GLuint texture,
                                                       GLsizei width,
                                                       GLsizei height,
                                                       GLsizei depth)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLboolean INTERNAL_GL_APIENTRY glIsBufferNULL(GLuint buffer)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsEnabledNULL(GLenum cap)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsEnablediNULL(GLenum target, GLuint index)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsFenceNVNULL(GLuint fence)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsFramebufferNULL(GLuint framebuffer)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsPathNVNULL(GLuint path)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsProgramNULL(GLuint program)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsProgramPipelineNULL(GLuint pipeline)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsQueryNULL(GLuint id)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsRenderbufferNULL(GLuint renderbuffer)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsSamplerNULL(GLuint sampler)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsShaderNULL(GLuint shader)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsSyncNULL(GLsync sync)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsTextureNULL(GLuint texture)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsTransformFeedbackNULL(GLuint id)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glIsVertexArrayNULL(GLuint array)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
-void INTERNAL_GL_APIENTRY glLineWidthNULL(GLfloat width) {}
+void INTERNAL_GL_APIENTRY glLineWidthNULL(GLfloat width)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glLinkProgramNULL(GLuint program) {}
+void INTERNAL_GL_APIENTRY glLinkProgramNULL(GLuint program)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glLogicOpNULL(GLenum opcode) {}
+void INTERNAL_GL_APIENTRY glLogicOpNULL(GLenum opcode)
+{
+    gNullFunctionCallCount++;
+}
 
 void *INTERNAL_GL_APIENTRY glMapBufferNULL(GLenum target, GLenum access)
 {
+    gNullFunctionCallCount++;
     return static_cast<void *>(0);
 }
 
@@ -1654,11 +2498,13 @@ void *INTERNAL_GL_APIENTRY glMapBufferRangeNULL(GLenum target,
                                                 GLsizeiptr length,
                                                 GLbitfield access)
 {
+    gNullFunctionCallCount++;
     return static_cast<void *>(0);
 }
 
 void *INTERNAL_GL_APIENTRY glMapNamedBufferNULL(GLuint buffer, GLenum access)
 {
+    gNullFunctionCallCount++;
     return static_cast<void *>(0);
 }
 
@@ -1667,35 +2513,54 @@ void *INTERNAL_GL_APIENTRY glMapNamedBufferRangeNULL(GLuint buffer,
                                                      GLsizeiptr length,
                                                      GLbitfield access)
 {
+    gNullFunctionCallCount++;
     return static_cast<void *>(0);
 }
 
-void INTERNAL_GL_APIENTRY glMatrixLoadfEXTNULL(GLenum mode, const GLfloat *m) {}
+void INTERNAL_GL_APIENTRY glMatrixLoadfEXTNULL(GLenum mode, const GLfloat *m)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glMemoryBarrierNULL(GLbitfield barriers) {}
+void INTERNAL_GL_APIENTRY glMemoryBarrierNULL(GLbitfield barriers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glMemoryBarrierByRegionNULL(GLbitfield barriers) {}
+void INTERNAL_GL_APIENTRY glMemoryBarrierByRegionNULL(GLbitfield barriers)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glMinSampleShadingNULL(GLfloat value) {}
+void INTERNAL_GL_APIENTRY glMinSampleShadingNULL(GLfloat value)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawArraysNULL(GLenum mode,
                                                 const GLint *first,
                                                 const GLsizei *count,
                                                 GLsizei drawcount)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawArraysIndirectNULL(GLenum mode,
                                                         const void *indirect,
                                                         GLsizei drawcount,
                                                         GLsizei stride)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawElementsNULL(GLenum mode,
                                                   const GLsizei *count,
                                                   GLenum type,
                                                   const void *const *indices,
                                                   GLsizei drawcount)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawElementsBaseVertexNULL(GLenum mode,
                                                             const GLsizei *count,
@@ -1703,91 +2568,131 @@ void INTERNAL_GL_APIENTRY glMultiDrawElementsBaseVertexNULL(GLenum mode,
                                                             const void *const *indices,
                                                             GLsizei drawcount,
                                                             const GLint *basevertex)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glMultiDrawElementsIndirectNULL(GLenum mode,
                                                           GLenum type,
                                                           const void *indirect,
                                                           GLsizei drawcount,
                                                           GLsizei stride)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedBufferDataNULL(GLuint buffer,
                                                 GLsizeiptr size,
                                                 const void *data,
                                                 GLenum usage)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedBufferStorageNULL(GLuint buffer,
                                                    GLsizeiptr size,
                                                    const void *data,
                                                    GLbitfield flags)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedBufferSubDataNULL(GLuint buffer,
                                                    GLintptr offset,
                                                    GLsizeiptr size,
                                                    const void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glNamedFramebufferDrawBufferNULL(GLuint framebuffer, GLenum buf) {}
+void INTERNAL_GL_APIENTRY glNamedFramebufferDrawBufferNULL(GLuint framebuffer, GLenum buf)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferDrawBuffersNULL(GLuint framebuffer,
                                                             GLsizei n,
                                                             const GLenum *bufs)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferParameteriNULL(GLuint framebuffer,
                                                            GLenum pname,
                                                            GLint param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glNamedFramebufferReadBufferNULL(GLuint framebuffer, GLenum src) {}
+void INTERNAL_GL_APIENTRY glNamedFramebufferReadBufferNULL(GLuint framebuffer, GLenum src)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferRenderbufferNULL(GLuint framebuffer,
                                                              GLenum attachment,
                                                              GLenum renderbuffertarget,
                                                              GLuint renderbuffer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferTextureNULL(GLuint framebuffer,
                                                         GLenum attachment,
                                                         GLuint texture,
                                                         GLint level)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedFramebufferTextureLayerNULL(GLuint framebuffer,
                                                              GLenum attachment,
                                                              GLuint texture,
                                                              GLint level,
                                                              GLint layer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedRenderbufferStorageNULL(GLuint renderbuffer,
                                                          GLenum internalformat,
                                                          GLsizei width,
                                                          GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glNamedRenderbufferStorageMultisampleNULL(GLuint renderbuffer,
                                                                     GLsizei samples,
                                                                     GLenum internalformat,
                                                                     GLsizei width,
                                                                     GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glObjectLabelNULL(GLenum identifier,
                                             GLuint name,
                                             GLsizei length,
                                             const GLchar *label)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glObjectPtrLabelNULL(const void *ptr, GLsizei length, const GLchar *label)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPatchParameterfvNULL(GLenum pname, const GLfloat *values) {}
+void INTERNAL_GL_APIENTRY glPatchParameterfvNULL(GLenum pname, const GLfloat *values)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPatchParameteriNULL(GLenum pname, GLint value) {}
+void INTERNAL_GL_APIENTRY glPatchParameteriNULL(GLenum pname, GLint value)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glPathCommandsNVNULL(GLuint path,
                                                GLsizei numCommands,
@@ -1795,37 +2700,84 @@ void INTERNAL_GL_APIENTRY glPathCommandsNVNULL(GLuint path,
                                                GLsizei numCoords,
                                                GLenum coordType,
                                                const void *coords)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPathParameterfNVNULL(GLuint path, GLenum pname, GLfloat value) {}
+void INTERNAL_GL_APIENTRY glPathParameterfNVNULL(GLuint path, GLenum pname, GLfloat value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPathParameteriNVNULL(GLuint path, GLenum pname, GLint value) {}
+void INTERNAL_GL_APIENTRY glPathParameteriNVNULL(GLuint path, GLenum pname, GLint value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPathStencilFuncNVNULL(GLenum func, GLint ref, GLuint mask) {}
+void INTERNAL_GL_APIENTRY glPathStencilFuncNVNULL(GLenum func, GLint ref, GLuint mask)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPauseTransformFeedbackNULL() {}
+void INTERNAL_GL_APIENTRY glPauseTransformFeedbackNULL()
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPixelStorefNULL(GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glPixelStorefNULL(GLenum pname, GLfloat param)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPixelStoreiNULL(GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glPixelStoreiNULL(GLenum pname, GLint param)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPointParameterfNULL(GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glPointParameterfNULL(GLenum pname, GLfloat param)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPointParameterfvNULL(GLenum pname, const GLfloat *params) {}
+void INTERNAL_GL_APIENTRY glPointParameterfvNULL(GLenum pname, const GLfloat *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPointParameteriNULL(GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glPointParameteriNULL(GLenum pname, GLint param)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPointParameterivNULL(GLenum pname, const GLint *params) {}
+void INTERNAL_GL_APIENTRY glPointParameterivNULL(GLenum pname, const GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPointSizeNULL(GLfloat size) {}
+void INTERNAL_GL_APIENTRY glPointSizeNULL(GLfloat size)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPolygonModeNULL(GLenum face, GLenum mode) {}
+void INTERNAL_GL_APIENTRY glPolygonModeNULL(GLenum face, GLenum mode)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPolygonOffsetNULL(GLfloat factor, GLfloat units) {}
+void INTERNAL_GL_APIENTRY glPolygonOffsetNULL(GLfloat factor, GLfloat units)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPopDebugGroupNULL() {}
+void INTERNAL_GL_APIENTRY glPopDebugGroupNULL()
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPopGroupMarkerEXTNULL() {}
+void INTERNAL_GL_APIENTRY glPopGroupMarkerEXTNULL()
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glPrimitiveBoundingBoxNULL(GLfloat minX,
                                                      GLfloat minY,
@@ -1835,141 +2787,205 @@ void INTERNAL_GL_APIENTRY glPrimitiveBoundingBoxNULL(GLfloat minX,
                                                      GLfloat maxY,
                                                      GLfloat maxZ,
                                                      GLfloat maxW)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPrimitiveRestartIndexNULL(GLuint index) {}
+void INTERNAL_GL_APIENTRY glPrimitiveRestartIndexNULL(GLuint index)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramBinaryNULL(GLuint program,
                                               GLenum binaryFormat,
                                               const void *binary,
                                               GLsizei length)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glProgramParameteriNULL(GLuint program, GLenum pname, GLint value) {}
+void INTERNAL_GL_APIENTRY glProgramParameteriNULL(GLuint program, GLenum pname, GLint value)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramPathFragmentInputGenNVNULL(GLuint program,
                                                               GLint location,
                                                               GLenum genMode,
                                                               GLint components,
                                                               const GLfloat *coeffs)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glProgramUniform1dNULL(GLuint program, GLint location, GLdouble v0) {}
+void INTERNAL_GL_APIENTRY glProgramUniform1dNULL(GLuint program, GLint location, GLdouble v0)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform1dvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glProgramUniform1fNULL(GLuint program, GLint location, GLfloat v0) {}
+void INTERNAL_GL_APIENTRY glProgramUniform1fNULL(GLuint program, GLint location, GLfloat v0)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform1fvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glProgramUniform1iNULL(GLuint program, GLint location, GLint v0) {}
+void INTERNAL_GL_APIENTRY glProgramUniform1iNULL(GLuint program, GLint location, GLint v0)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform1ivNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glProgramUniform1uiNULL(GLuint program, GLint location, GLuint v0) {}
+void INTERNAL_GL_APIENTRY glProgramUniform1uiNULL(GLuint program, GLint location, GLuint v0)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform1uivNULL(GLuint program,
                                                    GLint location,
                                                    GLsizei count,
                                                    const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2dNULL(GLuint program,
                                                  GLint location,
                                                  GLdouble v0,
                                                  GLdouble v1)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2dvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2fNULL(GLuint program,
                                                  GLint location,
                                                  GLfloat v0,
                                                  GLfloat v1)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2fvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2iNULL(GLuint program, GLint location, GLint v0, GLint v1)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2ivNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLint *value)
-{}
-
+{
+    gNullFunctionCallCount++;
+}
+
 void INTERNAL_GL_APIENTRY glProgramUniform2uiNULL(GLuint program,
                                                   GLint location,
                                                   GLuint v0,
                                                   GLuint v1)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform2uivNULL(GLuint program,
                                                    GLint location,
                                                    GLsizei count,
                                                    const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform3dNULL(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform3dvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform3fNULL(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform3fvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform3iNULL(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform3ivNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform3uiNULL(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform3uivNULL(GLuint program,
                                                    GLint location,
                                                    GLsizei count,
                                                    const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4dNULL(GLuint program,
                                                  GLint location,
@@ -1977,13 +2993,17 @@ void INTERNAL_GL_APIENTRY glProgramUniform4dNULL(GLuint program,
                                                  GLdouble v1,
                                                  GLdouble v2,
                                                  GLdouble v3)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4dvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4fNULL(GLuint program,
                                                  GLint location,
@@ -1991,173 +3011,235 @@ void INTERNAL_GL_APIENTRY glProgramUniform4fNULL(GLuint program,
                                                  GLfloat v1,
                                                  GLfloat v2,
                                                  GLfloat v3)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4fvNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform4iNULL(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4ivNULL(GLuint program,
                                                   GLint location,
                                                   GLsizei count,
                                                   const GLint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glProgramUniform4uiNULL(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniform4uivNULL(GLuint program,
                                                    GLint location,
                                                    GLsizei count,
                                                    const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2dvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2fvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x3dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x3fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x4dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix2x4fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3dvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3fvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x2dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x2fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x4dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix3x4fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4dvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4fvNULL(GLuint program,
                                                         GLint location,
                                                         GLsizei count,
                                                         GLboolean transpose,
                                                         const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x2dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x2fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x3dvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glProgramUniformMatrix4x3fvNULL(GLuint program,
                                                           GLint location,
                                                           GLsizei count,
                                                           GLboolean transpose,
                                                           const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glProvokingVertexNULL(GLenum mode) {}
+void INTERNAL_GL_APIENTRY glProvokingVertexNULL(GLenum mode)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glPushDebugGroupNULL(GLenum source,
                                                GLuint id,
                                                GLsizei length,
                                                const GLchar *message)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glPushGroupMarkerEXTNULL(GLsizei length, const GLchar *marker) {}
+void INTERNAL_GL_APIENTRY glPushGroupMarkerEXTNULL(GLsizei length, const GLchar *marker)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glQueryCounterNULL(GLuint id, GLenum target) {}
+void INTERNAL_GL_APIENTRY glQueryCounterNULL(GLuint id, GLenum target)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glReadBufferNULL(GLenum src) {}
+void INTERNAL_GL_APIENTRY glReadBufferNULL(GLenum src)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glReadPixelsNULL(GLint x,
                                            GLint y,
@@ -2166,7 +3248,9 @@ void INTERNAL_GL_APIENTRY glReadPixelsNULL(GLint x,
                                            GLenum format,
                                            GLenum type,
                                            void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glReadnPixelsNULL(GLint x,
                                             GLint y,
@@ -2176,80 +3260,132 @@ void INTERNAL_GL_APIENTRY glReadnPixelsNULL(GLint x,
                                             GLenum type,
                                             GLsizei bufSize,
                                             void *data)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glReleaseShaderCompilerNULL() {}
+void INTERNAL_GL_APIENTRY glReleaseShaderCompilerNULL()
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glRenderbufferStorageNULL(GLenum target,
                                                     GLenum internalformat,
                                                     GLsizei width,
                                                     GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glRenderbufferStorageMultisampleNULL(GLenum target,
                                                                GLsizei samples,
                                                                GLenum internalformat,
                                                                GLsizei width,
                                                                GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glResumeTransformFeedbackNULL() {}
+void INTERNAL_GL_APIENTRY glResumeTransformFeedbackNULL()
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glSampleCoverageNULL(GLfloat value, GLboolean invert) {}
+void INTERNAL_GL_APIENTRY glSampleCoverageNULL(GLfloat value, GLboolean invert)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glSampleMaskiNULL(GLuint maskNumber, GLbitfield mask) {}
+void INTERNAL_GL_APIENTRY glSampleMaskiNULL(GLuint maskNumber, GLbitfield mask)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glSamplerParameterIivNULL(GLuint sampler,
                                                     GLenum pname,
                                                     const GLint *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glSamplerParameterIuivNULL(GLuint sampler,
                                                      GLenum pname,
                                                      const GLuint *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glSamplerParameterfNULL(GLuint sampler, GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glSamplerParameterfNULL(GLuint sampler, GLenum pname, GLfloat param)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glSamplerParameterfvNULL(GLuint sampler,
                                                    GLenum pname,
                                                    const GLfloat *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glSamplerParameteriNULL(GLuint sampler, GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glSamplerParameteriNULL(GLuint sampler, GLenum pname, GLint param)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glSamplerParameterivNULL(GLuint sampler, GLenum pname, const GLint *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glScissorNULL(GLint x, GLint y, GLsizei width, GLsizei height) {}
+void INTERNAL_GL_APIENTRY glScissorNULL(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glScissorArrayvNULL(GLuint first, GLsizei count, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glScissorArrayvNULL(GLuint first, GLsizei count, const GLint *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glScissorIndexedNULL(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glScissorIndexedvNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glScissorIndexedvNULL(GLuint index, const GLint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glSetFenceNVNULL(GLuint fence, GLenum condition) {}
+void INTERNAL_GL_APIENTRY glSetFenceNVNULL(GLuint fence, GLenum condition)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glShaderBinaryNULL(GLsizei count,
                                              const GLuint *shaders,
                                              GLenum binaryformat,
                                              const void *binary,
                                              GLsizei length)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glShaderSourceNULL(GLuint shader,
                                              GLsizei count,
                                              const GLchar *const *string,
                                              const GLint *length)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glShaderStorageBlockBindingNULL(GLuint program,
                                                           GLuint storageBlockIndex,
                                                           GLuint storageBlockBinding)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glStencilFillPathInstancedNVNULL(GLsizei numPaths,
                                                            GLenum pathNameType,
@@ -2259,29 +3395,50 @@ void INTERNAL_GL_APIENTRY glStencilFillPathInstancedNVNULL(GLsizei numPaths,
                                                            GLuint mask,
                                                            GLenum transformType,
                                                            const GLfloat *transformValues)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glStencilFillPathNVNULL(GLuint path, GLenum fillMode, GLuint mask) {}
+void INTERNAL_GL_APIENTRY glStencilFillPathNVNULL(GLuint path, GLenum fillMode, GLuint mask)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glStencilFuncNULL(GLenum func, GLint ref, GLuint mask) {}
+void INTERNAL_GL_APIENTRY glStencilFuncNULL(GLenum func, GLint ref, GLuint mask)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glStencilFuncSeparateNULL(GLenum face,
                                                     GLenum func,
                                                     GLint ref,
                                                     GLuint mask)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glStencilMaskNULL(GLuint mask) {}
+void INTERNAL_GL_APIENTRY glStencilMaskNULL(GLuint mask)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glStencilMaskSeparateNULL(GLenum face, GLuint mask) {}
+void INTERNAL_GL_APIENTRY glStencilMaskSeparateNULL(GLenum face, GLuint mask)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glStencilOpNULL(GLenum fail, GLenum zfail, GLenum zpass) {}
+void INTERNAL_GL_APIENTRY glStencilOpNULL(GLenum fail, GLenum zfail, GLenum zpass)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glStencilOpSeparateNULL(GLenum face,
                                                   GLenum sfail,
                                                   GLenum dpfail,
                                                   GLenum dppass)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glStencilStrokePathInstancedNVNULL(GLsizei numPaths,
                                                              GLenum pathNameType,
@@ -2291,9 +3448,14 @@ void INTERNAL_GL_APIENTRY glStencilStrokePathInstancedNVNULL(GLsizei numPaths,
                                                              GLuint mask,
                                                              GLenum transformType,
                                                              const GLfloat *transformValues)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glStencilStrokePathNVNULL(GLuint path, GLint reference, GLuint mask) {}
+void INTERNAL_GL_APIENTRY glStencilStrokePathNVNULL(GLuint path, GLint reference, GLuint mask)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glStencilThenCoverFillPathInstancedNVNULL(GLsizei numPaths,
                                                                     GLenum pathNameType,
@@ -2304,13 +3466,17 @@ void INTERNAL_GL_APIENTRY glStencilThenCoverFillPathInstancedNVNULL(GLsizei numP
                                                                     GLenum coverMode,
                                                                     GLenum transformType,
                                                                     const GLfloat *transformValues)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glStencilThenCoverFillPathNVNULL(GLuint path,
                                                            GLenum fillMode,
                                                            GLuint mask,
                                                            GLenum coverMode)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glStencilThenCoverStrokePathInstancedNVNULL(GLsizei numPaths,
@@ -2322,27 +3488,37 @@ glStencilThenCoverStrokePathInstancedNVNULL(GLsizei numPaths,
                                             GLenum coverMode,
                                             GLenum transformType,
                                             const GLfloat *transformValues)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glStencilThenCoverStrokePathNVNULL(GLuint path,
                                                              GLint reference,
                                                              GLuint mask,
                                                              GLenum coverMode)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLboolean INTERNAL_GL_APIENTRY glTestFenceNVNULL(GLuint fence)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
-void INTERNAL_GL_APIENTRY glTexBufferNULL(GLenum target, GLenum internalformat, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glTexBufferNULL(GLenum target, GLenum internalformat, GLuint buffer)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexBufferRangeNULL(GLenum target,
                                                GLenum internalformat,
                                                GLuint buffer,
                                                GLintptr offset,
                                                GLsizeiptr size)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexImage1DNULL(GLenum target,
                                            GLint level,
@@ -2352,7 +3528,9 @@ void INTERNAL_GL_APIENTRY glTexImage1DNULL(GLenum target,
                                            GLenum format,
                                            GLenum type,
                                            const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexImage2DNULL(GLenum target,
                                            GLint level,
@@ -2363,7 +3541,9 @@ void INTERNAL_GL_APIENTRY glTexImage2DNULL(GLenum target,
                                            GLenum format,
                                            GLenum type,
                                            const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexImage2DMultisampleNULL(GLenum target,
                                                       GLsizei samples,
@@ -2371,7 +3551,9 @@ void INTERNAL_GL_APIENTRY glTexImage2DMultisampleNULL(GLenum target,
                                                       GLsizei width,
                                                       GLsizei height,
                                                       GLboolean fixedsamplelocations)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexImage3DNULL(GLenum target,
                                            GLint level,
@@ -2383,7 +3565,9 @@ void INTERNAL_GL_APIENTRY glTexImage3DNULL(GLenum target,
                                            GLenum format,
                                            GLenum type,
                                            const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexImage3DMultisampleNULL(GLenum target,
                                                       GLsizei samples,
@@ -2392,34 +3576,56 @@ void INTERNAL_GL_APIENTRY glTexImage3DMultisampleNULL(GLenum target,
                                                       GLsizei height,
                                                       GLsizei depth,
                                                       GLboolean fixedsamplelocations)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glTexParameterIivNULL(GLenum target, GLenum pname, const GLint *params) {}
+void INTERNAL_GL_APIENTRY glTexParameterIivNULL(GLenum target, GLenum pname, const GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexParameterIuivNULL(GLenum target, GLenum pname, const GLuint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glTexParameterfNULL(GLenum target, GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glTexParameterfNULL(GLenum target, GLenum pname, GLfloat param)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexParameterfvNULL(GLenum target, GLenum pname, const GLfloat *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glTexParameteriNULL(GLenum target, GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glTexParameteriNULL(GLenum target, GLenum pname, GLint param)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glTexParameterivNULL(GLenum target, GLenum pname, const GLint *params) {}
+void INTERNAL_GL_APIENTRY glTexParameterivNULL(GLenum target, GLenum pname, const GLint *params)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage1DNULL(GLenum target,
                                              GLsizei levels,
                                              GLenum internalformat,
                                              GLsizei width)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage2DNULL(GLenum target,
                                              GLsizei levels,
                                              GLenum internalformat,
                                              GLsizei width,
                                              GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage2DMultisampleNULL(GLenum target,
                                                         GLsizei samples,
@@ -2427,7 +3633,9 @@ void INTERNAL_GL_APIENTRY glTexStorage2DMultisampleNULL(GLenum target,
                                                         GLsizei width,
                                                         GLsizei height,
                                                         GLboolean fixedsamplelocations)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage3DNULL(GLenum target,
                                              GLsizei levels,
@@ -2435,7 +3643,9 @@ void INTERNAL_GL_APIENTRY glTexStorage3DNULL(GLenum target,
                                              GLsizei width,
                                              GLsizei height,
                                              GLsizei depth)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexStorage3DMultisampleNULL(GLenum target,
                                                         GLsizei samples,
@@ -2444,7 +3654,9 @@ void INTERNAL_GL_APIENTRY glTexStorage3DMultisampleNULL(GLenum target,
                                                         GLsizei height,
                                                         GLsizei depth,
                                                         GLboolean fixedsamplelocations)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexSubImage1DNULL(GLenum target,
                                               GLint level,
@@ -2453,7 +3665,9 @@ void INTERNAL_GL_APIENTRY glTexSubImage1DNULL(GLenum target,
                                               GLenum format,
                                               GLenum type,
                                               const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexSubImage2DNULL(GLenum target,
                                               GLint level,
@@ -2464,7 +3678,9 @@ void INTERNAL_GL_APIENTRY glTexSubImage2DNULL(GLenum target,
                                               GLenum format,
                                               GLenum type,
                                               const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTexSubImage3DNULL(GLenum target,
                                               GLint level,
@@ -2477,54 +3693,81 @@ void INTERNAL_GL_APIENTRY glTexSubImage3DNULL(GLenum target,
                                               GLenum format,
                                               GLenum type,
                                               const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glTextureBarrierNULL() {}
+void INTERNAL_GL_APIENTRY glTextureBarrierNULL()
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureBufferNULL(GLuint texture, GLenum internalformat, GLuint buffer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureBufferRangeNULL(GLuint texture,
                                                    GLenum internalformat,
                                                    GLuint buffer,
                                                    GLintptr offset,
                                                    GLsizeiptr size)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureParameterIivNULL(GLuint texture,
                                                     GLenum pname,
                                                     const GLint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureParameterIuivNULL(GLuint texture,
                                                      GLenum pname,
                                                      const GLuint *params)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glTextureParameterfNULL(GLuint texture, GLenum pname, GLfloat param) {}
+void INTERNAL_GL_APIENTRY glTextureParameterfNULL(GLuint texture, GLenum pname, GLfloat param)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureParameterfvNULL(GLuint texture,
                                                    GLenum pname,
                                                    const GLfloat *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glTextureParameteriNULL(GLuint texture, GLenum pname, GLint param) {}
+void INTERNAL_GL_APIENTRY glTextureParameteriNULL(GLuint texture, GLenum pname, GLint param)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureParameterivNULL(GLuint texture, GLenum pname, const GLint *param)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage1DNULL(GLuint texture,
                                                  GLsizei levels,
                                                  GLenum internalformat,
                                                  GLsizei width)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage2DNULL(GLuint texture,
                                                  GLsizei levels,
                                                  GLenum internalformat,
                                                  GLsizei width,
                                                  GLsizei height)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage2DMultisampleNULL(GLuint texture,
                                                             GLsizei samples,
@@ -2532,7 +3775,9 @@ void INTERNAL_GL_APIENTRY glTextureStorage2DMultisampleNULL(GLuint texture,
                                                             GLsizei width,
                                                             GLsizei height,
                                                             GLboolean fixedsamplelocations)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage3DNULL(GLuint texture,
                                                  GLsizei levels,
@@ -2540,7 +3785,9 @@ void INTERNAL_GL_APIENTRY glTextureStorage3DNULL(GLuint texture,
                                                  GLsizei width,
                                                  GLsizei height,
                                                  GLsizei depth)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureStorage3DMultisampleNULL(GLuint texture,
                                                             GLsizei samples,
@@ -2549,7 +3796,9 @@ void INTERNAL_GL_APIENTRY glTextureStorage3DMultisampleNULL(GLuint texture,
                                                             GLsizei height,
                                                             GLsizei depth,
                                                             GLboolean fixedsamplelocations)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureSubImage1DNULL(GLuint texture,
                                                   GLint level,
@@ -2558,7 +3807,9 @@ void INTERNAL_GL_APIENTRY glTextureSubImage1DNULL(GLuint texture,
                                                   GLenum format,
                                                   GLenum type,
                                                   const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureSubImage2DNULL(GLuint texture,
                                                   GLint level,
@@ -2569,7 +3820,9 @@ void INTERNAL_GL_APIENTRY glTextureSubImage2DNULL(GLuint texture,
                                                   GLenum format,
                                                   GLenum type,
                                                   const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureSubImage3DNULL(GLuint texture,
                                                   GLint level,
@@ -2582,7 +3835,9 @@ void INTERNAL_GL_APIENTRY glTextureSubImage3DNULL(GLuint texture,
                                                   GLenum format,
                                                   GLenum type,
                                                   const void *pixels)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTextureViewNULL(GLuint texture,
                                             GLenum target,
@@ -2592,235 +3847,391 @@ void INTERNAL_GL_APIENTRY glTextureViewNULL(GLuint texture,
                                             GLuint numlevels,
                                             GLuint minlayer,
                                             GLuint numlayers)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTransformFeedbackBufferBaseNULL(GLuint xfb, GLuint index, GLuint buffer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTransformFeedbackBufferRangeNULL(GLuint xfb,
                                                              GLuint index,
                                                              GLuint buffer,
                                                              GLintptr offset,
                                                              GLsizeiptr size)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glTransformFeedbackVaryingsNULL(GLuint program,
                                                           GLsizei count,
                                                           const GLchar *const *varyings,
                                                           GLenum bufferMode)
-{}
-
-void INTERNAL_GL_APIENTRY glUniform1dNULL(GLint location, GLdouble x) {}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform1dvNULL(GLint location, GLsizei count, const GLdouble *value) {}
+void INTERNAL_GL_APIENTRY glUniform1dNULL(GLint location, GLdouble x)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform1fNULL(GLint location, GLfloat v0) {}
+void INTERNAL_GL_APIENTRY glUniform1dvNULL(GLint location, GLsizei count, const GLdouble *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform1fvNULL(GLint location, GLsizei count, const GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glUniform1fNULL(GLint location, GLfloat v0)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform1iNULL(GLint location, GLint v0) {}
+void INTERNAL_GL_APIENTRY glUniform1fvNULL(GLint location, GLsizei count, const GLfloat *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform1ivNULL(GLint location, GLsizei count, const GLint *value) {}
+void INTERNAL_GL_APIENTRY glUniform1iNULL(GLint location, GLint v0)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform1uiNULL(GLint location, GLuint v0) {}
+void INTERNAL_GL_APIENTRY glUniform1ivNULL(GLint location, GLsizei count, const GLint *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform1uivNULL(GLint location, GLsizei count, const GLuint *value) {}
+void INTERNAL_GL_APIENTRY glUniform1uiNULL(GLint location, GLuint v0)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform2dNULL(GLint location, GLdouble x, GLdouble y) {}
+void INTERNAL_GL_APIENTRY glUniform1uivNULL(GLint location, GLsizei count, const GLuint *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform2dvNULL(GLint location, GLsizei count, const GLdouble *value) {}
+void INTERNAL_GL_APIENTRY glUniform2dNULL(GLint location, GLdouble x, GLdouble y)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform2fNULL(GLint location, GLfloat v0, GLfloat v1) {}
+void INTERNAL_GL_APIENTRY glUniform2dvNULL(GLint location, GLsizei count, const GLdouble *value)
+{
+    gNullFunctionCallCount++;
+}
+
+void INTERNAL_GL_APIENTRY glUniform2fNULL(GLint location, GLfloat v0, GLfloat v1)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform2fvNULL(GLint location, GLsizei count, const GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glUniform2fvNULL(GLint location, GLsizei count, const GLfloat *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform2iNULL(GLint location, GLint v0, GLint v1) {}
+void INTERNAL_GL_APIENTRY glUniform2iNULL(GLint location, GLint v0, GLint v1)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform2ivNULL(GLint location, GLsizei count, const GLint *value) {}
+void INTERNAL_GL_APIENTRY glUniform2ivNULL(GLint location, GLsizei count, const GLint *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform2uiNULL(GLint location, GLuint v0, GLuint v1) {}
+void INTERNAL_GL_APIENTRY glUniform2uiNULL(GLint location, GLuint v0, GLuint v1)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform2uivNULL(GLint location, GLsizei count, const GLuint *value) {}
+void INTERNAL_GL_APIENTRY glUniform2uivNULL(GLint location, GLsizei count, const GLuint *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform3dNULL(GLint location, GLdouble x, GLdouble y, GLdouble z) {}
+void INTERNAL_GL_APIENTRY glUniform3dNULL(GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform3dvNULL(GLint location, GLsizei count, const GLdouble *value) {}
+void INTERNAL_GL_APIENTRY glUniform3dvNULL(GLint location, GLsizei count, const GLdouble *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform3fNULL(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {}
+void INTERNAL_GL_APIENTRY glUniform3fNULL(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform3fvNULL(GLint location, GLsizei count, const GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glUniform3fvNULL(GLint location, GLsizei count, const GLfloat *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform3iNULL(GLint location, GLint v0, GLint v1, GLint v2) {}
+void INTERNAL_GL_APIENTRY glUniform3iNULL(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform3ivNULL(GLint location, GLsizei count, const GLint *value) {}
+void INTERNAL_GL_APIENTRY glUniform3ivNULL(GLint location, GLsizei count, const GLint *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform3uiNULL(GLint location, GLuint v0, GLuint v1, GLuint v2) {}
+void INTERNAL_GL_APIENTRY glUniform3uiNULL(GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform3uivNULL(GLint location, GLsizei count, const GLuint *value) {}
+void INTERNAL_GL_APIENTRY glUniform3uivNULL(GLint location, GLsizei count, const GLuint *value)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glUniform4dNULL(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform4dvNULL(GLint location, GLsizei count, const GLdouble *value) {}
+void INTERNAL_GL_APIENTRY glUniform4dvNULL(GLint location, GLsizei count, const GLdouble *value)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glUniform4fNULL(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform4fvNULL(GLint location, GLsizei count, const GLfloat *value) {}
+void INTERNAL_GL_APIENTRY glUniform4fvNULL(GLint location, GLsizei count, const GLfloat *value)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform4iNULL(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {}
+void INTERNAL_GL_APIENTRY glUniform4iNULL(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform4ivNULL(GLint location, GLsizei count, const GLint *value) {}
+void INTERNAL_GL_APIENTRY glUniform4ivNULL(GLint location, GLsizei count, const GLint *value)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glUniform4uiNULL(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glUniform4uivNULL(GLint location, GLsizei count, const GLuint *value) {}
+void INTERNAL_GL_APIENTRY glUniform4uivNULL(GLint location, GLsizei count, const GLuint *value)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformBlockBindingNULL(GLuint program,
                                                     GLuint uniformBlockIndex,
                                                     GLuint uniformBlockBinding)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2dvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2fvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2x3dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2x3fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2x4dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix2x4fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3dvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3fvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3x2dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3x2fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3x4dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix3x4fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4dvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4fvNULL(GLint location,
                                                  GLsizei count,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4x2dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4x2fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4x3dvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLdouble *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformMatrix4x3fvNULL(GLint location,
                                                    GLsizei count,
                                                    GLboolean transpose,
                                                    const GLfloat *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUniformSubroutinesuivNULL(GLenum shadertype,
                                                       GLsizei count,
                                                       const GLuint *indices)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 GLboolean INTERNAL_GL_APIENTRY glUnmapBufferNULL(GLenum target)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
 GLboolean INTERNAL_GL_APIENTRY glUnmapNamedBufferNULL(GLuint buffer)
 {
+    gNullFunctionCallCount++;
     return static_cast<GLboolean>(0);
 }
 
-void INTERNAL_GL_APIENTRY glUseProgramNULL(GLuint program) {}
+void INTERNAL_GL_APIENTRY glUseProgramNULL(GLuint program)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glUseProgramStagesNULL(GLuint pipeline, GLbitfield stages, GLuint program)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glValidateProgramNULL(GLuint program) {}
+void INTERNAL_GL_APIENTRY glValidateProgramNULL(GLuint program)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glValidateProgramPipelineNULL(GLuint pipeline) {}
+void INTERNAL_GL_APIENTRY glValidateProgramPipelineNULL(GLuint pipeline)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayAttribBindingNULL(GLuint vaobj,
                                                          GLuint attribindex,
                                                          GLuint bindingindex)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayAttribFormatNULL(GLuint vaobj,
                                                         GLuint attribindex,
@@ -2828,35 +4239,48 @@ void INTERNAL_GL_APIENTRY glVertexArrayAttribFormatNULL(GLuint vaobj,
                                                         GLenum type,
                                                         GLboolean normalized,
                                                         GLuint relativeoffset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayAttribIFormatNULL(GLuint vaobj,
                                                          GLuint attribindex,
                                                          GLint size,
                                                          GLenum type,
                                                          GLuint relativeoffset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayAttribLFormatNULL(GLuint vaobj,
                                                          GLuint attribindex,
                                                          GLint size,
                                                          GLenum type,
                                                          GLuint relativeoffset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayBindingDivisorNULL(GLuint vaobj,
                                                           GLuint bindingindex,
                                                           GLuint divisor)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexArrayElementBufferNULL(GLuint vaobj, GLuint buffer) {}
+void INTERNAL_GL_APIENTRY glVertexArrayElementBufferNULL(GLuint vaobj, GLuint buffer)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayVertexBufferNULL(GLuint vaobj,
                                                         GLuint bindingindex,
                                                         GLuint buffer,
                                                         GLintptr offset,
                                                         GLsizei stride)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexArrayVertexBuffersNULL(GLuint vaobj,
                                                          GLuint first,
@@ -2864,232 +4288,452 @@ void INTERNAL_GL_APIENTRY glVertexArrayVertexBuffersNULL(GLuint vaobj,
                                                          const GLuint *buffers,
                                                          const GLintptr *offsets,
                                                          const GLsizei *strides)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1dNULL(GLuint index, GLdouble x) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1dNULL(GLuint index, GLdouble x)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1dvNULL(GLuint index, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1fNULL(GLuint index, GLfloat x) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1fNULL(GLuint index, GLfloat x)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1fvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1fvNULL(GLuint index, const GLfloat *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1sNULL(GLuint index, GLshort x) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1sNULL(GLuint index, GLshort x)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib1svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib1svNULL(GLuint index, const GLshort *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2dNULL(GLuint index, GLdouble x, GLdouble y) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2dNULL(GLuint index, GLdouble x, GLdouble y)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2dvNULL(GLuint index, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2fNULL(GLuint index, GLfloat x, GLfloat y) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2fNULL(GLuint index, GLfloat x, GLfloat y)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2fvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2fvNULL(GLuint index, const GLfloat *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2sNULL(GLuint index, GLshort x, GLshort y) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2sNULL(GLuint index, GLshort x, GLshort y)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib2svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib2svNULL(GLuint index, const GLshort *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3dvNULL(GLuint index, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3fNULL(GLuint index, GLfloat x, GLfloat y, GLfloat z) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3fNULL(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3fvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3fvNULL(GLuint index, const GLfloat *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3sNULL(GLuint index, GLshort x, GLshort y, GLshort z) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3sNULL(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib3svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib3svNULL(GLuint index, const GLshort *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NbvNULL(GLuint index, const GLbyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NbvNULL(GLuint index, const GLbyte *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NivNULL(GLuint index, const GLint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NsvNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NsvNULL(GLuint index, const GLshort *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttrib4NubNULL(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NubvNULL(GLuint index, const GLubyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NubvNULL(GLuint index, const GLubyte *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NuivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NuivNULL(GLuint index, const GLuint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4NusvNULL(GLuint index, const GLushort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4NusvNULL(GLuint index, const GLushort *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4bvNULL(GLuint index, const GLbyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4bvNULL(GLuint index, const GLbyte *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttrib4dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4dvNULL(GLuint index, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttrib4fNULL(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4fvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4fvNULL(GLuint index, const GLfloat *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4ivNULL(GLuint index, const GLint *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttrib4sNULL(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4svNULL(GLuint index, const GLshort *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4ubvNULL(GLuint index, const GLubyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4ubvNULL(GLuint index, const GLubyte *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4uivNULL(GLuint index, const GLuint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttrib4usvNULL(GLuint index, const GLushort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttrib4usvNULL(GLuint index, const GLushort *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribBindingNULL(GLuint attribindex, GLuint bindingindex) {}
+void INTERNAL_GL_APIENTRY glVertexAttribBindingNULL(GLuint attribindex, GLuint bindingindex)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribDivisorNULL(GLuint index, GLuint divisor) {}
+void INTERNAL_GL_APIENTRY glVertexAttribDivisorNULL(GLuint index, GLuint divisor)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribFormatNULL(GLuint attribindex,
                                                    GLint size,
                                                    GLenum type,
                                                    GLboolean normalized,
                                                    GLuint relativeoffset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI1iNULL(GLuint index, GLint x) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI1iNULL(GLuint index, GLint x)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI1ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI1ivNULL(GLuint index, const GLint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI1uiNULL(GLuint index, GLuint x) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI1uiNULL(GLuint index, GLuint x)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI1uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI1uivNULL(GLuint index, const GLuint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI2iNULL(GLuint index, GLint x, GLint y) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI2iNULL(GLuint index, GLint x, GLint y)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI2ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI2ivNULL(GLuint index, const GLint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI2uiNULL(GLuint index, GLuint x, GLuint y) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI2uiNULL(GLuint index, GLuint x, GLuint y)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI2uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI2uivNULL(GLuint index, const GLuint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI3iNULL(GLuint index, GLint x, GLint y, GLint z) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI3iNULL(GLuint index, GLint x, GLint y, GLint z)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI3ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI3ivNULL(GLuint index, const GLint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI3uiNULL(GLuint index, GLuint x, GLuint y, GLuint z) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI3uiNULL(GLuint index, GLuint x, GLuint y, GLuint z)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI3uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI3uivNULL(GLuint index, const GLuint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4bvNULL(GLuint index, const GLbyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4bvNULL(GLuint index, const GLbyte *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4iNULL(GLuint index, GLint x, GLint y, GLint z, GLint w) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4iNULL(GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4ivNULL(GLuint index, const GLint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4ivNULL(GLuint index, const GLint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4svNULL(GLuint index, const GLshort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4svNULL(GLuint index, const GLshort *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4ubvNULL(GLuint index, const GLubyte *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4ubvNULL(GLuint index, const GLubyte *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttribI4uiNULL(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4uivNULL(GLuint index, const GLuint *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4uivNULL(GLuint index, const GLuint *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribI4usvNULL(GLuint index, const GLushort *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribI4usvNULL(GLuint index, const GLushort *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribIFormatNULL(GLuint attribindex,
                                                     GLint size,
                                                     GLenum type,
                                                     GLuint relativeoffset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribIPointerNULL(GLuint index,
                                                      GLint size,
                                                      GLenum type,
                                                      GLsizei stride,
                                                      const void *pointer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL1dNULL(GLuint index, GLdouble x) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL1dNULL(GLuint index, GLdouble x)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL1dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL1dvNULL(GLuint index, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL2dNULL(GLuint index, GLdouble x, GLdouble y) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL2dNULL(GLuint index, GLdouble x, GLdouble y)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL2dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL2dvNULL(GLuint index, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL3dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL3dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL3dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL3dvNULL(GLuint index, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glVertexAttribL4dNULL(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexAttribL4dvNULL(GLuint index, const GLdouble *v) {}
+void INTERNAL_GL_APIENTRY glVertexAttribL4dvNULL(GLuint index, const GLdouble *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribLFormatNULL(GLuint attribindex,
                                                     GLint size,
                                                     GLenum type,
                                                     GLuint relativeoffset)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribLPointerNULL(GLuint index,
                                                      GLint size,
                                                      GLenum type,
                                                      GLsizei stride,
                                                      const void *pointer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP1uiNULL(GLuint index,
                                                  GLenum type,
                                                  GLboolean normalized,
                                                  GLuint value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP1uivNULL(GLuint index,
                                                   GLenum type,
                                                   GLboolean normalized,
                                                   const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP2uiNULL(GLuint index,
                                                  GLenum type,
                                                  GLboolean normalized,
                                                  GLuint value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP2uivNULL(GLuint index,
                                                   GLenum type,
                                                   GLboolean normalized,
                                                   const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP3uiNULL(GLuint index,
                                                  GLenum type,
                                                  GLboolean normalized,
                                                  GLuint value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP3uivNULL(GLuint index,
                                                   GLenum type,
                                                   GLboolean normalized,
                                                   const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP4uiNULL(GLuint index,
                                                  GLenum type,
                                                  GLboolean normalized,
                                                  GLuint value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribP4uivNULL(GLuint index,
                                                   GLenum type,
                                                   GLboolean normalized,
                                                   const GLuint *value)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY glVertexAttribPointerNULL(GLuint index,
                                                     GLint size,
@@ -3097,19 +4741,38 @@ void INTERNAL_GL_APIENTRY glVertexAttribPointerNULL(GLuint index,
                                                     GLboolean normalized,
                                                     GLsizei stride,
                                                     const void *pointer)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glVertexBindingDivisorNULL(GLuint bindingindex, GLuint divisor) {}
+void INTERNAL_GL_APIENTRY glVertexBindingDivisorNULL(GLuint bindingindex, GLuint divisor)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glViewportNULL(GLint x, GLint y, GLsizei width, GLsizei height) {}
+void INTERNAL_GL_APIENTRY glViewportNULL(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glViewportArrayvNULL(GLuint first, GLsizei count, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glViewportArrayvNULL(GLuint first, GLsizei count, const GLfloat *v)
+{
+    gNullFunctionCallCount++;
+}
 
 void INTERNAL_GL_APIENTRY
 glViewportIndexedfNULL(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
-{}
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glViewportIndexedfvNULL(GLuint index, const GLfloat *v) {}
+void INTERNAL_GL_APIENTRY glViewportIndexedfvNULL(GLuint index, const GLfloat *v)
+{
+    gNullFunctionCallCount++;
+}
 
-void INTERNAL_GL_APIENTRY glWaitSyncNULL(GLsync sync, GLbitfield flags, GLuint64 timeout) {}
+void INTERNAL_GL_APIENTRY glWaitSyncNULL(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    gNullFunctionCallCount++;
+}
 }  // namespace rx
@@ -15,6 +15,11 @@
 
 namespace rx
 {
+// Every NULL/stub binding increments a shared counter, giving a deterministic count of the native
+// calls the back-end makes on the NULL device.
+size_t GetNullFunctionCallCount();
+void ResetNullFunctionCallCount();
+
 void INTERNAL_GL_APIENTRY glActiveShaderProgramNULL(GLuint pipeline, GLuint program);
 void INTERNAL_GL_APIENTRY glActiveTextureNULL(GLenum texture);
 void INTERNAL_GL_APIENTRY glAttachShaderNULL(GLuint program, GLuint shader);
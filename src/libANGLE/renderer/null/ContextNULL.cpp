@@ -9,9 +9,13 @@
 
 #include "libANGLE/renderer/null/ContextNULL.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "common/debug.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/null/BufferNULL.h"
 #include "libANGLE/renderer/null/CompilerNULL.h"
 #include "libANGLE/renderer/null/DisplayNULL.h"
@@ -29,9 +33,17 @@
 #include "libANGLE/renderer/null/TextureNULL.h"
 #include "libANGLE/renderer/null/TransformFeedbackNULL.h"
 #include "libANGLE/renderer/null/VertexArrayNULL.h"
+#include "libANGLE/renderer/renderer_utils.h"
 
 namespace rx
 {
+namespace
+{
+int ClampToHistogramSample(uint64_t value)
+{
+    return static_cast<int>(std::min<uint64_t>(value, std::numeric_limits<int>::max()));
+}
+}  // anonymous namespace
 
 AllocationTrackerNULL::AllocationTrackerNULL(size_t maxTotalAllocationSize)
     : mAllocatedBytes(0), mMaxBytes(maxTotalAllocationSize)
@@ -62,7 +74,10 @@ bool AllocationTrackerNULL::updateMemoryAllocation(size_t oldSize, size_t newSiz
 ContextNULL::ContextNULL(const gl::State &state,
                          gl::ErrorSet *errorSet,
                          AllocationTrackerNULL *allocationTracker)
-    : ContextImpl(state, errorSet), mAllocationTracker(allocationTracker)
+    : ContextImpl(state, errorSet),
+      mAllocationTracker(allocationTracker),
+      mDrawCallCount(0),
+      mSubDrawCount(0)
 {
     ASSERT(mAllocationTracker != nullptr);
 
@@ -106,6 +121,18 @@ ContextNULL::ContextNULL(const gl::State &state,
 
 ContextNULL::~ContextNULL() {}
 
+void ContextNULL::onDestroy(const gl::Context *context)
+{
+    if (mDrawCallCount == 0)
+    {
+        return;
+    }
+
+    // Reported so that tests and benchmarks can tell how many back-end calls their draws took.
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.NULLDrawCalls", ClampToHistogramSample(mDrawCallCount));
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.NULLSubDraws", ClampToHistogramSample(mSubDrawCount));
+}
+
 angle::Result ContextNULL::initialize()
 {
     return angle::Result::Continue;
@@ -126,6 +153,7 @@ angle::Result ContextNULL::drawArrays(const gl::Context *context,
                                       GLint first,
                                       GLsizei count)
 {
+    onDraw();
     return angle::Result::Continue;
 }
 
@@ -135,6 +163,7 @@ angle::Result ContextNULL::drawArraysInstanced(const gl::Context *context,
                                                GLsizei count,
                                                GLsizei instanceCount)
 {
+    onDraw();
     return angle::Result::Continue;
 }
 
@@ -144,6 +173,7 @@ angle::Result ContextNULL::drawElements(const gl::Context *context,
                                         gl::DrawElementsType type,
                                         const void *indices)
 {
+    onDraw();
     return angle::Result::Continue;
 }
 
@@ -154,6 +184,7 @@ angle::Result ContextNULL::drawElementsInstanced(const gl::Context *context,
                                                  const void *indices,
                                                  GLsizei instances)
 {
+    onDraw();
     return angle::Result::Continue;
 }
 
@@ -165,6 +196,7 @@ angle::Result ContextNULL::drawRangeElements(const gl::Context *context,
                                              gl::DrawElementsType type,
                                              const void *indices)
 {
+    onDraw();
     return angle::Result::Continue;
 }
 
@@ -172,6 +204,7 @@ angle::Result ContextNULL::drawArraysIndirect(const gl::Context *context,
                                               gl::PrimitiveMode mode,
                                               const void *indirect)
 {
+    onDraw();
     return angle::Result::Continue;
 }
 
@@ -180,6 +213,61 @@ angle::Result ContextNULL::drawElementsIndirect(const gl::Context *context,
                                                 gl::DrawElementsType type,
                                                 const void *indirect)
 {
+    onDraw();
+    return angle::Result::Continue;
+}
+
+angle::Result ContextNULL::multiDrawArrays(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLint *firsts,
+                                           const GLsizei *counts,
+                                           GLsizei drawcount)
+{
+    const uint64_t drawCallCount = mDrawCallCount;
+    ANGLE_TRY(rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount));
+    onMultiDraw(drawCallCount);
+    return angle::Result::Continue;
+}
+
+angle::Result ContextNULL::multiDrawArraysInstanced(const gl::Context *context,
+                                                    gl::PrimitiveMode mode,
+                                                    const GLint *firsts,
+                                                    const GLsizei *counts,
+                                                    const GLsizei *instanceCounts,
+                                                    GLsizei drawcount)
+{
+    const uint64_t drawCallCount = mDrawCallCount;
+    ANGLE_TRY(rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts,
+                                                  instanceCounts, drawcount));
+    onMultiDraw(drawCallCount);
+    return angle::Result::Continue;
+}
+
+angle::Result ContextNULL::multiDrawElements(const gl::Context *context,
+                                             gl::PrimitiveMode mode,
+                                             const GLsizei *counts,
+                                             gl::DrawElementsType type,
+                                             const GLvoid *const *indices,
+                                             GLsizei drawcount)
+{
+    const uint64_t drawCallCount = mDrawCallCount;
+    ANGLE_TRY(rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount));
+    onMultiDraw(drawCallCount);
+    return angle::Result::Continue;
+}
+
+angle::Result ContextNULL::multiDrawElementsInstanced(const gl::Context *context,
+                                                      gl::PrimitiveMode mode,
+                                                      const GLsizei *counts,
+                                                      gl::DrawElementsType type,
+                                                      const GLvoid *const *indices,
+                                                      const GLsizei *instanceCounts,
+                                                      GLsizei drawcount)
+{
+    const uint64_t drawCallCount = mDrawCallCount;
+    ANGLE_TRY(rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
+                                                    instanceCounts, drawcount));
+    onMultiDraw(drawCallCount);
     return angle::Result::Continue;
 }
 
@@ -39,12 +39,14 @@ class ContextNULL : public ContextImpl
     ~ContextNULL() override;
 
     angle::Result initialize() override;
+    void onDestroy(const gl::Context *context) override;
 
     // Flush and finish.
     angle::Result flush(const gl::Context *context) override;
     angle::Result finish(const gl::Context *context) override;
 
-    // Drawing methods.
+    // Drawing methods.  Nothing is drawn, but the calls are counted.  A multi-draw call counts as
+    // a single back-end call for all of its sub-draws.
     angle::Result drawArrays(const gl::Context *context,
                              gl::PrimitiveMode mode,
                              GLint first,
@@ -81,6 +83,32 @@ class ContextNULL : public ContextImpl
                                        gl::DrawElementsType type,
                                        const void *indirect) override;
 
+    // ANGLE_multi_draw
+    angle::Result multiDrawArrays(const gl::Context *context,
+                                  gl::PrimitiveMode mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  GLsizei drawcount) override;
+    angle::Result multiDrawArraysInstanced(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLint *firsts,
+                                           const GLsizei *counts,
+                                           const GLsizei *instanceCounts,
+                                           GLsizei drawcount) override;
+    angle::Result multiDrawElements(const gl::Context *context,
+                                    gl::PrimitiveMode mode,
+                                    const GLsizei *counts,
+                                    gl::DrawElementsType type,
+                                    const GLvoid *const *indices,
+                                    GLsizei drawcount) override;
+    angle::Result multiDrawElementsInstanced(const gl::Context *context,
+                                             gl::PrimitiveMode mode,
+                                             const GLsizei *counts,
+                                             gl::DrawElementsType type,
+                                             const GLvoid *const *indices,
+                                             const GLsizei *instanceCounts,
+                                             GLsizei drawcount) override;
+
     // CHROMIUM_path_rendering path drawing methods.
     void stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask) override;
     void stencilStrokePath(const gl::Path *path, GLint reference, GLuint mask) override;
@@ -214,12 +242,26 @@ class ContextNULL : public ContextImpl
                      unsigned int line);
 
   private:
+    void onDraw()
+    {
+        mDrawCallCount++;
+        mSubDrawCount++;
+    }
+
+    // The multi-draw methods issue their sub-draws through the draw methods above, so that the
+    // transform feedback accounting of the general helpers is kept.  Only the multi-draw itself
+    // counts as a back-end call.
+    void onMultiDraw(uint64_t drawCallCountBefore) { mDrawCallCount = drawCallCountBefore + 1; }
+
     gl::Caps mCaps;
     gl::TextureCapsMap mTextureCaps;
     gl::Extensions mExtensions;
     gl::Limitations mLimitations;
 
     AllocationTrackerNULL *mAllocationTracker;
+
+    uint64_t mDrawCallCount;
+    uint64_t mSubDrawCount;
 };
 
 }  // namespace rx
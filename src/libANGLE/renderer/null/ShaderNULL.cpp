@@ -31,6 +31,13 @@ bool ShaderNULL::postTranslateCompile(gl::ShCompilerInstance *compiler, std::str
     return true;
 }
 
+void ShaderNULL::save(gl::BinaryOutputStream *stream) const {}
+
+bool ShaderNULL::load(gl::BinaryInputStream *stream, std::string *infoLog)
+{
+    return true;
+}
+
 std::string ShaderNULL::getDebugInfo() const
 {
     return "";
@@ -27,6 +27,8 @@ class ShaderNULL : public ShaderImpl
                                                    std::string *sourcePath) override;
     // Returns success for compiling on the driver. Returns success.
     bool postTranslateCompile(gl::ShCompilerInstance *compiler, std::string *infoLog) override;
+    void save(gl::BinaryOutputStream *stream) const override;
+    bool load(gl::BinaryInputStream *stream, std::string *infoLog) override;
 
     std::string getDebugInfo() const override;
 };
@@ -14,6 +14,8 @@
 
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Context.inl.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/Format.h"
@@ -157,6 +159,12 @@ bool ExpandMatrix(T *target, const GLfloat *value)
     memcpy(target, staging, kTargetWidth * kTargetHeight * sizeof(T));
     return true;
 }
+
+// Matches gl::Context::noopDraw: the sub-draw can't produce a single primitive.
+bool IsNoopDraw(gl::PrimitiveMode mode, GLsizei count)
+{
+    return count < gl::kMinimumPrimitiveCounts[mode];
+}
 }  // anonymous namespace
 
 PackPixelsParams::PackPixelsParams()
@@ -608,4 +616,116 @@ angle::Result GetVertexRangeInfo(const gl::Context *context,
     }
     return angle::Result::Continue;
 }
+
+angle::Result MultiDrawArraysGeneral(ContextImpl *contextImpl,
+                                     const gl::Context *context,
+                                     gl::PrimitiveMode mode,
+                                     const GLint *firsts,
+                                     const GLsizei *counts,
+                                     GLsizei drawcount)
+{
+    gl::Program *programObject = context->getState().getLinkedProgram(context);
+    const bool hasDrawID       = programObject && programObject->hasDrawIDUniform();
+
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (IsNoopDraw(mode, counts[drawID]))
+        {
+            continue;
+        }
+        if (hasDrawID)
+        {
+            programObject->setDrawIDUniform(drawID);
+        }
+        ANGLE_TRY(contextImpl->drawArrays(context, mode, firsts[drawID], counts[drawID]));
+        gl::MarkTransformFeedbackBufferUsage(context, counts[drawID], 1);
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result MultiDrawArraysInstancedGeneral(ContextImpl *contextImpl,
+                                              const gl::Context *context,
+                                              gl::PrimitiveMode mode,
+                                              const GLint *firsts,
+                                              const GLsizei *counts,
+                                              const GLsizei *instanceCounts,
+                                              GLsizei drawcount)
+{
+    gl::Program *programObject = context->getState().getLinkedProgram(context);
+    const bool hasDrawID       = programObject && programObject->hasDrawIDUniform();
+
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (IsNoopDraw(mode, counts[drawID]) || instanceCounts[drawID] == 0)
+        {
+            continue;
+        }
+        if (hasDrawID)
+        {
+            programObject->setDrawIDUniform(drawID);
+        }
+        ANGLE_TRY(contextImpl->drawArraysInstanced(context, mode, firsts[drawID], counts[drawID],
+                                                   instanceCounts[drawID]));
+        gl::MarkTransformFeedbackBufferUsage(context, counts[drawID], instanceCounts[drawID]);
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result MultiDrawElementsGeneral(ContextImpl *contextImpl,
+                                       const gl::Context *context,
+                                       gl::PrimitiveMode mode,
+                                       const GLsizei *counts,
+                                       gl::DrawElementsType type,
+                                       const GLvoid *const *indices,
+                                       GLsizei drawcount)
+{
+    gl::Program *programObject = context->getState().getLinkedProgram(context);
+    const bool hasDrawID       = programObject && programObject->hasDrawIDUniform();
+
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (IsNoopDraw(mode, counts[drawID]))
+        {
+            continue;
+        }
+        if (hasDrawID)
+        {
+            programObject->setDrawIDUniform(drawID);
+        }
+        ANGLE_TRY(contextImpl->drawElements(context, mode, counts[drawID], type, indices[drawID]));
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result MultiDrawElementsInstancedGeneral(ContextImpl *contextImpl,
+                                                const gl::Context *context,
+                                                gl::PrimitiveMode mode,
+                                                const GLsizei *counts,
+                                                gl::DrawElementsType type,
+                                                const GLvoid *const *indices,
+                                                const GLsizei *instanceCounts,
+                                                GLsizei drawcount)
+{
+    gl::Program *programObject = context->getState().getLinkedProgram(context);
+    const bool hasDrawID       = programObject && programObject->hasDrawIDUniform();
+
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (IsNoopDraw(mode, counts[drawID]) || instanceCounts[drawID] == 0)
+        {
+            continue;
+        }
+        if (hasDrawID)
+        {
+            programObject->setDrawIDUniform(drawID);
+        }
+        ANGLE_TRY(contextImpl->drawElementsInstanced(context, mode, counts[drawID], type,
+                                                     indices[drawID], instanceCounts[drawID]));
+    }
+
+    return angle::Result::Continue;
+}
 }  // namespace rx
@@ -178,22 +178,33 @@ angle::Result BufferVk::getIndexRange(const gl::Context *context,
     }
 
     TRACE_EVENT0("gpu.angle", "BufferVk::getIndexRange");
-    // Needed before reading buffer or we could get stale data.
-    ANGLE_TRY(renderer->finish(contextVk));
 
+    // Note: this is only reached when the front-end validates buffer accesses, i.e. in robust or
+    // WebGL contexts on devices without robustBufferAccess.  Otherwise, out-of-range indices are
+    // clamped by the device and no index range is needed.
     // TODO(jmadill): Consider keeping a shadow system memory copy in some cases.
     ASSERT(mBuffer.valid());
 
-    const GLuint &typeBytes = gl::GetDrawElementsTypeSize(type);
+    void *mapPointer = nullptr;
+    ANGLE_TRY(mapForReadAccess(contextVk, &mapPointer));
 
-    uint8_t *mapPointer = nullptr;
-    ANGLE_VK_TRY(contextVk, mBuffer.getDeviceMemory().map(contextVk->getDevice(), offset,
-                                                          typeBytes * count, 0, &mapPointer));
+    *outRange = gl::ComputeIndexRange(type, static_cast<const uint8_t *>(mapPointer) + offset,
+                                      count, primitiveRestartEnabled);
 
-    *outRange = gl::ComputeIndexRange(type, mapPointer, count, primitiveRestartEnabled);
+    return unmapImpl(contextVk);
+}
 
-    mBuffer.getDeviceMemory().unmap(contextVk->getDevice());
-    return angle::Result::Continue;
+angle::Result BufferVk::mapForReadAccess(ContextVk *contextVk, void **mapPtr)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // Needed before reading buffer or we could get stale data.
+    if (mBuffer.isResourceInUse(renderer))
+    {
+        ANGLE_TRY(renderer->finish(contextVk));
+    }
+
+    return mapImpl(contextVk, mapPtr);
 }
 
 angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
@@ -207,24 +218,23 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
     // Use map when available.
     if (mBuffer.isResourceInUse(renderer))
     {
-        vk::StagingBuffer stagingBuffer;
-        ANGLE_TRY(stagingBuffer.init(contextVk, static_cast<VkDeviceSize>(size),
-                                     vk::StagingUsage::Write));
-
-        uint8_t *mapPointer = nullptr;
-        ANGLE_VK_TRY(contextVk,
-                     stagingBuffer.getDeviceMemory().map(device, 0, size, 0, &mapPointer));
+        // Stage the data in the renderer's shared staging ring.  The ring is recycled once the
+        // submission containing the copy has finished, so no per-upload allocation is needed.
+        vk::DynamicBuffer *stagingBuffer = renderer->getStagingBuffer();
+
+        uint8_t *mapPointer        = nullptr;
+        VkDeviceSize stagingOffset = 0;
+        ANGLE_TRY(stagingBuffer->allocate(contextVk, size, &mapPointer, nullptr, &stagingOffset,
+                                          nullptr));
         ASSERT(mapPointer);
 
         memcpy(mapPointer, data, size);
-        stagingBuffer.getDeviceMemory().unmap(device);
+        ANGLE_TRY(stagingBuffer->flush(contextVk));
 
         // Enqueue a copy command on the GPU.
-        VkBufferCopy copyRegion = {0, offset, size};
-        ANGLE_TRY(mBuffer.copyFromBuffer(contextVk, stagingBuffer.getBuffer(), copyRegion));
-
-        // Immediately release staging buffer. We should probably be using a DynamicBuffer here.
-        renderer->releaseObject(renderer->getCurrentQueueSerial(), &stagingBuffer);
+        VkBufferCopy copyRegion = {stagingOffset, offset, size};
+        ANGLE_TRY(mBuffer.copyFromBuffer(
+            contextVk, stagingBuffer->getCurrentBuffer()->getBuffer(), copyRegion));
     }
     else
     {
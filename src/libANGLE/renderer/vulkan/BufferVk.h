@@ -73,6 +73,10 @@ class BufferVk : public BufferImpl
     angle::Result mapImpl(ContextVk *contextVk, void **mapPtr);
     angle::Result unmapImpl(ContextVk *contextVk);
 
+    // Maps the buffer for reading on the CPU.  Only waits for the GPU if the buffer is still in
+    // use, as otherwise its memory already holds the latest data.
+    angle::Result mapForReadAccess(ContextVk *contextVk, void **mapPtr);
+
     // Calls copyBuffer internally.
     angle::Result copyToBuffer(ContextVk *contextVk,
                                vk::BufferHelper *destBuffer,
@@ -90,8 +90,58 @@ const char *GetResourceTypeName(CommandGraphResourceType resourceType,
             return "";
     }
 }
+
+void InitAttachmentOp(PackedAttachmentOpsDesc *ops, const angle::Format &format)
+{
+    VkImageLayout layout = format.hasDepthOrStencilBits()
+                               ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                               : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    ops->loadOp        = VK_ATTACHMENT_LOAD_OP_LOAD;
+    ops->storeOp       = VK_ATTACHMENT_STORE_OP_STORE;
+    ops->initialLayout = static_cast<uint16_t>(layout);
+    ops->finalLayout   = static_cast<uint16_t>(layout);
+
+    if (format.stencilBits > 0)
+    {
+        ops->stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_LOAD;
+        ops->stencilStoreOp = VK_ATTACHMENT_STORE_OP_STORE;
+    }
+    else
+    {
+        ops->stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        ops->stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    }
+}
+
+void CountAttachmentOps(uint8_t loadOp, uint8_t storeOp, RenderPassCounters *counters)
+{
+    if (loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR)
+    {
+        counters->attachmentsCleared++;
+    }
+    else if (loadOp == VK_ATTACHMENT_LOAD_OP_LOAD)
+    {
+        counters->attachmentsLoaded++;
+    }
+
+    if (storeOp == VK_ATTACHMENT_STORE_OP_STORE)
+    {
+        counters->attachmentsStored++;
+    }
+}
 }  // anonymous namespace
 
+RenderPassCounters &operator+=(RenderPassCounters &lhs, const RenderPassCounters &rhs)
+{
+    lhs.renderPasses += rhs.renderPasses;
+    lhs.mergedRenderPasses += rhs.mergedRenderPasses;
+    lhs.attachmentsCleared += rhs.attachmentsCleared;
+    lhs.attachmentsLoaded += rhs.attachmentsLoaded;
+    lhs.attachmentsStored += rhs.attachmentsStored;
+    return lhs;
+}
+
 // CommandGraphResource implementation.
 CommandGraphResource::CommandGraphResource(CommandGraphResourceType resourceType)
     : mCurrentWritingNode(nullptr), mResourceType(resourceType)
@@ -155,7 +205,31 @@ angle::Result CommandGraphResource::beginRenderPass(ContextVk *contextVk,
 
     mCurrentWritingNode->setCommandBufferOwner(contextVk);
 
-    return mCurrentWritingNode->beginInsideRenderPassRecording(contextVk, commandBufferOut);
+    CommandBuffer *renderPassCommands = nullptr;
+    ANGLE_TRY(mCurrentWritingNode->beginInsideRenderPassRecording(contextVk, &renderPassCommands));
+
+    // If the caller doesn't take the command buffer, the RenderPass is still empty.
+    if (commandBufferOut)
+    {
+        mCurrentWritingNode->onRenderPassCommandsRequested();
+        *commandBufferOut = renderPassCommands;
+    }
+
+    return angle::Result::Continue;
+}
+
+void CommandGraphResource::clearRenderPassAttachment(size_t attachmentIndex,
+                                                     VkImageAspectFlags aspectFlags,
+                                                     const VkClearValue &clearValue)
+{
+    ASSERT(hasStartedEmptyRenderPass());
+    mCurrentWritingNode->clearRenderPassAttachment(attachmentIndex, aspectFlags, clearValue);
+}
+
+void CommandGraphResource::deferRenderPassAttachmentBarrier()
+{
+    ASSERT(hasStartedRenderPass());
+    mCurrentWritingNode->setRenderPassAttachmentBarrier();
 }
 
 void CommandGraphResource::addWriteDependency(CommandGraphResource *writingResource)
@@ -219,6 +293,10 @@ void CommandGraphResource::onWriteImpl(CommandGraphNode *writingNode, Serial cur
 // CommandGraphNode implementation.
 CommandGraphNode::CommandGraphNode(CommandGraphNodeFunction function)
     : mRenderPassClearValues{},
+      mRenderPassCommandsRequested(false),
+      mRenderPassNeedsAttachmentBarrier(false),
+      mRenderPassContinuesPrevious(false),
+      mRenderPassContinuesInNext(false),
       mFunction(function),
       mQueryPool(VK_NULL_HANDLE),
       mQueryIndex(0),
@@ -306,6 +384,45 @@ void CommandGraphNode::storeRenderPassInfo(const Framebuffer &framebuffer,
     mRenderPassFramebuffer.setHandle(framebuffer.getHandle());
     mRenderPassRenderArea = renderArea;
     std::copy(clearValues.begin(), clearValues.end(), mRenderPassClearValues.begin());
+
+    // Attachments are loaded and stored by default.  Clears and the optimization pass at
+    // submission time may override these.
+    for (size_t attachmentIndex = 0; attachmentIndex < renderPassDesc.attachmentCount();
+         ++attachmentIndex)
+    {
+        InitAttachmentOp(&mRenderPassAttachmentOps[attachmentIndex],
+                         angle::Format::Get(renderPassDesc[attachmentIndex]));
+    }
+}
+
+void CommandGraphNode::clearRenderPassAttachment(size_t attachmentIndex,
+                                                 VkImageAspectFlags aspectFlags,
+                                                 const VkClearValue &clearValue)
+{
+    ASSERT(attachmentIndex < mRenderPassDesc.attachmentCount());
+    ASSERT(!mRenderPassCommandsRequested);
+
+    PackedAttachmentOpsDesc &ops = mRenderPassAttachmentOps[attachmentIndex];
+    VkClearValue &storedValue    = mRenderPassClearValues[attachmentIndex];
+
+    if ((aspectFlags & VK_IMAGE_ASPECT_COLOR_BIT) != 0)
+    {
+        ops.loadOp  = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        storedValue = clearValue;
+        return;
+    }
+
+    if ((aspectFlags & VK_IMAGE_ASPECT_DEPTH_BIT) != 0)
+    {
+        ops.loadOp                     = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        storedValue.depthStencil.depth = clearValue.depthStencil.depth;
+    }
+
+    if ((aspectFlags & VK_IMAGE_ASPECT_STENCIL_BIT) != 0)
+    {
+        ops.stencilLoadOp                = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        storedValue.depthStencil.stencil = clearValue.depthStencil.stencil;
+    }
 }
 
 // static
@@ -392,10 +509,109 @@ void CommandGraphNode::visitParents(std::vector<CommandGraphNode *> *stack)
     mVisitedState = VisitedState::Ready;
 }
 
-angle::Result CommandGraphNode::visitAndExecute(vk::Context *context,
-                                                Serial serial,
-                                                RenderPassCache *renderPassCache,
-                                                CommandBuffer *primaryCommandBuffer)
+bool CommandGraphNode::canMergeRenderPassWith(const CommandGraphNode *previous) const
+{
+    // Only render passes that start right after the previous one ends can be merged.  Any
+    // outside-render-pass command or barrier in between would have to be recorded inside the
+    // render pass, which is not allowed.
+    if (mFunction != CommandGraphNodeFunction::Generic ||
+        previous->mFunction != CommandGraphNodeFunction::Generic ||
+        !mInsideRenderPassCommands.valid() || !previous->mInsideRenderPassCommands.valid() ||
+        mOutsideRenderPassCommands.valid() || mGlobalMemoryBarrierSrcAccess != 0)
+    {
+        return false;
+    }
+
+    if (mRenderPassFramebuffer.getHandle() != previous->mRenderPassFramebuffer.getHandle() ||
+        !(mRenderPassDesc == previous->mRenderPassDesc) ||
+        mRenderPassRenderArea != previous->mRenderPassRenderArea)
+    {
+        return false;
+    }
+
+    // Clears folded into the load ops cannot be applied in the middle of a render pass.
+    for (size_t attachmentIndex = 0; attachmentIndex < mRenderPassDesc.attachmentCount();
+         ++attachmentIndex)
+    {
+        const PackedAttachmentOpsDesc &ops = mRenderPassAttachmentOps[attachmentIndex];
+        if (ops.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR ||
+            ops.stencilLoadOp == VK_ATTACHMENT_LOAD_OP_CLEAR)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void CommandGraphNode::mergeRenderPassWith(CommandGraphNode *previous)
+{
+    ASSERT(canMergeRenderPassWith(previous));
+
+    // The render pass is begun by the first node of the chain, so its load ops and clear values
+    // apply to the whole chain.  They are carried along so that the counters of the last node
+    // describe the merged render pass.  Store ops are never changed by clears, so the ops of the
+    // first node are valid for the end of the render pass as well.
+    for (size_t attachmentIndex = 0; attachmentIndex < mRenderPassDesc.attachmentCount();
+         ++attachmentIndex)
+    {
+        PackedAttachmentOpsDesc &ops = mRenderPassAttachmentOps[attachmentIndex];
+        const PackedAttachmentOpsDesc &previousOps =
+            previous->mRenderPassAttachmentOps[attachmentIndex];
+
+        ops.loadOp        = previousOps.loadOp;
+        ops.stencilLoadOp = previousOps.stencilLoadOp;
+    }
+    std::copy(previous->mRenderPassClearValues.begin(), previous->mRenderPassClearValues.end(),
+              mRenderPassClearValues.begin());
+
+    previous->mRenderPassContinuesInNext = true;
+    mRenderPassContinuesPrevious         = true;
+}
+
+void CommandGraphNode::accumulateRenderPassCounters(RenderPassCounters *counters) const
+{
+    if (mFunction != CommandGraphNodeFunction::Generic || !mInsideRenderPassCommands.valid())
+    {
+        return;
+    }
+
+    if (mRenderPassContinuesPrevious)
+    {
+        counters->mergedRenderPasses++;
+    }
+    else
+    {
+        counters->renderPasses++;
+    }
+
+    // Only the node that ends the render pass has the final load and store ops.
+    if (mRenderPassContinuesInNext)
+    {
+        return;
+    }
+
+    for (size_t attachmentIndex = 0; attachmentIndex < mRenderPassDesc.attachmentCount();
+         ++attachmentIndex)
+    {
+        const PackedAttachmentOpsDesc &ops = mRenderPassAttachmentOps[attachmentIndex];
+        const angle::Format &format        = angle::Format::Get(mRenderPassDesc[attachmentIndex]);
+
+        if (!format.hasDepthOrStencilBits() || format.depthBits > 0)
+        {
+            CountAttachmentOps(ops.loadOp, ops.storeOp, counters);
+        }
+        if (format.stencilBits > 0)
+        {
+            CountAttachmentOps(ops.stencilLoadOp, ops.stencilStoreOp, counters);
+        }
+    }
+}
+
+angle::Result CommandGraphNode::execute(vk::Context *context,
+                                        Serial serial,
+                                        RenderPassCache *renderPassCache,
+                                        CommandBuffer *primaryCommandBuffer)
 {
     switch (mFunction)
     {
@@ -425,14 +641,50 @@ angle::Result CommandGraphNode::visitAndExecute(vk::Context *context,
 
             if (mInsideRenderPassCommands.valid())
             {
-                // Pull a compatible RenderPass from the cache.
-                // TODO(jmadill): Insert real ops and layout transitions.
-                RenderPass *renderPass = nullptr;
-                ANGLE_TRY(renderPassCache->getCompatibleRenderPass(context, serial, mRenderPassDesc,
-                                                                   &renderPass));
-
                 ANGLE_VK_TRY(context, mInsideRenderPassCommands.end());
 
+                // A merged render pass is already open.
+                if (mRenderPassContinuesPrevious)
+                {
+                    primaryCommandBuffer->executeCommands(1, &mInsideRenderPassCommands);
+                    if (!mRenderPassContinuesInNext)
+                    {
+                        primaryCommandBuffer->endRenderPass();
+                    }
+                    break;
+                }
+
+                // Make prior attachment writes available to this render pass.  Layout transitions
+                // would have done this, but none was necessary.
+                if (mRenderPassNeedsAttachmentBarrier)
+                {
+                    constexpr VkAccessFlags kAttachmentWriteAccess =
+                        VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                        VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                    constexpr VkAccessFlags kAttachmentAccess =
+                        kAttachmentWriteAccess | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+                        VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+                    constexpr VkPipelineStageFlags kAttachmentStages =
+                        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                        VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+                        VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+
+                    VkMemoryBarrier memoryBarrier = {};
+                    memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                    memoryBarrier.srcAccessMask   = kAttachmentWriteAccess;
+                    memoryBarrier.dstAccessMask   = kAttachmentAccess;
+
+                    primaryCommandBuffer->pipelineBarrier(kAttachmentStages, kAttachmentStages, 0,
+                                                          1, &memoryBarrier, 0, nullptr, 0,
+                                                          nullptr);
+                }
+
+                // Pull a RenderPass with the right load and store ops from the cache.
+                // TODO(jmadill): Insert layout transitions.
+                RenderPass *renderPass = nullptr;
+                ANGLE_TRY(renderPassCache->getRenderPassWithOps(
+                    context, serial, mRenderPassDesc, mRenderPassAttachmentOps, &renderPass));
+
                 VkRenderPassBeginInfo beginInfo = {};
                 beginInfo.sType                 = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
                 beginInfo.renderPass            = renderPass->getHandle();
@@ -449,7 +701,10 @@ angle::Result CommandGraphNode::visitAndExecute(vk::Context *context,
                 primaryCommandBuffer->beginRenderPass(
                     beginInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
                 primaryCommandBuffer->executeCommands(1, &mInsideRenderPassCommands);
-                primaryCommandBuffer->endRenderPass();
+                if (!mRenderPassContinuesInNext)
+                {
+                    primaryCommandBuffer->endRenderPass();
+                }
             }
             break;
 
@@ -503,7 +758,6 @@ angle::Result CommandGraphNode::visitAndExecute(vk::Context *context,
             UNREACHABLE();
     }
 
-    mVisitedState = VisitedState::Visited;
     return angle::Result::Continue;
 }
 
@@ -600,13 +854,17 @@ angle::Result CommandGraph::submitCommands(Context *context,
 
     ANGLE_VK_TRY(context, primaryCommandBufferOut->init(context->getDevice(), primaryInfo));
 
+    std::vector<CommandGraphNode *> executionOrder;
+    linearizeNodes(&executionOrder);
+
+    RenderPassCounters counters = optimizeRenderPasses(executionOrder);
+    mRenderPassCounters += counters;
+
     if (mEnableGraphDiagnostics)
     {
-        dumpGraphDotFile(std::cout);
+        dumpGraphDotFile(std::cout, counters);
     }
 
-    std::vector<CommandGraphNode *> nodeStack;
-
     VkCommandBufferBeginInfo beginInfo = {};
     beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
@@ -617,6 +875,27 @@ angle::Result CommandGraph::submitCommands(Context *context,
     ANGLE_TRY(context->getRenderer()->traceGpuEvent(
         context, primaryCommandBufferOut, TRACE_EVENT_PHASE_BEGIN, "Primary Command Buffer"));
 
+    for (CommandGraphNode *node : executionOrder)
+    {
+        ANGLE_TRY(node->execute(context, serial, renderPassCache, primaryCommandBufferOut));
+    }
+
+    ANGLE_TRY(context->getRenderer()->traceGpuEvent(
+        context, primaryCommandBufferOut, TRACE_EVENT_PHASE_END, "Primary Command Buffer"));
+
+    ANGLE_VK_TRY(context, primaryCommandBufferOut->end());
+
+    clear();
+
+    return angle::Result::Continue;
+}
+
+void CommandGraph::linearizeNodes(std::vector<CommandGraphNode *> *executionOrderOut)
+{
+    executionOrderOut->reserve(mNodes.size());
+
+    std::vector<CommandGraphNode *> nodeStack;
+
     for (CommandGraphNode *topLevelNode : mNodes)
     {
         // Only process commands that don't have child commands. The others will be pulled in
@@ -636,8 +915,8 @@ angle::Result CommandGraph::submitCommands(Context *context,
                     node->visitParents(&nodeStack);
                     break;
                 case VisitedState::Ready:
-                    ANGLE_TRY(node->visitAndExecute(context, serial, renderPassCache,
-                                                    primaryCommandBufferOut));
+                    node->setVisited();
+                    executionOrderOut->push_back(node);
                     nodeStack.pop_back();
                     break;
                 case VisitedState::Visited:
@@ -649,15 +928,30 @@ angle::Result CommandGraph::submitCommands(Context *context,
             }
         }
     }
+}
 
-    ANGLE_TRY(context->getRenderer()->traceGpuEvent(
-        context, primaryCommandBufferOut, TRACE_EVENT_PHASE_END, "Primary Command Buffer"));
+RenderPassCounters CommandGraph::optimizeRenderPasses(
+    const std::vector<CommandGraphNode *> &executionOrder)
+{
+    RenderPassCounters counters;
 
-    ANGLE_VK_TRY(context, primaryCommandBufferOut->end());
+    for (size_t nodeIndex = 1; nodeIndex < executionOrder.size(); ++nodeIndex)
+    {
+        CommandGraphNode *previous = executionOrder[nodeIndex - 1];
+        CommandGraphNode *node     = executionOrder[nodeIndex];
 
-    clear();
+        if (node->canMergeRenderPassWith(previous))
+        {
+            node->mergeRenderPassWith(previous);
+        }
+    }
 
-    return angle::Result::Continue;
+    for (const CommandGraphNode *node : executionOrder)
+    {
+        node->accumulateRenderPassCounters(&counters);
+    }
+
+    return counters;
 }
 
 bool CommandGraph::empty() const
@@ -713,7 +1007,7 @@ void CommandGraph::waitFenceSync(const vk::Event &event)
 }
 
 // Dumps the command graph into a dot file that works with graphviz.
-void CommandGraph::dumpGraphDotFile(std::ostream &out) const
+void CommandGraph::dumpGraphDotFile(std::ostream &out, const RenderPassCounters &counters) const
 {
     // This ID maps a node pointer to a monatonic ID. It allows us to look up parent node IDs.
     std::map<const CommandGraphNode *, int> nodeIDMap;
@@ -732,6 +1026,11 @@ void CommandGraph::dumpGraphDotFile(std::ostream &out) const
     int queryIDCounter       = 1;
 
     out << "digraph {" << std::endl;
+    out << "  label=\"Render passes: " << counters.renderPasses
+        << ", merged: " << counters.mergedRenderPasses
+        << "\\nAttachments cleared: " << counters.attachmentsCleared
+        << ", loaded: " << counters.attachmentsLoaded << ", stored: " << counters.attachmentsStored
+        << "\";" << std::endl;
 
     for (const CommandGraphNode *node : mNodes)
     {
@@ -45,6 +45,24 @@ enum class CommandGraphNodeFunction
     WaitFenceSync,
 };
 
+// Render pass statistics gathered by the command graph optimization pass at submission time.
+// Counters are accumulated over the lifetime of the graph; callers can diff two snapshots to get
+// per-frame values.
+struct RenderPassCounters
+{
+    // Render passes actually begun in the primary command buffer.
+    uint64_t renderPasses = 0;
+    // Render pass nodes that continued the render pass of the previous node instead.
+    uint64_t mergedRenderPasses = 0;
+    // Attachment load and store operations of the executed render passes.  Depth and stencil
+    // aspects of the same attachment are counted separately.
+    uint64_t attachmentsCleared = 0;
+    uint64_t attachmentsLoaded  = 0;
+    uint64_t attachmentsStored  = 0;
+};
+
+RenderPassCounters &operator+=(RenderPassCounters &lhs, const RenderPassCounters &rhs);
+
 // Receives notifications when a command buffer is no longer able to record. Can be used with
 // inheritance. Faster than using an interface class since it has inlined methods. Could be used
 // with composition by adding a getCommandBuffer method.
@@ -76,6 +94,11 @@ class CommandGraphNode final : angle::NonCopyable
         return &mInsideRenderPassCommands;
     }
 
+    // Called whenever the render pass command buffer is handed out for recording.  Until then, the
+    // render pass attachments can still be cleared through their load ops.
+    void onRenderPassCommandsRequested() { mRenderPassCommandsRequested = true; }
+    bool hasRenderPassCommandsRequested() const { return mRenderPassCommandsRequested; }
+
     // For outside the render pass (copies, transitions, etc).
     angle::Result beginOutsideRenderPassRecording(Context *context,
                                                   const CommandPool &commandPool,
@@ -90,6 +113,17 @@ class CommandGraphNode final : angle::NonCopyable
                              const vk::RenderPassDesc &renderPassDesc,
                              const std::vector<VkClearValue> &clearValues);
 
+    // Folds a clear into the render pass by using a CLEAR load op for the given attachment.
+    // 'aspectFlags' selects the depth and/or stencil aspects for depth/stencil attachments.
+    void clearRenderPassAttachment(size_t attachmentIndex,
+                                   VkImageAspectFlags aspectFlags,
+                                   const VkClearValue &clearValue);
+
+    // Used when the attachments are already in the right layout and no layout transition is
+    // recorded.  Unless the render pass is merged with the previous one, a barrier against prior
+    // attachment writes is recorded before the render pass begins.
+    void setRenderPassAttachmentBarrier() { mRenderPassNeedsAttachmentBarrier = true; }
+
     // Dependency commands order node execution in the command graph.
     // Once a node has commands that must happen after it, recording is stopped and the node is
     // frozen forever.
@@ -113,10 +147,18 @@ class CommandGraphNode final : angle::NonCopyable
     // Commands for traversing the node on a flush operation.
     VisitedState visitedState() const;
     void visitParents(std::vector<CommandGraphNode *> *stack);
-    angle::Result visitAndExecute(Context *context,
-                                  Serial serial,
-                                  RenderPassCache *renderPassCache,
-                                  CommandBuffer *primaryCommandBuffer);
+    void setVisited() { mVisitedState = VisitedState::Visited; }
+    angle::Result execute(Context *context,
+                          Serial serial,
+                          RenderPassCache *renderPassCache,
+                          CommandBuffer *primaryCommandBuffer);
+
+    // Render pass optimization.  If 'previous' is executed right before this node and both
+    // render into the same framebuffer, this node's commands can be executed in the same render
+    // pass instance, which removes a store-then-load of all attachments.
+    bool canMergeRenderPassWith(const CommandGraphNode *previous) const;
+    void mergeRenderPassWith(CommandGraphNode *previous);
+    void accumulateRenderPassCounters(RenderPassCounters *counters) const;
 
     // Only used in the command graph diagnostics.
     const std::vector<CommandGraphNode *> &getParentsForDiagnostics() const;
@@ -160,9 +202,17 @@ class CommandGraphNode final : angle::NonCopyable
 
     // Only used if we need a RenderPass for these commands.
     RenderPassDesc mRenderPassDesc;
+    AttachmentOpsArray mRenderPassAttachmentOps;
     Framebuffer mRenderPassFramebuffer;
     gl::Rectangle mRenderPassRenderArea;
     gl::AttachmentArray<VkClearValue> mRenderPassClearValues;
+    bool mRenderPassCommandsRequested;
+    bool mRenderPassNeedsAttachmentBarrier;
+
+    // Set by the optimization pass.  The first node of a merged chain begins the render pass, and
+    // the last one ends it.
+    bool mRenderPassContinuesPrevious;
+    bool mRenderPassContinuesInNext;
 
     CommandGraphNodeFunction mFunction;
 
@@ -259,6 +309,7 @@ class CommandGraphResource : angle::NonCopyable
         updateQueueSerial(currentQueueSerial);
         if (hasStartedRenderPass())
         {
+            mCurrentWritingNode->onRenderPassCommandsRequested();
             *commandBufferOut = mCurrentWritingNode->getInsideRenderPassCommands();
             return true;
         }
@@ -271,6 +322,22 @@ class CommandGraphResource : angle::NonCopyable
     // Accessor for RenderPass RenderArea.
     const gl::Rectangle &getRenderPassRenderArea() const;
 
+    // Returns true if a RenderPass is started but nothing has been recorded in it yet.  Clears can
+    // then be folded into the RenderPass load ops with clearRenderPassAttachment.
+    bool hasStartedEmptyRenderPass() const
+    {
+        return hasStartedRenderPass() && !mCurrentWritingNode->hasRenderPassCommandsRequested();
+    }
+
+    // Clears an attachment of the started RenderPass using a CLEAR load op.  The RenderPass must
+    // not have any commands recorded in it.
+    void clearRenderPassAttachment(size_t attachmentIndex,
+                                   VkImageAspectFlags aspectFlags,
+                                   const VkClearValue &clearValue);
+
+    // Called when the started RenderPass was begun without transitioning its attachments.
+    void deferRenderPassAttachmentBarrier();
+
     // Called when 'this' object changes, but we'd like to start a new command buffer later.
     void finishCurrentCommands(RendererVk *renderer);
 
@@ -361,6 +428,9 @@ class CommandGraph final : angle::NonCopyable
     bool empty() const;
     void clear();
 
+    // Render pass statistics accumulated over all submissions.
+    const RenderPassCounters &getRenderPassCounters() const { return mRenderPassCounters; }
+
     // The following create special-function nodes that don't require a graph resource.
     // Queries:
     void beginQuery(const QueryPool *queryPool, uint32_t queryIndex);
@@ -377,10 +447,15 @@ class CommandGraph final : angle::NonCopyable
     CommandGraphNode *getLastBarrierNode(size_t *indexOut);
     void addDependenciesToNextBarrier(size_t begin, size_t end, CommandGraphNode *nextBarrier);
 
-    void dumpGraphDotFile(std::ostream &out) const;
+    // Orders the nodes for execution and merges adjacent compatible render passes.
+    void linearizeNodes(std::vector<CommandGraphNode *> *executionOrderOut);
+    RenderPassCounters optimizeRenderPasses(const std::vector<CommandGraphNode *> &executionOrder);
+
+    void dumpGraphDotFile(std::ostream &out, const RenderPassCounters &counters) const;
 
     std::vector<CommandGraphNode *> mNodes;
     bool mEnableGraphDiagnostics;
+    RenderPassCounters mRenderPassCounters;
 
     // A set of nodes (eventually) exist that act as barriers to guarantee submission order.  For
     // example, a glMemoryBarrier() calls would lead to such a barrier or beginning and ending a
@@ -15,6 +15,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/Surface.h"
+#include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/CommandGraph.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
@@ -81,6 +82,11 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
       mFlipYForCurrentSurface(false),
       mDriverUniformsBuffer(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, sizeof(DriverUniforms) * 16, true),
       mDriverUniformsDescriptorSet(VK_NULL_HANDLE),
+      mMultiDrawIndirectBuffer(VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+                               sizeof(VkDrawIndexedIndirectCommand) * 64,
+                               true),
+      mXfbBufferOffsets{},
+      mXfbVerticesPerDraw(0),
       mDefaultAttribBuffers{{INIT, INIT, INIT, INIT, INIT, INIT, INIT, INIT, INIT, INIT, INIT, INIT,
                              INIT, INIT, INIT, INIT}}
 {
@@ -117,9 +123,12 @@ ContextVk::~ContextVk() = default;
 void ContextVk::onDestroy(const gl::Context *context)
 {
     mDriverUniformsSetLayout.reset();
+    mDriverUniformsXfbSetLayout.reset();
     mIncompleteTextures.onDestroy(context);
     mDriverUniformsBuffer.destroy(getDevice());
     mDriverUniformsDescriptorPoolBinding.reset();
+    mEmptyXfbBuffer.destroy(getDevice());
+    mMultiDrawIndirectBuffer.destroy(getDevice());
 
     for (vk::DynamicDescriptorPool &descriptorPool : mDynamicDescriptorPools)
     {
@@ -154,11 +163,13 @@ angle::Result ContextVk::initialize()
                                            GetUniformBufferDescriptorCount()};
     VkDescriptorPoolSize textureSetSize = {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
                                            mRenderer->getMaxActiveTextures()};
-    VkDescriptorPoolSize driverSetSize  = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1};
+    VkDescriptorPoolSize driverSetSizes[] = {
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS}};
     ANGLE_TRY(mDynamicDescriptorPools[kUniformsDescriptorSetIndex].init(this, &uniformSetSize, 1));
     ANGLE_TRY(mDynamicDescriptorPools[kTextureDescriptorSetIndex].init(this, &textureSetSize, 1));
-    ANGLE_TRY(
-        mDynamicDescriptorPools[kDriverUniformsDescriptorSetIndex].init(this, &driverSetSize, 1));
+    ANGLE_TRY(mDynamicDescriptorPools[kDriverUniformsDescriptorSetIndex].init(
+        this, driverSetSizes, static_cast<uint32_t>(ArraySize(driverSetSizes))));
 
     ANGLE_TRY(mQueryPools[gl::QueryType::AnySamples].init(this, VK_QUERY_TYPE_OCCLUSION,
                                                           vk::kDefaultOcclusionQueryPoolSize));
@@ -172,6 +183,7 @@ angle::Result ContextVk::initialize()
     size_t minAlignment = static_cast<size_t>(
         mRenderer->getPhysicalDeviceProperties().limits.minUniformBufferOffsetAlignment);
     mDriverUniformsBuffer.init(minAlignment, mRenderer);
+    mMultiDrawIndirectBuffer.init(sizeof(uint32_t), mRenderer);
 
     mGraphicsPipelineDesc.reset(new vk::GraphicsPipelineDesc());
     mGraphicsPipelineDesc->initDefaults();
@@ -455,6 +467,14 @@ angle::Result ContextVk::drawArrays(const gl::Context *context,
                                     nullptr, &commandBuffer));
         vk::LineLoopHelper::Draw(clampedVertexCount, commandBuffer);
     }
+    else if (mState.isTransformFeedbackActiveUnpaused())
+    {
+        uint32_t vertexCount = setupTransformFeedbackDraw(mode, first, count);
+        ANGLE_TRY(setupDraw(context, mode, first, count, 1, gl::DrawElementsType::InvalidEnum,
+                            nullptr, mNonIndexedDirtyBitsMask, &commandBuffer));
+        onTransformFeedbackDraw();
+        commandBuffer->draw(vertexCount, 1, first, 0);
+    }
     else
     {
         ANGLE_TRY(setupDraw(context, mode, first, count, 1, gl::DrawElementsType::InvalidEnum,
@@ -479,9 +499,23 @@ angle::Result ContextVk::drawArraysInstanced(const gl::Context *context,
     }
 
     vk::CommandBuffer *commandBuffer = nullptr;
+    uint32_t vertexCount             = gl::GetClampedVertexCount<uint32_t>(count);
+    bool isTransformFeedbackDraw     = mState.isTransformFeedbackActiveUnpaused();
+
+    if (isTransformFeedbackDraw)
+    {
+        vertexCount = setupTransformFeedbackDraw(mode, first, count);
+    }
+
     ANGLE_TRY(setupDraw(context, mode, first, count, instances, gl::DrawElementsType::InvalidEnum,
                         nullptr, mNonIndexedDirtyBitsMask, &commandBuffer));
-    commandBuffer->draw(gl::GetClampedVertexCount<uint32_t>(count), instances, first, 0);
+
+    if (isTransformFeedbackDraw)
+    {
+        onTransformFeedbackDraw();
+    }
+
+    commandBuffer->draw(vertexCount, instances, first, 0);
     return angle::Result::Continue;
 }
 
@@ -560,6 +594,193 @@ angle::Result ContextVk::drawElementsIndirect(const gl::Context *context,
     return angle::Result::Stop;
 }
 
+angle::Result ContextVk::multiDrawArrays(const gl::Context *context,
+                                         gl::PrimitiveMode mode,
+                                         const GLint *firsts,
+                                         const GLsizei *counts,
+                                         GLsizei drawcount)
+{
+    if (!canUseIndirectMultiDraw(context, mode, drawcount))
+    {
+        return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
+    }
+
+    return multiDrawArraysIndirect(context, mode, firsts, counts, nullptr, drawcount);
+}
+
+angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
+                                                  gl::PrimitiveMode mode,
+                                                  const GLint *firsts,
+                                                  const GLsizei *counts,
+                                                  const GLsizei *instanceCounts,
+                                                  GLsizei drawcount)
+{
+    if (!canUseIndirectMultiDraw(context, mode, drawcount))
+    {
+        return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts,
+                                                   instanceCounts, drawcount);
+    }
+
+    return multiDrawArraysIndirect(context, mode, firsts, counts, instanceCounts, drawcount);
+}
+
+angle::Result ContextVk::multiDrawElements(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLsizei *counts,
+                                           gl::DrawElementsType type,
+                                           const GLvoid *const *indices,
+                                           GLsizei drawcount)
+{
+    if (!canUseIndirectMultiDrawElements(context, mode, type, indices, drawcount))
+    {
+        return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
+    }
+
+    return multiDrawElementsIndirect(context, mode, counts, type, indices, nullptr, drawcount);
+}
+
+angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
+                                                    gl::PrimitiveMode mode,
+                                                    const GLsizei *counts,
+                                                    gl::DrawElementsType type,
+                                                    const GLvoid *const *indices,
+                                                    const GLsizei *instanceCounts,
+                                                    GLsizei drawcount)
+{
+    if (!canUseIndirectMultiDrawElements(context, mode, type, indices, drawcount))
+    {
+        return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
+                                                     instanceCounts, drawcount);
+    }
+
+    return multiDrawElementsIndirect(context, mode, counts, type, indices, instanceCounts,
+                                     drawcount);
+}
+
+bool ContextVk::canUseIndirectMultiDraw(const gl::Context *context,
+                                        gl::PrimitiveMode mode,
+                                        GLsizei drawcount) const
+{
+    if (!mRenderer->getPhysicalDeviceFeatures().multiDrawIndirect ||
+        static_cast<uint32_t>(drawcount) >
+            mRenderer->getPhysicalDeviceProperties().limits.maxDrawIndirectCount)
+    {
+        return false;
+    }
+
+    // Line loops are drawn from a generated index buffer, client side data is streamed for the
+    // range of each sub-draw, and gl_DrawID and transform feedback need per-draw driver state.
+    return mode != gl::PrimitiveMode::LineLoop &&
+           !context->getStateCache().hasAnyActiveClientAttrib() &&
+           !mState.getProgram()->hasDrawIDUniform() && !mState.isTransformFeedbackActiveUnpaused();
+}
+
+bool ContextVk::canUseIndirectMultiDrawElements(const gl::Context *context,
+                                                gl::PrimitiveMode mode,
+                                                gl::DrawElementsType type,
+                                                const GLvoid *const *indices,
+                                                GLsizei drawcount) const
+{
+    // Unsigned byte indices are converted per draw, and client side indices are streamed.
+    if (!canUseIndirectMultiDraw(context, mode, drawcount) ||
+        type == gl::DrawElementsType::UnsignedByte ||
+        mVertexArray->getState().getElementArrayBuffer() == nullptr)
+    {
+        return false;
+    }
+
+    // The index buffer is bound once, so the offsets of all sub-draws must be expressible in
+    // whole indices.
+    const uintptr_t typeBytes = gl::GetDrawElementsTypeSize(type);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (reinterpret_cast<uintptr_t>(indices[drawID]) % typeBytes != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+angle::Result ContextVk::multiDrawArraysIndirect(const gl::Context *context,
+                                                 gl::PrimitiveMode mode,
+                                                 const GLint *firsts,
+                                                 const GLsizei *counts,
+                                                 const GLsizei *instanceCountsOrNull,
+                                                 GLsizei drawcount)
+{
+    mMultiDrawIndirectBuffer.releaseRetainedBuffers(mRenderer);
+
+    uint8_t *ptr        = nullptr;
+    VkBuffer buffer     = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    ANGLE_TRY(mMultiDrawIndirectBuffer.allocate(this, sizeof(VkDrawIndirectCommand) * drawcount,
+                                                &ptr, &buffer, &offset, nullptr));
+
+    // Sub-draws that don't produce any primitives are harmless, so they are not filtered out.
+    VkDrawIndirectCommand *commands = reinterpret_cast<VkDrawIndirectCommand *>(ptr);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        VkDrawIndirectCommand &command = commands[drawID];
+        command.vertexCount            = static_cast<uint32_t>(counts[drawID]);
+        command.instanceCount =
+            instanceCountsOrNull ? static_cast<uint32_t>(instanceCountsOrNull[drawID]) : 1;
+        command.firstVertex   = static_cast<uint32_t>(firsts[drawID]);
+        command.firstInstance = 0;
+    }
+
+    ANGLE_TRY(mMultiDrawIndirectBuffer.flush(this));
+
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(setupDraw(context, mode, 0, 0, 1, gl::DrawElementsType::InvalidEnum, nullptr,
+                        mNonIndexedDirtyBitsMask, &commandBuffer));
+    commandBuffer->drawIndirect(buffer, offset, static_cast<uint32_t>(drawcount),
+                                sizeof(VkDrawIndirectCommand));
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::multiDrawElementsIndirect(const gl::Context *context,
+                                                   gl::PrimitiveMode mode,
+                                                   const GLsizei *counts,
+                                                   gl::DrawElementsType type,
+                                                   const GLvoid *const *indices,
+                                                   const GLsizei *instanceCountsOrNull,
+                                                   GLsizei drawcount)
+{
+    mMultiDrawIndirectBuffer.releaseRetainedBuffers(mRenderer);
+
+    uint8_t *ptr        = nullptr;
+    VkBuffer buffer     = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    ANGLE_TRY(mMultiDrawIndirectBuffer.allocate(
+        this, sizeof(VkDrawIndexedIndirectCommand) * drawcount, &ptr, &buffer, &offset, nullptr));
+
+    const uintptr_t typeBytes = gl::GetDrawElementsTypeSize(type);
+
+    VkDrawIndexedIndirectCommand *commands = reinterpret_cast<VkDrawIndexedIndirectCommand *>(ptr);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        VkDrawIndexedIndirectCommand &command = commands[drawID];
+        command.indexCount                    = static_cast<uint32_t>(counts[drawID]);
+        command.instanceCount =
+            instanceCountsOrNull ? static_cast<uint32_t>(instanceCountsOrNull[drawID]) : 1;
+        command.firstIndex =
+            static_cast<uint32_t>(reinterpret_cast<uintptr_t>(indices[drawID]) / typeBytes);
+        command.vertexOffset  = 0;
+        command.firstInstance = 0;
+    }
+
+    ANGLE_TRY(mMultiDrawIndirectBuffer.flush(this));
+
+    // Bind the element array buffer at offset zero; the sub-draw offsets are in firstIndex.
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(setupIndexedDraw(context, mode, 0, 1, type, nullptr, &commandBuffer));
+    commandBuffer->drawIndexedIndirect(buffer, offset, static_cast<uint32_t>(drawcount),
+                                       sizeof(VkDrawIndexedIndirectCommand));
+    return angle::Result::Continue;
+}
+
 GLenum ContextVk::getResetStatus()
 {
     if (mRenderer->isDeviceLost())
@@ -784,6 +1005,8 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                                                            glState.getRasterizerState());
                 break;
             case gl::State::DIRTY_BIT_RASTERIZER_DISCARD_ENABLED:
+                mGraphicsPipelineDesc->updateRasterizerDiscardEnabled(
+                    &mGraphicsPipelineTransition, glState.isRasterizerDiscardEnabled());
                 break;
             case gl::State::DIRTY_BIT_LINE_WIDTH:
                 mGraphicsPipelineDesc->updateLineWidth(&mGraphicsPipelineTransition,
@@ -886,6 +1109,8 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 mIndexedDirtyBitsMask.set(DIRTY_BIT_VERTEX_BUFFERS, useVertexBuffer);
                 mCurrentPipeline = nullptr;
                 mGraphicsPipelineTransition.reset();
+                // The transform feedback buffers are bound based on the program's varyings.
+                invalidateDriverUniforms();
                 break;
             }
             case gl::State::DIRTY_BIT_TEXTURE_BINDINGS:
@@ -895,6 +1120,7 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 invalidateCurrentTextures();
                 break;
             case gl::State::DIRTY_BIT_TRANSFORM_FEEDBACK_BINDING:
+                onTransformFeedbackStateChanged();
                 break;
             case gl::State::DIRTY_BIT_SHADER_STORAGE_BUFFER_BINDING:
                 break;
@@ -1086,6 +1312,30 @@ void ContextVk::invalidateDriverUniforms()
     mDirtyBits.set(DIRTY_BIT_DESCRIPTOR_SETS);
 }
 
+uint32_t ContextVk::setupTransformFeedbackDraw(gl::PrimitiveMode mode, GLint first, GLsizei count)
+{
+    // Only complete primitives are captured, so incomplete ones are not drawn at all.
+    GLsizeiptr vertexCount = gl::GetVerticesNeededForDraw(mode, count, 1).ValueOrDie();
+
+    TransformFeedbackVk *transformFeedbackVk =
+        vk::GetImpl(mState.getCurrentTransformFeedback());
+    transformFeedbackVk->getBufferOffsets(mProgram->getState(), first, mXfbBufferOffsets.data(),
+                                          mXfbBufferOffsets.size());
+    mXfbVerticesPerDraw = static_cast<int32_t>(vertexCount);
+
+    // The capture location changes with every draw call.
+    invalidateDriverUniforms();
+
+    return static_cast<uint32_t>(vertexCount);
+}
+
+void ContextVk::onTransformFeedbackDraw()
+{
+    TransformFeedbackVk *transformFeedbackVk =
+        vk::GetImpl(mState.getCurrentTransformFeedback());
+    transformFeedbackVk->addFramebufferDependency(mProgram->getState(), mDrawFramebuffer);
+}
+
 void ContextVk::onFramebufferChange(const vk::RenderPassDesc &renderPassDesc)
 {
     // Ensure that the RenderPass description is updated.
@@ -1171,6 +1421,8 @@ angle::Result ContextVk::handleDirtyDriverUniforms(const gl::Context *context,
     float depthRangeFar  = mState.getFarPlane();
     float depthRangeDiff = depthRangeFar - depthRangeNear;
 
+    bool xfbActiveUnpaused = mState.isTransformFeedbackActiveUnpaused();
+
     // Copy and flush to the device.
     DriverUniforms *driverUniforms = reinterpret_cast<DriverUniforms *>(ptr);
     *driverUniforms                = {
@@ -1180,22 +1432,30 @@ angle::Result ContextVk::handleDirtyDriverUniforms(const gl::Context *context,
         scaleY,
         -scaleY,
         0.0f,
-        {depthRangeNear, depthRangeFar, depthRangeDiff, 0.0f}};
+        {depthRangeNear, depthRangeFar, depthRangeDiff, 0.0f},
+        mXfbBufferOffsets,
+        xfbActiveUnpaused ? 1 : 0,
+        mXfbVerticesPerDraw};
 
     ANGLE_TRY(mDriverUniformsBuffer.flush(this));
 
-    // Get the descriptor set layout.
-    if (!mDriverUniformsSetLayout.valid())
+    // Get the descriptor set layout.  It must match the program's, which only has the transform
+    // feedback buffers if the program captures varyings.  Changing the program invalidates the
+    // driver uniforms, so the set is reallocated with the right layout.
+    bool hasXfbBuffers = mProgram->hasXfbBuffers();
+    vk::BindingPointer<vk::DescriptorSetLayout> &setLayout =
+        hasXfbBuffers ? mDriverUniformsXfbSetLayout : mDriverUniformsSetLayout;
+    if (!setLayout.valid())
     {
         vk::DescriptorSetLayoutDesc desc;
-        desc.update(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1);
+        InitDriverUniformsSetLayoutDesc(hasXfbBuffers, &desc);
 
-        ANGLE_TRY(mRenderer->getDescriptorSetLayout(this, desc, &mDriverUniformsSetLayout));
+        ANGLE_TRY(mRenderer->getDescriptorSetLayout(this, desc, &setLayout));
     }
 
     // Allocate a new descriptor set.
     ANGLE_TRY(mDynamicDescriptorPools[kDriverUniformsDescriptorSetIndex].allocateSets(
-        this, mDriverUniformsSetLayout.get().ptr(), 1, &mDriverUniformsDescriptorPoolBinding,
+        this, setLayout.get().ptr(), 1, &mDriverUniformsDescriptorPoolBinding,
         &mDriverUniformsDescriptorSet));
 
     // Update the driver uniform descriptor set.
@@ -1204,22 +1464,102 @@ angle::Result ContextVk::handleDirtyDriverUniforms(const gl::Context *context,
     bufferInfo.offset                 = offset;
     bufferInfo.range                  = sizeof(DriverUniforms);
 
-    VkWriteDescriptorSet writeInfo = {};
-    writeInfo.sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    writeInfo.dstSet               = mDriverUniformsDescriptorSet;
-    writeInfo.dstBinding           = 0;
-    writeInfo.dstArrayElement      = 0;
-    writeInfo.descriptorCount      = 1;
-    writeInfo.descriptorType       = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    writeInfo.pImageInfo           = nullptr;
-    writeInfo.pTexelBufferView     = nullptr;
-    writeInfo.pBufferInfo          = &bufferInfo;
+    std::array<VkWriteDescriptorSet, 2> writeInfos = {};
+    uint32_t writeCount                            = 1;
+
+    VkWriteDescriptorSet &writeInfo = writeInfos[0];
+    writeInfo.sType                 = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeInfo.dstSet                = mDriverUniformsDescriptorSet;
+    writeInfo.dstBinding            = kDriverUniformsBindingIndex;
+    writeInfo.dstArrayElement       = 0;
+    writeInfo.descriptorCount       = 1;
+    writeInfo.descriptorType        = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    writeInfo.pImageInfo            = nullptr;
+    writeInfo.pTexelBufferView      = nullptr;
+    writeInfo.pBufferInfo           = &bufferInfo;
+
+    // Programs that capture varyings statically use the transform feedback buffers, so they
+    // need to be bound even when transform feedback is not active.
+    std::array<VkDescriptorBufferInfo, gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS>
+        xfbBufferInfos = {};
+    const gl::ProgramState &programState = mProgram->getState();
+    size_t xfbBufferCount                = 0;
+
+    if (hasXfbBuffers)
+    {
+        TransformFeedbackVk *transformFeedbackVk =
+            vk::GetImpl(mState.getCurrentTransformFeedback());
+        xfbBufferCount = transformFeedbackVk->getBufferCount(programState);
+
+        if (xfbActiveUnpaused)
+        {
+            transformFeedbackVk->getDescriptorBufferInfos(programState, xfbBufferInfos.data(),
+                                                          xfbBufferInfos.size());
+        }
+        else
+        {
+            ANGLE_TRY(initEmptyXfbBuffer());
+            for (size_t bufferIndex = 0; bufferIndex < xfbBufferCount; ++bufferIndex)
+            {
+                xfbBufferInfos[bufferIndex].buffer = mEmptyXfbBuffer.getBuffer().getHandle();
+                xfbBufferInfos[bufferIndex].offset = 0;
+                xfbBufferInfos[bufferIndex].range  = VK_WHOLE_SIZE;
+            }
+        }
+    }
+
+    if (xfbBufferCount > 0)
+    {
+        VkWriteDescriptorSet &xfbWriteInfo = writeInfos[writeCount++];
+        xfbWriteInfo                       = writeInfo;
+        xfbWriteInfo.dstBinding            = kXfbBindingIndexStart;
+        xfbWriteInfo.descriptorCount       = static_cast<uint32_t>(xfbBufferCount);
+        xfbWriteInfo.descriptorType        = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        xfbWriteInfo.pBufferInfo           = xfbBufferInfos.data();
+    }
 
-    vkUpdateDescriptorSets(getDevice(), 1, &writeInfo, 0, nullptr);
+    vkUpdateDescriptorSets(getDevice(), writeCount, writeInfos.data(), 0, nullptr);
 
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::initEmptyXfbBuffer()
+{
+    if (mEmptyXfbBuffer.valid())
+    {
+        return angle::Result::Continue;
+    }
+
+    // The shader never writes to this buffer, as capture is disabled through the driver uniforms.
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = 16;
+    createInfo.usage                 = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    return mEmptyXfbBuffer.init(this, createInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+}
+
+// static
+void ContextVk::InitDriverUniformsSetLayoutDesc(bool hasXfbBuffers,
+                                                vk::DescriptorSetLayoutDesc *descOut)
+{
+    descOut->update(kDriverUniformsBindingIndex, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1);
+    if (!hasXfbBuffers)
+    {
+        return;
+    }
+
+    for (uint32_t bufferIndex = 0; bufferIndex < gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS;
+         ++bufferIndex)
+    {
+        descOut->update(kXfbBindingIndexStart + bufferIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1);
+    }
+}
+
 void ContextVk::handleError(VkResult errorCode,
                             const char *file,
                             const char *function,
@@ -77,6 +77,32 @@ class ContextVk : public ContextImpl, public vk::Context, public vk::CommandBuff
                                        gl::DrawElementsType type,
                                        const void *indirect) override;
 
+    // ANGLE_multi_draw
+    angle::Result multiDrawArrays(const gl::Context *context,
+                                  gl::PrimitiveMode mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  GLsizei drawcount) override;
+    angle::Result multiDrawArraysInstanced(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLint *firsts,
+                                           const GLsizei *counts,
+                                           const GLsizei *instanceCounts,
+                                           GLsizei drawcount) override;
+    angle::Result multiDrawElements(const gl::Context *context,
+                                    gl::PrimitiveMode mode,
+                                    const GLsizei *counts,
+                                    gl::DrawElementsType type,
+                                    const GLvoid *const *indices,
+                                    GLsizei drawcount) override;
+    angle::Result multiDrawElementsInstanced(const gl::Context *context,
+                                             gl::PrimitiveMode mode,
+                                             const GLsizei *counts,
+                                             gl::DrawElementsType type,
+                                             const GLvoid *const *indices,
+                                             const GLsizei *instanceCounts,
+                                             GLsizei drawcount) override;
+
     // Device loss
     GLenum getResetStatus() override;
 
@@ -187,6 +213,12 @@ class ContextVk : public ContextImpl, public vk::Context, public vk::CommandBuff
     void invalidateDefaultAttribute(size_t attribIndex);
     void invalidateDefaultAttributes(const gl::AttributesMask &dirtyMask);
     void onFramebufferChange(const vk::RenderPassDesc &renderPassDesc);
+    void onTransformFeedbackStateChanged() { invalidateDriverUniforms(); }
+
+    // The driver uniforms descriptor set layout.  Programs that capture transform feedback
+    // varyings also have the storage buffers they are written to in this set.
+    static void InitDriverUniformsSetLayoutDesc(bool hasXfbBuffers,
+                                                vk::DescriptorSetLayoutDesc *descOut);
 
     vk::DynamicDescriptorPool *getDynamicDescriptorPool(uint32_t descriptorSetIndex);
     vk::DynamicQueryPool *getQueryPool(gl::QueryType queryType);
@@ -251,6 +283,31 @@ class ContextVk : public ContextImpl, public vk::Context, public vk::CommandBuff
                                     gl::DrawElementsType indexTypeOrInvalid,
                                     const void *indices,
                                     vk::CommandBuffer **commandBufferOut);
+    uint32_t setupTransformFeedbackDraw(gl::PrimitiveMode mode, GLint first, GLsizei count);
+
+    // ANGLE_multi_draw calls are issued as a single indirect draw when possible.
+    bool canUseIndirectMultiDraw(const gl::Context *context,
+                                 gl::PrimitiveMode mode,
+                                 GLsizei drawcount) const;
+    bool canUseIndirectMultiDrawElements(const gl::Context *context,
+                                         gl::PrimitiveMode mode,
+                                         gl::DrawElementsType type,
+                                         const GLvoid *const *indices,
+                                         GLsizei drawcount) const;
+    angle::Result multiDrawArraysIndirect(const gl::Context *context,
+                                          gl::PrimitiveMode mode,
+                                          const GLint *firsts,
+                                          const GLsizei *counts,
+                                          const GLsizei *instanceCountsOrNull,
+                                          GLsizei drawcount);
+    angle::Result multiDrawElementsIndirect(const gl::Context *context,
+                                            gl::PrimitiveMode mode,
+                                            const GLsizei *counts,
+                                            gl::DrawElementsType type,
+                                            const GLvoid *const *indices,
+                                            const GLsizei *instanceCountsOrNull,
+                                            GLsizei drawcount);
+    void onTransformFeedbackDraw();
 
     void updateViewport(FramebufferVk *framebufferVk,
                         const gl::Rectangle &viewport,
@@ -280,6 +337,7 @@ class ContextVk : public ContextImpl, public vk::Context, public vk::CommandBuff
                                          vk::CommandBuffer *commandBuffer);
     angle::Result handleDirtyDriverUniforms(const gl::Context *context,
                                             vk::CommandBuffer *commandBuffer);
+    angle::Result initEmptyXfbBuffer();
     angle::Result handleDirtyDescriptorSets(const gl::Context *context,
                                             vk::CommandBuffer *commandBuffer);
 
@@ -339,13 +397,32 @@ class ContextVk : public ContextImpl, public vk::Context, public vk::CommandBuff
 
         // We'll use x, y, z for near / far / diff respectively.
         std::array<float, 4> depthRange;
+
+        // Used to emulate transform feedback.  The vertex at gl_VertexIndex and gl_InstanceIndex
+        // is captured at xfbBufferOffsets + (gl_VertexIndex + gl_InstanceIndex *
+        // xfbVerticesPerDraw) * stride, in units of 32-bit words.
+        std::array<int32_t, gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS> xfbBufferOffsets;
+        int32_t xfbActiveUnpaused;
+        int32_t xfbVerticesPerDraw;
     };
 
     vk::DynamicBuffer mDriverUniformsBuffer;
     VkDescriptorSet mDriverUniformsDescriptorSet;
     vk::BindingPointer<vk::DescriptorSetLayout> mDriverUniformsSetLayout;
+    vk::BindingPointer<vk::DescriptorSetLayout> mDriverUniformsXfbSetLayout;
     vk::SharedDescriptorPoolBinding mDriverUniformsDescriptorPoolBinding;
 
+    // Holds the VkDraw[Indexed]IndirectCommands of multi-draw calls.
+    vk::DynamicBuffer mMultiDrawIndirectBuffer;
+
+    // Transform feedback state of the current draw call, copied to the driver uniforms.
+    std::array<int32_t, gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS> mXfbBufferOffsets;
+    int32_t mXfbVerticesPerDraw;
+
+    // Bound in place of the transform feedback buffers when the current program captures
+    // varyings but transform feedback is not active.
+    vk::BufferHelper mEmptyXfbBuffer;
+
     // This cache should also probably include the texture index (shader location) and array
     // index (also in the shader). This info is used in the descriptor update step.
     gl::ActiveTextureArray<TextureVk *> mActiveTextures;
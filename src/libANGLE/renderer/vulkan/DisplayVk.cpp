@@ -19,6 +19,10 @@
 #include "libANGLE/renderer/vulkan/SyncVk.h"
 #include "third_party/trace_event/trace_event.h"
 
+#if defined(ANGLE_PLATFORM_LINUX)
+#    include "libANGLE/renderer/vulkan/linux/DmaBufImageSiblingVkLinux.h"
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
 namespace rx
 {
 
@@ -139,6 +143,40 @@ ImageImpl *DisplayVk::createImage(const egl::ImageState &state,
     return new ImageVk(state, context);
 }
 
+egl::Error DisplayVk::validateImageClientBuffer(const gl::Context *context,
+                                                EGLenum target,
+                                                EGLClientBuffer clientBuffer,
+                                                const egl::AttributeMap &attribs) const
+{
+    switch (target)
+    {
+#if defined(ANGLE_PLATFORM_LINUX)
+        case EGL_LINUX_DMA_BUF_EXT:
+            return DmaBufImageSiblingVkLinux::ValidateBuffer(mRenderer, attribs);
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
+        default:
+            return DisplayImpl::validateImageClientBuffer(context, target, clientBuffer, attribs);
+    }
+}
+
+ExternalImageSiblingImpl *DisplayVk::createExternalImageSibling(const gl::Context *context,
+                                                                EGLenum target,
+                                                                EGLClientBuffer buffer,
+                                                                const egl::AttributeMap &attribs)
+{
+    switch (target)
+    {
+#if defined(ANGLE_PLATFORM_LINUX)
+        case EGL_LINUX_DMA_BUF_EXT:
+            return new DmaBufImageSiblingVkLinux(attribs);
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
+        default:
+            return DisplayImpl::createExternalImageSibling(context, target, buffer, attribs);
+    }
+}
+
 rx::ContextImpl *DisplayVk::createContext(const gl::State &state,
                                           gl::ErrorSet *errorSet,
                                           const egl::Config *configuration,
@@ -191,6 +229,12 @@ void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
     outExtensions->glTextureCubemapImage = true;
     outExtensions->glTexture3DImage      = false;
     outExtensions->glRenderbufferImage   = true;
+
+    // Single-plane linear dma-bufs are imported as Vulkan image memory.  The feature is only
+    // enabled on Linux, where every display creates the corresponding external image siblings.
+    // Multi-planar YUV formats such as NV12 are rejected with EGL_BAD_MATCH, which the extension
+    // allows for formats the implementation doesn't support.
+    outExtensions->imageDmaBufImportEXT = getRenderer()->getFeatures().supportsExternalMemoryDmaBuf;
 }
 
 void DisplayVk::generateCaps(egl::Caps *outCaps) const
@@ -59,6 +59,16 @@ class DisplayVk : public DisplayImpl, public vk::Context
                            EGLenum target,
                            const egl::AttributeMap &attribs) override;
 
+    egl::Error validateImageClientBuffer(const gl::Context *context,
+                                         EGLenum target,
+                                         EGLClientBuffer clientBuffer,
+                                         const egl::AttributeMap &attribs) const override;
+
+    ExternalImageSiblingImpl *createExternalImageSibling(const gl::Context *context,
+                                                         EGLenum target,
+                                                         EGLClientBuffer buffer,
+                                                         const egl::AttributeMap &attribs) override;
+
     ContextImpl *createContext(const gl::State &state,
                                gl::ErrorSet *errorSet,
                                const egl::Config *configuration,
@@ -165,9 +165,6 @@ angle::Result FramebufferVk::clear(const gl::Context *context, GLbitfield mask)
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
-    // This command buffer is only started once.
-    vk::CommandBuffer *commandBuffer = nullptr;
-
     const gl::FramebufferAttachment *depthAttachment = mState.getDepthAttachment();
     bool clearDepth = (depthAttachment && (mask & GL_DEPTH_BUFFER_BIT) != 0);
     ASSERT(!clearDepth || depthAttachment->isAttached());
@@ -243,64 +240,55 @@ angle::Result FramebufferVk::clear(const gl::Context *context, GLbitfield mask)
         return angle::Result::Continue;
     }
 
-    // Standard Depth/stencil clear without scissor.
-    if (clearDepth || clearStencil)
+    // Without scissor, the clear is folded into the load ops of the RenderPass.  If draws follow,
+    // they are recorded in the same RenderPass, which avoids loading the attachments only to
+    // overwrite them.
+    if (!mFramebuffer.hasStartedEmptyRenderPass())
     {
-        ANGLE_TRY(mFramebuffer.recordCommands(contextVk, &commandBuffer));
-
-        RenderTargetVk *renderTarget         = mRenderTargetCache.getDepthStencil();
-        const angle::Format &format          = renderTarget->getImageFormat().textureFormat();
-        const VkImageAspectFlags aspectFlags = vk::GetDepthStencilAspectFlags(format);
-
-        VkImageAspectFlags clearAspects = aspectFlags;
-        if (!clearDepth)
-        {
-            clearAspects &= ~VK_IMAGE_ASPECT_DEPTH_BIT;
-        }
-        if (!clearStencil)
-        {
-            clearAspects &= ~VK_IMAGE_ASPECT_STENCIL_BIT;
-        }
-
-        vk::ImageHelper *image = renderTarget->getImageForWrite(&mFramebuffer);
-        image->clearDepthStencil(aspectFlags, clearAspects, clearDepthStencilValue, commandBuffer);
+        ANGLE_TRY(startNewRenderPass(contextVk, nullptr));
     }
 
-    if (!clearColor)
+    // TODO(jmadill): Support gaps in RenderTargets. http://anglebug.com/2394
+    size_t attachmentIndex = 0;
+    if (clearColor)
     {
-        return angle::Result::Continue;
-    }
+        const VkClearValue &clearColorValue = contextVk->getClearColorValue();
+        for (size_t colorIndex : mState.getEnabledDrawBuffers())
+        {
+            VkClearValue modifiedClearColorValue = clearColorValue;
 
-    const auto *attachment = mState.getFirstNonNullAttachment();
-    ASSERT(attachment && attachment->isAttached());
+            // It's possible we're clearing a render target that has no alpha channel but we
+            // represent it with a texture that has one. We must not affect its alpha channel no
+            // matter what the clear value is in that case.
+            if (mEmulatedAlphaAttachmentMask[colorIndex])
+            {
+                modifiedClearColorValue.color.float32[3] = 1.0;
+            }
 
-    if (!commandBuffer)
+            mFramebuffer.clearRenderPassAttachment(attachmentIndex++, VK_IMAGE_ASPECT_COLOR_BIT,
+                                                   modifiedClearColorValue);
+        }
+    }
+    else
     {
-        ANGLE_TRY(mFramebuffer.recordCommands(contextVk, &commandBuffer));
+        attachmentIndex = mState.getEnabledDrawBuffers().count();
     }
 
-    // TODO(jmadill): Support gaps in RenderTargets. http://anglebug.com/2394
-    const auto &colorRenderTargets           = mRenderTargetCache.getColors();
-    const VkClearColorValue &clearColorValue = contextVk->getClearColorValue().color;
-    for (size_t colorIndex : mState.getEnabledDrawBuffers())
+    if (clearDepth || clearStencil)
     {
-        VkClearColorValue modifiedClearColorValue = clearColorValue;
-        RenderTargetVk *colorRenderTarget         = colorRenderTargets[colorIndex];
-
-        // It's possible we're clearing a render target that has no alpha channel but we represent
-        // it with a texture that has one. We must not affect its alpha channel no matter what the
-        // clear value is in that case.
-        if (mEmulatedAlphaAttachmentMask[colorIndex])
+        VkImageAspectFlags clearAspects = 0;
+        if (clearDepth)
         {
-            modifiedClearColorValue.float32[3] = 1.0;
+            clearAspects |= VK_IMAGE_ASPECT_DEPTH_BIT;
+        }
+        if (clearStencil)
+        {
+            clearAspects |= VK_IMAGE_ASPECT_STENCIL_BIT;
         }
 
-        ASSERT(colorRenderTarget);
-        vk::ImageHelper *image = colorRenderTarget->getImageForWrite(&mFramebuffer);
-
-        // If we're clearing a cube map face ensure we only clear the selected layer.
-        image->clearColorLayer(modifiedClearColorValue, colorRenderTarget->getLevelIndex(), 1,
-                               colorRenderTarget->getLayerIndex(), 1, commandBuffer);
+        VkClearValue clearValue = {};
+        clearValue.depthStencil = clearDepthStencilValue;
+        mFramebuffer.clearRenderPassAttachment(attachmentIndex, clearAspects, clearValue);
     }
 
     return angle::Result::Continue;
@@ -1045,14 +1033,34 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
     // TODO(jmadill): Proper clear value implementation. http://anglebug.com/2361
     std::vector<VkClearValue> attachmentClearValues;
 
+    const auto &colorRenderTargets           = mRenderTargetCache.getColors();
+    RenderTargetVk *depthStencilRenderTarget = mRenderTargetCache.getDepthStencil();
+
+    // If every attachment is already in its attachment layout, no layout transition needs to be
+    // recorded.  The RenderPass then has no outside commands and can be merged with the previous
+    // RenderPass on this framebuffer when the command graph is flushed.
+    bool attachmentsInLayout =
+        !depthStencilRenderTarget || depthStencilRenderTarget->isInAttachmentLayout();
+    for (size_t colorIndex : mState.getEnabledDrawBuffers())
+    {
+        attachmentsInLayout =
+            attachmentsInLayout && colorRenderTargets[colorIndex]->isInAttachmentLayout();
+    }
+
     vk::CommandBuffer *writeCommands = nullptr;
-    ANGLE_TRY(mFramebuffer.recordCommands(contextVk, &writeCommands));
+    if (attachmentsInLayout)
+    {
+        mFramebuffer.finishCurrentCommands(contextVk->getRenderer());
+    }
+    else
+    {
+        ANGLE_TRY(mFramebuffer.recordCommands(contextVk, &writeCommands));
+    }
 
     vk::RenderPassDesc renderPassDesc;
 
     // Initialize RenderPass info.
     // TODO(jmadill): Support gaps in RenderTargets. http://anglebug.com/2394
-    const auto &colorRenderTargets = mRenderTargetCache.getColors();
     for (size_t colorIndex : mState.getEnabledDrawBuffers())
     {
         RenderTargetVk *colorRenderTarget = colorRenderTargets[colorIndex];
@@ -1062,7 +1070,6 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
         attachmentClearValues.emplace_back(contextVk->getClearColorValue());
     }
 
-    RenderTargetVk *depthStencilRenderTarget = mRenderTargetCache.getDepthStencil();
     if (depthStencilRenderTarget)
     {
         depthStencilRenderTarget->onDepthStencilDraw(&mFramebuffer, writeCommands, &renderPassDesc);
@@ -1072,8 +1079,15 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
     gl::Rectangle renderArea =
         gl::Rectangle(0, 0, mState.getDimensions().width, mState.getDimensions().height);
 
-    return mFramebuffer.beginRenderPass(contextVk, *framebuffer, renderArea, mRenderPassDesc,
-                                        attachmentClearValues, commandBufferOut);
+    ANGLE_TRY(mFramebuffer.beginRenderPass(contextVk, *framebuffer, renderArea, mRenderPassDesc,
+                                           attachmentClearValues, commandBufferOut));
+
+    if (attachmentsInLayout)
+    {
+        mFramebuffer.deferRenderPassAttachmentBarrier();
+    }
+
+    return angle::Result::Continue;
 }
 
 void FramebufferVk::updateActiveColorMasks(size_t colorIndex, bool r, bool g, bool b, bool a)
@@ -1150,6 +1164,22 @@ angle::Result FramebufferVk::readPixelsImpl(ContextVk *contextVk,
     // created with the host coherent bit.
     ANGLE_TRY(mReadPixelBuffer.invalidate(contextVk));
 
+    // Formats without alpha that are emulated with an 8-bit alpha channel normally hold one in it,
+    // because draws and clears mask it.  Images imported from outside, such as XRGB dma-bufs,
+    // hold undefined data there instead, so force it to one before packing.
+    const angle::Format &angleFormat = srcImage->getFormat().angleFormat();
+    if (copyAspectFlags == VK_IMAGE_ASPECT_COLOR_BIT && angleFormat.alphaBits == 0 &&
+        readFormat->alphaBits == 8 && readFormat->pixelBytes == 4 &&
+        readFormat->componentType == GL_UNSIGNED_NORMALIZED)
+    {
+        // Both RGBA8 and BGRA8 store alpha in the last byte.
+        for (size_t pixelIndex = 0; pixelIndex < static_cast<size_t>(area.width * area.height);
+             ++pixelIndex)
+        {
+            readPixelBuffer[pixelIndex * 4 + 3] = 0xFF;
+        }
+    }
+
     PackPixels(packPixelsParams, *readFormat, area.width * readFormat->pixelBytes, readPixelBuffer,
                static_cast<uint8_t *>(pixels));
 
@@ -21,8 +21,11 @@ ANGLE_DISABLE_EXTRA_SEMI_WARNING
 ANGLE_REENABLE_EXTRA_SEMI_WARNING
 
 #include <array>
+#include <cstring>
+#include <map>
 
 #include "common/FixedVector.h"
+#include "common/spirv_constants.h"
 #include "common/string_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Caps.h"
@@ -36,11 +39,52 @@ constexpr char kQualifierMarkerBegin[] = "@@ QUALIFIER-";
 constexpr char kLayoutMarkerBegin[]    = "@@ LAYOUT-";
 constexpr char kMarkerEnd[]            = " @@";
 constexpr char kUniformQualifier[]     = "uniform";
+constexpr char kXfbOutMarker[]         = "@@ XFB-OUT @@";
 constexpr char kVersionDefine[]        = "#version 450 core\n";
+constexpr char kCaptureXfbDefine[]     = R"(#version 450 core
+
+#define ANGLE_CAPTURE_XFB
+)";
 constexpr char kLineRasterDefine[]     = R"(#version 450 core
 
 #define ANGLE_ENABLE_LINE_SEGMENT_RASTERIZATION
 )";
+constexpr char kDriverBlockName[]      = "ANGLEUniforms";
+constexpr char kPositionVaryingName[]  = "ANGLEPosition";
+constexpr char kDefaultUniformsName[]  = "defaultUniforms";
+
+// Start the unused sampler bindings at something ridiculously high.
+constexpr int kBaseUnusedSamplerBinding = 100;
+
+// The decorations assigned at link time to an interface variable of the SPIR-V generated by the
+// translator.  Attributes and varyings use the location and component, while samplers and uniform
+// blocks use the descriptor set and binding.
+struct InterfaceDecorations
+{
+    uint32_t location      = 0;
+    uint32_t component     = 0;
+    uint32_t descriptorSet = 0;
+    uint32_t binding       = 0;
+};
+
+// The interface variables are identified by their debug name, which is their GLSL name.
+using InterfaceDecorationsMap = std::map<std::string, InterfaceDecorations>;
+
+InterfaceDecorations MakeLocationDecorations(uint32_t location, uint32_t component)
+{
+    InterfaceDecorations decorations;
+    decorations.location  = location;
+    decorations.component = component;
+    return decorations;
+}
+
+InterfaceDecorations MakeBindingDecorations(uint32_t descriptorSet, uint32_t binding)
+{
+    InterfaceDecorations decorations;
+    decorations.descriptorSet = descriptorSet;
+    decorations.binding       = binding;
+    return decorations;
+}
 
 void GetBuiltInResourcesFromCaps(const gl::Caps &caps, TBuiltInResource *outBuiltInResources)
 {
@@ -114,6 +158,161 @@ void EraseLayoutAndQualifierStrings(std::string *vertexSource,
     InsertQualifierSpecifierString(fragmentSource, uniformName, "");
 }
 
+// Returns the GLSL expression that refers to a captured varying in the vertex shader.
+std::string GetXfbVaryingExpression(gl::Shader *vertexShader,
+                                    const gl::TransformFeedbackVarying &varying)
+{
+    std::string expression;
+
+    if (varying.isBuiltIn())
+    {
+        expression = varying.name;
+    }
+    else if (varying.name.find('.') != std::string::npos)
+    {
+        // Struct fields are captured with the "struct.field" name, but only carry the mapped name
+        // of the field.  Look up the mapped name of the struct in the vertex shader outputs.
+        const std::string structName = varying.name.substr(0, varying.name.find('.'));
+        for (const sh::Varying &output : vertexShader->getOutputVaryings())
+        {
+            if (output.name == structName)
+            {
+                ASSERT(output.isStruct() && !output.isArray());
+                expression = output.mappedName + "." + varying.mappedName;
+                break;
+            }
+        }
+        ASSERT(!expression.empty());
+    }
+    else
+    {
+        expression = varying.mappedName;
+    }
+
+    if (varying.arrayIndex != GL_INVALID_INDEX)
+    {
+        expression += "[" + Str(varying.arrayIndex) + "]";
+    }
+
+    return expression;
+}
+
+// Writes the statements that store one captured varying at 'offsetName' + 'offset' in the
+// transform feedback buffer 'bufferName'.  Returns the number of 32-bit words written.
+int WriteXfbVaryingCapture(std::ostringstream *out,
+                           const std::string &bufferName,
+                           const std::string &offsetName,
+                           int offset,
+                           const std::string &varyingExpression,
+                           const gl::TransformFeedbackVarying &varying)
+{
+    const GLenum componentType = gl::VariableComponentType(varying.type);
+    const int columnCount      = gl::VariableColumnCount(varying.type);
+    const int rowCount         = gl::VariableRowCount(varying.type);
+    const int elementCount     = varying.size();
+
+    // The buffers are declared as uint arrays to store the bits of all types unchanged.
+    const char *conversion = componentType == GL_FLOAT ? "floatBitsToUint" : "uint";
+
+    int wordCount = 0;
+    for (int element = 0; element < elementCount; ++element)
+    {
+        std::string elementExpression = varyingExpression;
+        if (varying.isArray() && varying.arrayIndex == GL_INVALID_INDEX)
+        {
+            elementExpression += "[" + Str(element) + "]";
+        }
+
+        for (int column = 0; column < columnCount; ++column)
+        {
+            for (int row = 0; row < rowCount; ++row)
+            {
+                std::string componentExpression = elementExpression;
+                if (columnCount > 1)
+                {
+                    componentExpression += "[" + Str(column) + "]";
+                }
+                if (rowCount > 1)
+                {
+                    componentExpression += "[" + Str(row) + "]";
+                }
+
+                *out << "        " << bufferName << ".xfbOut[" << offsetName << " + "
+                     << (offset + wordCount) << "] = " << conversion << "(" << componentExpression
+                     << ");\n";
+                ++wordCount;
+            }
+        }
+    }
+
+    return wordCount;
+}
+
+// Generates the definition of ANGLECaptureXfb(), which the translator calls at the end of the
+// vertex shader when ANGLE_CAPTURE_XFB is defined, along with the storage buffers it writes to.
+// See ContextVk::DriverUniforms for the uniforms used to locate the captured vertex in the buffers.
+std::string GenerateXfbCapture(const gl::ProgramState &programState, gl::Shader *vertexShader)
+{
+    const std::vector<gl::TransformFeedbackVarying> &varyings =
+        programState.getLinkedTransformFeedbackVaryings();
+    ASSERT(!varyings.empty());
+
+    std::ostringstream declarations;
+    std::ostringstream body;
+
+    declarations << "\n";
+
+    const bool isInterleaved =
+        programState.getTransformFeedbackBufferMode() == GL_INTERLEAVED_ATTRIBS;
+    const size_t bufferCount = isInterleaved ? 1 : varyings.size();
+
+    body << "    if (ANGLEUniforms.xfbActiveUnpaused != 0)\n"
+         << "    {\n"
+         << "        int xfbIndex = gl_VertexIndex + gl_InstanceIndex * "
+            "ANGLEUniforms.xfbVerticesPerDraw;\n";
+
+    // Compute the strides up front, as the offsets need to be known before the writes.
+    std::vector<int> strides(bufferCount, 0);
+    for (size_t varyingIndex = 0; varyingIndex < varyings.size(); ++varyingIndex)
+    {
+        const gl::TransformFeedbackVarying &varying = varyings[varyingIndex];
+        strides[isInterleaved ? 0 : varyingIndex] +=
+            varying.size() * gl::VariableComponentCount(varying.type);
+    }
+
+    for (size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex)
+    {
+        const std::string bufferIndexString = Str(static_cast<int>(bufferIndex));
+
+        // The buffers follow the driver uniforms in their descriptor set.
+        declarations << "layout(set = 2, binding = " << (bufferIndex + 1)
+                     << ", std430) buffer ANGLEXfbBuffer" << bufferIndexString
+                     << "\n{\n    uint xfbOut[];\n} ANGLEXfb" << bufferIndexString << ";\n";
+
+        body << "        int xfbOffset" << bufferIndexString
+             << " = ANGLEUniforms.xfbBufferOffsets[" << bufferIndexString << "] + xfbIndex * "
+             << strides[bufferIndex] << ";\n";
+    }
+
+    int interleavedOffset = 0;
+    for (size_t varyingIndex = 0; varyingIndex < varyings.size(); ++varyingIndex)
+    {
+        const gl::TransformFeedbackVarying &varying = varyings[varyingIndex];
+        const std::string bufferIndexString =
+            Str(isInterleaved ? 0 : static_cast<int>(varyingIndex));
+
+        int wordCount = WriteXfbVaryingCapture(
+            &body, "ANGLEXfb" + bufferIndexString, "xfbOffset" + bufferIndexString,
+            isInterleaved ? interleavedOffset : 0,
+            GetXfbVaryingExpression(vertexShader, varying), varying);
+        interleavedOffset += wordCount;
+    }
+
+    body << "    }\n";
+
+    return declarations.str() + "void ANGLECaptureXfb()\n{\n" + body.str() + "}\n";
+}
+
 std::string GetMappedSamplerName(const std::string &originalName)
 {
     std::string samplerName = gl::ParseResourceName(originalName, nullptr);
@@ -126,6 +325,195 @@ std::string GetMappedSamplerName(const std::string &originalName)
     samplerName.erase(std::remove(samplerName.begin(), samplerName.end(), ']'), samplerName.end());
     return samplerName;
 }
+
+// Returns the number of locations taken by a varying.
+uint32_t GetVaryingLocationCount(const sh::Varying &varying)
+{
+    const uint32_t columnCount =
+        gl::IsMatrixType(varying.type) ? gl::VariableColumnCount(varying.type) : 1;
+    return std::max(1u, varying.getOutermostArraySize()) * columnCount;
+}
+
+// Sets the decorations of a variable that is declared the same way in both shaders.
+void SetInterfaceDecorations(const std::string &name,
+                             const InterfaceDecorations &decorations,
+                             InterfaceDecorationsMap *vertexDecorations,
+                             InterfaceDecorationsMap *fragmentDecorations)
+{
+    (*vertexDecorations)[name]   = decorations;
+    (*fragmentDecorations)[name] = decorations;
+}
+
+// Gathers the decorations of the interface variables of both shaders, using the same rules as
+// GetShaderSource.  Returns false if the varyings don't fit in the vertex outputs.
+bool GetInterfaceDecorations(const gl::ProgramState &programState,
+                             const gl::ProgramLinkedResources &resources,
+                             const gl::Caps &glCaps,
+                             InterfaceDecorationsMap *vertexDecorationsOut,
+                             InterfaceDecorationsMap *fragmentDecorationsOut)
+{
+    gl::Shader *glVertexShader = programState.getAttachedShader(gl::ShaderType::Vertex);
+
+    for (const sh::Attribute &attribute : programState.getAttributes())
+    {
+        ASSERT(attribute.active);
+        (*vertexDecorationsOut)[attribute.name] = MakeLocationDecorations(attribute.location, 0);
+    }
+
+    // Only the first register of a varying is used, like the GLSL marker is only replaced once.
+    for (const gl::PackedVaryingRegister &varyingReg : resources.varyingPacking.getRegisterList())
+    {
+        const std::string &name = varyingReg.packedVarying->varying->name;
+        if (vertexDecorationsOut->count(name) == 0)
+        {
+            SetInterfaceDecorations(
+                name, MakeLocationDecorations(varyingReg.registerRow, varyingReg.registerColumn),
+                vertexDecorationsOut, fragmentDecorationsOut);
+        }
+    }
+
+    const uint32_t positionLocation = resources.varyingPacking.getMaxSemanticIndex() + 1;
+    SetInterfaceDecorations(kPositionVaryingName, MakeLocationDecorations(positionLocation, 0),
+                            vertexDecorationsOut, fragmentDecorationsOut);
+
+    // Inactive varyings are plain globals in the GLSL path.  In SPIR-V they stay vertex outputs,
+    // and are given the locations after the position varying, which the fragment shader ignores.
+    uint32_t nextInactiveLocation = positionLocation + 1;
+    for (const std::string &varyingName : resources.varyingPacking.getInactiveVaryingNames())
+    {
+        for (const sh::Varying &varying : glVertexShader->getOutputVaryings())
+        {
+            if (varying.name == varyingName)
+            {
+                (*vertexDecorationsOut)[varyingName] =
+                    MakeLocationDecorations(nextInactiveLocation, 0);
+                nextInactiveLocation += GetVaryingLocationCount(varying);
+                break;
+            }
+        }
+    }
+
+    if (nextInactiveLocation > static_cast<uint32_t>(glCaps.maxVertexOutputComponents / 4))
+    {
+        return false;
+    }
+
+    (*vertexDecorationsOut)[kDefaultUniformsName]   = MakeBindingDecorations(0, 0);
+    (*fragmentDecorationsOut)[kDefaultUniformsName] = MakeBindingDecorations(0, 1);
+
+    uint32_t textureCount = 0;
+    const auto &uniforms  = programState.getUniforms();
+    for (unsigned int uniformIndex : programState.getSamplerUniformRange())
+    {
+        SetInterfaceDecorations(GetMappedSamplerName(uniforms[uniformIndex].name),
+                                MakeBindingDecorations(1, textureCount++), vertexDecorationsOut,
+                                fragmentDecorationsOut);
+    }
+
+    uint32_t unusedSamplerBinding = kBaseUnusedSamplerBinding;
+    for (const gl::UnusedUniform &unusedUniform : resources.unusedUniforms)
+    {
+        if (unusedUniform.isSampler)
+        {
+            SetInterfaceDecorations(GetMappedSamplerName(unusedUniform.name),
+                                    MakeBindingDecorations(0, unusedSamplerBinding++),
+                                    vertexDecorationsOut, fragmentDecorationsOut);
+        }
+    }
+
+    SetInterfaceDecorations(kDriverBlockName, MakeBindingDecorations(2, 0), vertexDecorationsOut,
+                            fragmentDecorationsOut);
+
+    return true;
+}
+
+// Copies a module generated by the translator, replacing the placeholder Location, DescriptorSet
+// and Binding decorations of its named interface variables with |decorations|.  A Component
+// decoration is added after the Location of varyings that don't start at the first component.
+// Returns false if a named variable isn't part of the linked interface.
+bool AssignInterfaceDecorations(const std::vector<uint32_t> &code,
+                                const InterfaceDecorationsMap &decorations,
+                                std::vector<uint32_t> *codeOut)
+{
+    namespace spirv = angle::spirv;
+
+    if (code.size() < spirv::kHeaderWordCount || code[0] != spirv::MagicNumber)
+    {
+        return false;
+    }
+
+    codeOut->clear();
+    codeOut->reserve(code.size());
+    codeOut->insert(codeOut->end(), code.begin(), code.begin() + spirv::kHeaderWordCount);
+
+    // The debug names come before the decorations in a module.
+    std::map<uint32_t, const InterfaceDecorations *> idDecorations;
+
+    size_t offset = spirv::kHeaderWordCount;
+    while (offset < code.size())
+    {
+        const uint32_t *instruction = &code[offset];
+        const uint32_t wordCount    = spirv::GetWordCount(instruction[0]);
+        const uint32_t opCode       = spirv::GetOpCode(instruction[0]);
+        if (wordCount == 0 || offset + wordCount > code.size())
+        {
+            return false;
+        }
+        offset += wordCount;
+
+        if (opCode == spirv::OpName && wordCount > 2)
+        {
+            // The name is a nul-terminated string padded to a word boundary.
+            const char *name       = reinterpret_cast<const char *>(&instruction[2]);
+            const size_t maxLength = (wordCount - 2) * sizeof(uint32_t);
+            auto iter              = decorations.find(std::string(name, strnlen(name, maxLength)));
+            if (iter == decorations.end())
+            {
+                return false;
+            }
+            idDecorations[instruction[1]] = &iter->second;
+        }
+
+        codeOut->insert(codeOut->end(), instruction, instruction + wordCount);
+
+        if (opCode != spirv::OpDecorate || wordCount != 4)
+        {
+            continue;
+        }
+
+        auto iter = idDecorations.find(instruction[1]);
+        if (iter == idDecorations.end())
+        {
+            continue;
+        }
+
+        const InterfaceDecorations &assigned = *iter->second;
+        uint32_t *value                      = &codeOut->back();
+        switch (instruction[2])
+        {
+            case spirv::DecorationLocation:
+                *value = assigned.location;
+                if (assigned.component > 0)
+                {
+                    codeOut->push_back(spirv::MakeFirstWord(spirv::OpDecorate, 4));
+                    codeOut->push_back(instruction[1]);
+                    codeOut->push_back(spirv::DecorationComponent);
+                    codeOut->push_back(assigned.component);
+                }
+                break;
+            case spirv::DecorationDescriptorSet:
+                *value = assigned.descriptorSet;
+                break;
+            case spirv::DecorationBinding:
+                *value = assigned.binding;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
 }  // anonymous namespace
 
 // static
@@ -145,13 +533,20 @@ void GlslangWrapper::Release()
 // static
 void GlslangWrapper::GetShaderSource(const gl::ProgramState &programState,
                                      const gl::ProgramLinkedResources &resources,
+                                     bool removeUnusedVertexOutputs,
                                      std::string *vertexSourceOut,
                                      std::string *fragmentSourceOut)
 {
     gl::Shader *glVertexShader   = programState.getAttachedShader(gl::ShaderType::Vertex);
     gl::Shader *glFragmentShader = programState.getAttachedShader(gl::ShaderType::Fragment);
 
-    std::string vertexSource   = glVertexShader->getTranslatedSource();
+    // The markers of the removed outputs are gone along with them, so erasing the markers of the
+    // inactive varyings below doesn't find them.
+    std::string vertexSource =
+        removeUnusedVertexOutputs
+            ? glVertexShader->getTranslatedSourceWithoutOutputs(
+                  resources.varyingPacking.getUnusedVertexOutputNames())
+            : glVertexShader->getTranslatedSource();
     std::string fragmentSource = glFragmentShader->getTranslatedSource();
 
     // Parse attribute locations and replace them in the vertex shader.
@@ -247,9 +642,7 @@ void GlslangWrapper::GetShaderSource(const gl::ProgramState &programState,
         textureCount++;
     }
 
-    // Start the unused sampler bindings at something ridiculously high.
-    constexpr int kBaseUnusedSamplerBinding = 100;
-    int unusedSamplerBinding                = kBaseUnusedSamplerBinding;
+    int unusedSamplerBinding = kBaseUnusedSamplerBinding;
 
     for (const gl::UnusedUniform &unusedUniform : resources.unusedUniforms)
     {
@@ -278,7 +671,6 @@ void GlslangWrapper::GetShaderSource(const gl::ProgramState &programState,
 
     // Substitute layout and qualifier strings for the driver uniforms block.
     constexpr char kDriverBlockLayoutString[] = "set = 2, binding = 0";
-    constexpr char kDriverBlockName[]         = "ANGLEUniforms";
     InsertLayoutSpecifierString(&vertexSource, kDriverBlockName, kDriverBlockLayoutString);
     InsertLayoutSpecifierString(&fragmentSource, kDriverBlockName, kDriverBlockLayoutString);
 
@@ -287,15 +679,27 @@ void GlslangWrapper::GetShaderSource(const gl::ProgramState &programState,
 
     // Substitute layout and qualifier strings for the position varying. Use the first free
     // varying register after the packed varyings.
-    constexpr char kVaryingName[] = "ANGLEPosition";
     std::stringstream layoutStream;
     layoutStream << "location = " << (resources.varyingPacking.getMaxSemanticIndex() + 1);
     const std::string layout = layoutStream.str();
-    InsertLayoutSpecifierString(&vertexSource, kVaryingName, layout);
-    InsertLayoutSpecifierString(&fragmentSource, kVaryingName, layout);
+    InsertLayoutSpecifierString(&vertexSource, kPositionVaryingName, layout);
+    InsertLayoutSpecifierString(&fragmentSource, kPositionVaryingName, layout);
 
-    InsertQualifierSpecifierString(&vertexSource, kVaryingName, "out");
-    InsertQualifierSpecifierString(&fragmentSource, kVaryingName, "in");
+    InsertQualifierSpecifierString(&vertexSource, kPositionVaryingName, "out");
+    InsertQualifierSpecifierString(&fragmentSource, kPositionVaryingName, "in");
+
+    // Only programs that capture varyings define the transform feedback capture function.  The
+    // translator calls it behind ANGLE_CAPTURE_XFB, which must come after the #version directive.
+    if (programState.getLinkedTransformFeedbackVaryings().empty())
+    {
+        angle::ReplaceSubstring(&vertexSource, kXfbOutMarker, "");
+    }
+    else
+    {
+        angle::ReplaceSubstring(&vertexSource, kXfbOutMarker,
+                                GenerateXfbCapture(programState, glVertexShader));
+        angle::ReplaceSubstring(&vertexSource, kVersionDefine, kCaptureXfbDefine);
+    }
 
     *vertexSourceOut   = vertexSource;
     *fragmentSourceOut = fragmentSource;
@@ -335,6 +739,27 @@ angle::Result GlslangWrapper::GetShaderCode(vk::Context *context,
     }
 }
 
+// static
+bool GlslangWrapper::GetShaderCodeFromSPIRV(const gl::ProgramState &programState,
+                                            const gl::ProgramLinkedResources &resources,
+                                            const gl::Caps &glCaps,
+                                            const std::vector<uint32_t> &vertexSPIRV,
+                                            const std::vector<uint32_t> &fragmentSPIRV,
+                                            std::vector<uint32_t> *vertexCodeOut,
+                                            std::vector<uint32_t> *fragmentCodeOut)
+{
+    InterfaceDecorationsMap vertexDecorations;
+    InterfaceDecorationsMap fragmentDecorations;
+    if (!GetInterfaceDecorations(programState, resources, glCaps, &vertexDecorations,
+                                 &fragmentDecorations))
+    {
+        return false;
+    }
+
+    return AssignInterfaceDecorations(vertexSPIRV, vertexDecorations, vertexCodeOut) &&
+           AssignInterfaceDecorations(fragmentSPIRV, fragmentDecorations, fragmentCodeOut);
+}
+
 // static
 angle::Result GlslangWrapper::GetShaderCodeImpl(vk::Context *context,
                                                 const gl::Caps &glCaps,
@@ -22,8 +22,11 @@ class GlslangWrapper
     static void Initialize();
     static void Release();
 
+    // If |removeUnusedVertexOutputs| is true, the vertex shader is translated again without the
+    // outputs that the fragment shader doesn't read.
     static void GetShaderSource(const gl::ProgramState &programState,
                                 const gl::ProgramLinkedResources &resources,
+                                bool removeUnusedVertexOutputs,
                                 std::string *vertexSourceOut,
                                 std::string *fragmentSourceOut);
 
@@ -35,6 +38,17 @@ class GlslangWrapper
                                        std::vector<uint32_t> *vertexCodeOut,
                                        std::vector<uint32_t> *fragmentCodeOut);
 
+    // Assigns the locations and descriptor set bindings of the SPIR-V generated by the translator
+    // following the same rules as GetShaderSource.  Returns false if the shaders can't be linked
+    // this way, in which case GetShaderSource and GetShaderCode must be used instead.
+    static bool GetShaderCodeFromSPIRV(const gl::ProgramState &programState,
+                                       const gl::ProgramLinkedResources &resources,
+                                       const gl::Caps &glCaps,
+                                       const std::vector<uint32_t> &vertexSPIRV,
+                                       const std::vector<uint32_t> &fragmentSPIRV,
+                                       std::vector<uint32_t> *vertexCodeOut,
+                                       std::vector<uint32_t> *fragmentCodeOut);
+
   private:
     static angle::Result GetShaderCodeImpl(vk::Context *context,
                                            const gl::Caps &glCaps,
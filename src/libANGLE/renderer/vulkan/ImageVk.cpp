@@ -80,6 +80,24 @@ egl::Error ImageVk::initialize(const egl::Display *display)
         mImageLevel       = 0;
         mImageLayer       = 0;
     }
+    else if (egl::IsExternalImageTarget(mState.target))
+    {
+        // The sibling imports the buffer when the image is initialized, and keeps the image alive
+        // until the EGL image is destroyed.
+        ExternalImageSiblingVk *externalImageSibling =
+            GetImplAs<ExternalImageSiblingVk>(GetAs<egl::ExternalImageSibling>(mState.source));
+        mImage = externalImageSibling->getImage();
+        ASSERT(mImage != nullptr && mImage->valid());
+
+        DisplayVk *displayVk = vk::GetImpl(display);
+        mImage->initStagingBuffer(displayVk->getRenderer());
+
+        mOwnsImage = false;
+
+        mImageTextureType = gl::TextureType::_2D;
+        mImageLevel       = 0;
+        mImageLayer       = 0;
+    }
     else
     {
         UNREACHABLE();
@@ -16,6 +16,17 @@
 namespace rx
 {
 
+// Base class for EGL image sources that are imported from outside of ANGLE, such as dma-bufs.  The
+// sibling owns the vk::ImageHelper that the EGL image and its targets share.
+class ExternalImageSiblingVk : public ExternalImageSiblingImpl
+{
+  public:
+    ExternalImageSiblingVk() {}
+    ~ExternalImageSiblingVk() override {}
+
+    virtual vk::ImageHelper *getImage() const = 0;
+};
+
 class ImageVk : public ImageImpl
 {
   public:
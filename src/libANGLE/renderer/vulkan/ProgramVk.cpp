@@ -15,6 +15,7 @@
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/GlslangWrapper.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
+#include "libANGLE/renderer/vulkan/ShaderVk.h"
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 
 namespace rx
@@ -147,9 +148,17 @@ angle::Result ProgramVk::ShaderInfo::initShaders(ContextVk *contextVk,
 
     std::vector<uint32_t> vertexCode;
     std::vector<uint32_t> fragmentCode;
-    ANGLE_TRY(GlslangWrapper::GetShaderCode(contextVk, contextVk->getCaps(),
-                                            enableLineRasterEmulation, vertexSource, fragmentSource,
-                                            &vertexCode, &fragmentCode));
+    if (!mLinkedSPIRV[gl::ShaderType::Vertex].empty())
+    {
+        vertexCode   = std::move(mLinkedSPIRV[gl::ShaderType::Vertex]);
+        fragmentCode = std::move(mLinkedSPIRV[gl::ShaderType::Fragment]);
+    }
+    else
+    {
+        ANGLE_TRY(GlslangWrapper::GetShaderCode(contextVk, contextVk->getCaps(),
+                                                enableLineRasterEmulation, vertexSource,
+                                                fragmentSource, &vertexCode, &fragmentCode));
+    }
 
     ANGLE_TRY(vk::InitShaderAndSerial(contextVk, &mShaders[gl::ShaderType::Vertex].get(),
                                       vertexCode.data(), vertexCode.size() * sizeof(uint32_t)));
@@ -170,6 +179,17 @@ void ProgramVk::ShaderInfo::release(RendererVk *renderer)
     {
         shader.get().destroy(renderer->getDevice());
     }
+
+    for (std::vector<uint32_t> &code : mLinkedSPIRV)
+    {
+        code.clear();
+    }
+}
+
+void ProgramVk::ShaderInfo::setLinkedSPIRV(gl::ShaderMap<std::vector<uint32_t>> &&linkedSPIRV)
+{
+    ASSERT(!valid());
+    mLinkedSPIRV = std::move(linkedSPIRV);
 }
 
 // ProgramVk implementation.
@@ -181,7 +201,8 @@ ProgramVk::DefaultUniformBlock::DefaultUniformBlock()
 
 ProgramVk::DefaultUniformBlock::~DefaultUniformBlock() = default;
 
-ProgramVk::ProgramVk(const gl::ProgramState &state) : ProgramImpl(state), mUniformBlocksOffsets{}
+ProgramVk::ProgramVk(const gl::ProgramState &state)
+    : ProgramImpl(state), mUniformBlocksOffsets{}, mUsesTranslatorSPIRV(false)
 {
     mUsedDescriptorSetRange.invalidate();
 }
@@ -214,6 +235,7 @@ void ProgramVk::reset(RendererVk *renderer)
 
     mDescriptorSets.clear();
     mUsedDescriptorSetRange.invalidate();
+    mTextureDescriptorsCache.clear();
 
     for (vk::SharedDescriptorPoolBinding &binding : mDescriptorPoolBindings)
     {
@@ -253,6 +275,44 @@ std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
     return std::make_unique<LinkEventDone>(linkImpl(context, resources, infoLog));
 }
 
+bool ProgramVk::linkSPIRV(ContextVk *contextVk, const gl::ProgramLinkedResources &resources)
+{
+    // Transform feedback capture is only generated in the GLSL path.
+    if (!mState.getLinkedTransformFeedbackVaryings().empty())
+    {
+        return false;
+    }
+
+    const ShaderVk *vertexShaderVk =
+        GetImplAs<ShaderVk>(mState.getAttachedShader(gl::ShaderType::Vertex));
+    const ShaderVk *fragmentShaderVk =
+        GetImplAs<ShaderVk>(mState.getAttachedShader(gl::ShaderType::Fragment));
+
+    // Both variants are generated together, so only the default one needs to be checked.
+    if (vertexShaderVk->getSPIRV(false).empty() || fragmentShaderVk->getSPIRV(false).empty())
+    {
+        return false;
+    }
+
+    gl::ShaderMap<std::vector<uint32_t>> defaultSPIRV;
+    gl::ShaderMap<std::vector<uint32_t>> lineRasterSPIRV;
+    if (!GlslangWrapper::GetShaderCodeFromSPIRV(
+            mState, resources, contextVk->getCaps(), vertexShaderVk->getSPIRV(false),
+            fragmentShaderVk->getSPIRV(false), &defaultSPIRV[gl::ShaderType::Vertex],
+            &defaultSPIRV[gl::ShaderType::Fragment]) ||
+        !GlslangWrapper::GetShaderCodeFromSPIRV(
+            mState, resources, contextVk->getCaps(), vertexShaderVk->getSPIRV(true),
+            fragmentShaderVk->getSPIRV(true), &lineRasterSPIRV[gl::ShaderType::Vertex],
+            &lineRasterSPIRV[gl::ShaderType::Fragment]))
+    {
+        return false;
+    }
+
+    mDefaultShaderInfo.setLinkedSPIRV(std::move(defaultSPIRV));
+    mLineRasterShaderInfo.setLinkedSPIRV(std::move(lineRasterSPIRV));
+    return true;
+}
+
 angle::Result ProgramVk::linkImpl(const gl::Context *glContext,
                                   const gl::ProgramLinkedResources &resources,
                                   gl::InfoLog &infoLog)
@@ -262,7 +322,12 @@ angle::Result ProgramVk::linkImpl(const gl::Context *glContext,
 
     reset(renderer);
 
-    GlslangWrapper::GetShaderSource(mState, resources, &mVertexSource, &mFragmentSource);
+    // Translating the vertex shader again is only worth it if its GLSL is compiled.
+    mUsesTranslatorSPIRV = linkSPIRV(contextVk, resources);
+    bool removeUnusedVertexOutputs =
+        !mUsesTranslatorSPIRV && renderer->getFeatures().removeUnusedVertexOutputs;
+    GlslangWrapper::GetShaderSource(mState, resources, removeUnusedVertexOutputs, &mVertexSource,
+                                    &mFragmentSource);
 
     ANGLE_TRY(initDefaultUniformBlocks(glContext));
 
@@ -298,8 +363,11 @@ angle::Result ProgramVk::linkImpl(const gl::Context *glContext,
     ANGLE_TRY(renderer->getDescriptorSetLayout(contextVk, texturesSetDesc,
                                                &mDescriptorSetLayouts[kTextureDescriptorSetIndex]));
 
+    // The caps only allow capturing varyings when transform feedback is emulated.
+    ASSERT(!hasXfbBuffers() || contextVk->getFeatures().emulateTransformFeedback);
+
     vk::DescriptorSetLayoutDesc driverUniformsSetDesc;
-    driverUniformsSetDesc.update(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1);
+    ContextVk::InitDriverUniformsSetLayoutDesc(hasXfbBuffers(), &driverUniformsSetDesc);
     ANGLE_TRY(renderer->getDescriptorSetLayout(
         contextVk, driverUniformsSetDesc,
         &mDescriptorSetLayouts[kDriverUniformsDescriptorSetIndex]));
@@ -726,11 +794,23 @@ angle::Result ProgramVk::allocateDescriptorSet(ContextVk *contextVk, uint32_t de
         mDescriptorSets.resize(potentialNewCount, VK_NULL_HANDLE);
     }
 
+    vk::SharedDescriptorPoolBinding &poolBinding = mDescriptorPoolBindings[descriptorSetIndex];
+    const vk::DescriptorPoolHelper *previousPool =
+        poolBinding.valid() ? &poolBinding.get() : nullptr;
+
     const vk::DescriptorSetLayout &descriptorSetLayout =
         mDescriptorSetLayouts[descriptorSetIndex].get();
     ANGLE_TRY(dynamicDescriptorPool->allocateSets(contextVk, descriptorSetLayout.ptr(), 1,
-                                                  &mDescriptorPoolBindings[descriptorSetIndex],
+                                                  &poolBinding,
                                                   &mDescriptorSets[descriptorSetIndex]));
+
+    // Once we release our reference to a pool it can be recycled, which frees all the cached
+    // descriptor sets that were allocated from it.
+    if (descriptorSetIndex == kTextureDescriptorSetIndex && &poolBinding.get() != previousPool)
+    {
+        mTextureDescriptorsCache.clear();
+    }
+
     return angle::Result::Continue;
 }
 
@@ -831,28 +911,19 @@ angle::Result ProgramVk::updateTexturesDescriptorSet(ContextVk *contextVk,
                                                      vk::FramebufferHelper *framebuffer)
 {
     ASSERT(hasTextures());
-    ANGLE_TRY(allocateDescriptorSet(contextVk, kTextureDescriptorSetIndex));
-
-    ASSERT(mUsedDescriptorSetRange.contains(1));
-    VkDescriptorSet descriptorSet = mDescriptorSets[kTextureDescriptorSetIndex];
-
-    gl::ActiveTextureArray<VkDescriptorImageInfo> descriptorImageInfo;
-    gl::ActiveTextureArray<VkWriteDescriptorSet> writeDescriptorInfo;
-    uint32_t writeCount = 0;
+    ASSERT(mUsedDescriptorSetRange.contains(kTextureDescriptorSetIndex));
 
     const gl::ActiveTextureArray<TextureVk *> &activeTextures = contextVk->getActiveTextures();
 
-    for (uint32_t textureIndex = 0; textureIndex < mState.getSamplerBindings().size();
-         ++textureIndex)
-    {
-        const gl::SamplerBinding &samplerBinding = mState.getSamplerBindings()[textureIndex];
+    vk::TextureDescriptorDesc texturesDesc;
+    uint32_t textureCount = 0;
 
+    for (const gl::SamplerBinding &samplerBinding : mState.getSamplerBindings())
+    {
         ASSERT(!samplerBinding.unreferenced);
 
-        for (uint32_t arrayElement = 0; arrayElement < samplerBinding.boundTextureUnits.size();
-             ++arrayElement)
+        for (GLuint textureUnit : samplerBinding.boundTextureUnits)
         {
-            GLuint textureUnit   = samplerBinding.boundTextureUnits[arrayElement];
             TextureVk *textureVk = activeTextures[textureUnit];
 
             // Ensure any writes to the textures are flushed before we read from them.
@@ -871,6 +942,48 @@ angle::Result ProgramVk::updateTexturesDescriptorSet(ContextVk *contextVk,
 
             image.addReadDependency(framebuffer);
 
+            texturesDesc.update(textureCount++, textureVk->getSerial());
+        }
+    }
+
+    // Reuse a previously written descriptor set if the same textures were bound before.
+    auto iter = mTextureDescriptorsCache.find(texturesDesc);
+    if (iter != mTextureDescriptorsCache.end())
+    {
+        mDescriptorSets[kTextureDescriptorSetIndex] = iter->second;
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(allocateDescriptorSet(contextVk, kTextureDescriptorSetIndex));
+
+    VkDescriptorSet descriptorSet = mDescriptorSets[kTextureDescriptorSetIndex];
+    ANGLE_TRY(writeTexturesDescriptorSet(contextVk, descriptorSet));
+
+    mTextureDescriptorsCache.emplace(texturesDesc, descriptorSet);
+    return angle::Result::Continue;
+}
+
+angle::Result ProgramVk::writeTexturesDescriptorSet(ContextVk *contextVk,
+                                                    VkDescriptorSet descriptorSet)
+{
+    gl::ActiveTextureArray<VkDescriptorImageInfo> descriptorImageInfo;
+    gl::ActiveTextureArray<VkWriteDescriptorSet> writeDescriptorInfo;
+    uint32_t writeCount = 0;
+
+    const gl::ActiveTextureArray<TextureVk *> &activeTextures = contextVk->getActiveTextures();
+
+    for (uint32_t textureIndex = 0; textureIndex < mState.getSamplerBindings().size();
+         ++textureIndex)
+    {
+        const gl::SamplerBinding &samplerBinding = mState.getSamplerBindings()[textureIndex];
+
+        for (uint32_t arrayElement = 0; arrayElement < samplerBinding.boundTextureUnits.size();
+             ++arrayElement)
+        {
+            GLuint textureUnit     = samplerBinding.boundTextureUnits[arrayElement];
+            TextureVk *textureVk   = activeTextures[textureUnit];
+            vk::ImageHelper &image = textureVk->getImage();
+
             VkDescriptorImageInfo &imageInfo = descriptorImageInfo[writeCount];
 
             imageInfo.sampler     = textureVk->getSampler().getHandle();
@@ -112,11 +112,16 @@ class ProgramVk : public ProgramImpl
 
     // For testing only.
     void setDefaultUniformBlocksMinSizeForTesting(size_t minSize);
+    bool usesTranslatorSPIRVForTesting() const { return mUsesTranslatorSPIRV; }
 
     const vk::PipelineLayout &getPipelineLayout() const { return mPipelineLayout.get(); }
 
     bool hasTextures() const { return !mState.getSamplerBindings().empty(); }
 
+    // Whether the vertex shader writes transform feedback varyings to storage buffers in the
+    // driver uniforms set.
+    bool hasXfbBuffers() const { return !mState.getLinkedTransformFeedbackVaryings().empty(); }
+
     bool dirtyUniforms() const { return mDefaultUniformBlocksDirty.any(); }
 
     angle::Result getGraphicsPipeline(ContextVk *contextVk,
@@ -148,6 +153,7 @@ class ProgramVk : public ProgramImpl
     angle::Result initDefaultUniformBlocks(const gl::Context *glContext);
 
     angle::Result updateDefaultUniformsDescriptorSet(ContextVk *contextVk);
+    angle::Result writeTexturesDescriptorSet(ContextVk *contextVk, VkDescriptorSet descriptorSet);
 
     template <class T>
     void getUniformImpl(GLint location, T *v, GLenum entryPointType) const;
@@ -157,6 +163,9 @@ class ProgramVk : public ProgramImpl
     angle::Result linkImpl(const gl::Context *glContext,
                            const gl::ProgramLinkedResources &resources,
                            gl::InfoLog &infoLog);
+    // Uses the SPIR-V generated by the translator if both shaders have some, and falls back to the
+    // GLSL sources otherwise.  Returns true if the SPIR-V is used.
+    bool linkSPIRV(ContextVk *contextVk, const gl::ProgramLinkedResources &resources);
 
     ANGLE_INLINE angle::Result initShaders(ContextVk *contextVk,
                                            gl::PrimitiveMode mode,
@@ -226,6 +235,11 @@ class ProgramVk : public ProgramImpl
     // is in use.
     vk::DescriptorSetLayoutArray<vk::SharedDescriptorPoolBinding> mDescriptorPoolBindings;
 
+    // Texture descriptor sets that were already written, keyed on the serials of the bound
+    // textures. The sets are only kept alive by the binding to the current texture descriptor
+    // pool, so the cache is cleared whenever the program moves on to a new pool.
+    std::unordered_map<vk::TextureDescriptorDesc, VkDescriptorSet> mTextureDescriptorsCache;
+
     class ShaderInfo final : angle::NonCopyable
     {
       public:
@@ -238,6 +252,10 @@ class ProgramVk : public ProgramImpl
                                   bool enableLineRasterEmulation);
         void release(RendererVk *renderer);
 
+        // Makes initShaders use the SPIR-V generated by the translator, with its interface already
+        // assigned, instead of compiling the GLSL sources with glslang.
+        void setLinkedSPIRV(gl::ShaderMap<std::vector<uint32_t>> &&linkedSPIRV);
+
         ANGLE_INLINE bool valid() const { return mShaders[gl::ShaderType::Vertex].get().valid(); }
 
         vk::ShaderProgramHelper &getShaderProgram() { return mProgramHelper; }
@@ -245,6 +263,7 @@ class ProgramVk : public ProgramImpl
       private:
         vk::ShaderProgramHelper mProgramHelper;
         gl::ShaderMap<vk::RefCounted<vk::ShaderAndSerial>> mShaders;
+        gl::ShaderMap<std::vector<uint32_t>> mLinkedSPIRV;
     };
 
     ShaderInfo mDefaultShaderInfo;
@@ -253,6 +272,9 @@ class ProgramVk : public ProgramImpl
     // We keep the translated linked shader sources to use with shader draw call patching.
     std::string mVertexSource;
     std::string mFragmentSource;
+
+    // Whether the shaders use the SPIR-V generated by the translator instead of glslang.
+    bool mUsesTranslatorSPIRV;
 };
 
 }  // namespace rx
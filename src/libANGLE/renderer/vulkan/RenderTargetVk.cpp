@@ -56,15 +56,18 @@ void RenderTargetVk::onColorDraw(vk::FramebufferHelper *framebufferVk,
                                  vk::CommandBuffer *commandBuffer,
                                  vk::RenderPassDesc *renderPassDesc)
 {
-    ASSERT(commandBuffer->valid());
+    ASSERT(commandBuffer ? commandBuffer->valid() : isInAttachmentLayout());
     ASSERT(!mImage->getFormat().textureFormat().hasDepthOrStencilBits());
 
     // Store the attachment info in the renderPassDesc.
     renderPassDesc->packAttachment(mImage->getFormat());
 
     // TODO(jmadill): Use automatic layout transition. http://anglebug.com/2361
-    mImage->changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, vk::ImageLayout::ColorAttachment,
-                         commandBuffer);
+    if (commandBuffer)
+    {
+        mImage->changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, vk::ImageLayout::ColorAttachment,
+                             commandBuffer);
+    }
 
     // Set up dependencies between the RT resource and the Framebuffer.
     mImage->addWriteDependency(framebufferVk);
@@ -74,22 +77,35 @@ void RenderTargetVk::onDepthStencilDraw(vk::FramebufferHelper *framebufferVk,
                                         vk::CommandBuffer *commandBuffer,
                                         vk::RenderPassDesc *renderPassDesc)
 {
-    ASSERT(commandBuffer->valid());
+    ASSERT(commandBuffer ? commandBuffer->valid() : isInAttachmentLayout());
     ASSERT(mImage->getFormat().textureFormat().hasDepthOrStencilBits());
 
     // Store the attachment info in the renderPassDesc.
     renderPassDesc->packAttachment(mImage->getFormat());
 
     // TODO(jmadill): Use automatic layout transition. http://anglebug.com/2361
-    const angle::Format &format    = mImage->getFormat().textureFormat();
-    VkImageAspectFlags aspectFlags = vk::GetDepthStencilAspectFlags(format);
+    if (commandBuffer)
+    {
+        const angle::Format &format    = mImage->getFormat().textureFormat();
+        VkImageAspectFlags aspectFlags = vk::GetDepthStencilAspectFlags(format);
 
-    mImage->changeLayout(aspectFlags, vk::ImageLayout::DepthStencilAttachment, commandBuffer);
+        mImage->changeLayout(aspectFlags, vk::ImageLayout::DepthStencilAttachment, commandBuffer);
+    }
 
     // Set up dependencies between the RT resource and the Framebuffer.
     mImage->addWriteDependency(framebufferVk);
 }
 
+bool RenderTargetVk::isInAttachmentLayout() const
+{
+    ASSERT(mImage && mImage->valid());
+
+    VkImageLayout attachmentLayout = mImage->getFormat().textureFormat().hasDepthOrStencilBits()
+                                         ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                                         : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    return mImage->getCurrentLayout() == attachmentLayout;
+}
+
 vk::ImageHelper &RenderTargetVk::getImage()
 {
     ASSERT(mImage && mImage->valid());
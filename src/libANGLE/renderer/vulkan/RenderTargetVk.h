@@ -52,6 +52,8 @@ class RenderTargetVk final : public FramebufferAttachmentRenderTarget
     void reset();
 
     // Note: RenderTargets should be called in order, with the depth/stencil onRender last.
+    // |commandBuffer| can be null if isInAttachmentLayout() returns true, in which case no layout
+    // transition is recorded.
     void onColorDraw(vk::FramebufferHelper *framebufferVk,
                      vk::CommandBuffer *commandBuffer,
                      vk::RenderPassDesc *renderPassDesc);
@@ -59,6 +61,9 @@ class RenderTargetVk final : public FramebufferAttachmentRenderTarget
                             vk::CommandBuffer *commandBuffer,
                             vk::RenderPassDesc *renderPassDesc);
 
+    // Returns true if the image is already in the layout it is rendered to with.
+    bool isInAttachmentLayout() const;
+
     vk::ImageHelper &getImage();
     const vk::ImageHelper &getImage() const;
 
@@ -55,6 +55,10 @@ constexpr size_t kUniformBufferDescriptorsPerDescriptorSet = 2;
 constexpr uint32_t kPipelineCacheVkUpdatePeriod = 10 * 60 * 60;
 // Wait a maximum of 10s.  If that times out, we declare it a failure.
 constexpr uint64_t kMaxFenceWaitTimeNs = 10'000'000'000llu;
+// Staging buffers shared by all buffer uploads are recycled once the GPU is done with them.
+constexpr VkBufferUsageFlags kStagingBufferUsage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+constexpr size_t kStagingBufferSize              = 1024 * 64;
+constexpr size_t kStagingBufferAlignment         = 4;
 // Per the Vulkan specification, as long as Vulkan 1.1+ is returned by vkEnumerateInstanceVersion,
 // ANGLE must indicate the highest version of Vulkan functionality that it uses.  The Vulkan
 // validation layers will issue messages for any core functionality that requires a higher version.
@@ -505,6 +509,7 @@ RendererVk::RendererVk()
       mCurrentQueueSerial(mQueueSerialFactory.generate()),
       mDeviceLost(false),
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
+      mStagingBuffer(kStagingBufferUsage, kStagingBufferSize, true),
       mCommandGraph(kEnableCommandGraphDiagnostics),
       mGpuEventsEnabled(false),
       mGpuClockSync{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()},
@@ -532,6 +537,7 @@ void RendererVk::onDestroy(vk::Context *context)
     mRenderPassCache.destroy(mDevice);
     mPipelineCache.destroy(mDevice);
     mSubmitSemaphorePool.destroy(mDevice);
+    mStagingBuffer.destroy(mDevice);
     mShaderLibrary.destroy(mDevice);
     mGpuEventQueryPool.destroy(mDevice);
 
@@ -922,6 +928,15 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     {
         enabledDeviceExtensions.push_back(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME);
     }
+    if (getFeatures().supportsExternalMemoryDmaBuf)
+    {
+        if (mPhysicalDeviceProperties.apiVersion < VK_MAKE_VERSION(1, 1, 0))
+        {
+            enabledDeviceExtensions.push_back(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
+        }
+        enabledDeviceExtensions.push_back(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME);
+        enabledDeviceExtensions.push_back(VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME);
+    }
 
     std::sort(enabledDeviceExtensions.begin(), enabledDeviceExtensions.end(), StrLess);
     ANGLE_VK_TRY(displayVk, VerifyExtensionsPresent(deviceExtensionNames, enabledDeviceExtensions));
@@ -931,6 +946,9 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     enabledFeatures.sType                        = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
     enabledFeatures.features.inheritedQueries    = mPhysicalDeviceFeatures.inheritedQueries;
     enabledFeatures.features.robustBufferAccess  = mPhysicalDeviceFeatures.robustBufferAccess;
+    enabledFeatures.features.vertexPipelineStoresAndAtomics =
+        mPhysicalDeviceFeatures.vertexPipelineStoresAndAtomics;
+    enabledFeatures.features.multiDrawIndirect = mPhysicalDeviceFeatures.multiDrawIndirect;
 
     VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT divisorFeatures = {};
     divisorFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT;
@@ -984,6 +1002,13 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
 
     ANGLE_VK_TRY(displayVk, vkCreateDevice(mPhysicalDevice, &createInfo, nullptr, &mDevice));
 
+#if defined(ANGLE_PLATFORM_LINUX)
+    if (getFeatures().supportsExternalMemoryDmaBuf)
+    {
+        InitExternalMemoryFdKHRFunctions(mInstance);
+    }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
     mCurrentQueueFamilyIndex = queueFamilyIndex;
 
     vkGetDeviceQueue(mDevice, mCurrentQueueFamilyIndex, 0, &mQueue);
@@ -1002,6 +1027,9 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     // Initialize the submission semaphore pool.
     ANGLE_TRY(mSubmitSemaphorePool.init(displayVk, vk::kDefaultSemaphorePoolSize));
 
+    // Initialize the staging ring used for buffer uploads.
+    mStagingBuffer.init(kStagingBufferAlignment, this);
+
 #if ANGLE_ENABLE_VULKAN_GPU_TRACE_EVENTS
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
@@ -1151,6 +1179,11 @@ void RendererVk::initFeatures(const ExtensionNameList &deviceExtensionNames)
     mFeatures.forceCpuPathForCubeMapCopy = IsIntel(mPhysicalDeviceProperties.vendorID);
 #endif
 
+    mFeatures.removeUnusedVertexOutputs = true;
+
+    // Transform feedback capture writes to storage buffers from the vertex shader.
+    mFeatures.emulateTransformFeedback = mPhysicalDeviceFeatures.vertexPipelineStoresAndAtomics;
+
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
     platform->overrideFeaturesVk(platform, &mFeatures);
 
@@ -1180,6 +1213,17 @@ void RendererVk::initFeatures(const ExtensionNameList &deviceExtensionNames)
     {
         mFeatures.supportsIncrementalPresent = true;
     }
+
+#if defined(ANGLE_PLATFORM_LINUX)
+    // Importing a dma-buf needs VK_KHR_external_memory, which is core in Vulkan 1.1.
+    if (((mPhysicalDeviceProperties.apiVersion >= VK_MAKE_VERSION(1, 1, 0)) ||
+         ExtensionFound(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME, deviceExtensionNames)) &&
+        ExtensionFound(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME, deviceExtensionNames) &&
+        ExtensionFound(VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME, deviceExtensionNames))
+    {
+        mFeatures.supportsExternalMemoryDmaBuf = true;
+    }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
 }
 
 void RendererVk::initPipelineCacheVkKey()
@@ -1422,6 +1466,9 @@ angle::Result RendererVk::submitFrame(vk::Context *context,
     // InterleavedAttributeDataBenchmark perf test for example issues a large number of flushes.
     ASSERT(mInFlightCommands.size() <= kInFlightCommandsLimit);
 
+    // Staging data written for this submission can be recycled once its serial completes.
+    mStagingBuffer.releaseRetainedBuffers(this);
+
     nextSerial();
 
     ANGLE_TRY(checkCompletedCommands(context));
@@ -1591,6 +1638,11 @@ Serial RendererVk::issueShaderSerial()
     return mShaderSerialFactory.generate();
 }
 
+Serial RendererVk::issueTextureSerial()
+{
+    return mTextureSerialFactory.generate();
+}
+
 angle::Result RendererVk::getDescriptorSetLayout(
     vk::Context *context,
     const vk::DescriptorSetLayoutDesc &desc,
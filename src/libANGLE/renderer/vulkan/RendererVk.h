@@ -155,6 +155,10 @@ class RendererVk : angle::NonCopyable
 
     vk::DynamicSemaphorePool *getDynamicSemaphorePool() { return &mSubmitSemaphorePool; }
 
+    // A host-visible ring used to stage uploads to device buffers.  Allocations made from it are
+    // valid until the next submission.
+    vk::DynamicBuffer *getStagingBuffer() { return &mStagingBuffer; }
+
     // Request a semaphore, that is expected to be signaled externally.  The next submission will
     // wait on it.
     angle::Result allocateSubmitWaitSemaphore(vk::Context *context,
@@ -170,6 +174,9 @@ class RendererVk : angle::NonCopyable
     // Issues a new serial for linked shader modules. Used in the pipeline cache.
     Serial issueShaderSerial();
 
+    // Issues a new serial for texture image views and samplers. Used in the descriptor set cache.
+    Serial issueTextureSerial();
+
     vk::ShaderLibrary &getShaderLibrary() { return mShaderLibrary; }
     UtilsVk &getUtils() { return mUtils; }
     const angle::FeaturesVk &getFeatures() const
@@ -270,6 +277,7 @@ class RendererVk : angle::NonCopyable
     vk::CommandPool mCommandPool;
     SerialFactory mQueueSerialFactory;
     SerialFactory mShaderSerialFactory;
+    SerialFactory mTextureSerialFactory;
     Serial mLastCompletedQueueSerial;
     Serial mLastSubmittedQueueSerial;
     Serial mCurrentQueueSerial;
@@ -324,6 +332,9 @@ class RendererVk : angle::NonCopyable
     // A pool of semaphores used to support the aforementioned mid-frame submissions.
     vk::DynamicSemaphorePool mSubmitSemaphorePool;
 
+    // Shared staging ring for buffer uploads.  See getStagingBuffer().
+    vk::DynamicBuffer mStagingBuffer;
+
     // See CommandGraph.h for a desription of the Command Graph.
     vk::CommandGraph mCommandGraph;
 
@@ -10,12 +10,36 @@
 #include "libANGLE/renderer/vulkan/ShaderVk.h"
 
 #include "common/debug.h"
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/Compiler.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "platform/FeaturesVk.h"
 
 namespace rx
 {
+namespace
+{
+void WriteSPIRV(gl::BinaryOutputStream *stream, const std::vector<uint32_t> &spirv)
+{
+    stream->writeInt(spirv.size());
+    for (uint32_t word : spirv)
+    {
+        // The words are written with their bits unchanged.
+        stream->writeInt(static_cast<int>(word));
+    }
+}
+
+void LoadSPIRV(gl::BinaryInputStream *stream, std::vector<uint32_t> *spirv)
+{
+    spirv->clear();
+    size_t wordCount = stream->readInt<size_t>();
+    for (size_t wordIndex = 0; wordIndex < wordCount && !stream->error(); ++wordIndex)
+    {
+        spirv->push_back(stream->readInt<uint32_t>());
+    }
+}
+}  // anonymous namespace
 
 ShaderVk::ShaderVk(const gl::ShaderState &data) : ShaderImpl(data) {}
 
@@ -36,15 +60,43 @@ ShCompileOptions ShaderVk::prepareSourceAndReturnOptions(const gl::Context *cont
         compileOptions |= SH_CLAMP_POINT_SIZE;
     }
 
+    mSPIRV.clear();
+    mLineRasterSPIRV.clear();
+    if (contextVk->getFeatures().directSPIRVGeneration)
+    {
+        compileOptions |= SH_GENERATE_SPIRV;
+    }
+
     return compileOptions;
 }
 
 bool ShaderVk::postTranslateCompile(gl::ShCompilerInstance *compiler, std::string *infoLog)
 {
-    // No work to do here.
+    // Keep the SPIR-V generated by the translator, if any.  Its interface is assigned at link time.
+    const std::vector<uint32_t> *spirv           = sh::GetSPIRVCode(compiler->getHandle(), false);
+    const std::vector<uint32_t> *lineRasterSPIRV = sh::GetSPIRVCode(compiler->getHandle(), true);
+    if (spirv != nullptr && lineRasterSPIRV != nullptr)
+    {
+        mSPIRV           = *spirv;
+        mLineRasterSPIRV = *lineRasterSPIRV;
+    }
+
     return true;
 }
 
+void ShaderVk::save(gl::BinaryOutputStream *stream) const
+{
+    WriteSPIRV(stream, mSPIRV);
+    WriteSPIRV(stream, mLineRasterSPIRV);
+}
+
+bool ShaderVk::load(gl::BinaryInputStream *stream, std::string *infoLog)
+{
+    LoadSPIRV(stream, &mSPIRV);
+    LoadSPIRV(stream, &mLineRasterSPIRV);
+    return !stream->error();
+}
+
 std::string ShaderVk::getDebugInfo() const
 {
     return mData.getTranslatedSource();
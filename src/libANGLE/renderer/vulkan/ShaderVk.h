@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_SHADERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_SHADERVK_H_
 
+#include <vector>
+
 #include "libANGLE/renderer/ShaderImpl.h"
 
 namespace rx
@@ -27,8 +29,21 @@ class ShaderVk : public ShaderImpl
                                                    std::string *sourcePath) override;
     // Returns success for compiling on the driver. Returns success.
     bool postTranslateCompile(gl::ShCompilerInstance *compiler, std::string *infoLog) override;
+    void save(gl::BinaryOutputStream *stream) const override;
+    bool load(gl::BinaryInputStream *stream, std::string *infoLog) override;
 
     std::string getDebugInfo() const override;
+
+    // The SPIR-V generated by the translator when the directSPIRVGeneration feature is enabled,
+    // with or without line raster emulation.  Empty if the shader must be compiled with glslang.
+    const std::vector<uint32_t> &getSPIRV(bool lineRasterEmulation) const
+    {
+        return lineRasterEmulation ? mLineRasterSPIRV : mSPIRV;
+    }
+
+  private:
+    std::vector<uint32_t> mSPIRV;
+    std::vector<uint32_t> mLineRasterSPIRV;
 };
 
 }  // namespace rx
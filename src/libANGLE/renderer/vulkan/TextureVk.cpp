@@ -973,6 +973,10 @@ angle::Result TextureVk::syncState(const gl::Context *context,
     samplerInfo.unnormalizedCoordinates = VK_FALSE;
 
     ANGLE_VK_TRY(contextVk, mSampler.init(contextVk->getDevice(), samplerInfo));
+
+    // Regenerate the serial on a sampler change.
+    mSerial = renderer->issueTextureSerial();
+
     return angle::Result::Continue;
 }
 
@@ -1108,6 +1112,9 @@ angle::Result TextureVk::initImageViews(ContextVk *contextVk,
                                          gl::SwizzleState(), &mDrawBaseLevelImageView, baseLevel, 1,
                                          baseLayer, layerCount));
 
+    // Regenerate the serial on a view change.
+    mSerial = contextVk->getRenderer()->issueTextureSerial();
+
     return angle::Result::Continue;
 }
 
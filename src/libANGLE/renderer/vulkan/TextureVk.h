@@ -148,6 +148,10 @@ class TextureVk : public TextureImpl
                                              vk::ImageView **imageViewOut);
     const vk::Sampler &getSampler() const;
 
+    // Changes whenever the read image views or the sampler are recreated, so cached texture
+    // descriptor sets can be matched against the currently bound textures.
+    Serial getSerial() const { return mSerial; }
+
     angle::Result ensureImageInitialized(ContextVk *contextVk);
 
   private:
@@ -258,6 +262,9 @@ class TextureVk : public TextureImpl
     std::vector<std::vector<vk::ImageView>> mLayerLevelDrawImageViews;
     vk::Sampler mSampler;
 
+    // Identifies the current combination of read image view and sampler.
+    Serial mSerial;
+
     RenderTargetVk mRenderTarget;
     std::vector<RenderTargetVk> mCubeMapRenderTargets;
 };
@@ -9,7 +9,12 @@
 
 #include "libANGLE/renderer/vulkan/TransformFeedbackVk.h"
 
-#include "common/debug.h"
+#include "libANGLE/Buffer.h"
+#include "libANGLE/Program.h"
+#include "libANGLE/TransformFeedback.h"
+#include "libANGLE/renderer/vulkan/BufferVk.h"
+#include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/FramebufferVk.h"
 
 namespace rx
 {
@@ -23,33 +28,33 @@ TransformFeedbackVk::~TransformFeedbackVk() {}
 angle::Result TransformFeedbackVk::begin(const gl::Context *context,
                                          gl::PrimitiveMode primitiveMode)
 {
-    UNIMPLEMENTED();
-    return angle::Result::Stop;
+    vk::GetImpl(context)->onTransformFeedbackStateChanged();
+    return angle::Result::Continue;
 }
 
 angle::Result TransformFeedbackVk::end(const gl::Context *context)
 {
-    UNIMPLEMENTED();
-    return angle::Result::Stop;
+    vk::GetImpl(context)->onTransformFeedbackStateChanged();
+    return angle::Result::Continue;
 }
 
 angle::Result TransformFeedbackVk::pause(const gl::Context *context)
 {
-    UNIMPLEMENTED();
-    return angle::Result::Stop;
+    vk::GetImpl(context)->onTransformFeedbackStateChanged();
+    return angle::Result::Continue;
 }
 
 angle::Result TransformFeedbackVk::resume(const gl::Context *context)
 {
-    UNIMPLEMENTED();
-    return angle::Result::Stop;
+    vk::GetImpl(context)->onTransformFeedbackStateChanged();
+    return angle::Result::Continue;
 }
 
 angle::Result TransformFeedbackVk::bindGenericBuffer(const gl::Context *context,
                                                      const gl::BindingPointer<gl::Buffer> &binding)
 {
-    UNIMPLEMENTED();
-    return angle::Result::Stop;
+    // The generic binding point is not used for capture.
+    return angle::Result::Continue;
 }
 
 angle::Result TransformFeedbackVk::bindIndexedBuffer(
@@ -57,8 +62,87 @@ angle::Result TransformFeedbackVk::bindIndexedBuffer(
     size_t index,
     const gl::OffsetBindingPointer<gl::Buffer> &binding)
 {
-    UNIMPLEMENTED();
-    return angle::Result::Stop;
+    // The bound buffers are only looked up when a draw call captures vertices.
+    vk::GetImpl(context)->onTransformFeedbackStateChanged();
+    return angle::Result::Continue;
+}
+
+size_t TransformFeedbackVk::getBufferCount(const gl::ProgramState &programState) const
+{
+    size_t varyingCount = programState.getLinkedTransformFeedbackVaryings().size();
+    if (programState.getTransformFeedbackBufferMode() == GL_INTERLEAVED_ATTRIBS)
+    {
+        return std::min<size_t>(varyingCount, 1);
+    }
+    return varyingCount;
+}
+
+void TransformFeedbackVk::getBufferOffsets(const gl::ProgramState &programState,
+                                           GLint drawCallFirstVertex,
+                                           int32_t *offsetsOut,
+                                           size_t offsetsSize) const
+{
+    const std::vector<GLsizei> &bufferStrides = programState.getTransformFeedbackStrides();
+    size_t bufferCount                        = getBufferCount(programState);
+    ASSERT(bufferCount <= offsetsSize);
+
+    // The vertex shader indexes the buffers with gl_VertexIndex, which includes the first vertex
+    // of the draw call.  Fold the vertices already captured and the binding offset into the base
+    // offset, in units of the uint array the buffers are declared with.
+    GLsizeiptr verticesDrawn = mState.getVerticesDrawn();
+
+    for (size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex)
+    {
+        const gl::OffsetBindingPointer<gl::Buffer> &bufferBinding =
+            mState.getIndexedBuffer(bufferIndex);
+
+        GLsizeiptr strideWords = bufferStrides[bufferIndex] / sizeof(uint32_t);
+        GLsizeiptr offsetWords = bufferBinding.getOffset() / sizeof(uint32_t) +
+                                 (verticesDrawn - drawCallFirstVertex) * strideWords;
+
+        offsetsOut[bufferIndex] = static_cast<int32_t>(offsetWords);
+    }
+}
+
+void TransformFeedbackVk::getDescriptorBufferInfos(const gl::ProgramState &programState,
+                                                   VkDescriptorBufferInfo *bufferInfosOut,
+                                                   size_t bufferInfosSize) const
+{
+    size_t bufferCount = getBufferCount(programState);
+    ASSERT(bufferCount <= bufferInfosSize);
+
+    for (size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex)
+    {
+        const gl::OffsetBindingPointer<gl::Buffer> &bufferBinding =
+            mState.getIndexedBuffer(bufferIndex);
+        ASSERT(bufferBinding.get());
+
+        // The binding offset is applied in the shader, as it's not necessarily aligned to
+        // minStorageBufferOffsetAlignment.
+        BufferVk *bufferVk                 = vk::GetImpl(bufferBinding.get());
+        VkDescriptorBufferInfo &bufferInfo = bufferInfosOut[bufferIndex];
+        bufferInfo.buffer                  = bufferVk->getBuffer().getBuffer().getHandle();
+        bufferInfo.offset                  = 0;
+        bufferInfo.range                   = VK_WHOLE_SIZE;
+    }
+}
+
+void TransformFeedbackVk::addFramebufferDependency(const gl::ProgramState &programState,
+                                                   FramebufferVk *framebufferVk) const
+{
+    size_t bufferCount = getBufferCount(programState);
+
+    // The buffers are written to by the render pass of the draw framebuffer.
+    for (size_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex)
+    {
+        const gl::OffsetBindingPointer<gl::Buffer> &bufferBinding =
+            mState.getIndexedBuffer(bufferIndex);
+        ASSERT(bufferBinding.get());
+
+        vk::BufferHelper &bufferHelper = vk::GetImpl(bufferBinding.get())->getBuffer();
+        bufferHelper.addWriteDependency(framebufferVk);
+        bufferHelper.onWrite(VK_ACCESS_SHADER_WRITE_BIT);
+    }
 }
 
 }  // namespace rx
@@ -11,9 +11,16 @@
 #define LIBANGLE_RENDERER_VULKAN_TRANSFORMFEEDBACKVK_H_
 
 #include "libANGLE/renderer/TransformFeedbackImpl.h"
+#include "libANGLE/renderer/vulkan/vk_utils.h"
+
+namespace gl
+{
+class ProgramState;
+}  // namespace gl
 
 namespace rx
 {
+class FramebufferVk;
 
 class TransformFeedbackVk : public TransformFeedbackImpl
 {
@@ -31,6 +38,20 @@ class TransformFeedbackVk : public TransformFeedbackImpl
     angle::Result bindIndexedBuffer(const gl::Context *context,
                                     size_t index,
                                     const gl::OffsetBindingPointer<gl::Buffer> &binding) override;
+
+    // Transform feedback is emulated by having the vertex shader write the captured varyings to
+    // storage buffers.  The following are used to set up the driver uniforms and descriptors used
+    // by the vertex shader for a draw call.
+    size_t getBufferCount(const gl::ProgramState &programState) const;
+    void getBufferOffsets(const gl::ProgramState &programState,
+                          GLint drawCallFirstVertex,
+                          int32_t *offsetsOut,
+                          size_t offsetsSize) const;
+    void getDescriptorBufferInfos(const gl::ProgramState &programState,
+                                  VkDescriptorBufferInfo *bufferInfosOut,
+                                  size_t bufferInfosSize) const;
+    void addFramebufferDependency(const gl::ProgramState &programState,
+                                  FramebufferVk *framebufferVk) const;
 };
 
 }  // namespace rx
@@ -677,8 +677,6 @@ angle::Result VertexArrayVk::updateIndexTranslation(ContextVk *contextVk,
         // http://anglebug.com/3003
 
         TRACE_EVENT0("gpu.angle", "VertexArrayVk::updateIndexTranslation");
-        // Needed before reading buffer or we could get stale data.
-        ANGLE_TRY(renderer->finish(contextVk));
 
         ASSERT(type == gl::DrawElementsType::UnsignedByte);
         // Unsigned bytes don't have direct support in Vulkan so we have to expand the
@@ -686,7 +684,7 @@ angle::Result VertexArrayVk::updateIndexTranslation(ContextVk *contextVk,
         BufferVk *bufferVk   = vk::GetImpl(glBuffer);
         void *srcDataMapping = nullptr;
         ASSERT(!glBuffer->isMapped());
-        ANGLE_TRY(bufferVk->mapImpl(contextVk, &srcDataMapping));
+        ANGLE_TRY(bufferVk->mapForReadAccess(contextVk, &srcDataMapping));
         uint8_t *srcData           = static_cast<uint8_t *>(srcDataMapping);
         intptr_t offsetIntoSrcData = reinterpret_cast<intptr_t>(indices);
         srcData += offsetIntoSrcData;
@@ -0,0 +1,306 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DmaBufImageSiblingVkLinux.cpp:
+//    Implements the DmaBufImageSiblingVkLinux class.  Single-plane linear dma-bufs are aliased by a
+//    linear VkImage bound to the imported memory, so that sampling and rendering happen in place
+//    without a copy.  Multi-planar YUV dma-bufs are not supported.
+//
+//    The X channel of XRGB8888 and XBGR8888 is stored in the alpha channel of the emulating
+//    BGRA8 and RGBA8 images, and holds whatever the producer left there.  Sampling forces it to
+//    one through the image view swizzle and readPixels overwrites it, but blits into a
+//    destination with alpha copy it as is.
+//
+
+#include "libANGLE/renderer/vulkan/linux/DmaBufImageSiblingVkLinux.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/mathutil.h"
+#include "libANGLE/Display.h"
+#include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/vulkan/DisplayVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+
+namespace rx
+{
+namespace
+{
+constexpr uint32_t FourCC(char a, char b, char c, char d)
+{
+    return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) |
+           (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+}
+
+struct DmaBufFormat
+{
+    uint32_t fourcc;
+    GLenum internalFormat;
+    uint32_t pixelBytes;
+};
+
+// The DRM formats, from drm_fourcc.h, that have a single plane and an equivalent GL format.  DRM
+// formats are named by their little-endian packed layout, so ARGB8888 is BGRA in memory.
+constexpr DmaBufFormat kDmaBufFormats[] = {
+    {FourCC('R', '8', ' ', ' '), GL_R8, 1},            // DRM_FORMAT_R8
+    {FourCC('G', 'R', '8', '8'), GL_RG8, 2},           // DRM_FORMAT_GR88
+    {FourCC('R', 'G', '1', '6'), GL_RGB565, 2},        // DRM_FORMAT_RGB565
+    {FourCC('A', 'R', '2', '4'), GL_BGRA8_EXT, 4},     // DRM_FORMAT_ARGB8888
+    {FourCC('X', 'R', '2', '4'), GL_BGRX8_ANGLEX, 4},  // DRM_FORMAT_XRGB8888
+    {FourCC('A', 'B', '2', '4'), GL_RGBA8, 4},         // DRM_FORMAT_ABGR8888
+    {FourCC('X', 'B', '2', '4'), GL_RGB8, 4},          // DRM_FORMAT_XBGR8888
+};
+
+const DmaBufFormat *FindDmaBufFormat(uint32_t fourcc)
+{
+    for (const DmaBufFormat &format : kDmaBufFormats)
+    {
+        if (format.fourcc == fourcc)
+        {
+            return &format;
+        }
+    }
+    return nullptr;
+}
+
+VkFormatFeatureFlags GetLinearTilingFeatures(RendererVk *renderer, VkFormat format)
+{
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(renderer->getPhysicalDevice(), format, &formatProperties);
+    return formatProperties.linearTilingFeatures;
+}
+
+// Returns the size of the dma-buf, or -1 on failure.  The file offset is shared by every
+// descriptor duplicated from the application's, so it is left untouched.
+off_t GetDmaBufSize(int fd)
+{
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        return fileStat.st_size;
+    }
+
+    // Older kernels don't report the size of a dma-buf through fstat, but support seeking to its
+    // end.
+    off_t offset = lseek(fd, 0, SEEK_CUR);
+    if (offset < 0)
+    {
+        return -1;
+    }
+    off_t size = lseek(fd, 0, SEEK_END);
+    lseek(fd, offset, SEEK_SET);
+    return size;
+}
+}  // anonymous namespace
+
+DmaBufImageSiblingVkLinux::DmaBufImageSiblingVkLinux(const egl::AttributeMap &attribs)
+    : mSize(attribs.getAsInt(EGL_WIDTH), attribs.getAsInt(EGL_HEIGHT), 1),
+      mInternalFormat(GL_NONE),
+      mFd(attribs.getAsInt(EGL_DMA_BUF_PLANE0_FD_EXT)),
+      mOffset(static_cast<VkDeviceSize>(attribs.getAsInt(EGL_DMA_BUF_PLANE0_OFFSET_EXT))),
+      mPitch(static_cast<VkDeviceSize>(attribs.getAsInt(EGL_DMA_BUF_PLANE0_PITCH_EXT))),
+      mRenderable(false),
+      mImage(nullptr)
+{
+    const DmaBufFormat *format =
+        FindDmaBufFormat(static_cast<uint32_t>(attribs.getAsInt(EGL_LINUX_DRM_FOURCC_EXT)));
+    ASSERT(format != nullptr);
+    mInternalFormat = format->internalFormat;
+}
+
+DmaBufImageSiblingVkLinux::~DmaBufImageSiblingVkLinux()
+{
+    ASSERT(mImage == nullptr);
+}
+
+// static
+egl::Error DmaBufImageSiblingVkLinux::ValidateBuffer(RendererVk *renderer,
+                                                     const egl::AttributeMap &attribs)
+{
+    const DmaBufFormat *format =
+        FindDmaBufFormat(static_cast<uint32_t>(attribs.getAsInt(EGL_LINUX_DRM_FOURCC_EXT)));
+    if (format == nullptr)
+    {
+        return egl::EglBadMatch() << "Unsupported EGL_LINUX_DRM_FOURCC_EXT format.";
+    }
+
+    // Every supported format has a single plane.  Multi-planar YUV formats such as NV12 are
+    // rejected above: sampling them would need VK_KHR_sampler_ycbcr_conversion, and aliasing each
+    // plane would need a disjoint image, neither of which the back-end supports.
+    constexpr EGLAttrib kExtraPlaneAttributes[] = {
+        EGL_DMA_BUF_PLANE1_FD_EXT, EGL_DMA_BUF_PLANE1_OFFSET_EXT, EGL_DMA_BUF_PLANE1_PITCH_EXT,
+        EGL_DMA_BUF_PLANE2_FD_EXT, EGL_DMA_BUF_PLANE2_OFFSET_EXT, EGL_DMA_BUF_PLANE2_PITCH_EXT,
+    };
+    for (EGLAttrib attribute : kExtraPlaneAttributes)
+    {
+        if (attribs.contains(attribute))
+        {
+            return egl::EglBadAttribute() << "Too many planes for a single-plane format.";
+        }
+    }
+
+    if (attribs.getAsInt(EGL_DMA_BUF_PLANE0_FD_EXT) < 0)
+    {
+        return egl::EglBadParameter() << "Invalid dma-buf file descriptor.";
+    }
+
+    EGLint width  = attribs.getAsInt(EGL_WIDTH);
+    EGLint offset = attribs.getAsInt(EGL_DMA_BUF_PLANE0_OFFSET_EXT);
+    EGLint pitch  = attribs.getAsInt(EGL_DMA_BUF_PLANE0_PITCH_EXT);
+    if (offset < 0 || pitch < 0 ||
+        static_cast<uint64_t>(pitch) < static_cast<uint64_t>(width) * format->pixelBytes ||
+        pitch % format->pixelBytes != 0)
+    {
+        return egl::EglBadAccess() << "Invalid dma-buf plane offset or pitch.";
+    }
+
+    // The image aliases the dma-buf, so the Vulkan format can't be an emulation with a different
+    // pixel size, and it must be usable with linear tiling.
+    const vk::Format &vkFormat = renderer->getFormat(format->internalFormat);
+    if (vkFormat.textureFormat().pixelBytes != format->pixelBytes ||
+        (GetLinearTilingFeatures(renderer, vkFormat.vkTextureFormat) &
+         VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) == 0)
+    {
+        return egl::EglBadMatch() << "The dma-buf format is not supported by the device.";
+    }
+
+    // Formats with an ignored X channel rely on the swizzle that MapSwizzleState sets up for
+    // formats whose alpha is emulated.
+    ASSERT(gl::GetSizedInternalFormatInfo(format->internalFormat).alphaBits > 0 ||
+           vkFormat.angleFormat().alphaBits == 0);
+
+    return egl::NoError();
+}
+
+egl::Error DmaBufImageSiblingVkLinux::initialize(const egl::Display *display)
+{
+    DisplayVk *displayVk = vk::GetImpl(display);
+    return angle::ToEGL(initImpl(displayVk), displayVk, EGL_BAD_ACCESS);
+}
+
+angle::Result DmaBufImageSiblingVkLinux::initImpl(DisplayVk *displayVk)
+{
+    RendererVk *renderer = displayVk->getRenderer();
+    VkDevice device      = renderer->getDevice();
+
+    const vk::Format &vkFormat = renderer->getFormat(mInternalFormat);
+
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                              VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    mRenderable = (GetLinearTilingFeatures(renderer, vkFormat.vkTextureFormat) &
+                   VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT) != 0;
+    if (mRenderable)
+    {
+        usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    }
+
+    VkExternalMemoryImageCreateInfo externalMemoryImageCreateInfo = {};
+    externalMemoryImageCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+    externalMemoryImageCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+    // The contents of the dma-buf are preserved by starting out in the preinitialized layout,
+    // which is only meaningful with linear tiling.
+    mImage = new vk::ImageHelper();
+    ANGLE_TRY(mImage->initExternal(displayVk, gl::TextureType::_2D, mSize, vkFormat, 1, usage,
+                                   VK_IMAGE_TILING_LINEAR, vk::ImageLayout::PreInitialized,
+                                   &externalMemoryImageCreateInfo, 1, 1));
+
+    // The row pitch of a linear image is chosen by the driver.  The image can only alias the
+    // dma-buf if it picked the buffer's pitch.
+    VkSubresourceLayout subresourceLayout;
+    mImage->getImage().getSubresourceLayout(device, VK_IMAGE_ASPECT_COLOR_BIT, 0, 0,
+                                            &subresourceLayout);
+    ANGLE_VK_CHECK(displayVk, subresourceLayout.rowPitch == mPitch, VK_ERROR_FORMAT_NOT_SUPPORTED);
+
+    VkMemoryRequirements memoryRequirements;
+    mImage->getImage().getMemoryRequirements(device, &memoryRequirements);
+    ANGLE_VK_CHECK(displayVk, mOffset % memoryRequirements.alignment == 0,
+                   VK_ERROR_INVALID_EXTERNAL_HANDLE);
+
+    // A successful import takes ownership of the file descriptor, while the application keeps
+    // ownership of the one it passed in.
+    int fd = dup(mFd);
+    ANGLE_VK_CHECK(displayVk, fd >= 0, VK_ERROR_INVALID_EXTERNAL_HANDLE);
+
+    off_t bufferSize = GetDmaBufSize(fd);
+
+    VkMemoryFdPropertiesKHR memoryFdProperties = {};
+    memoryFdProperties.sType                   = VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR;
+    VkResult result = vkGetMemoryFdPropertiesKHR(
+        device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT, fd, &memoryFdProperties);
+
+    uint32_t memoryTypeBits = memoryRequirements.memoryTypeBits & memoryFdProperties.memoryTypeBits;
+    if (result == VK_SUCCESS &&
+        (bufferSize < 0 || memoryTypeBits == 0 ||
+         static_cast<VkDeviceSize>(bufferSize) < mOffset + memoryRequirements.size))
+    {
+        result = VK_ERROR_INVALID_EXTERNAL_HANDLE;
+    }
+    if (result != VK_SUCCESS)
+    {
+        close(fd);
+        ANGLE_VK_TRY(displayVk, result);
+    }
+
+    VkImportMemoryFdInfoKHR importMemoryFdInfo = {};
+    importMemoryFdInfo.sType                   = VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR;
+    importMemoryFdInfo.handleType              = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+    importMemoryFdInfo.fd                      = fd;
+
+    angle::Result importResult = mImage->initExternalMemory(
+        displayVk, &importMemoryFdInfo, static_cast<uint32_t>(gl::ScanForward(memoryTypeBits)),
+        static_cast<VkDeviceSize>(bufferSize), mOffset);
+    if (importResult != angle::Result::Continue && !mImage->getDeviceMemory().valid())
+    {
+        // The allocation failed, so the descriptor is still ours.
+        close(fd);
+    }
+
+    return importResult;
+}
+
+void DmaBufImageSiblingVkLinux::onDestroy(const egl::Display *display)
+{
+    if (mImage != nullptr)
+    {
+        RendererVk *renderer = vk::GetImpl(display)->getRenderer();
+        mImage->releaseImage(renderer);
+        mImage->releaseStagingBuffer(renderer);
+        SafeDelete(mImage);
+    }
+}
+
+gl::Format DmaBufImageSiblingVkLinux::getFormat() const
+{
+    return gl::Format(mInternalFormat);
+}
+
+bool DmaBufImageSiblingVkLinux::isRenderable(const gl::Context *context) const
+{
+    return mRenderable;
+}
+
+bool DmaBufImageSiblingVkLinux::isTexturable(const gl::Context *context) const
+{
+    return true;
+}
+
+gl::Extents DmaBufImageSiblingVkLinux::getSize() const
+{
+    return mSize;
+}
+
+size_t DmaBufImageSiblingVkLinux::getSamples() const
+{
+    return 0;
+}
+
+vk::ImageHelper *DmaBufImageSiblingVkLinux::getImage() const
+{
+    return mImage;
+}
+
+}  // namespace rx
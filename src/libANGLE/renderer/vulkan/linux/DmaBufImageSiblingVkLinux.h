@@ -0,0 +1,58 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DmaBufImageSiblingVkLinux.h:
+//    Defines the DmaBufImageSiblingVkLinux class to wrap EGL images created from Linux dma-bufs
+//    with EGL_EXT_image_dma_buf_import.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_LINUX_DMABUFIMAGESIBLINGVKLINUX_H_
+#define LIBANGLE_RENDERER_VULKAN_LINUX_DMABUFIMAGESIBLINGVKLINUX_H_
+
+#include "libANGLE/AttributeMap.h"
+#include "libANGLE/renderer/vulkan/ImageVk.h"
+
+namespace rx
+{
+class DisplayVk;
+class RendererVk;
+
+class DmaBufImageSiblingVkLinux : public ExternalImageSiblingVk
+{
+  public:
+    DmaBufImageSiblingVkLinux(const egl::AttributeMap &attribs);
+    ~DmaBufImageSiblingVkLinux() override;
+
+    static egl::Error ValidateBuffer(RendererVk *renderer, const egl::AttributeMap &attribs);
+
+    egl::Error initialize(const egl::Display *display) override;
+    void onDestroy(const egl::Display *display) override;
+
+    // ExternalImageSiblingImpl interface
+    gl::Format getFormat() const override;
+    bool isRenderable(const gl::Context *context) const override;
+    bool isTexturable(const gl::Context *context) const override;
+    gl::Extents getSize() const override;
+    size_t getSamples() const override;
+
+    // ExternalImageSiblingVk interface
+    vk::ImageHelper *getImage() const override;
+
+  private:
+    angle::Result initImpl(DisplayVk *displayVk);
+
+    gl::Extents mSize;
+    GLenum mInternalFormat;
+    int mFd;
+    VkDeviceSize mOffset;
+    VkDeviceSize mPitch;
+
+    bool mRenderable;
+    vk::ImageHelper *mImage;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_LINUX_DMABUFIMAGESIBLINGVKLINUX_H_
@@ -965,6 +965,14 @@ void GraphicsPipelineDesc::updateStencilBackWriteMask(
     transition->set(ANGLE_GET_TRANSITION_BIT(mDepthStencilStateInfo, back));
 }
 
+void GraphicsPipelineDesc::updateRasterizerDiscardEnabled(
+    GraphicsPipelineTransitionBits *transition,
+    bool enabled)
+{
+    mRasterizationAndMultisampleStateInfo.bits.rasterizationDiscardEnable = enabled;
+    transition->set(ANGLE_GET_TRANSITION_BIT(mRasterizationAndMultisampleStateInfo, bits));
+}
+
 void GraphicsPipelineDesc::updatePolygonOffsetFillEnabled(
     GraphicsPipelineTransitionBits *transition,
     bool enabled)
@@ -1201,6 +1209,45 @@ const PushConstantRangeArray<PackedPushConstantRange> &PipelineLayoutDesc::getPu
     return mPushConstantRanges;
 }
 
+// TextureDescriptorDesc implementation.
+TextureDescriptorDesc::TextureDescriptorDesc() : mMaxIndex(0)
+{
+    mSerials.fill(Serial());
+}
+
+TextureDescriptorDesc::~TextureDescriptorDesc() = default;
+
+TextureDescriptorDesc::TextureDescriptorDesc(const TextureDescriptorDesc &other) = default;
+
+TextureDescriptorDesc &TextureDescriptorDesc::operator=(const TextureDescriptorDesc &other) =
+    default;
+
+void TextureDescriptorDesc::update(size_t index, Serial serial)
+{
+    if (index >= mMaxIndex)
+    {
+        mMaxIndex = static_cast<uint32_t>(index + 1);
+    }
+
+    mSerials[index] = serial;
+}
+
+size_t TextureDescriptorDesc::hash() const
+{
+    return angle::ComputeGenericHash(mSerials.data(), sizeof(Serial) * mMaxIndex);
+}
+
+bool TextureDescriptorDesc::operator==(const TextureDescriptorDesc &other) const
+{
+    if (mMaxIndex != other.mMaxIndex)
+        return false;
+
+    if (mMaxIndex == 0)
+        return true;
+
+    return memcmp(mSerials.data(), other.mSerials.data(), sizeof(Serial) * mMaxIndex) == 0;
+}
+
 // PipelineHelper implementation.
 PipelineHelper::PipelineHelper() = default;
 
@@ -396,6 +396,9 @@ class GraphicsPipelineDesc final
                                     const gl::DepthStencilState &depthStencilState,
                                     const gl::Framebuffer *drawFramebuffer);
 
+    // Rasterizer discard.
+    void updateRasterizerDiscardEnabled(GraphicsPipelineTransitionBits *transition, bool enabled);
+
     // Depth offset.
     void updatePolygonOffsetFillEnabled(GraphicsPipelineTransitionBits *transition, bool enabled);
     void updatePolygonOffset(GraphicsPipelineTransitionBits *transition,
@@ -518,6 +521,28 @@ static_assert(sizeof(PipelineLayoutDesc) ==
                    sizeof(std::array<PackedPushConstantRange, kMaxPushConstantRanges>)),
               "Unexpected Size");
 
+// A packed description of the textures bound to a program's texture descriptor set. Each entry
+// is the serial of a TextureVk, which changes whenever its image views or sampler are recreated.
+// Used to find previously written texture descriptor sets in ProgramVk.
+class TextureDescriptorDesc final
+{
+  public:
+    TextureDescriptorDesc();
+    ~TextureDescriptorDesc();
+    TextureDescriptorDesc(const TextureDescriptorDesc &other);
+    TextureDescriptorDesc &operator=(const TextureDescriptorDesc &other);
+
+    void update(size_t index, Serial serial);
+    size_t hash() const;
+
+    bool operator==(const TextureDescriptorDesc &other) const;
+
+  private:
+    // Exclusive: one past the highest index that was updated.
+    uint32_t mMaxIndex;
+    gl::ActiveTextureArray<Serial> mSerials;
+};
+
 // Disable warnings about struct padding.
 ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
 
@@ -654,6 +679,12 @@ struct hash<rx::vk::PipelineLayoutDesc>
 {
     size_t operator()(const rx::vk::PipelineLayoutDesc &key) const { return key.hash(); }
 };
+
+template <>
+struct hash<rx::vk::TextureDescriptorDesc>
+{
+    size_t operator()(const rx::vk::TextureDescriptorDesc &key) const { return key.hash(); }
+};
 }  // namespace std
 
 namespace rx
@@ -798,6 +829,9 @@ constexpr uint32_t kFragmentUniformsBindingIndex     = 1;
 constexpr uint32_t kUniformsDescriptorSetIndex       = 0;
 constexpr uint32_t kTextureDescriptorSetIndex        = 1;
 constexpr uint32_t kDriverUniformsDescriptorSetIndex = 2;
+// Transform feedback buffers are bound after the driver uniforms in their descriptor set.
+constexpr uint32_t kDriverUniformsBindingIndex = 0;
+constexpr uint32_t kXfbBindingIndexStart       = 1;
 
 }  // namespace rx
 
@@ -192,6 +192,17 @@ void RendererVk::ensureCapsInitialized() const
     mNativeCaps.maxVaryingVectors =
         (mPhysicalDeviceProperties.limits.maxVertexOutputComponents / 4) - kReservedVaryingCount;
     mNativeCaps.maxVertexOutputComponents = mNativeCaps.maxVaryingVectors * 4;
+
+    // Transform feedback is emulated with storage buffer writes from the vertex shader.
+    if (mFeatures.emulateTransformFeedback &&
+        mPhysicalDeviceFeatures.vertexPipelineStoresAndAtomics)
+    {
+        mNativeCaps.maxTransformFeedbackInterleavedComponents =
+            static_cast<GLuint>(mNativeCaps.maxVertexOutputComponents);
+        mNativeCaps.maxTransformFeedbackSeparateAttributes =
+            gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS;
+        mNativeCaps.maxTransformFeedbackSeparateComponents = 4;
+    }
 }
 
 namespace egl_vk
@@ -31,6 +31,10 @@ constexpr int kLineLoopDynamicBufferMinSize = 1024 * 1024;
 // This is an arbitrary max. We can change this later if necessary.
 constexpr uint32_t kDefaultDescriptorPoolMaxSets = 128;
 
+// The number of released buffers a DynamicBuffer keeps for reuse. Enough for a few frames in
+// flight of a streaming buffer that rolls over several times per frame.
+constexpr size_t kMaxFreeBuffers = 16;
+
 struct ImageMemoryBarrierData
 {
     // The Vk layout corresponding to the ImageLayout key.
@@ -203,6 +207,35 @@ VkImageCreateFlags GetImageCreateFlags(gl::TextureType textureType)
         return 0;
     }
 }
+
+bool RangesOverlap(int32_t startA, uint32_t sizeA, int32_t startB, uint32_t sizeB)
+{
+    const int64_t endA = static_cast<int64_t>(startA) + sizeA;
+    const int64_t endB = static_cast<int64_t>(startB) + sizeB;
+    return startA < endB && startB < endA;
+}
+
+// Returns true if the two copies may write to the same texels of the destination image.
+bool BufferImageCopiesOverlap(const VkBufferImageCopy &a, const VkBufferImageCopy &b)
+{
+    const VkImageSubresourceLayers &subresourceA = a.imageSubresource;
+    const VkImageSubresourceLayers &subresourceB = b.imageSubresource;
+
+    if ((subresourceA.aspectMask & subresourceB.aspectMask) == 0 ||
+        subresourceA.mipLevel != subresourceB.mipLevel ||
+        !RangesOverlap(subresourceA.baseArrayLayer, subresourceA.layerCount,
+                       subresourceB.baseArrayLayer, subresourceB.layerCount))
+    {
+        return false;
+    }
+
+    return RangesOverlap(a.imageOffset.x, a.imageExtent.width, b.imageOffset.x,
+                         b.imageExtent.width) &&
+           RangesOverlap(a.imageOffset.y, a.imageExtent.height, b.imageOffset.y,
+                         b.imageExtent.height) &&
+           RangesOverlap(a.imageOffset.z, a.imageExtent.depth, b.imageOffset.z,
+                         b.imageExtent.depth);
+}
 }  // anonymous namespace
 
 // DynamicBuffer implementation.
@@ -226,7 +259,8 @@ DynamicBuffer::DynamicBuffer(DynamicBuffer &&other)
       mLastFlushOrInvalidateOffset(other.mLastFlushOrInvalidateOffset),
       mSize(other.mSize),
       mAlignment(other.mAlignment),
-      mRetainedBuffers(std::move(other.mRetainedBuffers))
+      mRetainedBuffers(std::move(other.mRetainedBuffers)),
+      mBufferFreeList(std::move(other.mBufferFreeList))
 {
     other.mBuffer = nullptr;
 }
@@ -276,22 +310,29 @@ angle::Result DynamicBuffer::allocate(Context *context,
 
         mSize = std::max(sizeToAllocate, mMinSize);
 
-        std::unique_ptr<BufferHelper> buffer = std::make_unique<BufferHelper>();
-
-        VkBufferCreateInfo createInfo    = {};
-        createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        createInfo.flags                 = 0;
-        createInfo.size                  = mSize;
-        createInfo.usage                 = mUsage;
-        createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-        createInfo.queueFamilyIndexCount = 0;
-        createInfo.pQueueFamilyIndices   = nullptr;
+        // Reuse the oldest released buffer if the GPU is done with it. Buffers that are too small
+        // for this allocation are dropped from the ring.
+        RendererVk *renderer = context->getRenderer();
+        while (!mBufferFreeList.empty() && !mBufferFreeList.front()->isResourceInUse(renderer))
+        {
+            BufferHelper *freeBuffer = mBufferFreeList.front();
+            mBufferFreeList.pop_front();
+
+            if (freeBuffer->getSize() >= mSize)
+            {
+                mSize   = static_cast<size_t>(freeBuffer->getSize());
+                mBuffer = freeBuffer;
+                break;
+            }
+
+            freeBuffer->release(renderer);
+            delete freeBuffer;
+        }
 
-        const VkMemoryPropertyFlags memoryProperty = mHostVisible
-                                                         ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
-                                                         : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-        ANGLE_TRY(buffer->init(context, createInfo, memoryProperty));
-        mBuffer = buffer.release();
+        if (!mBuffer)
+        {
+            ANGLE_TRY(allocateNewBuffer(context));
+        }
 
         mNextAllocationOffset        = 0;
         mLastFlushOrInvalidateOffset = 0;
@@ -327,6 +368,27 @@ angle::Result DynamicBuffer::allocate(Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result DynamicBuffer::allocateNewBuffer(Context *context)
+{
+    std::unique_ptr<BufferHelper> buffer = std::make_unique<BufferHelper>();
+
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = mSize;
+    createInfo.usage                 = mUsage;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+
+    const VkMemoryPropertyFlags memoryProperty =
+        mHostVisible ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    ANGLE_TRY(buffer->init(context, createInfo, memoryProperty));
+    mBuffer = buffer.release();
+
+    return angle::Result::Continue;
+}
+
 angle::Result DynamicBuffer::flush(Context *context)
 {
     if (mHostVisible && (mNextAllocationOffset > mLastFlushOrInvalidateOffset))
@@ -356,6 +418,14 @@ void DynamicBuffer::release(RendererVk *renderer)
     reset();
     releaseRetainedBuffers(renderer);
 
+    for (BufferHelper *toFree : mBufferFreeList)
+    {
+        toFree->release(renderer);
+        delete toFree;
+    }
+
+    mBufferFreeList.clear();
+
     if (mBuffer)
     {
         mBuffer->unmap(renderer->getDevice());
@@ -376,11 +446,19 @@ void DynamicBuffer::releaseRetainedBuffers(RendererVk *renderer)
     {
         // See note in release().
         toFree->updateQueueSerial(renderer->getCurrentQueueSerial());
-        toFree->release(renderer);
-        delete toFree;
+        mBufferFreeList.push_back(toFree);
     }
 
     mRetainedBuffers.clear();
+
+    // Drop the oldest buffers past the cap. They are destroyed once the GPU is done with them.
+    while (mBufferFreeList.size() > kMaxFreeBuffers)
+    {
+        BufferHelper *toFree = mBufferFreeList.front();
+        mBufferFreeList.pop_front();
+        toFree->release(renderer);
+        delete toFree;
+    }
 }
 
 void DynamicBuffer::destroy(VkDevice device)
@@ -395,6 +473,14 @@ void DynamicBuffer::destroy(VkDevice device)
 
     mRetainedBuffers.clear();
 
+    for (BufferHelper *toFree : mBufferFreeList)
+    {
+        toFree->destroy(device);
+        delete toFree;
+    }
+
+    mBufferFreeList.clear();
+
     if (mBuffer)
     {
         mBuffer->unmap(device);
@@ -948,14 +1034,44 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
                                                                   vk::BufferHelper **bufferOut,
                                                                   VkDeviceSize *bufferOffsetOut)
 {
+    RendererVk *renderer = contextVk->getRenderer();
+
+    if (glIndexType == gl::DrawElementsType::UnsignedByte &&
+        renderer->getFormat(angle::FormatID::R16_UINT).vkSupportsStorageBuffer)
+    {
+        // Expand the ubyte indices to ushort with a compute shader, appending the first index to
+        // close the loop.  This avoids reading the element array buffer back on the CPU.
+        mDynamicIndexBuffer.releaseRetainedBuffers(renderer);
+        ANGLE_TRY(mDynamicIndexBuffer.allocate(contextVk, sizeof(uint16_t) * (indexCount + 1),
+                                               nullptr, nullptr, bufferOffsetOut, nullptr));
+        *bufferOut = mDynamicIndexBuffer.getCurrentBuffer();
+
+        vk::BufferHelper *dest = *bufferOut;
+        vk::BufferHelper *src  = &elementArrayBufferVk->getBuffer();
+        ANGLE_TRY(src->initBufferView(contextVk, renderer->getFormat(angle::FormatID::R8_UINT)));
+        ANGLE_TRY(dest->initBufferView(contextVk, renderer->getFormat(angle::FormatID::R16_UINT)));
+
+        // Note: the offset returned by allocate() is in bytes, while the destination view is of
+        // GLushorts.
+        UtilsVk::CopyParameters params = {};
+        params.destOffset              = static_cast<size_t>(*bufferOffsetOut) / sizeof(uint16_t);
+        params.srcOffset               = static_cast<size_t>(elementArrayOffset);
+        params.size                    = static_cast<size_t>(indexCount);
+        ANGLE_TRY(renderer->getUtils().copyBuffer(contextVk, dest, src, params));
+
+        params.destOffset += params.size;
+        params.size       = 1;
+        ANGLE_TRY(renderer->getUtils().copyBuffer(contextVk, dest, src, params));
+
+        return angle::Result::Continue;
+    }
+
     if (glIndexType == gl::DrawElementsType::UnsignedByte)
     {
         TRACE_EVENT0("gpu.angle", "LineLoopHelper::getIndexBufferForElementArrayBuffer");
-        // Needed before reading buffer or we could get stale data.
-        ANGLE_TRY(contextVk->getRenderer()->finish(contextVk));
 
         void *srcDataMapping = nullptr;
-        ANGLE_TRY(elementArrayBufferVk->mapImpl(contextVk, &srcDataMapping));
+        ANGLE_TRY(elementArrayBufferVk->mapForReadAccess(contextVk, &srcDataMapping));
         ANGLE_TRY(streamIndices(contextVk, glIndexType, indexCount,
                                 static_cast<const uint8_t *>(srcDataMapping) + elementArrayOffset,
                                 bufferOut, bufferOffsetOut));
@@ -970,7 +1086,7 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
     auto unitSize = (indexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t));
     size_t allocateBytes = unitSize * (indexCount + 1) + 1;
 
-    mDynamicIndexBuffer.releaseRetainedBuffers(contextVk->getRenderer());
+    mDynamicIndexBuffer.releaseRetainedBuffers(renderer);
     ANGLE_TRY(mDynamicIndexBuffer.allocate(contextVk, allocateBytes,
                                            reinterpret_cast<uint8_t **>(&indices), nullptr,
                                            bufferOffsetOut, nullptr));
@@ -982,7 +1098,7 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
         {sourceOffset, *bufferOffsetOut, unitCount * unitSize},
         {sourceOffset, *bufferOffsetOut + unitCount * unitSize, unitSize},
     };
-    if (contextVk->getRenderer()->getFeatures().extraCopyBufferRegion)
+    if (renderer->getFeatures().extraCopyBufferRegion)
         copies.push_back({sourceOffset, *bufferOffsetOut + (unitCount + 1) * unitSize, 1});
 
     ANGLE_TRY(
@@ -1057,7 +1173,9 @@ BufferHelper::BufferHelper()
       mMappedMemory(nullptr),
       mViewFormat(nullptr),
       mCurrentWriteAccess(0),
-      mCurrentReadAccess(0)
+      mCurrentReadAccess(0),
+      mPendingCopyWriteStart(0),
+      mPendingCopyWriteEnd(0)
 {}
 
 BufferHelper::~BufferHelper() = default;
@@ -1101,8 +1219,10 @@ void BufferHelper::onWrite(VkAccessFlagBits writeAccessType)
         addGlobalMemoryBarrier(mCurrentReadAccess | mCurrentWriteAccess, writeAccessType);
     }
 
-    mCurrentWriteAccess = writeAccessType;
-    mCurrentReadAccess  = 0;
+    mCurrentWriteAccess    = writeAccessType;
+    mCurrentReadAccess     = 0;
+    mPendingCopyWriteStart = 0;
+    mPendingCopyWriteEnd   = 0;
 }
 
 angle::Result BufferHelper::copyFromBuffer(Context *context,
@@ -1113,21 +1233,40 @@ angle::Result BufferHelper::copyFromBuffer(Context *context,
     vk::CommandBuffer *commandBuffer = nullptr;
     ANGLE_TRY(recordCommands(context, &commandBuffer));
 
-    if (mCurrentReadAccess != 0 || mCurrentWriteAccess != 0)
-    {
-        // Insert a barrier to ensure reads/writes are complete.
-        // Use a global memory barrier to keep things simple.
-        VkMemoryBarrier memoryBarrier = {};
-        memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-        memoryBarrier.srcAccessMask   = mCurrentReadAccess | mCurrentWriteAccess;
-        memoryBarrier.dstAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    // A batch of sub-data uploads into disjoint ranges only waits on what came before the batch.
+    const VkDeviceSize writeStart = copyRegion.dstOffset;
+    const VkDeviceSize writeEnd   = copyRegion.dstOffset + copyRegion.size;
+    const bool onlyPendingCopyWrites =
+        mCurrentReadAccess == 0 && mCurrentWriteAccess == VK_ACCESS_TRANSFER_WRITE_BIT &&
+        mPendingCopyWriteStart < mPendingCopyWriteEnd;
+    const bool overlapsPendingCopyWrites =
+        writeStart < mPendingCopyWriteEnd && writeEnd > mPendingCopyWriteStart;
 
-        commandBuffer->pipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &memoryBarrier, 0,
-                                       nullptr, 0, nullptr);
+    if (onlyPendingCopyWrites && !overlapsPendingCopyWrites)
+    {
+        mPendingCopyWriteStart = std::min(mPendingCopyWriteStart, writeStart);
+        mPendingCopyWriteEnd   = std::max(mPendingCopyWriteEnd, writeEnd);
+    }
+    else
+    {
+        if (mCurrentReadAccess != 0 || mCurrentWriteAccess != 0)
+        {
+            // Insert a barrier to ensure reads/writes are complete.
+            // Use a global memory barrier to keep things simple.
+            VkMemoryBarrier memoryBarrier = {};
+            memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask   = mCurrentReadAccess | mCurrentWriteAccess;
+            memoryBarrier.dstAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+            commandBuffer->pipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                           VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &memoryBarrier,
+                                           0, nullptr, 0, nullptr);
+        }
 
-        mCurrentWriteAccess = VK_ACCESS_TRANSFER_WRITE_BIT;
-        mCurrentReadAccess  = 0;
+        mCurrentWriteAccess    = VK_ACCESS_TRANSFER_WRITE_BIT;
+        mCurrentReadAccess     = 0;
+        mPendingCopyWriteStart = writeStart;
+        mPendingCopyWriteEnd   = writeEnd;
     }
 
     commandBuffer->copyBuffer(buffer, mBuffer, 1, &copyRegion);
@@ -1262,6 +1401,23 @@ angle::Result ImageHelper::init(Context *context,
                                 VkImageUsageFlags usage,
                                 uint32_t mipLevels,
                                 uint32_t layerCount)
+{
+    return initExternal(context, textureType, extents, format, samples, usage,
+                        VK_IMAGE_TILING_OPTIMAL, ImageLayout::Undefined, nullptr, mipLevels,
+                        layerCount);
+}
+
+angle::Result ImageHelper::initExternal(Context *context,
+                                        gl::TextureType textureType,
+                                        const gl::Extents &extents,
+                                        const Format &format,
+                                        GLint samples,
+                                        VkImageUsageFlags usage,
+                                        VkImageTiling tiling,
+                                        ImageLayout initialLayout,
+                                        const void *externalImageCreateInfo,
+                                        uint32_t mipLevels,
+                                        uint32_t layerCount)
 {
     ASSERT(!valid());
 
@@ -1279,6 +1435,7 @@ angle::Result ImageHelper::init(Context *context,
 
     VkImageCreateInfo imageInfo     = {};
     imageInfo.sType                 = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.pNext                 = externalImageCreateInfo;
     imageInfo.flags                 = GetImageCreateFlags(textureType);
     imageInfo.imageType             = gl_vk::GetImageType(textureType);
     imageInfo.format                = format.vkTextureFormat;
@@ -1288,14 +1445,14 @@ angle::Result ImageHelper::init(Context *context,
     imageInfo.mipLevels             = mipLevels;
     imageInfo.arrayLayers           = mLayerCount;
     imageInfo.samples               = gl_vk::GetSamples(samples);
-    imageInfo.tiling                = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.tiling                = tiling;
     imageInfo.usage                 = usage;
     imageInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
     imageInfo.queueFamilyIndexCount = 0;
     imageInfo.pQueueFamilyIndices   = nullptr;
-    imageInfo.initialLayout         = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.initialLayout         = kImageMemoryBarrierData[initialLayout].layout;
 
-    mCurrentLayout = ImageLayout::Undefined;
+    mCurrentLayout = initialLayout;
 
     ANGLE_VK_TRY(context, mImage.init(context->getDevice(), imageInfo));
 
@@ -1333,6 +1490,23 @@ angle::Result ImageHelper::initMemory(Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result ImageHelper::initExternalMemory(Context *context,
+                                              const void *importMemoryInfo,
+                                              uint32_t memoryTypeIndex,
+                                              VkDeviceSize allocationSize,
+                                              VkDeviceSize memoryOffset)
+{
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType                = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext                = importMemoryInfo;
+    allocInfo.memoryTypeIndex      = memoryTypeIndex;
+    allocInfo.allocationSize       = allocationSize;
+
+    ANGLE_VK_TRY(context, mDeviceMemory.allocate(context->getDevice(), allocInfo));
+    ANGLE_VK_TRY(context, mImage.bindMemory(context->getDevice(), mDeviceMemory, memoryOffset));
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::initImageView(Context *context,
                                          gl::TextureType textureType,
                                          VkImageAspectFlags aspectMask,
@@ -1975,6 +2149,32 @@ angle::Result ImageHelper::flushStagedUpdates(Context *context,
 
     std::vector<SubresourceUpdate> updatesToKeep;
 
+    // Consecutive buffer updates from the same staging buffer that write to disjoint regions of
+    // the image are batched into a single copy command.
+    VkBuffer batchBufferHandle = VK_NULL_HANDLE;
+    std::vector<VkBufferImageCopy> batchCopyRegions;
+
+    auto flushBatch = [&]() {
+        if (batchCopyRegions.empty())
+        {
+            return;
+        }
+
+        // Conservatively flush all writes to the image. We could use a more restricted barrier.
+        // Do not move this above the for loop, otherwise multiple updates can have race
+        // conditions and not be applied correctly as seen in:
+        // dEQP-gles2.functional_texture_specification_texsubimage2d_align_2d* tests on Windows
+        // AMD.  Updates in a batch never overlap, so a single barrier per batch is sufficient.
+        changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, vk::ImageLayout::TransferDst, commandBuffer);
+
+        commandBuffer->copyBufferToImage(batchBufferHandle, mImage, getCurrentLayout(),
+                                         static_cast<uint32_t>(batchCopyRegions.size()),
+                                         batchCopyRegions.data());
+
+        batchBufferHandle = VK_NULL_HANDLE;
+        batchCopyRegions.clear();
+    };
+
     for (SubresourceUpdate &update : mSubresourceUpdates)
     {
         ASSERT((update.updateSource == SubresourceUpdate::UpdateSource::Buffer &&
@@ -1993,19 +2193,30 @@ angle::Result ImageHelper::flushStagedUpdates(Context *context,
             continue;
         }
 
-        // Conservatively flush all writes to the image. We could use a more restricted barrier.
-        // Do not move this above the for loop, otherwise multiple updates can have race conditions
-        // and not be applied correctly as seen in:
-        // dEQP-gles2.functional_texture_specification_texsubimage2d_align_2d* tests on Windows AMD
-        changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, vk::ImageLayout::TransferDst, commandBuffer);
-
         if (update.updateSource == SubresourceUpdate::UpdateSource::Buffer)
         {
-            commandBuffer->copyBufferToImage(update.buffer.bufferHandle, mImage, getCurrentLayout(),
-                                             1, &update.buffer.copyRegion);
+            bool canBatch = update.buffer.bufferHandle == batchBufferHandle;
+            for (size_t regionIndex = 0; canBatch && regionIndex < batchCopyRegions.size();
+                 ++regionIndex)
+            {
+                canBatch = !BufferImageCopiesOverlap(batchCopyRegions[regionIndex],
+                                                     update.buffer.copyRegion);
+            }
+
+            if (!canBatch)
+            {
+                flushBatch();
+                batchBufferHandle = update.buffer.bufferHandle;
+            }
+
+            batchCopyRegions.push_back(update.buffer.copyRegion);
         }
         else
         {
+            flushBatch();
+
+            changeLayout(VK_IMAGE_ASPECT_COLOR_BIT, vk::ImageLayout::TransferDst, commandBuffer);
+
             // Note: currently, the staging images are only made through color attachment writes. If
             // they were written to otherwise in the future, the src stage of this transition should
             // be adjusted appropriately.
@@ -2022,6 +2233,8 @@ angle::Result ImageHelper::flushStagedUpdates(Context *context,
         update.release(renderer);
     }
 
+    flushBatch();
+
     // Only remove the updates that were actually applied to the image.
     mSubresourceUpdates = std::move(updatesToKeep);
 
@@ -9,6 +9,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 
+#include <deque>
+
 #include "libANGLE/renderer/vulkan/CommandGraph.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
@@ -28,6 +30,10 @@ namespace vk
 //
 // Dynamic buffers are used to implement a variety of data streaming operations in Vulkan, such
 // as for immediate vertex array and element array data, uniform updates, and other dynamic data.
+//
+// Retained buffers are not destroyed when released. They are kept in a free list and recycled as a
+// ring once the GPU is done with the queue serial they were released at. The free list is capped so
+// that a usage peak doesn't keep its buffers alive for the life of the DynamicBuffer.
 class BufferHelper;
 class DynamicBuffer : angle::NonCopyable
 {
@@ -59,7 +65,8 @@ class DynamicBuffer : angle::NonCopyable
     // This releases resources when they might currently be in use.
     void release(RendererVk *renderer);
 
-    // This releases all the buffers that have been allocated since this was last called.
+    // This releases all the buffers that have been allocated since this was last called. The
+    // buffers are recycled once the current queue serial has finished executing.
     void releaseRetainedBuffers(RendererVk *renderer);
 
     // This frees resources immediately.
@@ -72,6 +79,7 @@ class DynamicBuffer : angle::NonCopyable
 
   private:
     void reset();
+    angle::Result allocateNewBuffer(Context *context);
 
     VkBufferUsageFlags mUsage;
     bool mHostVisible;
@@ -83,6 +91,7 @@ class DynamicBuffer : angle::NonCopyable
     size_t mAlignment;
 
     std::vector<BufferHelper *> mRetainedBuffers;
+    std::deque<BufferHelper *> mBufferFreeList;
 };
 
 // Uses DescriptorPool to allocate descriptor sets as needed. If a descriptor pool becomes full, we
@@ -399,6 +408,7 @@ class BufferHelper final : public CommandGraphResource
     bool valid() const { return mBuffer.valid(); }
     const Buffer &getBuffer() const { return mBuffer; }
     const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    VkDeviceSize getSize() const { return mSize; }
 
     // Helpers for setting the graph dependencies *and* setting the appropriate barrier.
     ANGLE_INLINE void onRead(CommandGraphResource *reader, VkAccessFlagBits readAccessType)
@@ -414,7 +424,8 @@ class BufferHelper final : public CommandGraphResource
 
     void onWrite(VkAccessFlagBits writeAccessType);
 
-    // Also implicitly sets up the correct barriers.
+    // Also implicitly sets up the correct barriers. Consecutive copies into disjoint ranges share
+    // the barrier of the first one.
     angle::Result copyFromBuffer(Context *context,
                                  const Buffer &buffer,
                                  const VkBufferCopy &copyRegion);
@@ -469,6 +480,10 @@ class BufferHelper final : public CommandGraphResource
     // For memory barriers.
     VkFlags mCurrentWriteAccess;
     VkFlags mCurrentReadAccess;
+
+    // The range written by copyFromBuffer since the last barrier. Empty when start == end.
+    VkDeviceSize mPendingCopyWriteStart;
+    VkDeviceSize mPendingCopyWriteEnd;
 };
 
 // Imagine an image going through a few layout transitions:
@@ -535,9 +550,27 @@ class ImageHelper final : public CommandGraphResource
                        VkImageUsageFlags usage,
                        uint32_t mipLevels,
                        uint32_t layerCount);
+    angle::Result initExternal(Context *context,
+                               gl::TextureType textureType,
+                               const gl::Extents &extents,
+                               const Format &format,
+                               GLint samples,
+                               VkImageUsageFlags usage,
+                               VkImageTiling tiling,
+                               ImageLayout initialLayout,
+                               const void *externalImageCreateInfo,
+                               uint32_t mipLevels,
+                               uint32_t layerCount);
     angle::Result initMemory(Context *context,
                              const MemoryProperties &memoryProperties,
                              VkMemoryPropertyFlags flags);
+    // Import memory allocated outside of ANGLE, described by the extension structures chained in
+    // |importMemoryInfo|, and bind the image at |memoryOffset| into it.
+    angle::Result initExternalMemory(Context *context,
+                                     const void *importMemoryInfo,
+                                     uint32_t memoryTypeIndex,
+                                     VkDeviceSize allocationSize,
+                                     VkDeviceSize memoryOffset);
     angle::Result initLayerImageView(Context *context,
                                      gl::TextureType textureType,
                                      VkImageAspectFlags aspectMask,
@@ -488,6 +488,11 @@ PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR = nullpt
 PFN_vkCreateImagePipeSurfaceFUCHSIA vkCreateImagePipeSurfaceFUCHSIA = nullptr;
 #endif
 
+#if defined(ANGLE_PLATFORM_LINUX)
+// VK_KHR_external_memory_fd
+PFN_vkGetMemoryFdPropertiesKHR vkGetMemoryFdPropertiesKHR = nullptr;
+#endif
+
 #define GET_FUNC(vkName)                                                                   \
     do                                                                                     \
     {                                                                                      \
@@ -519,6 +524,13 @@ void InitImagePipeSurfaceFUCHSIAFunctions(VkInstance instance)
 }
 #endif
 
+#if defined(ANGLE_PLATFORM_LINUX)
+void InitExternalMemoryFdKHRFunctions(VkInstance instance)
+{
+    GET_FUNC(vkGetMemoryFdPropertiesKHR);
+}
+#endif
+
 #undef GET_FUNC
 
 namespace gl_vk
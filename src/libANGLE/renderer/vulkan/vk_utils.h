@@ -401,6 +401,12 @@ extern PFN_vkCreateImagePipeSurfaceFUCHSIA vkCreateImagePipeSurfaceFUCHSIA;
 void InitImagePipeSurfaceFUCHSIAFunctions(VkInstance instance);
 #endif
 
+#if defined(ANGLE_PLATFORM_LINUX)
+// VK_KHR_external_memory_fd
+extern PFN_vkGetMemoryFdPropertiesKHR vkGetMemoryFdPropertiesKHR;
+void InitExternalMemoryFdKHRFunctions(VkInstance instance);
+#endif
+
 namespace gl_vk
 {
 VkRect2D GetRect(const gl::Rectangle &source);
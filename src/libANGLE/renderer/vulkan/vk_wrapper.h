@@ -238,6 +238,12 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                      int32_t vertexOffset,
                      uint32_t firstInstance);
 
+    void drawIndirect(VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride);
+    void drawIndexedIndirect(VkBuffer buffer,
+                             VkDeviceSize offset,
+                             uint32_t drawCount,
+                             uint32_t stride);
+
     void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ);
 
     void bindPipeline(VkPipelineBindPoint pipelineBindPoint, const Pipeline &pipeline);
@@ -309,6 +315,9 @@ class Image final : public WrappedObject<Image, VkImage>
 
     void getMemoryRequirements(VkDevice device, VkMemoryRequirements *requirementsOut) const;
     VkResult bindMemory(VkDevice device, const DeviceMemory &deviceMemory);
+    VkResult bindMemory(VkDevice device,
+                        const DeviceMemory &deviceMemory,
+                        VkDeviceSize memoryOffset);
 
     void getSubresourceLayout(VkDevice device,
                               VkImageAspectFlagBits aspectMask,
@@ -835,6 +844,24 @@ ANGLE_INLINE void CommandBuffer::drawIndexed(uint32_t indexCount,
     vkCmdDrawIndexed(mHandle, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 }
 
+ANGLE_INLINE void CommandBuffer::drawIndirect(VkBuffer buffer,
+                                              VkDeviceSize offset,
+                                              uint32_t drawCount,
+                                              uint32_t stride)
+{
+    ASSERT(valid());
+    vkCmdDrawIndirect(mHandle, buffer, offset, drawCount, stride);
+}
+
+ANGLE_INLINE void CommandBuffer::drawIndexedIndirect(VkBuffer buffer,
+                                                     VkDeviceSize offset,
+                                                     uint32_t drawCount,
+                                                     uint32_t stride)
+{
+    ASSERT(valid());
+    vkCmdDrawIndexedIndirect(mHandle, buffer, offset, drawCount, stride);
+}
+
 ANGLE_INLINE void CommandBuffer::dispatch(uint32_t groupCountX,
                                           uint32_t groupCountY,
                                           uint32_t groupCountZ)
@@ -898,6 +925,14 @@ ANGLE_INLINE VkResult Image::bindMemory(VkDevice device, const vk::DeviceMemory
     return vkBindImageMemory(device, mHandle, deviceMemory.getHandle(), 0);
 }
 
+ANGLE_INLINE VkResult Image::bindMemory(VkDevice device,
+                                        const vk::DeviceMemory &deviceMemory,
+                                        VkDeviceSize memoryOffset)
+{
+    ASSERT(valid() && deviceMemory.valid());
+    return vkBindImageMemory(device, mHandle, deviceMemory.getHandle(), memoryOffset);
+}
+
 ANGLE_INLINE void Image::getSubresourceLayout(VkDevice device,
                                               VkImageAspectFlagBits aspectMask,
                                               uint32_t mipLevel,
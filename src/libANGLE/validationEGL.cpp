@@ -1852,6 +1852,29 @@ Error ValidateCreateImageKHR(const Display *display,
                 }
                 break;
 
+            case EGL_WIDTH:
+            case EGL_HEIGHT:
+            case EGL_LINUX_DRM_FOURCC_EXT:
+            case EGL_DMA_BUF_PLANE0_FD_EXT:
+            case EGL_DMA_BUF_PLANE0_OFFSET_EXT:
+            case EGL_DMA_BUF_PLANE0_PITCH_EXT:
+            case EGL_DMA_BUF_PLANE1_FD_EXT:
+            case EGL_DMA_BUF_PLANE1_OFFSET_EXT:
+            case EGL_DMA_BUF_PLANE1_PITCH_EXT:
+            case EGL_DMA_BUF_PLANE2_FD_EXT:
+            case EGL_DMA_BUF_PLANE2_OFFSET_EXT:
+            case EGL_DMA_BUF_PLANE2_PITCH_EXT:
+            case EGL_YUV_COLOR_SPACE_HINT_EXT:
+            case EGL_SAMPLE_RANGE_HINT_EXT:
+            case EGL_YUV_CHROMA_HORIZONTAL_SITING_HINT_EXT:
+            case EGL_YUV_CHROMA_VERTICAL_SITING_HINT_EXT:
+                if (!displayExtensions.imageDmaBufImportEXT)
+                {
+                    return EglBadParameter()
+                           << "invalid attribute: 0x" << std::hex << std::uppercase << attribute;
+                }
+                break;
+
             default:
                 return EglBadParameter()
                        << "invalid attribute: 0x" << std::hex << std::uppercase << attribute;
@@ -2046,6 +2069,49 @@ Error ValidateCreateImageKHR(const Display *display,
         }
         break;
 
+        case EGL_LINUX_DMA_BUF_EXT:
+        {
+            if (!displayExtensions.imageDmaBufImportEXT)
+            {
+                return EglBadParameter() << "EGL_EXT_image_dma_buf_import not supported.";
+            }
+
+            if (context != nullptr)
+            {
+                return EglBadContext() << "ctx must be EGL_NO_CONTEXT.";
+            }
+
+            if (buffer != nullptr)
+            {
+                return EglBadParameter() << "buffer must be NULL.";
+            }
+
+            constexpr EGLAttrib kRequiredAttributes[] = {
+                EGL_WIDTH,
+                EGL_HEIGHT,
+                EGL_LINUX_DRM_FOURCC_EXT,
+                EGL_DMA_BUF_PLANE0_FD_EXT,
+                EGL_DMA_BUF_PLANE0_OFFSET_EXT,
+                EGL_DMA_BUF_PLANE0_PITCH_EXT,
+            };
+            for (EGLAttrib requiredAttribute : kRequiredAttributes)
+            {
+                if (!attributes.contains(requiredAttribute))
+                {
+                    return EglBadParameter() << "missing required attribute: 0x" << std::hex
+                                             << std::uppercase << requiredAttribute;
+                }
+            }
+
+            if (attributes.getAsInt(EGL_WIDTH) <= 0 || attributes.getAsInt(EGL_HEIGHT) <= 0)
+            {
+                return EglBadParameter() << "EGL_WIDTH and EGL_HEIGHT must be positive.";
+            }
+
+            ANGLE_TRY(display->validateImageClientBuffer(context, target, buffer, attributes));
+        }
+        break;
+
         default:
             return EglBadParameter()
                    << "invalid target: 0x" << std::hex << std::uppercase << target;
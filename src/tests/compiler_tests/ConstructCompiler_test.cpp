@@ -9,6 +9,8 @@
 
 #include "GLSLANG/ShaderLang.h"
 #include "angle_gl.h"
+#include "compiler/translator/Compiler.h"
+#include "compiler/translator/SymbolTable.h"
 #include "gtest/gtest.h"
 
 // Test default parameters.
@@ -43,3 +45,92 @@ TEST(ConstructCompilerTest, InvalidMaxDualSourceDrawBuffers)
                                               SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
     ASSERT_EQ(nullptr, compiler);
 }
+
+namespace
+{
+
+const char *kMaxDrawBuffersShader = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(gl_MaxDrawBuffers, gl_DepthRange.far, 0, 1);
+})";
+
+bool CompileShader(ShHandle compiler, const char *shaderString)
+{
+    const char *shaderStrings[] = {shaderString};
+    return sh::Compile(compiler, shaderStrings, 1, SH_OBJECT_CODE);
+}
+
+const sh::TBuiltInSnapshot *GetBuiltInSnapshot(ShHandle handle)
+{
+    sh::TCompiler *compiler = static_cast<sh::TShHandleBase *>(handle)->getAsCompiler();
+    return compiler->getSymbolTable().getBuiltInSnapshotForTesting();
+}
+
+}  // anonymous namespace
+
+// Test that compilers with different resources don't share built-in variables that depend on the
+// resources.
+TEST(ConstructCompilerTest, BuiltInsDependOnResources)
+{
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.MaxDrawBuffers = 4;
+    ShHandle fourDrawBuffers =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+    ASSERT_NE(nullptr, fourDrawBuffers);
+
+    resources.MaxDrawBuffers = 8;
+    ShHandle eightDrawBuffers =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+    ASSERT_NE(nullptr, eightDrawBuffers);
+
+    EXPECT_NE(GetBuiltInSnapshot(fourDrawBuffers), GetBuiltInSnapshot(eightDrawBuffers));
+
+    ASSERT_TRUE(CompileShader(fourDrawBuffers, kMaxDrawBuffersShader));
+    EXPECT_NE(std::string::npos, sh::GetObjectCode(fourDrawBuffers).find("vec4(4,"));
+
+    ASSERT_TRUE(CompileShader(eightDrawBuffers, kMaxDrawBuffersShader));
+    EXPECT_NE(std::string::npos, sh::GetObjectCode(eightDrawBuffers).find("vec4(8,"));
+
+    sh::Destruct(fourDrawBuffers);
+    sh::Destruct(eightDrawBuffers);
+}
+
+// Test that compilers with identical resources keep working when the other compilers that share
+// the built-in variables with them are destroyed, or the shared built-ins are released.
+TEST(ConstructCompilerTest, SharedBuiltInsOutliveCompilers)
+{
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.MaxDrawBuffers = 3;
+
+    ShHandle first =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+    ShHandle second =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(nullptr, GetBuiltInSnapshot(first));
+    EXPECT_EQ(GetBuiltInSnapshot(first), GetBuiltInSnapshot(second));
+
+    ASSERT_TRUE(CompileShader(first, kMaxDrawBuffersShader));
+    sh::Destruct(first);
+
+    ASSERT_TRUE(CompileShader(second, kMaxDrawBuffersShader));
+    EXPECT_NE(std::string::npos, sh::GetObjectCode(second).find("vec4(3,"));
+
+    sh::TSymbolTable::ReleaseBuiltInSnapshots();
+    ASSERT_TRUE(CompileShader(second, kMaxDrawBuffersShader));
+    EXPECT_NE(std::string::npos, sh::GetObjectCode(second).find("vec4(3,"));
+
+    ShHandle third =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, &resources);
+    ASSERT_NE(nullptr, third);
+    EXPECT_NE(GetBuiltInSnapshot(second), GetBuiltInSnapshot(third));
+    ASSERT_TRUE(CompileShader(third, kMaxDrawBuffersShader));
+    EXPECT_NE(std::string::npos, sh::GetObjectCode(third).find("vec4(3,"));
+
+    sh::Destruct(second);
+    sh::Destruct(third);
+}
@@ -0,0 +1,104 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EmulateTransformFeedback_test.cpp:
+//   Tests that the Vulkan translator only captures transform feedback in programs that define
+//   ANGLE_CAPTURE_XFB when they are linked.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+class EmulateTransformFeedbackTest : public MatchOutputCodeTest
+{
+  public:
+    EmulateTransformFeedbackTest()
+        : MatchOutputCodeTest(GL_VERTEX_SHADER, SH_OBJECT_CODE, SH_GLSL_VULKAN_OUTPUT)
+    {}
+};
+
+constexpr char kVertexShader[] = R"(#version 300 es
+in vec4 position;
+out vec4 color;
+void main()
+{
+    color = position * 0.5;
+    gl_Position = position;
+})";
+
+// Check that both the declaration and the call of the capture function are guarded by
+// ANGLE_CAPTURE_XFB, and that the call comes at the end of main.
+TEST_F(EmulateTransformFeedbackTest, CaptureIsGuarded)
+{
+    compile(kVertexShader);
+
+    EXPECT_TRUE(foundInCode("@@ XFB-OUT @@", 1));
+    EXPECT_TRUE(foundInCode("#ifdef ANGLE_CAPTURE_XFB", 2));
+    EXPECT_TRUE(foundInCode("ANGLECaptureXfb()", 2));
+    EXPECT_TRUE(foundInCodeInOrder({"#ifdef ANGLE_CAPTURE_XFB", "void ANGLECaptureXfb();",
+                                    "#endif", "void main", "gl_Position", "#ifdef ANGLE_CAPTURE_XFB",
+                                    "ANGLECaptureXfb();", "#endif"}));
+}
+
+// Check that fragment shaders don't capture anything.
+TEST_F(EmulateTransformFeedbackTest, FragmentShaderDoesNotCapture)
+{
+    const std::string shaderString =
+        R"(#version 300 es
+precision mediump float;
+in vec4 color;
+out vec4 fragColor;
+void main()
+{
+    fragColor = color;
+})";
+
+    std::string translatedCode;
+    std::string infoLog;
+    ASSERT_TRUE(compileTestShader(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_GLSL_VULKAN_OUTPUT,
+                                  shaderString, SH_OBJECT_CODE, &translatedCode, &infoLog))
+        << infoLog;
+
+    EXPECT_EQ(std::string::npos, translatedCode.find("ANGLE_CAPTURE_XFB"));
+    EXPECT_EQ(std::string::npos, translatedCode.find("ANGLECaptureXfb"));
+    EXPECT_EQ(std::string::npos, translatedCode.find("@@ XFB-OUT @@"));
+}
+
+// Check that SPIR-V is still generated for vertex shaders, which leaves out the capture as the
+// programs that use it are compiled from the GLSL output.
+TEST_F(EmulateTransformFeedbackTest, SPIRVSkipsCapture)
+{
+    constexpr char kESSL100VertexShader[] = R"(attribute vec4 position;
+varying vec4 color;
+void main()
+{
+    color = position * 0.5;
+    gl_Position = position;
+})";
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    ShHandle compiler =
+        sh::ConstructCompiler(GL_VERTEX_SHADER, SH_GLES3_SPEC, SH_GLSL_VULKAN_OUTPUT, &resources);
+    ASSERT_NE(nullptr, compiler);
+
+    const char *shaderStrings[] = {kESSL100VertexShader};
+    ASSERT_TRUE(sh::Compile(compiler, shaderStrings, 1, SH_OBJECT_CODE | SH_GENERATE_SPIRV));
+
+    const std::vector<uint32_t> *spirv = sh::GetSPIRVCode(compiler, false);
+    ASSERT_NE(nullptr, spirv);
+    EXPECT_FALSE(spirv->empty());
+
+    sh::Destruct(compiler);
+}
+
+}  // anonymous namespace
@@ -260,3 +260,51 @@ TEST_F(IntermNodeTest, DeepCopyTernaryNode)
     checkSymbolCopy(original->getTrueExpression(), copy->getTrueExpression());
     checkSymbolCopy(original->getFalseExpression(), copy->getFalseExpression());
 }
+
+// Check that nodes with equal types share the type while types are shared, and that changing the
+// type of one node doesn't change the type of the nodes it was shared with.
+TEST_F(IntermNodeTest, SharedTypes)
+{
+    TScopedTypeSharing typeSharing;
+
+    TConstantUnion *constValue = new TConstantUnion[1];
+    constValue[0].setFConst(1.0f);
+    TType type(EbtFloat, EbpHigh, EvqConst);
+    TIntermConstantUnion *left  = new TIntermConstantUnion(constValue, type);
+    TIntermConstantUnion *right = new TIntermConstantUnion(constValue, type);
+    EXPECT_EQ(&left->getType(), &right->getType());
+
+    // In ESSL 3.00 the result of a sequence operator is not a constant, even if its operands are.
+    TIntermBinary *comma = TIntermBinary::CreateComma(left, right, 300);
+    EXPECT_EQ(EvqTemporary, comma->getQualifier());
+    EXPECT_EQ(EvqConst, right->getQualifier());
+    EXPECT_NE(&right->getType(), &comma->getType());
+
+    TIntermBinary *add = new TIntermBinary(EOpAdd, createTestSymbol(), createTestSymbol());
+    EXPECT_EQ(&comma->getType(), &add->getType());
+
+    TIntermTyped *copy = comma->deepCopy();
+    EXPECT_EQ(&comma->getType(), &copy->getType());
+}
+
+// Check that types with layout qualifiers and types created while types are not shared are copied.
+TEST_F(IntermNodeTest, UnsharedTypes)
+{
+    TConstantUnion *constValue = new TConstantUnion[1];
+    constValue[0].setIConst(1);
+    TType type(EbtInt, EbpHigh, EvqConst);
+    TIntermConstantUnion *first  = new TIntermConstantUnion(constValue, type);
+    TIntermConstantUnion *second = new TIntermConstantUnion(constValue, type);
+    EXPECT_NE(&first->getType(), &second->getType());
+    checkTypeEqualWithQualifiers(first->getType(), second->getType());
+
+    TScopedTypeSharing typeSharing;
+
+    TLayoutQualifier layoutQualifier = TLayoutQualifier::Create();
+    layoutQualifier.location         = 1;
+    type.setLayoutQualifier(layoutQualifier);
+    first  = new TIntermConstantUnion(constValue, type);
+    second = new TIntermConstantUnion(constValue, type);
+    EXPECT_NE(&first->getType(), &second->getType());
+    EXPECT_EQ(1, second->getType().getLayoutQualifier().location);
+}
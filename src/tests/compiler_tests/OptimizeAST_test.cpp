@@ -0,0 +1,414 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeAST_test.cpp:
+//   Tests for the optional AST optimizations enabled with SH_OPTIMIZE_AST.
+//
+
+#include <algorithm>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+class OptimizeASTTest : public MatchOutputCodeTest
+{
+  public:
+    OptimizeASTTest() : MatchOutputCodeTest(GL_FRAGMENT_SHADER, SH_OPTIMIZE_AST, SH_ESSL_OUTPUT)
+    {}
+};
+
+// Test that a variable initialized with a constant is replaced with the constant.
+TEST_F(OptimizeASTTest, PropagateConstant)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform float u;
+        void main()
+        {
+            float myConstant = 2.0;
+            gl_FragColor = vec4(u * myConstant);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("myConstant"));
+    ASSERT_TRUE(foundInCode("(_uu * 2.0)"));
+}
+
+// Test that a variable initialized with a copy of another variable is replaced with the other
+// variable.
+TEST_F(OptimizeASTTest, PropagateCopy)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform float u;
+        void main()
+        {
+            float original = u * u;
+            float myCopy = original;
+            gl_FragColor = vec4(myCopy);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("myCopy"));
+    ASSERT_TRUE(foundInCode("vec4(_uoriginal)"));
+}
+
+// Test that a copy is not propagated into a scope where the name of the source is hidden.
+TEST_F(OptimizeASTTest, CopyNotPropagatedIntoShadowingScope)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform float u;
+        void main()
+        {
+            float original = u * u;
+            float myCopy = original;
+            {
+                float original = 3.0;
+                gl_FragColor = vec4(myCopy, original, 0.0, 1.0);
+            }
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("vec4(_umyCopy"));
+}
+
+// Test that a copy is not propagated if the copied variable is assigned later.
+TEST_F(OptimizeASTTest, CopyOfAssignedVariableNotPropagated)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform float u;
+        void main()
+        {
+            float original = u;
+            float myCopy = original;
+            original += 1.0;
+            gl_FragColor = vec4(myCopy, original, 0.0, 1.0);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("vec4(_umyCopy"));
+}
+
+// Test that a recomputed expression reuses the variable that was initialized with it.
+TEST_F(OptimizeASTTest, ReuseCommonSubexpression)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void main()
+        {
+            float first = sin(u.x) * u.y;
+            float second = sin(u.x) * u.y;
+            gl_FragColor = vec4(first, second, 0.0, 1.0);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("sin(_uu.x)", 1));
+    ASSERT_TRUE(notFoundInCode("second"));
+    ASSERT_TRUE(foundInCode("vec4(_ufirst, _ufirst"));
+}
+
+// Test that an expression is not reused after a variable it reads is assigned.
+TEST_F(OptimizeASTTest, CommonSubexpressionInvalidatedByAssignment)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        void main()
+        {
+            vec4 v = u;
+            float first = v.x * v.y;
+            v.x += 1.0;
+            float second = v.x * v.y;
+            gl_FragColor = vec4(first, second, 0.0, 1.0);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("(_uv.x * _uv.y)", 2));
+}
+
+// Test that an expression is not reused after a call to a function that may have side effects.
+TEST_F(OptimizeASTTest, CommonSubexpressionInvalidatedByFunctionCall)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform vec4 u;
+        float g;
+        void setG()
+        {
+            g = u.z;
+        }
+        void main()
+        {
+            g = u.x;
+            float first = g * u.y;
+            setG();
+            float second = g * u.y;
+            gl_FragColor = vec4(first, second, 0.0, 1.0);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("(_ug * _uu.y)", 2));
+}
+
+// Test that the branch of an if statement with a constant condition that's not taken is removed.
+TEST_F(OptimizeASTTest, RemoveUntakenBranch)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        const bool kEnabled = false;
+        void main()
+        {
+            if (kEnabled)
+            {
+                gl_FragColor = vec4(1.0);
+            }
+            else
+            {
+                gl_FragColor = vec4(0.5);
+            }
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("if"));
+    ASSERT_TRUE(notFoundInCode("vec4(1.0"));
+    ASSERT_TRUE(foundInCode("vec4(0.5"));
+}
+
+// Test that statements after a return are removed.
+TEST_F(OptimizeASTTest, RemoveUnreachableStatements)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        void main()
+        {
+            gl_FragColor = vec4(0.5);
+            return;
+            gl_FragColor = vec4(1.0);
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("vec4(1.0"));
+}
+
+// Test that statements after a break in a switch statement are kept, since they may be reached
+// through a case label.
+TEST_F(OptimizeASTTest, KeepStatementsAfterBreakInSwitch)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform int u;
+        out vec4 color;
+        void main()
+        {
+            switch (u)
+            {
+                case 0:
+                    color = vec4(0.5);
+                    break;
+                case 1:
+                    color = vec4(1.0);
+            }
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("vec4(1.0"));
+}
+
+// Test that assignments to a local variable that's never read are removed, but the side effects
+// of the assigned value are kept.
+TEST_F(OptimizeASTTest, RemoveDeadStores)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform float u;
+        float sideEffect()
+        {
+            gl_FragColor = vec4(u);
+            return u;
+        }
+        void main()
+        {
+            float myDead = 0.0;
+            myDead = u * 3.0;
+            myDead = sideEffect();
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(notFoundInCode("myDead"));
+    ASSERT_TRUE(notFoundInCode("3.0"));
+    ASSERT_TRUE(foundInCode("_usideEffect()", 2));
+}
+
+// Test that a constant is not propagated into an operation where its precision is higher than that
+// of the other operands, since the ESSL output would have to declare it again for each use.
+TEST_F(OptimizeASTTest, ConstantNotPropagatedWherePrecisionMatters)
+{
+    const std::string &shaderString =
+        R"(precision mediump float;
+        uniform lowp vec4 u;
+        void main()
+        {
+            float weight = 0.5;
+            gl_FragColor = u * weight + u.yzwx * weight;
+        })";
+    compile(shaderString);
+
+    ASSERT_TRUE(foundInCode("weight", 3));
+}
+
+struct CorpusShader
+{
+    const char *name;
+    ShShaderSpec spec;
+    const char *source;
+};
+
+// Shaders with the kind of redundancy the passes target, as found in shaders generated by engines
+// and by preprocessor-heavy shader libraries.
+constexpr CorpusShader kCorpus[] = {
+    {"Redundant", SH_GLES2_SPEC,
+     R"(precision mediump float;
+uniform vec4 u;
+varying vec2 texCoord;
+const float kScale = 0.5;
+void main()
+{
+    float scale = kScale;
+    vec2 coord = texCoord;
+    float a = length(coord) * scale;
+    float b = length(coord) * scale;
+    float unused = a * b;
+    if (kScale > 1.0)
+    {
+        a = 0.0;
+    }
+    gl_FragColor = vec4(a, b, u.x, 1.0);
+})"},
+    {"Lighting", SH_GLES2_SPEC,
+     R"(precision mediump float;
+uniform vec3 lightPositions[4];
+uniform vec3 lightColors[4];
+uniform vec3 albedo;
+varying vec3 worldPosition;
+varying vec3 worldNormal;
+void main()
+{
+    vec3 normal = normalize(worldNormal);
+    vec3 n = normal;
+    float ambient = 0.1;
+    vec3 color = albedo * ambient;
+    for (int i = 0; i < 4; ++i)
+    {
+        vec3 toLight = lightPositions[i] - worldPosition;
+        float distance = length(toLight);
+        vec3 direction = toLight / length(toLight);
+        float diffuse = max(dot(n, direction), 0.0);
+        float attenuation = 1.0 / (1.0 + distance * distance);
+        float unusedFalloff = attenuation * attenuation;
+        color += albedo * lightColors[i] * diffuse * attenuation;
+    }
+    gl_FragColor = vec4(color, 1.0);
+})"},
+    {"UberShader", SH_GLES3_SPEC,
+     R"(#version 300 es
+precision highp float;
+const bool kUseFog = false;
+const bool kUseTint = true;
+const int kMode = 1;
+uniform sampler2D tex;
+uniform vec4 tint;
+uniform vec4 fogColor;
+in vec2 uv;
+in float depth;
+out vec4 fragColor;
+void main()
+{
+    vec4 color = texture(tex, uv);
+    vec4 baseColor = color;
+    if (kUseFog)
+    {
+        float fog = clamp(depth * 0.1, 0.0, 1.0);
+        color = mix(color, fogColor, fog);
+    }
+    if (kUseTint)
+    {
+        color *= tint;
+    }
+    else
+    {
+        color = baseColor;
+    }
+    switch (kMode)
+    {
+        case 0:
+            color.rgb = vec3(dot(color.rgb, vec3(0.299, 0.587, 0.114)));
+            break;
+        default:
+            break;
+    }
+    fragColor = color;
+    return;
+    fragColor = baseColor;
+})"},
+    {"Blur", SH_GLES2_SPEC,
+     R"(precision mediump float;
+uniform sampler2D tex;
+uniform vec2 texelSize;
+varying vec2 uv;
+void main()
+{
+    vec2 center = uv;
+    vec2 dx = texelSize * vec2(1.0, 0.0);
+    vec2 dy = texelSize * vec2(0.0, 1.0);
+    vec2 rightCoord = center + dx;
+    vec2 leftCoord = center - texelSize * vec2(1.0, 0.0);
+    vec2 upCoord = center + dy;
+    vec2 downCoord = center - texelSize * vec2(0.0, 1.0);
+    vec4 sum = texture2D(tex, center) * 0.4;
+    vec2 tapCoord = rightCoord;
+    sum += texture2D(tex, tapCoord) * 0.15;
+    sum += texture2D(tex, leftCoord) * 0.15;
+    sum += texture2D(tex, upCoord) * 0.15;
+    sum += texture2D(tex, downCoord) * 0.15;
+    gl_FragColor = sum;
+})"},
+};
+
+// Test that the passes reduce both the size and the number of statements of the translated code
+// of every shader in the corpus.
+TEST_F(OptimizeASTTest, OutputIsSmaller)
+{
+    auto countStatements = [](const std::string &code) {
+        return std::count(code.begin(), code.end(), ';');
+    };
+
+    for (const CorpusShader &shader : kCorpus)
+    {
+        SCOPED_TRACE(shader.name);
+
+        std::string unoptimizedCode;
+        std::string infoLog;
+        ASSERT_TRUE(compileTestShader(GL_FRAGMENT_SHADER, shader.spec, SH_ESSL_OUTPUT,
+                                      shader.source, SH_OBJECT_CODE, &unoptimizedCode, &infoLog))
+            << infoLog;
+
+        std::string optimizedCode;
+        ASSERT_TRUE(compileTestShader(GL_FRAGMENT_SHADER, shader.spec, SH_ESSL_OUTPUT,
+                                      shader.source, SH_OBJECT_CODE | SH_OPTIMIZE_AST,
+                                      &optimizedCode, &infoLog))
+            << infoLog;
+
+        EXPECT_LT(optimizedCode.size(), unoptimizedCode.size());
+        EXPECT_LT(countStatements(optimizedCode), countStatements(unoptimizedCode));
+    }
+}
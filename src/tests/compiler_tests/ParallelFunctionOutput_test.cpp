@@ -0,0 +1,156 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ParallelFunctionOutput_test.cpp:
+//   Test that writing the code of functions on several threads with SH_PARALLEL_FUNCTION_OUTPUT
+//   gives the same output as writing it on one thread.
+//
+
+#include <sstream>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+// Generates a shader with many functions that call each other, with structs declared at the
+// global scope and inside functions, and with global declarations between the functions.
+std::string GenerateShader(int functionCount)
+{
+    std::stringstream shader;
+    shader << R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+uniform int uIndex;
+out vec4 color;
+struct Global { vec4 v; float f[2]; };
+float function0(Global g)
+{
+    return g.v.x + g.f[1];
+}
+)";
+
+    for (int index = 1; index < functionCount; ++index)
+    {
+        if (index % 7 == 0)
+        {
+            shader << "struct Global" << index << " { vec2 v; Global g; };\n";
+            shader << "uniform float uValue" << index << ";\n";
+        }
+        shader << "float function" << index << "(float x);\n";
+        shader << "float function" << index << "(float x)\n{\n";
+        shader << "    struct Local { float f; vec3 v; };\n";
+        shader << "    Local l = Local(x, vec3(u.y));\n";
+        shader << "    Global g = Global(u * x, float[2](l.f, " << index << ".5));\n";
+        shader << "    for (int i = 0; i < uIndex; ++i)\n    {\n";
+        shader << "        l.v += vec3(function" << (index - 1) << "(g));\n";
+        shader << "    }\n";
+        shader << "    return l.v.x > 0.5 ? l.f : -x;\n}\n";
+        shader << "float function" << index << "(Global g)\n{\n";
+        shader << "    return function" << index << "(g.v.y * g.f[0]);\n}\n";
+    }
+
+    shader << "void main()\n{\n";
+    shader << "    Global g = Global(u, float[2](u.x, u.y));\n";
+    shader << "    color = vec4(function" << (functionCount - 1) << "(g));\n}\n";
+    return shader.str();
+}
+
+class ParallelFunctionOutputTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+    }
+
+    std::string compile(ShShaderOutput output,
+                        const std::string &shaderString,
+                        ShCompileOptions options)
+    {
+        ShHandle compiler =
+            sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, output, &mResources);
+        EXPECT_NE(nullptr, compiler);
+        if (compiler == nullptr)
+        {
+            return "";
+        }
+
+        // Use other threads even on machines with a single core.
+        sh::SetFunctionOutputThreadCount(compiler, kThreadCount);
+
+        const char *shaderStrings[] = {shaderString.c_str()};
+        bool success                = sh::Compile(compiler, shaderStrings, 1, options);
+        EXPECT_TRUE(success) << sh::GetInfoLog(compiler);
+        std::string objectCode = sh::GetObjectCode(compiler);
+        sh::Destruct(compiler);
+        return objectCode;
+    }
+
+    void testOutputs(const std::string &shaderString, ShCompileOptions options)
+    {
+        std::vector<ShShaderOutput> outputs = {SH_ESSL_OUTPUT, SH_GLSL_COMPATIBILITY_OUTPUT,
+                                               SH_GLSL_450_CORE_OUTPUT};
+#if defined(ANGLE_ENABLE_VULKAN)
+        outputs.push_back(SH_GLSL_VULKAN_OUTPUT);
+#endif  // defined(ANGLE_ENABLE_VULKAN)
+
+        for (ShShaderOutput output : outputs)
+        {
+            SCOPED_TRACE(testing::Message() << "output " << output);
+            std::string expected = compile(output, shaderString, options);
+            std::string actual =
+                compile(output, shaderString, options | SH_PARALLEL_FUNCTION_OUTPUT);
+            EXPECT_FALSE(expected.empty());
+            EXPECT_EQ(expected, actual);
+        }
+    }
+
+    static constexpr int kThreadCount = 4;
+
+    ShBuiltInResources mResources;
+};
+
+// Test that a shader with many functions gives the same output.
+TEST_F(ParallelFunctionOutputTest, ManyFunctions)
+{
+    testOutputs(GenerateShader(100), SH_OBJECT_CODE);
+}
+
+// Test that a shader with too few functions to use other threads gives the same output.
+TEST_F(ParallelFunctionOutputTest, FewFunctions)
+{
+    testOutputs(GenerateShader(2), SH_OBJECT_CODE);
+}
+
+// Test that the output is the same together with options that add functions and temporary
+// variables.
+TEST_F(ParallelFunctionOutputTest, ManyFunctionsWithOtherOptions)
+{
+    testOutputs(GenerateShader(100), SH_OBJECT_CODE | SH_INITIALIZE_UNINITIALIZED_LOCALS |
+                                         SH_CLAMP_INDIRECT_ARRAY_BOUNDS | SH_OPTIMIZE_AST |
+                                         SH_REWRITE_FLOAT_UNARY_MINUS_OPERATOR);
+}
+
+// Test that the output is the same with hashed names. Hashing adds the names to a map shared by
+// every function, so the functions are then written on a single thread even with
+// SH_PARALLEL_FUNCTION_OUTPUT. This only checks that fallback.
+TEST_F(ParallelFunctionOutputTest, HashedNamesUseSingleThread)
+{
+    mResources.HashFunction = [](const char *str, size_t len) -> khronos_uint64_t {
+        khronos_uint64_t hash = 0;
+        for (size_t index = 0; index < len; ++index)
+        {
+            hash = hash * 31 + static_cast<unsigned char>(str[index]);
+        }
+        return hash;
+    };
+    testOutputs(GenerateShader(100), SH_OBJECT_CODE);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,234 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// RemoveUnusedOutputVaryings_test.cpp:
+//   Test that SH_REMOVE_UNUSED_OUTPUT_VARYINGS removes the vertex shader outputs set with
+//   sh::SetUnusedOutputVaryings together with the code that computes them.
+//
+
+#include <algorithm>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+class RemoveUnusedOutputVaryingsTest : public testing::Test
+{
+  protected:
+    void SetUp() override { sh::InitBuiltInResources(&mResources); }
+
+    void compile(const std::string &shaderString,
+                 const std::vector<std::string> &unusedOutputs,
+                 ShCompileOptions options = SH_REMOVE_UNUSED_OUTPUT_VARYINGS,
+                 ShShaderOutput output    = SH_ESSL_OUTPUT)
+    {
+        mObjectCode.clear();
+        mOutputVaryingNames.clear();
+
+        ShHandle compiler =
+            sh::ConstructCompiler(GL_VERTEX_SHADER, SH_GLES3_SPEC, output, &mResources);
+        ASSERT_NE(nullptr, compiler);
+
+        sh::SetUnusedOutputVaryings(compiler, unusedOutputs);
+        const char *shaderStrings[] = {shaderString.c_str()};
+        bool success =
+            sh::Compile(compiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES | options);
+        EXPECT_TRUE(success) << sh::GetInfoLog(compiler);
+
+        mObjectCode = sh::GetObjectCode(compiler);
+        for (const sh::Varying &varying : *sh::GetOutputVaryings(compiler))
+        {
+            mOutputVaryingNames.push_back(varying.name);
+        }
+        sh::Destruct(compiler);
+    }
+
+    bool foundInCode(const char *stringToFind) const
+    {
+        return mObjectCode.find(stringToFind) != std::string::npos;
+    }
+
+    bool isOutputVaryingReported(const std::string &name) const
+    {
+        return std::find(mOutputVaryingNames.begin(), mOutputVaryingNames.end(), name) !=
+               mOutputVaryingNames.end();
+    }
+
+    ShBuiltInResources mResources;
+    std::string mObjectCode;
+    std::vector<std::string> mOutputVaryingNames;
+};
+
+// Test that an unused output and the code that only computes its value are removed, while the
+// output is still reported.
+TEST_F(RemoveUnusedOutputVaryingsTest, UnusedOutputRemoved)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        in vec4 position;
+        uniform vec4 u;
+        out vec4 used;
+        out vec4 unused;
+        void main()
+        {
+            vec4 unusedValue = sin(u) * cos(u);
+            unused = unusedValue;
+            used = u;
+            gl_Position = position;
+        })";
+    compile(shaderString, {"unused"});
+
+    EXPECT_TRUE(foundInCode("out highp vec4 _uused;"));
+    EXPECT_FALSE(foundInCode("_uunused"));
+    EXPECT_FALSE(foundInCode("sin("));
+    EXPECT_TRUE(isOutputVaryingReported("used"));
+    EXPECT_TRUE(isOutputVaryingReported("unused"));
+}
+
+// Test that the names are ignored without SH_REMOVE_UNUSED_OUTPUT_VARYINGS.
+TEST_F(RemoveUnusedOutputVaryingsTest, NoRemovalWithoutOption)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        uniform vec4 u;
+        out vec4 unused;
+        void main()
+        {
+            unused = sin(u);
+            gl_Position = u;
+        })";
+    compile(shaderString, {"unused"}, 0);
+
+    EXPECT_TRUE(foundInCode("out highp vec4 _uunused;"));
+    EXPECT_TRUE(foundInCode("sin("));
+}
+
+// Test that partial writes to arrays, vectors and struct fields are removed.
+TEST_F(RemoveUnusedOutputVaryingsTest, PartialWritesRemoved)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        uniform vec4 u;
+        uniform int i;
+        struct S { vec2 a; float b; };
+        out vec4 unusedArray[2];
+        out vec3 unusedVector;
+        out S unusedStruct;
+        void main()
+        {
+            unusedArray[i] = sin(u);
+            unusedVector.yx = u.zw;
+            unusedStruct.b = u.x;
+            gl_Position = u;
+        })";
+    compile(shaderString, {"unusedArray", "unusedVector", "unusedStruct"});
+
+    EXPECT_FALSE(foundInCode("_uunused"));
+    EXPECT_FALSE(foundInCode("sin("));
+}
+
+// Test that an output that the shader reads back becomes a private variable, and that the writes
+// to it are kept.
+TEST_F(RemoveUnusedOutputVaryingsTest, OutputReadBackKept)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        uniform vec4 u;
+        out vec4 unused;
+        void main()
+        {
+            unused = sin(u);
+            gl_Position = unused;
+        })";
+    compile(shaderString, {"unused"});
+
+    EXPECT_FALSE(foundInCode("out highp vec4 _uunused"));
+    EXPECT_TRUE(foundInCode("highp vec4 _uunused;"));
+    EXPECT_TRUE(foundInCode("sin("));
+}
+
+// Test that a write with side effects is kept.
+TEST_F(RemoveUnusedOutputVaryingsTest, WriteWithSideEffectsKept)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        uniform vec4 u;
+        out vec4 unused[2];
+        void main()
+        {
+            int index = 0;
+            unused[index++] = u;
+            gl_Position = vec4(index);
+        })";
+    compile(shaderString, {"unused"});
+
+    EXPECT_FALSE(foundInCode("out highp vec4 _uunused"));
+    EXPECT_TRUE(foundInCode("_uindex++"));
+}
+
+// Test that the invariant declaration of a removed output is removed as well.
+TEST_F(RemoveUnusedOutputVaryingsTest, InvariantDeclarationRemoved)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        uniform vec4 u;
+        out vec4 unused;
+        invariant unused;
+        void main()
+        {
+            unused = u;
+            gl_Position = u;
+        })";
+    compile(shaderString, {"unused"});
+
+    EXPECT_FALSE(foundInCode("_uunused"));
+}
+
+// Test that names which aren't user-defined outputs are ignored.
+TEST_F(RemoveUnusedOutputVaryingsTest, OtherNamesIgnored)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        uniform vec4 u;
+        out vec4 used;
+        void main()
+        {
+            used = u;
+            gl_Position = u;
+        })";
+    compile(shaderString, {"u", "gl_Position", "missing"});
+
+    EXPECT_TRUE(foundInCode("out highp vec4 _uused;"));
+    EXPECT_TRUE(foundInCode("(gl_Position = _uu)"));
+}
+
+#if defined(ANGLE_ENABLE_VULKAN)
+// Test that no layout or qualifier markers are left for the removed output in Vulkan GLSL.
+TEST_F(RemoveUnusedOutputVaryingsTest, VulkanMarkersRemoved)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        uniform vec4 u;
+        out vec4 used;
+        out vec4 unused;
+        void main()
+        {
+            unused = sin(u);
+            used = u;
+            gl_Position = u;
+        })";
+    compile(shaderString, {"unused"}, SH_REMOVE_UNUSED_OUTPUT_VARYINGS, SH_GLSL_VULKAN_OUTPUT);
+
+    EXPECT_TRUE(foundInCode("@@ LAYOUT-used @@"));
+    EXPECT_FALSE(foundInCode("unused"));
+    EXPECT_FALSE(foundInCode("sin("));
+}
+#endif  // defined(ANGLE_ENABLE_VULKAN)
+
+}  // anonymous namespace
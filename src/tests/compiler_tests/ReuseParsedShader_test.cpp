@@ -0,0 +1,272 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReuseParsedShader_test.cpp:
+//   Test that recompiling a shader from the AST kept by SH_REUSE_PARSED_SHADER gives the same
+//   results as compiling it from scratch.
+//
+
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+struct CompileResults
+{
+    bool success;
+    std::string objectCode;
+    std::string infoLog;
+    std::vector<sh::Uniform> uniforms;
+    std::vector<sh::Varying> outputVaryings;
+};
+
+CompileResults CompileShader(ShHandle compiler, const char *shaderString, ShCompileOptions options)
+{
+    const char *shaderStrings[] = {shaderString};
+
+    CompileResults results;
+    results.success    = sh::Compile(compiler, shaderStrings, 1, options);
+    results.objectCode = sh::GetObjectCode(compiler);
+    results.infoLog    = sh::GetInfoLog(compiler);
+    if (results.success)
+    {
+        results.uniforms       = *sh::GetUniforms(compiler);
+        results.outputVaryings = *sh::GetOutputVaryings(compiler);
+    }
+    return results;
+}
+
+const char *kFragmentShader = R"(#extension GL_OES_standard_derivatives : warn
+precision mediump float;
+uniform vec4 u;
+uniform float uArray[4];
+uniform int uIndex;
+varying vec2 texCoord;
+float helper(float x);
+void main()
+{
+    struct S { float f; vec2 v; };
+    S s = S(u.x, texCoord);
+    float sum;
+    for (int i = 0; i < 4; ++i)
+    {
+        sum += helper(uArray[i]) * s.f;
+    }
+    bool condition = u.y > 0.5 && dFdx(texCoord.x) > 0.0;
+    do
+    {
+        sum += pow(s.v.x, 2.0);
+    } while (condition && sum < 1.0);
+    gl_FragColor = vec4(sum, uArray[uIndex], u.zw);
+}
+float helper(float x)
+{
+    return x * x;
+})";
+
+const char *kMultiviewVertexShader = R"(#version 300 es
+#extension GL_OVR_multiview : require
+layout(num_views = 2) in;
+precision highp float;
+in vec4 position;
+uniform vec4 u;
+flat out int instance;
+out vec4 color;
+void main()
+{
+    vec4 offset;
+    offset.x = gl_ViewID_OVR == 0u ? -1.0 : 1.0;
+    instance = gl_InstanceID;
+    color = u * float(gl_VertexID);
+    gl_Position = position + offset;
+    gl_PointSize = 2.0;
+})";
+
+const char *kInvalidShader = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(undeclared);
+})";
+
+class ReuseParsedShaderTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+        mResources.OES_standard_derivatives = 1;
+        mResources.OVR_multiview            = 1;
+        mResources.MaxViewsOVR              = 4;
+    }
+
+    void TearDown() override
+    {
+        for (ShHandle compiler : mCompilers)
+        {
+            sh::Destruct(compiler);
+        }
+    }
+
+    ShHandle constructCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
+    {
+        ShHandle compiler = sh::ConstructCompiler(type, spec, output, &mResources);
+        EXPECT_NE(nullptr, compiler);
+        mCompilers.push_back(compiler);
+        return compiler;
+    }
+
+    // Compiles the shader with |reusingCompiler| and with a new compiler that doesn't reuse
+    // anything, and checks that the results are the same.
+    void expectSameResults(ShHandle reusingCompiler,
+                           sh::GLenum type,
+                           ShShaderSpec spec,
+                           ShShaderOutput output,
+                           const char *shaderString,
+                           ShCompileOptions options)
+    {
+        ShHandle compiler = sh::ConstructCompiler(type, spec, output, &mResources);
+        ASSERT_NE(nullptr, compiler);
+        CompileResults expected = CompileShader(compiler, shaderString, options);
+        sh::Destruct(compiler);
+
+        CompileResults actual =
+            CompileShader(reusingCompiler, shaderString, options | SH_REUSE_PARSED_SHADER);
+        EXPECT_EQ(expected.success, actual.success) << actual.infoLog;
+        EXPECT_EQ(expected.objectCode, actual.objectCode);
+        EXPECT_EQ(expected.infoLog, actual.infoLog);
+        EXPECT_EQ(expected.uniforms, actual.uniforms);
+        EXPECT_EQ(expected.outputVaryings, actual.outputVaryings);
+    }
+
+    // Compiles the shader with each of |optionsList| twice in a row with one compiler, and checks
+    // the results against compiling from scratch.
+    void testOptionsList(sh::GLenum type,
+                         ShShaderSpec spec,
+                         ShShaderOutput output,
+                         const char *shaderString,
+                         const std::vector<ShCompileOptions> &optionsList)
+    {
+        ShHandle reusingCompiler = constructCompiler(type, spec, output);
+        ASSERT_NE(nullptr, reusingCompiler);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            for (ShCompileOptions options : optionsList)
+            {
+                SCOPED_TRACE(testing::Message() << "output " << output << ", options 0x"
+                                                << std::hex << options << ", pass " << pass);
+                expectSameResults(reusingCompiler, type, spec, output, shaderString, options);
+            }
+        }
+    }
+
+    std::vector<ShShaderOutput> getOutputs() const
+    {
+        std::vector<ShShaderOutput> outputs = {SH_ESSL_OUTPUT, SH_GLSL_COMPATIBILITY_OUTPUT,
+                                               SH_GLSL_450_CORE_OUTPUT};
+#if defined(ANGLE_ENABLE_HLSL)
+        outputs.push_back(SH_HLSL_4_1_OUTPUT);
+#endif  // defined(ANGLE_ENABLE_HLSL)
+#if defined(ANGLE_ENABLE_VULKAN)
+        outputs.push_back(SH_GLSL_VULKAN_OUTPUT);
+#endif  // defined(ANGLE_ENABLE_VULKAN)
+        return outputs;
+    }
+
+    ShBuiltInResources mResources;
+    std::vector<ShHandle> mCompilers;
+};
+
+// Test that a fragment shader compiled with different options gives the same results as when it's
+// compiled from scratch, including the warnings generated while parsing.
+TEST_F(ReuseParsedShaderTest, FragmentShaderWithDifferentOptions)
+{
+    const ShCompileOptions kBaseOptions             = SH_OBJECT_CODE | SH_VARIABLES;
+    const std::vector<ShCompileOptions> optionsList = {
+        kBaseOptions,
+        kBaseOptions | SH_UNFOLD_SHORT_CIRCUIT | SH_REWRITE_DO_WHILE_LOOPS,
+        kBaseOptions | SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES,
+        kBaseOptions | SH_CLAMP_INDIRECT_ARRAY_BOUNDS | SH_REMOVE_POW_WITH_CONSTANT_EXPONENT,
+        kBaseOptions | SH_VALIDATE_LOOP_INDEXING | SH_LIMIT_EXPRESSION_COMPLEXITY,
+        kBaseOptions | SH_REGENERATE_STRUCT_NAMES,
+        kBaseOptions | SH_OPTIMIZE_AST,
+        kBaseOptions | SH_INTERMEDIATE_TREE,
+    };
+
+    for (ShShaderOutput output : getOutputs())
+    {
+        testOptionsList(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, output, kFragmentShader, optionsList);
+    }
+
+    // The warning about using the extension is repeated when the kept AST is used.
+    ShHandle compiler = constructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        CompileResults results =
+            CompileShader(compiler, kFragmentShader, kBaseOptions | SH_REUSE_PARSED_SHADER);
+        EXPECT_NE(std::string::npos, results.infoLog.find("WARNING"));
+    }
+}
+
+// Test that a multiview vertex shader compiled with different options gives the same results as
+// when it's compiled from scratch.
+TEST_F(ReuseParsedShaderTest, VertexShaderWithDifferentOptions)
+{
+    const ShCompileOptions kBaseOptions             = SH_OBJECT_CODE | SH_VARIABLES;
+    const std::vector<ShCompileOptions> optionsList = {
+        kBaseOptions,
+        kBaseOptions | SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW,
+        kBaseOptions | SH_INIT_GL_POSITION | SH_CLAMP_POINT_SIZE,
+        kBaseOptions | SH_EMULATE_GL_DRAW_ID | SH_REWRITE_VECTOR_SCALAR_ARITHMETIC,
+        kBaseOptions | SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_DONT_PRUNE_UNUSED_FUNCTIONS,
+    };
+
+    for (ShShaderOutput output : getOutputs())
+    {
+        testOptionsList(GL_VERTEX_SHADER, SH_GLES3_SPEC, output, kMultiviewVertexShader,
+                        optionsList);
+    }
+}
+
+// Test that a compiler that kept the AST of one shader parses a different shader.
+TEST_F(ReuseParsedShaderTest, DifferentShaders)
+{
+    const ShCompileOptions kOptions = SH_OBJECT_CODE | SH_VARIABLES;
+    const char *kOtherShader        = R"(precision mediump float;
+uniform vec4 u;
+void main()
+{
+    gl_FragColor = u;
+})";
+
+    ShHandle compiler = constructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT);
+    expectSameResults(compiler, GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT,
+                      kFragmentShader, kOptions);
+    expectSameResults(compiler, GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT, kOtherShader,
+                      kOptions);
+    expectSameResults(compiler, GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT,
+                      kFragmentShader, kOptions);
+}
+
+// Test that a shader that fails to compile keeps failing with the same errors, and that the
+// compiler keeps working after it.
+TEST_F(ReuseParsedShaderTest, InvalidShader)
+{
+    const ShCompileOptions kOptions = SH_OBJECT_CODE | SH_VARIABLES;
+
+    ShHandle compiler = constructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        expectSameResults(compiler, GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT,
+                          kInvalidShader, kOptions);
+    }
+    expectSameResults(compiler, GL_FRAGMENT_SHADER, SH_GLES2_SPEC, SH_ESSL_OUTPUT,
+                      kFragmentShader, kOptions);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,186 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SPIRVOutput_test.cpp:
+//   Tests the SPIR-V generated by the Vulkan translator with SH_GENERATE_SPIRV.  The modules are
+//   checked with the SPIR-V validator.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/spirv_constants.h"
+#include "gtest/gtest.h"
+#include "spirv-tools/libspirv.hpp"
+
+namespace
+{
+
+class SPIRVOutputTest : public testing::Test
+{
+  public:
+    SPIRVOutputTest() {}
+
+  protected:
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+            mCompiler = nullptr;
+        }
+    }
+
+    bool compile(GLenum shaderType, const char *shaderString)
+    {
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+
+        mCompiler = sh::ConstructCompiler(shaderType, SH_GLES3_SPEC, SH_GLSL_VULKAN_OUTPUT,
+                                          &resources);
+        EXPECT_NE(nullptr, mCompiler);
+
+        const char *shaderStrings[] = {shaderString};
+        return sh::Compile(mCompiler, shaderStrings, 1,
+                           SH_OBJECT_CODE | SH_VARIABLES | SH_INITIALIZE_UNINITIALIZED_LOCALS |
+                               SH_GENERATE_SPIRV);
+    }
+
+    void expectValidModule(bool lineRasterEmulation)
+    {
+        const std::vector<uint32_t> *spirv = sh::GetSPIRVCode(mCompiler, lineRasterEmulation);
+        ASSERT_NE(nullptr, spirv);
+        ASSERT_GT(spirv->size(), angle::spirv::kHeaderWordCount);
+        EXPECT_EQ(angle::spirv::MagicNumber, (*spirv)[0]);
+        EXPECT_EQ(angle::spirv::kVersion1_0, (*spirv)[1]);
+
+        std::string messages;
+        spvtools::SpirvTools spirvTools(SPV_ENV_VULKAN_1_0);
+        spirvTools.SetMessageConsumer(
+            [&messages](spv_message_level_t, const char *, const spv_position_t &position,
+                        const char *message) {
+                messages += "word " + std::to_string(position.index) + ": " + message + "\n";
+            });
+        EXPECT_TRUE(spirvTools.Validate(*spirv)) << messages;
+    }
+
+    ShHandle mCompiler = nullptr;
+};
+
+// Test that SPIR-V is generated for a simple vertex shader, with and without line raster
+// emulation.
+TEST_F(SPIRVOutputTest, VertexShader)
+{
+    const char kShader[] = R"(attribute vec4 position;
+attribute vec2 uv;
+uniform mat4 transform;
+varying vec2 v_uv;
+void main()
+{
+    v_uv = uv;
+    gl_Position = transform * position;
+})";
+    ASSERT_TRUE(compile(GL_VERTEX_SHADER, kShader));
+    expectValidModule(false);
+    expectValidModule(true);
+}
+
+// Test that SPIR-V is generated for a fragment shader with control flow and texture sampling.
+TEST_F(SPIRVOutputTest, FragmentShader)
+{
+    const char kShader[] = R"(precision mediump float;
+uniform sampler2D s;
+varying vec2 v_uv;
+void main()
+{
+    vec4 color = texture2D(s, v_uv);
+    if (color.a < 0.5)
+    {
+        discard;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        color.rgb *= 0.5;
+    }
+    gl_FragColor = color.a > 0.75 ? color : vec4(0.0);
+})";
+    ASSERT_TRUE(compile(GL_FRAGMENT_SHADER, kShader));
+    expectValidModule(false);
+    expectValidModule(true);
+}
+
+// Test that SPIR-V is generated for user-defined functions with in, out and inout parameters.
+TEST_F(SPIRVOutputTest, Functions)
+{
+    const char kShader[] = R"(precision mediump float;
+uniform vec4 color;
+float scale(float value, float factor)
+{
+    return value * factor;
+}
+void split(vec4 value, out vec3 rgb, inout float alpha)
+{
+    rgb = value.rgb;
+    alpha *= value.a;
+}
+void main()
+{
+    vec3 rgb;
+    float alpha = scale(color.a, 2.0);
+    split(color, rgb, alpha);
+    gl_FragColor = vec4(rgb, alpha);
+})";
+    ASSERT_TRUE(compile(GL_FRAGMENT_SHADER, kShader));
+    expectValidModule(false);
+    expectValidModule(true);
+}
+
+// Test that SPIR-V is generated for structs, arrays and matrices in uniforms and locals.
+TEST_F(SPIRVOutputTest, Aggregates)
+{
+    const char kShader[] = R"(attribute vec4 position;
+struct Light
+{
+    vec3 direction;
+    float intensity;
+};
+uniform Light lights[2];
+uniform mat4 transform;
+uniform mat3 normalMatrix;
+varying float v_light;
+void main()
+{
+    vec3 normal = normalMatrix * position.xyz;
+    float weights[2];
+    weights[0] = 0.25;
+    weights[1] = 0.75;
+    v_light = 0.0;
+    for (int i = 0; i < 2; ++i)
+    {
+        v_light += weights[i] * lights[i].intensity * max(dot(normal, lights[i].direction), 0.0);
+    }
+    gl_Position = transform * position;
+})";
+    ASSERT_TRUE(compile(GL_VERTEX_SHADER, kShader));
+    expectValidModule(false);
+    expectValidModule(true);
+}
+
+// Test that no SPIR-V is generated for ESSL 3.00 shaders, which still translate to GLSL.
+TEST_F(SPIRVOutputTest, NoSPIRVForESSL300)
+{
+    const char kShader[] = R"(#version 300 es
+precision mediump float;
+out vec4 color;
+void main()
+{
+    color = vec4(1.0);
+})";
+    ASSERT_TRUE(compile(GL_FRAGMENT_SHADER, kShader));
+    EXPECT_EQ(nullptr, sh::GetSPIRVCode(mCompiler, false));
+    EXPECT_EQ(nullptr, sh::GetSPIRVCode(mCompiler, true));
+    EXPECT_FALSE(sh::GetObjectCode(mCompiler).empty());
+}
+
+}  // anonymous namespace
@@ -0,0 +1,280 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLDmaBufImageTest.cpp:
+//   Tests for the EGL_EXT_image_dma_buf_import extension.  Buffers are allocated from a sealed
+//   memfd and exported as dma-bufs through /dev/udmabuf, which stands in for a gbm allocator.
+//   The attributes are validated before the buffer is imported, so the validation tests only need
+//   a file descriptor and run even where /dev/udmabuf isn't available.
+//
+
+#include "test_utils/ANGLETest.h"
+
+#include <fcntl.h>
+#include <linux/ioctl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr char kDmaBufImportExt[] = "EGL_EXT_image_dma_buf_import";
+
+#ifndef MFD_ALLOW_SEALING
+#    define MFD_ALLOW_SEALING 0x0002U
+#endif
+
+// Taken from linux/udmabuf.h, which older sysroots don't have.
+struct UdmabufCreate
+{
+    uint32_t memfd;
+    uint32_t flags;
+    uint64_t offset;
+    uint64_t size;
+};
+constexpr unsigned long kUdmabufCreate = _IOW('u', 0x42, UdmabufCreate);
+
+// Little-endian DRM_FORMAT_ABGR8888, which is RGBA in memory.
+constexpr EGLint kFourCCABGR8888 = 'A' | ('B' << 8) | ('2' << 16) | ('4' << 24);
+// DRM_FORMAT_NV12, a two-plane YUV format.
+constexpr EGLint kFourCCNV12 = 'N' | ('V' << 8) | ('1' << 16) | ('2' << 24);
+
+// A CPU-visible dma-buf backed by a memfd.
+class ScopedDmaBuf : angle::NonCopyable
+{
+  public:
+    ScopedDmaBuf(size_t size)
+    {
+        mMemFd = static_cast<int>(syscall(SYS_memfd_create, "angle_dmabuf", MFD_ALLOW_SEALING));
+        if (mMemFd < 0 || ftruncate(mMemFd, size) != 0 ||
+            fcntl(mMemFd, F_ADD_SEALS, F_SEAL_SHRINK) != 0)
+        {
+            return;
+        }
+
+        void *pixels = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, mMemFd, 0);
+        if (pixels == MAP_FAILED)
+        {
+            return;
+        }
+        mPixels = static_cast<GLubyte *>(pixels);
+        mSize   = size;
+
+        int udmabuf = open("/dev/udmabuf", O_RDWR);
+        if (udmabuf < 0)
+        {
+            return;
+        }
+
+        UdmabufCreate create = {};
+        create.memfd         = static_cast<uint32_t>(mMemFd);
+        create.size          = size;
+        mDmaBufFd            = ioctl(udmabuf, kUdmabufCreate, &create);
+        close(udmabuf);
+    }
+
+    ~ScopedDmaBuf()
+    {
+        if (mPixels != nullptr)
+        {
+            munmap(mPixels, mSize);
+        }
+        if (mDmaBufFd >= 0)
+        {
+            close(mDmaBufFd);
+        }
+        if (mMemFd >= 0)
+        {
+            close(mMemFd);
+        }
+    }
+
+    bool valid() const { return mDmaBufFd >= 0 && mPixels != nullptr; }
+    int fd() const { return mDmaBufFd; }
+    int memFd() const { return mMemFd; }
+    GLubyte *pixels() const { return mPixels; }
+
+  private:
+    int mMemFd       = -1;
+    int mDmaBufFd    = -1;
+    GLubyte *mPixels = nullptr;
+    size_t mSize     = 0;
+};
+}  // anonymous namespace
+
+class EGLDmaBufImageTest : public ANGLETest
+{
+  protected:
+    static constexpr EGLint kWidth  = 64;
+    static constexpr EGLint kHeight = 64;
+    static constexpr EGLint kPitch  = kWidth * 4;
+
+    EGLDmaBufImageTest()
+    {
+        setWindowWidth(kWidth);
+        setWindowHeight(kHeight);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+        mDisplay = getEGLWindow()->getDisplay();
+
+        eglCreateImageKHR =
+            reinterpret_cast<PFNEGLCREATEIMAGEKHRPROC>(eglGetProcAddress("eglCreateImageKHR"));
+        eglDestroyImageKHR =
+            reinterpret_cast<PFNEGLDESTROYIMAGEKHRPROC>(eglGetProcAddress("eglDestroyImageKHR"));
+    }
+
+    bool hasDmaBufImportExt() const
+    {
+        return eglDisplayExtensionEnabled(mDisplay, kDmaBufImportExt);
+    }
+
+    EGLImageKHR createImage(EGLint fd, EGLint fourcc, EGLint pitch) const
+    {
+        // clang-format off
+        const EGLint attribs[] = {
+            EGL_WIDTH,                     kWidth,
+            EGL_HEIGHT,                    kHeight,
+            EGL_LINUX_DRM_FOURCC_EXT,      fourcc,
+            EGL_DMA_BUF_PLANE0_FD_EXT,     fd,
+            EGL_DMA_BUF_PLANE0_OFFSET_EXT, 0,
+            EGL_DMA_BUF_PLANE0_PITCH_EXT,  pitch,
+            EGL_NONE,
+        };
+        // clang-format on
+
+        return eglCreateImageKHR(mDisplay, EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT, nullptr, attribs);
+    }
+
+    EGLDisplay mDisplay = EGL_NO_DISPLAY;
+
+    PFNEGLCREATEIMAGEKHRPROC eglCreateImageKHR   = nullptr;
+    PFNEGLDESTROYIMAGEKHRPROC eglDestroyImageKHR = nullptr;
+};
+
+// Tests the error cases of creating images from dma-bufs.
+TEST_P(EGLDmaBufImageTest, Validation)
+{
+    ANGLE_SKIP_TEST_IF(!hasDmaBufImportExt());
+
+    ScopedDmaBuf dmaBuf(kPitch * kHeight);
+    ASSERT_GE(dmaBuf.memFd(), 0);
+
+    // None of the attributes below make it to the import, so the memfd is as good as a dma-buf.
+    const EGLint fd = dmaBuf.memFd();
+
+    // Missing plane attributes.
+    const EGLint missingAttribs[] = {
+        EGL_WIDTH, kWidth, EGL_HEIGHT, kHeight, EGL_LINUX_DRM_FOURCC_EXT, kFourCCABGR8888, EGL_NONE,
+    };
+    EXPECT_EQ(EGL_NO_IMAGE_KHR, eglCreateImageKHR(mDisplay, EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT,
+                                                  nullptr, missingAttribs));
+    EXPECT_EGL_ERROR(EGL_BAD_PARAMETER);
+
+    // Multi-planar formats aren't supported.
+    EXPECT_EQ(EGL_NO_IMAGE_KHR, createImage(fd, kFourCCNV12, kPitch));
+    EXPECT_EGL_ERROR(EGL_BAD_MATCH);
+
+    // Neither are extra planes for a single-plane format.
+    // clang-format off
+    const EGLint extraPlaneAttribs[] = {
+        EGL_WIDTH,                     kWidth,
+        EGL_HEIGHT,                    kHeight,
+        EGL_LINUX_DRM_FOURCC_EXT,      kFourCCABGR8888,
+        EGL_DMA_BUF_PLANE0_FD_EXT,     fd,
+        EGL_DMA_BUF_PLANE0_OFFSET_EXT, 0,
+        EGL_DMA_BUF_PLANE0_PITCH_EXT,  kPitch,
+        EGL_DMA_BUF_PLANE1_FD_EXT,     fd,
+        EGL_DMA_BUF_PLANE1_OFFSET_EXT, 0,
+        EGL_DMA_BUF_PLANE1_PITCH_EXT,  kPitch,
+        EGL_NONE,
+    };
+    // clang-format on
+    EXPECT_EQ(EGL_NO_IMAGE_KHR, eglCreateImageKHR(mDisplay, EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT,
+                                                  nullptr, extraPlaneAttribs));
+    EXPECT_EGL_ERROR(EGL_BAD_ATTRIBUTE);
+
+    // The pitch must fit a row.
+    EXPECT_EQ(EGL_NO_IMAGE_KHR, createImage(fd, kFourCCABGR8888, kPitch - 4));
+    EXPECT_EGL_ERROR(EGL_BAD_ACCESS);
+}
+
+// Tests that a texture targeting a dma-buf image samples the buffer's memory in place, so CPU
+// writes to the buffer are seen without another upload.
+TEST_P(EGLDmaBufImageTest, SampleWithoutCopy)
+{
+    ANGLE_SKIP_TEST_IF(!hasDmaBufImportExt() || !extensionEnabled("GL_OES_EGL_image"));
+
+    ScopedDmaBuf dmaBuf(kPitch * kHeight);
+    ANGLE_SKIP_TEST_IF(!dmaBuf.valid());
+
+    auto fill = [&dmaBuf](const GLColor &color) {
+        for (EGLint texel = 0; texel < kWidth * kHeight; ++texel)
+        {
+            memcpy(dmaBuf.pixels() + texel * 4, &color.R, 4);
+        }
+    };
+    fill(GLColor::red);
+
+    // Importing the buffer must not move the file offset that the application shares with the
+    // imported descriptor.
+    ASSERT_EQ(4, lseek(dmaBuf.fd(), 4, SEEK_SET));
+
+    EGLImageKHR image = createImage(dmaBuf.fd(), kFourCCABGR8888, kPitch);
+    EXPECT_EQ(4, lseek(dmaBuf.fd(), 0, SEEK_CUR));
+
+    // The driver may not be able to alias a buffer with this pitch.
+    ANGLE_SKIP_TEST_IF(image == EGL_NO_IMAGE_KHR && eglGetError() == EGL_BAD_ACCESS);
+    ASSERT_NE(EGL_NO_IMAGE_KHR, image);
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, image);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    constexpr char kVS[] = R"(attribute vec4 position;
+varying vec2 texcoord;
+void main()
+{
+    gl_Position = position;
+    texcoord = position.xy * 0.5 + 0.5;
+})";
+    constexpr char kFS[] = R"(precision mediump float;
+uniform sampler2D tex;
+varying vec2 texcoord;
+void main()
+{
+    gl_FragColor = texture2D(tex, texcoord);
+})";
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(kWidth / 2, kHeight / 2, GLColor::red);
+
+    glFinish();
+    fill(GLColor::green);
+
+    drawQuad(program, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(kWidth / 2, kHeight / 2, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+
+    eglDestroyImageKHR(mDisplay, image);
+}
+
+ANGLE_INSTANTIATE_TEST(EGLDmaBufImageTest, ES2_VULKAN());
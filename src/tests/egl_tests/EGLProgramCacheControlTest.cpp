@@ -239,6 +239,86 @@ TEST_P(EGLProgramCacheControlTest, SaveAndReload)
     EXPECT_TRUE(mCachedBinary.empty());
 }
 
+// Tests that compiling a shader that was compiled before loads it from the cache, even when the
+// program it's linked into is not in the cache.
+TEST_P(EGLProgramCacheControlTest, ReuseCompiledShaders)
+{
+    ANGLE_SKIP_TEST_IF(!extensionAvailable() || !programBinaryAvailable());
+
+    constexpr char kVS[] = R"(attribute vec4 position;
+attribute float attribValue;
+varying float value;
+void main()
+{
+    value       = attribValue;
+    gl_Position = position;
+})";
+
+    constexpr char kRedFS[] = R"(precision mediump float;
+uniform vec4 color;
+varying float value;
+void main()
+{
+    gl_FragColor = vec4(color.r, value, 0.0, 1.0);
+})";
+
+    constexpr char kGreenFS[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = vec4(0.0, color.g, 0.0, 1.0);
+})";
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    // Links a program from new shader objects, and checks that it works like the first time the
+    // shaders were compiled.
+    auto linkAndDraw = [&](const char *fs, const GLColor &expectedColor) {
+        ANGLE_GL_PROGRAM(program, kVS, fs);
+
+        GLint colorLocation = glGetUniformLocation(program, "color");
+        ASSERT_NE(-1, colorLocation);
+        glUseProgram(program);
+        glUniform4f(colorLocation, 1.0f, 1.0f, 0.0f, 1.0f);
+
+        GLint valueLocation = glGetAttribLocation(program, "attribValue");
+        if (valueLocation != -1)
+        {
+            glVertexAttrib1f(valueLocation, 0.0f);
+        }
+
+        drawQuad(program, "position", 0.5f);
+        EXPECT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(0, 0, expectedColor);
+    };
+
+    // Compiling the shaders for the first time misses the cache. The compiled shaders are cached
+    // apart from the programs, so only the program shows up in the cache.
+    linkAndDraw(kRedFS, GLColor::red);
+    EXPECT_EQ(1, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+
+    // The vertex shader is loaded from the cache, and the new program is added.
+    linkAndDraw(kGreenFS, GLColor::green);
+    EXPECT_EQ(2, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+
+    // Linking the same shaders again hits the cache for the shaders and the program.
+    linkAndDraw(kRedFS, GLColor::red);
+    linkAndDraw(kGreenFS, GLColor::green);
+    EXPECT_EQ(2, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+
+    // After the programs are trimmed from the cache, the program is linked from the cached shaders.
+    eglProgramCacheResizeANGLE(display, 0, EGL_PROGRAM_CACHE_TRIM_ANGLE);
+    EXPECT_EQ(0, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+    linkAndDraw(kGreenFS, GLColor::green);
+    EXPECT_EQ(1, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+
+    // Resizing the cache drops the compiled shaders too, and they are compiled again.
+    eglProgramCacheResizeANGLE(display, kEnabledCacheSize, EGL_PROGRAM_CACHE_RESIZE_ANGLE);
+    EXPECT_EQ(0, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+    linkAndDraw(kRedFS, GLColor::red);
+    EXPECT_EQ(1, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+}
+
 // Tests that trying to link a program without correct shaders doesn't buggily call the cache.
 TEST_P(EGLProgramCacheControlTest, LinkProgramWithBadShaders)
 {
@@ -736,6 +736,139 @@ TEST_P(GLSLTest, ReleaseCompilerThenCompile)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
 }
 
+// Test that a program renders correctly when the vertex shader writes varyings that the fragment
+// shader doesn't read, with some of them only declared in the fragment shader.
+TEST_P(GLSLTest, UnusedVaryingsNotReadByFragmentShader)
+{
+    constexpr char kVS[] = R"(attribute vec4 a_position;
+uniform float u_value;
+varying vec4 v_used;
+varying vec4 v_unused;
+varying float v_declaredOnly;
+void main()
+{
+    vec4 unusedValue = vec4(0.0);
+    for (int i = 0; i < 8; ++i)
+    {
+        unusedValue += sin(a_position * float(i) + u_value);
+    }
+    v_unused       = unusedValue;
+    v_declaredOnly = cos(u_value);
+    v_used         = vec4(0.0, 1.0, 0.0, 1.0);
+    gl_Position    = a_position;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec4 v_used;
+varying float v_declaredOnly;
+void main()
+{
+    gl_FragColor = v_used;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+// Test that a varying that the fragment shader doesn't read keeps its value in the vertex shader
+// when the vertex shader reads it back.
+TEST_P(GLSLTest, UnusedVaryingReadBackInVertexShader)
+{
+    constexpr char kVS[] = R"(attribute vec4 a_position;
+varying vec4 v_used;
+varying vec4 v_unused;
+void main()
+{
+    v_unused    = vec4(0.0, 1.0, 0.0, 1.0);
+    v_used      = v_unused;
+    gl_Position = a_position;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec4 v_used;
+void main()
+{
+    gl_FragColor = v_used;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+// Test that the same vertex shader can be linked with fragment shaders that read different
+// varyings, and that changing its source after compiling it doesn't affect the link.
+TEST_P(GLSLTest, VertexShaderLinkedWithFragmentShadersReadingDifferentVaryings)
+{
+    constexpr char kVS[] = R"(attribute vec4 a_position;
+varying vec4 v_red;
+varying vec4 v_green;
+void main()
+{
+    v_red       = vec4(1.0, 0.0, 0.0, 1.0);
+    v_green     = vec4(0.0, 1.0, 0.0, 1.0);
+    gl_Position = a_position;
+})";
+
+    constexpr char kFSRed[] = R"(precision mediump float;
+varying vec4 v_red;
+void main()
+{
+    gl_FragColor = v_red;
+})";
+
+    constexpr char kFSGreen[] = R"(precision mediump float;
+varying vec4 v_green;
+void main()
+{
+    gl_FragColor = v_green;
+})";
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, kVS);
+    ASSERT_NE(0u, vs);
+
+    // Linking uses the last compiled source, not the current one.
+    const char *newSource = "invalid";
+    glShaderSource(vs, 1, &newSource, nullptr);
+
+    GLuint fsRed   = CompileShader(GL_FRAGMENT_SHADER, kFSRed);
+    GLuint fsGreen = CompileShader(GL_FRAGMENT_SHADER, kFSGreen);
+    ASSERT_NE(0u, fsRed);
+    ASSERT_NE(0u, fsGreen);
+
+    GLuint programRed = glCreateProgram();
+    glAttachShader(programRed, vs);
+    glAttachShader(programRed, fsRed);
+    glLinkProgram(programRed);
+    programRed = CheckLinkStatusAndReturnProgram(programRed, true);
+
+    GLuint programGreen = glCreateProgram();
+    glAttachShader(programGreen, vs);
+    glAttachShader(programGreen, fsGreen);
+    glLinkProgram(programGreen);
+    programGreen = CheckLinkStatusAndReturnProgram(programGreen, true);
+
+    glDeleteShader(vs);
+    glDeleteShader(fsRed);
+    glDeleteShader(fsGreen);
+    ASSERT_NE(0u, programRed);
+    ASSERT_NE(0u, programGreen);
+
+    drawQuad(programRed, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    drawQuad(programGreen, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glDeleteProgram(programRed);
+    glDeleteProgram(programGreen);
+}
+
 // Verify that linking shaders declaring different shading language versions fails.
 TEST_P(GLSLTest_ES3, VersionMismatch)
 {
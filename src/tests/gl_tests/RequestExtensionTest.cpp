@@ -10,6 +10,7 @@
 
 #include "test_utils/ANGLETest.h"
 
+#include "test_utils/gl_raii.h"
 #include "util/EGLWindow.h"
 
 namespace angle
@@ -67,6 +68,41 @@ TEST_P(RequestExtensionTest, Queries)
     }
 }
 
+// Test that requesting an extension in one context doesn't enable it in other contexts created
+// with the same attributes, which share their caps until then.
+TEST_P(RequestExtensionTest, RequestedExtensionsAreNotShared)
+{
+    ANGLE_SKIP_TEST_IF(!extensionRequestable("GL_OES_rgb8_rgba8"));
+
+    EGLWindow *window   = getEGLWindow();
+    EGLDisplay display  = window->getDisplay();
+    EGLSurface surface  = window->getSurface();
+    EGLContext context1 = window->getContext();
+
+    EGLContext context2 = window->createContext(EGL_NO_CONTEXT);
+    ASSERT_NE(EGL_NO_CONTEXT, context2);
+
+    glRequestExtensionANGLE("GL_OES_rgb8_rgba8");
+    EXPECT_TRUE(extensionEnabled("GL_OES_rgb8_rgba8"));
+
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, context2));
+    EXPECT_FALSE(extensionEnabled("GL_OES_rgb8_rgba8"));
+
+    // The renderbuffer format of the extension should still be rejected by the second context.
+    GLRenderbuffer renderbuffer;
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8_OES, 1, 1);
+    if (getClientMajorVersion() < 3)
+    {
+        EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    }
+
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, surface, surface, context1));
+    EXPECT_TRUE(extensionEnabled("GL_OES_rgb8_rgba8"));
+
+    EXPECT_EGL_TRUE(eglDestroyContext(display, context2));
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these
 // tests should be run against.
 ANGLE_INSTANTIATE_TEST(RequestExtensionTest,
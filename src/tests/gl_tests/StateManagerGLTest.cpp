@@ -0,0 +1,169 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// StateManagerGLTest:
+//   Tests that the GL back-end only sends the bindings that changed between draws to the driver,
+//   using the binding calls counted by StateManagerGL and the native calls counted by the
+//   NULL/stub bindings.
+//
+
+// 'None' is defined as 'struct None {};' in
+// third_party/googletest/src/googletest/include/gtest/internal/gtest-type-util.h.
+// But 'None' is also defined as a numeric constant 0L in <X11/X.h>, which the EGL headers
+// include on Linux.  So we need to include ANGLETest.h first to avoid this conflict.
+#include "test_utils/ANGLETest.h"
+
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/null_functions.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+
+class StateManagerGLTest : public ANGLETest
+{
+  protected:
+    StateManagerGLTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+    }
+
+    void setupTexture(GLuint texture)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    uint64_t countBindingCallsForDraw()
+    {
+        // Hack the angle!
+        gl::Context *context = static_cast<gl::Context *>(getEGLWindow()->getContext());
+        const rx::StateManagerGL *stateManager =
+            rx::GetImplAs<rx::ContextGL>(context)->getStateManager();
+
+        uint64_t callsBefore = stateManager->getBindingCallCount();
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        return stateManager->getBindingCallCount() - callsBefore;
+    }
+
+    size_t countNativeCallsForDraw()
+    {
+        rx::ResetNullFunctionCallCount();
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        return rx::GetNullFunctionCallCount();
+    }
+};
+
+// Tests that changing the texture of one unit doesn't touch the other units the program samples.
+TEST_P(StateManagerGLTest, TextureChangeOnlyBindsChangedUnit)
+{
+    constexpr char kFS[] = R"(precision mediump float;
+uniform sampler2D tex0;
+uniform sampler2D tex1;
+void main()
+{
+    gl_FragColor = texture2D(tex0, vec2(0)) + texture2D(tex1, vec2(0));
+})";
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kFS);
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "tex0"), 0);
+    glUniform1i(glGetUniformLocation(program, "tex1"), 1);
+
+    GLTexture textures[3];
+    for (GLTexture &texture : textures)
+    {
+        setupTexture(texture);
+    }
+
+    // Bind every texture once so that none of them have pending syncs.
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, textures[0]);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, textures[2]);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindTexture(GL_TEXTURE_2D, textures[1]);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    EXPECT_EQ(0u, countBindingCallsForDraw());
+
+    // One glBindTexture or glBindTextures, and no glActiveTexture.
+    glBindTexture(GL_TEXTURE_2D, textures[2]);
+    EXPECT_EQ(1u, countBindingCallsForDraw());
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that a draw without any state change re-sends no binding.
+TEST_P(StateManagerGLTest, RedundantDrawIsStable)
+{
+    constexpr char kFS[] = R"(precision mediump float;
+uniform sampler2D tex;
+void main()
+{
+    gl_FragColor = texture2D(tex, vec2(0));
+})";
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kFS);
+    glUseProgram(program);
+
+    GLTexture texture;
+    setupTexture(texture);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    EXPECT_EQ(0u, countBindingCallsForDraw());
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that a texture change costs exactly one more native call than an unchanged draw, counting
+// every call the back-end makes and not only the bindings.
+TEST_P(StateManagerGLTest, TextureChangeCostsOneNativeCall)
+{
+    constexpr char kFS[] = R"(precision mediump float;
+uniform sampler2D tex0;
+uniform sampler2D tex1;
+void main()
+{
+    gl_FragColor = texture2D(tex0, vec2(0)) + texture2D(tex1, vec2(0));
+})";
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kFS);
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "tex0"), 0);
+    glUniform1i(glGetUniformLocation(program, "tex1"), 1);
+
+    GLTexture textures[3];
+    for (GLTexture &texture : textures)
+    {
+        setupTexture(texture);
+    }
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, textures[0]);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, textures[2]);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindTexture(GL_TEXTURE_2D, textures[1]);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    size_t unchangedDrawCalls = countNativeCallsForDraw();
+    EXPECT_EQ(unchangedDrawCalls, countNativeCallsForDraw());
+
+    glBindTexture(GL_TEXTURE_2D, textures[2]);
+    EXPECT_EQ(unchangedDrawCalls + 1, countNativeCallsForDraw());
+    ASSERT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST(StateManagerGLTest, PlatformParameters(2, 0, egl_platform::OPENGL_NULL()));
+
+}  // anonymous namespace
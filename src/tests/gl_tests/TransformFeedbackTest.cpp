@@ -5,6 +5,8 @@
 //
 
 #include "test_utils/ANGLETest.h"
+
+#include "platform/FeaturesVk.h"
 #include "test_utils/gl_raii.h"
 #include "util/EGLWindow.h"
 #include "util/random_utils.h"
@@ -64,6 +66,13 @@ class TransformFeedbackTestBase : public ANGLETest
         ANGLETest::TearDown();
     }
 
+    // Keep the Vulkan transform feedback emulation on, so that these tests cover it even on
+    // devices where it would be turned off.
+    void overrideFeaturesVk(FeaturesVk *featuresVk) override
+    {
+        featuresVk->emulateTransformFeedback = true;
+    }
+
     GLuint mProgram;
 
     static const size_t mTransformFeedbackBufferSize = 1 << 24;
@@ -1493,8 +1502,16 @@ TEST_P(TransformFeedbackTest, NoTransformFeedbackVaryingsInUse)
 
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these
 // tests should be run against.
-ANGLE_INSTANTIATE_TEST(TransformFeedbackTest, ES3_D3D11(), ES3_OPENGL(), ES3_OPENGLES());
-ANGLE_INSTANTIATE_TEST(TransformFeedbackLifetimeTest, ES3_D3D11(), ES3_OPENGL(), ES3_OPENGLES());
+ANGLE_INSTANTIATE_TEST(TransformFeedbackTest,
+                       ES3_D3D11(),
+                       ES3_OPENGL(),
+                       ES3_OPENGLES(),
+                       ES3_VULKAN());
+ANGLE_INSTANTIATE_TEST(TransformFeedbackLifetimeTest,
+                       ES3_D3D11(),
+                       ES3_OPENGL(),
+                       ES3_OPENGLES(),
+                       ES3_VULKAN());
 ANGLE_INSTANTIATE_TEST(TransformFeedbackTestES31, ES31_D3D11(), ES31_OPENGL(), ES31_OPENGLES());
 
 }  // anonymous namespace
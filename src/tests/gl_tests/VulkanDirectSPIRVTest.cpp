@@ -0,0 +1,192 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VulkanDirectSPIRVTest:
+//   Draws with programs that use the SPIR-V generated by the translator, with the
+//   directSPIRVGeneration feature enabled, instead of compiling the translated GLSL with glslang.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+// 'None' is defined as 'struct None {};' in
+// third_party/googletest/src/googletest/include/gtest/internal/gtest-type-util.h.
+// But 'None' is also defined as a numeric constant 0L in <X11/X.h>.
+// So we need to include ANGLETest.h first to avoid this conflict.
+
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/vulkan/ProgramVk.h"
+#include "platform/FeaturesVk.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+
+class VulkanDirectSPIRVTest : public ANGLETest
+{
+  protected:
+    VulkanDirectSPIRVTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void overrideFeaturesVk(FeaturesVk *featuresVk) override
+    {
+        featuresVk->directSPIRVGeneration = true;
+    }
+
+    bool usesTranslatorSPIRV(GLuint handle) const
+    {
+        // Hack the angle!
+        const gl::Context *context = static_cast<gl::Context *>(getEGLWindow()->getContext());
+        const gl::Program *program = context->getProgramResolveLink(handle);
+        return rx::vk::GetImpl(program)->usesTranslatorSPIRVForTesting();
+    }
+};
+
+// Draw with a uniform color.
+TEST_P(VulkanDirectSPIRVTest, UniformColor)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    EXPECT_TRUE(usesTranslatorSPIRV(program));
+
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+    glUniform4f(colorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::green);
+}
+
+// Draw with varyings that are packed together, so that some of them are assigned a component
+// when the program is linked.
+TEST_P(VulkanDirectSPIRVTest, PackedVaryings)
+{
+    constexpr char kVS[] = R"(attribute vec4 position;
+varying vec3 v_rgb;
+varying float v_a;
+varying vec2 v_unused;
+void main()
+{
+    v_rgb = vec3(1.0, 0.0, 1.0);
+    v_a = 1.0;
+    v_unused = vec2(0.5);
+    gl_Position = position;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec3 v_rgb;
+varying float v_a;
+void main()
+{
+    gl_FragColor = vec4(v_rgb, v_a);
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    EXPECT_TRUE(usesTranslatorSPIRV(program));
+
+    drawQuad(program, "position", 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::magenta);
+}
+
+// Draw with a texture, so that the sampler is assigned a binding when the program is linked.
+TEST_P(VulkanDirectSPIRVTest, Texture)
+{
+    const std::vector<GLColor> colors(4, GLColor::blue);
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, colors.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    constexpr char kVS[] = R"(attribute vec4 position;
+varying vec2 v_uv;
+void main()
+{
+    v_uv = position.xy * 0.5 + 0.5;
+    gl_Position = position;
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+uniform sampler2D tex;
+varying vec2 v_uv;
+void main()
+{
+    gl_FragColor = texture2D(tex, v_uv);
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    EXPECT_TRUE(usesTranslatorSPIRV(program));
+
+    glUseProgram(program);
+    GLint texLocation = glGetUniformLocation(program, "tex");
+    ASSERT_NE(-1, texLocation);
+    glUniform1i(texLocation, 0);
+
+    drawQuad(program, "position", 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::blue);
+}
+
+// Draw with control flow and a user-defined function.
+TEST_P(VulkanDirectSPIRVTest, ControlFlow)
+{
+    constexpr char kFS[] = R"(precision mediump float;
+uniform float threshold;
+float halve(float value)
+{
+    return value * 0.5;
+}
+void main()
+{
+    vec4 color = vec4(0.0, 0.0, 0.0, 1.0);
+    for (int i = 0; i < 4; ++i)
+    {
+        color.r += halve(0.5);
+    }
+    if (color.r < threshold)
+    {
+        discard;
+    }
+    gl_FragColor = color;
+})";
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kFS);
+    EXPECT_TRUE(usesTranslatorSPIRV(program));
+
+    glUseProgram(program);
+    GLint thresholdLocation = glGetUniformLocation(program, "threshold");
+    ASSERT_NE(-1, thresholdLocation);
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+
+    // Nothing is discarded.
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUniform1f(thresholdLocation, 0.5f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+
+    // Everything is discarded.
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUniform1f(thresholdLocation, 2.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::blue);
+}
+
+ANGLE_INSTANTIATE_TEST(VulkanDirectSPIRVTest, ES2_VULKAN());
+
+}  // anonymous namespace
@@ -0,0 +1,112 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VulkanDmaBufImageTest:
+//   White-box tests of the dma-buf attribute validation and format mapping of the Vulkan
+//   back-end.  They don't import a buffer, so unlike EGLDmaBufImageTest they also run where the
+//   device can't import dma-bufs, such as on the mock ICD.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+// 'None' is defined as 'struct None {};' in
+// third_party/googletest/src/googletest/include/gtest/internal/gtest-type-util.h.
+// But 'None' is also defined as a numeric constant 0L in <X11/X.h>.
+// So we need to include ANGLETest.h first to avoid this conflict.
+
+#include "libANGLE/AttributeMap.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+#include "libANGLE/renderer/vulkan/linux/DmaBufImageSiblingVkLinux.h"
+#include "libANGLE/renderer/vulkan/vk_format_utils.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr EGLint FourCC(char a, char b, char c, char d)
+{
+    return a | (b << 8) | (c << 16) | (d << 24);
+}
+
+constexpr EGLint kFourCCABGR8888 = FourCC('A', 'B', '2', '4');
+constexpr EGLint kFourCCXBGR8888 = FourCC('X', 'B', '2', '4');
+constexpr EGLint kFourCCXRGB8888 = FourCC('X', 'R', '2', '4');
+constexpr EGLint kFourCCNV12     = FourCC('N', 'V', '1', '2');
+
+constexpr EGLint kWidth  = 64;
+constexpr EGLint kHeight = 64;
+constexpr EGLint kPitch  = kWidth * 4;
+
+// ValidateBuffer never touches the buffer, so any descriptor will do.
+constexpr EGLint kFd = 0;
+
+class VulkanDmaBufImageTest : public ANGLETest
+{
+  protected:
+    rx::RendererVk *getRenderer() const
+    {
+        const gl::Context *context = static_cast<gl::Context *>(getEGLWindow()->getContext());
+        return rx::GetImplAs<rx::ContextVk>(context)->getRenderer();
+    }
+
+    EGLint validate(EGLint fourcc, EGLint pitch, bool extraPlane) const
+    {
+        // clang-format off
+        const EGLint attribs[] = {
+            EGL_WIDTH,                     kWidth,
+            EGL_HEIGHT,                    kHeight,
+            EGL_LINUX_DRM_FOURCC_EXT,      fourcc,
+            EGL_DMA_BUF_PLANE0_FD_EXT,     kFd,
+            EGL_DMA_BUF_PLANE0_OFFSET_EXT, 0,
+            EGL_DMA_BUF_PLANE0_PITCH_EXT,  pitch,
+            extraPlane ? EGL_DMA_BUF_PLANE1_FD_EXT : EGL_NONE, kFd,
+            EGL_NONE,
+        };
+        // clang-format on
+
+        egl::Error error = rx::DmaBufImageSiblingVkLinux::ValidateBuffer(
+            getRenderer(), egl::AttributeMap::CreateFromIntArray(attribs));
+        return error.getCode();
+    }
+};
+
+// Tests that multi-planar formats and extra planes are rejected, and that single-plane formats
+// are accepted.
+TEST_P(VulkanDmaBufImageTest, Validation)
+{
+    EXPECT_EQ(EGL_SUCCESS, validate(kFourCCABGR8888, kPitch, false));
+    EXPECT_EQ(EGL_SUCCESS, validate(kFourCCXBGR8888, kPitch, false));
+    EXPECT_EQ(EGL_SUCCESS, validate(kFourCCXRGB8888, kPitch, false));
+
+    EXPECT_EQ(EGL_BAD_MATCH, validate(kFourCCNV12, kPitch, false));
+    EXPECT_EQ(EGL_BAD_ATTRIBUTE, validate(kFourCCABGR8888, kPitch, true));
+    EXPECT_EQ(EGL_BAD_ACCESS, validate(kFourCCABGR8888, kPitch - 4, false));
+    EXPECT_EQ(EGL_BAD_ACCESS, validate(kFourCCABGR8888, kPitch + 2, false));
+}
+
+// Tests that the X channel of XBGR8888 and XRGB8888 buffers, which lands in the alpha channel of
+// the emulating image, is sampled as one.
+TEST_P(VulkanDmaBufImageTest, IgnoredChannelSampledAsOne)
+{
+    rx::RendererVk *renderer = getRenderer();
+
+    for (GLenum internalFormat : {GL_RGB8, GL_BGRX8_ANGLEX})
+    {
+        const rx::vk::Format &vkFormat = renderer->getFormat(internalFormat);
+        EXPECT_EQ(0u, vkFormat.angleFormat().alphaBits);
+        EXPECT_EQ(4u, vkFormat.textureFormat().pixelBytes);
+
+        gl::SwizzleState swizzle;
+        rx::MapSwizzleState(vkFormat, gl::SwizzleState(), &swizzle);
+        EXPECT_EQ(static_cast<GLenum>(GL_ONE), swizzle.swizzleAlpha);
+    }
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(VulkanDmaBufImageTest, ES2_VULKAN(), ES2_VULKAN_NULL());
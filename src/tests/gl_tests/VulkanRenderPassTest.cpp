@@ -0,0 +1,166 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VulkanRenderPassTest:
+//   Tests to validate that the Vulkan command graph folds clears into render pass load ops and
+//   merges adjacent render passes on the same framebuffer.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+// 'None' is defined as 'struct None {};' in
+// third_party/googletest/src/googletest/include/gtest/internal/gtest-type-util.h.
+// But 'None' is also defined as a numeric constant 0L in <X11/X.h>.
+// So we need to include ANGLETest.h first to avoid this conflict.
+
+#include "libANGLE/Context.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/renderer/vulkan/CommandGraph.h"
+#include "libANGLE/renderer/vulkan/ContextVk.h"
+#include "libANGLE/renderer/vulkan/RendererVk.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+
+class VulkanRenderPassTest : public ANGLETest
+{
+  protected:
+    VulkanRenderPassTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    rx::vk::RenderPassCounters getCounters() const
+    {
+        // Hack the angle!
+        const gl::Context *context = static_cast<gl::Context *>(getEGLWindow()->getContext());
+        rx::ContextVk *contextVk   = rx::GetImplAs<rx::ContextVk>(context);
+        return contextVk->getRenderer()->getCommandGraph()->getRenderPassCounters();
+    }
+
+    // Counters are only updated when the command graph is flushed.
+    rx::vk::RenderPassCounters flushAndGetCountersSince(const rx::vk::RenderPassCounters &before)
+    {
+        glFinish();
+
+        rx::vk::RenderPassCounters after = getCounters();
+        rx::vk::RenderPassCounters diff;
+        diff.renderPasses       = after.renderPasses - before.renderPasses;
+        diff.mergedRenderPasses = after.mergedRenderPasses - before.mergedRenderPasses;
+        diff.attachmentsCleared = after.attachmentsCleared - before.attachmentsCleared;
+        diff.attachmentsLoaded  = after.attachmentsLoaded - before.attachmentsLoaded;
+        diff.attachmentsStored  = after.attachmentsStored - before.attachmentsStored;
+        return diff;
+    }
+
+    void setupFramebuffer()
+    {
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     nullptr);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+        glViewport(0, 0, kSize, kSize);
+    }
+
+    static constexpr GLsizei kSize = 16;
+
+    GLTexture mTexture;
+    GLFramebuffer mFramebuffer;
+};
+
+// Tests that a clear followed by a draw results in a single render pass that clears its
+// attachment instead of loading it.
+TEST_P(VulkanRenderPassTest, ClearFoldedIntoLoadOp)
+{
+    ASSERT_TRUE(IsVulkan());
+
+    setupFramebuffer();
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    rx::vk::RenderPassCounters before = getCounters();
+
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f, 0.5f);
+
+    rx::vk::RenderPassCounters counters = flushAndGetCountersSince(before);
+    EXPECT_EQ(1u, counters.renderPasses);
+    EXPECT_EQ(1u, counters.attachmentsCleared);
+    EXPECT_EQ(0u, counters.attachmentsLoaded);
+    EXPECT_EQ(1u, counters.attachmentsStored);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that a clear without any draw is still executed through the render pass load op.
+TEST_P(VulkanRenderPassTest, ClearOnly)
+{
+    ASSERT_TRUE(IsVulkan());
+
+    setupFramebuffer();
+
+    rx::vk::RenderPassCounters before = getCounters();
+
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    rx::vk::RenderPassCounters counters = flushAndGetCountersSince(before);
+    EXPECT_EQ(1u, counters.renderPasses);
+    EXPECT_EQ(1u, counters.attachmentsCleared);
+
+    EXPECT_PIXEL_COLOR_EQ(kSize / 2, kSize / 2, GLColor::blue);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that render passes split by a scissored clear are merged back together.
+TEST_P(VulkanRenderPassTest, ScissoredClearMerged)
+{
+    ASSERT_TRUE(IsVulkan());
+
+    setupFramebuffer();
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    // Transition the attachment to its render pass layout.
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glFinish();
+
+    rx::vk::RenderPassCounters before = getCounters();
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, kSize / 2, kSize / 2);
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_SCISSOR_TEST);
+
+    rx::vk::RenderPassCounters counters = flushAndGetCountersSince(before);
+    EXPECT_EQ(1u, counters.renderPasses);
+    EXPECT_GE(counters.mergedRenderPasses, 1u);
+    EXPECT_EQ(1u, counters.attachmentsLoaded);
+    EXPECT_EQ(1u, counters.attachmentsStored);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(kSize - 1, kSize - 1, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST(VulkanRenderPassTest, ES2_VULKAN());
+
+}  // anonymous namespace
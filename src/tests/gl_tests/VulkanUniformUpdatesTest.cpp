@@ -158,6 +158,52 @@ TEST_P(VulkanUniformUpdatesTest, DescriptorPoolUpdates)
     }
 }
 
+// Switch back and forth between textures until the descriptor pool wraps, so cached texture
+// descriptor sets are reused and then invalidated along with their pool.
+TEST_P(VulkanUniformUpdatesTest, DescriptorPoolTextureSwitches)
+{
+    ASSERT_TRUE(IsVulkan());
+
+    // Force a small limit on the max sets per pool to more easily trigger a new allocation.
+    limitMaxSets();
+
+    // Initialize texture program.
+    GLuint program = get2DTexturedQuadProgram();
+    ASSERT_NE(0u, program);
+    glUseProgram(program);
+
+    GLint texLoc = glGetUniformLocation(program, "tex");
+    ASSERT_NE(-1, texLoc);
+    glUniform1i(texLoc, 0);
+
+    GLTexture redTexture;
+    InitTexture(GLColor::red, &redTexture);
+
+    GLTexture greenTexture;
+    InitTexture(GLColor::green, &greenTexture);
+    ASSERT_GL_NO_ERROR();
+
+    for (uint32_t iteration = 0; iteration < kMaxSetsForTesting * 4; ++iteration)
+    {
+        glBindTexture(GL_TEXTURE_2D, redTexture);
+        drawQuad(program, "position", 0.5f, 1.0f, true);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+        glBindTexture(GL_TEXTURE_2D, greenTexture);
+        drawQuad(program, "position", 0.5f, 1.0f, true);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+        // Changing the sampler state creates a new sampler, which must not hit the cache.
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+                        (iteration % 2) ? GL_NEAREST : GL_LINEAR);
+        drawQuad(program, "position", 0.5f, 1.0f, true);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+        swapBuffers();
+        ASSERT_GL_NO_ERROR();
+    }
+}
+
 // Uniform updates along with Texture updates.
 TEST_P(VulkanUniformUpdatesTest, DescriptorPoolUniformAndTextureUpdates)
 {
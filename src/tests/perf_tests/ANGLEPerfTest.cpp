@@ -14,6 +14,8 @@
 #include "util/shader_utils.h"
 #include "util/system_utils.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <fstream>
@@ -22,34 +24,41 @@
 
 #include <json/json.h>
 
+#if defined(ANGLE_PLATFORM_LINUX)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+
 #if defined(ANGLE_USE_UTIL_LOADER) && defined(ANGLE_PLATFORM_WINDOWS)
 #    include "util/windows/WGLWindow.h"
 #endif  // defined(ANGLE_USE_UTIL_LOADER) &&defined(ANGLE_PLATFORM_WINDOWS)
 
 namespace
 {
-constexpr size_t kInitialTraceEventBufferSize = 50000;
-constexpr double kMicroSecondsPerSecond       = 1e6;
-constexpr double kNanoSecondsPerSecond        = 1e9;
-constexpr double kCalibrationRunTimeSeconds   = 1.0;
-constexpr double kMaximumRunTimeSeconds       = 10.0;
-constexpr unsigned int kNumTrials             = 3;
+constexpr double kMicroSecondsPerSecond     = 1e6;
+constexpr double kNanoSecondsPerSecond      = 1e9;
+constexpr double kCalibrationRunTimeSeconds = 1.0;
+constexpr double kMaximumRunTimeSeconds     = 10.0;
+constexpr unsigned int kNumTrials           = 3;
+
+// Warmup runs continue until the time per step of two consecutive runs is within this tolerance.
+constexpr unsigned int kMaxWarmupRuns = 5;
+constexpr double kWarmupTolerance     = 0.02;
+
+// Caps the number of step times kept for the statistics of the measured runs. Steps past the cap
+// still count towards the per-iteration CPU time and counters.
+constexpr size_t kMaxStepTimes = 1 << 20;
 
 bool gCalibration = false;
 Optional<unsigned int> gStepsToRunOverride;
-bool gEnableTrace      = false;
-const char *gTraceFile = "ANGLETrace.json";
-
-struct TraceCategory
-{
-    unsigned char enabled;
-    const char *name;
-};
+bool gEnableTrace        = false;
+const char *gTraceFile   = "ANGLETrace.json";
+const char *gResultsFile = nullptr;
+bool gEnablePerfCounters = false;
 
-constexpr TraceCategory gTraceCategories[2] = {
-    {1, "gpu.angle"},
-    {1, "gpu.angle.gpu"},
-};
+constexpr char kTraceCategories[] = "gpu.angle,gpu.angle.gpu";
 
 void EmptyPlatformMethod(angle::PlatformMethods *, const char *) {}
 
@@ -59,6 +68,12 @@ void OverrideWorkaroundsD3D(angle::PlatformMethods *platform, angle::Workarounds
     angleRenderTest->overrideWorkaroundsD3D(workaroundsD3D);
 }
 
+void OverrideFeaturesVk(angle::PlatformMethods *platform, angle::FeaturesVk *featuresVk)
+{
+    auto *angleRenderTest = static_cast<ANGLERenderTest *>(platform->context);
+    angleRenderTest->overrideFeaturesVk(featuresVk);
+}
+
 angle::TraceEventHandle AddTraceEvent(angle::PlatformMethods *platform,
                                       char phase,
                                       const unsigned char *categoryEnabledFlag,
@@ -71,33 +86,24 @@ angle::TraceEventHandle AddTraceEvent(angle::PlatformMethods *platform,
                                       const unsigned long long *argValues,
                                       unsigned char flags)
 {
-    if (!gEnableTrace)
-        return 0;
-
-    // Discover the category name based on categoryEnabledFlag.  This flag comes from the first
-    // parameter of TraceCategory, and corresponds to one of the entries in gTraceCategories.
-    static_assert(offsetof(TraceCategory, enabled) == 0,
-                  "|enabled| must be the first field of the TraceCategory class.");
-    const TraceCategory *category = reinterpret_cast<const TraceCategory *>(categoryEnabledFlag);
-
-    ANGLERenderTest *renderTest     = static_cast<ANGLERenderTest *>(platform->context);
-    std::vector<TraceEvent> &buffer = renderTest->getTraceEventBuffer();
-    buffer.emplace_back(phase, category->name, name, timestamp);
-    return buffer.size();
+    ANGLERenderTest *renderTest    = static_cast<ANGLERenderTest *>(platform->context);
+    angle::TraceRecorder *recorder = renderTest->getTraceRecorder();
+    if (recorder != nullptr)
+    {
+        recorder->addEvent(phase, categoryEnabledFlag, name, id, timestamp, numArgs, argNames,
+                           argTypes, argValues, flags);
+    }
+    return 0;
 }
 
 const unsigned char *GetTraceCategoryEnabledFlag(angle::PlatformMethods *platform,
                                                  const char *categoryName)
 {
-    if (gEnableTrace)
+    ANGLERenderTest *renderTest    = static_cast<ANGLERenderTest *>(platform->context);
+    angle::TraceRecorder *recorder = renderTest->getTraceRecorder();
+    if (recorder != nullptr)
     {
-        for (const TraceCategory &category : gTraceCategories)
-        {
-            if (strcmp(category.name, categoryName) == 0)
-            {
-                return &category.enabled;
-            }
-        }
+        return recorder->getCategoryEnabledFlag(categoryName);
     }
 
     constexpr static unsigned char kZero = 0;
@@ -112,21 +118,29 @@ void UpdateTraceEventDuration(angle::PlatformMethods *platform,
     // Not implemented.
 }
 
+void HistogramCustomCounts(angle::PlatformMethods *platform,
+                           const char *name,
+                           int sample,
+                           int min,
+                           int max,
+                           int bucketCount)
+{
+    ANGLERenderTest *renderTest = static_cast<ANGLERenderTest *>(platform->context);
+    renderTest->recordHistogramSample(name, sample);
+}
+
 double MonotonicallyIncreasingTime(angle::PlatformMethods *platform)
 {
     ANGLERenderTest *renderTest = static_cast<ANGLERenderTest *>(platform->context);
-    // Move the time origin to the first call to this function, to avoid generating unnecessarily
-    // large timestamps.
-    static double origin = renderTest->getTimer()->getAbsoluteTime();
-    return renderTest->getTimer()->getAbsoluteTime() - origin;
+    return renderTest->getTraceTime();
 }
 
-void DumpTraceEventsToJSONFile(const std::vector<TraceEvent> &traceEvents,
+void DumpTraceEventsToJSONFile(const std::vector<angle::TraceRecorder::Event> &traceEvents,
                                const char *outputFileName)
 {
     Json::Value eventsValue(Json::arrayValue);
 
-    for (const TraceEvent &traceEvent : traceEvents)
+    for (const angle::TraceRecorder::Event &traceEvent : traceEvents)
     {
         Json::Value value(Json::objectValue);
 
@@ -136,7 +150,8 @@ void DumpTraceEventsToJSONFile(const std::vector<TraceEvent> &traceEvents,
         unsigned long long microseconds =
             static_cast<unsigned long long>(traceEvent.timestamp * 1000.0 * 1000.0);
 
-        value["name"] = traceEvent.name;
+        const char *name = traceEvent.getName();
+        value["name"]    = name != nullptr ? name : "";
         value["cat"]  = traceEvent.categoryName;
         value["ph"]   = phaseName.str();
         value["ts"]   = microseconds;
@@ -158,6 +173,189 @@ void DumpTraceEventsToJSONFile(const std::vector<TraceEvent> &traceEvents,
     outFile.close();
 }
 
+// The trace of the slowest measured step goes next to the full trace, e.g. in
+// ANGLETrace_slowest.json.
+std::string GetSlowestStepTraceFile()
+{
+    std::string traceFile(gTraceFile);
+    size_t extension = traceFile.rfind('.');
+    if (extension == std::string::npos ||
+        traceFile.find_first_of("/\\", extension) != std::string::npos)
+    {
+        extension = traceFile.size();
+    }
+    return traceFile.insert(extension, "_slowest");
+}
+
+// Statistics of the time per iteration of the measured steps, in seconds.
+struct StepStatistics
+{
+    double median = 0.0;
+    // The median absolute deviation from the median.
+    double mad = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    // The 95% confidence interval of the median.
+    double medianLow  = 0.0;
+    double medianHigh = 0.0;
+};
+
+double SortedMedian(const std::vector<double> &sorted)
+{
+    size_t middle = sorted.size() / 2;
+    return sorted.size() % 2 == 1 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2.0;
+}
+
+// Nearest-rank percentile.
+double SortedPercentile(const std::vector<double> &sorted, double percentile)
+{
+    size_t rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(sorted.size())));
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+StepStatistics ComputeStepStatistics(std::vector<double> samples)
+{
+    StepStatistics stats;
+    if (samples.empty())
+    {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    stats.median = SortedMedian(samples);
+    stats.p95    = SortedPercentile(samples, 0.95);
+    stats.p99    = SortedPercentile(samples, 0.99);
+
+    // The confidence interval comes from the order statistics of the samples, so it doesn't assume
+    // a distribution: the median lies between the ranks n/2 -/+ 1.96 * sqrt(n)/2 in 95% of runs.
+    double count     = static_cast<double>(samples.size());
+    double halfWidth = 1.96 * std::sqrt(count) / 2.0;
+    size_t lowRank   = static_cast<size_t>(std::max(0.0, std::floor(count / 2.0 - halfWidth)));
+    size_t highRank  = static_cast<size_t>(std::ceil(count / 2.0 + halfWidth));
+    stats.medianLow  = samples[lowRank];
+    stats.medianHigh = samples[std::min(highRank, samples.size() - 1)];
+
+    std::vector<double> deviations;
+    deviations.reserve(samples.size());
+    for (double sample : samples)
+    {
+        deviations.push_back(std::abs(sample - stats.median));
+    }
+    std::sort(deviations.begin(), deviations.end());
+    stats.mad = SortedMedian(deviations);
+
+    return stats;
+}
+
+// Counts hardware events of the calling thread through perf_event_open on Linux.  The counters
+// stay invalid when the kernel doesn't allow it, e.g. because of kernel.perf_event_paranoid.
+constexpr size_t kPerfCounterCount                       = 2;
+constexpr const char *kPerfCounterNames[kPerfCounterCount] = {"instructions", "cache_misses"};
+
+class PerfEventCounters final : angle::NonCopyable
+{
+  public:
+    explicit PerfEventCounters(bool enable)
+    {
+        mFds.fill(-1);
+#if defined(ANGLE_PLATFORM_LINUX)
+        if (!enable)
+        {
+            return;
+        }
+
+        constexpr uint64_t kConfigs[kPerfCounterCount] = {PERF_COUNT_HW_INSTRUCTIONS,
+                                                      PERF_COUNT_HW_CACHE_MISSES};
+        for (size_t index = 0; index < kPerfCounterCount; ++index)
+        {
+            perf_event_attr attribs = {};
+            attribs.type            = PERF_TYPE_HARDWARE;
+            attribs.size            = sizeof(attribs);
+            attribs.config          = kConfigs[index];
+            attribs.disabled        = 1;
+            attribs.exclude_kernel  = 1;
+            attribs.exclude_hv      = 1;
+            mFds[index] = static_cast<int>(syscall(SYS_perf_event_open, &attribs, 0, -1, -1, 0));
+        }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+    }
+
+    ~PerfEventCounters()
+    {
+#if defined(ANGLE_PLATFORM_LINUX)
+        for (int fd : mFds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+    }
+
+    bool valid(size_t index) const { return mFds[index] >= 0; }
+
+    void start()
+    {
+#if defined(ANGLE_PLATFORM_LINUX)
+        for (int fd : mFds)
+        {
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+    }
+
+    void stop()
+    {
+#if defined(ANGLE_PLATFORM_LINUX)
+        for (int fd : mFds)
+        {
+            if (fd >= 0)
+            {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+    }
+
+    uint64_t getCount(size_t index) const
+    {
+        uint64_t count = 0;
+#if defined(ANGLE_PLATFORM_LINUX)
+        if (mFds[index] >= 0 && read(mFds[index], &count, sizeof(count)) != sizeof(count))
+        {
+            count = 0;
+        }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
+        return count;
+    }
+
+  private:
+    std::array<int, kPerfCounterCount> mFds;
+};
+
+// The results of all the tests that ran, written to gResultsFile after each one.
+Json::Value &GetResults()
+{
+    static Json::Value *results = new Json::Value(Json::arrayValue);
+    return *results;
+}
+
+void WriteResultsFile()
+{
+    Json::Value root(Json::objectValue);
+    root["units"]   = "ns";
+    root["results"] = GetResults();
+
+    std::ofstream outFile(gResultsFile);
+    Json::StyledWriter styledWrite;
+    outFile << styledWrite.write(root);
+}
+
 bool OneFrame()
 {
     return gStepsToRunOverride.valid() && gStepsToRunOverride.value() == 1;
@@ -175,7 +373,10 @@ ANGLEPerfTest::ANGLEPerfTest(const std::string &name,
       mStepsToRun(std::numeric_limits<unsigned int>::max()),
       mNumStepsPerformed(0),
       mIterationsPerStep(iterationsPerStep),
-      mRunning(true)
+      mRunning(true),
+      mRecordStepTimes(false),
+      mMeasuredStepCount(0),
+      mSlowestStepTime(0.0)
 {}
 
 ANGLEPerfTest::~ANGLEPerfTest()
@@ -211,8 +412,35 @@ void ANGLEPerfTest::run()
         mStepsToRun = gStepsToRunOverride.value();
     }
 
-    // Do another warmup run. Seems to consistently improve results.
-    doRunLoop(kMaximumRunTimeSeconds);
+    // Do more warmup runs until the results are stable. Seems to consistently improve results.
+    double previousStepTime = 0.0;
+    for (unsigned int warmupRun = 0; warmupRun < kMaxWarmupRuns; ++warmupRun)
+    {
+        doRunLoop(kMaximumRunTimeSeconds);
+        if (mNumStepsPerformed == 0)
+        {
+            break;
+        }
+
+        double stepTime = mTimer->getElapsedTime() / static_cast<double>(mNumStepsPerformed);
+        if (warmupRun > 0 && std::abs(stepTime - previousStepTime) <= kWarmupTolerance * stepTime)
+        {
+            break;
+        }
+        previousStepTime = stepTime;
+    }
+
+    // Only the measured steps are sampled, and are candidates for the slowest step's trace.
+    mRecordStepTimes = true;
+    mSlowestStepTime = 0.0;
+    mMeasuredStepCount = 0;
+    mStepTimes.clear();
+    mStepTimes.reserve(
+        std::min<size_t>(static_cast<size_t>(mStepsToRun) * kNumTrials, kMaxStepTimes));
+
+    PerfEventCounters perfCounters(gEnablePerfCounters);
+    double cpuStartTime = angle::GetCurrentProcessCpuTime();
+    perfCounters.start();
 
     double totalTime = 0.0;
     for (unsigned int trial = 0; trial < kNumTrials; ++trial)
@@ -220,10 +448,103 @@ void ANGLEPerfTest::run()
         doRunLoop(kMaximumRunTimeSeconds);
         totalTime += printResults();
     }
+
+    perfCounters.stop();
+    double cpuTime   = angle::GetCurrentProcessCpuTime() - cpuStartTime;
+    mRecordStepTimes = false;
+
+    std::map<std::string, uint64_t> counterTotals;
+    for (size_t index = 0; index < kPerfCounterCount; ++index)
+    {
+        if (perfCounters.valid(index))
+        {
+            counterTotals[kPerfCounterNames[index]] = perfCounters.getCount(index);
+        }
+    }
+
+    if (gEnableTrace)
+    {
+        printResult("slowest_step", mSlowestStepTime * kMicroSecondsPerSecond, "us", false);
+    }
+
     double average = totalTime / kNumTrials;
     std::ostringstream averageString;
     averageString << "for " << kNumTrials << " runs";
     printResult("average", average, averageString.str(), false);
+
+    reportStatistics(cpuTime, counterTotals);
+}
+
+void ANGLEPerfTest::reportStatistics(double cpuTime,
+                                     const std::map<std::string, uint64_t> &counterTotals)
+{
+    if (mStepTimes.empty())
+    {
+        return;
+    }
+
+    double iterationsPerStep = static_cast<double>(mIterationsPerStep);
+    double iterations        = static_cast<double>(mMeasuredStepCount) * iterationsPerStep;
+
+    std::vector<double> iterationTimes;
+    iterationTimes.reserve(mStepTimes.size());
+    for (double stepTime : mStepTimes)
+    {
+        iterationTimes.push_back(stepTime / iterationsPerStep);
+    }
+    StepStatistics stats = ComputeStepStatistics(std::move(iterationTimes));
+
+    // Use the same units as printResults.
+    bool useMicroSeconds = stats.median > 1e-3;
+    double scale         = useMicroSeconds ? kMicroSecondsPerSecond : kNanoSecondsPerSecond;
+    const char *units    = useMicroSeconds ? "us" : "ns";
+
+    printResult("wall_time_median", stats.median * scale, units, false);
+    printResult("wall_time_mad", stats.mad * scale, units, false);
+    printResult("wall_time_p95", stats.p95 * scale, units, false);
+    printResult("wall_time_p99", stats.p99 * scale, units, false);
+
+    double cpuTimePerIteration = cpuTime / iterations;
+    if (cpuTime > 0.0)
+    {
+        printResult("cpu_time", cpuTimePerIteration * scale, units, false);
+    }
+
+    Json::Value counters(Json::objectValue);
+    for (const auto &counterTotal : counterTotals)
+    {
+        double countPerIteration = static_cast<double>(counterTotal.second) / iterations;
+        printResult(counterTotal.first, countPerIteration, "count", false);
+        counters[counterTotal.first] = countPerIteration;
+    }
+
+    if (gResultsFile == nullptr)
+    {
+        return;
+    }
+
+    Json::Value result(Json::objectValue);
+    result["name"]                = mName;
+    result["backend"]             = mSuffix;
+    result["samples"]             = static_cast<Json::UInt64>(mStepTimes.size());
+    result["iterations_per_step"] = static_cast<Json::UInt64>(mIterationsPerStep);
+    result["median"]              = stats.median * kNanoSecondsPerSecond;
+    result["mad"]                 = stats.mad * kNanoSecondsPerSecond;
+    result["p95"]                 = stats.p95 * kNanoSecondsPerSecond;
+    result["p99"]                 = stats.p99 * kNanoSecondsPerSecond;
+    result["median_ci_low"]       = stats.medianLow * kNanoSecondsPerSecond;
+    result["median_ci_high"]      = stats.medianHigh * kNanoSecondsPerSecond;
+    if (cpuTime > 0.0)
+    {
+        result["cpu_time"] = cpuTimePerIteration * kNanoSecondsPerSecond;
+    }
+    if (!counters.empty())
+    {
+        result["counters"] = counters;
+    }
+
+    GetResults().append(result);
+    WriteResultsFile();
 }
 
 void ANGLEPerfTest::doRunLoop(double maxRunTime)
@@ -235,10 +556,26 @@ void ANGLEPerfTest::doRunLoop(double maxRunTime)
 
     while (mRunning)
     {
+        double stepStartTime = mRecordStepTimes ? mTimer->getAbsoluteTime() : 0.0;
         step();
         if (mRunning)
         {
             ++mNumStepsPerformed;
+            if (mRecordStepTimes)
+            {
+                double stepEndTime = mTimer->getAbsoluteTime();
+                double stepTime    = stepEndTime - stepStartTime;
+                ++mMeasuredStepCount;
+                if (mStepTimes.size() < kMaxStepTimes)
+                {
+                    mStepTimes.push_back(stepTime);
+                }
+                if (stepTime > mSlowestStepTime)
+                {
+                    mSlowestStepTime = stepTime;
+                    onSlowestStep(stepStartTime, stepEndTime);
+                }
+            }
             if (mTimer->getElapsedTime() > maxRunTime)
             {
                 mRunning = false;
@@ -345,6 +682,8 @@ std::string RenderTestParams::suffix() const
             return "_default";
         case EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE:
             return "_vulkan";
+        case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE:
+            return "_null";
         default:
             assert(0);
             return "_unk";
@@ -355,7 +694,8 @@ ANGLERenderTest::ANGLERenderTest(const std::string &name, const RenderTestParams
     : ANGLEPerfTest(name, testParams.suffix(), OneFrame() ? 1 : testParams.iterationsPerStep),
       mTestParams(testParams),
       mGLWindow(nullptr),
-      mOSWindow(nullptr)
+      mOSWindow(nullptr),
+      mTraceTimeOrigin(getTimer()->getAbsoluteTime())
 {
     // Force fast tests to make sure our slowest bots don't time out.
     if (OneFrame())
@@ -363,8 +703,11 @@ ANGLERenderTest::ANGLERenderTest(const std::string &name, const RenderTestParams
         const_cast<RenderTestParams &>(testParams).iterationsPerStep = 1;
     }
 
-    // Try to ensure we don't trigger allocation during execution.
-    mTraceEventBuffer.reserve(kInitialTraceEventBufferSize);
+    // Recording only allocates on the first event of each thread, not during execution.
+    if (gEnableTrace)
+    {
+        mTraceRecorder.reset(new angle::TraceRecorder(kTraceCategories));
+    }
 
     switch (testParams.driver)
     {
@@ -426,6 +769,7 @@ void ANGLERenderTest::SetUp()
     mGLWindow->setSwapInterval(0);
 
     mPlatformMethods.overrideWorkaroundsD3D      = OverrideWorkaroundsD3D;
+    mPlatformMethods.overrideFeaturesVk          = OverrideFeaturesVk;
     mPlatformMethods.logError                    = EmptyPlatformMethod;
     mPlatformMethods.logWarning                  = EmptyPlatformMethod;
     mPlatformMethods.logInfo                     = EmptyPlatformMethod;
@@ -433,6 +777,7 @@ void ANGLERenderTest::SetUp()
     mPlatformMethods.getTraceCategoryEnabledFlag = GetTraceCategoryEnabledFlag;
     mPlatformMethods.updateTraceEventDuration    = UpdateTraceEventDuration;
     mPlatformMethods.monotonicallyIncreasingTime = MonotonicallyIncreasingTime;
+    mPlatformMethods.histogramCustomCounts       = HistogramCustomCounts;
     mPlatformMethods.context                     = this;
     mGLWindow->setPlatformMethods(&mPlatformMethods);
 
@@ -489,10 +834,44 @@ void ANGLERenderTest::TearDown()
         mOSWindow = nullptr;
     }
 
+    // Back-ends built with native call counters report them when their context is destroyed.
+    int64_t nativeCalls     = mHistogramSamples["GPU.ANGLE.GLNativeCalls"];
+    int64_t nativeDrawCalls = mHistogramSamples["GPU.ANGLE.GLNativeDrawCalls"];
+    if (!mSkipTest && nativeDrawCalls > 0)
+    {
+        printResult("native_calls_per_draw",
+                    static_cast<double>(nativeCalls) / static_cast<double>(nativeDrawCalls),
+                    "calls", false);
+    }
+
+    // The GL back-end counts the buffer, texture and sampler binding calls made for its draws.
+    int64_t bindingCalls = mHistogramSamples["GPU.ANGLE.GLBindingCalls"];
+    int64_t drawCalls    = mHistogramSamples["GPU.ANGLE.GLDrawCalls"];
+    if (!mSkipTest && drawCalls > 0)
+    {
+        printResult("binding_calls_per_draw",
+                    static_cast<double>(bindingCalls) / static_cast<double>(drawCalls), "calls",
+                    false);
+    }
+
+    // The NULL back-end counts a multi-draw as a single call for all of its sub-draws.
+    int64_t nullDrawCalls = mHistogramSamples["GPU.ANGLE.NULLDrawCalls"];
+    int64_t nullSubDraws  = mHistogramSamples["GPU.ANGLE.NULLSubDraws"];
+    if (!mSkipTest && nullSubDraws > 0)
+    {
+        printResult("backend_calls_per_draw",
+                    static_cast<double>(nullDrawCalls) / static_cast<double>(nullSubDraws),
+                    "calls", false);
+    }
+
     // Dump trace events to json file.
-    if (gEnableTrace)
+    if (mTraceRecorder)
     {
-        DumpTraceEventsToJSONFile(mTraceEventBuffer, gTraceFile);
+        DumpTraceEventsToJSONFile(mTraceRecorder->getEvents(), gTraceFile);
+        if (!mSlowestStepEvents.empty())
+        {
+            DumpTraceEventsToJSONFile(mSlowestStepEvents, GetSlowestStepTraceFile().c_str());
+        }
     }
 
     ANGLEPerfTest::TearDown();
@@ -569,6 +948,15 @@ void ANGLERenderTest::finishTest()
     }
 }
 
+void ANGLERenderTest::onSlowestStep(double startTime, double endTime)
+{
+    if (mTraceRecorder)
+    {
+        mSlowestStepEvents =
+            mTraceRecorder->getEvents(startTime - mTraceTimeOrigin, endTime - mTraceTimeOrigin);
+    }
+}
+
 bool ANGLERenderTest::popEvent(Event *event)
 {
     return mOSWindow->popEvent(event);
@@ -603,9 +991,14 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mGLWindow->setRobustResourceInit(enabled);
 }
 
-std::vector<TraceEvent> &ANGLERenderTest::getTraceEventBuffer()
+void ANGLERenderTest::recordHistogramSample(const char *name, int sample)
+{
+    mHistogramSamples[name] += sample;
+}
+
+double ANGLERenderTest::getTraceTime() const
 {
-    return mTraceEventBuffer;
+    return mTimer->getAbsoluteTime() - mTraceTimeOrigin;
 }
 
 // static
@@ -631,10 +1024,20 @@ void ANGLEProcessPerfTestArgs(int *argc, char **argv)
         }
         else if (strcmp("--trace-file", argv[argIndex]) == 0 && argIndex < *argc - 1)
         {
-            gTraceFile = argv[argIndex];
+            gTraceFile = argv[argIndex + 1];
             // Skip an additional argument.
             argIndex++;
         }
+        else if (strcmp("--results-file", argv[argIndex]) == 0 && argIndex < *argc - 1)
+        {
+            gResultsFile = argv[argIndex + 1];
+            // Skip an additional argument.
+            argIndex++;
+        }
+        else if (strcmp("--perf-counters", argv[argIndex]) == 0)
+        {
+            gEnablePerfCounters = true;
+        }
         else if (strcmp("--calibration", argv[argIndex]) == 0)
         {
             gCalibration = true;
@@ -12,9 +12,11 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
 #include <string>
 #include <vector>
 
+#include "common/trace_recorder.h"
 #include "platform/Platform.h"
 #include "test_utils/angle_test_configs.h"
 #include "test_utils/angle_test_instantiate.h"
@@ -34,23 +36,6 @@ class Event;
         ASSERT_EQ(static_cast<GLenum>(expected), static_cast<GLenum>(actual))
 #endif  // !defined(ASSERT_GLENUM_EQ)
 
-// These are trace events according to Google's "Trace Event Format".
-// See https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
-// Only a subset of the properties are implemented.
-struct TraceEvent final
-{
-    TraceEvent() {}
-
-    TraceEvent(char phaseIn, const char *categoryNameIn, const char *nameIn, double timestampIn)
-        : phase(phaseIn), categoryName(categoryNameIn), name(nameIn), timestamp(timestampIn)
-    {}
-
-    char phase               = 0;
-    const char *categoryName = nullptr;
-    const char *name         = nullptr;
-    double timestamp         = 0;
-};
-
 class ANGLEPerfTest : public testing::Test, angle::NonCopyable
 {
   public:
@@ -65,6 +50,9 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     virtual void startTest() {}
     // Called right before timer is stopped to let the test wait for asynchronous operations.
     virtual void finishTest() {}
+    // Called whenever a measured step is the slowest one so far, with the step's bounds in the
+    // timer's absolute time.
+    virtual void onSlowestStep(double startTime, double endTime) {}
 
     Timer *getTimer() const { return mTimer; }
 
@@ -98,11 +86,19 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
 
   private:
     double printResults();
+    // Prints the statistics of the sampled steps, and adds them to the results file if requested.
+    void reportStatistics(double cpuTime, const std::map<std::string, uint64_t> &counterTotals);
 
     unsigned int mStepsToRun;
     unsigned int mNumStepsPerformed;
     unsigned int mIterationsPerStep;
     bool mRunning;
+
+    // The duration of each measured step, in seconds, up to a cap.
+    bool mRecordStepTimes;
+    size_t mMeasuredStepCount;
+    std::vector<double> mStepTimes;
+    double mSlowestStepTime;
 };
 
 struct RenderTestParams : public angle::PlatformParameters
@@ -134,9 +130,14 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     OSWindow *getWindow();
 
-    std::vector<TraceEvent> &getTraceEventBuffer();
+    angle::TraceRecorder *getTraceRecorder() const { return mTraceRecorder.get(); }
+    // Seconds since the test was created, which is the time base of the trace events.
+    double getTraceTime() const;
+
+    void recordHistogramSample(const char *name, int sample);
 
     virtual void overrideWorkaroundsD3D(angle::WorkaroundsD3D *workaroundsD3D) {}
+    virtual void overrideFeaturesVk(angle::FeaturesVk *featuresVk) {}
 
   protected:
     const RenderTestParams &mTestParams;
@@ -154,6 +155,7 @@ class ANGLERenderTest : public ANGLEPerfTest
     void step() override;
     void startTest() override;
     void finishTest() override;
+    void onSlowestStep(double startTime, double endTime) override;
 
     bool areExtensionPrerequisitesFulfilled() const;
 
@@ -166,8 +168,13 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     GLuint mTimestampQuery;
 
-    // Trace event record that can be output.
-    std::vector<TraceEvent> mTraceEventBuffer;
+    // Trace events recorded when tracing is enabled, and those of the slowest measured step.
+    std::unique_ptr<angle::TraceRecorder> mTraceRecorder;
+    double mTraceTimeOrigin;
+    std::vector<angle::TraceRecorder::Event> mSlowestStepEvents;
+
+    // Histogram samples reported by ANGLE, summed by name.
+    std::map<std::string, int64_t> mHistogramSamples;
 
     // Handle to the entry point binding library.
     std::unique_ptr<angle::Library> mEntryPointsLib;
@@ -380,6 +380,16 @@ BufferSubDataParams BufferUpdateVulkanParams()
     return params;
 }
 
+BufferSubDataParams BufferUpdateVulkanNullParams()
+{
+    BufferSubDataParams params;
+    params.eglParameters        = egl_platform::VULKAN_NULL();
+    params.vertexType           = GL_FLOAT;
+    params.vertexComponentCount = 4;
+    params.vertexNormalized     = GL_FALSE;
+    return params;
+}
+
 TEST_P(BufferSubDataBenchmark, Run)
 {
     run();
@@ -389,6 +399,7 @@ ANGLE_INSTANTIATE_TEST(BufferSubDataBenchmark,
                        BufferUpdateD3D11Params(),
                        BufferUpdateD3D9Params(),
                        BufferUpdateOpenGLOrGLESParams(),
-                       BufferUpdateVulkanParams());
+                       BufferUpdateVulkanParams(),
+                       BufferUpdateVulkanNullParams());
 
 }  // namespace
@@ -11,9 +11,12 @@
 
 #include "ANGLEPerfTest.h"
 
+#include <algorithm>
+#include <memory>
+#include <sstream>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
-#include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
 
 namespace
@@ -162,6 +165,49 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+const char *kManyFunctionsESSL300Id = "ManyFunctionsESSL300";
+
+// Generates a large shader made of many small functions, like the uber shaders that some
+// applications generate.
+const char *GetManyFunctionsESSL300FragSource()
+{
+    constexpr int kFunctionCount = 400;
+
+    static const std::string source = [] {
+        std::stringstream shader;
+        shader << R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+uniform sampler2D s;
+in vec2 texCoord;
+out vec4 color;
+struct Light { vec3 position; vec3 color; float attenuation; };
+uniform Light lights[4];
+vec3 function0(vec3 v)
+{
+    return v;
+}
+)";
+        for (int index = 1; index < kFunctionCount; ++index)
+        {
+            shader << "vec3 function" << index << "(vec3 v)\n{\n";
+            shader << "    vec3 sum = vec3(0.0);\n";
+            shader << "    for (int i = 0; i < 4; ++i)\n    {\n";
+            shader << "        vec3 toLight = lights[i].position - v;\n";
+            shader << "        float d = length(toLight) * lights[i].attenuation;\n";
+            shader << "        float lambert = max(dot(normalize(toLight), v), 0.0);\n";
+            shader << "        sum += lights[i].color * lambert / d;\n";
+            shader << "    }\n";
+            shader << "    vec4 t = texture(s, texCoord * " << index << ".0 + sum.xy);\n";
+            shader << "    return function" << (index - 1) << "(mix(sum, t.rgb, u.w));\n}\n";
+        }
+        shader << "void main()\n{\n";
+        shader << "    color = vec4(function" << (kFunctionCount - 1) << "(u.xyz), 1.0);\n}\n";
+        return shader.str();
+    }();
+    return source.c_str();
+}
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -180,6 +226,8 @@ struct CompilerParameters
                 return "GLSL_4_50";
             case SH_ESSL_OUTPUT:
                 return "ESSL";
+            case SH_GLSL_VULKAN_OUTPUT:
+                return "Vulkan";
             default:
                 UNREACHABLE();
                 return "unk";
@@ -196,9 +244,10 @@ bool IsPlatformAvailable(const CompilerParameters &param)
         case SH_HLSL_4_1_OUTPUT:
         case SH_HLSL_4_0_FL9_3_OUTPUT:
         case SH_HLSL_3_0_OUTPUT:
+        case SH_GLSL_VULKAN_OUTPUT:
         {
             TPoolAllocator allocator;
-            InitializePoolIndex();
+            sh::Initialize();
             allocator.push();
             SetGlobalPoolAllocator(&allocator);
             ShHandle translator =
@@ -206,7 +255,7 @@ bool IsPlatformAvailable(const CompilerParameters &param)
             bool success = translator != nullptr;
             SetGlobalPoolAllocator(nullptr);
             allocator.pop();
-            FreePoolIndex();
+            sh::Finalize();
             if (!success)
             {
                 return false;
@@ -219,19 +268,70 @@ bool IsPlatformAvailable(const CompilerParameters &param)
     return true;
 }
 
+// Initializes the translator for the duration of the test, the way a context does before it
+// constructs its compilers, and holds the resources the compilers are constructed with.
+template <typename ParamT>
+class CompilerPerfTestBase : public ANGLEPerfTest, public ::testing::WithParamInterface<ParamT>
+{
+  public:
+    CompilerPerfTestBase(const std::string &name, const std::string &suffix)
+        : ANGLEPerfTest(name, suffix, kNumIterationsPerStep)
+    {}
+
+    void SetUp() override
+    {
+        ANGLEPerfTest::SetUp();
+
+        ASSERT_TRUE(sh::Initialize());
+        sh::InitBuiltInResources(&mResources);
+        mResources.FragmentPrecisionHigh = true;
+    }
+
+    void TearDown() override
+    {
+        sh::Finalize();
+        ANGLEPerfTest::TearDown();
+    }
+
+  protected:
+    ShHandle constructCompiler(GLenum shaderType) const
+    {
+        return sh::ConstructCompiler(shaderType, SH_WEBGL2_SPEC, this->GetParam().output,
+                                     &mResources);
+    }
+
+    ShBuiltInResources mResources;
+};
+
 struct CompilerPerfParameters final : public CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           ShCompileOptions extraCompileOptions = 0)
+        : CompilerParameters(output),
+          shaderSource(shaderSource),
+          extraCompileOptions(extraCompileOptions)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += CompilerParameters::str();
+        if ((extraCompileOptions & SH_GENERATE_SPIRV) != 0)
+        {
+            testId += "_SPIRV";
+        }
+        if ((extraCompileOptions & SH_PARALLEL_FUNCTION_OUTPUT) != 0)
+        {
+            testId += "_ParallelFunctionOutput";
+        }
+        if ((extraCompileOptions & SH_OPTIMIZE_AST) != 0)
+        {
+            testId += "_OptimizeAST";
+        }
     }
 
     const char *shaderSource;
+    ShCompileOptions extraCompileOptions;
     std::string testId;
 };
 
@@ -241,8 +341,7 @@ std::ostream &operator<<(std::ostream &stream, const CompilerPerfParameters &p)
     return stream;
 }
 
-class CompilerPerfTest : public ANGLEPerfTest,
-                         public ::testing::WithParamInterface<CompilerPerfParameters>
+class CompilerPerfTest : public CompilerPerfTestBase<CompilerPerfParameters>
 {
   public:
     CompilerPerfTest();
@@ -256,56 +355,136 @@ class CompilerPerfTest : public ANGLEPerfTest,
     void setTestShader(const char *str) { mTestShader = str; }
 
   private:
+    ShCompileOptions getCompileOptions() const;
+    double getAverageCompileTime(ShCompileOptions compileOptions, unsigned int compileCount);
+    void reportEmitTime();
+    void reportAllocatedBytes();
+    void reportObjectCodeSize();
+
     const char *mTestShader;
+    ShCompileOptions mExtraCompileOptions;
 
-    ShBuiltInResources mResources;
     TPoolAllocator mAllocator;
     sh::TCompiler *mTranslator;
 };
 
 CompilerPerfTest::CompilerPerfTest()
-    : ANGLEPerfTest("CompilerPerf", GetParam().testId, kNumIterationsPerStep)
+    : CompilerPerfTestBase("CompilerPerf", GetParam().testId)
 {}
 
 void CompilerPerfTest::SetUp()
 {
-    ANGLEPerfTest::SetUp();
+    CompilerPerfTestBase::SetUp();
 
-    InitializePoolIndex();
     mAllocator.push();
     SetGlobalPoolAllocator(&mAllocator);
 
     const auto &params = GetParam();
 
     mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, params.output);
-    sh::InitBuiltInResources(&mResources);
-    mResources.FragmentPrecisionHigh = true;
     if (!mTranslator->Init(mResources))
     {
         SafeDelete(mTranslator);
     }
 
     setTestShader(params.shaderSource);
+    mExtraCompileOptions = params.extraCompileOptions;
 }
 
 void CompilerPerfTest::TearDown()
 {
+    if (mTranslator != nullptr)
+    {
+        reportEmitTime();
+        reportAllocatedBytes();
+        reportObjectCodeSize();
+    }
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
     mAllocator.pop();
 
-    FreePoolIndex();
+    CompilerPerfTestBase::TearDown();
+}
+
+ShCompileOptions CompilerPerfTest::getCompileOptions() const
+{
+    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
+                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+    return compileOptions | mExtraCompileOptions;
+}
+
+// Returns the average duration of a compile in seconds.
+double CompilerPerfTest::getAverageCompileTime(ShCompileOptions compileOptions,
+                                               unsigned int compileCount)
+{
+    const char *shaderStrings[] = {mTestShader};
+
+    std::unique_ptr<Timer> timer(CreateTimer());
+    timer->start();
+    for (unsigned int compileIndex = 0; compileIndex < compileCount; ++compileIndex)
+    {
+        mTranslator->compile(shaderStrings, 1, compileOptions);
+    }
+    timer->stop();
+    return timer->getElapsedTime() / compileCount;
+}
+
+// Compiles without SH_OBJECT_CODE stop once the AST has been transformed, so the difference to a
+// full compile is the time spent emitting the translated code.
+void CompilerPerfTest::reportEmitTime()
+{
+    constexpr unsigned int kEmitTimingCompileCount = 64;
+    constexpr double kMicroSecondsPerSecond        = 1e6;
+
+    const ShCompileOptions compileOptions = getCompileOptions();
+    const double fullTime = getAverageCompileTime(compileOptions, kEmitTimingCompileCount);
+    const double withoutEmitTime =
+        getAverageCompileTime(compileOptions & ~SH_OBJECT_CODE, kEmitTimingCompileCount);
 
-    ANGLEPerfTest::TearDown();
+    printResult("compile_without_emit", withoutEmitTime * kMicroSecondsPerSecond, "us", false);
+    printResult("emit", std::max(fullTime - withoutEmitTime, 0.0) * kMicroSecondsPerSecond, "us",
+                true);
+}
+
+// The AST lives in the pool until the end of the compilation, so the memory allocated from the pool
+// until the AST is transformed is close to the peak memory use of a compile.
+void CompilerPerfTest::reportAllocatedBytes()
+{
+    const char *shaderStrings[] = {mTestShader};
+
+    SetGlobalPoolAllocator(&mAllocator);
+    const size_t bytesBefore = mAllocator.getTotalBytes();
+    mTranslator->compileTreeForTesting(shaderStrings, 1, getCompileOptions());
+    const size_t allocatedBytes = mAllocator.getTotalBytes() - bytesBefore;
+
+    printResult("pool_allocated_without_emit", allocatedBytes, "bytes", true);
+}
+
+// The size of the translated code, to compare the variants that optimize the AST with those that
+// don't. Statements are counted by their semicolons.
+void CompilerPerfTest::reportObjectCodeSize()
+{
+    const char *shaderStrings[] = {mTestShader};
+
+    if (!mTranslator->compile(shaderStrings, 1, getCompileOptions()))
+    {
+        return;
+    }
+
+    const TPersistString &objectCode = mTranslator->getInfoSink().obj.str();
+    const size_t statementCount =
+        static_cast<size_t>(std::count(objectCode.begin(), objectCode.end(), ';'));
+
+    printResult("object_code_size", objectCode.size(), "bytes", false);
+    printResult("object_code_statements", statementCount, "count", false);
 }
 
 void CompilerPerfTest::step()
 {
     const char *shaderStrings[] = {mTestShader};
 
-    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
-                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+    const ShCompileOptions compileOptions = getCompileOptions();
 
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
@@ -333,6 +512,14 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id,
+                           SH_OPTIMIZE_AST),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           kTrickyESSL300FragSource,
+                           kTrickyESSL300Id,
+                           SH_OPTIMIZE_AST),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
@@ -342,6 +529,193 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id,
+                           SH_OPTIMIZE_AST),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kTrickyESSL300FragSource,
+                           kTrickyESSL300Id,
+                           SH_OPTIMIZE_AST),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT,
+                           kSimpleESSL100FragSource,
+                           kSimpleESSL100Id,
+                           SH_GENERATE_SPIRV),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id,
+                           SH_GENERATE_SPIRV),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id,
+                           SH_PARALLEL_FUNCTION_OUTPUT),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id,
+                           SH_PARALLEL_FUNCTION_OUTPUT),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id,
+                           SH_OPTIMIZE_AST),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id),
+    CompilerPerfParameters(SH_GLSL_VULKAN_OUTPUT,
+                           GetManyFunctionsESSL300FragSource(),
+                           kManyFunctionsESSL300Id,
+                           SH_PARALLEL_FUNCTION_OUTPUT));
+
+std::ostream &operator<<(std::ostream &stream, const CompilerParameters &p)
+{
+    stream << p.str();
+    return stream;
+}
+
+// Measures the construction of a vertex and a fragment shader compiler with the same resources, the
+// way a context creates them. The built-in symbols that depend on the resources are shared between
+// compilers, so this is mostly the cost of the per-compiler state.
+class CompilerConstructionPerfTest : public CompilerPerfTestBase<CompilerParameters>
+{
+  public:
+    CompilerConstructionPerfTest();
+
+    void step() override;
+};
+
+CompilerConstructionPerfTest::CompilerConstructionPerfTest()
+    : CompilerPerfTestBase("CompilerConstructionPerf", GetParam().str())
+{}
+
+void CompilerConstructionPerfTest::step()
+{
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        for (GLenum shaderType : {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER})
+        {
+            ShHandle compiler = constructCompiler(shaderType);
+            ASSERT_NE(nullptr, compiler);
+            sh::Destruct(compiler);
+        }
+    }
+}
+
+TEST_P(CompilerConstructionPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(CompilerConstructionPerfTest,
+                       CompilerParameters(SH_HLSL_4_1_OUTPUT),
+                       CompilerParameters(SH_GLSL_450_CORE_OUTPUT),
+                       CompilerParameters(SH_ESSL_OUTPUT),
+                       CompilerParameters(SH_GLSL_VULKAN_OUTPUT));
+
+struct CompilerRecompilePerfParameters final : public CompilerParameters
+{
+    CompilerRecompilePerfParameters(ShShaderOutput output, bool reuseParsedShader)
+        : CompilerParameters(output), reuseParsedShader(reuseParsedShader)
+    {
+        testId = CompilerParameters::str();
+        if (reuseParsedShader)
+        {
+            testId += "_ReuseParsedShader";
+        }
+    }
+
+    bool reuseParsedShader;
+    std::string testId;
+};
+
+std::ostream &operator<<(std::ostream &stream, const CompilerRecompilePerfParameters &p)
+{
+    stream << p.testId;
+    return stream;
+}
+
+// Measures compiling the same shader with a few different sets of options, the way a shader is
+// recompiled when the state it is used with needs different workarounds. With
+// SH_REUSE_PARSED_SHADER, only the first of the compiles parses the shader.
+class CompilerRecompilePerfTest : public CompilerPerfTestBase<CompilerRecompilePerfParameters>
+{
+  public:
+    CompilerRecompilePerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    ShHandle mCompiler;
+};
+
+CompilerRecompilePerfTest::CompilerRecompilePerfTest()
+    : CompilerPerfTestBase("CompilerRecompilePerf", GetParam().testId), mCompiler(nullptr)
+{}
+
+void CompilerRecompilePerfTest::SetUp()
+{
+    CompilerPerfTestBase::SetUp();
+
+    mCompiler = constructCompiler(GL_FRAGMENT_SHADER);
+    ASSERT_NE(nullptr, mCompiler);
+}
+
+void CompilerRecompilePerfTest::TearDown()
+{
+    if (mCompiler != nullptr)
+    {
+        sh::Destruct(mCompiler);
+        mCompiler = nullptr;
+    }
+
+    CompilerPerfTestBase::TearDown();
+}
+
+void CompilerRecompilePerfTest::step()
+{
+    const char *shaderStrings[] = {kRealWorldESSL100FragSource};
+
+    const ShCompileOptions kBaseOptions = SH_OBJECT_CODE | SH_VARIABLES;
+    const ShCompileOptions kOptionsList[] = {
+        kBaseOptions,
+        kBaseOptions | SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES,
+        kBaseOptions | SH_CLAMP_INDIRECT_ARRAY_BOUNDS | SH_UNFOLD_SHORT_CIRCUIT,
+        kBaseOptions | SH_REWRITE_FLOAT_UNARY_MINUS_OPERATOR | SH_REMOVE_POW_WITH_CONSTANT_EXPONENT,
+    };
+    const ShCompileOptions reuseOption = GetParam().reuseParsedShader ? SH_REUSE_PARSED_SHADER : 0;
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        for (ShCompileOptions options : kOptionsList)
+        {
+            sh::Compile(mCompiler, shaderStrings, 1, options | reuseOption);
+        }
+    }
+}
+
+TEST_P(CompilerRecompilePerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(CompilerRecompilePerfTest,
+                       CompilerRecompilePerfParameters(SH_HLSL_4_1_OUTPUT, false),
+                       CompilerRecompilePerfParameters(SH_HLSL_4_1_OUTPUT, true),
+                       CompilerRecompilePerfParameters(SH_GLSL_450_CORE_OUTPUT, false),
+                       CompilerRecompilePerfParameters(SH_GLSL_450_CORE_OUTPUT, true),
+                       CompilerRecompilePerfParameters(SH_ESSL_OUTPUT, false),
+                       CompilerRecompilePerfParameters(SH_ESSL_OUTPUT, true),
+                       CompilerRecompilePerfParameters(SH_GLSL_VULKAN_OUTPUT, false),
+                       CompilerRecompilePerfParameters(SH_GLSL_VULKAN_OUTPUT, true));
 
 }  // anonymous namespace
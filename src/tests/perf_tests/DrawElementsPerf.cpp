@@ -7,6 +7,7 @@
 //   Performance tests for ANGLE DrawElements call overhead.
 //
 
+#include <algorithm>
 #include <sstream>
 
 #include "ANGLEPerfTest.h"
@@ -50,11 +51,21 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
         {
             strstr << "_ushort";
         }
+        else if (type == GL_UNSIGNED_BYTE)
+        {
+            strstr << "_ubyte";
+        }
+
+        if (mode == GL_LINE_LOOP)
+        {
+            strstr << "_line_loop";
+        }
 
         return strstr.str();
     }
 
     GLenum type             = GL_UNSIGNED_INT;
+    GLenum mode             = GL_TRIANGLES;
     bool indexBufferChanged = false;
 };
 
@@ -75,6 +86,8 @@ class DrawElementsPerfBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   private:
+    const void *getIndexData() const;
+
     GLuint mProgram     = 0;
     GLuint mBuffer      = 0;
     GLuint mIndexBuffer = 0;
@@ -84,6 +97,7 @@ class DrawElementsPerfBenchmark : public ANGLERenderTest,
     int mCount          = 3 * GetParam().numTris;
     std::vector<GLuint> mIntIndexData;
     std::vector<GLushort> mShortIndexData;
+    std::vector<GLubyte> mByteIndexData;
 };
 
 DrawElementsPerfBenchmark::DrawElementsPerfBenchmark()
@@ -110,6 +124,19 @@ GLsizei ElementTypeSize(GLenum elementType)
     }
 }
 
+const void *DrawElementsPerfBenchmark::getIndexData() const
+{
+    switch (GetParam().type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return mByteIndexData.data();
+        case GL_UNSIGNED_SHORT:
+            return mShortIndexData.data();
+        default:
+            return mIntIndexData.data();
+    }
+}
+
 void DrawElementsPerfBenchmark::initializeBenchmark()
 {
     const auto &params = GetParam();
@@ -127,20 +154,14 @@ void DrawElementsPerfBenchmark::initializeBenchmark()
         ASSERT_GE(std::numeric_limits<GLushort>::max(), mCount);
         mShortIndexData.push_back(static_cast<GLushort>(rand() % mCount));
         mIntIndexData.push_back(rand() % mCount);
+        mByteIndexData.push_back(static_cast<GLubyte>(rand() % std::min(mCount, 256)));
     }
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
 
     mBufferSize = ElementTypeSize(params.type) * mCount;
 
-    if (params.type == GL_UNSIGNED_INT)
-    {
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, mIntIndexData.data());
-    }
-    else
-    {
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, mShortIndexData.data());
-    }
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, getIndexData());
 
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(0);
@@ -182,20 +203,18 @@ void DrawElementsPerfBenchmark::drawBenchmark()
 
     if (params.indexBufferChanged)
     {
-        const void *bufferData = (params.type == GL_UNSIGNED_INT)
-                                     ? static_cast<GLvoid *>(mIntIndexData.data())
-                                     : static_cast<GLvoid *>(mShortIndexData.data());
+        const void *bufferData = getIndexData();
         for (unsigned int it = 0; it < params.iterationsPerStep; it++)
         {
             glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, mBufferSize, bufferData);
-            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type, 0);
+            glDrawElements(params.mode, static_cast<GLsizei>(mCount), params.type, 0);
         }
     }
     else
     {
         for (unsigned int it = 0; it < params.iterationsPerStep; it++)
         {
-            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mCount), params.type, 0);
+            glDrawElements(params.mode, static_cast<GLsizei>(mCount), params.type, 0);
         }
     }
 
@@ -250,13 +269,15 @@ DrawElementsPerfParams DrawElementsPerfOpenGLOrGLESParams(bool indexBufferChange
 
 DrawElementsPerfParams DrawElementsPerfVulkanParams(bool indexBufferChanged,
                                                     bool useNullDevice,
-                                                    GLenum indexType)
+                                                    GLenum indexType,
+                                                    GLenum mode = GL_TRIANGLES)
 {
     DrawElementsPerfParams params;
     params.eglParameters =
         useNullDevice ? angle::egl_platform::VULKAN_NULL() : angle::egl_platform::VULKAN();
     params.indexBufferChanged = indexBufferChanged;
     params.type               = indexType;
+    params.mode               = mode;
 
     // Scale down iterations for slower tests.
     if (indexBufferChanged)
@@ -303,6 +324,11 @@ ANGLE_INSTANTIATE_TEST(DrawElementsPerfBenchmark,
                        DrawElementsPerfVulkanParams(false, true, GL_UNSIGNED_SHORT),
                        DrawElementsPerfVulkanParams(false, false, GL_UNSIGNED_INT),
                        DrawElementsPerfVulkanParams(false, true, GL_UNSIGNED_INT),
+                       DrawElementsPerfVulkanParams(true, false, GL_UNSIGNED_SHORT),
+                       DrawElementsPerfVulkanParams(true, true, GL_UNSIGNED_SHORT),
+                       DrawElementsPerfVulkanParams(true, true, GL_UNSIGNED_BYTE),
+                       DrawElementsPerfVulkanParams(false, false, GL_UNSIGNED_BYTE, GL_LINE_LOOP),
+                       DrawElementsPerfVulkanParams(false, true, GL_UNSIGNED_BYTE, GL_LINE_LOOP),
                        DrawElementsPerfWGLParams(false, GL_UNSIGNED_SHORT));
 
 }  // anonymous namespace
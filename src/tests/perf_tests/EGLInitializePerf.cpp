@@ -5,6 +5,8 @@
 //
 // EGLInitializePerfTest:
 //   Performance test for device creation.
+// EGLCreateContextPerfTest:
+//   Performance test for creating a context and making it current for the first time.
 //
 
 #include "ANGLEPerfTest.h"
@@ -74,11 +76,8 @@ class EGLInitializePerfTest : public ANGLEPerfTest,
     Captures mCaptures;
 };
 
-EGLInitializePerfTest::EGLInitializePerfTest()
-    : ANGLEPerfTest("EGLInitialize", "_run", 1), mOSWindow(nullptr), mDisplay(EGL_NO_DISPLAY)
+EGLDisplay GetPlatformDisplay(const EGLPlatformParameters &platform, OSWindow *osWindow)
 {
-    auto platform = GetParam().eglParameters;
-
     std::vector<EGLint> displayAttributes;
     displayAttributes.push_back(EGL_PLATFORM_ANGLE_TYPE_ANGLE);
     displayAttributes.push_back(platform.renderer);
@@ -95,20 +94,26 @@ EGLInitializePerfTest::EGLInitializePerfTest()
     }
     displayAttributes.push_back(EGL_NONE);
 
-    mOSWindow = OSWindow::New();
-    mOSWindow->initialize("EGLInitialize Test", 64, 64);
-
     auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
         eglGetProcAddress("eglGetPlatformDisplayEXT"));
     if (eglGetPlatformDisplayEXT == nullptr)
     {
         std::cerr << "Error getting platform display!" << std::endl;
-        return;
+        return EGL_NO_DISPLAY;
     }
 
-    mDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE,
-                                        reinterpret_cast<void *>(mOSWindow->getNativeDisplay()),
-                                        &displayAttributes[0]);
+    return eglGetPlatformDisplayEXT(EGL_PLATFORM_ANGLE_ANGLE,
+                                    reinterpret_cast<void *>(osWindow->getNativeDisplay()),
+                                    &displayAttributes[0]);
+}
+
+EGLInitializePerfTest::EGLInitializePerfTest()
+    : ANGLEPerfTest("EGLInitialize", "_run", 1), mOSWindow(nullptr), mDisplay(EGL_NO_DISPLAY)
+{
+    mOSWindow = OSWindow::New();
+    mOSWindow->initialize("EGLInitialize Test", 64, 64);
+
+    mDisplay = GetPlatformDisplay(GetParam().eglParameters, mOSWindow);
 }
 
 void EGLInitializePerfTest::SetUp()
@@ -155,4 +160,114 @@ TEST_P(EGLInitializePerfTest, Run)
 
 ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest, angle::ES2_D3D11(), angle::ES2_VULKAN());
 
+// Each step creates a few contexts on an initialized display, makes them current, which is when
+// their caps and default objects are set up, and destroys them again.
+constexpr size_t kContextsPerStep = 10;
+
+class EGLCreateContextPerfTest : public ANGLEPerfTest,
+                                 public WithParamInterface<angle::PlatformParameters>
+{
+  public:
+    EGLCreateContextPerfTest();
+    ~EGLCreateContextPerfTest();
+
+    void step() override;
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    OSWindow *mOSWindow;
+    EGLDisplay mDisplay;
+    EGLConfig mConfig;
+    EGLSurface mSurface;
+};
+
+EGLCreateContextPerfTest::EGLCreateContextPerfTest()
+    : ANGLEPerfTest("EGLCreateContext", "_run", kContextsPerStep),
+      mOSWindow(nullptr),
+      mDisplay(EGL_NO_DISPLAY),
+      mConfig(nullptr),
+      mSurface(EGL_NO_SURFACE)
+{
+    mOSWindow = OSWindow::New();
+    mOSWindow->initialize("EGLCreateContext Test", 64, 64);
+
+    mDisplay = GetPlatformDisplay(GetParam().eglParameters, mOSWindow);
+}
+
+EGLCreateContextPerfTest::~EGLCreateContextPerfTest()
+{
+    OSWindow::Delete(&mOSWindow);
+}
+
+void EGLCreateContextPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+
+    EGLint majorVersion, minorVersion;
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+              eglInitialize(mDisplay, &majorVersion, &minorVersion));
+
+    const EGLint renderableType =
+        GetParam().majorVersion == 3 ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_ES2_BIT;
+
+    // clang-format off
+    const EGLint configAttribs[] = {
+        EGL_RED_SIZE,        8,
+        EGL_GREEN_SIZE,      8,
+        EGL_BLUE_SIZE,       8,
+        EGL_RENDERABLE_TYPE, renderableType,
+        EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+        EGL_NONE,
+    };
+    // clang-format on
+
+    EGLint numConfigs = 0;
+    ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+              eglChooseConfig(mDisplay, configAttribs, &mConfig, 1, &numConfigs));
+    ASSERT_EQ(1, numConfigs);
+
+    const EGLint surfaceAttribs[] = {EGL_WIDTH, 64, EGL_HEIGHT, 64, EGL_NONE};
+    mSurface = eglCreatePbufferSurface(mDisplay, mConfig, surfaceAttribs);
+    ASSERT_NE(EGL_NO_SURFACE, mSurface);
+}
+
+void EGLCreateContextPerfTest::step()
+{
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, GetParam().majorVersion,
+                                     EGL_NONE};
+
+    for (size_t iteration = 0; iteration < kContextsPerStep; ++iteration)
+    {
+        EGLContext context = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, contextAttribs);
+        ASSERT_NE(EGL_NO_CONTEXT, context);
+        ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+                  eglMakeCurrent(mDisplay, mSurface, mSurface, context));
+        ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE),
+                  eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        ASSERT_EQ(static_cast<EGLBoolean>(EGL_TRUE), eglDestroyContext(mDisplay, context));
+    }
+}
+
+void EGLCreateContextPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    eglDestroySurface(mDisplay, mSurface);
+    eglTerminate(mDisplay);
+}
+
+TEST_P(EGLCreateContextPerfTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(EGLCreateContextPerfTest,
+                       angle::ES2_D3D11(),
+                       angle::ES3_D3D11(),
+                       angle::ES2_OPENGL(),
+                       angle::ES2_VULKAN());
+
 }  // namespace
@@ -0,0 +1,132 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FormatUtilsPerf:
+//   Performance test for internal format info lookups, comparing the generated internal format
+//   index with a nested std::unordered_map.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <unordered_map>
+
+#include "libANGLE/formatutils.h"
+
+volatile GLuint gFormatUtilsPixelBytes = 0;
+
+namespace
+{
+constexpr int kIterationsPerStep = 1000;
+
+// Format and type pairs in the mix seen by texture upload validation.
+constexpr GLenum kQueries[][2] = {
+    {GL_RGBA8, GL_UNSIGNED_BYTE},
+    {GL_RGBA, GL_UNSIGNED_BYTE},
+    {GL_RGB, GL_UNSIGNED_SHORT_5_6_5},
+    {GL_RGBA16F, GL_HALF_FLOAT},
+    {GL_R8, GL_UNSIGNED_BYTE},
+    {GL_DEPTH24_STENCIL8, GL_UNSIGNED_INT_24_8},
+    {GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE},
+    {GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, GL_UNSIGNED_BYTE},
+    {GL_BGRA8_EXT, GL_UNSIGNED_BYTE},
+    {GL_RGB10_A2, GL_UNSIGNED_INT_2_10_10_10_REV},
+    {GL_SRGB8_ALPHA8, GL_UNSIGNED_BYTE},
+    {GL_RGBA32F, GL_FLOAT},
+};
+
+using FormatMap =
+    std::unordered_map<GLenum, std::unordered_map<GLenum, const gl::InternalFormat *>>;
+
+class FormatUtilsPerfTest : public ANGLEPerfTest
+{
+  public:
+    FormatUtilsPerfTest(const std::string &suffix)
+        : ANGLEPerfTest("FormatUtilsPerf", suffix, kIterationsPerStep)
+    {}
+};
+
+class FormatUtilsIndexPerfTest : public FormatUtilsPerfTest
+{
+  public:
+    FormatUtilsIndexPerfTest() : FormatUtilsPerfTest("_index") {}
+    void step() override;
+};
+
+void FormatUtilsIndexPerfTest::step()
+{
+    GLuint pixelBytes = 0;
+    for (int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        for (const auto &query : kQueries)
+        {
+            pixelBytes += gl::GetInternalFormatInfo(query[0], query[1]).pixelBytes;
+        }
+    }
+    gFormatUtilsPixelBytes = pixelBytes;
+}
+
+class FormatUtilsUnorderedMapPerfTest : public FormatUtilsPerfTest
+{
+  public:
+    FormatUtilsUnorderedMapPerfTest();
+    void step() override;
+
+  private:
+    FormatMap mFormatMap;
+};
+
+FormatUtilsUnorderedMapPerfTest::FormatUtilsUnorderedMapPerfTest()
+    : FormatUtilsPerfTest("_unordered_map")
+{
+    for (const std::vector<gl::InternalFormat> &typeInfos : gl::GetInternalFormatInfoTable())
+    {
+        for (const gl::InternalFormat &info : typeInfos)
+        {
+            mFormatMap[info.internalFormat][info.type] = &info;
+        }
+    }
+}
+
+void FormatUtilsUnorderedMapPerfTest::step()
+{
+    GLuint pixelBytes = 0;
+    for (int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        for (const auto &query : kQueries)
+        {
+            // Same lookup as GetInternalFormatInfo before the generated index.
+            auto internalFormatIter = mFormatMap.find(query[0]);
+            if (internalFormatIter == mFormatMap.end())
+            {
+                continue;
+            }
+
+            const auto &typeMap = internalFormatIter->second;
+            if (typeMap.size() == 1 && typeMap.begin()->second->sized)
+            {
+                pixelBytes += typeMap.begin()->second->pixelBytes;
+                continue;
+            }
+
+            auto typeIter = typeMap.find(query[1]);
+            if (typeIter != typeMap.end())
+            {
+                pixelBytes += typeIter->second->pixelBytes;
+            }
+        }
+    }
+    gFormatUtilsPixelBytes = pixelBytes;
+}
+
+TEST_F(FormatUtilsIndexPerfTest, Run)
+{
+    run();
+}
+
+TEST_F(FormatUtilsUnorderedMapPerfTest, Run)
+{
+    run();
+}
+}  // anonymous namespace
@@ -0,0 +1,219 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GLES1DrawPerf:
+//   Performance test for draws through the GLES 1.x fixed-function emulation, with the mix of
+//   lighting, texturing and fog used by the gles1 samples and a matrix change between each draw.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 100;
+
+struct GLES1DrawParams final : public RenderTestParams
+{
+    GLES1DrawParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        majorVersion = 1;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+    }
+
+    std::string suffix() const override;
+
+    bool lighting = false;
+    bool texture  = false;
+    bool fog      = false;
+};
+
+std::string GLES1DrawParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+
+    if (!lighting && !texture && !fog)
+    {
+        strstr << "_unlit";
+    }
+    if (lighting)
+    {
+        strstr << "_lighting";
+    }
+    if (texture)
+    {
+        strstr << "_texture";
+    }
+    if (fog)
+    {
+        strstr << "_fog";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const GLES1DrawParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+class GLES1DrawBenchmark : public ANGLERenderTest,
+                           public ::testing::WithParamInterface<GLES1DrawParams>
+{
+  public:
+    GLES1DrawBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mBuffer  = 0;
+    GLuint mTexture = 0;
+    float mRotation = 0.0f;
+};
+
+GLES1DrawBenchmark::GLES1DrawBenchmark() : ANGLERenderTest("GLES1Draw", GetParam()) {}
+
+void GLES1DrawBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    // Position, normal and texture coordinate of each vertex of a quad.
+    constexpr GLfloat kVertexData[] = {
+        -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,  // Vertex 0
+        0.5f,  -0.5f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f,  // Vertex 1
+        -0.5f, 0.5f,  0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f,  // Vertex 2
+        0.5f,  0.5f,  0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f,  // Vertex 3
+    };
+    constexpr GLsizei kStride = 8 * sizeof(GLfloat);
+
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertexData), kVertexData, GL_STATIC_DRAW);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, kStride, nullptr);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glNormalPointer(GL_FLOAT, kStride, reinterpret_cast<const void *>(3 * sizeof(GLfloat)));
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glTexCoordPointer(2, GL_FLOAT, kStride, reinterpret_cast<const void *>(6 * sizeof(GLfloat)));
+
+    glColor4f(0.2f, 0.6f, 0.8f, 1.0f);
+
+    if (params.lighting)
+    {
+        constexpr GLfloat kMaterialAmbient[]  = {0.7f, 0.4f, 0.2f, 1.0f};
+        constexpr GLfloat kMaterialSpecular[] = {0.5f, 0.5f, 0.5f, 1.0f};
+        constexpr GLfloat kMaterialDiffuse[]  = {0.3f, 0.4f, 0.6f, 1.0f};
+        constexpr GLfloat kLightPosition[]    = {0.0f, 1.0f, 1.0f, 0.0f};
+
+        glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, kMaterialAmbient);
+        glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, kMaterialSpecular);
+        glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, kMaterialDiffuse);
+        glLightfv(GL_LIGHT0, GL_POSITION, kLightPosition);
+
+        glEnable(GL_LIGHTING);
+        glEnable(GL_LIGHT0);
+    }
+
+    if (params.texture)
+    {
+        constexpr GLubyte kPixels[] = {
+            255, 0, 0, 255, 0, 255, 0, 255, 0, 0, 255, 255, 255, 255, 0, 255,
+        };
+
+        glGenTextures(1, &mTexture);
+        glBindTexture(GL_TEXTURE_2D, mTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, kPixels);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+
+        glEnable(GL_TEXTURE_2D);
+    }
+
+    if (params.fog)
+    {
+        constexpr GLfloat kFogColor[] = {0.5f, 0.5f, 0.5f, 1.0f};
+
+        glFogf(GL_FOG_MODE, GL_EXP);
+        glFogf(GL_FOG_DENSITY, 0.5f);
+        glFogfv(GL_FOG_COLOR, kFogColor);
+
+        glEnable(GL_FOG);
+    }
+
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void GLES1DrawBenchmark::destroyBenchmark()
+{
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteTextures(1, &mTexture);
+}
+
+void GLES1DrawBenchmark::drawBenchmark()
+{
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    const auto &params = GetParam();
+
+    // Like the samples, every draw gets its own modelview matrix.
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        glPushMatrix();
+        glRotatef(mRotation + static_cast<float>(it), 0.0f, 0.0f, 1.0f);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        glPopMatrix();
+    }
+
+    mRotation += 0.5f;
+
+    ASSERT_GL_NO_ERROR();
+}
+
+GLES1DrawParams CombineFeatures(const EGLPlatformParameters &eglParameters,
+                                bool lighting,
+                                bool texture,
+                                bool fog)
+{
+    GLES1DrawParams params;
+    params.eglParameters = eglParameters;
+    params.lighting      = lighting;
+    params.texture       = texture;
+    params.fog           = fog;
+    return params;
+}
+
+}  // namespace
+
+TEST_P(GLES1DrawBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(GLES1DrawBenchmark,
+                       CombineFeatures(egl_platform::D3D11(), false, false, false),
+                       CombineFeatures(egl_platform::D3D11(), true, true, true),
+                       CombineFeatures(egl_platform::OPENGL_OR_GLES(false), false, false, false),
+                       CombineFeatures(egl_platform::OPENGL_OR_GLES(false), true, false, false),
+                       CombineFeatures(egl_platform::OPENGL_OR_GLES(false), false, true, false),
+                       CombineFeatures(egl_platform::OPENGL_OR_GLES(false), true, true, true),
+                       CombineFeatures(egl_platform::VULKAN(), false, false, false),
+                       CombineFeatures(egl_platform::VULKAN(), true, true, true));
@@ -12,6 +12,7 @@
 #include <array>
 
 #include "common/vector_utils.h"
+#include "platform/FeaturesVk.h"
 #include "util/shader_utils.h"
 
 using namespace angle;
@@ -77,11 +78,45 @@ struct LinkProgramParams final : public RenderTestParams
             strstr << "_null";
         }
 
+        if (directSPIRVGeneration)
+        {
+            strstr << "_spirv";
+        }
+
+        if (shaderCache)
+        {
+            strstr << "_shader_cache";
+        }
+
+        if (unusedVertexOutput)
+        {
+            strstr << "_unused_output";
+        }
+
+        if (removeUnusedVertexOutputs)
+        {
+            strstr << "_remove_unused_outputs";
+        }
+
         return strstr.str();
     }
 
     TaskOption taskOption;
     ThreadOption threadOption;
+
+    // Whether the Vulkan back-end generates SPIR-V in the translator instead of using glslang.
+    bool directSPIRVGeneration = false;
+
+    // Whether the program cache is enabled, so that the compiles after the first one load the
+    // compiled shaders from the cache.
+    bool shaderCache = false;
+
+    // Whether the vertex shader has an output that the fragment shader doesn't read.
+    bool unusedVertexOutput = false;
+
+    // Whether the Vulkan back-end translates the vertex shader again without its unused outputs
+    // when the program is linked.
+    bool removeUnusedVertexOutputs = false;
 };
 
 std::ostream &operator<<(std::ostream &os, const LinkProgramParams &params)
@@ -100,6 +135,12 @@ class LinkProgramBenchmark : public ANGLERenderTest,
     void destroyBenchmark() override;
     void drawBenchmark() override;
 
+    void overrideFeaturesVk(FeaturesVk *featuresVk) override
+    {
+        featuresVk->directSPIRVGeneration     = GetParam().directSPIRVGeneration;
+        featuresVk->removeUnusedVertexOutputs = GetParam().removeUnusedVertexOutputs;
+    }
+
   protected:
     GLuint mVertexBuffer = 0;
 };
@@ -108,6 +149,22 @@ LinkProgramBenchmark::LinkProgramBenchmark() : ANGLERenderTest("LinkProgram", Ge
 
 void LinkProgramBenchmark::initializeBenchmark()
 {
+    if (GetParam().shaderCache)
+    {
+        EGLDisplay display = eglGetCurrentDisplay();
+        if (!CheckExtensionExists(eglQueryString(display, EGL_EXTENSIONS),
+                                  "EGL_ANGLE_program_cache_control"))
+        {
+            std::cout << "Test skipped because EGL_ANGLE_program_cache_control is not available."
+                      << std::endl;
+            mSkipTest = true;
+            return;
+        }
+
+        constexpr EGLint kCacheSize = 0x100000;
+        eglProgramCacheResizeANGLE(display, kCacheSize, EGL_PROGRAM_CACHE_RESIZE_ANGLE);
+    }
+
     if (GetParam().threadOption == ThreadOption::SingleThread)
     {
         glMaxShaderCompilerThreadsKHR(0);
@@ -135,12 +192,21 @@ void LinkProgramBenchmark::drawBenchmark()
         "void main() {\n"
         "    gl_Position = vec4(position, 0, 1);\n"
         "}";
+    static const char *vertexShaderWithUnusedOutput =
+        "attribute vec2 position;\n"
+        "varying vec4 unused;\n"
+        "void main() {\n"
+        "    unused = vec4(position * 0.5, position * 2.0);\n"
+        "    gl_Position = vec4(position, 0, 1);\n"
+        "}";
     static const char *fragmentShader =
         "precision mediump float;\n"
         "void main() {\n"
         "    gl_FragColor = vec4(1, 0, 0, 1);\n"
         "}";
-    GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexShader);
+    const char *vertexShaderSource =
+        GetParam().unusedVertexOutput ? vertexShaderWithUnusedOutput : vertexShader;
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, vertexShaderSource);
     GLuint fs = CompileShader(GL_FRAGMENT_SHADER, fragmentShader);
 
     ASSERT_NE(0u, vs);
@@ -202,6 +268,34 @@ LinkProgramParams LinkProgramVulkanParams(TaskOption taskOption, ThreadOption th
     return params;
 }
 
+LinkProgramParams LinkProgramShaderCacheParams(const EGLPlatformParameters &eglParameters)
+{
+    LinkProgramParams params(TaskOption::CompileOnly, ThreadOption::SingleThread);
+    params.eglParameters = eglParameters;
+    params.shaderCache   = true;
+    return params;
+}
+
+LinkProgramParams LinkProgramVulkanNullParams(TaskOption taskOption,
+                                              ThreadOption threadOption,
+                                              bool directSPIRVGeneration)
+{
+    LinkProgramParams params(taskOption, threadOption);
+    params.eglParameters         = VULKAN_NULL();
+    params.directSPIRVGeneration = directSPIRVGeneration;
+    return params;
+}
+
+LinkProgramParams LinkProgramUnusedOutputParams(const EGLPlatformParameters &eglParameters,
+                                               bool removeUnusedVertexOutputs)
+{
+    LinkProgramParams params(TaskOption::CompileAndLink, ThreadOption::SingleThread);
+    params.eglParameters             = eglParameters;
+    params.unusedVertexOutput        = true;
+    params.removeUnusedVertexOutputs = removeUnusedVertexOutputs;
+    return params;
+}
+
 TEST_P(LinkProgramBenchmark, Run)
 {
     run();
@@ -224,6 +318,16 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramD3D9Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramVulkanNullParams(TaskOption::CompileAndLink, ThreadOption::SingleThread, false),
+    LinkProgramVulkanNullParams(TaskOption::CompileAndLink, ThreadOption::SingleThread, true),
+    LinkProgramShaderCacheParams(D3D11()),
+    LinkProgramShaderCacheParams(OPENGL_OR_GLES(false)),
+    LinkProgramShaderCacheParams(VULKAN()),
+    LinkProgramShaderCacheParams(VULKAN_NULL()),
+    LinkProgramUnusedOutputParams(VULKAN(), false),
+    LinkProgramUnusedOutputParams(VULKAN(), true),
+    LinkProgramUnusedOutputParams(VULKAN_NULL(), false),
+    LinkProgramUnusedOutputParams(VULKAN_NULL(), true));
 
 }  // anonymous namespace
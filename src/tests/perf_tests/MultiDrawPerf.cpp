@@ -0,0 +1,246 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultiDrawPerf:
+//   Performance tests for ANGLE_multi_draw call overhead, compared against issuing the same
+//   sub-draws one draw call at a time.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "DrawCallPerfParams.h"
+#include "test_utils/draw_call_perf_utils.h"
+
+namespace
+{
+constexpr GLsizei kDrawCount = 64;
+
+struct MultiDrawPerfParams final : public DrawCallPerfParams
+{
+    // Common default options
+    MultiDrawPerfParams()
+    {
+        runTimeSeconds = 5.0;
+        numTris        = kDrawCount;
+
+        // Every iteration issues kDrawCount sub-draws.
+        iterationsPerStep /= 10;
+    }
+
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+
+        strstr << DrawCallPerfParams::suffix();
+
+        strstr << (indexed ? "_elements" : "_arrays");
+        strstr << (useMultiDraw ? "_multi_draw" : "_loop");
+
+        return strstr.str();
+    }
+
+    bool indexed      = false;
+    bool useMultiDraw = true;
+};
+
+std::ostream &operator<<(std::ostream &os, const MultiDrawPerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+class MultiDrawPerfBenchmark : public ANGLERenderTest,
+                               public ::testing::WithParamInterface<MultiDrawPerfParams>
+{
+  public:
+    MultiDrawPerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram     = 0;
+    GLuint mBuffer      = 0;
+    GLuint mIndexBuffer = 0;
+    GLuint mFBO         = 0;
+    GLuint mTexture     = 0;
+
+    // One triangle per sub-draw.
+    std::vector<GLint> mFirsts;
+    std::vector<GLsizei> mCounts;
+    std::vector<const GLvoid *> mIndices;
+};
+
+MultiDrawPerfBenchmark::MultiDrawPerfBenchmark() : ANGLERenderTest("MultiDrawPerf", GetParam())
+{
+    addExtensionPrerequisite("GL_ANGLE_multi_draw");
+}
+
+void MultiDrawPerfBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    mProgram = SetupSimpleDrawProgram();
+    ASSERT_NE(0u, mProgram);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+    mBuffer = Create2DTriangleBuffer(params.numTris, GL_STATIC_DRAW);
+
+    std::vector<GLushort> indexData;
+    for (GLsizei drawID = 0; drawID < kDrawCount; ++drawID)
+    {
+        GLushort firstIndex = static_cast<GLushort>(drawID * 3);
+        mFirsts.push_back(firstIndex);
+        mCounts.push_back(3);
+        mIndices.push_back(reinterpret_cast<const GLvoid *>(firstIndex * sizeof(GLushort)));
+
+        indexData.push_back(firstIndex);
+        indexData.push_back(firstIndex + 1);
+        indexData.push_back(firstIndex + 2);
+    }
+
+    glGenBuffers(1, &mIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size() * sizeof(GLushort), indexData.data(),
+                 GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+
+    // Set the viewport
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    if (params.useFBO)
+    {
+        CreateColorFBO(getWindow()->getWidth(), getWindow()->getHeight(), &mTexture, &mFBO);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void MultiDrawPerfBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteBuffers(1, &mIndexBuffer);
+    glDeleteTextures(1, &mTexture);
+    glDeleteFramebuffers(1, &mFBO);
+}
+
+void MultiDrawPerfBenchmark::drawBenchmark()
+{
+    // This workaround fixes a huge queue of graphics commands accumulating on the GL
+    // back-end. The GL back-end doesn't have a proper NULL device at the moment.
+    // TODO(jmadill): Remove this when/if we ever get a proper OpenGL NULL device.
+    const auto &eglParams = GetParam().eglParameters;
+    if (eglParams.deviceType != EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE ||
+        (eglParams.renderer != EGL_PLATFORM_ANGLE_TYPE_OPENGL_ANGLE &&
+         eglParams.renderer != EGL_PLATFORM_ANGLE_TYPE_OPENGLES_ANGLE))
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    const MultiDrawPerfParams &params = GetParam();
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        if (params.indexed && params.useMultiDraw)
+        {
+            glMultiDrawElementsANGLE(GL_TRIANGLES, mCounts.data(), GL_UNSIGNED_SHORT,
+                                     mIndices.data(), kDrawCount);
+        }
+        else if (params.indexed)
+        {
+            for (GLsizei drawID = 0; drawID < kDrawCount; ++drawID)
+            {
+                glDrawElements(GL_TRIANGLES, mCounts[drawID], GL_UNSIGNED_SHORT, mIndices[drawID]);
+            }
+        }
+        else if (params.useMultiDraw)
+        {
+            glMultiDrawArraysANGLE(GL_TRIANGLES, mFirsts.data(), mCounts.data(), kDrawCount);
+        }
+        else
+        {
+            for (GLsizei drawID = 0; drawID < kDrawCount; ++drawID)
+            {
+                glDrawArrays(GL_TRIANGLES, mFirsts[drawID], mCounts[drawID]);
+            }
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+MultiDrawPerfParams MultiDrawPerfD3D11Params(bool indexed, bool useMultiDraw, bool useNullDevice)
+{
+    MultiDrawPerfParams params;
+    params.eglParameters =
+        useNullDevice ? angle::egl_platform::D3D11_NULL() : angle::egl_platform::D3D11();
+    params.indexed      = indexed;
+    params.useMultiDraw = useMultiDraw;
+    return params;
+}
+
+MultiDrawPerfParams MultiDrawPerfOpenGLOrGLESParams(bool indexed,
+                                                    bool useMultiDraw,
+                                                    bool useNullDevice)
+{
+    MultiDrawPerfParams params;
+    params.eglParameters = angle::egl_platform::OPENGL_OR_GLES(useNullDevice);
+    params.indexed       = indexed;
+    params.useMultiDraw  = useMultiDraw;
+    return params;
+}
+
+MultiDrawPerfParams MultiDrawPerfVulkanParams(bool indexed, bool useMultiDraw, bool useNullDevice)
+{
+    MultiDrawPerfParams params;
+    params.eglParameters =
+        useNullDevice ? angle::egl_platform::VULKAN_NULL() : angle::egl_platform::VULKAN();
+    params.indexed      = indexed;
+    params.useMultiDraw = useMultiDraw;
+    return params;
+}
+
+// The NULL back-end reports how many back-end calls the sub-draws took.
+MultiDrawPerfParams MultiDrawPerfNULLParams(bool indexed, bool useMultiDraw)
+{
+    MultiDrawPerfParams params;
+    params.eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    params.indexed       = indexed;
+    params.useMultiDraw  = useMultiDraw;
+    return params;
+}
+
+TEST_P(MultiDrawPerfBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(MultiDrawPerfBenchmark,
+                       MultiDrawPerfD3D11Params(false, false, true),
+                       MultiDrawPerfD3D11Params(false, true, true),
+                       MultiDrawPerfD3D11Params(true, false, true),
+                       MultiDrawPerfD3D11Params(true, true, true),
+                       MultiDrawPerfOpenGLOrGLESParams(false, false, false),
+                       MultiDrawPerfOpenGLOrGLESParams(false, true, false),
+                       MultiDrawPerfOpenGLOrGLESParams(true, false, false),
+                       MultiDrawPerfOpenGLOrGLESParams(true, true, false),
+                       MultiDrawPerfVulkanParams(false, false, false),
+                       MultiDrawPerfVulkanParams(false, true, false),
+                       MultiDrawPerfVulkanParams(true, false, false),
+                       MultiDrawPerfVulkanParams(true, true, false),
+                       MultiDrawPerfVulkanParams(false, false, true),
+                       MultiDrawPerfVulkanParams(false, true, true),
+                       MultiDrawPerfNULLParams(false, false),
+                       MultiDrawPerfNULLParams(false, true),
+                       MultiDrawPerfNULLParams(true, false),
+                       MultiDrawPerfNULLParams(true, true));
+
+}  // anonymous namespace
@@ -0,0 +1,197 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessorPerfTest:
+//   Performance test for the shader preprocessor. Each step preprocesses the same macro-heavy
+//   shader, and the number of tokens produced per second is reported next to the step time.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+
+namespace
+{
+
+// Object-like macros expanded many times, like constants in generated shaders.
+const char *kObjectMacrosSource = R"(
+#define LIGHT_COUNT 4
+#define PI 3.14159265
+#define TWO_PI (2.0 * PI)
+#define AMBIENT vec3(0.1, 0.1, 0.1)
+#define SPECULAR_POWER 32.0
+#define GAMMA vec3(1.0 / 2.2)
+precision mediump float;
+uniform vec3 lightColors[LIGHT_COUNT];
+varying vec3 normal;
+void main()
+{
+    vec3 color = AMBIENT;
+    color += lightColors[0] * PI + lightColors[1] * TWO_PI + AMBIENT * SPECULAR_POWER;
+    color += lightColors[2] * PI + lightColors[3] * TWO_PI + AMBIENT * SPECULAR_POWER;
+    color += normal * PI + normal * TWO_PI + AMBIENT * SPECULAR_POWER + GAMMA;
+    color += normal * PI + normal * TWO_PI + AMBIENT * SPECULAR_POWER + GAMMA;
+    color += normal * PI + normal * TWO_PI + AMBIENT * SPECULAR_POWER + GAMMA;
+    color += normal * PI + normal * TWO_PI + AMBIENT * SPECULAR_POWER + GAMMA;
+    gl_FragColor = vec4(pow(color, GAMMA), 1.0);
+}
+)";
+
+const char *kObjectMacrosId = "ObjectMacros";
+
+// Nested function-like macros, like the ones material shader generators use to select features.
+const char *kFunctionMacrosSource = R"(
+#define SATURATE(x) clamp(x, 0.0, 1.0)
+#define LERP(a, b, t) mix(a, b, SATURATE(t))
+#define DIFFUSE(n, l) SATURATE(dot(n, l))
+#define SPECULAR(n, h, p) pow(SATURATE(dot(n, h)), p)
+#define LIGHT(n, l, h, c) (c * (DIFFUSE(n, l) + SPECULAR(n, h, 32.0)))
+#define FOG(c, d) LERP(c, vec3(0.5, 0.6, 0.7), d * 0.01)
+precision mediump float;
+uniform vec3 lightDirs[4];
+uniform vec3 halfVectors[4];
+uniform vec3 lightColors[4];
+varying vec3 normal;
+varying float depth;
+void main()
+{
+    vec3 n = normalize(normal);
+    vec3 color = LIGHT(n, lightDirs[0], halfVectors[0], lightColors[0]);
+    color += LIGHT(n, lightDirs[1], halfVectors[1], lightColors[1]);
+    color += LIGHT(n, lightDirs[2], halfVectors[2], lightColors[2]);
+    color += LIGHT(n, lightDirs[3], halfVectors[3], lightColors[3]);
+    color = FOG(color, depth);
+    color = FOG(LERP(color, SATURATE(color * 2.0), 0.5), depth);
+    gl_FragColor = vec4(SATURATE(color), 1.0);
+}
+)";
+
+const char *kFunctionMacrosId = "FunctionMacros";
+
+constexpr int kNumIterationsPerStep = 10;
+
+class NullDiagnostics : public angle::pp::Diagnostics
+{
+  protected:
+    void print(ID id, const angle::pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public angle::pp::DirectiveHandler
+{
+  public:
+    void handleError(const angle::pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const angle::pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {}
+    void handleExtension(const angle::pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {}
+    void handleVersion(const angle::pp::SourceLocation &loc, int version) override {}
+};
+
+struct PreprocessorPerfParameters
+{
+    PreprocessorPerfParameters(const char *shaderSource, const char *shaderSourceId)
+        : shaderSource(shaderSource), testId(shaderSourceId)
+    {}
+
+    const char *shaderSource;
+    std::string testId;
+};
+
+std::ostream &operator<<(std::ostream &stream, const PreprocessorPerfParameters &p)
+{
+    stream << p.testId;
+    return stream;
+}
+
+class PreprocessorPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<PreprocessorPerfParameters>
+{
+  public:
+    PreprocessorPerfTest();
+
+    void step() override;
+
+    void TearDown() override;
+
+  private:
+    size_t preprocess();
+
+    size_t mTokensPerIteration;
+};
+
+PreprocessorPerfTest::PreprocessorPerfTest()
+    : ANGLEPerfTest("PreprocessorPerf", GetParam().testId, kNumIterationsPerStep),
+      mTokensPerIteration(0)
+{}
+
+size_t PreprocessorPerfTest::preprocess()
+{
+    NullDiagnostics diagnostics;
+    NullDirectiveHandler directiveHandler;
+    angle::pp::Preprocessor preprocessor(&diagnostics, &directiveHandler,
+                                         angle::pp::PreprocessorSettings(SH_GLES2_SPEC));
+
+    const char *shaderStrings[] = {GetParam().shaderSource};
+    if (!preprocessor.init(1, shaderStrings, nullptr))
+    {
+        return 0;
+    }
+
+    size_t tokenCount = 0;
+    angle::pp::Token token;
+    preprocessor.lex(&token);
+    while (token.type != angle::pp::Token::LAST)
+    {
+        ++tokenCount;
+        preprocessor.lex(&token);
+    }
+    return tokenCount;
+}
+
+void PreprocessorPerfTest::step()
+{
+    for (int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        mTokensPerIteration = preprocess();
+    }
+}
+
+void PreprocessorPerfTest::TearDown()
+{
+    // The timer holds the duration of the last trial.
+    const double elapsedTime = getTimer()->getElapsedTime();
+    if (elapsedTime > 0.0)
+    {
+        const double tokenCount = static_cast<double>(mTokensPerIteration) *
+                                  kNumIterationsPerStep * getNumStepsPerformed();
+        printResult("tokens_per_second", tokenCount / elapsedTime, "tokens/s", true);
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+TEST_P(PreprocessorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        PreprocessorPerfTest,
+                        ::testing::Values(PreprocessorPerfParameters(kObjectMacrosSource,
+                                                                     kObjectMacrosId),
+                                          PreprocessorPerfParameters(kFunctionMacrosSource,
+                                                                     kFunctionMacrosId)));
+
+}  // anonymous namespace
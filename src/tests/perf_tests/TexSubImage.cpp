@@ -286,6 +286,13 @@ TexSubImageParams VulkanParams()
     return params;
 }
 
+TexSubImageParams VulkanNullParams()
+{
+    TexSubImageParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    return params;
+}
+
 }  // namespace
 
 TEST_P(TexSubImageBenchmark, Run)
@@ -297,4 +304,5 @@ ANGLE_INSTANTIATE_TEST(TexSubImageBenchmark,
                        D3D11Params(),
                        D3D9Params(),
                        OpenGLOrGLESParams(),
-                       VulkanParams());
+                       VulkanParams(),
+                       VulkanNullParams());
@@ -4,7 +4,7 @@
 // found in the LICENSE file.
 //
 // UniformsBenchmark:
-//   Performance test for setting uniform data.
+//   Performance test for setting uniform data and for looking up uniform locations.
 //
 
 #include "ANGLEPerfTest.h"
@@ -65,6 +65,9 @@ struct UniformsParams final : public RenderTestParams
     DataType dataType       = DataType::VEC4;
     DataMode dataMode       = DataMode::REPEAT;
     ProgramMode programMode = ProgramMode::SINGLE;
+
+    // Measures glGetUniformLocation instead of setting uniform data.
+    bool locationLookup = false;
 };
 
 std::ostream &operator<<(std::ostream &os, const UniformsParams &params)
@@ -98,7 +101,11 @@ std::string UniformsParams::suffix() const
         strstr << "_multiprogram";
     }
 
-    if (dataMode == DataMode::REPEAT)
+    if (locationLookup)
+    {
+        strstr << "_location_lookup";
+    }
+    else if (dataMode == DataMode::REPEAT)
     {
         strstr << "_repeating";
     }
@@ -121,9 +128,11 @@ class UniformsBenchmark : public ANGLERenderTest,
 
     template <bool MultiProgram, typename SetUniformFunc>
     void drawLoop(const SetUniformFunc &setUniformsFunc);
+    void lookupLoop();
 
     std::array<GLuint, 2> mPrograms;
     std::vector<GLuint> mUniformLocations;
+    std::vector<std::string> mUniformNames;
 
     using MatrixData = std::array<std::vector<Matrix4>, 2>;
     MatrixData mMatrixData;
@@ -290,6 +299,7 @@ void UniformsBenchmark::initShaders()
         ASSERT_NE(-1, location);
         ASSERT_EQ(location, glGetUniformLocation(mPrograms[1], name.c_str()));
         mUniformLocations.push_back(location);
+        mUniformNames.push_back(name);
     }
     for (size_t i = 0; i < params.numFragmentUniforms; ++i)
     {
@@ -298,6 +308,7 @@ void UniformsBenchmark::initShaders()
         ASSERT_NE(-1, location);
         ASSERT_EQ(location, glGetUniformLocation(mPrograms[1], name.c_str()));
         mUniformLocations.push_back(location);
+        mUniformNames.push_back(name);
     }
 
     // Use the program object
@@ -335,11 +346,35 @@ void UniformsBenchmark::drawLoop(const SetUniformFunc &setUniformsFunc)
     }
 }
 
+void UniformsBenchmark::lookupLoop()
+{
+    const auto &params = GetParam();
+
+    GLuint mismatches = 0;
+    for (size_t it = 0; it < params.iterationsPerStep; ++it)
+    {
+        for (size_t uniform = 0; uniform < mUniformNames.size(); ++uniform)
+        {
+            GLint location = glGetUniformLocation(mPrograms[0], mUniformNames[uniform].c_str());
+            if (static_cast<GLuint>(location) != mUniformLocations[uniform])
+            {
+                ++mismatches;
+            }
+        }
+    }
+
+    ASSERT_EQ(0u, mismatches);
+}
+
 void UniformsBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
 
-    if (params.dataType == DataType::MAT4)
+    if (params.locationLookup)
+    {
+        lookupLoop();
+    }
+    else if (params.dataType == DataType::MAT4)
     {
         auto setFunc = [](const std::vector<GLuint> &locations, const MatrixData &matrixData,
                           size_t uniform, size_t frameIndex) {
@@ -383,6 +418,14 @@ UniformsParams VectorUniforms(const EGLPlatformParameters &egl,
     return params;
 }
 
+UniformsParams LocationLookup(const EGLPlatformParameters &egl)
+{
+    UniformsParams params;
+    params.eglParameters  = egl;
+    params.locationLookup = true;
+    return params;
+}
+
 UniformsParams MatrixUniforms(const EGLPlatformParameters &egl, DataMode dataMode)
 {
     UniformsParams params;
@@ -414,4 +457,7 @@ ANGLE_INSTANTIATE_TEST(UniformsBenchmark,
                        VectorUniforms(OPENGL_OR_GLES(true), DataMode::UPDATE),
                        MatrixUniforms(D3D11(), DataMode::UPDATE),
                        MatrixUniforms(OPENGL_OR_GLES(false), DataMode::UPDATE),
-                       VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE));
+                       VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE),
+                       LocationLookup(D3D11_NULL()),
+                       LocationLookup(OPENGL_OR_GLES(true)),
+                       LocationLookup(VULKAN_NULL()));
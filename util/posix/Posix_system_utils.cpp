@@ -90,4 +90,14 @@ bool StabilizeCPUForBenchmarking()
     return false;
 #endif
 }
+
+double GetCurrentProcessCpuTime()
+{
+    timespec cpuTime;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime) != 0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(cpuTime.tv_sec) + static_cast<double>(cpuTime.tv_nsec) * 1e-9;
+}
 }  // namespace angle
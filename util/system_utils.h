@@ -26,6 +26,10 @@ ANGLE_UTIL_EXPORT void WriteDebugMessage(const char *format, ...);
 
 // Set thread affinity and priority.
 ANGLE_UTIL_EXPORT bool StabilizeCPUForBenchmarking();
+
+// Returns the CPU time used by all the threads of the process so far, in seconds, or 0 where that
+// isn't available.
+ANGLE_UTIL_EXPORT double GetCurrentProcessCpuTime();
 }  // namespace angle
 
 #endif  // UTIL_SYSTEM_UTILS_H_
@@ -36,4 +36,23 @@ bool StabilizeCPUForBenchmarking()
 
     return true;
 }
+
+double GetCurrentProcessCpuTime()
+{
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) ==
+        FALSE)
+    {
+        return 0.0;
+    }
+
+    // FILETIMEs count 100 nanosecond intervals.
+    auto toSeconds = [](const FILETIME &time) {
+        ULARGE_INTEGER value;
+        value.LowPart  = time.dwLowDateTime;
+        value.HighPart = time.dwHighDateTime;
+        return static_cast<double>(value.QuadPart) * 1e-7;
+    };
+    return toSeconds(kernelTime) + toSeconds(userTime);
+}
 }  // namespace angle
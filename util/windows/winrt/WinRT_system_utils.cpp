@@ -24,4 +24,10 @@ bool StabilizeCPUForBenchmarking()
     // No equivalent to this in WinRT
     return true;
 }
+
+double GetCurrentProcessCpuTime()
+{
+    // No equivalent to this in WinRT
+    return 0.0;
+}
 }  // namespace angle